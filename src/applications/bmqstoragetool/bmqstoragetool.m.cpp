@@ -188,6 +188,19 @@ parseArgs(CommandLineArguments& arguments, int argc, const char* argv[])
          "limit of queues to display in CSL file summary",
          balcl::TypeInfo(&arguments.d_cslSummaryQueuesLimit),
          balcl::OccurrenceInfo(50)},
+        {"threads",
+         "threads",
+         "number of threads to scan the journal file with when searching "
+         "GUIDs or compacting",
+         balcl::TypeInfo(&arguments.d_threads),
+         balcl::OccurrenceInfo(1)},
+        {"compact-to",
+         "compacted file set",
+         "path prefix of the compacted journal and data files to write, "
+         "containing only the outstanding messages and queueOp records "
+         "(requires the data file)",
+         balcl::TypeInfo(&arguments.d_compactTo),
+         balcl::OccurrenceInfo::e_OPTIONAL},
         {"h|help",
          "help",
          "print usage)",
@@ -16,6 +16,7 @@
 // bmqstoragetool
 #include <m_bmqstoragetool_commandprocessorfactory.h>
 #include <m_bmqstoragetool_cslfileprocessor.h>
+#include <m_bmqstoragetool_journalcompactor.h>
 #include <m_bmqstoragetool_journalfileprocessor.h>
 #include <m_bmqstoragetool_searchresultfactory.h>
 
@@ -59,6 +60,12 @@ CommandProcessorFactory::createCommandProcessor(
                                           alloc),
             alloc);  // RETURN
     }
+    else if (!params->d_compactTo.empty()) {
+        // Create JournalCompactor
+        return bslma::ManagedPtr<CommandProcessor>(
+            new (*alloc) JournalCompactor(params, fileManager, ostream, alloc),
+            alloc);  // RETURN
+    }
     else {
         // Create printer
         bsl::shared_ptr<Printer> printer = createPrinter(params->d_printMode,
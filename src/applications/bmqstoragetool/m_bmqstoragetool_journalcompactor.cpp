@@ -0,0 +1,366 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqstoragetool
+#include <m_bmqstoragetool_journalcompactor.h>
+
+// MQB
+#include <mqbs_datafileiterator.h>
+#include <mqbs_filestoreprotocol.h>
+#include <mqbs_filestoreprotocolutil.h>
+#include <mqbs_journalfileiterator.h>
+#include <mqbs_mappedfiledescriptor.h>
+#include <mqbs_offsetptr.h>
+
+// BMQ
+#include <bmqp_protocol.h>
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_functional.h>
+#include <bsl_string.h>
+#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+#include <bslmt_threadgroup.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace m_bmqstoragetool {
+
+namespace {
+
+typedef bsl::unordered_set<bmqt::MessageGUID> GuidsSet;
+
+/// Load into the specified `messages` the GUIDs of the messages added by the
+/// records, from the specified `beginIndex` included to the specified
+/// `endIndex` excluded, of the journal file mapped by the specified `mfd`
+/// and not deleted by these records, and into the specified `deletions` the
+/// GUIDs of the messages deleted by these records but added before them.
+/// Load into the specified `rc` 0 on success, or a negative value if an error
+/// was encountered.  The behavior is undefined unless
+/// `beginIndex < endIndex` and `endIndex` is not greater than the number of
+/// records in the journal file.
+void scanSegment(GuidsSet*                         messages,
+                 GuidsSet*                         deletions,
+                 int*                              rc,
+                 const mqbs::MappedFileDescriptor* mfd,
+                 bsls::Types::Uint64               beginIndex,
+                 bsls::Types::Uint64               endIndex)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(messages && deletions && rc && mfd);
+    BSLS_ASSERT(beginIndex < endIndex);
+
+    mqbs::JournalFileIterator iter;
+    *rc = iter.reset(mfd, mqbs::FileStoreProtocolUtil::bmqHeader(*mfd));
+    if (*rc != 0) {
+        return;  // RETURN
+    }
+
+    *rc = iter.nextRecord();
+    if (*rc == 1 && beginIndex > 0) {
+        *rc = iter.advance(beginIndex);
+    }
+
+    while (*rc == 1) {
+        if (iter.recordType() == mqbs::RecordType::e_MESSAGE) {
+            messages->insert(iter.asMessageRecord().messageGUID());
+        }
+        else if (iter.recordType() == mqbs::RecordType::e_DELETION) {
+            const bmqt::MessageGUID& guid =
+                iter.asDeletionRecord().messageGUID();
+            if (messages->erase(guid) == 0) {
+                deletions->insert(guid);
+            }
+        }
+
+        if (iter.recordIndex() + 1 >= endIndex) {
+            break;  // BREAK
+        }
+        *rc = iter.nextRecord();
+    }
+
+    if (*rc > 0) {
+        *rc = 0;
+    }
+    else if (*rc == 0) {
+        // The segment ends before the end of the file
+        *rc = -1;
+    }
+}
+
+/// Load into the specified `outstanding` the GUIDs of the messages which are
+/// not deleted in the journal file iterated by the specified `iter`, by
+/// scanning the specified `numSegments` segments of the file in parallel.
+/// Use the specified `allocator` to supply memory.  Return 0 on success, or
+/// a negative value if an error was encountered.
+int loadOutstandingGuids(GuidsSet*                        outstanding,
+                         const mqbs::JournalFileIterator& iter,
+                         bsls::Types::Uint64              numSegments,
+                         bslma::Allocator*                allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(outstanding);
+    BSLS_ASSERT(iter.isValid());
+    BSLS_ASSERT(numSegments > 0);
+
+    if (iter.lastRecordPosition() == 0) {
+        // No records
+        return 0;  // RETURN
+    }
+
+    const unsigned int recordSize = iter.header().recordWords() *
+                                    bmqp::Protocol::k_WORD_SIZE;
+    const bsls::Types::Uint64 numRecords =
+        (iter.lastRecordPosition() - iter.firstRecordPosition()) /
+            recordSize +
+        1;
+    numSegments = bsl::min(numSegments, numRecords);
+
+    bsl::vector<GuidsSet> messages(numSegments,
+                                   GuidsSet(allocator),
+                                   allocator);
+    bsl::vector<GuidsSet> deletions(numSegments,
+                                    GuidsSet(allocator),
+                                    allocator);
+    bsl::vector<int>      rcs(numSegments, 0, allocator);
+    bslmt::ThreadGroup    threadGroup(allocator);
+    for (bsls::Types::Uint64 i = 0; i < numSegments; ++i) {
+        bsl::function<void()> scanFn = bdlf::BindUtil::bindS(
+            allocator,
+            &scanSegment,
+            &messages[i],
+            &deletions[i],
+            &rcs[i],
+            iter.mappedFileDescriptor(),
+            numRecords * i / numSegments,
+            numRecords * (i + 1) / numSegments);
+        if (threadGroup.addThread(scanFn) != 0) {
+            // Scan the segment in this thread if no thread can be created.
+            scanFn();
+        }
+    }
+    threadGroup.joinAll();
+
+    // A message is always deleted after being added, so the deletions left
+    // unmatched in a segment refer to the messages of the previous ones.
+    for (bsls::Types::Uint64 i = 0; i < numSegments; ++i) {
+        if (rcs[i] != 0) {
+            return rcs[i];  // RETURN
+        }
+
+        for (GuidsSet::const_iterator it = deletions[i].cbegin();
+             it != deletions[i].cend();
+             ++it) {
+            outstanding->erase(*it);
+        }
+        outstanding->insert(messages[i].cbegin(), messages[i].cend());
+
+        GuidsSet(allocator).swap(messages[i]);
+        GuidsSet(allocator).swap(deletions[i]);
+    }
+
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ======================
+// class JournalCompactor
+// ======================
+
+// CREATORS
+
+JournalCompactor::JournalCompactor(
+    const Parameters*               params,
+    bslma::ManagedPtr<FileManager>& fileManager,
+    bsl::ostream&                   ostream,
+    bslma::Allocator*               allocator)
+: d_parameters(params)
+, d_fileManager(fileManager)
+, d_ostream(ostream)
+, d_allocator_p(allocator)
+{
+    // NOTHING
+}
+
+void JournalCompactor::process()
+{
+    mqbs::JournalFileIterator* iter   = d_fileManager->journalFileIterator();
+    mqbs::DataFileIterator*    dataIt = d_fileManager->dataFileIterator();
+
+    // The message records of the compacted journal must refer to the
+    // compacted data file.
+    if (!dataIt || !dataIt->isValid()) {
+        d_ostream << "Can't compact, because data file is not specified\n";
+        return;  // RETURN
+    }
+
+    // 1) Find the outstanding messages
+    GuidsSet outstanding(d_allocator_p);
+    int      rc = loadOutstandingGuids(&outstanding,
+                                       *iter,
+                                       d_parameters->d_threads,
+                                       d_allocator_p);
+    if (rc != 0) {
+        d_ostream << "Iteration aborted (exit status " << rc << ").";
+        return;  // RETURN
+    }
+
+    // 2) Write the headers of the compacted files
+    const bsl::string journalPath(d_parameters->d_compactTo + ".bmq_journal",
+                                  d_allocator_p);
+    const bsl::string dataPath(d_parameters->d_compactTo + ".bmq_data",
+                               d_allocator_p);
+
+    const mqbs::MappedFileDescriptor& journalMfd =
+        *iter->mappedFileDescriptor();
+    const char* journalBase =
+        mqbs::OffsetPtr<const char>(journalMfd.block(), 0).get();
+    const unsigned int fileHeaderSize =
+        mqbs::FileStoreProtocolUtil::bmqHeader(journalMfd).headerWords() *
+        bmqp::Protocol::k_WORD_SIZE;
+    const unsigned int headersSize = fileHeaderSize +
+                                     iter->header().headerWords() *
+                                         bmqp::Protocol::k_WORD_SIZE;
+    const unsigned int recordSize = iter->header().recordWords() *
+                                    bmqp::Protocol::k_WORD_SIZE;
+
+    bsl::ofstream journalFile(journalPath.c_str(),
+                              bsl::ios::out | bsl::ios::binary |
+                                  bsl::ios::trunc);
+    if (!journalFile) {
+        d_ostream << "Failed to open file [" << journalPath << "]\n";
+        return;  // RETURN
+    }
+    bsl::ofstream dataFile(dataPath.c_str(),
+                           bsl::ios::out | bsl::ios::binary | bsl::ios::trunc);
+    if (!dataFile) {
+        d_ostream << "Failed to open file [" << dataPath << "]\n";
+        return;  // RETURN
+    }
+
+    // The sync points are not copied
+    bsl::vector<char> buffer(journalBase,
+                             journalBase + headersSize,
+                             d_allocator_p);
+    reinterpret_cast<mqbs::JournalFileHeader*>(buffer.data() + fileHeaderSize)
+        ->setFirstSyncPointAfterRolloverOffsetWords(0);
+    journalFile.write(buffer.data(), buffer.size());
+
+    const mqbs::MappedFileDescriptor& dataMfd =
+        *dataIt->mappedFileDescriptor();
+    bsls::Types::Uint64 dataFilePosition = dataIt->firstRecordPosition();
+    dataFile.write(mqbs::OffsetPtr<const char>(dataMfd.block(), 0).get(),
+                   dataFilePosition);
+
+    // 3) Copy the records of the outstanding messages and the queueOp records
+    bsls::Types::Uint64 numRecords        = 0;
+    bsls::Types::Uint64 numCopiedRecords  = 0;
+    bsls::Types::Uint64 numCopiedMessages = 0;
+    buffer.resize(recordSize);
+    while (iter->hasRecordSizeRemaining()) {
+        rc = iter->nextRecord();
+        if (rc <= 0) {
+            d_ostream << "Iteration aborted (exit status " << rc << ").";
+            return;  // RETURN
+        }
+        ++numRecords;
+
+        bool isCopied = false;
+        switch (iter->recordType()) {
+        case mqbs::RecordType::e_MESSAGE: {
+            isCopied = outstanding.count(
+                iter->asMessageRecord().messageGUID());
+        } break;
+        case mqbs::RecordType::e_CONFIRM: {
+            isCopied = outstanding.count(
+                iter->asConfirmRecord().messageGUID());
+        } break;
+        case mqbs::RecordType::e_QUEUE_OP: {
+            isCopied = true;
+        } break;
+        case mqbs::RecordType::e_UNDEFINED:
+        case mqbs::RecordType::e_DELETION:
+        case mqbs::RecordType::e_JOURNAL_OP:
+        default: break;
+        }
+        if (!isCopied) {
+            continue;  // CONTINUE
+        }
+
+        bsl::memcpy(buffer.data(),
+                    journalBase + iter->recordOffset(),
+                    recordSize);
+
+        if (iter->recordType() == mqbs::RecordType::e_MESSAGE) {
+            // Copy the message data and refer to its new offset
+            const bsls::Types::Uint64 offset =
+                static_cast<bsls::Types::Uint64>(
+                    iter->asMessageRecord().messageOffsetDwords()) *
+                bmqp::Protocol::k_DWORD_SIZE;
+            if (offset + sizeof(mqbs::DataHeader) > dataMfd.fileSize()) {
+                d_ostream << "Message data out of data file bounds (offset "
+                          << offset << ").";
+                return;  // RETURN
+            }
+            const unsigned int length =
+                mqbs::OffsetPtr<const mqbs::DataHeader>(dataMfd.block(),
+                                                        offset)
+                    ->messageWords() *
+                bmqp::Protocol::k_WORD_SIZE;
+            if (offset + length > dataMfd.fileSize() ||
+                dataFilePosition % bmqp::Protocol::k_DWORD_SIZE != 0) {
+                d_ostream << "Invalid message data (offset " << offset
+                          << ").";
+                return;  // RETURN
+            }
+
+            dataFile.write(
+                mqbs::OffsetPtr<const char>(dataMfd.block(), offset).get(),
+                length);
+            reinterpret_cast<mqbs::MessageRecord*>(buffer.data())
+                ->setMessageOffsetDwords(static_cast<unsigned int>(
+                    dataFilePosition / bmqp::Protocol::k_DWORD_SIZE));
+            dataFilePosition += length;
+        }
+
+        journalFile.write(buffer.data(), recordSize);
+        ++numCopiedRecords;
+        if (iter->recordType() == mqbs::RecordType::e_MESSAGE) {
+            ++numCopiedMessages;
+        }
+    }
+
+    journalFile.close();
+    dataFile.close();
+    if (!journalFile || !dataFile) {
+        d_ostream << "Failed to write the compacted files.";
+        return;  // RETURN
+    }
+
+    d_ostream << "Compacted " << numRecords << " records into "
+              << numCopiedRecords << " records (" << numCopiedMessages
+              << " outstanding messages) in [" << journalPath << "] and ["
+              << dataPath << "]\n";
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,80 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_M_BMQSTORAGETOOL_JOURNALCOMPACTOR
+#define INCLUDED_M_BMQSTORAGETOOL_JOURNALCOMPACTOR
+
+//@PURPOSE: Provide a command processor compacting a journal file set.
+//
+//@CLASSES:
+//  m_bmqstoragetool::JournalCompactor: journal file set compactor.
+//
+//@DESCRIPTION: 'JournalCompactor' writes a compacted copy of a journal file
+//  and of its data file, which is required, containing only the outstanding
+//  (not deleted) messages, their confirmations and the queueOp records.  The
+//  journal file is first scanned in parallel for the outstanding messages,
+//  keeping memory usage proportional to their number, and the compacted files
+//  are then written in a single streaming pass.  Message records are updated
+//  to refer to the offsets of their data in the compacted data file.
+//
+//  JournalOp records (i.e. sync points) refer to positions in the original
+//  file set and are not copied, so a compacted file set is meant for offline
+//  analysis with this tool, not for the recovery of a broker.
+
+// bmqstoragetool
+#include <m_bmqstoragetool_commandprocessor.h>
+#include <m_bmqstoragetool_filemanager.h>
+#include <m_bmqstoragetool_parameters.h>
+
+// BDE
+#include <bsl_ostream.h>
+#include <bslma_allocator.h>
+#include <bslma_managedptr.h>
+#include <bsls_keyword.h>
+
+namespace BloombergLP {
+namespace m_bmqstoragetool {
+
+// ======================
+// class JournalCompactor
+// ======================
+
+class JournalCompactor : public CommandProcessor {
+  private:
+    // PRIVATE DATA
+    const Parameters*                    d_parameters;
+    const bslma::ManagedPtr<FileManager> d_fileManager;
+    bsl::ostream&                        d_ostream;
+    bslma::Allocator*                    d_allocator_p;
+
+  public:
+    // CREATORS
+    /// Constructor using the specified `params`, 'fileManager', 'ostream'
+    /// and 'allocator'.
+    JournalCompactor(const Parameters*               params,
+                     bslma::ManagedPtr<FileManager>& fileManager,
+                     bsl::ostream&                   ostream,
+                     bslma::Allocator*               allocator);
+
+    // MANIPULATORS
+    /// Write the compacted file set to the files prefixed by
+    /// `d_parameters->d_compactTo` and print a summary of it.
+    void process() BSLS_KEYWORD_OVERRIDE;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,398 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqstoragetool
+#include <m_bmqstoragetool_journalcompactor.h>
+
+#include <m_bmqstoragetool_commandprocessorfactory.h>
+#include <m_bmqstoragetool_filemanagermock.h>
+#include <m_bmqstoragetool_journalfile.h>
+#include <m_bmqstoragetool_parameters.h>
+
+// MQB
+#include <mqbs_datafileiterator.h>
+#include <mqbs_filestoreprotocol.h>
+#include <mqbs_filestoreprotocolutil.h>
+#include <mqbs_filesystemutil.h>
+#include <mqbs_journalfileiterator.h>
+#include <mqbs_mappedfiledescriptor.h>
+#include <mqbs_memoryblock.h>
+#include <mqbs_offsetptr.h>
+
+// BMQ
+#include <bmqp_protocol.h>
+#include <bmqp_protocolutil.h>
+#include <bmqu_memoutstream.h>
+#include <bmqu_tempdirectory.h>
+
+// BDE
+#include <bdls_filesystemutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace m_bmqstoragetool;
+using namespace bsl;
+using namespace mqbs;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Allocate from the specified `allocator` an in-memory data file holding a
+/// message with each of the specified `numMessages` `payloads`.  Load into
+/// the specified `mfd` its descriptor, into the specified `fileHeader` its
+/// file header, and into the specified `messageOffsets` the offset of each
+/// message in dwords.  Return the address of the allocated memory.
+char* addDataRecords(MappedFileDescriptor*      mfd,
+                     FileHeader*                fileHeader,
+                     bsl::vector<unsigned int>* messageOffsets,
+                     const char* const*         payloads,
+                     unsigned int               numMessages,
+                     bslma::Allocator*          allocator)
+{
+    const unsigned int dhSize    = sizeof(DataHeader);
+    unsigned int       totalSize = sizeof(FileHeader) + sizeof(DataFileHeader);
+    for (unsigned int i = 0; i < numMessages; ++i) {
+        const unsigned int payloadLen = static_cast<unsigned int>(
+            bsl::strlen(payloads[i]));
+        int padding = 0;
+        bmqp::ProtocolUtil::calcNumDwordsAndPadding(&padding,
+                                                    payloadLen + dhSize);
+        totalSize += dhSize + payloadLen + padding;
+    }
+
+    char*       p = static_cast<char*>(allocator->allocate(totalSize));
+    MemoryBlock block(p, totalSize);
+
+    mfd->setFd(-1);
+    mfd->setBlock(block);
+    mfd->setFileSize(totalSize);
+
+    bsls::Types::Uint64   currPos = 0;
+    OffsetPtr<FileHeader> fh(block, currPos);
+    new (fh.get()) FileHeader();
+    fh->setHeaderWords(sizeof(FileHeader) / bmqp::Protocol::k_WORD_SIZE);
+    fh->setMagic1(FileHeader::k_MAGIC1);
+    fh->setMagic2(FileHeader::k_MAGIC2);
+    currPos += sizeof(FileHeader);
+
+    OffsetPtr<DataFileHeader> dfh(block, currPos);
+    new (dfh.get()) DataFileHeader();
+    dfh->setHeaderWords(sizeof(DataFileHeader) / bmqp::Protocol::k_WORD_SIZE);
+    currPos += sizeof(DataFileHeader);
+
+    for (unsigned int i = 0; i < numMessages; ++i) {
+        messageOffsets->push_back(
+            static_cast<unsigned int>(currPos / bmqp::Protocol::k_DWORD_SIZE));
+
+        OffsetPtr<DataHeader> dh(block, currPos);
+        new (dh.get()) DataHeader();
+        currPos += dhSize;
+
+        const unsigned int payloadLen = static_cast<unsigned int>(
+            bsl::strlen(payloads[i]));
+        int padding = 0;
+        bmqp::ProtocolUtil::calcNumDwordsAndPadding(&padding,
+                                                    payloadLen + dhSize);
+        char* destination = p + currPos;
+        bsl::memcpy(destination, payloads[i], payloadLen);
+        bmqp::ProtocolUtil::appendPaddingDwordRaw(destination + payloadLen,
+                                                  padding);
+        currPos += payloadLen + padding;
+
+        dh->setMessageWords(dh->headerWords() +
+                            (payloadLen + padding) /
+                                bmqp::Protocol::k_WORD_SIZE);
+    }
+
+    *fileHeader = *fh;
+
+    return p;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_compactOutstandingMessagesTest()
+// ------------------------------------------------------------------------
+// COMPACT OUTSTANDING MESSAGES TEST
+//
+// Concerns:
+//   Compact a journal file scanned by several threads along with its data
+//   file, and check that the compacted journal file contains only the
+//   records of the outstanding messages, in the order of the original file,
+//   and that their message records refer to their payloads copied one after
+//   another in the compacted data file.
+//
+// Testing:
+//   JournalCompactor::process()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COMPACT OUTSTANDING MESSAGES TEST");
+
+    // Simulate data file
+    const char* const k_PAYLOADS[] = {"PAYLOAD_0",
+                                      "PAYLOAD_PAYLOAD_1",
+                                      "PAYLOAD_PAYLOAD_PAYLOAD_2",
+                                      "PAYLOAD_3",
+                                      "PAYLOAD_PAYLOAD_PAYLOAD_PAYLOAD_4",
+                                      "PAYLOAD_PAYLOAD_5"};
+    const unsigned int k_NUM_MSGS = sizeof(k_PAYLOADS) / sizeof(*k_PAYLOADS);
+
+    MappedFileDescriptor      mfdData;
+    FileHeader                fileHeader;
+    bsl::vector<unsigned int> messageOffsets(
+        bmqtst::TestHelperUtil::allocator());
+    char* pd = addDataRecords(&mfdData,
+                              &fileHeader,
+                              &messageOffsets,
+                              k_PAYLOADS,
+                              k_NUM_MSGS,
+                              bmqtst::TestHelperUtil::allocator());
+    DataFileIterator dataIt(&mfdData, fileHeader);
+    BMQTST_ASSERT(dataIt.isValid());
+
+    // Simulate journal file, in which messages of odd index are outstanding
+    const size_t k_NUM_RECORDS = k_NUM_MSGS * 2 + (k_NUM_MSGS + 1) / 2;
+    JournalFile::RecordsListType records(bmqtst::TestHelperUtil::allocator());
+    JournalFile                  journalFile(k_NUM_RECORDS,
+                            bmqtst::TestHelperUtil::allocator());
+    JournalFile::GuidVectorType  outstandingGUIDs(
+        bmqtst::TestHelperUtil::allocator());
+    journalFile.addJournalRecordsWithOutstandingMessages(&records,
+                                                         &outstandingGUIDs,
+                                                         messageOffsets);
+
+    // Configure parameters to compact the journal file
+    bmqu::TempDirectory tempDir(bmqtst::TestHelperUtil::allocator());
+    Parameters          params(
+        CommandLineArguments(bmqtst::TestHelperUtil::allocator()),
+        bmqtst::TestHelperUtil::allocator());
+    params.d_compactTo = tempDir.path();
+    params.d_compactTo.append("/compacted");
+    params.d_threads = 3;
+
+    // Prepare file manager
+    bslma::ManagedPtr<FileManager> fileManager(
+        new (*bmqtst::TestHelperUtil::allocator())
+            FileManagerMock(journalFile),
+        bmqtst::TestHelperUtil::allocator());
+    EXPECT_CALL(static_cast<FileManagerMock&>(*fileManager),
+                dataFileIterator())
+        .WillRepeatedly(testing::Return(&dataIt));
+
+    // Run compaction
+    bmqu::MemOutStream resultStream(bmqtst::TestHelperUtil::allocator());
+    bslma::ManagedPtr<CommandProcessor> compactor =
+        CommandProcessorFactory::createCommandProcessor(
+            &params,
+            fileManager,
+            resultStream,
+            bmqtst::TestHelperUtil::allocator());
+    compactor->process();
+    PV(resultStream.str());
+
+    // Iterate the compacted journal file
+    const bsl::string journalPath(params.d_compactTo + ".bmq_journal",
+                                  bmqtst::TestHelperUtil::allocator());
+    MappedFileDescriptor mfd;
+    bmqu::MemOutStream   errorDesc(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0,
+                     FileSystemUtil::open(
+                         &mfd,
+                         journalPath.c_str(),
+                         bdls::FilesystemUtil::getFileSize(journalPath),
+                         true,  // read only
+                         errorDesc));
+
+    JournalFileIterator it;
+    BMQTST_ASSERT_EQ(0,
+                     it.reset(&mfd, FileStoreProtocolUtil::bmqHeader(mfd)));
+
+    // Open the compacted data file
+    const bsl::string dataPath(params.d_compactTo + ".bmq_data",
+                               bmqtst::TestHelperUtil::allocator());
+    MappedFileDescriptor compactedMfdData;
+    BMQTST_ASSERT_EQ(0,
+                     FileSystemUtil::open(
+                         &compactedMfdData,
+                         dataPath.c_str(),
+                         bdls::FilesystemUtil::getFileSize(dataPath),
+                         true,  // read only
+                         errorDesc));
+
+    // The payloads are copied one after another, after the file headers
+    unsigned int expectedOffset = messageOffsets[0];
+
+    JournalFile::GuidVectorType messageGUIDs(
+        bmqtst::TestHelperUtil::allocator());
+    while (it.hasRecordSizeRemaining()) {
+        BMQTST_ASSERT_EQ(1, it.nextRecord());
+        BMQTST_ASSERT_NE(RecordType::e_DELETION, it.recordType());
+        BMQTST_ASSERT_NE(RecordType::e_JOURNAL_OP, it.recordType());
+
+        if (it.recordType() == RecordType::e_MESSAGE) {
+            const MessageRecord& record = it.asMessageRecord();
+            messageGUIDs.push_back(record.messageGUID());
+
+            // Outstanding messages are of odd index
+            const unsigned int index = static_cast<unsigned int>(
+                2 * messageGUIDs.size() - 1);
+            BMQTST_ASSERT_LT(index, k_NUM_MSGS);
+            BMQTST_ASSERT_EQ(expectedOffset, record.messageOffsetDwords());
+
+            const bsls::Types::Uint64 offset =
+                static_cast<bsls::Types::Uint64>(
+                    record.messageOffsetDwords()) *
+                bmqp::Protocol::k_DWORD_SIZE;
+            BMQTST_ASSERT_LT(offset + sizeof(DataHeader),
+                             compactedMfdData.fileSize());
+            OffsetPtr<const DataHeader> dh(compactedMfdData.block(), offset);
+            OffsetPtr<const DataHeader> originalDh(
+                mfdData.block(),
+                static_cast<bsls::Types::Uint64>(messageOffsets[index]) *
+                    bmqp::Protocol::k_DWORD_SIZE);
+            BMQTST_ASSERT_EQ(originalDh->messageWords(), dh->messageWords());
+            BMQTST_ASSERT_LE(offset + dh->messageWords() *
+                                          bmqp::Protocol::k_WORD_SIZE,
+                             compactedMfdData.fileSize());
+
+            const bsl::string payload(
+                reinterpret_cast<const char*>(dh.get()) +
+                    dh->headerWords() * bmqp::Protocol::k_WORD_SIZE,
+                bsl::strlen(k_PAYLOADS[index]),
+                bmqtst::TestHelperUtil::allocator());
+            BMQTST_ASSERT_EQ(k_PAYLOADS[index], payload);
+
+            expectedOffset += dh->messageWords() *
+                              bmqp::Protocol::k_WORD_SIZE /
+                              bmqp::Protocol::k_DWORD_SIZE;
+        }
+        else if (it.recordType() == RecordType::e_CONFIRM) {
+            const bmqt::MessageGUID& guid = it.asConfirmRecord().messageGUID();
+            BMQTST_ASSERT(bsl::find(outstandingGUIDs.cbegin(),
+                                    outstandingGUIDs.cend(),
+                                    guid) != outstandingGUIDs.cend());
+        }
+    }
+    it.clear();
+    FileSystemUtil::close(&mfd);
+
+    BMQTST_ASSERT_EQ(messageGUIDs, outstandingGUIDs);
+
+    // The compacted data file ends with the last copied payload
+    BMQTST_ASSERT_EQ(static_cast<bsls::Types::Uint64>(expectedOffset) *
+                         bmqp::Protocol::k_DWORD_SIZE,
+                     compactedMfdData.fileSize());
+    FileSystemUtil::close(&compactedMfdData);
+
+    bmqtst::TestHelperUtil::allocator()->deallocate(pd);
+}
+
+static void test2_compactWithoutDataFileTest()
+// ------------------------------------------------------------------------
+// COMPACT WITHOUT DATA FILE TEST
+//
+// Concerns:
+//   Check that a journal file is not compacted without its data file, since
+//   the message records of the compacted journal file must refer to the
+//   compacted data file.
+//
+// Testing:
+//   JournalCompactor::process()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COMPACT WITHOUT DATA FILE TEST");
+
+    // Simulate journal file
+    const size_t                 k_NUM_RECORDS = 30;
+    JournalFile::RecordsListType records(bmqtst::TestHelperUtil::allocator());
+    JournalFile                  journalFile(k_NUM_RECORDS,
+                            bmqtst::TestHelperUtil::allocator());
+    JournalFile::GuidVectorType  outstandingGUIDs(
+        bmqtst::TestHelperUtil::allocator());
+    journalFile.addJournalRecordsWithOutstandingAndConfirmedMessages(
+        &records,
+        &outstandingGUIDs,
+        true);
+
+    bmqu::TempDirectory tempDir(bmqtst::TestHelperUtil::allocator());
+    Parameters          params(
+        CommandLineArguments(bmqtst::TestHelperUtil::allocator()),
+        bmqtst::TestHelperUtil::allocator());
+    params.d_compactTo = tempDir.path();
+    params.d_compactTo.append("/compacted");
+
+    // Prepare file manager without data file
+    bslma::ManagedPtr<FileManager> fileManager(
+        new (*bmqtst::TestHelperUtil::allocator())
+            FileManagerMock(journalFile),
+        bmqtst::TestHelperUtil::allocator());
+    EXPECT_CALL(static_cast<FileManagerMock&>(*fileManager),
+                dataFileIterator())
+        .WillRepeatedly(testing::Return(static_cast<DataFileIterator*>(0)));
+
+    // Run compaction
+    bmqu::MemOutStream resultStream(bmqtst::TestHelperUtil::allocator());
+    bslma::ManagedPtr<CommandProcessor> compactor =
+        CommandProcessorFactory::createCommandProcessor(
+            &params,
+            fileManager,
+            resultStream,
+            bmqtst::TestHelperUtil::allocator());
+    compactor->process();
+
+    BMQTST_ASSERT_EQ(resultStream.str(),
+                     "Can't compact, because data file is not specified\n");
+    BMQTST_ASSERT(!bdls::FilesystemUtil::exists(params.d_compactTo +
+                                                ".bmq_journal"));
+    BMQTST_ASSERT(
+        !bdls::FilesystemUtil::exists(params.d_compactTo + ".bmq_data"));
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    ::testing::GTEST_FLAG(throw_on_failure) = true;
+    ::testing::InitGoogleMock(&argc, argv);
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_compactOutstandingMessagesTest(); break;
+    case 2: test2_compactWithoutDataFileTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_GBL_ALLOC);
+}
@@ -617,6 +617,104 @@ void JournalFile::addJournalRecordsWithConfirmedMessagesWithDifferentOrder(
     }
 }
 
+void JournalFile::addJournalRecordsWithOutstandingMessages(
+    RecordsListType*                 records,
+    GuidVectorType*                  expectedGUIDs,
+    const bsl::vector<unsigned int>& messageOffsets)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(records);
+    BSLS_ASSERT(expectedGUIDs);
+
+    const size_t numMessages = messageOffsets.size();
+    BSLS_ASSERT(d_numRecords == numMessages * 2 + (numMessages + 1) / 2);
+
+    bsls::Types::Uint64 seqNumber = 1;
+    for (unsigned int i = 0; i < numMessages; ++i) {
+        bmqt::MessageGUID guid;
+        mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+        // MsgRec
+        OffsetPtr<MessageRecord> msgRec(d_block, d_currPos);
+        new (msgRec.get()) MessageRecord();
+        msgRec->header()
+            .setPrimaryLeaseId(100)
+            .setSequenceNumber(seqNumber)
+            .setTimestamp(seqNumber * d_timestampIncrement);
+        msgRec->setRefCount(1)
+            .setQueueKey(
+                mqbu::StorageKey(mqbu::StorageKey::BinaryRepresentation(),
+                                 "abcde"))
+            .setFileKey(
+                mqbu::StorageKey(mqbu::StorageKey::BinaryRepresentation(),
+                                 "12345"))
+            .setMessageOffsetDwords(messageOffsets[i])
+            .setMessageGUID(guid)
+            .setCrc32c(i)
+            .setCompressionAlgorithmType(
+                bmqt::CompressionAlgorithmType::e_NONE)
+            .setMagic(RecordHeader::k_MAGIC);
+
+        RecordBufferType buf;
+        bsl::memcpy(buf.buffer(),
+                    msgRec.get(),
+                    FileStoreProtocol::k_JOURNAL_RECORD_SIZE);
+        records->push_back(bsl::make_pair(RecordType::e_MESSAGE, buf));
+        d_currPos += FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
+        ++seqNumber;
+
+        // ConfRec
+        OffsetPtr<ConfirmRecord> confRec(d_block, d_currPos);
+        new (confRec.get()) ConfirmRecord();
+        confRec->header()
+            .setPrimaryLeaseId(100)
+            .setSequenceNumber(seqNumber)
+            .setTimestamp(seqNumber * d_timestampIncrement);
+        confRec->setReason(ConfirmReason::e_CONFIRMED)
+            .setQueueKey(
+                mqbu::StorageKey(mqbu::StorageKey::BinaryRepresentation(),
+                                 "abcde"))
+            .setAppKey(
+                mqbu::StorageKey(mqbu::StorageKey::BinaryRepresentation(),
+                                 "appid"))
+            .setMessageGUID(guid)
+            .setMagic(RecordHeader::k_MAGIC);
+
+        bsl::memcpy(buf.buffer(),
+                    confRec.get(),
+                    FileStoreProtocol::k_JOURNAL_RECORD_SIZE);
+        records->push_back(bsl::make_pair(RecordType::e_CONFIRM, buf));
+        d_currPos += FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
+        ++seqNumber;
+
+        if (i % 2 != 0) {
+            expectedGUIDs->push_back(guid);
+            continue;  // CONTINUE
+        }
+
+        // DelRec
+        OffsetPtr<DeletionRecord> delRec(d_block, d_currPos);
+        new (delRec.get()) DeletionRecord();
+        delRec->header()
+            .setPrimaryLeaseId(100)
+            .setSequenceNumber(seqNumber)
+            .setTimestamp(seqNumber * d_timestampIncrement);
+        delRec->setDeletionRecordFlag(DeletionRecordFlag::e_IMPLICIT_CONFIRM)
+            .setQueueKey(
+                mqbu::StorageKey(mqbu::StorageKey::BinaryRepresentation(),
+                                 "abcde"))
+            .setMessageGUID(guid)
+            .setMagic(RecordHeader::k_MAGIC);
+
+        bsl::memcpy(buf.buffer(),
+                    delRec.get(),
+                    FileStoreProtocol::k_JOURNAL_RECORD_SIZE);
+        records->push_back(bsl::make_pair(RecordType::e_DELETION, buf));
+        d_currPos += FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
+        ++seqNumber;
+    }
+}
+
 void JournalFile::addMultipleTypesRecordsWithMultipleLeaseId(
     RecordsListType* records,
     size_t           numRecordsWithSameLeaseId)
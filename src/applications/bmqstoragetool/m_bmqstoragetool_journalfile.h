@@ -169,6 +169,19 @@ class JournalFile {
         size_t                     numMessages,
         bsl::vector<unsigned int>& messageOffsets);
 
+    /// Generate a MessageRecord followed by a ConfirmRecord for each of the
+    /// specified `messageOffsets`, setting the message offset of the
+    /// MessageRecord from it, and a DeletionRecord for the messages of even
+    /// index.  Store list of created records in the specified `records`.
+    /// Store the GUIDs of the outstanding messages, i.e. of odd index, in the
+    /// specified `expectedGUIDs`.  The behavior is undefined unless the
+    /// number of records is `2 * n + (n + 1) / 2`, where `n` is the number
+    /// of `messageOffsets`.
+    void addJournalRecordsWithOutstandingMessages(
+        RecordsListType*                 records,
+        GuidVectorType*                  expectedGUIDs,
+        const bsl::vector<unsigned int>& messageOffsets);
+
     /// Generate sequence of multiple types of records. Increase Primary Lease
     /// Id after the specified `numRecordsWithSameLeaseId` records. Store list
     /// of created records in the specified `records`.
@@ -19,8 +19,13 @@
 #include <m_bmqstoragetool_journalfileprocessor.h>
 
 // BDE
+#include <bdlf_bind.h>
 #include <bdls_filesystemutil.h>
+#include <bsl_functional.h>
 #include <bsl_iostream.h>
+#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+#include <bslmt_threadgroup.h>
 #include <bsls_assert.h>
 
 // MQB
@@ -30,6 +35,7 @@
 #include <mqbs_offsetptr.h>
 
 // BMQ
+#include <bmqt_messageguid.h>
 #include <bmqu_alignedprinter.h>
 #include <bmqu_memoutstream.h>
 #include <bmqu_outstreamformatsaver.h>
@@ -40,6 +46,87 @@
 namespace BloombergLP {
 namespace m_bmqstoragetool {
 
+namespace {
+
+typedef bsl::unordered_set<bmqt::MessageGUID> GuidsSet;
+
+/// Load into the specified `result` the indices of the records, from the
+/// specified `beginIndex` included to the specified `endIndex` excluded, of
+/// the journal file mapped by the specified `mfd` which a search of the
+/// specified `guids` with the specified `processRecordTypes` processes, and
+/// load into the specified `rc` the status of the iteration: `0` on success,
+/// or a negative value if an error was encountered.  The behavior is
+/// undefined unless `beginIndex < endIndex` and `endIndex` is not greater
+/// than the number of records in the journal file.
+void scanJournalSegment(bsl::vector<bsls::Types::Uint64>*     result,
+                        int*                                  rc,
+                        const mqbs::MappedFileDescriptor*     mfd,
+                        bsls::Types::Uint64                   beginIndex,
+                        bsls::Types::Uint64                   endIndex,
+                        const GuidsSet&                       guids,
+                        const Parameters::ProcessRecordTypes& recordTypes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(result && rc && mfd);
+    BSLS_ASSERT(beginIndex < endIndex);
+
+    mqbs::JournalFileIterator iter;
+    *rc = iter.reset(mfd, mqbs::FileStoreProtocolUtil::bmqHeader(*mfd));
+    if (*rc != 0) {
+        return;  // RETURN
+    }
+
+    *rc = iter.nextRecord();
+    if (*rc == 1 && beginIndex > 0) {
+        *rc = iter.advance(beginIndex);
+    }
+
+    while (*rc == 1) {
+        bool isSelected = false;
+        switch (iter.recordType()) {
+        case mqbs::RecordType::e_MESSAGE: {
+            isSelected = recordTypes.d_message &&
+                         guids.count(iter.asMessageRecord().messageGUID());
+        } break;
+        case mqbs::RecordType::e_CONFIRM: {
+            isSelected = recordTypes.d_message &&
+                         guids.count(iter.asConfirmRecord().messageGUID());
+        } break;
+        case mqbs::RecordType::e_DELETION: {
+            isSelected = recordTypes.d_message &&
+                         guids.count(iter.asDeletionRecord().messageGUID());
+        } break;
+        case mqbs::RecordType::e_QUEUE_OP: {
+            isSelected = recordTypes.d_queueOp;
+        } break;
+        case mqbs::RecordType::e_JOURNAL_OP: {
+            isSelected = recordTypes.d_journalOp;
+        } break;
+        case mqbs::RecordType::e_UNDEFINED:
+        default: break;
+        }
+
+        if (isSelected) {
+            result->push_back(iter.recordIndex());
+        }
+
+        if (iter.recordIndex() + 1 >= endIndex) {
+            break;  // BREAK
+        }
+        *rc = iter.nextRecord();
+    }
+
+    if (*rc > 0) {
+        *rc = 0;
+    }
+    else if (*rc == 0) {
+        // The segment ends before the end of the file
+        *rc = -1;
+    }
+}
+
+}  // close unnamed namespace
+
 /// Move the journal iterator pointed by the specified 'jit' to the first
 /// record whose value is more then the range lower bound. The specified
 /// `moreThanLowerBoundFn` functor is used for comparison. Return '1' on
@@ -141,6 +228,160 @@ bool MoreThanLowerBoundFn::operator()(
 // ==========================
 // class JournalFileProcessor
 // ==========================
+// PRIVATE MANIPULATORS
+
+void JournalFileProcessor::processRecord(bool*                      stopSearch,
+                                         mqbs::JournalFileIterator* iter,
+                                         const Filters&             filters)
+{
+    // Process Message records
+    if (d_parameters->d_processRecordTypes.d_message) {
+        // MessageRecord
+        if (iter->recordType() == mqbs::RecordType::e_MESSAGE) {
+            const mqbs::MessageRecord& record = iter->asMessageRecord();
+            // Apply filters
+            if (filters.apply(iter->recordHeader(),
+                              iter->recordOffset(),
+                              record.queueKey())) {
+                *stopSearch = d_searchResult_p->processMessageRecord(
+                    record,
+                    iter->recordIndex(),
+                    iter->recordOffset());
+            }
+        }
+        // ConfirmRecord
+        else if (iter->recordType() == mqbs::RecordType::e_CONFIRM) {
+            const mqbs::ConfirmRecord& record = iter->asConfirmRecord();
+            *stopSearch = d_searchResult_p->processConfirmRecord(
+                record,
+                iter->recordIndex(),
+                iter->recordOffset());
+        }
+        // DeletionRecord
+        else if (iter->recordType() == mqbs::RecordType::e_DELETION) {
+            const mqbs::DeletionRecord& record = iter->asDeletionRecord();
+            *stopSearch = d_searchResult_p->processDeletionRecord(
+                record,
+                iter->recordIndex(),
+                iter->recordOffset());
+        }
+    }
+    // Process QueueOp record
+    if (d_parameters->d_processRecordTypes.d_queueOp &&
+        iter->recordType() == mqbs::RecordType::e_QUEUE_OP) {
+        const mqbs::QueueOpRecord& record = iter->asQueueOpRecord();
+
+        // Apply filters
+        if (filters.apply(iter->recordHeader(),
+                          iter->recordOffset(),
+                          record.queueKey(),
+                          stopSearch)) {
+            *stopSearch = d_searchResult_p->processQueueOpRecord(
+                record,
+                iter->recordIndex(),
+                iter->recordOffset());
+        }
+    }
+    // Process JournalOp record
+    if (d_parameters->d_processRecordTypes.d_journalOp &&
+        iter->recordType() == mqbs::RecordType::e_JOURNAL_OP) {
+        const mqbs::JournalOpRecord& record = iter->asJournalOpRecord();
+
+        // Apply filters
+        if (filters.apply(iter->recordHeader(),
+                          iter->recordOffset(),
+                          mqbu::StorageKey::k_NULL_KEY,
+                          stopSearch)) {
+            *stopSearch = d_searchResult_p->processJournalOpRecord(
+                record,
+                iter->recordIndex(),
+                iter->recordOffset());
+        }
+    }
+}
+
+int JournalFileProcessor::processInParallel(
+    mqbs::JournalFileIterator* iter,
+    const Filters&             filters)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(iter && iter->isValid());
+    BSLS_ASSERT(iter->recordIndex() == 0);
+
+    const unsigned int recordSize = iter->header().recordWords() *
+                                    bmqp::Protocol::k_WORD_SIZE;
+    const bsls::Types::Uint64 numRecords =
+        (iter->lastRecordPosition() - iter->firstRecordPosition()) /
+            recordSize +
+        1;
+    const bsls::Types::Uint64 numSegments = bsl::min(
+        static_cast<bsls::Types::Uint64>(d_parameters->d_threads),
+        numRecords);
+
+    GuidsSet guids(d_allocator_p);
+    for (bsl::vector<bsl::string>::const_iterator it =
+             d_parameters->d_guid.cbegin();
+         it != d_parameters->d_guid.cend();
+         ++it) {
+        bmqt::MessageGUID guid;
+        guid.fromHex(it->c_str());
+        guids.insert(guid);
+    }
+
+    // Scan contiguous segments of the journal file in parallel, each thread
+    // using its own iterator over the shared mapping.
+    bsl::vector<bsl::vector<bsls::Types::Uint64> > selected(
+        numSegments,
+        bsl::vector<bsls::Types::Uint64>(d_allocator_p),
+        d_allocator_p);
+    bsl::vector<int>   rcs(numSegments, 0, d_allocator_p);
+    bslmt::ThreadGroup threadGroup(d_allocator_p);
+    for (bsls::Types::Uint64 i = 0; i < numSegments; ++i) {
+        bsl::function<void()> scanFn = bdlf::BindUtil::bindS(
+            d_allocator_p,
+            &scanJournalSegment,
+            &selected[i],
+            &rcs[i],
+            iter->mappedFileDescriptor(),
+            numRecords * i / numSegments,
+            numRecords * (i + 1) / numSegments,
+            guids,
+            d_parameters->d_processRecordTypes);
+        if (threadGroup.addThread(scanFn) != 0) {
+            // Scan the segment in this thread if no thread can be created.
+            scanFn();
+        }
+    }
+    threadGroup.joinAll();
+
+    for (bsls::Types::Uint64 i = 0; i < numSegments; ++i) {
+        if (rcs[i] < 0) {
+            d_ostream << "Iteration aborted (exit status " << rcs[i] << ").";
+            return rcs[i];  // RETURN
+        }
+    }
+
+    // Process the selected records in the order of the journal file, as the
+    // search result depends on it.
+    bool stopSearch = false;
+    for (bsls::Types::Uint64 i = 0; i < numSegments && !stopSearch; ++i) {
+        const bsl::vector<bsls::Types::Uint64>& indices = selected[i];
+        for (size_t j = 0; j < indices.size() && !stopSearch; ++j) {
+            if (indices[j] != iter->recordIndex()) {
+                const int rc = iter->advance(indices[j] -
+                                             iter->recordIndex());
+                if (rc != 1) {
+                    d_ostream << "Iteration aborted (exit status " << rc
+                              << ").";
+                    return rc == 0 ? -1 : rc;  // RETURN
+                }
+            }
+            processRecord(&stopSearch, iter, filters);
+        }
+    }
+
+    return 0;
+}
 
 // CREATORS
 
@@ -185,6 +426,15 @@ void JournalFileProcessor::process()
             return;  // RETURN
         }
 
+        if (d_parameters->d_threads > 1 && !d_parameters->d_guid.empty()) {
+            // Few records match a GUID search, so select them by scanning
+            // the journal file in parallel.
+            if (processInParallel(iter, filters) == 0) {
+                d_searchResult_p->outputResult();
+            }
+            return;  // RETURN
+        }
+
         if (needMoveToLowerBound) {
             MoreThanLowerBoundFn moreThanLowerBoundFn(d_parameters->d_range);
             rc = moveToLowerBound(iter, moreThanLowerBoundFn);
@@ -200,70 +450,7 @@ void JournalFileProcessor::process()
             needMoveToLowerBound = false;
         }
 
-        // Process Message records
-        if (d_parameters->d_processRecordTypes.d_message) {
-            // MessageRecord
-            if (iter->recordType() == mqbs::RecordType::e_MESSAGE) {
-                const mqbs::MessageRecord& record = iter->asMessageRecord();
-                // Apply filters
-                if (filters.apply(iter->recordHeader(),
-                                  iter->recordOffset(),
-                                  record.queueKey())) {
-                    stopSearch = d_searchResult_p->processMessageRecord(
-                        record,
-                        iter->recordIndex(),
-                        iter->recordOffset());
-                }
-            }
-            // ConfirmRecord
-            else if (iter->recordType() == mqbs::RecordType::e_CONFIRM) {
-                const mqbs::ConfirmRecord& record = iter->asConfirmRecord();
-                stopSearch = d_searchResult_p->processConfirmRecord(
-                    record,
-                    iter->recordIndex(),
-                    iter->recordOffset());
-            }
-            // DeletionRecord
-            else if (iter->recordType() == mqbs::RecordType::e_DELETION) {
-                const mqbs::DeletionRecord& record = iter->asDeletionRecord();
-                stopSearch = d_searchResult_p->processDeletionRecord(
-                    record,
-                    iter->recordIndex(),
-                    iter->recordOffset());
-            }
-        }
-        // Process QueueOp record
-        if (d_parameters->d_processRecordTypes.d_queueOp &&
-            iter->recordType() == mqbs::RecordType::e_QUEUE_OP) {
-            const mqbs::QueueOpRecord& record = iter->asQueueOpRecord();
-
-            // Apply filters
-            if (filters.apply(iter->recordHeader(),
-                              iter->recordOffset(),
-                              record.queueKey(),
-                              &stopSearch)) {
-                stopSearch = d_searchResult_p->processQueueOpRecord(
-                    record,
-                    iter->recordIndex(),
-                    iter->recordOffset());
-            }
-        }
-        // Process JournalOp record
-        if (d_parameters->d_processRecordTypes.d_journalOp &&
-            iter->recordType() == mqbs::RecordType::e_JOURNAL_OP) {
-            const mqbs::JournalOpRecord& record = iter->asJournalOpRecord();
-
-            // Apply filters
-            if (filters.apply(iter->recordHeader(),
-                              iter->recordOffset(),
-                              mqbu::StorageKey::k_NULL_KEY,
-                              &stopSearch)) {
-                stopSearch = d_searchResult_p->processJournalOpRecord(
-                    record,
-                    iter->recordIndex(),
-                    iter->recordOffset());
-            }
-        }
+        processRecord(&stopSearch, iter, filters);
     }
 }
 
@@ -22,7 +22,9 @@
 //  m_bmqstoragetool::JournalFileProcessor: search engine.
 //
 //@DESCRIPTION: 'JournalFileProcessor' provides engine for iterating a journal
-//  file and searching records in it.
+//  file and searching records in it.  When searching GUIDs with more than one
+//  thread, segments of the journal file are scanned in parallel for the
+//  matching records, which are then processed in the order of the file.
 
 // bmqstoragetool
 #include <m_bmqstoragetool_commandprocessor.h>
@@ -80,7 +82,23 @@ class JournalFileProcessor : public CommandProcessor {
     bsl::shared_ptr<SearchResult>        d_searchResult_p;
     bslma::Allocator*                    d_allocator_p;
 
-    // MANIPULATORS
+    // PRIVATE MANIPULATORS
+
+    /// Process the record pointed by the specified `iter` if it matches the
+    /// specified `filters`, and set the specified `stopSearch` to true if
+    /// the search is complete.
+    void processRecord(bool*                      stopSearch,
+                       mqbs::JournalFileIterator* iter,
+                       const Filters&             filters);
+
+    /// Scan `d_parameters->d_threads` segments of the journal file in
+    /// parallel for the records of a GUID search, and process these records
+    /// in order using the specified `iter` and `filters`.  Return 0 on
+    /// success, or a negative value if the iteration failed, in which case
+    /// an error is written to `d_ostream`.  The behavior is undefined unless
+    /// `iter` points to the first record of the journal file.
+    int processInParallel(mqbs::JournalFileIterator* iter,
+                          const Filters&             filters);
 
   public:
     // CREATORS
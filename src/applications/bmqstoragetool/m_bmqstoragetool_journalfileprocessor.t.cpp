@@ -2613,6 +2613,79 @@ static void test26_summaryWithQueueDetailsTest()
     searchProcessor->process();
 }
 
+static void test27_searchGuidInParallelTest()
+// ------------------------------------------------------------------------
+// SEARCH GUID IN PARALLEL TEST
+//
+// Concerns:
+//   Search messages by GUIDs in journal file scanned by several threads and
+//   output GUIDs in the order of the file.
+//
+// Testing:
+//   JournalFileProcessor::process()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("SEARCH GUID IN PARALLEL");
+
+    // Simulate journal file
+    const size_t                 k_NUM_RECORDS = 50;
+    JournalFile::RecordsListType records(bmqtst::TestHelperUtil::allocator());
+    JournalFile                  journalFile(k_NUM_RECORDS,
+                            bmqtst::TestHelperUtil::allocator());
+    journalFile.addAllTypesRecords(&records);
+
+    // Create printer mock
+    bsl::shared_ptr<PrinterMock> printer(
+        new (*bmqtst::TestHelperUtil::allocator()) PrinterMock(),
+        bmqtst::TestHelperUtil::allocator());
+
+    // Prepare parameters
+    Parameters params = createTestParameters();
+    params.d_threads  = 4;
+    // Get list of message GUIDs for searching, spread over all the segments
+    bsl::vector<bsl::string>& searchGuids = params.d_guid;
+    bsl::list<JournalFile::NodeType>::const_iterator recordIter =
+        records.begin();
+    bsl::size_t msgCnt = 0;
+    Sequence    s;
+    for (; recordIter != records.end(); ++recordIter) {
+        RecordType::Enum rtype = recordIter->first;
+        if (rtype == RecordType::e_MESSAGE) {
+            if (msgCnt++ % 3 != 0)
+                continue;  // Skip some messages for test purposes
+            const MessageRecord& msg = *reinterpret_cast<const MessageRecord*>(
+                recordIter->second.buffer());
+            bmqu::MemOutStream ss(bmqtst::TestHelperUtil::allocator());
+            ss << msg.messageGUID();
+            searchGuids.push_back(
+                bsl::string(ss.str(), bmqtst::TestHelperUtil::allocator()));
+            EXPECT_CALL(*printer, printGuid(msg.messageGUID())).InSequence(s);
+        }
+    }
+    EXPECT_CALL(
+        *printer,
+        printFooter(searchGuids.size(), 0, 0, params.d_processRecordTypes))
+        .InSequence(s);
+
+    // Prepare file manager
+    bslma::ManagedPtr<FileManager> fileManager(
+        new (*bmqtst::TestHelperUtil::allocator())
+            FileManagerMock(journalFile),
+        bmqtst::TestHelperUtil::allocator());
+
+    // Create command processor
+    bmqu::MemOutStream resultStream(bmqtst::TestHelperUtil::allocator());
+    bslma::ManagedPtr<CommandProcessor> searchProcessor =
+        createCommandProcessor(&params,
+                               printer,
+                               fileManager,
+                               resultStream,
+                               bmqtst::TestHelperUtil::allocator());
+    // Run search
+    searchProcessor->process();
+    BMQTST_ASSERT(resultStream.str().empty());
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2651,6 +2724,7 @@ int main(int argc, char* argv[])
     case 24: test24_searchConfirmAndDeletionRecordsByOffset(); break;
     case 25: test25_searchConfirmAndDeletionRecordsBySeqNumber(); break;
     case 26: test26_summaryWithQueueDetailsTest(); break;
+    case 27: test27_searchGuidInParallelTest(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
@@ -133,6 +133,8 @@ CommandLineArguments::CommandLineArguments(bslma::Allocator* allocator)
 , d_partiallyConfirmed(false)
 , d_minRecordsPerQueue(0)
 , d_cslSummaryQueuesLimit(0)
+, d_threads(1)
+, d_compactTo(allocator)
 , d_allocator_p(bslma::Default::allocator(allocator))
 {
     // NOTHING
@@ -177,6 +179,11 @@ void CommandLineArguments::validateCslModeArgs(bsl::ostream& stream)
                   "passed.\n";
     }
 
+    if (!d_compactTo.empty()) {
+        stream << "--compact-to is not supported when only CSL file is "
+                  "passed.\n";
+    }
+
     const bool rangeArgPresent = validateRangeArgs(stream);
 
     // Validate options compatibility
@@ -313,6 +320,9 @@ void CommandLineArguments::validateJournalModeArgs(bsl::ostream& stream)
     if (d_dataFile.empty() && d_dumpPayload) {
         stream << "Can't dump payload, because data file is not specified\n";
     }
+    if (d_dataFile.empty() && !d_compactTo.empty()) {
+        stream << "Can't compact, because data file is not specified\n";
+    }
     if (d_cslFile.empty() && !d_queueName.empty()) {
         stream << "Can't search by queue name, because csl file is not "
                   "specified\n";
@@ -369,6 +379,15 @@ void CommandLineArguments::validateJournalModeArgs(bsl::ostream& stream)
         }
     }
 
+    if (!d_compactTo.empty() &&
+        (!d_queueKey.empty() || !d_queueName.empty() || !d_guid.empty() ||
+         !d_seqNum.empty() || !d_offset.empty() || d_outstanding ||
+         d_confirmed || d_partiallyConfirmed || rangeArgPresent ||
+         d_summary || d_details || d_dumpPayload)) {
+        stream << "'--compact-to' can't be combined with any filters or "
+                  "output options, as it copies all outstanding messages\n";
+    }
+
     if (d_summary &&
         (d_outstanding || d_confirmed || d_partiallyConfirmed || d_details)) {
         stream << "'--summary' can't be combined with '--outstanding', "
@@ -400,6 +419,10 @@ void CommandLineArguments::validateJournalModeArgs(bsl::ostream& stream)
 
     if (d_dumpLimit <= 0)
         stream << "Dump limit must be positive value greater than zero.\n";
+
+    if (d_threads <= 0)
+        stream << "Number of threads must be positive value greater than "
+                  "zero.\n";
 }
 
 bool CommandLineArguments::validateRangeArgs(bsl::ostream& error) const
@@ -594,6 +617,8 @@ Parameters::Parameters(const CommandLineArguments& arguments,
 , d_confirmed(arguments.d_confirmed)
 , d_partiallyConfirmed(arguments.d_partiallyConfirmed)
 , d_cslSummaryQueuesLimit(arguments.d_cslSummaryQueuesLimit)
+, d_threads(arguments.d_threads)
+, d_compactTo(arguments.d_compactTo, allocator)
 , d_allocator_p(bslma::Default::allocator(allocator))
 {
     // Determine processing mode: process Journal or CSL file
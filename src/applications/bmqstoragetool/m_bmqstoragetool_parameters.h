@@ -108,6 +108,10 @@ class CommandLineArguments {
     bsls::Types::Int64 d_minRecordsPerQueue;
     /// Limit number of queues to display in CSL file summary
     int d_cslSummaryQueuesLimit;
+    /// Number of threads to scan the journal file with
+    int d_threads;
+    /// Path prefix of the compacted file set to write
+    bsl::string d_compactTo;
 
     // CREATORS
 
@@ -284,6 +288,10 @@ struct Parameters {
     bsl::optional<bsls::Types::Uint64> d_minRecordsPerQueue;
     /// Limit number of queues to display in CSL file summary
     unsigned int d_cslSummaryQueuesLimit;
+    /// Number of threads to scan the journal file with
+    unsigned int d_threads;
+    /// Path prefix of the compacted file set to write
+    bsl::string d_compactTo;
     /// Allocator used inside the class.
     bslma::Allocator* d_allocator_p;
 
@@ -1438,6 +1438,12 @@ bool SummaryProcessor::processDeletionRecord(
             d_partiallyConfirmedGuids.erase(it);
             d_deletedMessagesCount++;
         }
+        else {
+            // Message is deleted without confirmation (e.g. purged or
+            // expired), forget it so that memory usage is proportional to the
+            // number of outstanding messages rather than to the file size.
+            d_notConfirmedGuids.erase(record.messageGUID());
+        }
     }
 
     if (d_minRecordsPerQueue.has_value()) {
@@ -263,6 +263,17 @@ static bool parseArgs(Parameters* parameters, int argc, const char* argv[])
          "interval to wait between each post",
          balcl::TypeInfo(&params.postInterval()),
          balcl::OccurrenceInfo(params.postInterval())},
+        {"producerthreads",
+         "producerThreads",
+         "number of threads posting 'eventscount' events each (for auto mode)",
+         balcl::TypeInfo(&params.producerThreads()),
+         balcl::OccurrenceInfo(params.producerThreads())},
+        {"openloop",
+         "openLoop",
+         "post at scheduled times regardless of how long posting takes, and "
+         "measure latency from the scheduled times",
+         balcl::TypeInfo(&params.openLoop()),
+         balcl::OccurrenceInfo::e_OPTIONAL},
         {"v|verbosity",
          "verbosity",
          "verbosity ([silent, trace, debug, <info>, warning, error, fatal])",
@@ -51,8 +51,8 @@
 #include <ball_streamobserver.h>
 #include <bdlbb_blobutil.h>
 #include <bdlf_bind.h>
-#include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
+#include <bdlt_timeunitratio.h>
 #include <bsl_fstream.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
@@ -63,8 +63,10 @@
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
 #include <bslmt_turnstile.h>
 #include <bsls_assert.h>
+#include <bsls_timeutil.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -232,6 +234,12 @@ void Application::snapshotStats()
 {
     d_statContext_sp->snapshot();
 
+    if (!d_parameters.latencyReportPath().empty()) {
+        // One interval per second in the timeline of the latency report
+        d_confirmLatencyStorage.snapshot();
+        d_ackLatencyStorage.snapshot();
+    }
+
     static unsigned int count = 0;
     if (++count % k_STAT_DUMP_INTERVAL == 0 &&
         d_parameters.verbosity() != ParametersVerbosity::e_SILENT &&
@@ -562,6 +570,8 @@ int Application::initialize()
             return e_OPEN_QUEUE_ERROR;  // RETURN
         }
 
+        BALL_LOG_INFO << "Queue opened: " << d_parameters.queueUri();
+
         // Schedule a clock to collect / dump stats
         bdlmt::EventScheduler::RecurringEventHandle handle;
         d_scheduler.scheduleRecurringEvent(
@@ -799,34 +809,85 @@ void Application::onMessageEvent(const bmqa::MessageEvent& event)
     }
 }
 
-void Application::producerThread()
+void Application::producerThread(int producerIndex)
 {
     BSLS_ASSERT_SAFE(d_session_mp);
 
-    bslmt::Turnstile turnstile(1000.0);
-    if (d_parameters.postInterval() != 0) {
-        turnstile.reset(1000.0 / d_parameters.postInterval());
-    }
-
     bsl::shared_ptr<PostingContext> postingContext =
         d_poster.createPostingContext(d_session_mp.get(),
                                       d_parameters,
                                       d_queueId);
 
-    while (d_isRunning && postingContext->pendingPost()) {
-        if (d_isConnected) {
-            postingContext->postNext();
-        }
+    if (d_parameters.openLoop()) {
+        postOpenLoop(postingContext.get(), producerIndex);
+    }
+    else {
+        bslmt::Turnstile turnstile(1000.0);
         if (d_parameters.postInterval() != 0) {
-            turnstile.waitTurn();
+            turnstile.reset(1000.0 / d_parameters.postInterval());
+        }
+
+        while (d_isRunning && postingContext->pendingPost()) {
+            if (d_isConnected) {
+                postingContext->postNext();
+            }
+            if (d_parameters.postInterval() != 0) {
+                turnstile.waitTurn();
+            }
         }
     }
 
-    if (!bmqt::QueueFlagsUtil::isAck(d_parameters.queueFlags())) {
+    if (!bmqt::QueueFlagsUtil::isAck(d_parameters.queueFlags()) &&
+        d_numRunningProducers.add(-1) == 0) {
         d_shutdownSemaphore_p->post();
     }
 }
 
+void Application::postOpenLoop(PostingContext* postingContext,
+                               int             producerIndex)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_parameters.postInterval() != 0);
+
+    // The posts of each producer are scheduled every 'postInterval' since the
+    // start, the producers being evenly offset within the interval.  A post
+    // happens as soon as it is due, and one late because of slow previous
+    // posts does not delay the schedule of the next ones, so that the latency
+    // of the messages, measured from their scheduled time, includes the time
+    // spent waiting to be posted.
+    const bsls::Types::Int64 intervalNs =
+        static_cast<bsls::Types::Int64>(d_parameters.postInterval()) *
+        bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MILLISECOND;
+    const bsls::Types::Int64 offsetNs = intervalNs * producerIndex /
+                                        d_parameters.numProducerThreads();
+
+    const bsls::Types::Int64 startTimer = bsls::TimeUtil::getTimer() +
+                                          offsetNs;
+    bsls::Types::Int64       startTime  = 0;
+    if (d_parameters.latency() != ParametersLatency::e_NONE) {
+        // Scheduled times, in the clock used to compute latencies
+        startTime = StatUtil::getNowAsNs(d_parameters.latency()) + offsetNs;
+    }
+
+    for (bsls::Types::Int64 postId = 0;
+         d_isRunning && postingContext->pendingPost();
+         ++postId) {
+        const bsls::Types::Int64 scheduledNs = postId * intervalNs;
+
+        const bsls::Types::Int64 waitNs = startTimer + scheduledNs -
+                                          bsls::TimeUtil::getTimer();
+        if (waitNs > 0) {
+            bslmt::ThreadUtil::microSleep(static_cast<int>(
+                waitNs / bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MICROSECOND));
+        }
+
+        if (d_isConnected) {
+            postingContext->postNext(startTime == 0 ? 0
+                                                    : startTime + scheduledNs);
+        }
+    }
+}
+
 // CLASS METHODS
 int Application::syschk(const m_bmqtool::Parameters& parameters)
 {
@@ -886,7 +947,8 @@ Application::Application(const Parameters& parameters,
 : d_allocator_p(bslma::Default::allocator(allocator))
 , d_parameters(parameters)
 , d_shutdownSemaphore_p(shutdownSemaphore)
-, d_runningThread(bslmt::ThreadUtil::invalidHandle())
+, d_producerThreads(d_allocator_p)
+, d_numRunningProducers(0)
 , d_queueId(d_allocator_p)
 , d_statContext_sp(createStatContext(10, d_allocator_p))
 , d_isConnected(false)
@@ -896,8 +958,8 @@ Application::Application(const Parameters& parameters,
 , d_fileLogger(d_parameters.logFilePath(), d_allocator_p)
 , d_poster(&d_fileLogger, d_statContext_sp.get(), d_allocator_p)
 , d_interactive(parameters, &d_poster, d_allocator_p)
-, d_confirmLatencyStorage("end2end", 3, d_allocator_p)
-, d_ackLatencyStorage("ack", 3, d_allocator_p)
+, d_confirmLatencyStorage("end2end", d_allocator_p)
+, d_ackLatencyStorage("ack", d_allocator_p)
 , d_autoReadInProgress(false)
 , d_autoReadActivity(false)
 , d_numExpectedAcks(0)
@@ -956,14 +1018,20 @@ int Application::run()
     }
     else {
         if (bmqt::QueueFlagsUtil::isWriter(d_parameters.queueFlags())) {
+            const int numProducers = d_parameters.numProducerThreads();
+
             d_numExpectedAcks = d_parameters.eventsCount() *
-                                d_parameters.eventSize();
+                                d_parameters.eventSize() * numProducers;
             d_numAcknowledged = 0;
 
-            // Start the thread
-            rc = bslmt::ThreadUtil::create(
-                &d_runningThread,
-                bdlf::MemFnUtil::memFn(&Application::producerThread, this));
+            // Start the threads
+            d_numRunningProducers = numProducers;
+            for (int i = 0; i < numProducers && rc == 0; ++i) {
+                rc = d_producerThreads.addThread(bdlf::BindUtil::bind(
+                    &Application::producerThread,
+                    this,
+                    i));
+            }
         }
     }
 
@@ -981,10 +1049,7 @@ void Application::stop()
     d_scheduler.cancelAllEventsAndWait();
     d_scheduler.stop();
 
-    if (d_runningThread != bslmt::ThreadUtil::invalidHandle()) {
-        bslmt::ThreadUtil::join(d_runningThread);
-        d_runningThread = bslmt::ThreadUtil::invalidHandle();
-    }
+    d_producerThreads.joinAll();
 
     // Disconnect from the broker
     if (d_parameters.mode() == ParametersMode::e_AUTO) {
@@ -48,7 +48,7 @@
 #include <bsl_memory.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
-#include <bslmt_threadutil.h>
+#include <bslmt_threadgroup.h>
 #include <bsls_atomic.h>
 #include <bsls_types.h>
 
@@ -88,9 +88,13 @@ class Application : public bmqa::SessionEventHandler {
     // Semaphore holding the main thread
     // alive
 
-    bslmt::ThreadUtil::Handle d_runningThread;
-    // Handle on the running thread
-    // (producer mode)
+    bslmt::ThreadGroup d_producerThreads;
+    // Threads posting messages (producer
+    // mode)
+
+    bsls::AtomicInt d_numRunningProducers;
+    // Number of producer threads still
+    // posting messages
 
     bmqa::QueueId d_queueId;
     // Queue to send/receive messages
@@ -129,12 +133,12 @@ class Application : public bmqa::SessionEventHandler {
     Interactive d_interactive;
     // CLI handler.
 
-    /// Storage for confirm message latencies (rounded and bucketed).
+    /// Storage for confirm message latencies.
     /// Confirm message latency is the end-to-end time to deliver a message,
     /// starting from producer post and ending on a consumer.
     LatencyStorage d_confirmLatencyStorage;
 
-    /// Storage for ack message latencies (rounded and bucketed).
+    /// Storage for ack message latencies.
     /// Ack message latency is the time between posting a message and getting
     /// an ACK for it, meaning that the message was at least replicated with
     /// a needed quorum (delivery might not have happened yet).
@@ -208,8 +212,14 @@ class Application : public bmqa::SessionEventHandler {
     /// success.
     int initialize();
 
-    /// Thread to process the publish.
-    void producerThread();
+    /// Thread to process the publish, being the producer thread of the
+    /// specified `producerIndex`.
+    void producerThread(int producerIndex);
+
+    /// Post messages using the specified `postingContext` in open-loop, at
+    /// the times scheduled for the producer thread of the specified
+    /// `producerIndex`.
+    void postOpenLoop(PostingContext* postingContext, int producerIndex);
 
   public:
     // CLASS METHODS
@@ -17,8 +17,9 @@
 #include <m_bmqtool_latencystorage.h>
 
 // BDE
-#include <bsl_cmath.h>
+#include <bsl_algorithm.h>
 #include <bsl_fstream.h>
+#include <bsl_limits.h>
 #include <bslma_default.h>
 #include <bsls_assert.h>
 #include <bsls_types.h>
@@ -29,92 +30,148 @@
 namespace BloombergLP {
 namespace m_bmqtool {
 
+namespace {
+
+/// Store the specified `value` into the specified `min` if lower.
+void storeMin(bsls::AtomicInt64* min, bsls::Types::Int64 value)
+{
+    bsls::Types::Int64 current = min->loadRelaxed();
+    while (value < current) {
+        const bsls::Types::Int64 previous = min->testAndSwap(current, value);
+        if (previous == current) {
+            break;  // BREAK
+        }
+        current = previous;
+    }
+}
+
+/// Store the specified `value` into the specified `max` if higher.
+void storeMax(bsls::AtomicInt64* max, bsls::Types::Int64 value)
+{
+    bsls::Types::Int64 current = max->loadRelaxed();
+    while (current < value) {
+        const bsls::Types::Int64 previous = max->testAndSwap(current, value);
+        if (previous == current) {
+            break;  // BREAK
+        }
+        current = previous;
+    }
+}
+
+}  // close unnamed namespace
+
 LatencyStorage::LatencyStorage(bsl::string_view  origin,
-                               int               latencyDigits,
                                bslma::Allocator* allocator)
 : d_allocator_p(bslma::Default::allocator(allocator))
 , d_origin(origin, d_allocator_p)
-, d_digitsLimit(1)
+, d_current(d_allocator_p)
+, d_total(d_allocator_p)
+, d_timeline(d_allocator_p)
+, d_timelineBounds(d_allocator_p)
+, d_intervalMin(bsl::numeric_limits<bsls::Types::Int64>::max())
+, d_intervalMax(0)
 , d_totalCount(0)
-, d_latencies(d_allocator_p)
+, d_sum(0)
+, d_min(bsl::numeric_limits<bsls::Types::Int64>::max())
+, d_max(0)
 {
-    BSLS_ASSERT_SAFE(1 <= latencyDigits && latencyDigits <= 9);
-
-    for (int i = 0; i < latencyDigits; ++i) {
-        d_digitsLimit *= 10;
-    }
+    // NOTHING
 }
 
 void LatencyStorage::insert(bsls::Types::Int64 latency)
 {
     BSLS_ASSERT_SAFE(0 <= latency);
 
-    bsls::Types::Int64 divisor = 1;
-    while (divisor * d_digitsLimit < latency) {
-        divisor *= 10;
-    }
+    // Store the bounds of the interval before recording the latency, so that
+    // those of the interval closing it are always stored when 'snapshot'
+    // resets them after moving the recorded latencies.
+    storeMin(&d_intervalMin, latency);
+    storeMax(&d_intervalMax, latency);
 
-    bsls::Types::Int64 rounded = (latency / divisor) * divisor;
+    d_current.record(latency);
+    d_sum.addRelaxed(latency);
+    storeMin(&d_min, latency);
+    storeMax(&d_max, latency);
 
-    ++d_latencies[rounded];
-    ++d_totalCount;
+    // Count last, so that the minimum and maximum of counted latencies are
+    // always stored.
+    d_totalCount.add(1);
 }
 
-bsls::Types::Int64 LatencyStorage::computePercentile(double percentile) const
+void LatencyStorage::snapshot()
+{
+    d_timeline.emplace_back();
+    d_current.moveTo(&d_timeline.back());
+    d_total.add(d_timeline.back());
+
+    d_timelineBounds.emplace_back(
+        d_intervalMin.swap(bsl::numeric_limits<bsls::Types::Int64>::max()),
+        d_intervalMax.swap(0));
+}
+
+void LatencyStorage::loadHistogram(bmqst::Histogram* histogram) const
+{
+    d_current.loadHistogram(histogram);
+    histogram->add(d_total);
+}
+
+bsls::Types::Int64
+LatencyStorage::boundedPercentile(const bmqst::Histogram& histogram,
+                                  double                  percentile) const
+{
+    return boundedPercentile(histogram,
+                             percentile,
+                             Bounds(minLatency(), maxLatency()));
+}
+
+bsls::Types::Int64
+LatencyStorage::boundedPercentile(const bmqst::Histogram& histogram,
+                                  double                  percentile,
+                                  const Bounds&           bounds)
 {
     BSLS_ASSERT_SAFE(0 <= percentile && percentile <= 100.0);
 
-    if (d_totalCount == 0) {
+    if (histogram.isEmpty()) {
         return 0;  // RETURN
     }
 
-    bsls::Types::Int64 targetCount = static_cast<bsls::Types::Int64>(
-        bsl::ceil(percentile * static_cast<double>(d_totalCount) / 100.0));
+    // The highest value of a bucket may be beyond the actual latencies.
+    return bsl::min(bsl::max(histogram.valueAtPercentile(percentile),
+                             bounds.first),
+                    bounds.second);
+}
 
-    bsls::Types::Int64 accumulated = 0;
-    for (LatencyMap::const_iterator it = d_latencies.begin();
-         it != d_latencies.end();
-         ++it) {
-        accumulated += it->second;
-        if (targetCount <= accumulated) {
-            return it->first;  // RETURN
-        }
-    }
+bsls::Types::Int64 LatencyStorage::computePercentile(double percentile) const
+{
+    bmqst::Histogram histogram(d_allocator_p);
+    loadHistogram(&histogram);
 
-    // We should be able to find the required bucket in the loop,
-    // keep this return for safety.
-    return d_latencies.rbegin()->first;  // RETURN
+    return boundedPercentile(histogram, percentile);
 }
 
 bsls::Types::Int64 LatencyStorage::minLatency() const
 {
-    if (d_latencies.empty()) {
+    if (totalCount() == 0) {
         return 0;  // RETURN
     }
-    return d_latencies.begin()->first;
+    return d_min.load();
 }
 
 bsls::Types::Int64 LatencyStorage::maxLatency() const
 {
-    if (d_latencies.empty()) {
+    if (totalCount() == 0) {
         return 0;  // RETURN
     }
-    return d_latencies.rbegin()->first;
+    return d_max.load();
 }
 
 bsls::Types::Int64 LatencyStorage::avgLatency() const
 {
-    if (d_totalCount == 0) {
+    const bsls::Types::Int64 count = totalCount();
+    if (count == 0) {
         return 0;  // RETURN
     }
-
-    bsls::Types::Int64 sum = 0;
-    for (LatencyMap::const_iterator it = d_latencies.begin();
-         it != d_latencies.end();
-         ++it) {
-        sum += it->first * it->second;
-    }
-    return sum / d_totalCount;
+    return d_sum.load() / count;
 }
 
 int LatencyStorage::save(const bsl::string& filename) const
@@ -124,28 +181,65 @@ int LatencyStorage::save(const bsl::string& filename) const
         return -1;  // RETURN
     }
 
+    bmqst::Histogram histogram(d_allocator_p);
+    loadHistogram(&histogram);
+
     file << "{\n";
     file << "  \"origin\": \"" << d_origin << "\",\n";
     file << "  \"min\": " << minLatency() << ",\n";
     file << "  \"max\": " << maxLatency() << ",\n";
     file << "  \"avg\": " << avgLatency() << ",\n";
-    file << "  \"median\": " << computePercentile(50) << ",\n";
-    file << "  \"95percentile\": " << computePercentile(95) << ",\n";
-    file << "  \"96percentile\": " << computePercentile(96) << ",\n";
-    file << "  \"97percentile\": " << computePercentile(97) << ",\n";
-    file << "  \"98percentile\": " << computePercentile(98) << ",\n";
-    file << "  \"99percentile\": " << computePercentile(99) << ",\n";
+    file << "  \"median\": " << boundedPercentile(histogram, 50) << ",\n";
+    file << "  \"95percentile\": " << boundedPercentile(histogram, 95)
+         << ",\n";
+    file << "  \"96percentile\": " << boundedPercentile(histogram, 96)
+         << ",\n";
+    file << "  \"97percentile\": " << boundedPercentile(histogram, 97)
+         << ",\n";
+    file << "  \"98percentile\": " << boundedPercentile(histogram, 98)
+         << ",\n";
+    file << "  \"99percentile\": " << boundedPercentile(histogram, 99)
+         << ",\n";
+    file << "  \"99.9percentile\": " << boundedPercentile(histogram, 99.9)
+         << ",\n";
+
+    // Count of each bucket, keyed by its lowest latency
     file << "  \"dataPoints\": {";
-    for (LatencyMap::const_iterator cit = d_latencies.cbegin();
-         cit != d_latencies.cend();
+    const bmqst::Histogram::Buckets& buckets = histogram.buckets();
+    for (bmqst::Histogram::Buckets::const_iterator cit = buckets.cbegin();
+         cit != buckets.cend();
          ++cit) {
-        if (cit != d_latencies.cbegin()) {
+        if (cit != buckets.cbegin()) {
+            // Not the first entry, add a separator
+            file << ",";
+        }
+        file << "\n    \""
+             << bmqst::Histogram::bucketLowestValue(cit->first)
+             << "\": " << cit->second;
+    }
+    file << "\n  },\n";
+
+    // Percentiles of each interval of the timeline, bounded by the minimum
+    // and maximum latencies of that interval
+    file << "  \"timeline\": [";
+    for (size_t i = 0; i < d_timeline.size(); ++i) {
+        if (i != 0) {
             // Not the first entry, add a separator
             file << ",";
         }
-        file << "\n    \"" << cit->first << "\": " << cit->second;
+        const bmqst::Histogram& interval = d_timeline[i];
+        const Bounds&           bounds   = d_timelineBounds[i];
+        file << "\n    {\"interval\": " << i
+             << ", \"count\": " << interval.count() << ", \"median\": "
+             << boundedPercentile(interval, 50, bounds)
+             << ", \"99percentile\": "
+             << boundedPercentile(interval, 99, bounds)
+             << ", \"99.9percentile\": "
+             << boundedPercentile(interval, 99.9, bounds)
+             << ", \"max\": " << boundedPercentile(interval, 100, bounds)
+             << "}";
     }
-    file << "\n  }\n";
+    file << "\n  ]\n";
     file << "}\n";
 
     if (!file) {
@@ -166,16 +260,20 @@ void LatencyStorage::printSummary(bsl::ostream& stream) const
     stream << "    " << (DESC) << ": "                                        \
            << bmqu::PrintUtil::prettyTimeInterval(TIMESTAMP) << "\n";
 
-    stream << "    totalCount......: " << d_totalCount << "\n";
+    bmqst::Histogram histogram(d_allocator_p);
+    loadHistogram(&histogram);
+
+    stream << "    totalCount......: " << totalCount() << "\n";
     BMQTOOL_LSTAT("min.............", minLatency());
     BMQTOOL_LSTAT("avg.............", avgLatency());
     BMQTOOL_LSTAT("max.............", maxLatency());
-    BMQTOOL_LSTAT("median..........", computePercentile(50));
-    BMQTOOL_LSTAT("95Percentile....", computePercentile(95));
-    BMQTOOL_LSTAT("96Percentile....", computePercentile(96));
-    BMQTOOL_LSTAT("97Percentile....", computePercentile(97));
-    BMQTOOL_LSTAT("98Percentile....", computePercentile(98));
-    BMQTOOL_LSTAT("99Percentile....", computePercentile(99));
+    BMQTOOL_LSTAT("median..........", boundedPercentile(histogram, 50));
+    BMQTOOL_LSTAT("95Percentile....", boundedPercentile(histogram, 95));
+    BMQTOOL_LSTAT("96Percentile....", boundedPercentile(histogram, 96));
+    BMQTOOL_LSTAT("97Percentile....", boundedPercentile(histogram, 97));
+    BMQTOOL_LSTAT("98Percentile....", boundedPercentile(histogram, 98));
+    BMQTOOL_LSTAT("99Percentile....", boundedPercentile(histogram, 99));
+    BMQTOOL_LSTAT("99.9Percentile..", boundedPercentile(histogram, 99.9));
 
 #undef BMQTOOL_LSTAT
 }
@@ -22,18 +22,33 @@
 //  m_bmqtool::LatencyStorage: Storage and analysis of latency measurements.
 //
 //@DESCRIPTION: 'm_bmqtool::LatencyStorage' stores latency measurements
-// (in nanoseconds) with automatic rounding to a specified precision for
-// bucketing. It provides APIs to compute percentiles, save JSON reports,
-// and print human-readable summaries.
+// (in nanoseconds) into an HDR histogram, reporting each of them with a
+// relative error of at most 6.25%, while the minimum, maximum and average are
+// exact.  It provides APIs to compute percentiles, save JSON reports, and
+// print human-readable summaries.
+//
+// Each call to 'snapshot' closes an interval of the timeline of the storage,
+// holding the latencies inserted since the previous call, so that calling it
+// every second gives the percentiles per second over time in the report.
+// The percentiles of an interval are bounded by the minimum and maximum
+// latencies of that interval, tracked along with its histogram.
+//
+// 'insert' is thread-safe and lock-free, and may be called concurrently with
+// 'snapshot'.  All other methods must be called from a single thread.
+
+// BMQ
+#include <bmqst_histogram.h>
 
 // BDE
-#include <bsl_map.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_string_view.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_atomic.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -42,15 +57,54 @@ namespace m_bmqtool {
 class LatencyStorage {
   private:
     // PRIVATE TYPES
-    typedef bsl::map<bsls::Types::Int64, bsls::Types::Int64>
-        LatencyMap;  // Maps rounded latency to counter
+    typedef bsl::vector<bmqst::Histogram> Timeline;
+
+    /// Minimum and maximum latencies of an interval of the timeline.
+    typedef bsl::pair<bsls::Types::Int64, bsls::Types::Int64> Bounds;
+
+    typedef bsl::vector<Bounds> TimelineBounds;
 
     // DATA
-    bslma::Allocator*  d_allocator_p;
-    bsl::string        d_origin;
-    bsls::Types::Int64 d_digitsLimit;
-    bsls::Types::Int64 d_totalCount;
-    LatencyMap         d_latencies;
+    bslma::Allocator* d_allocator_p;
+    bsl::string       d_origin;
+
+    /// Latencies inserted since the last snapshot.
+    bmqst::AtomicHistogram d_current;
+
+    /// Latencies inserted up to the last snapshot.
+    bmqst::Histogram d_total;
+
+    /// Latencies inserted during each interval between two snapshots.
+    Timeline d_timeline;
+
+    /// Minimum and maximum latencies of each interval of `d_timeline`.
+    TimelineBounds d_timelineBounds;
+
+    /// Minimum and maximum latencies inserted since the last snapshot.
+    bsls::AtomicInt64 d_intervalMin;
+    bsls::AtomicInt64 d_intervalMax;
+
+    bsls::AtomicInt64 d_totalCount;
+    bsls::AtomicInt64 d_sum;
+    bsls::AtomicInt64 d_min;
+    bsls::AtomicInt64 d_max;
+
+    // PRIVATE ACCESSORS
+
+    /// Load into the specified `histogram` all the inserted latencies.
+    void loadHistogram(bmqst::Histogram* histogram) const;
+
+    /// Return the value at the specified `percentile` of the specified
+    /// `histogram`, bounded by the minimum and maximum latencies.
+    bsls::Types::Int64 boundedPercentile(const bmqst::Histogram& histogram,
+                                         double percentile) const;
+
+    /// Return the value at the specified `percentile` of the specified
+    /// `histogram`, bounded by the specified `bounds`.
+    static bsls::Types::Int64
+    boundedPercentile(const bmqst::Histogram& histogram,
+                      double                  percentile,
+                      const Bounds&           bounds);
 
   public:
     // TRAITS
@@ -58,12 +112,10 @@ class LatencyStorage {
 
     // CREATORS
 
-    /// @brief Create a LatencyStorage with the specified origin and precision.
+    /// @brief Create a LatencyStorage with the specified origin.
     /// @param origin Origin name for JSON reports (e.g., "end2end", "ack")
-    /// @param latencyDigits Number of decimal digits for rounding (1-9)
     /// @param allocator Optional allocator for memory (uses default if 0)
     explicit LatencyStorage(bsl::string_view  origin,
-                            int               latencyDigits,
                             bslma::Allocator* allocator = 0);
 
     // MANIPULATORS
@@ -72,6 +124,9 @@ class LatencyStorage {
     /// @param latency Latency value in nanoseconds
     void insert(bsls::Types::Int64 latency);
 
+    /// @brief Close the current interval of the timeline.
+    void snapshot();
+
     /// @brief Save the latency report to a JSON file.
     /// @param filename Path to output file
     /// @return 0 on success, non-zero error code on failure
@@ -86,6 +141,9 @@ class LatencyStorage {
     /// @brief Return the total number of latencies stored.
     bsls::Types::Int64 totalCount() const;
 
+    /// @brief Return the number of closed intervals of the timeline.
+    int timelineSize() const;
+
     /// @brief Compute a percentile latency value.
     /// @param percentile Percentile level (0-100)
     /// @return Latency at the specified percentile, or 0 if empty
@@ -104,7 +162,12 @@ class LatencyStorage {
 // INLINE DEFINITIONS
 inline bsls::Types::Int64 LatencyStorage::totalCount() const
 {
-    return d_totalCount;
+    return d_totalCount.load();
+}
+
+inline int LatencyStorage::timelineSize() const
+{
+    return static_cast<int>(d_timeline.size());
 }
 
 }  // close package namespace
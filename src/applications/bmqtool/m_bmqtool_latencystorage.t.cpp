@@ -17,12 +17,14 @@
 #include <m_bmqtool_latencystorage.h>
 
 // BDE
+#include <bdlf_bind.h>
 #include <bmqtst_tempfile.h>
 #include <bmqtst_testhelper.h>
 #include <bsl_cstdlib.h>
 #include <bsl_fstream.h>
 #include <bsl_ios.h>
 #include <bsl_iostream.h>
+#include <bslmt_threadgroup.h>
 #include <bsls_types.h>
 
 // CONVENIENCE
@@ -41,7 +43,7 @@ static void test1_breathingTest()
 {
     bmqtst::TestHelper::printTestName("BREATHING TEST");
 
-    LatencyStorage storage("test", 2, bmqtst::TestHelperUtil::allocator());
+    LatencyStorage storage("test", bmqtst::TestHelperUtil::allocator());
 
     BMQTST_ASSERT_EQ(storage.totalCount(), 0);
 
@@ -52,56 +54,59 @@ static void test1_breathingTest()
     BMQTST_ASSERT_EQ(storage.totalCount(), 2);
 }
 
-static void test2_roundingPrecisionTest()
+static void test2_precisionTest()
 // ------------------------------------------------------------------------
-// ROUNDING PRECISION TEST
+// PRECISION TEST
 //
-// Verify that latencies are grouped into correct buckets with different
-// 'latencyDigits' values.
+// Verify that low latencies are exact, that percentiles have a relative
+// error of at most 1/16th, and that they are bounded by the exact minimum
+// and maximum latencies.
 // ------------------------------------------------------------------------
 {
-    bmqtst::TestHelper::printTestName("ROUNDING PRECISION TEST");
+    bmqtst::TestHelper::printTestName("PRECISION TEST");
 
-    // Test with latencyDigits = 1
+    // Latencies below 32ns are exact
     {
-        LatencyStorage storage("test", 1);
+        LatencyStorage storage("test", bmqtst::TestHelperUtil::allocator());
 
-        storage.insert(100);  // 100 rounds to 100
-        storage.insert(105);  // 105 rounds to 100
-        storage.insert(199);  // 199 rounds to 100
-
-        storage.insert(200);  // 200 rounds to 200
-        storage.insert(205);  // 205 rounds to 200
-
-        BMQTST_ASSERT_EQ(storage.totalCount(), 5);
-
-        // Buckets: 100 (3 items), 200 (2 items)
-        bsls::Types::Int64 p50 = storage.computePercentile(50);
-        BMQTST_ASSERT_EQ(p50, 100);
+        for (bsls::Types::Int64 latency = 1; latency <= 31; ++latency) {
+            storage.insert(latency);
+        }
 
-        bsls::Types::Int64 p100 = storage.computePercentile(100);
-        BMQTST_ASSERT_EQ(p100, 200);
+        BMQTST_ASSERT_EQ(storage.totalCount(), 31);
+        BMQTST_ASSERT_EQ(storage.computePercentile(0), 1);
+        BMQTST_ASSERT_EQ(storage.computePercentile(50), 16);
+        BMQTST_ASSERT_EQ(storage.computePercentile(100), 31);
     }
 
-    // Test with latencyDigits = 2
+    // Higher latencies have a bounded relative error
     {
-        LatencyStorage storage("test", 2, bmqtst::TestHelperUtil::allocator());
-
-        storage.insert(500);   // 500 rounds to 500
-        storage.insert(550);   // 550 rounds to 550
-        storage.insert(1000);  // 1000 rounds to 1000
-        storage.insert(1050);  // 1050 rounds to 1000
+        LatencyStorage storage("test", bmqtst::TestHelperUtil::allocator());
 
-        BMQTST_ASSERT_EQ(storage.totalCount(), 4);
-        BMQTST_ASSERT_EQ(storage.minLatency(), 500);
-        BMQTST_ASSERT_EQ(storage.maxLatency(), 1000);
+        const bsls::Types::Int64 k_NUM_LATENCIES = 10000;
+        for (bsls::Types::Int64 i = 1; i <= k_NUM_LATENCIES; ++i) {
+            storage.insert(i * 1000);
+        }
 
-        // Buckets: 500 (1 item), 550 (1 item), 1000 (2 items)
-        bsls::Types::Int64 p50 = storage.computePercentile(50);
-        BMQTST_ASSERT(p50 == 550 || p50 == 1000);
+        const double PERCENTILES[]   = {10, 50, 90, 99, 99.9};
+        const int    NUM_PERCENTILES = sizeof(PERCENTILES) /
+                                    sizeof(*PERCENTILES);
+        for (int i = 0; i < NUM_PERCENTILES; ++i) {
+            const bsls::Types::Int64 exact = static_cast<bsls::Types::Int64>(
+                PERCENTILES[i] * k_NUM_LATENCIES * 10);
+            const bsls::Types::Int64 result = storage.computePercentile(
+                PERCENTILES[i]);
+            BMQTST_ASSERT_LE(exact, result);
+            BMQTST_ASSERT_LE(result, exact + exact / 16);
+        }
 
-        bsls::Types::Int64 p100 = storage.computePercentile(100);
-        BMQTST_ASSERT_EQ(p100, 1000);
+        // Bounded by the exact maximum
+        BMQTST_ASSERT_LE(1000, storage.computePercentile(0));
+        BMQTST_ASSERT_LE(storage.computePercentile(0), 1000 + 1000 / 16);
+        BMQTST_ASSERT_EQ(storage.computePercentile(100),
+                         k_NUM_LATENCIES * 1000);
+        BMQTST_ASSERT_EQ(storage.minLatency(), 1000);
+        BMQTST_ASSERT_EQ(storage.maxLatency(), k_NUM_LATENCIES * 1000);
     }
 }
 
@@ -114,7 +119,7 @@ static void test3_percentileComputationTest()
 {
     bmqtst::TestHelper::printTestName("PERCENTILE COMPUTATION TEST");
 
-    LatencyStorage storage("test", 1);
+    LatencyStorage storage("test", bmqtst::TestHelperUtil::allocator());
 
     // Insert 10 latencies: 10, 10, 20, 20, 20, 30, 30, 40, 50, 60
     for (int i = 0; i < 2; ++i) {
@@ -156,7 +161,7 @@ static void test4_emptyStorageTest()
 {
     bmqtst::TestHelper::printTestName("EMPTY STORAGE TEST");
 
-    LatencyStorage storage("test", 2, bmqtst::TestHelperUtil::allocator());
+    LatencyStorage storage("test", bmqtst::TestHelperUtil::allocator());
 
     BMQTST_ASSERT_EQ(storage.totalCount(), 0);
     BMQTST_ASSERT_EQ(storage.minLatency(), 0);
@@ -173,7 +178,7 @@ static void test5_statisticsTest()
 {
     bmqtst::TestHelper::printTestName("STATISTICS TEST");
 
-    LatencyStorage storage("test", 1);
+    LatencyStorage storage("test", bmqtst::TestHelperUtil::allocator());
 
     // Insert: 10, 10, 20, 30, 30, 30
     // Min: 10, Max: 30, Avg: (10+10+20+30+30+30)/6 = 130/6 ≈ 21.67
@@ -202,7 +207,7 @@ static void test6_saveAndLoadTest()
 
     bmqtst::TempFile tempFile;
     {
-        LatencyStorage storage("test", 2, bmqtst::TestHelperUtil::allocator());
+        LatencyStorage storage("test", bmqtst::TestHelperUtil::allocator());
 
         storage.insert(100);
         storage.insert(100);
@@ -235,10 +240,162 @@ static void test6_saveAndLoadTest()
     BMQTST_ASSERT(content.find("\"dataPoints\": {") != bsl::string::npos);
     BMQTST_ASSERT(content.find("\"100\": 2") !=
                   bsl::string::npos);  // 100 appears 2 times
-    BMQTST_ASSERT(content.find("\"300\": 3") !=
-                  bsl::string::npos);  // 300 appears 3 times
+    BMQTST_ASSERT(content.find("\"288\": 3") !=
+                  bsl::string::npos);  // 300 appears 3 times, in [288, 303]
     BMQTST_ASSERT(content.find("\"median\":") != bsl::string::npos);
     BMQTST_ASSERT(content.find("\"99percentile\":") != bsl::string::npos);
+    BMQTST_ASSERT(content.find("\"99.9percentile\": 300") !=
+                  bsl::string::npos);
+    BMQTST_ASSERT(content.find("\"timeline\": [") != bsl::string::npos);
+}
+
+static void test7_timelineTest()
+// ------------------------------------------------------------------------
+// TIMELINE TEST
+//
+// Verify that each snapshot closes an interval of the timeline holding the
+// latencies inserted since the previous one, that the percentiles of each
+// interval are bounded by its own minimum and maximum latencies, and that
+// the totals include the latencies of all intervals as well as the current
+// one.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("TIMELINE TEST");
+
+    bmqtst::TempFile tempFile;
+    {
+        LatencyStorage storage("test", bmqtst::TestHelperUtil::allocator());
+
+        storage.insert(10);
+        storage.insert(20);
+        storage.snapshot();
+
+        // Empty interval
+        storage.snapshot();
+
+        storage.insert(30);
+        storage.snapshot();
+
+        // Not yet in the timeline
+        storage.insert(5);
+
+        BMQTST_ASSERT_EQ(storage.timelineSize(), 3);
+        BMQTST_ASSERT_EQ(storage.totalCount(), 4);
+        BMQTST_ASSERT_EQ(storage.minLatency(), 5);
+        BMQTST_ASSERT_EQ(storage.maxLatency(), 30);
+        BMQTST_ASSERT_EQ(storage.computePercentile(0), 5);
+        BMQTST_ASSERT_EQ(storage.computePercentile(50), 10);
+
+        int rc = storage.save(tempFile.path());
+        BMQTST_ASSERT_EQ(rc, 0);
+    }
+
+    bsl::ifstream file(tempFile.path().c_str());
+    BMQTST_ASSERT(file.good());
+
+    bsl::string line;
+    bsl::string content;
+    while (bsl::getline(file, line)) {
+        content += line + "\n";
+    }
+    file.close();
+
+    BMQTST_ASSERT(content.find("{\"interval\": 0, \"count\": 2, "
+                               "\"median\": 10, \"99percentile\": 20, "
+                               "\"99.9percentile\": 20, \"max\": 20}") !=
+                  bsl::string::npos);
+    BMQTST_ASSERT(content.find("{\"interval\": 1, \"count\": 0, "
+                               "\"median\": 0, \"99percentile\": 0, "
+                               "\"99.9percentile\": 0, \"max\": 0}") !=
+                  bsl::string::npos);
+    BMQTST_ASSERT(content.find("{\"interval\": 2, \"count\": 1, "
+                               "\"median\": 30, \"99percentile\": 30, "
+                               "\"99.9percentile\": 30, \"max\": 30}") !=
+                  bsl::string::npos);
+    BMQTST_ASSERT(content.find("\"interval\": 3") == bsl::string::npos);
+
+    // The bucket of 1000 goes up to 1023, which is below the maximum of all
+    // the latencies but beyond that of the first interval.
+    bmqtst::TempFile boundsFile;
+    {
+        LatencyStorage storage("test", bmqtst::TestHelperUtil::allocator());
+
+        storage.insert(1000);
+        storage.snapshot();
+
+        storage.insert(5000);
+        storage.snapshot();
+
+        BMQTST_ASSERT_EQ(storage.maxLatency(), 5000);
+
+        int rc = storage.save(boundsFile.path());
+        BMQTST_ASSERT_EQ(rc, 0);
+    }
+
+    file.open(boundsFile.path().c_str());
+    BMQTST_ASSERT(file.good());
+
+    content.clear();
+    while (bsl::getline(file, line)) {
+        content += line + "\n";
+    }
+    file.close();
+
+    BMQTST_ASSERT(content.find("{\"interval\": 0, \"count\": 1, "
+                               "\"median\": 1000, \"99percentile\": 1000, "
+                               "\"99.9percentile\": 1000, \"max\": 1000}") !=
+                  bsl::string::npos);
+    BMQTST_ASSERT(content.find("{\"interval\": 1, \"count\": 1, "
+                               "\"median\": 5000, \"99percentile\": 5000, "
+                               "\"99.9percentile\": 5000, \"max\": 5000}") !=
+                  bsl::string::npos);
+}
+
+/// Insert the specified `numLatencies` latencies of 1 to `numLatencies`
+/// microseconds into the specified `storage`.
+static void insertLatencies(LatencyStorage* storage, int numLatencies)
+{
+    for (int i = 1; i <= numLatencies; ++i) {
+        storage->insert(static_cast<bsls::Types::Int64>(i) * 1000);
+    }
+}
+
+static void test8_concurrentInsertTest()
+// ------------------------------------------------------------------------
+// CONCURRENT INSERT TEST
+//
+// Verify that latencies inserted concurrently by several threads, while
+// snapshots are taken, are all counted.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("CONCURRENT INSERT TEST");
+
+    const int k_NUM_THREADS   = 4;
+    const int k_NUM_LATENCIES = 100000;
+
+    LatencyStorage storage("test", bmqtst::TestHelperUtil::allocator());
+
+    bslmt::ThreadGroup threadGroup(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        int rc = threadGroup.addThread(
+            bdlf::BindUtil::bind(&insertLatencies, &storage, k_NUM_LATENCIES));
+        BMQTST_ASSERT_EQ_D(i, rc, 0);
+    }
+
+    for (int i = 0; i < 10; ++i) {
+        storage.snapshot();
+    }
+    threadGroup.joinAll();
+    storage.snapshot();
+
+    BMQTST_ASSERT_EQ(storage.totalCount(), k_NUM_THREADS * k_NUM_LATENCIES);
+    BMQTST_ASSERT_EQ(storage.minLatency(), 1000);
+    BMQTST_ASSERT_EQ(storage.maxLatency(), k_NUM_LATENCIES * 1000);
+    BMQTST_ASSERT_EQ(storage.avgLatency(), (k_NUM_LATENCIES + 1) * 500);
+
+    const bsls::Types::Int64 median = storage.computePercentile(50);
+    BMQTST_ASSERT_LE(k_NUM_LATENCIES * 500, median);
+    BMQTST_ASSERT_LE(median, k_NUM_LATENCIES * 500 * 17 / 16);
 }
 
 static void test_N1_manualSaveInspection()
@@ -253,7 +410,7 @@ static void test_N1_manualSaveInspection()
 
     bsl::string filename = "/tmp/latency_storage_dump.json";
 
-    LatencyStorage storage("test", 3, bmqtst::TestHelperUtil::allocator());
+    LatencyStorage storage("test", bmqtst::TestHelperUtil::allocator());
 
     cout << "\nGenerating random latencies..." << endl;
 
@@ -320,11 +477,13 @@ int main(int argc, char* argv[])
     switch (_testCase) {
     case 0:
     case 1: test1_breathingTest(); break;
-    case 2: test2_roundingPrecisionTest(); break;
+    case 2: test2_precisionTest(); break;
     case 3: test3_percentileComputationTest(); break;
     case 4: test4_emptyStorageTest(); break;
     case 5: test5_statisticsTest(); break;
     case 6: test6_saveAndLoadTest(); break;
+    case 7: test7_timelineTest(); break;
+    case 8: test8_concurrentInsertTest(); break;
     case -1: test_N1_manualSaveInspection(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
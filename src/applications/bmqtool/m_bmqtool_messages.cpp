@@ -4374,6 +4374,10 @@ const char CommandLineParameters::DEFAULT_INITIALIZER_AUTHN_MECHANISM[] = "";
 
 const char CommandLineParameters::DEFAULT_INITIALIZER_AUTHN_DATA[] = "";
 
+const int CommandLineParameters::DEFAULT_INITIALIZER_PRODUCER_THREADS = 1;
+
+const bool CommandLineParameters::DEFAULT_INITIALIZER_OPEN_LOOP = false;
+
 const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_MODE,
      "mode",
@@ -4529,6 +4533,16 @@ const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
      "authnData",
      sizeof("authnData") - 1,
      "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_PRODUCER_THREADS,
+     "producerThreads",
+     sizeof("producerThreads") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_OPEN_LOOP,
+     "openLoop",
+     sizeof("openLoop") - 1,
+     "",
      bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
@@ -4536,7 +4550,7 @@ const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo*
 CommandLineParameters::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 31; ++i) {
+    for (int i = 0; i < 33; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             CommandLineParameters::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4613,6 +4627,10 @@ const bdlat_AttributeInfo* CommandLineParameters::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AUTHN_MECHANISM];
     case ATTRIBUTE_ID_AUTHN_DATA:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AUTHN_DATA];
+    case ATTRIBUTE_ID_PRODUCER_THREADS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCER_THREADS];
+    case ATTRIBUTE_ID_OPEN_LOOP:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OPEN_LOOP];
     default: return 0;
     }
 }
@@ -4648,10 +4666,12 @@ CommandLineParameters::CommandLineParameters(bslma::Allocator* basicAllocator)
 , d_shutdownGrace(DEFAULT_INITIALIZER_SHUTDOWN_GRACE)
 , d_autoPubSubModulo(DEFAULT_INITIALIZER_AUTO_PUB_SUB_MODULO)
 , d_timeoutSec(DEFAULT_INITIALIZER_TIMEOUT_SEC)
+, d_producerThreads(DEFAULT_INITIALIZER_PRODUCER_THREADS)
 , d_dumpMsg(DEFAULT_INITIALIZER_DUMP_MSG)
 , d_confirmMsg(DEFAULT_INITIALIZER_CONFIRM_MSG)
 , d_memoryDebug(DEFAULT_INITIALIZER_MEMORY_DEBUG)
 , d_noSessionEventHandler(DEFAULT_INITIALIZER_NO_SESSION_EVENT_HANDLER)
+, d_openLoop(DEFAULT_INITIALIZER_OPEN_LOOP)
 {
 }
 
@@ -4686,10 +4706,12 @@ CommandLineParameters::CommandLineParameters(
 , d_shutdownGrace(original.d_shutdownGrace)
 , d_autoPubSubModulo(original.d_autoPubSubModulo)
 , d_timeoutSec(original.d_timeoutSec)
+, d_producerThreads(original.d_producerThreads)
 , d_dumpMsg(original.d_dumpMsg)
 , d_confirmMsg(original.d_confirmMsg)
 , d_memoryDebug(original.d_memoryDebug)
 , d_noSessionEventHandler(original.d_noSessionEventHandler)
+, d_openLoop(original.d_openLoop)
 {
 }
 
@@ -4724,10 +4746,12 @@ CommandLineParameters::CommandLineParameters(
   d_shutdownGrace(bsl::move(original.d_shutdownGrace)),
   d_autoPubSubModulo(bsl::move(original.d_autoPubSubModulo)),
   d_timeoutSec(bsl::move(original.d_timeoutSec)),
+  d_producerThreads(bsl::move(original.d_producerThreads)),
   d_dumpMsg(bsl::move(original.d_dumpMsg)),
   d_confirmMsg(bsl::move(original.d_confirmMsg)),
   d_memoryDebug(bsl::move(original.d_memoryDebug)),
-  d_noSessionEventHandler(bsl::move(original.d_noSessionEventHandler))
+  d_noSessionEventHandler(bsl::move(original.d_noSessionEventHandler)),
+  d_openLoop(bsl::move(original.d_openLoop))
 {
 }
 
@@ -4761,10 +4785,12 @@ CommandLineParameters::CommandLineParameters(CommandLineParameters&& original,
 , d_shutdownGrace(bsl::move(original.d_shutdownGrace))
 , d_autoPubSubModulo(bsl::move(original.d_autoPubSubModulo))
 , d_timeoutSec(bsl::move(original.d_timeoutSec))
+, d_producerThreads(bsl::move(original.d_producerThreads))
 , d_dumpMsg(bsl::move(original.d_dumpMsg))
 , d_confirmMsg(bsl::move(original.d_confirmMsg))
 , d_memoryDebug(bsl::move(original.d_memoryDebug))
 , d_noSessionEventHandler(bsl::move(original.d_noSessionEventHandler))
+, d_openLoop(bsl::move(original.d_openLoop))
 {
 }
 #endif
@@ -4810,6 +4836,8 @@ CommandLineParameters::operator=(const CommandLineParameters& rhs)
         d_timeoutSec               = rhs.d_timeoutSec;
         d_authnMechanism           = rhs.d_authnMechanism;
         d_authnData                = rhs.d_authnData;
+        d_producerThreads          = rhs.d_producerThreads;
+        d_openLoop                 = rhs.d_openLoop;
     }
 
     return *this;
@@ -4852,6 +4880,8 @@ CommandLineParameters::operator=(CommandLineParameters&& rhs)
         d_timeoutSec               = bsl::move(rhs.d_timeoutSec);
         d_authnMechanism           = bsl::move(rhs.d_authnMechanism);
         d_authnData                = bsl::move(rhs.d_authnData);
+        d_producerThreads          = bsl::move(rhs.d_producerThreads);
+        d_openLoop                 = bsl::move(rhs.d_openLoop);
     }
 
     return *this;
@@ -4892,6 +4922,8 @@ void CommandLineParameters::reset()
     d_timeoutSec       = DEFAULT_INITIALIZER_TIMEOUT_SEC;
     d_authnMechanism   = DEFAULT_INITIALIZER_AUTHN_MECHANISM;
     d_authnData        = DEFAULT_INITIALIZER_AUTHN_DATA;
+    d_producerThreads  = DEFAULT_INITIALIZER_PRODUCER_THREADS;
+    d_openLoop         = DEFAULT_INITIALIZER_OPEN_LOOP;
 }
 
 // ACCESSORS
@@ -4935,6 +4967,8 @@ bsl::ostream& CommandLineParameters::print(bsl::ostream& stream,
     printer.printAttribute("timeoutSec", this->timeoutSec());
     printer.printAttribute("authnMechanism", this->authnMechanism());
     printer.printAttribute("authnData", this->authnData());
+    printer.printAttribute("producerThreads", this->producerThreads());
+    printer.printAttribute("openLoop", this->openLoop());
     printer.end();
     return stream;
 }
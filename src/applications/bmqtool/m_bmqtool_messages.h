@@ -5423,10 +5423,12 @@ class CommandLineParameters {
     int                          d_shutdownGrace;
     int                          d_autoPubSubModulo;
     int                          d_timeoutSec;
+    int                          d_producerThreads;
     bool                         d_dumpMsg;
     bool                         d_confirmMsg;
     bool                         d_memoryDebug;
     bool                         d_noSessionEventHandler;
+    bool                         d_openLoop;
 
     // PRIVATE ACCESSORS
 
@@ -5469,10 +5471,12 @@ class CommandLineParameters {
         ATTRIBUTE_ID_AUTO_PUB_SUB_MODULO        = 27,
         ATTRIBUTE_ID_TIMEOUT_SEC                = 28,
         ATTRIBUTE_ID_AUTHN_MECHANISM            = 29,
-        ATTRIBUTE_ID_AUTHN_DATA                 = 30
+        ATTRIBUTE_ID_AUTHN_DATA                 = 30,
+        ATTRIBUTE_ID_PRODUCER_THREADS           = 31,
+        ATTRIBUTE_ID_OPEN_LOOP                  = 32
     };
 
-    enum { NUM_ATTRIBUTES = 31 };
+    enum { NUM_ATTRIBUTES = 33 };
 
     enum {
         ATTRIBUTE_INDEX_MODE                       = 0,
@@ -5505,7 +5509,9 @@ class CommandLineParameters {
         ATTRIBUTE_INDEX_AUTO_PUB_SUB_MODULO        = 27,
         ATTRIBUTE_INDEX_TIMEOUT_SEC                = 28,
         ATTRIBUTE_INDEX_AUTHN_MECHANISM            = 29,
-        ATTRIBUTE_INDEX_AUTHN_DATA                 = 30
+        ATTRIBUTE_INDEX_AUTHN_DATA                 = 30,
+        ATTRIBUTE_INDEX_PRODUCER_THREADS           = 31,
+        ATTRIBUTE_INDEX_OPEN_LOOP                  = 32
     };
 
     // CONSTANTS
@@ -5570,6 +5576,10 @@ class CommandLineParameters {
 
     static const char DEFAULT_INITIALIZER_AUTHN_DATA[];
 
+    static const int DEFAULT_INITIALIZER_PRODUCER_THREADS;
+
+    static const bool DEFAULT_INITIALIZER_OPEN_LOOP;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -5787,6 +5797,14 @@ class CommandLineParameters {
     /// object.
     bsl::string& authnData();
 
+    /// Return a reference to the modifiable "ProducerThreads" attribute of
+    /// this object.
+    int& producerThreads();
+
+    /// Return a reference to the modifiable "OpenLoop" attribute of this
+    /// object.
+    bool& openLoop();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -5944,6 +5962,12 @@ class CommandLineParameters {
     /// attribute of this object.
     const bsl::string& authnData() const;
 
+    /// Return the value of the "ProducerThreads" attribute of this object.
+    int producerThreads() const;
+
+    /// Return the value of the "OpenLoop" attribute of this object.
+    bool openLoop() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -10852,6 +10876,8 @@ void CommandLineParameters::hashAppendImpl(
     hashAppend(hashAlgorithm, this->timeoutSec());
     hashAppend(hashAlgorithm, this->authnMechanism());
     hashAppend(hashAlgorithm, this->authnData());
+    hashAppend(hashAlgorithm, this->producerThreads());
+    hashAppend(hashAlgorithm, this->openLoop());
 }
 
 inline bool
@@ -10886,7 +10912,9 @@ CommandLineParameters::isEqualTo(const CommandLineParameters& rhs) const
            this->autoPubSubModulo() == rhs.autoPubSubModulo() &&
            this->timeoutSec() == rhs.timeoutSec() &&
            this->authnMechanism() == rhs.authnMechanism() &&
-           this->authnData() == rhs.authnData();
+           this->authnData() == rhs.authnData() &&
+           this->producerThreads() == rhs.producerThreads() &&
+           this->openLoop() == rhs.openLoop();
 }
 
 // CLASS METHODS
@@ -11083,6 +11111,18 @@ int CommandLineParameters::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_producerThreads,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCER_THREADS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_openLoop,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OPEN_LOOP]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -11227,6 +11267,15 @@ int CommandLineParameters::manipulateAttribute(t_MANIPULATOR& manipulator,
         return manipulator(&d_authnData,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AUTHN_DATA]);
     }
+    case ATTRIBUTE_ID_PRODUCER_THREADS: {
+        return manipulator(
+            &d_producerThreads,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCER_THREADS]);
+    }
+    case ATTRIBUTE_ID_OPEN_LOOP: {
+        return manipulator(&d_openLoop,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OPEN_LOOP]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -11402,6 +11451,16 @@ inline bsl::string& CommandLineParameters::authnData()
     return d_authnData;
 }
 
+inline int& CommandLineParameters::producerThreads()
+{
+    return d_producerThreads;
+}
+
+inline bool& CommandLineParameters::openLoop()
+{
+    return d_openLoop;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int CommandLineParameters::accessAttributes(t_ACCESSOR& accessor) const
@@ -11588,6 +11647,18 @@ int CommandLineParameters::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_producerThreads,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCER_THREADS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_openLoop,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OPEN_LOOP]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -11723,6 +11794,15 @@ int CommandLineParameters::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_authnData,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AUTHN_DATA]);
     }
+    case ATTRIBUTE_ID_PRODUCER_THREADS: {
+        return accessor(
+            d_producerThreads,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCER_THREADS]);
+    }
+    case ATTRIBUTE_ID_OPEN_LOOP: {
+        return accessor(d_openLoop,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OPEN_LOOP]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -11901,6 +11981,16 @@ inline const bsl::string& CommandLineParameters::authnData() const
     return d_authnData;
 }
 
+inline int CommandLineParameters::producerThreads() const
+{
+    return d_producerThreads;
+}
+
+inline bool CommandLineParameters::openLoop() const
+{
+    return d_openLoop;
+}
+
 // --------------------
 // class JournalCommand
 // --------------------
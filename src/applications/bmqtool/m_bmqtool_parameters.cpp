@@ -334,6 +334,8 @@ Parameters::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("messageProperties", d_messageProperties);
     printer.printAttribute("subscriptions", d_subscriptions);
     printer.printAttribute("timeout", d_timeout);
+    printer.printAttribute("numProducerThreads", numProducerThreads());
+    printer.printAttribute("openLoop", openLoop());
     printer.end();
 
     return stream;
@@ -414,6 +416,11 @@ bool Parameters::from(bsl::ostream&                stream,
     }
     bsls::TimeInterval timeout(params.timeoutSec(), 0);
 
+    if (params.producerThreads() < 1) {
+        stream << "At least one producer thread is required" << "\n";
+        return false;  // RETURN
+    }
+
     // Populate output parameters struct
     setVerbosity(paramVerbosity);
     setLogFormat(params.logFormat());
@@ -445,6 +452,8 @@ bool Parameters::from(bsl::ostream&                stream,
     setTimeout(timeout);
     setAuthnMechanism(params.authnMechanism());
     setAuthnData(params.authnData());
+    setNumProducerThreads(params.producerThreads());
+    setOpenLoop(params.openLoop());
 
     return true;
 }
@@ -475,6 +484,14 @@ bool Parameters::validate(bsl::string* error)
         ss << "NoSessionEventHandler is only to use in interactive or storage "
            << "mode\n";
     }
+    if (d_openLoop && d_postInterval == 0) {
+        ss << "OpenLoop requires a non-zero postInterval\n";
+    }
+    if (d_numProducerThreads > 1 &&
+        (!d_sequentialMessagePattern.empty() || !d_logFilePath.empty())) {
+        ss << "Sequential message pattern and log file require a single "
+           << "producer thread\n";
+    }
 
     error->assign(ss.str().data(), ss.str().length());
     return error->empty();
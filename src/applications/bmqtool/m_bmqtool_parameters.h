@@ -287,6 +287,16 @@ class Parameters {
     bsl::string d_authnData;
     // Authentication data/credentials string.
 
+    int d_numProducerThreads;
+    // How many threads to post from, in auto producer mode, each of them
+    // posting 'd_eventsCount' events at 'd_postRate' per 'd_postInterval'.
+    // Default: 1
+
+    bool d_openLoop;
+    // Whether to post in open-loop, i.e. at scheduled times independent of
+    // how long posting takes, stamping messages with their scheduled time.
+    // Default: false
+
   public:
     // CREATORS
 
@@ -326,6 +336,8 @@ class Parameters {
     Parameters& setTimeout(const bsls::TimeInterval& value);
     Parameters& setAuthnMechanism(const bsl::string& value);
     Parameters& setAuthnData(const bsl::string& value);
+    Parameters& setNumProducerThreads(int value);
+    Parameters& setOpenLoop(bool value);
 
     // Set the corresponding member to the specified 'value' and return a
     // reference offering modifiable access to this object.
@@ -388,6 +400,8 @@ class Parameters {
     const bsls::TimeInterval&           timeout() const;
     const bsl::string&                  authnMechanism() const;
     const bsl::string&                  authnData() const;
+    int                                 numProducerThreads() const;
+    bool                                openLoop() const;
 
     const char* autoPubSubPropertyName() const;
 };
@@ -625,6 +639,18 @@ inline Parameters& Parameters::setAuthnData(const bsl::string& value)
     return *this;
 }
 
+inline Parameters& Parameters::setNumProducerThreads(int value)
+{
+    d_numProducerThreads = value;
+    return *this;
+}
+
+inline Parameters& Parameters::setOpenLoop(bool value)
+{
+    d_openLoop = value;
+    return *this;
+}
+
 // ACCESSORS
 inline ParametersMode::Value Parameters::mode() const
 {
@@ -792,6 +818,16 @@ inline const bsl::string& Parameters::authnData() const
     return d_authnData;
 }
 
+inline int Parameters::numProducerThreads() const
+{
+    return d_numProducerThreads;
+}
+
+inline bool Parameters::openLoop() const
+{
+    return d_openLoop;
+}
+
 }  // close package namespace
 
 // --------------------------
@@ -98,7 +98,7 @@ bool PostingContext::pendingPost() const
     return d_parameters.eventsCount() == 0 || d_remainingEvents > 0;
 }
 
-void PostingContext::postNext()
+void PostingContext::postNext(bsls::Types::Int64 postTime)
 {
     BSLS_ASSERT_SAFE(pendingPost());
 
@@ -121,15 +121,20 @@ void PostingContext::postNext()
             bmqa::Message& msg    = eventBuilder.startMessage();
             int            length = 0;
 
+            // Time to stamp the message with, to compute latencies
+            bsls::Types::Int64 timestamp = postTime;
+            if (timestamp == 0 &&
+                d_parameters.latency() != ParametersLatency::e_NONE) {
+                timestamp = StatUtil::getNowAsNs(d_parameters.latency());
+            }
+
             // Set a correlationId if queue is open in ACK mode
             if (bmqt::QueueFlagsUtil::isAck(d_parameters.queueFlags())) {
                 if (d_parameters.latency() != ParametersLatency::e_NONE) {
-                    bsls::Types::Int64 nowNs = StatUtil::getNowAsNs(
-                        d_parameters.latency());
                     // Correlation Ids might be non-unique, and we use this
                     // quality to store possibly overlapping send timestamps.
                     // It allows us to calculate ack latencies.
-                    bmqt::CorrelationId cId(nowNs);
+                    bmqt::CorrelationId cId(timestamp);
                     msg.setCorrelationId(cId);
                 }
                 else {
@@ -156,15 +161,15 @@ void PostingContext::postNext()
             else {
                 // Insert latency if required...
                 if (d_parameters.latency() != ParametersLatency::e_NONE) {
-                    bdlb::BigEndianInt64 postTime = bdlb::BigEndianInt64::make(
-                        StatUtil::getNowAsNs(d_parameters.latency()));
+                    bdlb::BigEndianInt64 postTimeBE =
+                        bdlb::BigEndianInt64::make(timestamp);
 
                     bdlbb::BlobBuffer buffer;
                     d_timeBufferFactory_p->allocate(&buffer);
                     buffer.setSize(sizeof(bdlb::BigEndianInt64));
                     bsl::memcpy(buffer.buffer().get(),
-                                &postTime,
-                                sizeof(postTime));
+                                &postTimeBE,
+                                sizeof(postTimeBE));
                     d_blob.swapBufferRaw(0, &buffer);
                 }
                 msg.setDataRef(&d_blob);
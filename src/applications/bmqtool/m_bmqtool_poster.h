@@ -42,6 +42,7 @@
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace m_bmqtool {
@@ -111,9 +112,12 @@ class PostingContext {
 
     // MANIPULATORS
 
-    /// Post next message. The behavior is undefined unless pendingPost()
-    /// is true.
-    void postNext();
+    /// Post next message. Optionally specify a `postTime`, in nanoseconds
+    /// of the clock of the latency parameter, to stamp the posted messages
+    /// with instead of the current time, such as the time at which they
+    /// were scheduled to be posted.  The behavior is undefined unless
+    /// pendingPost() is true.
+    void postNext(bsls::Types::Int64 postTime = 0);
 
     // ACCESSORS
 
@@ -27,5 +27,7 @@ const int
     OrderedHashMapWithHistory_ImpDetails::k_INSERT_GC_MESSAGES_BATCH_SIZE =
         1000;
 
+const int OrderedHashMapWithHistory_ImpDetails::k_NUM_HISTORY_BUCKETS = 4;
+
 }  // close package namespace
 }  // close enterprise namespace
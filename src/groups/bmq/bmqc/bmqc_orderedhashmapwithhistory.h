@@ -28,20 +28,29 @@
 //@DESCRIPTION: 'bmqc::OrderedHashMapWithHistory' is a wrapper around
 // 'bmqc::OrderedHashMap' which adds insertion time in nanoseconds as part of
 // the value.  It keeps history of erased keys until called 'gc' outside of
-// specified time window.  For optimization (at expense of extra memory), it
-// tracks the history from the moment an item is inserted.  That means, there
-// are 3 collections effectively: 1) a hashtable, 2) a list of all items
-// including erased ones which get tracked as history, and 3) a list of valid,
-// not-erased items.  'OrderedHashMap' provides the 1) and the 2).  This
-// component adds 3) and exposes new iterator over valid, not-erased items.
+// specified time window.  There are 3 collections effectively: 1) a hashtable
+// and 2) a list of all live items, both provided by 'OrderedHashMap', and 3)
+// the history of erased keys.  This component adds 3) and exposes new
+// iterator over valid, not-erased items.
+//
+// The history is a ring of time buckets, each of them being a flat hash map
+// of the erased keys whose history expires within the time span of that
+// bucket, to the expiration time of each key.  A bucket spans a fraction of
+// the timeout, so that there are only a few buckets at any time and a lookup
+// in the history costs a few probes in compact tables.  A bucket is dropped
+// as a whole by 'gc' once all of its keys have expired, which does not
+// require to visit the keys one by one, and the history does not grow the
+// hashtable of live items.
 //
 
 #include <bmqc_orderedhashmap.h>
 
 // BDE
+#include <bdlc_flathashmap.h>
 #include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_functional.h>
+#include <bsl_map.h>
 #include <bsl_type_traits.h>
 #include <bsl_utility.h>
 #include <bsla_annotations.h>
@@ -65,6 +74,10 @@ struct OrderedHashMapWithHistory_ImpDetails {
     /// How many messages to GC when GC required in
     /// `bmqc::OrderedHashMapWithHistory::insert`
     static const int k_INSERT_GC_MESSAGES_BATCH_SIZE;
+
+    /// Number of time buckets the timeout is split into for the history of
+    /// erased keys.
+    static const int k_NUM_HISTORY_BUCKETS;
 };
 
 // ========================================
@@ -200,8 +213,6 @@ class OrderedHashMapWithHistory {
         /// `d_next` and `d_prev` implement the list of `live`
         /// un-TTL-expired elements.  See 3) in the Component Description.
         OrderedHashMap_SequentialIterator<Value> d_prev;
-        bool                                     d_isLive;
-        // not confirmed, not TTLed
 
         // CREATORS
         Value(const VALUE_TYPE& value, TimeType time);
@@ -209,6 +220,14 @@ class OrderedHashMapWithHistory {
 
     typedef OrderedHashMap<KEY, VALUE, HASH, Value> ImplType;
 
+    /// Erased keys which are kept in history, mapped to the time at which
+    /// they expire from the history.
+    typedef bdlc::FlatHashMap<KEY, TimeType, HASH> HistoryBucket;
+
+    /// Buckets of the history, keyed by the time at which all of their keys
+    /// have expired.
+    typedef bsl::map<TimeType, HistoryBucket> History;
+
   public:
     // PUBLIC TYPES
 
@@ -223,36 +242,25 @@ class OrderedHashMapWithHistory {
     ImplType       d_impl;
     const TimeType d_timeout;
 
+    /// The time span covered by each bucket of `d_history`.
+    const TimeType d_bucketSpan;
+
     iterator d_first;
     iterator d_last;
     // 'd_first' and 'd_last' refer to the first and last 'live'
     // un-TTL-expired elements or they both refer to `end()` if there
     // are no 'live' elements.  See 3) in the Component Description.
 
-    size_t d_historySize;  // how many historical (!d_isLive) items
+    /// The history of erased keys, from the oldest to the youngest bucket.
+    History d_history;
 
-    /// Whether this container has more elements to `gc`.  This flag might be
-    /// set or unset during every `gc` call according to this container's
-    /// needs.
-    bool d_requireGC;
+    size_t d_historySize;  // how many keys in `d_history`
 
     /// The `now` time of the last GC.  We assume that the current actual time
-    /// is no less than this timestamp.
+    /// is no less than this timestamp.  Keys of the history whose expiration
+    /// time is not after this timestamp are no longer reported as historical.
     TimeType d_lastGCTime;
 
-    /// The iterator pointing to the element where garbage collection should
-    /// continue once `gc` is called.  According to contract, this iterator
-    /// only goes forward.  All the elements passed by this iterator are either
-    /// removed or marked for removal, depending on what happened first:
-    /// - If the element was not erased by the user before, but its timeout
-    /// happened in this container, it is marked for deletion in `gc` and
-    /// iterator goes forward.  Next, it is the user's responsibility to call
-    /// `erase` on this element to fully remove it.
-    /// - If the user removes the element before its timeout happened, the
-    /// element becomes `not alive`, but still lives in the history.
-    /// Eventually `gc` reaches this element and fully removes it.
-    gc_iterator d_gcIt;
-
     // PRIVATE CLASS METHODS
     static const KEY& get_key(const bsl::pair<const KEY, VALUE>& value)
     {
@@ -282,11 +290,18 @@ class OrderedHashMapWithHistory {
     OrderedHashMapWithHistory&
     operator=(const OrderedHashMapWithHistory&) BSLS_KEYWORD_DELETED;
 
-    /// Remove the specified `it` from the list of `live` un-TTL-expired
-    /// items accessed by `live` iterators while still keeping the item in
-    /// the `d_impl` as a historical record.
+    /// Remove the specified `it` from the list of `live` items accessed by
+    /// `live` iterators.
     void unlink(iterator it);
 
+    /// Remove the specified `it` from this container, and keep its key in
+    /// the history if the expiration time of the item is after both the
+    /// specified `now` and the time of the last GC.
+    void eraseImp(iterator it, TimeType now);
+
+    /// Remove the specified `key` from the history, if present.
+    void eraseFromHistory(const KEY& key);
+
   public:
     // PUBLIC MANIPULATORS
 
@@ -299,24 +314,25 @@ class OrderedHashMapWithHistory {
     /// container.
     iterator end();
 
-    /// Return iterator referring to the first element in the entire history
-    /// of items, if any, or one past the end of this container if there are
-    /// no elements.
+    /// Return iterator referring to the first live element in the
+    /// underlying hashtable, if any, or one past the end of this container
+    /// if there are no elements.
     gc_iterator beginGc();
 
-    /// Return iterator referring to one past the end of the entire history
-    /// of items, if any, or one past the end of this container if there are
-    /// no elements.
+    /// Return iterator referring to one past the end of the underlying
+    /// hashtable.
     gc_iterator endGc();
 
-    /// Iterate up to the specified `batchSize` of elements (both historical
-    /// and live) and erase expired historical records according to the
-    /// specified `now` time.
+    /// Drop the buckets of the history in which all the keys have expired
+    /// according to the specified `now` time, until at least the optionally
+    /// specified `batchSize` of historical records are erased, if not zero.
     /// Return rc == 0, if no elements were GCed.
     /// Return rc > 0, if all the needed elements were GCed and there is
     ///                nothing more to do now.
     /// Return rc < 0, if the maximum batch of elements was GCed, but there
     ///                are more messages to GC.
+    /// Note that a bucket is always dropped as a whole, so that more than
+    /// `batchSize` records may be erased.
     int gc(TimeType now, unsigned batchSize = 0);
 
     /// Remove all entries from this container.  Clear all history.  Note
@@ -326,7 +342,7 @@ class OrderedHashMapWithHistory {
 
     /// Remove from this container the `value_type` object at the specified
     /// `position`.  If the time point for the object is known, keep the
-    /// item as historical until the time of expiration routine invocation
+    /// key as historical until the time of expiration routine invocation
     /// exceeds its `timePoint` plus `d_timeout`.
     /// The behavior is undefined unless `position` refers to a `value_type`
     /// object in this container.
@@ -386,8 +402,8 @@ class OrderedHashMapWithHistory {
     /// otherwise.
     const_iterator find(const KEY& key) const;
 
-    /// Return `true` if an entry for the specified `key` exists or `false`
-    /// otherwise.
+    /// Return `true` if a live entry for the specified `key` exists or if
+    /// the `key` is in the history, and `false` otherwise.
     bool isInHistory(const KEY& key) const;
 
     /// Return the number of elements in this container.
@@ -460,16 +476,12 @@ OrderedHashMapWithHistory_Iterator<VALUE>::operator++(int)
 template <class VALUE>
 inline VALUE& OrderedHashMapWithHistory_Iterator<VALUE>::operator*() const
 {
-    BSLS_ASSERT_SAFE(d_baseIterator->d_isLive);
-
     return *d_baseIterator;
 }
 
 template <class VALUE>
 inline VALUE* OrderedHashMapWithHistory_Iterator<VALUE>::operator->() const
 {
-    BSLS_ASSERT_SAFE(d_baseIterator->d_isLive);
-
     return d_baseIterator.operator->();
 }
 
@@ -506,7 +518,6 @@ inline OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::Value::Value(
 , d_time(time)
 , d_next()
 , d_prev()
-, d_isLive(true)
 {
     // NOTHING
 }
@@ -521,12 +532,14 @@ inline OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::
                               bslma::Allocator* basicAllocator)
 : d_impl(basicAllocator)
 , d_timeout(timeout)
+, d_bucketSpan(bsl::max(
+      timeout / OrderedHashMapWithHistory_ImpDetails::k_NUM_HISTORY_BUCKETS,
+      static_cast<TimeType>(1)))
 , d_first(d_impl.end())
 , d_last(d_impl.end())
+, d_history(basicAllocator)
 , d_historySize(0)
-, d_requireGC(false)
 , d_lastGCTime(0)
-, d_gcIt(endGc())
 {
     // NOTHING
 }
@@ -552,10 +565,9 @@ template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
 inline void OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::clear()
 {
     d_impl.clear();
+    d_history.clear();
 
     d_first = d_last = end();
-    d_gcIt           = endGc();
-    d_requireGC      = false;
     d_lastGCTime     = 0;
     d_historySize    = 0;
 }
@@ -564,20 +576,7 @@ template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
 inline void
 OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::erase(iterator it)
 {
-    TimeType   time = it->d_time;
-    const KEY& key  = get_key(*it);
-
-    unlink(it);
-
-    if (time) {
-        ++d_historySize;
-    }
-    else {
-        if (d_gcIt == it.d_baseIterator) {
-            d_gcIt++;
-        }
-        d_impl.erase(key);
-    }
+    eraseImp(it, d_lastGCTime);
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
@@ -585,19 +584,44 @@ inline void
 OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::erase(iterator it,
                                                                TimeType now)
 {
-    TimeType   time = it->d_time;
-    const KEY& key  = get_key(*it);
+    eraseImp(it, now);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void
+OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::eraseImp(iterator it,
+                                                                  TimeType now)
+{
+    const TimeType time = it->d_time;
+
+    if (time && now < time && d_lastGCTime < time) {
+        // Keep the key in the bucket of the history covering its expiration
+        // time.
+        const TimeType bucketEnd = ((time - 1) / d_bucketSpan + 1) *
+                                   d_bucketSpan;
+        if (d_history[bucketEnd]
+                .insert(bsl::make_pair(get_key(*it), time))
+                .second) {
+            ++d_historySize;
+        }
+    }
 
     unlink(it);
+    d_impl.erase(it.d_baseIterator);
+}
 
-    if (time && now < time) {
-        ++d_historySize;
-    }
-    else {
-        if (d_gcIt == it.d_baseIterator) {
-            d_gcIt++;
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void
+OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::eraseFromHistory(
+    const KEY& key)
+{
+    for (typename History::reverse_iterator bucketIt = d_history.rbegin();
+         bucketIt != d_history.rend();
+         ++bucketIt) {
+        if (bucketIt->second.erase(key)) {
+            --d_historySize;
+            return;  // RETURN
         }
-        d_impl.erase(key);
     }
 }
 
@@ -605,8 +629,6 @@ template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
 inline void
 OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::unlink(iterator it)
 {
-    BSLS_ASSERT(it->d_isLive);
-
     if (it == d_first) {
         if (it == d_last) {
             d_last = d_first = end();
@@ -629,8 +651,6 @@ OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::unlink(iterator it)
     }
 
     clean(*it);
-
-    it->d_isLive = false;
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
@@ -639,15 +659,7 @@ inline
     OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::find(
         const KEY& key)
 {
-    gc_iterator it = d_impl.find(key);
-
-    if (it != d_impl.end()) {
-        if (!it->d_isLive) {
-            it = d_impl.end();
-        }
-    }
-
-    return iterator(it);
+    return iterator(d_impl.find(key));
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
@@ -659,9 +671,10 @@ OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::insert(
     const SOURCE_TYPE& value,
     TimeType           timePoint)
 {
-    TimeType time = d_timeout ? timePoint + d_timeout : 0;
-    if (d_requireGC) {
-        gc(bsl::max(timePoint, d_lastGCTime),
+    TimeType       time = d_timeout ? timePoint + d_timeout : 0;
+    const TimeType now  = bsl::max(timePoint, d_lastGCTime);
+    if (!d_history.empty() && d_history.begin()->first <= now) {
+        gc(now,
            OrderedHashMapWithHistory_ImpDetails::
                k_INSERT_GC_MESSAGES_BATCH_SIZE);
     }
@@ -683,22 +696,13 @@ OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::insert(
             d_last         = iterator(it);
         }
         it->d_next = d_impl.end();
-    }
-    else {
-        if (!it->d_isLive) {
-            // This is previously erase key that still exists in history.
-            // Erase and reinsert.
-            d_impl.erase(it);
-            --d_historySize;
-
-            result = d_impl.insert(Value(value, time));
-
-            it = result.first;
 
-            BSLS_ASSERT_SAFE(result.second);
+        if (d_historySize) {
+            // The key might have been erased before and still be in the
+            // history, which it leaves as a live element.
+            eraseFromHistory(get_key(*it));
         }
     }
-    BSLS_ASSERT_SAFE(it->d_isLive);
 
     return bsl::pair<iterator, bool>(iterator(it), result.second);
 }
@@ -708,48 +712,24 @@ inline int
 OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::gc(TimeType now,
                                                             unsigned batchSize)
 {
-    // Try to advance to either a young item, or to the end of the batch, or to
-    // the end of collection.
+    // Drop the oldest buckets, in which all the keys have expired, until the
+    // end of the batch.  Keys which have expired in the remaining buckets are
+    // no longer reported by 'isInHistory' since 'd_lastGCTime' is updated.
 
-    d_lastGCTime = now;
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_gcIt == endGc())) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        d_gcIt = beginGc();
-    }
+    d_lastGCTime                    = now;
     const size_t initialHistorySize = d_historySize;
 
-    while (d_gcIt != endGc() && d_historySize) {
-        if (now < d_gcIt->d_time) {
-            // next time resume from this item unless some earlier item(s) will
-            // get erased in which case 'erase' will move 'd_gcIt' back.
-            break;  // BREAK
-        }
-        gc_iterator it = d_gcIt++;
-        if (it->d_isLive) {
-            // This item was not erased by the user yet, but its timeout in
-            // this container happened.  Mark it for deletion by setting
-            // `d_time` to 0, so the next time user calls `erase` on it, it
-            // will be fully removed.
-            it->d_time = 0;
-        }
-        else {
-            // This item was erased by the user before, and we can fully remove
-            // it right here.
-            d_impl.erase(it);
-            --d_historySize;
-        }
-        // Meaning, there is no need for 'd_gcIt' to step back.  Only forward.
-
-        if (--batchSize == 0) {
-            // Remember where we have stopped and resume from there next time
-            d_requireGC             = true;
-            const size_t historyChange = initialHistorySize - d_historySize;
-            // Note that we return either a negative value or 0 here:
+    while (!d_history.empty() && d_history.begin()->first <= now) {
+        const size_t historyChange = initialHistorySize - d_historySize;
+        if (batchSize && historyChange >= batchSize) {
+            // Note that we return a negative value here:
             return -static_cast<int>(historyChange);  // RETURN
         }
+
+        d_historySize -= d_history.begin()->second.size();
+        d_history.erase(d_history.begin());
     }
 
-    d_requireGC             = false;
     const size_t historyChange = initialHistorySize - d_historySize;
     // Note that we return either a positive value or 0 here:
     return static_cast<int>(historyChange);
@@ -791,9 +771,7 @@ template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
 inline size_t OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::count(
     const KEY& key) const
 {
-    const_gc_iterator it = d_impl.find(key);
-
-    return it == d_impl.end() ? 0 : it->d_isLive ? 1 : 0;
+    return d_impl.find(key) == d_impl.end() ? 0 : 1;
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
@@ -809,15 +787,7 @@ inline typename OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::
     OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::find(
         const KEY& key) const
 {
-    const_gc_iterator cit = d_impl.find(key);
-
-    if (cit != d_impl.end()) {
-        if (!cit->d_isLive) {
-            cit = d_impl.end();
-        }
-    }
-
-    return const_iterator(cit);
+    return const_iterator(d_impl.find(key));
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
@@ -825,14 +795,29 @@ inline bool
 OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::isInHistory(
     const KEY& key) const
 {
-    return d_impl.find(key) != d_impl.end();
+    if (d_impl.find(key) != d_impl.end()) {
+        return true;  // RETURN
+    }
+
+    for (typename History::const_reverse_iterator bucketIt =
+             d_history.rbegin();
+         bucketIt != d_history.rend();
+         ++bucketIt) {
+        typename HistoryBucket::const_iterator it = bucketIt->second.find(
+            key);
+        if (it != bucketIt->second.end()) {
+            return d_lastGCTime < it->second;  // RETURN
+        }
+    }
+
+    return false;
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
 inline size_t
 OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::size() const
 {
-    return d_impl.size() - d_historySize;
+    return d_impl.size();
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
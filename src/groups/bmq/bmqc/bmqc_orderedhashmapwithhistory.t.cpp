@@ -17,6 +17,8 @@
 
 // BDE
 #include <bsl_unordered_map.h>
+#include <bslh_hash.h>
+#include <bslma_testallocator.h>
 #include <bsls_timeutil.h>
 
 // TEST DRIVER
@@ -368,6 +370,89 @@ static void test7_gcThenInsert()
     setup(obj, 1, timeout);
 }
 
+static void test8_historyBuckets()
+{
+    // ------------------------------------------------------------------------
+    // HISTORY BUCKETS
+    //
+    // Concerns:
+    //   Erased keys stay in history until their own expiration time, even if
+    //   they share a bucket with keys expiring later.  A bucket is dropped by
+    //   'gc' once all its keys have expired, within the limit of the batch.
+    //   A historical key inserted again leaves the history.
+    //
+    // Plan:
+    //   Insert and erase keys expiring within the same bucket, and 'gc' in
+    //   the middle and at the end of the bucket.
+    //   Erase keys expiring in different buckets, and 'gc' with a batch size
+    //   of one.
+    //   Erase a key, and insert it again.
+    //
+    // Testing:
+    //   insert, erase, gc, isInHistory, size, historySize
+    // ------------------------------------------------------------------------
+
+    bmqtst::TestHelper::printTestName("HISTORY_BUCKETS");
+
+    // The timeout is split into buckets of 25
+    const int       timeout = 100;
+    ObjectUnderTest obj(timeout, bmqtst::TestHelperUtil::allocator());
+    const size_t    TOTAL = 10;
+    const size_t    HALF  = TOTAL / 2;
+
+    // Keys expire at 101 to 110, in the bucket ending at 125
+    for (size_t key = 0; key < TOTAL; ++key) {
+        obj.insert(bsl::make_pair(key, key), key + 1);
+    }
+    for (size_t key = 0; key < TOTAL; ++key) {
+        obj.erase(obj.find(key), 50);
+    }
+    BMQTST_ASSERT_EQ(0U, obj.size());
+    BMQTST_ASSERT_EQ(TOTAL, obj.historySize());
+
+    // Half of the keys have expired, but the bucket is kept
+    BMQTST_ASSERT_EQ(0, obj.gc(100 + HALF));
+    BMQTST_ASSERT_EQ(TOTAL, obj.historySize());
+    for (size_t key = 0; key < TOTAL; ++key) {
+        BMQTST_ASSERT_EQ_D(key, key >= HALF, obj.isInHistory(key));
+    }
+
+    // All the keys have expired, and the bucket is dropped
+    BMQTST_ASSERT_EQ(static_cast<int>(TOTAL), obj.gc(125));
+    BMQTST_ASSERT_EQ(0U, obj.historySize());
+    for (size_t key = 0; key < TOTAL; ++key) {
+        BMQTST_ASSERT_EQ_D(key, false, obj.isInHistory(key));
+    }
+
+    // Keys expire at 300 and 330, in the buckets ending at 300 and 350
+    obj.insert(bsl::make_pair(30U, 30U), 200);
+    obj.insert(bsl::make_pair(31U, 31U), 230);
+    obj.erase(obj.find(30U), 240);
+    obj.erase(obj.find(31U), 240);
+    BMQTST_ASSERT_EQ(2U, obj.historySize());
+
+    BMQTST_ASSERT_EQ(-1, obj.gc(400, 1));
+    BMQTST_ASSERT_EQ(1U, obj.historySize());
+    BMQTST_ASSERT_EQ(false, obj.isInHistory(30U));
+    BMQTST_ASSERT_EQ(false, obj.isInHistory(31U));
+
+    BMQTST_ASSERT_EQ(1, obj.gc(400, 1));
+    BMQTST_ASSERT_EQ(0U, obj.historySize());
+
+    // A historical key inserted again
+    obj.insert(bsl::make_pair(40U, 40U), 500);
+    obj.erase(obj.find(40U), 510);
+    BMQTST_ASSERT_EQ(1U, obj.historySize());
+    BMQTST_ASSERT_EQ(true, obj.isInHistory(40U));
+
+    bsl::pair<Iterator, bool> rc = obj.insert(bsl::make_pair(40U, 41U), 520);
+    BMQTST_ASSERT_EQ(true, rc.second);
+    BMQTST_ASSERT_EQ(41U, rc.first->second);
+    BMQTST_ASSERT_EQ(1U, obj.size());
+    BMQTST_ASSERT_EQ(0U, obj.historySize());
+    BMQTST_ASSERT_EQ(true, obj.isInHistory(40U));
+}
+
 static void testN1_insertPerformance()
 // ------------------------------------------------------------------------
 // INSERT PERFORMANCE
@@ -575,6 +660,59 @@ static void testN3_findPerformance()
     table.print(bsl::cout);
 }
 
+static void testN4_historyMemory()
+// ------------------------------------------------------------------------
+// HISTORY MEMORY
+//
+// Concerns:
+//   Memory used by the history of erased keys, compared to the memory used
+//   by live elements, which is what each historical key used to cost when
+//   the history was kept in the hashtable of live elements.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("HISTORY MEMORY");
+
+    const size_t k_NUM_ELEMENTS = 5000000;
+
+    typedef bmqc::OrderedHashMapWithHistory<size_t, size_t, bslh::Hash<> >
+        MyMapType;
+
+    bslma::TestAllocator allocator("history", false);
+    MyMapType            map(1000000000, &allocator);
+
+    for (size_t i = 0; i < k_NUM_ELEMENTS; ++i) {
+        map.insert(bsl::make_pair(i, i), 1);
+    }
+    const bsls::Types::Int64 liveBytes = allocator.numBytesInUse();
+
+    // Nodes of erased elements are retained by the pool of the hashtable, so
+    // that the growth of the memory in use is the memory of the history.
+    for (size_t i = 0; i < k_NUM_ELEMENTS; ++i) {
+        map.erase(map.find(i), 2);
+    }
+    const bsls::Types::Int64 historyBytes = allocator.numBytesInUse() -
+                                            liveBytes;
+
+    BMQTST_ASSERT_EQ(k_NUM_ELEMENTS, map.historySize());
+
+    bmqtst::Table table(bmqtst::TestHelperUtil::allocator());
+
+    table.column("Elements")
+        .insertValue(static_cast<bsls::Types::Uint64>(k_NUM_ELEMENTS));
+    table.column("Live (bytes)")
+        .insertValue(static_cast<bsls::Types::Uint64>(liveBytes));
+    table.column("Per live element")
+        .insertValue(
+            static_cast<bsls::Types::Uint64>(liveBytes / k_NUM_ELEMENTS));
+    table.column("History (bytes)")
+        .insertValue(static_cast<bsls::Types::Uint64>(historyBytes));
+    table.column("Per historical key")
+        .insertValue(
+            static_cast<bsls::Types::Uint64>(historyBytes / k_NUM_ELEMENTS));
+
+    table.print(bsl::cout);
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -587,6 +725,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_historyBuckets(); break;
     case 7: test7_gcThenInsert(); break;
     case 6: test6_eraseThenGc(); break;
     case 5: test5_insertAfterEnd(); break;
@@ -597,6 +736,7 @@ int main(int argc, char* argv[])
     case -1: testN1_insertPerformance(); break;
     case -2: testN2_erasePerformance(); break;
     case -3: testN3_findPerformance(); break;
+    case -4: testN4_historyMemory(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
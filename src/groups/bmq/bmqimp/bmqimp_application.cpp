@@ -26,6 +26,7 @@
 #include <bmqio_connectoptions.h>
 #include <bmqio_reconnectingchannelfactory.h>
 #include <bmqio_resolvingchannelfactory.h>
+#include <bmqio_shmchannelfactory.h>
 #include <bmqio_statchannel.h>
 #include <bmqio_statchannelfactory.h>
 #include <bmqio_status.h>
@@ -226,18 +227,36 @@ bslma::ManagedPtr<bmqio::ChannelFactoryPipeline> makeChannelFactoryPipeline(
         }
     };
 
-    bsl::shared_ptr<bmqio::NtcChannelFactory> channelFactory =
-        bsl::make_shared<bmqio::NtcChannelFactory>(
+    // A broker running on the same host may be reached through shared memory
+    // rather than TCP, in which case the endpoint is a local path: there is
+    // nothing to resolve.
+    const bool isShm = bmqio::ShmChannelFactoryUtil::isShmUri(
+        sessionOptions.brokerUri());
+
+    ChannelFactorySP channelFactory;
+    if (isShm) {
+        channelFactory = bsl::make_shared<bmqio::ShmChannelFactory>(
+            blobBufferFactory,
+            static_cast<int>(bmqio::ShmChannelFactory::k_DEFAULT_RING_SIZE),
+            static_cast<int>(k_CHANNEL_LOW_WATERMARK),
+            static_cast<int>(sessionOptions.channelHighWatermark()),
+            allocator);
+    }
+    else {
+        channelFactory = bsl::make_shared<bmqio::NtcChannelFactory>(
             ntcCreateInterfaceConfig(sessionOptions, allocator),
             blobBufferFactory,
             allocator);
+    }
 
     using bdlf::PlaceHolders::_1;
     bmqio::ChannelFactoryPipeline::Config builder(channelFactory, allocator);
+    if (!isShm) {
+        builder.addWith(bdlf::BindUtil::bind(Builders::resolvingChannelFactory,
+                                             allocator,
+                                             _1));
+    }
     builder
-        .addWith(bdlf::BindUtil::bind(Builders::resolvingChannelFactory,
-                                      allocator,
-                                      _1))
         .addWith(bdlf::BindUtil::bind(Builders::reconnectingChannelFactory,
                                       allocator,
                                       _1,
@@ -504,16 +523,28 @@ bmqt::GenericResult::Enum Application::startChannel()
                      bmqimp::BrokerSession::State::e_STARTING);
 
     // 1. Prepare and validate connection parameters
-    bmqio::TCPEndpoint endpoint(d_sessionOptions.brokerUri());
-    if (!endpoint) {
-        BALL_LOG_ERROR << id() << "Invalid brokerURI '"
-                       << d_sessionOptions.brokerUri() << "'";
-        return bmqt::GenericResult::e_INVALID_ARGUMENT;  // RETURN
-    }
-
     bdlma::LocalSequentialAllocator<32> localAllocator(&d_allocator);
     bmqu::MemOutStream                  out(&localAllocator);
-    out << endpoint.host() << ":" << endpoint.port();
+    if (bmqio::ShmChannelFactoryUtil::isShmUri(d_sessionOptions.brokerUri())) {
+        bsl::string path(&localAllocator);
+        if (bmqio::ShmChannelFactoryUtil::parseEndpoint(
+                &path,
+                d_sessionOptions.brokerUri()) != 0) {
+            BALL_LOG_ERROR << id() << "Invalid brokerURI '"
+                           << d_sessionOptions.brokerUri() << "'";
+            return bmqt::GenericResult::e_INVALID_ARGUMENT;  // RETURN
+        }
+        out << d_sessionOptions.brokerUri();
+    }
+    else {
+        bmqio::TCPEndpoint endpoint(d_sessionOptions.brokerUri());
+        if (!endpoint) {
+            BALL_LOG_ERROR << id() << "Invalid brokerURI '"
+                           << d_sessionOptions.brokerUri() << "'";
+            return bmqt::GenericResult::e_INVALID_ARGUMENT;  // RETURN
+        }
+        out << endpoint.host() << ":" << endpoint.port();
+    }
 
     bsls::TimeInterval attemptInterval;
     attemptInterval.setTotalMilliseconds(k_RECONNECT_INTERVAL_MS);
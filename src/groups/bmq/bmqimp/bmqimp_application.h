@@ -49,13 +49,13 @@
 #include <bmqio_statchannelfactory.h>
 #include <bmqma_countingallocator.h>
 #include <bmqma_countingallocatorstore.h>
+#include <bmqp_threadcachingblobbufferfactory.h>
 #include <bmqst_basictableinfoprovider.h>
 #include <bmqst_statcontext.h>
 #include <bmqst_table.h>
 
 // BDE
 #include <ball_log.h>
-#include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlmt_eventscheduler.h>
 #include <bsl_memory.h>
 #include <bslma_allocator.h>
@@ -125,7 +125,7 @@ class Application {
     bmqst::BasicTableInfoProvider d_channelsTip;
 
     /// Factory for blob buffers
-    bdlbb::PooledBlobBufferFactory d_blobBufferFactory;
+    bmqp::ThreadCachingBlobBufferFactory d_blobBufferFactory;
 
     /// Shared pointer to the pool of shared pointers to blobs.
     BlobSpPoolSp d_blobSpPool_sp;
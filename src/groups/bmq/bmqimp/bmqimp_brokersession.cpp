@@ -41,11 +41,13 @@
 #include <bmqt_resultcode.h>
 #include <bmqt_uri.h>
 #include <bmqu_blob.h>
+#include <bmqu_blobobjectproxy.h>
 #include <bmqu_memoutstream.h>
 #include <bmqu_printutil.h>
 #include <bmqu_time.h>
 
 // BDE
+#include <bdlbb_blobutil.h>
 #include <bdld_datum.h>
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
@@ -549,6 +551,7 @@ void BrokerSession::SessionFsm::setStopped(FsmEvent::Enum event,
     // Cancel pending PUTs expiration timer
     d_session.d_scheduler_p->cancelEvent(
         &d_session.d_messageExpirationTimeoutHandle);
+    d_session.d_scheduler_p->cancelEvent(&d_session.d_lingerTimeoutHandle);
 
     // The session is fully stopped, we can now reset its state to release any
     // references to objects (queues, ...) it may still hold.
@@ -818,6 +821,12 @@ void BrokerSession::SessionFsm::handleChannelDown()
     // Remove all pending blobs from the blob queue
     d_session.d_extensionBlobBuffer.clear();
 
+    // Drop the lingering PUT messages, as if they had been written to the
+    // channel: those requiring an ACK are retransmitted.
+    d_session.d_scheduler_p->cancelEvent(&d_session.d_lingerTimeoutHandle);
+    d_session.d_lingerBlob.removeAll();
+    d_session.d_lingerMessageCount = 0;
+
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_session.d_extensionBufferLock);
         // LOCK
@@ -3513,11 +3522,23 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
 
     bool readyToSend = isStarted() && (d_numPendingReopenQueues == 0);
 
+    // Whether the messages are held to be coalesced with those posted during
+    // the linger interval
+    const bool linger = d_sessionOptions.putLingerInterval() !=
+                        bsls::TimeInterval(0);
+
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(readyToSend)) {
-        // Post the event.
-        bmqt::GenericResult::Enum res = writeOrBuffer(
-            *event.blob(),
-            d_sessionOptions.channelHighWatermark());
+        // Post the event, or hold its messages until the end of the linger
+        // interval.  Held messages are considered sent: they are written
+        // before anything else is written to the channel.
+        bmqt::GenericResult::Enum res = bmqt::GenericResult::e_SUCCESS;
+        if (linger) {
+            lingerPutEvent(event);
+        }
+        else {
+            res = writeOrBuffer(*event.blob(),
+                                d_sessionOptions.channelHighWatermark());
+        }
 
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
                 res != bmqt::GenericResult::e_SUCCESS)) {
@@ -3541,7 +3562,10 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
 
     BSLS_ASSERT_SAFE(putIter.isValid());
 
+    int msgCount = 0;
     while (BSLS_PERFORMANCEHINT_PREDICT_LIKELY((putIter.next()) == 1)) {
+        ++msgCount;
+
         const bool ackRequested = bmqp::PutHeaderFlagUtil::isSet(
             putIter.header().flags(),
             bmqp::PutHeaderFlags::e_ACK_REQUESTED);
@@ -3562,6 +3586,105 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
         // down.
         enableMessageRetransmission(putIter, sentTime);
     }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!readyToSend)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;  // RETURN
+    }
+
+    if (!linger) {
+        d_eventsStats.onBatch(EventsStatsEventType::e_PUT, msgCount);
+        return;  // RETURN
+    }
+
+    d_lingerMessageCount += msgCount;
+    if (d_lingerBlob.length() >= d_sessionOptions.putLingerMaxBytes()) {
+        flushLingeringPuts();
+    }
+}
+
+void BrokerSession::lingerPutEvent(const bmqp::Event& event)
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    // Messages of a PUT event immediately follow its header, and do not
+    // depend on the event they belong to: the messages of independently
+    // built events are coalesced by appending them (sharing their buffers)
+    // after a single header.
+    bmqu::BlobObjectProxy<bmqp::EventHeader> header(
+        event.blob(),
+        -bmqp::EventHeader::k_MIN_HEADER_SIZE,
+        true,    // read
+        false);  // write
+    BSLS_ASSERT_SAFE(header.isSet());
+    const int headerSize = header->headerWords() *
+                           bmqp::Protocol::k_WORD_SIZE;
+    const int messagesSize = event.blob()->length() - headerSize;
+
+    if (d_lingerBlob.length() != 0 &&
+        d_lingerBlob.length() + messagesSize >
+            bmqp::EventHeader::k_MAX_SIZE_SOFT) {
+        flushLingeringPuts();
+    }
+
+    if (d_lingerBlob.length() == 0) {
+        // Start a new linger interval
+        d_lingerBlob.setLength(sizeof(bmqp::EventHeader));
+        new (d_lingerBlob.buffer(0).data())
+            bmqp::EventHeader(bmqp::EventType::e_PUT);
+
+        d_scheduler_p->scheduleEvent(
+            &d_lingerTimeoutHandle,
+            bmqu::Time::nowMonotonicClock() +
+                d_sessionOptions.putLingerInterval(),
+            bdlf::BindUtil::bind(&BrokerSession::onLingerTimeout, this));
+    }
+
+    bdlbb::BlobUtil::append(&d_lingerBlob,
+                            *event.blob(),
+                            headerSize,
+                            messagesSize);
+}
+
+bmqt::GenericResult::Enum BrokerSession::flushLingeringPuts()
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    if (d_lingerBlob.length() == 0) {
+        return bmqt::GenericResult::e_SUCCESS;  // RETURN
+    }
+
+    d_scheduler_p->cancelEvent(&d_lingerTimeoutHandle);
+
+    reinterpret_cast<bmqp::EventHeader*>(d_lingerBlob.buffer(0).data())
+        ->setLength(d_lingerBlob.length());
+
+    // Reset the linger state before writing: 'writeOrBuffer' flushes any
+    // lingering PUTs.
+    bdlbb::Blob blob(d_bufferFactory_p, d_allocator_p);
+    blob.swap(d_lingerBlob);
+    const int msgCount   = d_lingerMessageCount;
+    d_lingerMessageCount = 0;
+
+    bmqt::GenericResult::Enum res = writeOrBuffer(
+        blob,
+        d_sessionOptions.channelHighWatermark());
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            res != bmqt::GenericResult::e_SUCCESS)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BALL_LOG_ERROR << id() << "Unable to post " << msgCount
+                       << " lingering PUT messages [reason: 'NOT_CONNECTED']";
+        return res;  // RETURN
+    }
+
+    d_eventsStats.onBatch(EventsStatsEventType::e_PUT, msgCount);
+
+    return res;
 }
 
 void BrokerSession::processConfirmEvent(const bmqp::Event& event)
@@ -4252,6 +4375,19 @@ void BrokerSession::doHandleStartTimeout(
     d_sessionFsm.handleStartTimeout();
 }
 
+void BrokerSession::doHandleLingerTimeout(
+    BSLA_MAYBE_UNUSED const bsl::shared_ptr<Event>& eventSp)
+{
+    // executed by the FSM thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    // The linger interval may already have been ended by a flush.
+    if (d_channel_sp) {
+        flushLingeringPuts();
+    }
+}
+
 void BrokerSession::doHandlePendingPutExpirationTimeout(
     BSLA_MAYBE_UNUSED const bsl::shared_ptr<Event>& eventSp)
 {
@@ -5245,6 +5381,10 @@ void BrokerSession::resetState()
     // Remove queue retransmission timeout data
     d_queueRetransmissionTimeoutMap.clear();
 
+    // Drop any lingering PUT messages
+    d_lingerBlob.removeAll();
+    d_lingerMessageCount = 0;
+
     // Release any writing user threads
     d_extensionBlobBuffer.clear();
 
@@ -5657,6 +5797,15 @@ BrokerSession::writeOrBuffer(const bdlbb::Blob& eventBlob,
     BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
     BSLS_ASSERT_SAFE(d_channel_sp);
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_lingerBlob.length() != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bmqt::GenericResult::Enum res = flushLingeringPuts();
+        if (res != bmqt::GenericResult::e_SUCCESS) {
+            return res;  // RETURN
+        }
+    }
+
     bmqio::Status             status(d_allocator_p);
     bmqt::GenericResult::Enum res = bmqt::GenericResult::e_SUCCESS;
 
@@ -5770,6 +5919,9 @@ BrokerSession::BrokerSession(
 , d_inProgressEventHandlerCount(0)
 , d_isStopping(false)
 , d_messageExpirationTimeoutHandle()
+, d_lingerBlob(bufferFactory, allocator)
+, d_lingerMessageCount(0)
+, d_lingerTimeoutHandle()
 , d_nextRequestGroupId(k_NON_BUFFERED_REQUEST_GROUP_ID)
 , d_queueRetransmissionTimeoutMap(allocator)
 , d_nextInternalSubscriptionId(bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID)
@@ -7478,6 +7630,18 @@ void BrokerSession::onPendingPutExpirationTimeout()
     enqueueFsmEvent(event);
 }
 
+void BrokerSession::onLingerTimeout()
+{
+    // executed by the *SCHEDULER* thread
+
+    bsl::shared_ptr<Event> event = createEvent();
+    event->configureAsRequestEvent(
+        bdlf::BindUtil::bind(&BrokerSession::doHandleLingerTimeout,
+                             this,
+                             bdlf::PlaceHolders::_1));  // eventImpl
+    enqueueFsmEvent(event);
+}
+
 void BrokerSession::handleChannelWatermark(
     bmqio::ChannelWatermarkType::Enum type)
 {
@@ -884,6 +884,22 @@ class BrokerSession BSLS_CPP11_FINAL {
     // Timer Event handle for pending PUT
     // messages' expiration timeout
 
+    bdlbb::Blob d_lingerBlob;
+    // PUT event coalescing the messages
+    // posted during the current linger
+    // interval (see 'putLingerInterval'
+    // in 'bmqt::SessionOptions').  Only
+    // manipulated from the FSM thread.
+
+    int d_lingerMessageCount;
+    // Number of PUT messages held in
+    // 'd_lingerBlob', zero if no linger
+    // interval is in progress.
+
+    bdlmt::EventScheduler::EventHandle d_lingerTimeoutHandle;
+    // Timer Event handle for the end of
+    // the current linger interval
+
     int d_nextRequestGroupId;
     // Id of the next request group to
     // use
@@ -989,6 +1005,15 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// method gets called each time a new put event is poseted by the user.
     void processPutEvent(const bmqp::Event& event);
 
+    /// Append the messages of the specified PUT `event` to the PUT event
+    /// being coalesced during the current linger interval, starting a new
+    /// linger interval if none is in progress.
+    void lingerPutEvent(const bmqp::Event& event);
+
+    /// Send the PUT event coalesced during the current linger interval, if
+    /// any, and end that interval.  Return the result of the write.
+    bmqt::GenericResult::Enum flushLingeringPuts();
+
     /// Process the confirm event represented by the specified `event`.
     /// This method gets called each time a new confirm event is poseted by
     /// the user.
@@ -1362,6 +1387,11 @@ class BrokerSession BSLS_CPP11_FINAL {
     void
     doHandlePendingPutExpirationTimeout(const bsl::shared_ptr<Event>& eventSp);
 
+    /// Invoked from the FSM thread as a handler to the end of the PUT
+    /// linger interval event specified as `eventSp` and sent by the
+    /// scheduler thread.
+    void doHandleLingerTimeout(const bsl::shared_ptr<Event>& eventSp);
+
     /// Invoked from the FSM thread as a handler to the channel watermark
     /// event specified as `eventSp` with the specified watermark `type`
     /// sent by the IO thread.
@@ -1457,7 +1487,8 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// channel `highWaterMark` value.  If the write operation fails with
     /// the e_LIMIT error put the `blob` into the extention buffer.  Return
     /// success status or error code in case of write failure due to any
-    /// error other than e_LIMIT.
+    /// error other than e_LIMIT.  Note that PUT messages held by a linger
+    /// interval in progress are sent first, to preserve ordering.
     bmqt::GenericResult::Enum writeOrBuffer(const bdlbb::Blob& eventBlob,
                                             bsls::Types::Int64 highWaterMark);
 
@@ -1631,6 +1662,9 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// Invoked when pending PUT expiration timeout fires.
     void onPendingPutExpirationTimeout();
 
+    /// Invoked when the PUT linger interval ends.
+    void onLingerTimeout();
+
     /// Process the specified dump `command`.
     void processDumpCommand(const bmqp_ctrlmsg::DumpMessages& command);
 
@@ -9751,6 +9751,156 @@ static void test68_queueLateAsyncCanceledHybrid3()
                            bmqimp::QueueState::e_PENDING);
 }
 
+static void test71_putLinger()
+// ------------------------------------------------------------------------
+// PUT LINGER TEST
+//
+// Concerns:
+//   1. Check that when a linger interval is configured, PUT events posted
+//      within the interval are coalesced into a single PUT event, which is
+//      sent once the interval elapses, with the messages in posting order.
+//   2. Check that lingering PUT messages are sent before any other data
+//      written to the channel.
+//
+// Plan:
+//   1. Create bmqimp::BrokerSession test wrapper object with a non-zero
+//      PUT linger interval and start the session with a test network
+//      channel.
+//   2. Open a queue for writing.
+//   3. Post three PUT events with one message each and verify nothing is
+//      sent right away.
+//   4. Verify a single PUT event with the three messages is sent once the
+//      linger interval elapses.
+//   5. Post one more PUT event and close the queue right away, and verify
+//      the PUT event is sent before the close queue request.
+//   6. Stop the session.
+//
+// Testing manipulators:
+//   - start
+//   - openQueue
+//   - post
+//   - closeQueueAsync
+//   - stop
+//   ----------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PUT LINGER TEST");
+
+    const char* k_PAYLOAD     = "abcdefghijklmnopqrstuvwxyz";
+    const int   k_PAYLOAD_LEN = bsl::strlen(k_PAYLOAD);
+    const int   k_NUM_EVENTS  = 3;
+
+    const bsls::TimeInterval       timeout = bsls::TimeInterval(5);
+    bmqt::SessionOptions           sessionOptions;
+    bmqt::QueueOptions             queueOptions;
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+    bmqp::PutEventBuilder    putEventBuilder(blobSpPool.get(),
+                                          bmqtst::TestHelperUtil::allocator());
+    bmqp::PutMessageIterator putIter(&bufferFactory,
+                                     bmqtst::TestHelperUtil::allocator());
+    bmqp::Event              rawEvent(bmqtst::TestHelperUtil::allocator());
+    bdlmt::EventScheduler    scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    bmqtst::TestHelperUtil::allocator());
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+
+    sessionOptions.setNumProcessingThreads(1);
+    sessionOptions.setPutLingerInterval(bsls::TimeInterval(0.2));
+
+    TestSession obj(sessionOptions,
+                    scheduler,
+                    bmqtst::TestHelperUtil::allocator());
+
+    bsl::shared_ptr<bmqimp::Queue> pQueue =
+        obj.createQueue(k_URI, bmqt::QueueFlags::e_WRITE, queueOptions);
+
+    PVV_SAFE("Step 1. Start the session");
+    obj.startAndConnect();
+
+    PVV_SAFE("Step 2. Open the queue");
+    obj.openQueue(pQueue, timeout);
+
+    PVV_SAFE("Step 3. Post PUT events and verify nothing is sent yet");
+    for (int i = 0; i < k_NUM_EVENTS + 1; ++i) {
+        guids.push_back(bmqp::MessageGUIDGenerator::testGUID());
+    }
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        putEventBuilder.reset();
+        putEventBuilder.startMessage();
+        putEventBuilder.setMessagePayload(k_PAYLOAD, k_PAYLOAD_LEN)
+            .setMessageGUID(guids[i]);
+
+        bmqt::EventBuilderResult::Enum rc = putEventBuilder.packMessage(
+            pQueue->id());
+        BMQTST_ASSERT_EQ(rc, bmqt::EventBuilderResult::e_SUCCESS);
+
+        int res = obj.session().post(putEventBuilder.blob());
+        BMQTST_ASSERT_EQ(res, bmqt::PostResult::e_SUCCESS);
+    }
+
+    BMQTST_ASSERT(obj.isChannelEmpty());
+
+    PVV_SAFE("Step 4. Verify a single PUT event is sent");
+    obj.getOutboundEvent(&rawEvent);
+
+    BMQTST_ASSERT(rawEvent.isPutEvent());
+
+    rawEvent.loadPutMessageIterator(&putIter, true);
+
+    BMQTST_ASSERT(putIter.isValid());
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        BMQTST_ASSERT_EQ_D(i, 1, putIter.next());
+        BMQTST_ASSERT_EQ_D(i, pQueue->id(), putIter.header().queueId());
+        BMQTST_ASSERT_EQ_D(i, guids[i], putIter.header().messageGUID());
+    }
+    BMQTST_ASSERT_EQ(0, putIter.next());
+
+    BMQTST_ASSERT(obj.isChannelEmpty());
+
+    PVV_SAFE("Step 5. Post a PUT event and close the queue");
+    putEventBuilder.reset();
+    putEventBuilder.startMessage();
+    putEventBuilder.setMessagePayload(k_PAYLOAD, k_PAYLOAD_LEN)
+        .setMessageGUID(guids[k_NUM_EVENTS]);
+
+    bmqt::EventBuilderResult::Enum rc = putEventBuilder.packMessage(
+        pQueue->id());
+    BMQTST_ASSERT_EQ(rc, bmqt::EventBuilderResult::e_SUCCESS);
+
+    int res = obj.session().post(putEventBuilder.blob());
+    BMQTST_ASSERT_EQ(res, bmqt::PostResult::e_SUCCESS);
+
+    res = obj.session().closeQueueAsync(pQueue, timeout);
+    BMQTST_ASSERT_EQ(res, bmqp_ctrlmsg::StatusCategory::E_SUCCESS);
+
+    rawEvent.clear();
+    obj.getOutboundEvent(&rawEvent);
+
+    BMQTST_ASSERT(rawEvent.isPutEvent());
+
+    rawEvent.loadPutMessageIterator(&putIter, true);
+
+    BMQTST_ASSERT(putIter.isValid());
+    BMQTST_ASSERT_EQ(1, putIter.next());
+    BMQTST_ASSERT_EQ(guids[k_NUM_EVENTS], putIter.header().messageGUID());
+    BMQTST_ASSERT_EQ(0, putIter.next());
+
+    bmqp_ctrlmsg::ControlMessage request = obj.verifyCloseRequestSent(true);
+
+    obj.sendResponse(request);
+
+    obj.verifyCloseQueueResult(bmqp_ctrlmsg::StatusCategory::E_SUCCESS,
+                               pQueue);
+
+    PVV_SAFE("Step 6. Stop the session");
+    BMQTST_ASSERT(obj.stop());
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -9763,6 +9913,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 71: test71_putLinger(); break;
     case 70: /* removed test */ break;
     case 69: /* removed test */ break;
     case 68: test68_queueLateAsyncCanceledHybrid3(); break;
@@ -37,7 +37,9 @@ enum {
     /// value = bytes ; increments = number of events
     k_STAT_EVENT = 0,
     /// value = number of messages
-    k_STAT_MESSAGE = 1
+    k_STAT_MESSAGE = 1,
+    /// value = number of messages per event written to the channel
+    k_STAT_BATCH = 2
 };
 }  // close unnamed namespace
 
@@ -85,7 +87,9 @@ void EventsStats::initializeStats(
     // ----------------------------
     bmqst::StatContextConfiguration config(k_STAT_NAME, &localAllocator);
     config.isTable(true);
-    config.value("event").value("message");
+    config.value("event").value("message").value(
+        "batch",
+        bmqst::StatValue::e_DISCRETE);
     d_stat.d_statContext_mp = rootStatContext->addSubcontext(config);
 
     // Create the subContexts
@@ -126,6 +130,19 @@ void EventsStats::initializeStats(
                      bmqst::StatUtil::valueDifference,
                      start,
                      end);
+    schema.addColumn("batch_avg_delta",
+                     k_STAT_BATCH,
+                     bmqst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addColumn("batch_max_delta",
+                     k_STAT_BATCH,
+                     bmqst::StatUtil::rangeMax,
+                     start,
+                     end);
+    schema.addColumn("batch_absmax",
+                     k_STAT_BATCH,
+                     bmqst::StatUtil::absoluteMax);
 
     // Configure records
     bmqst::TableRecords& records = d_stat.d_table.records();
@@ -144,11 +161,17 @@ void EventsStats::initializeStats(
     d_stat.d_tip.addColumn("bytes_delta", "bytes")
         .zeroString("")
         .printAsMemory();
+    d_stat.d_tip.addColumn("batch_avg_delta", "batch avg")
+        .extremeValueString("");
+    d_stat.d_tip.addColumn("batch_max_delta", "batch max")
+        .extremeValueString("");
 
     d_stat.d_tip.setColumnGroup("absolute");
     d_stat.d_tip.addColumn("messages", "messages").zeroString("");
     d_stat.d_tip.addColumn("events", "events").zeroString("");
     d_stat.d_tip.addColumn("bytes", "bytes").zeroString("").printAsMemory();
+    d_stat.d_tip.addColumn("batch_absmax", "batch max")
+        .extremeValueString("");
 
     // Create the table (without Delta stats)
     // --------------------------------------
@@ -170,6 +193,9 @@ void EventsStats::initializeStats(
                             k_STAT_EVENT,
                             bmqst::StatUtil::value,
                             loc);
+    schemaNoDelta.addColumn("batch_absmax",
+                            k_STAT_BATCH,
+                            bmqst::StatUtil::absoluteMax);
 
     // Configure records
     bmqst::TableRecords& recordsNoDelta = d_stat.d_tableNoDelta.records();
@@ -186,6 +212,8 @@ void EventsStats::initializeStats(
     d_stat.d_tipNoDelta.addColumn("bytes", "bytes")
         .zeroString("")
         .printAsMemory();
+    d_stat.d_tipNoDelta.addColumn("batch_absmax", "batch max")
+        .extremeValueString("");
 }
 
 void EventsStats::resetStats()
@@ -209,5 +237,16 @@ void EventsStats::onEvent(EventsStatsEventType::Enum type,
     d_statContexts_mp[type]->adjustValue(k_STAT_MESSAGE, messageCount);
 }
 
+void EventsStats::onBatch(EventsStatsEventType::Enum type, int messageCount)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_statContexts_mp[type])) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        // Stats are disabled (i.e. 'initializeStats' was not called).
+        return;  // RETURN
+    }
+
+    d_statContexts_mp[type]->reportValue(k_STAT_BATCH, messageCount);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -143,6 +143,15 @@ class EventsStats {
     void
     onEvent(EventsStatsEventType::Enum type, int eventSize, int messageCount);
 
+    /// Update stats associated to the event of the specified `type` to
+    /// indicate that one event containing the specified `messageCount`
+    /// messages was written to the channel.  This tracks the size of the
+    /// batches actually sent, which may differ from the events reported by
+    /// `onEvent` when messages are coalesced.  The behavior is undefined
+    /// unless `initializeStats` has been called on the object prior to
+    /// `onBatch`.
+    void onBatch(EventsStatsEventType::Enum type, int messageCount);
+
     // ACCESSORS
 
     /// Print the stats to the specified `stream`; print the `delta` stats
@@ -16,6 +16,7 @@
 #include <bmqio_ntcchannel.h>
 
 // BMQ
+#include <bmqio_ntcchannelfactory.h>
 #include <bmqu_blob.h>
 
 // NTC
@@ -24,9 +25,11 @@
 #include <ntsf_system.h>
 
 // BDE
+#include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlf_bind.h>
 #include <bsla_annotations.h>
+#include <bslmt_semaphore.h>
 #include <bsls_types.h>
 
 #include <bmqtst_testhelper.h>
@@ -104,6 +107,37 @@ void executeOnClosedChannelFunc(bmqio::NtcChannel*              channel,
     channel->close();
 }
 
+/// Read callback appending the content of the specified `blob` to the
+/// specified `out` until it holds the specified `expected` number of bytes,
+/// at which point post on the specified `semaphore`.
+void onRead(bslmt::Semaphore* semaphore,
+            bsl::string*      out,
+            int               expected,
+            const Status&     status,
+            int*              numNeeded,
+            bdlbb::Blob*      blob)
+{
+    BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
+    if (status.category() != bmqio::StatusCategory::e_SUCCESS) {
+        semaphore->post();
+        return;  // RETURN
+    }
+
+    for (int i = 0; i < blob->numDataBuffers(); ++i) {
+        const int size = i == blob->numDataBuffers() - 1
+                             ? blob->lastDataBufferLength()
+                             : blob->buffer(i).size();
+        out->append(blob->buffer(i).data(), size);
+    }
+    bdlbb::BlobUtil::erase(blob, 0, blob->length());
+
+    *numNeeded = expected - static_cast<int>(out->length());
+    if (*numNeeded <= 0) {
+        *numNeeded = 0;
+        semaphore->post();
+    }
+}
+
 // ============
 // class Tester
 // ============
@@ -154,10 +188,18 @@ class Tester {
     // MANIPULATORS
 
     /// (Re-)create the object being tested and reset the state of any
-    /// supporting objects.
-    void init();
+    /// supporting objects, using the optionally specified `driverName` for
+    /// the ntc interface (or the default driver if empty).  Return 0 on
+    /// success, or a non-zero value if the interface could not be started
+    /// with a non-default `driverName`.
+    int init(const bslstl::StringRef& driverName = "");
 
     bsl::shared_ptr<bmqio::NtcChannel> connect();
+
+    // ACCESSORS
+
+    /// Return the channel most recently accepted by the listener.
+    const bsl::shared_ptr<bmqio::Channel>& lastAcceptedChannel() const;
 };
 
 // ------------
@@ -239,7 +281,7 @@ void Tester::onChannelResult(bslmt::Semaphore* semaphore_p,
     semaphore_p->post();
 }
 
-void Tester::init()
+int Tester::init(const bslstl::StringRef& driverName)
 {
     // 0. Cleanup
     destroy();
@@ -250,16 +292,28 @@ void Tester::init()
     // 2. Start ntc intefrace
     ntca::InterfaceConfig config = ntcCreateInterfaceConfig(d_allocator_p);
     config.setThreadName("test");
+    if (!driverName.isEmpty()) {
+        config.setDriverName(driverName);
+    }
 
     // Solaris: disambiguate by using the expected interface type
     bsl::shared_ptr<bdlbb::BlobBufferFactory> bufferFactory_sp =
         bsl::static_pointer_cast<bdlbb::BlobBufferFactory>(
             d_blobBufferFactory_sp);
 
-    d_interface_sp    = ntcf::System::createInterface(config,
+    d_interface_sp = ntcf::System::createInterface(config,
                                                    bufferFactory_sp,
                                                    d_allocator_p);
+    if (!d_interface_sp) {
+        BMQTST_ASSERT(!driverName.isEmpty());
+        return -1;  // RETURN
+    }
+
     ntsa::Error error = d_interface_sp->start();
+    if (error && !driverName.isEmpty()) {
+        d_interface_sp.reset();
+        return -2;  // RETURN
+    }
     BMQTST_ASSERT_EQ(error, ntsa::Error::e_OK);
 
     // 3. Start listener
@@ -286,6 +340,8 @@ void Tester::init()
     const ntsa::Endpoint endpoint = d_listener_sp->sourceEndpoint();
     BMQTST_ASSERT(endpoint.isIp());
     BMQTST_ASSERT(endpoint.ip().host().isV4());
+
+    return 0;
 }
 
 bsl::shared_ptr<bmqio::NtcChannel> Tester::connect()
@@ -335,6 +391,13 @@ bsl::shared_ptr<bmqio::NtcChannel> Tester::connect()
     return channel;
 }
 
+// ACCESSORS
+const bsl::shared_ptr<bmqio::Channel>& Tester::lastAcceptedChannel() const
+{
+    BSLS_ASSERT_OPT(!d_listenChannels.empty());
+    return d_listenChannels.back();
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -384,6 +447,70 @@ static void test1_breathingTest()
     channel->close();
 }
 
+static void test2_ioRingLoopback()
+// ------------------------------------------------------------------------
+// IO_URING LOOPBACK
+//
+// Concerns:
+//   a) Channels of an interface driven by io_uring can be connected over
+//      loopback.
+//   b) Data written on one end, in a blob of several buffers, is received
+//      intact on the other end.
+//
+// Plan:
+//   Start an interface with the io_uring driver (skipping the test if the
+//   host or the networking library does not support it), connect a
+//   channel, write a multi-buffer blob and read it on the accepted end.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("io_uring Loopback");
+
+    Tester tester(bmqtst::TestHelperUtil::allocator());
+    if (tester.init(bmqio::NtcChannelFactoryUtil::ioRingDriverName()) != 0) {
+        cout << "io_uring driver is not available, skipping test" << endl;
+        return;  // RETURN
+    }
+
+    bsl::shared_ptr<bmqio::NtcChannel> channel = tester.connect();
+
+    // Build a payload spanning several blob buffers
+    const int                      k_PAYLOAD_SIZE = 3 * 4096 + 17;
+    bdlbb::PooledBlobBufferFactory blobFactory(
+        4096,
+        bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob blob(&blobFactory, bmqtst::TestHelperUtil::allocator());
+    bsl::string payload(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_PAYLOAD_SIZE; ++i) {
+        payload.push_back(static_cast<char>('a' + (i % 26)));
+    }
+    bdlbb::BlobUtil::append(&blob, payload.data(), k_PAYLOAD_SIZE);
+
+    // Read on the accepted end
+    bslmt::Semaphore readSemaphore;
+    bsl::string      received(bmqtst::TestHelperUtil::allocator());
+    bmqio::Status    status(bmqtst::TestHelperUtil::allocator());
+    tester.lastAcceptedChannel()->read(
+        &status,
+        k_PAYLOAD_SIZE,
+        bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                              &onRead,
+                              &readSemaphore,
+                              &received,
+                              k_PAYLOAD_SIZE,
+                              bdlf::PlaceHolders::_1,
+                              bdlf::PlaceHolders::_2,
+                              bdlf::PlaceHolders::_3));
+    BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
+
+    channel->write(&status, blob);
+    BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
+
+    readSemaphore.wait();
+    BMQTST_ASSERT_EQ(received, payload);
+
+    channel->close();
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -394,6 +521,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 2: {
+        test2_ioRingLoopback();
+    } break;
     case 1: {
         test1_breathingTest();
     } break;
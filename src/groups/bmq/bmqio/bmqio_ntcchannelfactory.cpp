@@ -177,13 +177,20 @@ NtcChannelFactory::NtcChannelFactory(
     d_interface_sp = ntcf::System::createInterface(interfaceConfig,
                                                    blobBufferFactory_sp,
                                                    d_allocator_p);
+    if (!d_interface_sp) {
+        // E.g. the requested driver is not supported by the host or was not
+        // enabled when building the networking library.  'start()' fails.
+        BALL_LOG_ERROR << "NTC factory failed to create interface with "
+                       << "driver '" << interfaceConfig.driverName() << "'"
+                       << BALL_LOG_END;
+    }
 }
 
 NtcChannelFactory::~NtcChannelFactory()
 {
     this->stop();
 
-    if (d_owned) {
+    if (d_owned && d_interface_sp) {
         d_interface_sp->closeAll();
         d_interface_sp->shutdown();
         d_interface_sp->linger();
@@ -207,6 +214,13 @@ int NtcChannelFactory::start()
         return 1;  // RETURN
     }
 
+    if (!d_interface_sp) {
+        // The interface could not be created, see the constructor.
+        BALL_LOG_ERROR << "NTC factory cannot start: no interface"
+                       << BALL_LOG_END;
+        return 2;  // RETURN
+    }
+
     if (!d_isInterfaceStarted) {
         // Make sure we don't restart the same interface if we have
         // `start()`, `stop()`, `start()` sequence.
@@ -469,5 +483,10 @@ bslstl::StringRef NtcChannelFactoryUtil::listenPortProperty()
     return bmqio::NtcListenerUtil::listenPortProperty();
 }
 
+bslstl::StringRef NtcChannelFactoryUtil::ioRingDriverName()
+{
+    return "iouring";
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -186,7 +186,9 @@ class NtcChannelFactory : public bmqio::ChannelFactory {
     /// and timers.  Allocate blob buffers when receiving data using the
     /// specified `blobBufferFactory`. Optionally specify a `basicAllocator`
     /// used to supply memory. If `basicAllocator` is 0, the currently
-    /// installed default allocator is used.
+    /// installed default allocator is used.  Note that if the interface
+    /// cannot be created (e.g., the driver requested by `interfaceConfig`
+    /// is not available), `start()` fails.
     explicit NtcChannelFactory(const ntca::InterfaceConfig& interfaceConfig,
                                bdlbb::BlobBufferFactory*    blobBufferFactory,
                                bslma::Allocator* basicAllocator = 0);
@@ -279,6 +281,15 @@ struct NtcChannelFactoryUtil {
     /// `NtcChannelFactory::listen` with an integer property containing the
     /// port to which the listening socket is bound.
     static bslstl::StringRef listenPortProperty();
+
+    /// Return the name of the io_uring driver, to be set as the driver name
+    /// of the `ntca::InterfaceConfig` of an interface whose sockets should
+    /// be driven by io_uring.  Such an interface operates as a proactor:
+    /// receives complete directly into the blob buffers of the interface's
+    /// blob buffer factory, and each blob written to a channel is submitted
+    /// as a single gathered send.  Note that io_uring is only available on
+    /// Linux, and only if enabled when building the networking library.
+    static bslstl::StringRef ioRingDriverName();
 };
 
 // -----------------------
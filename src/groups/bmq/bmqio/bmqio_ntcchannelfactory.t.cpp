@@ -1101,6 +1101,40 @@ NtcChannelFactory& Tester::object()
 // ============================================================================
 //                                    TESTS
 // ----------------------------------------------------------------------------
+static void test8_unavailableDriverTest()
+// ------------------------------------------------------------------------
+// UNAVAILABLE DRIVER TEST
+//
+// Concerns:
+//   a) A factory configured with a driver that cannot be created fails to
+//      start instead of crashing.
+//   b) Such a factory can be destroyed.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("Unavailable Driver Test");
+
+    bdlbb::PooledBlobBufferFactory blobBufferFactory(
+        4096,
+        bmqtst::TestHelperUtil::allocator());
+
+    ntca::InterfaceConfig interfaceConfig;
+    interfaceConfig.setThreadName("test");
+    interfaceConfig.setDriverName("noSuchDriver");
+
+    bslma::ManagedPtr<NtcChannelFactory> factory;
+    factory.load(new (*bmqtst::TestHelperUtil::allocator())
+                     NtcChannelFactory(interfaceConfig,
+                                       &blobBufferFactory,
+                                       bmqtst::TestHelperUtil::allocator()),
+                 bmqtst::TestHelperUtil::allocator());
+
+    // Concern 'a'
+    BMQTST_ASSERT_NE(factory->start(), 0);
+
+    // Concern 'b'
+    factory.reset();
+}
+
 static void test7_checkMultithreadListen()
 {
     bmqtst::TestHelper::printTestName("Check Multithread Listen Test");
@@ -1437,6 +1471,7 @@ int main(int argc, char* argv[])
     case 5: test5_visitChannelsTest(); break;
     case 6: test6_preCreationCbTest(); break;
     case 7: test7_checkMultithreadListen(); break;
+    case 8: test8_unavailableDriverTest(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
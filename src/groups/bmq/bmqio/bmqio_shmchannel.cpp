@@ -0,0 +1,948 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqio_shmchannel.h>
+
+#include <bmqscm_version.h>
+/// IMPLEMENTATION NOTES
+///--------------------
+//
+/// Wake up protocol
+///----------------
+//
+// Each ring has a 'waiting' flag for its reader and one for its writer.  A
+// side about to wait for data (resp. space) sets the flag and then checks the
+// ring again, while the other side publishes a new write (resp. read)
+// position and then clears the flag, signaling the 'eventfd' of the waiting
+// side if it was set.  All these operations are sequentially consistent, so
+// that either the waiting side sees the new position, or the other side sees
+// the flag: a wake up can not be lost.  Spurious wake ups are harmless.
+//
+/// Flow control
+///------------
+//
+// Like for a socket, data is only pulled from the incoming ring while a read
+// is pending, so that a slow reader eventually blocks the writer of the peer
+// (whose data then accumulates in its write queue, up to the high
+// watermark).  Processing of a single channel is bounded to the size of its
+// ring, after which the channel schedules itself again, so that a busy
+// channel does not starve the other channels of the factory.
+//
+/// Untrusted peer
+///--------------
+// The peer can write anything anywhere in the segment.  Each side therefore
+// keeps its own copy of the positions it owns, and only loads from the
+// segment the positions owned by the peer, which must be at most one ring
+// apart from (and not behind) the local ones: otherwise copying to or from
+// the ring would go out of its bounds.  A position violating this is a
+// protocol error, which closes the channel.
+
+// BDE
+#include <ball_log.h>
+#include <bdlbb_blobutil.h>
+#include <bdlf_bind.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_new.h>
+#include <bslma_default.h>
+#include <bslmf_assert.h>
+#include <bslmt_lockguard.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_systemtime.h>
+
+// SYSTEM
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace BloombergLP {
+namespace bmqio {
+
+namespace {
+
+BALL_LOG_SET_NAMESPACE_CATEGORY("BMQIO.SHMCHANNEL");
+
+// CONSTANTS
+
+/// Magic value identifying a segment ("BMQSHMCH").
+const bsls::Types::Uint64 k_SEGMENT_MAGIC = 0x424D5153484D4348ULL;
+
+/// Version of the layout of a segment.
+const int k_SEGMENT_VERSION = 1;
+
+enum { k_CACHE_LINE_SIZE = 64 };
+
+/// Wake up the owner of the specified event descriptor `fd`.
+void notify(int fd)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    ::eventfd_write(fd, 1);
+#else
+    (void)fd;
+#endif
+}
+
+/// Load into the optionally specified `status` the specified `category` and
+/// `reason`.
+void fail(Status* status, StatusCategory::Enum category, const char* reason)
+{
+    if (status) {
+        status->reset(category, "reason", reason);
+    }
+}
+
+}  // close unnamed namespace
+
+// ======================
+// struct ShmChannel_Ring
+// ======================
+
+/// Control block of a ring, laid out in shared memory.  Positions are byte
+/// counts which only grow: the offset in the data of the ring is the
+/// position modulo the size of the ring.
+struct ShmChannel_Ring {
+    // DATA
+
+    /// Position up to which the writer published data.
+    bsls::AtomicUint64 d_writePosition;
+
+    char d_writerPadding[k_CACHE_LINE_SIZE - sizeof(bsls::AtomicUint64)];
+
+    /// Position up to which the reader consumed data.
+    bsls::AtomicUint64 d_readPosition;
+
+    char d_readerPadding[k_CACHE_LINE_SIZE - sizeof(bsls::AtomicUint64)];
+
+    /// Set by the reader before waiting for data.
+    bsls::AtomicInt d_isReaderWaiting;
+
+    /// Set by the writer before waiting for space.
+    bsls::AtomicInt d_isWriterWaiting;
+
+    /// Set by the writer once it closed its side of the channel.
+    bsls::AtomicInt d_isWriterClosed;
+
+    char d_flagsPadding[k_CACHE_LINE_SIZE - 3 * sizeof(bsls::AtomicInt)];
+};
+
+// ===============================
+// struct ShmChannel_SegmentHeader
+// ===============================
+
+/// Header of a segment, laid out in shared memory.
+struct ShmChannel_SegmentHeader {
+    // DATA
+    bsls::Types::Uint64 d_magic;
+
+    int d_version;
+
+    int d_ringSize;
+
+    char d_padding[k_CACHE_LINE_SIZE - sizeof(bsls::Types::Uint64) -
+                   2 * sizeof(int)];
+
+    /// Control blocks of the rings, indexed by the side writing to them.
+    ShmChannel_Ring d_rings[2];
+};
+
+BSLMF_ASSERT(sizeof(ShmChannel_SegmentHeader) <=
+             ShmChannelUtil::k_HEADER_SIZE);
+
+// =====================
+// class ShmChannel_Read
+// =====================
+
+/// State of a single pending read operation.
+class ShmChannel_Read {
+  public:
+    // DATA
+    Channel::ReadCallback d_callback;
+
+    int d_numNeeded;
+
+    /// Deadline of the read, or the default value if it has no timeout.
+    bsls::TimeInterval d_deadline;
+
+    /// True once the read was completed, canceled or timed out.
+    bool d_isComplete;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ShmChannel_Read, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+    ShmChannel_Read(const Channel::ReadCallback& callback,
+                    int                          numNeeded,
+                    const bsls::TimeInterval&    deadline,
+                    bslma::Allocator*            basicAllocator = 0)
+    : d_callback(bsl::allocator_arg, basicAllocator, callback)
+    , d_numNeeded(numNeeded)
+    , d_deadline(deadline)
+    , d_isComplete(false)
+    {
+        // NOTHING
+    }
+};
+
+// ---------------------
+// struct ShmChannelUtil
+// ---------------------
+
+bool ShmChannelUtil::isValidRingSize(int ringSize)
+{
+    return ringSize >= k_MIN_RING_SIZE && (ringSize & (ringSize - 1)) == 0;
+}
+
+bsl::size_t ShmChannelUtil::segmentSize(int ringSize)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isValidRingSize(ringSize));
+
+    return k_HEADER_SIZE + 2 * static_cast<bsl::size_t>(ringSize);
+}
+
+void ShmChannelUtil::initializeSegment(void* segment, int ringSize)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(segment);
+    BSLS_ASSERT_SAFE(isValidRingSize(ringSize));
+
+    bsl::memset(segment, 0, k_HEADER_SIZE);
+
+    ShmChannel_SegmentHeader* header = new (segment)
+        ShmChannel_SegmentHeader();
+    header->d_magic    = k_SEGMENT_MAGIC;
+    header->d_version  = k_SEGMENT_VERSION;
+    header->d_ringSize = ringSize;
+}
+
+int ShmChannelUtil::validateSegment(const void* segment, bsl::size_t size)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_TOO_SMALL         = -1,
+        rc_INVALID_MAGIC     = -2,
+        rc_INVALID_VERSION   = -3,
+        rc_INVALID_RING_SIZE = -4,
+        rc_SIZE_MISMATCH     = -5
+    };
+
+    if (segment == 0 || size < static_cast<bsl::size_t>(k_HEADER_SIZE)) {
+        return rc_TOO_SMALL;  // RETURN
+    }
+
+    const ShmChannel_SegmentHeader* header =
+        static_cast<const ShmChannel_SegmentHeader*>(segment);
+    if (header->d_magic != k_SEGMENT_MAGIC) {
+        return rc_INVALID_MAGIC;  // RETURN
+    }
+
+    if (header->d_version != k_SEGMENT_VERSION) {
+        return rc_INVALID_VERSION;  // RETURN
+    }
+
+    const int ringSize = header->d_ringSize;
+    if (!isValidRingSize(ringSize)) {
+        return rc_INVALID_RING_SIZE;  // RETURN
+    }
+
+    if (segmentSize(ringSize) != size) {
+        return rc_SIZE_MISMATCH;  // RETURN
+    }
+
+    return ringSize;
+}
+
+// ----------------
+// class ShmChannel
+// ----------------
+
+// PRIVATE MANIPULATORS
+int ShmChannel::loadTxUsed(bsls::Types::Uint64* used)
+{
+    const bsls::Types::Uint64 readPosition =
+        d_txRing_p->d_readPosition.loadAcquire();
+
+    // A read position ahead of the write position wraps around to a huge
+    // value.
+    *used = d_txWritePosition - readPosition;
+    if (*used > d_ringMask + 1) {
+        failProtocol("read position");
+        return -1;  // RETURN
+    }
+
+    return 0;
+}
+
+int ShmChannel::writeToRing(const bdlbb::Blob& blob)
+{
+    const bsls::Types::Uint64 capacity      = d_ringMask + 1;
+    const bsls::Types::Uint64 writePosition = d_txWritePosition;
+
+    bsls::Types::Uint64 used = 0;
+    if (loadTxUsed(&used) != 0) {
+        return -1;  // RETURN
+    }
+
+    const bsls::Types::Uint64 space   = capacity - used;
+    const int                 toWrite = static_cast<int>(
+        bsl::min<bsls::Types::Uint64>(space, blob.length()));
+    if (toWrite == 0) {
+        return 0;  // RETURN
+    }
+
+    bsls::Types::Uint64 position  = writePosition;
+    int                 remaining = toWrite;
+    for (int i = 0; remaining > 0; ++i) {
+        const bdlbb::BlobBuffer& buffer = blob.buffer(i);
+        const int size = bsl::min(remaining,
+                                  i == blob.numDataBuffers() - 1
+                                      ? blob.lastDataBufferLength()
+                                      : buffer.size());
+
+        const bsls::Types::Uint64 offset = position & d_ringMask;
+        const int                 first  = static_cast<int>(
+            bsl::min<bsls::Types::Uint64>(size, capacity - offset));
+        bsl::memcpy(d_txData_p + offset, buffer.data(), first);
+        bsl::memcpy(d_txData_p, buffer.data() + first, size - first);
+
+        position += size;
+        remaining -= size;
+    }
+
+    // Publish the data, then wake up the peer if it announced it is waiting
+    // for data (see 'Wake up protocol' in the implementation notes).
+    d_txWritePosition           = writePosition + toWrite;
+    d_txRing_p->d_writePosition = d_txWritePosition;
+    if (d_txRing_p->d_isReaderWaiting.testAndSwap(1, 0) == 1) {
+        notify(d_peerEventFd);
+    }
+
+    return toWrite;
+}
+
+int ShmChannel::readFromRing()
+{
+    const bsls::Types::Uint64 capacity      = d_ringMask + 1;
+    const bsls::Types::Uint64 writePosition = d_rxRing_p->d_writePosition;
+    const bsls::Types::Uint64 readPosition  = d_rxReadPosition;
+
+    // A write position behind the read position wraps around to a huge
+    // value.
+    if (writePosition - readPosition > capacity) {
+        failProtocol("write position");
+        return -1;  // RETURN
+    }
+
+    const int available = static_cast<int>(writePosition - readPosition);
+    if (available == 0) {
+        return 0;  // RETURN
+    }
+
+    const bsls::Types::Uint64 offset = readPosition & d_ringMask;
+    const int                 first  = static_cast<int>(
+        bsl::min<bsls::Types::Uint64>(available, capacity - offset));
+    bdlbb::BlobUtil::append(&d_readCache, d_rxData_p + offset, first);
+    if (available > first) {
+        bdlbb::BlobUtil::append(&d_readCache, d_rxData_p, available - first);
+    }
+
+    // Release the space, then wake up the peer if it announced it is waiting
+    // for space.
+    d_rxReadPosition           = writePosition;
+    d_rxRing_p->d_readPosition = d_rxReadPosition;
+    if (d_rxRing_p->d_isWriterWaiting.testAndSwap(1, 0) == 1) {
+        notify(d_peerEventFd);
+    }
+
+    return available;
+}
+
+void ShmChannel::flushWriteQueue()
+{
+    while (d_writeQueue.length() > 0) {
+        const int written = writeToRing(d_writeQueue);
+        if (written > 0) {
+            bdlbb::BlobUtil::erase(&d_writeQueue, 0, written);
+            continue;  // CONTINUE
+        }
+
+        if (written < 0) {
+            // Protocol error, the channel is closing.
+            return;  // RETURN
+        }
+
+        // The ring is full: announce that we are waiting for space, and
+        // check again to not miss space released concurrently.
+        d_txRing_p->d_isWriterWaiting = 1;
+        bsls::Types::Uint64 used      = 0;
+        if (loadTxUsed(&used) != 0 || used == d_ringMask + 1) {
+            break;  // BREAK
+        }
+    }
+
+    if (d_isHighWatermarkReached &&
+        d_writeQueue.length() <= d_writeQueueLowWatermark) {
+        d_isHighWatermarkReached = false;
+        d_pendingWatermarks.push_back(ChannelWatermarkType::e_LOW_WATERMARK);
+    }
+}
+
+void ShmChannel::failProtocol(const char* reason)
+{
+    BALL_LOG_ERROR << "Shared memory channel to '" << d_peerUri
+                   << "': invalid " << reason
+                   << " published by the peer, closing the channel";
+
+    if (d_state == e_STATE_OPEN) {
+        d_state = e_STATE_CLOSING;
+        d_closeStatus.reset(StatusCategory::e_GENERIC_ERROR,
+                            "reason",
+                            "protocol");
+    }
+}
+
+void ShmChannel::removeRead(const bsl::shared_ptr<ShmChannel_Read>& read)
+{
+    if (read->d_deadline != bsls::TimeInterval()) {
+        --(*d_numTimedReads_p);
+    }
+
+    read->d_isComplete = true;
+    read->d_numNeeded  = 0;
+
+    ReadQueue::iterator it = bsl::find(d_readQueue.begin(),
+                                       d_readQueue.end(),
+                                       read);
+    if (it != d_readQueue.end()) {
+        d_readQueue.erase(it);
+    }
+}
+
+void ShmChannel::drainReaders(const Status& status)
+{
+    ReadQueue reads(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        reads.swap(d_readQueue);
+        for (ReadQueue::iterator it = reads.begin(); it != reads.end(); ++it) {
+            if ((*it)->d_deadline != bsls::TimeInterval()) {
+                --(*d_numTimedReads_p);
+            }
+            (*it)->d_isComplete = true;
+        }
+    }  // UNLOCK
+
+    for (ReadQueue::iterator it = reads.begin(); it != reads.end(); ++it) {
+        int         numNeeded = 0;
+        bdlbb::Blob blob;
+        (*it)->d_callback(status, &numNeeded, &blob);
+    }
+}
+
+void ShmChannel::processClose()
+{
+    Status status(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        if (d_state == e_STATE_CLOSED) {
+            return;  // RETURN
+        }
+
+        d_state = e_STATE_CLOSED;
+        status  = d_closeStatus;
+
+        // Let the peer know, through the segment and through the socket in
+        // case it is not processing the segment anymore.
+        d_txRing_p->d_isWriterClosed = 1;
+        notify(d_peerEventFd);
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        ::shutdown(d_socketFd, SHUT_RDWR);
+#endif
+
+        // Pending reads are canceled without being invoked.
+        for (ReadQueue::iterator it = d_readQueue.begin();
+             it != d_readQueue.end();
+             ++it) {
+            if ((*it)->d_deadline != bsls::TimeInterval()) {
+                --(*d_numTimedReads_p);
+            }
+            (*it)->d_isComplete = true;
+        }
+        d_readQueue.clear();
+        d_readCache.removeAll();
+        d_writeQueue.removeAll();
+        d_executeQueue.clear();
+        d_pendingWatermarks.clear();
+    }  // UNLOCK
+
+    BALL_LOG_DEBUG << "Shared memory channel to '" << d_peerUri
+                   << "' closed [status: " << status << "]";
+
+    d_closeSignaler(status);
+
+    d_watermarkSignaler.disconnectAllSlots();
+    d_closeSignaler.disconnectAllSlots();
+}
+
+// CREATORS
+ShmChannel::ShmChannel(void*                     segment,
+                       bsl::size_t               segmentSize,
+                       ShmChannelUtil::Side      side,
+                       int                       localEventFd,
+                       int                       peerEventFd,
+                       int                       socketFd,
+                       const bsl::string&        peerUri,
+                       bdlbb::BlobBufferFactory* blobBufferFactory,
+                       int                       lowWatermark,
+                       int                       highWatermark,
+                       bsls::AtomicInt*          numTimedReads,
+                       bslma::Allocator*         basicAllocator)
+: d_mutex()
+, d_state(e_STATE_OPEN)
+, d_segment_p(segment)
+, d_segmentSize(segmentSize)
+, d_txRing_p(0)
+, d_txData_p(0)
+, d_rxRing_p(0)
+, d_rxData_p(0)
+, d_ringMask(0)
+, d_txWritePosition(0)
+, d_rxReadPosition(0)
+, d_localEventFd(localEventFd)
+, d_peerEventFd(peerEventFd)
+, d_socketFd(socketFd)
+, d_peerUri(peerUri, basicAllocator)
+, d_readCache(blobBufferFactory, basicAllocator)
+, d_readQueue(basicAllocator)
+, d_writeQueue(basicAllocator)
+, d_writeQueueLowWatermark(lowWatermark)
+, d_writeQueueHighWatermark(highWatermark)
+, d_isHighWatermarkReached(false)
+, d_pendingWatermarks(basicAllocator)
+, d_executeQueue(basicAllocator)
+, d_closeStatus(basicAllocator)
+, d_numTimedReads_p(numTimedReads)
+, d_properties(basicAllocator)
+, d_watermarkSignaler(basicAllocator)
+, d_closeSignaler(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(ShmChannelUtil::validateSegment(segment, segmentSize) >
+                    0);
+    BSLS_ASSERT_SAFE(numTimedReads);
+
+    ShmChannel_SegmentHeader* header =
+        static_cast<ShmChannel_SegmentHeader*>(segment);
+    char* const data     = static_cast<char*>(segment) +
+                       ShmChannelUtil::k_HEADER_SIZE;
+    const int   ringSize = header->d_ringSize;
+    const int   peer     = 1 - side;
+
+    d_txRing_p = &header->d_rings[side];
+    d_txData_p = data + side * static_cast<bsl::size_t>(ringSize);
+    d_rxRing_p = &header->d_rings[peer];
+    d_rxData_p = data + peer * static_cast<bsl::size_t>(ringSize);
+    d_ringMask = ringSize - 1;
+
+    // The segment is validated before any data is exchanged, so these are
+    // the initial positions of the rings.
+    d_txWritePosition = d_txRing_p->d_writePosition;
+    d_rxReadPosition  = d_rxRing_p->d_readPosition;
+}
+
+ShmChannel::~ShmChannel()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    ::munmap(d_segment_p, d_segmentSize);
+    ::close(d_localEventFd);
+    ::close(d_peerEventFd);
+    ::close(d_socketFd);
+#endif
+}
+
+// MANIPULATORS
+void ShmChannel::read(Status*                   status,
+                      int                       numBytes,
+                      const ReadCallback&       readCallback,
+                      const bsls::TimeInterval& timeout)
+{
+    if (status) {
+        status->reset();
+    }
+
+    bsls::TimeInterval deadline;
+    if (timeout != bsls::TimeInterval()) {
+        deadline = bsls::SystemTime::nowMonotonicClock() + timeout;
+    }
+
+    bsl::shared_ptr<ShmChannel_Read> read;
+    read.createInplace(d_allocator_p,
+                       readCallback,
+                       numBytes,
+                       deadline,
+                       d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        if (d_state != e_STATE_OPEN) {
+            fail(status, StatusCategory::e_GENERIC_ERROR, "state");
+            return;  // RETURN
+        }
+
+        if (deadline != bsls::TimeInterval()) {
+            ++(*d_numTimedReads_p);
+        }
+        d_readQueue.push_back(read);
+    }  // UNLOCK
+
+    // Data may already be available: process it from the event thread.
+    notify(d_localEventFd);
+}
+
+void ShmChannel::write(Status*            status,
+                       const bdlbb::Blob& blob,
+                       bsls::Types::Int64 watermark)
+{
+    if (status) {
+        status->reset();
+    }
+
+    bool wakeUp = false;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        if (d_state != e_STATE_OPEN) {
+            fail(status, StatusCategory::e_GENERIC_ERROR, "state");
+            return;  // RETURN
+        }
+
+        if (d_writeQueue.length() > 0) {
+            // Preserve ordering with the data already queued.
+            const bsls::Types::Int64 limit = bsl::min<bsls::Types::Int64>(
+                watermark,
+                d_writeQueueHighWatermark);
+            if (d_writeQueue.length() + blob.length() > limit) {
+                fail(status, StatusCategory::e_LIMIT, "send");
+                if (!d_isHighWatermarkReached) {
+                    d_isHighWatermarkReached = true;
+                    d_pendingWatermarks.push_back(
+                        ChannelWatermarkType::e_HIGH_WATERMARK);
+                    wakeUp = true;
+                }
+            }
+            else {
+                bdlbb::BlobUtil::append(&d_writeQueue, blob);
+            }
+        }
+        else {
+            const int written = writeToRing(blob);
+            if (written < 0) {
+                // Protocol error: the closing is completed from the event
+                // thread.
+                fail(status, StatusCategory::e_GENERIC_ERROR, "protocol");
+                wakeUp = true;
+            }
+            else if (written < blob.length()) {
+                bdlbb::BlobUtil::append(&d_writeQueue, blob, written);
+
+                // Announce that we are waiting for space, and check again to
+                // not miss space released concurrently.
+                d_txRing_p->d_isWriterWaiting = 1;
+                bsls::Types::Uint64 used      = 0;
+                wakeUp = loadTxUsed(&used) != 0 || used <= d_ringMask;
+            }
+        }
+    }  // UNLOCK
+
+    if (wakeUp) {
+        notify(d_localEventFd);
+    }
+}
+
+void ShmChannel::cancelRead()
+{
+    const Status status(StatusCategory::e_CANCELED);
+    if (execute(bdlf::BindUtil::bind(&ShmChannel::drainReaders,
+                                     shared_from_this(),
+                                     status)) != 0) {
+        drainReaders(status);
+    }
+}
+
+void ShmChannel::close(const Status& status)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        if (d_state != e_STATE_OPEN) {
+            return;  // RETURN
+        }
+
+        d_state       = e_STATE_CLOSING;
+        d_closeStatus = status;
+    }  // UNLOCK
+
+    // The closing is completed from the event thread.
+    notify(d_localEventFd);
+}
+
+int ShmChannel::execute(const ExecuteCb& cb)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        if (d_state != e_STATE_OPEN) {
+            return -1;  // RETURN
+        }
+
+        d_executeQueue.push_back(cb);
+    }  // UNLOCK
+
+    notify(d_localEventFd);
+    return 0;
+}
+
+bdlmt::SignalerConnection ShmChannel::onClose(const CloseFn& cb)
+{
+    return d_closeSignaler.connect(cb);
+}
+
+bdlmt::SignalerConnection ShmChannel::onClose(const CloseFn& cb, int group)
+{
+    return d_closeSignaler.connect(cb, group);
+}
+
+bdlmt::SignalerConnection ShmChannel::onWatermark(const WatermarkFn& cb)
+{
+    return d_watermarkSignaler.connect(cb);
+}
+
+bmqvt::PropertyBag& ShmChannel::properties()
+{
+    return d_properties;
+}
+
+void ShmChannel::setWriteQueueLowWatermark(int lowWatermark)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+    d_writeQueueLowWatermark = lowWatermark;
+}
+
+void ShmChannel::setWriteQueueHighWatermark(int highWatermark)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+    d_writeQueueHighWatermark = highWatermark;
+}
+
+void ShmChannel::processEvents()
+{
+    // executed by the *EVENT* thread
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    eventfd_t value;
+    ::eventfd_read(d_localEventFd, &value);
+#endif
+
+    // Keep this object alive while invoking the user callbacks.
+    bsl::shared_ptr<ShmChannel> self = shared_from_this();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    if (d_state == e_STATE_CLOSED) {
+        return;  // RETURN
+    }
+
+    // 1. Callbacks submitted to 'execute'
+    if (!d_executeQueue.empty()) {
+        ExecuteQueue callbacks(d_allocator_p);
+        callbacks.swap(d_executeQueue);
+
+        bslmt::UnLockGuard<bslmt::Mutex> unlock(&d_mutex);  // UNLOCK
+        for (ExecuteQueue::iterator it = callbacks.begin();
+             it != callbacks.end();
+             ++it) {
+            (*it)();
+        }
+    }  // LOCK
+
+    if (d_state == e_STATE_CLOSING) {
+        guard.release()->unlock();  // UNLOCK
+        processClose();
+        return;  // RETURN
+    }
+
+    // 2. Outgoing data
+    flushWriteQueue();
+
+    // 3. Incoming data, bounded to one ring worth of data per invocation
+    bool close  = false;
+    int  budget = static_cast<int>(d_ringMask + 1);
+    while (!d_readQueue.empty() && d_state == e_STATE_OPEN) {
+        bsl::shared_ptr<ShmChannel_Read> read = d_readQueue.front();
+
+        if (read->d_numNeeded > d_readCache.length()) {
+            if (budget <= 0) {
+                notify(d_localEventFd);
+                break;  // BREAK
+            }
+
+            int numRead = readFromRing();
+            if (numRead == 0) {
+                // Announce that we are waiting for data, and check again to
+                // not miss data published concurrently.
+                d_rxRing_p->d_isReaderWaiting = 1;
+                numRead                       = readFromRing();
+            }
+
+            if (numRead <= 0) {
+                // No data, or protocol error (the channel is closing).
+                break;  // BREAK
+            }
+
+            budget -= numRead;
+            continue;  // CONTINUE
+        }
+
+        int numNeeded = 0;
+        {
+            bslmt::UnLockGuard<bslmt::Mutex> unlock(&d_mutex);  // UNLOCK
+            read->d_callback(Status(), &numNeeded, &d_readCache);
+        }  // LOCK
+
+        if (read->d_isComplete) {
+            // The read was canceled or timed out while the mutex was
+            // released.
+            continue;  // CONTINUE
+        }
+
+        if (numNeeded == 0) {
+            removeRead(read);
+        }
+        else if (numNeeded < 0) {
+            close = true;
+            break;  // BREAK
+        }
+        else {
+            read->d_numNeeded = numNeeded;
+        }
+    }
+
+    // 4. End of stream: the peer closed and all its data was consumed
+    if (!close && d_rxRing_p->d_isWriterClosed &&
+        d_rxRing_p->d_writePosition == d_rxReadPosition) {
+        close = true;
+    }
+
+    if (close && d_state == e_STATE_OPEN) {
+        d_state       = e_STATE_CLOSING;
+        d_closeStatus = Status();
+    }
+
+    // 5. Watermark events
+    WatermarkEvents watermarks(d_allocator_p);
+    watermarks.swap(d_pendingWatermarks);
+    const bool isClosing = d_state == e_STATE_CLOSING;
+
+    guard.release()->unlock();  // UNLOCK
+
+    for (WatermarkEvents::const_iterator it = watermarks.begin();
+         it != watermarks.end();
+         ++it) {
+        d_watermarkSignaler(*it);
+    }
+
+    if (isClosing) {
+        processClose();
+    }
+}
+
+void ShmChannel::processTimeouts(const bsls::TimeInterval& now)
+{
+    // executed by the *EVENT* thread
+
+    ReadQueue expired(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        for (ReadQueue::iterator it = d_readQueue.begin();
+             it != d_readQueue.end();) {
+            const ShmChannel_Read& read = **it;
+            if (read.d_deadline == bsls::TimeInterval() ||
+                read.d_deadline > now) {
+                ++it;
+                continue;  // CONTINUE
+            }
+
+            --(*d_numTimedReads_p);
+            (*it)->d_isComplete = true;
+            expired.push_back(*it);
+            it = d_readQueue.erase(it);
+        }
+    }  // UNLOCK
+
+    for (ReadQueue::iterator it = expired.begin(); it != expired.end(); ++it) {
+        int         numNeeded = 0;
+        bdlbb::Blob blob;
+        (*it)->d_callback(Status(StatusCategory::e_TIMEOUT),
+                          &numNeeded,
+                          &blob);
+    }
+}
+
+void ShmChannel::processHangup()
+{
+    // executed by the *EVENT* thread
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        if (d_state == e_STATE_OPEN) {
+            if (d_rxRing_p->d_isWriterClosed) {
+                // Orderly close of the peer: it is detected, once the
+                // remaining data is consumed, by 'processEvents'.
+                return;  // RETURN
+            }
+
+            BALL_LOG_WARN << "Shared memory channel to '" << d_peerUri
+                          << "': peer terminated without closing";
+
+            d_state       = e_STATE_CLOSING;
+            d_closeStatus = Status(StatusCategory::e_CONNECTION);
+        }
+    }  // UNLOCK
+
+    processClose();
+}
+
+// ACCESSORS
+bsl::string ShmChannel::peerUri() const
+{
+    return d_peerUri;
+}
+
+const bmqvt::PropertyBag& ShmChannel::properties() const
+{
+    return d_properties;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
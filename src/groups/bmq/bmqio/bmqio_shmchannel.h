@@ -0,0 +1,452 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQIO_SHMCHANNEL
+#define INCLUDED_BMQIO_SHMCHANNEL
+
+//@PURPOSE: Provide a bi-directional async channel over shared memory.
+//
+//@CLASSES:
+//  bmqio::ShmChannel:     channel exchanging data through shared memory rings
+//  bmqio::ShmChannelUtil: layout of the shared memory segment of a channel
+//
+//@SEE_ALSO:
+//  bmqio_shmchannelfactory
+//
+//@DESCRIPTION: This component provides a mechanism, 'bmqio::ShmChannel',
+// implementing the 'bmqio::Channel' protocol between two processes running on
+// the same host, without going through the network stack of the kernel.
+// Channels are created by a 'bmqio::ShmChannelFactory', which also drives
+// their events.
+//
+/// Segment layout
+///--------------
+// A channel is backed by one shared memory segment, mapped by both peers, and
+// by two 'eventfd' descriptors, one per peer.  The segment starts with a
+// header holding the control blocks of two single-producer single-consumer
+// byte rings, followed by the data of each ring:
+//..
+//  +---------------------+-----------------------+-----------------------+
+//  | header              | ring 0 data           | ring 1 data           |
+//  | (control of 0 and 1)| connector -> acceptor | acceptor -> connector |
+//  +---------------------+-----------------------+-----------------------+
+//..
+// Writing a blob copies its bytes into the outgoing ring and publishes the new
+// write position of the ring; reading copies the available bytes of the
+// incoming ring into blob buffers and publishes the new read position.  No
+// system call is involved, except to wake up a peer that announced, through
+// the control block of the ring, that it is about to wait for data (reader)
+// or for space (writer): the 'eventfd' of that peer is then signaled.  Data
+// which does not fit in the outgoing ring is queued by the channel and
+// flushed as the peer consumes the ring, subject to the usual write queue
+// watermarks.
+//
+/// Thread Safety
+///-------------
+// 'bmqio::ShmChannel' is thread safe.  Read, close, watermark and execute
+// callbacks are invoked from the event thread of the factory which created
+// the channel.
+
+#include <bmqio_channel.h>
+#include <bmqio_status.h>
+#include <bmqvt_propertybag.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlmt_signaler.h>
+#include <bsl_cstddef.h>
+#include <bsl_deque.h>
+#include <bsl_limits.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bmqio {
+
+// FORWARD DECLARATION
+class ShmChannel_Read;
+struct ShmChannel_Ring;
+
+// =====================
+// struct ShmChannelUtil
+// =====================
+
+/// Utilities describing the shared memory segment backing a `ShmChannel`.
+struct ShmChannelUtil {
+    // TYPES
+
+    /// Side of a channel: the connector writes to ring 0 and reads from ring
+    /// 1, the acceptor does the opposite.
+    enum Side { e_CONNECTOR = 0, e_ACCEPTOR = 1 };
+
+    // CONSTANTS
+    enum {
+        /// Size of the header of the segment, preceding the data of the
+        /// rings.
+        k_HEADER_SIZE = 4096,
+
+        /// Minimum size of the data of a ring.
+        k_MIN_RING_SIZE = 4096
+    };
+
+    // CLASS METHODS
+
+    /// Return true if the specified `ringSize` is a valid size for the data
+    /// of a ring, that is a power of 2 greater than or equal to
+    /// `k_MIN_RING_SIZE`, and false otherwise.
+    static bool isValidRingSize(int ringSize);
+
+    /// Return the size of a segment holding two rings of the specified
+    /// `ringSize`.  The behavior is undefined unless
+    /// `isValidRingSize(ringSize)`.
+    static bsl::size_t segmentSize(int ringSize);
+
+    /// Initialize, at the specified `segment` address, the header of a
+    /// segment holding two empty rings of the specified `ringSize`.  The
+    /// behavior is undefined unless `isValidRingSize(ringSize)` and
+    /// `segment` is the address of at least `segmentSize(ringSize)` bytes.
+    static void initializeSegment(void* segment, int ringSize);
+
+    /// Return the size of the rings of the segment of the specified `size`
+    /// at the specified `segment` address if it holds a valid header, or a
+    /// negative value otherwise.
+    static int validateSegment(const void* segment, bsl::size_t size);
+};
+
+// ================
+// class ShmChannel
+// ================
+
+/// Bi-directional async channel over a shared memory segment.
+class ShmChannel : public Channel,
+                   public bsl::enable_shared_from_this<ShmChannel> {
+  private:
+    // PRIVATE TYPES
+    enum State { e_STATE_OPEN, e_STATE_CLOSING, e_STATE_CLOSED };
+
+    typedef bsl::deque<bsl::shared_ptr<ShmChannel_Read> > ReadQueue;
+
+    typedef bsl::vector<ExecuteCb> ExecuteQueue;
+
+    typedef bsl::vector<ChannelWatermarkType::Enum> WatermarkEvents;
+
+    // DATA
+
+    /// Mutex protecting the state of this object.
+    mutable bslmt::Mutex d_mutex;
+
+    State d_state;
+
+    /// Mapped segment of this channel, and its size.
+    void*       d_segment_p;
+    bsl::size_t d_segmentSize;
+
+    /// Control block and data of the ring written by this side.
+    ShmChannel_Ring* d_txRing_p;
+    char*            d_txData_p;
+
+    /// Control block and data of the ring written by the peer.
+    ShmChannel_Ring* d_rxRing_p;
+    const char*      d_rxData_p;
+
+    /// Size of the data of each ring, minus 1.
+    bsls::Types::Uint64 d_ringMask;
+
+    /// Authoritative copies of the positions owned by this side: the write
+    /// position of the outgoing ring and the read position of the incoming
+    /// ring.  They are published to the segment, but never read back from
+    /// it, since the peer can write anywhere in the segment.
+    bsls::Types::Uint64 d_txWritePosition;
+    bsls::Types::Uint64 d_rxReadPosition;
+
+    /// Event descriptor signaled to wake up this side.
+    int d_localEventFd;
+
+    /// Event descriptor signaled to wake up the peer.
+    int d_peerEventFd;
+
+    /// Socket connected to the peer, only used to detect its termination.
+    int d_socketFd;
+
+    bsl::string d_peerUri;
+
+    /// Data read from the incoming ring but not consumed by a reader yet.
+    bdlbb::Blob d_readCache;
+
+    ReadQueue d_readQueue;
+
+    /// Data written to this channel which did not fit in the outgoing ring.
+    bdlbb::Blob d_writeQueue;
+
+    int d_writeQueueLowWatermark;
+
+    int d_writeQueueHighWatermark;
+
+    /// True if the high watermark was reached and the low watermark was not
+    /// reached since.
+    bool d_isHighWatermarkReached;
+
+    /// Watermark events to notify from the event thread.
+    WatermarkEvents d_pendingWatermarks;
+
+    /// Callbacks to invoke from the event thread.
+    ExecuteQueue d_executeQueue;
+
+    /// Status to report to the close callbacks.
+    Status d_closeStatus;
+
+    /// Number of pending reads with a timeout, across all channels of the
+    /// factory, held not owned.
+    bsls::AtomicInt* d_numTimedReads_p;
+
+    bmqvt::PropertyBag d_properties;
+
+    bdlmt::Signaler<WatermarkFnType> d_watermarkSignaler;
+
+    bdlmt::Signaler<CloseFnType> d_closeSignaler;
+
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    // NOT IMPLEMENTED
+    ShmChannel(const ShmChannel&) BSLS_KEYWORD_DELETED;
+    ShmChannel& operator=(const ShmChannel&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Load into the specified `used` the number of bytes of the outgoing
+    /// ring not consumed by the peer yet.  Return 0 on success, or a
+    /// non-zero value, after starting to close this channel with a protocol
+    /// error, if the read position published by the peer is invalid.  The
+    /// behavior is undefined unless `d_mutex` is locked.
+    int loadTxUsed(bsls::Types::Uint64* used);
+
+    /// Copy as many bytes as fit in the outgoing ring from the start of the
+    /// specified `blob`, wake up the peer if it is waiting for data, and
+    /// return the number of bytes copied, or a negative value, after
+    /// starting to close this channel with a protocol error, if the peer
+    /// published an invalid read position.  The behavior is undefined
+    /// unless `d_mutex` is locked.
+    int writeToRing(const bdlbb::Blob& blob);
+
+    /// Append all the bytes available in the incoming ring to the read
+    /// cache, wake up the peer if it is waiting for space, and return the
+    /// number of bytes appended, or a negative value, after starting to
+    /// close this channel with a protocol error, if the peer published an
+    /// invalid write position.  The behavior is undefined unless `d_mutex`
+    /// is locked.
+    int readFromRing();
+
+    /// Start closing this channel because the peer violated the protocol
+    /// of the segment, as described by the specified `reason`.  The
+    /// behavior is undefined unless `d_mutex` is locked.
+    void failProtocol(const char* reason);
+
+    /// Flush as much of the write queue as fits in the outgoing ring.  The
+    /// behavior is undefined unless `d_mutex` is locked.
+    void flushWriteQueue();
+
+    /// Remove the specified `read` from the read queue.  The behavior is
+    /// undefined unless `d_mutex` is locked.
+    void removeRead(const bsl::shared_ptr<ShmChannel_Read>& read);
+
+    /// Remove each pending read and invoke its callback with the specified
+    /// `status`.
+    void drainReaders(const Status& status);
+
+    /// Complete the closing of this channel, and notify the close
+    /// callbacks.
+    void processClose();
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ShmChannel, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a channel over the specified `segment` of the specified
+    /// `segmentSize`, mapped by this process, as the specified `side`.  Use
+    /// the specified `localEventFd` and `peerEventFd` to respectively be
+    /// woken up by, and wake up, the peer, and the specified `socketFd` to
+    /// detect the termination of the peer.  Report the specified `peerUri`.
+    /// Use the specified `blobBufferFactory` to allocate the buffers of the
+    /// data read, and the specified `lowWatermark` and `highWatermark` for
+    /// the write queue.  Maintain in the specified `numTimedReads` the
+    /// number of pending reads with a timeout.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  This object takes
+    /// ownership of the mapping and of the three descriptors.
+    ShmChannel(void*                     segment,
+               bsl::size_t               segmentSize,
+               ShmChannelUtil::Side      side,
+               int                       localEventFd,
+               int                       peerEventFd,
+               int                       socketFd,
+               const bsl::string&        peerUri,
+               bdlbb::BlobBufferFactory* blobBufferFactory,
+               int                       lowWatermark,
+               int                       highWatermark,
+               bsls::AtomicInt*          numTimedReads,
+               bslma::Allocator*         basicAllocator = 0);
+
+    /// Destroy this object, unmapping the segment and closing the
+    /// descriptors.
+    ~ShmChannel() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Initiate an asynchronous (timed) read operation on this channel, or
+    /// append this request to the currently pending requests if an
+    /// asynchronous read operation was already initiated, with an
+    /// associated specified relative `timeout`.  When at least the
+    /// specified `numBytes` of data are available after all previous
+    /// requests have been processed, if any, or when the timeout is
+    /// reached, the specified `readCallback` will be invoked (with
+    /// `category() == e_SUCCESS` or `category() == e_TIMEOUT`,
+    /// respectively).  Return `e_SUCCESS` on success, or a different value
+    /// on failure, populating the optionally specified `status` with
+    /// additional information about the failure.
+    void read(Status*                   status,
+              int                       numBytes,
+              const ReadCallback&       readCallback,
+              const bsls::TimeInterval& timeout = bsls::TimeInterval())
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Enqueue the specified message `blob` to be written to this channel.
+    /// Optionally provide `highWaterMark` to specify the maximum data size
+    /// that can be enqueued.  If `highWaterMark` is not specified then
+    /// INT_MAX is used.  Return 0 on success, and a non-zero value
+    /// otherwise.  On error, the return value may equal to one of the
+    /// enumerators in `bmqio_ChannelStatus::Type`.  Note that success does
+    /// not imply that the data has been written or will be successfully
+    /// written to the underlying stream used by this channel.  Also note
+    /// that in addition to `highWatermark` the enqueued portion must also
+    /// be less than a high watermark value supplied at the construction of
+    /// this channel for the write to succeed.
+    void write(Status*            status,
+               const bdlbb::Blob& blob,
+               bsls::Types::Int64 watermark = bsl::numeric_limits<int>::max())
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Cancel all pending read requests, and invoke their read callbacks
+    /// with a `bmqio::ChannelStatus::e_CANCELED` status.  Note that if the
+    /// channel is active, the read callbacks are invoked in the thread in
+    /// which the channel's data callbacks are invoked, else they are
+    /// invoked in the thread calling `cancelRead`.
+    void cancelRead() BSLS_KEYWORD_OVERRIDE;
+
+    /// Shutdown this channel, and cancel all pending read requests (but do
+    /// not invoke them).  Pass the specified `status` to any registered
+    /// `CloseFn`s.
+    void close(const Status& status = Status()) BSLS_KEYWORD_OVERRIDE;
+
+    /// Execute the specified `cb` serialized with calls to any registered
+    /// read callbacks, or any `close` or `watermark` event handlers for
+    /// this channel.  Return `0` on success or a negative value if the `cb`
+    /// could not be enqueued for execution.
+    int execute(const ExecuteCb& cb) BSLS_KEYWORD_OVERRIDE;
+
+    /// Register the specified `cb` to be invoked when a `close` event
+    /// occurs for this channel.  Return a `bdlmt::SignalerConnection`
+    /// object than can be used to unregister the callback.
+    bdlmt::SignalerConnection onClose(const CloseFn& cb) BSLS_KEYWORD_OVERRIDE;
+
+    /// Register the specified `cb` to be invoked when a `close` event
+    /// occurs for this channel.  Invoke the `cb` as part of the specified
+    /// `group`. Return a `bdlmt::SignalerConnection` object than can be
+    /// used to unregister the callback.
+    bdlmt::SignalerConnection onClose(const CloseFn& cb, int group);
+
+    /// Register the specified `cb` to be invoked when a `watermark` event
+    /// occurs for this channel.  Return a `bdlmt::SignalerConnection`
+    /// object than can be used to unregister the callback.
+    bdlmt::SignalerConnection
+    onWatermark(const WatermarkFn& cb) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a reference providing modifiable access to the properties of
+    /// this Channel.
+    bmqvt::PropertyBag& properties() BSLS_KEYWORD_OVERRIDE;
+
+    /// Set the write queue low watermark to the specified `lowWatermark`.
+    void setWriteQueueLowWatermark(int lowWatermark) BSLS_KEYWORD_OVERRIDE;
+
+    /// Set the write queue high watermark to the specified `highWatermark`.
+    void setWriteQueueHighWatermark(int highWatermark) BSLS_KEYWORD_OVERRIDE;
+
+    /// Process the events of this channel: run the callbacks submitted to
+    /// `execute`, flush the write queue, satisfy the pending reads from the
+    /// incoming ring and notify watermark events.  This method must be
+    /// called from the event thread whenever the local event descriptor is
+    /// signaled.
+    void processEvents();
+
+    /// Fail the pending reads whose deadline is before the specified `now`
+    /// with a `e_TIMEOUT` status.  This method must be called from the
+    /// event thread.
+    void processTimeouts(const bsls::TimeInterval& now);
+
+    /// Process the termination of the peer, signaled by its socket being
+    /// shut down.  This method must be called from the event thread.
+    void processHangup();
+
+    // ACCESSORS
+
+    /// Return the descriptor signaled to wake up this side of the channel.
+    int localEventFd() const;
+
+    /// Return the socket connected to the peer.
+    int socketFd() const;
+
+    /// Return the URI of the "remote" end of this channel.  It is up to the
+    /// underlying implementation to define the format of the returned URI.
+    bsl::string peerUri() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a reference providing modifiable access to the properties of
+    /// this Channel.
+    const bmqvt::PropertyBag& properties() const BSLS_KEYWORD_OVERRIDE;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ----------------
+// class ShmChannel
+// ----------------
+
+// ACCESSORS
+inline int ShmChannel::localEventFd() const
+{
+    return d_localEventFd;
+}
+
+inline int ShmChannel::socketFd() const
+{
+    return d_socketFd;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,1336 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqio_shmchannelfactory.h>
+
+#include <bmqscm_version.h>
+/// IMPLEMENTATION NOTES
+///--------------------
+//
+// Each descriptor monitored by the event thread is described by a
+// 'ShmChannelFactory_Registration', identified in the epoll instance by a
+// unique 64-bit identifier (0 being reserved to the control descriptor), so
+// that events of a descriptor which was removed and reused while a batch of
+// events is processed are simply ignored.  A registration owns the resources
+// of its operation (socket, mapping, event descriptors) until they are handed
+// over to a channel, which then owns them.
+//
+// The registrations are only accessed from the event thread: operations
+// initiated from other threads (listen, connect, cancel, stop) post a
+// callback to it.
+
+#include <bmqu_memoutstream.h>
+#include <bmqvt_propertybag.h>
+
+// BDE
+#include <ball_log.h>
+#include <bdlf_bind.h>
+#include <bdlf_memfn.h>
+#include <bdlf_placeholder.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+#include <bsl_utility.h>
+#include <bsla_annotations.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+
+// SYSTEM
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace BloombergLP {
+namespace bmqio {
+
+namespace {
+
+BALL_LOG_SET_NAMESPACE_CATEGORY("BMQIO.SHMCHANNELFACTORY");
+
+// CONSTANTS
+const char k_SCHEME[] = "shm://";
+
+const int k_CLOSE_GROUP = bsl::numeric_limits<int>::max();
+
+/// Identifier of the control descriptor in the epoll instance.
+const bsls::Types::Uint64 k_CONTROL_ID = 0;
+
+/// Magic value identifying a handshake ("BMQSHMHI").
+const bsls::Types::Uint64 k_HELLO_MAGIC = 0x424D5153484D4849ULL;
+
+const int k_HELLO_VERSION = 1;
+
+/// Byte acknowledging a handshake.
+const char k_ACK = 'A';
+
+enum {
+    k_LISTEN_BACKLOG = 128,
+
+    k_MAX_EVENTS = 64,
+
+    /// Number of descriptors passed in a handshake: the segment, and the
+    /// event descriptors of the connector and of the acceptor.
+    k_NUM_HANDSHAKE_FDS = 3
+};
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+/// Seals which must be set on a segment: a mapped segment shrunk by the peer
+/// would make accessing it raise 'SIGBUS'.
+const int k_REQUIRED_SEALS = F_SEAL_SHRINK | F_SEAL_GROW;
+#endif
+
+/// Load into the optionally specified `status` the specified `category` and
+/// `reason`.
+void fail(Status* status, StatusCategory::Enum category, const char* reason)
+{
+    if (status) {
+        status->reset(category, "reason", reason);
+    }
+}
+
+}  // close unnamed namespace
+
+// ==============================
+// struct ShmChannelFactory_Hello
+// ==============================
+
+/// Payload of the handshake sent by the connecting side.
+struct ShmChannelFactory_Hello {
+    // DATA
+    bsls::Types::Uint64 d_magic;
+
+    int d_version;
+
+    int d_ringSize;
+};
+
+// =====================================
+// struct ShmChannelFactory_Registration
+// =====================================
+
+/// Descriptor monitored by the event thread of a `ShmChannelFactory`, with
+/// the resources of its operation.
+struct ShmChannelFactory_Registration {
+    // TYPES
+    enum Type {
+        e_LISTENER,        // listening socket
+        e_HANDSHAKE,       // accepted socket, awaiting the handshake
+        e_CONNECTING,      // connected socket, awaiting the acknowledgment
+        e_CHANNEL_EVENT,   // event descriptor of a channel
+        e_CHANNEL_SOCKET   // socket of a channel
+    };
+
+    // DATA
+    Type d_type;
+
+    bsls::Types::Uint64 d_id;
+
+    /// Monitored descriptor.
+    int d_fd;
+
+    /// True if `d_fd` is owned by this object.
+    bool d_ownsFd;
+
+    /// Path of the socket of the listener.
+    bsl::string d_path;
+
+    ChannelFactory::ResultCallback d_callback;
+
+    /// Mapped segment of the channel being established, and its size.
+    void*       d_segment_p;
+    bsl::size_t d_segmentSize;
+
+    /// Event descriptors of the connector and of the acceptor of the channel
+    /// being established.
+    int d_eventFds[2];
+
+    /// Process identifier of the peer.
+    int d_peerPid;
+
+    /// Channel of a `e_CHANNEL_EVENT` or `e_CHANNEL_SOCKET` registration.
+    bsl::shared_ptr<ShmChannel> d_channel_sp;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ShmChannelFactory_Registration,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+    ShmChannelFactory_Registration(
+        Type                                  type,
+        bsls::Types::Uint64                   id,
+        int                                   fd,
+        bool                                  ownsFd,
+        const bsl::string&                    path,
+        const ChannelFactory::ResultCallback& callback,
+        bslma::Allocator*                     basicAllocator = 0);
+
+    /// Destroy this object, releasing the resources it still owns.
+    ~ShmChannelFactory_Registration();
+
+    // MANIPULATORS
+
+    /// Release the ownership of the descriptor, the mapping and the event
+    /// descriptors, which were handed over to a channel.
+    void release();
+};
+
+// ================================
+// class ShmChannelFactory_OpHandle
+// ================================
+
+/// Handle of a listen or connect operation of a `ShmChannelFactory`.
+class ShmChannelFactory_OpHandle : public ChannelFactoryOperationHandle {
+  private:
+    // DATA
+    ShmChannelFactory* d_factory_p;
+
+    bsls::Types::Uint64 d_id;
+
+    bmqvt::PropertyBag d_properties;
+
+  public:
+    // CREATORS
+    ShmChannelFactory_OpHandle(ShmChannelFactory*  factory,
+                               bsls::Types::Uint64 id,
+                               bslma::Allocator*   basicAllocator);
+
+    // MANIPULATORS
+
+    /// Cancel the operation, if it is still pending.
+    void cancel() BSLS_KEYWORD_OVERRIDE;
+
+    bmqvt::PropertyBag& properties() BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+    const bmqvt::PropertyBag& properties() const BSLS_KEYWORD_OVERRIDE;
+};
+
+// -------------------------------------
+// struct ShmChannelFactory_Registration
+// -------------------------------------
+
+ShmChannelFactory_Registration::ShmChannelFactory_Registration(
+    Type                                  type,
+    bsls::Types::Uint64                   id,
+    int                                   fd,
+    bool                                  ownsFd,
+    const bsl::string&                    path,
+    const ChannelFactory::ResultCallback& callback,
+    bslma::Allocator*                     basicAllocator)
+: d_type(type)
+, d_id(id)
+, d_fd(fd)
+, d_ownsFd(ownsFd)
+, d_path(path, basicAllocator)
+, d_callback(bsl::allocator_arg, basicAllocator, callback)
+, d_segment_p(0)
+, d_segmentSize(0)
+, d_peerPid(0)
+, d_channel_sp()
+{
+    d_eventFds[0] = -1;
+    d_eventFds[1] = -1;
+}
+
+ShmChannelFactory_Registration::~ShmChannelFactory_Registration()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (d_segment_p) {
+        ::munmap(d_segment_p, d_segmentSize);
+    }
+
+    for (int i = 0; i < 2; ++i) {
+        if (d_eventFds[i] >= 0) {
+            ::close(d_eventFds[i]);
+        }
+    }
+
+    if (d_ownsFd && d_fd >= 0) {
+        ::close(d_fd);
+        if (d_type == e_LISTENER) {
+            ::unlink(d_path.c_str());
+        }
+    }
+#endif
+}
+
+void ShmChannelFactory_Registration::release()
+{
+    d_ownsFd      = false;
+    d_segment_p   = 0;
+    d_eventFds[0] = -1;
+    d_eventFds[1] = -1;
+}
+
+// --------------------------------
+// class ShmChannelFactory_OpHandle
+// --------------------------------
+
+ShmChannelFactory_OpHandle::ShmChannelFactory_OpHandle(
+    ShmChannelFactory*  factory,
+    bsls::Types::Uint64 id,
+    bslma::Allocator*   basicAllocator)
+: d_factory_p(factory)
+, d_id(id)
+, d_properties(basicAllocator)
+{
+    // NOTHING
+}
+
+void ShmChannelFactory_OpHandle::cancel()
+{
+    d_factory_p->post(
+        bdlf::BindUtil::bind(&ShmChannelFactory::removeRegistration,
+                             d_factory_p,
+                             d_id));
+}
+
+bmqvt::PropertyBag& ShmChannelFactory_OpHandle::properties()
+{
+    return d_properties;
+}
+
+const bmqvt::PropertyBag& ShmChannelFactory_OpHandle::properties() const
+{
+    return d_properties;
+}
+
+// ----------------------------
+// struct ShmChannelFactoryUtil
+// ----------------------------
+
+bool ShmChannelFactoryUtil::isShmUri(const bslstl::StringRef& uri)
+{
+    const bsl::size_t length = sizeof(k_SCHEME) - 1;
+    return uri.length() >= length &&
+           bsl::memcmp(uri.data(), k_SCHEME, length) == 0;
+}
+
+int ShmChannelFactoryUtil::parseEndpoint(bsl::string*             path,
+                                         const bslstl::StringRef& endpoint)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(path);
+
+    bslstl::StringRef result = endpoint;
+    if (isShmUri(endpoint)) {
+        result = bslstl::StringRef(endpoint.data() + sizeof(k_SCHEME) - 1,
+                                   endpoint.length() - sizeof(k_SCHEME) + 1);
+    }
+
+    if (result.isEmpty()) {
+        return -1;  // RETURN
+    }
+
+    path->assign(result.data(), result.length());
+    return 0;
+}
+
+bsl::string ShmChannelFactoryUtil::peerUri(const bsl::string& path,
+                                           int                pid,
+                                           bslma::Allocator*  basicAllocator)
+{
+    bmqu::MemOutStream os(basicAllocator);
+    os << k_SCHEME << path << '#' << pid;
+    return bsl::string(os.str().data(), os.str().length(), basicAllocator);
+}
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+namespace {
+
+/// Load into the specified `address` the address of the Unix domain socket
+/// at the specified `path`.  Return 0 on success, or a non-zero value if
+/// `path` is too long.
+int makeAddress(sockaddr_un* address, const bsl::string& path)
+{
+    bsl::memset(address, 0, sizeof(*address));
+    if (path.length() >= sizeof(address->sun_path)) {
+        return -1;  // RETURN
+    }
+
+    address->sun_family = AF_UNIX;
+    bsl::memcpy(address->sun_path, path.c_str(), path.length());
+    return 0;
+}
+
+/// Return true if no process listens on the socket at the specified
+/// `address` anymore, and false otherwise.
+bool isStaleSocket(const sockaddr_un& address)
+{
+    const int fd = ::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return false;  // RETURN
+    }
+
+    const int rc = ::connect(fd,
+                             reinterpret_cast<const sockaddr*>(&address),
+                             sizeof(address));
+    const bool isStale = rc != 0 && errno == ECONNREFUSED;
+    ::close(fd);
+    return isStale;
+}
+
+/// Return the process identifier of the peer of the specified socket `fd`,
+/// or 0 if it can not be retrieved.
+int peerPid(int fd)
+{
+    struct ucred credentials;
+    socklen_t    length = sizeof(credentials);
+    if (::getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &length) !=
+        0) {
+        return 0;  // RETURN
+    }
+
+    return credentials.pid;
+}
+
+/// Create the segment and the event descriptors of a channel with rings of
+/// the specified `ringSize` into the specified `registration`, connect to
+/// the socket at its path and send the handshake.  Return 0 on success, or
+/// a non-zero value otherwise.
+int initiateConnection(ShmChannelFactory_Registration* registration,
+                       int                             ringSize)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS   = 0,
+        rc_ADDRESS   = -1,
+        rc_SEGMENT   = -2,
+        rc_EVENT_FDS = -3,
+        rc_SOCKET    = -4,
+        rc_CONNECT   = -5,
+        rc_HANDSHAKE = -6
+    };
+
+    sockaddr_un address;
+    if (makeAddress(&address, registration->d_path) != 0) {
+        return rc_ADDRESS;  // RETURN
+    }
+
+    // Segment
+    const bsl::size_t size = ShmChannelUtil::segmentSize(ringSize);
+    const int         memFd = ::memfd_create("bmq-shm-channel",
+                                             MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (memFd < 0) {
+        return rc_SEGMENT;  // RETURN
+    }
+
+    void* segment = MAP_FAILED;
+    if (::ftruncate(memFd, static_cast<off_t>(size)) == 0 &&
+        ::fcntl(memFd, F_ADD_SEALS, k_REQUIRED_SEALS) == 0) {
+        segment = ::mmap(0,
+                         size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED,
+                         memFd,
+                         0);
+    }
+    if (segment == MAP_FAILED) {
+        ::close(memFd);
+        return rc_SEGMENT;  // RETURN
+    }
+
+    registration->d_segment_p   = segment;
+    registration->d_segmentSize = size;
+    ShmChannelUtil::initializeSegment(segment, ringSize);
+
+    // Event descriptors
+    for (int i = 0; i < 2; ++i) {
+        registration->d_eventFds[i] = ::eventfd(0,
+                                                EFD_NONBLOCK | EFD_CLOEXEC);
+        if (registration->d_eventFds[i] < 0) {
+            ::close(memFd);
+            return rc_EVENT_FDS;  // RETURN
+        }
+    }
+
+    // Connection
+    registration->d_fd = ::socket(AF_UNIX,
+                                  SOCK_SEQPACKET | SOCK_NONBLOCK |
+                                      SOCK_CLOEXEC,
+                                  0);
+    if (registration->d_fd < 0) {
+        ::close(memFd);
+        return rc_SOCKET;  // RETURN
+    }
+
+    if (::connect(registration->d_fd,
+                  reinterpret_cast<const sockaddr*>(&address),
+                  sizeof(address)) != 0) {
+        ::close(memFd);
+        return rc_CONNECT;  // RETURN
+    }
+
+    // Handshake
+    ShmChannelFactory_Hello hello;
+    hello.d_magic    = k_HELLO_MAGIC;
+    hello.d_version  = k_HELLO_VERSION;
+    hello.d_ringSize = ringSize;
+
+    const int fds[k_NUM_HANDSHAKE_FDS] = {memFd,
+                                          registration->d_eventFds[0],
+                                          registration->d_eventFds[1]};
+
+    union {
+        char    d_buffer[CMSG_SPACE(sizeof(fds))];
+        cmsghdr d_align;
+    } control;
+    bsl::memset(&control, 0, sizeof(control));
+
+    iovec iov;
+    iov.iov_base = &hello;
+    iov.iov_len  = sizeof(hello);
+
+    msghdr message;
+    bsl::memset(&message, 0, sizeof(message));
+    message.msg_iov        = &iov;
+    message.msg_iovlen     = 1;
+    message.msg_control    = control.d_buffer;
+    message.msg_controllen = sizeof(control.d_buffer);
+
+    cmsghdr* header    = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type  = SCM_RIGHTS;
+    header->cmsg_len   = CMSG_LEN(sizeof(fds));
+    bsl::memcpy(CMSG_DATA(header), fds, sizeof(fds));
+
+    const ssize_t sent = ::sendmsg(registration->d_fd, &message, MSG_NOSIGNAL);
+    ::close(memFd);
+    if (sent != static_cast<ssize_t>(sizeof(hello))) {
+        return rc_HANDSHAKE;  // RETURN
+    }
+
+    registration->d_peerPid = peerPid(registration->d_fd);
+    return rc_SUCCESS;
+}
+
+/// Receive the handshake on the socket of the specified `registration` of
+/// an accepted connection, map the segment it carries and acknowledge it.
+/// Return 0 on success, a positive value if the handshake is not available
+/// yet, or a negative value on failure.
+int acceptConnection(ShmChannelFactory_Registration* registration)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS     = 0,
+        rc_PENDING     = 1,
+        rc_RECEIVE     = -1,
+        rc_DESCRIPTORS = -2,
+        rc_HELLO       = -3,
+        rc_SEALS       = -4,
+        rc_SEGMENT     = -5,
+        rc_ACK         = -6
+    };
+
+    ShmChannelFactory_Hello hello;
+    iovec                   iov;
+    iov.iov_base = &hello;
+    iov.iov_len  = sizeof(hello);
+
+    union {
+        char    d_buffer[CMSG_SPACE(k_NUM_HANDSHAKE_FDS * sizeof(int))];
+        cmsghdr d_align;
+    } control;
+
+    msghdr message;
+    bsl::memset(&message, 0, sizeof(message));
+    message.msg_iov        = &iov;
+    message.msg_iovlen     = 1;
+    message.msg_control    = control.d_buffer;
+    message.msg_controllen = sizeof(control.d_buffer);
+
+    const ssize_t received = ::recvmsg(registration->d_fd,
+                                       &message,
+                                       MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+    if (received < 0 && (errno == EAGAIN || errno == EINTR)) {
+        return rc_PENDING;  // RETURN
+    }
+    if (received <= 0) {
+        return rc_RECEIVE;  // RETURN
+    }
+
+    int fds[k_NUM_HANDSHAKE_FDS] = {-1, -1, -1};
+    int numFds                   = 0;
+    for (cmsghdr* header = CMSG_FIRSTHDR(&message); header;
+         header          = CMSG_NXTHDR(&message, header)) {
+        if (header->cmsg_level != SOL_SOCKET ||
+            header->cmsg_type != SCM_RIGHTS) {
+            continue;  // CONTINUE
+        }
+
+        numFds = static_cast<int>((header->cmsg_len - CMSG_LEN(0)) /
+                                  sizeof(int));
+        bsl::memcpy(fds,
+                    CMSG_DATA(header),
+                    bsl::min(numFds, static_cast<int>(k_NUM_HANDSHAKE_FDS)) *
+                        sizeof(int));
+    }
+
+    // From now on, the event descriptors are released with the registration.
+    const int memFd             = fds[0];
+    registration->d_eventFds[0] = fds[1];
+    registration->d_eventFds[1] = fds[2];
+
+    if (numFds != k_NUM_HANDSHAKE_FDS ||
+        (message.msg_flags & MSG_CTRUNC) != 0) {
+        if (memFd >= 0) {
+            ::close(memFd);
+        }
+        return rc_DESCRIPTORS;  // RETURN
+    }
+
+    struct stat info;
+    if (received != static_cast<ssize_t>(sizeof(hello)) ||
+        hello.d_magic != k_HELLO_MAGIC ||
+        hello.d_version != k_HELLO_VERSION ||
+        !ShmChannelUtil::isValidRingSize(hello.d_ringSize) ||
+        ::fstat(memFd, &info) != 0 ||
+        static_cast<bsl::size_t>(info.st_size) !=
+            ShmChannelUtil::segmentSize(hello.d_ringSize)) {
+        ::close(memFd);
+        return rc_HELLO;  // RETURN
+    }
+
+    // Without these seals, the peer could shrink the segment once mapped.
+    const int seals = ::fcntl(memFd, F_GET_SEALS);
+    if (seals < 0 || (seals & k_REQUIRED_SEALS) != k_REQUIRED_SEALS) {
+        ::close(memFd);
+        return rc_SEALS;  // RETURN
+    }
+
+    const bsl::size_t size    = ShmChannelUtil::segmentSize(hello.d_ringSize);
+    void*             segment = ::mmap(0,
+                               size,
+                               PROT_READ | PROT_WRITE,
+                               MAP_SHARED,
+                               memFd,
+                               0);
+    ::close(memFd);
+    if (segment == MAP_FAILED) {
+        return rc_SEGMENT;  // RETURN
+    }
+
+    registration->d_segment_p   = segment;
+    registration->d_segmentSize = size;
+    if (ShmChannelUtil::validateSegment(segment, size) != hello.d_ringSize) {
+        return rc_SEGMENT;  // RETURN
+    }
+
+    if (::send(registration->d_fd, &k_ACK, 1, MSG_NOSIGNAL) != 1) {
+        return rc_ACK;  // RETURN
+    }
+
+    registration->d_peerPid = peerPid(registration->d_fd);
+    return rc_SUCCESS;
+}
+
+}  // close unnamed namespace
+
+#endif  // BSLS_PLATFORM_OS_LINUX
+
+// -----------------------
+// class ShmChannelFactory
+// -----------------------
+
+// PRIVATE MANIPULATORS
+int ShmChannelFactory::post(const Callback& callback)
+{
+    if (!d_isRunning) {
+        return -1;  // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        d_callbacks.push_back(callback);
+    }  // UNLOCK
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    ::eventfd_write(d_controlFd, 1);
+#endif
+    return 0;
+}
+
+void ShmChannelFactory::processCallbacks()
+{
+    // executed by the *EVENT* thread
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    eventfd_t value;
+    ::eventfd_read(d_controlFd, &value);
+#endif
+
+    CallbackQueue callbacks(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        callbacks.swap(d_callbacks);
+    }  // UNLOCK
+
+    for (CallbackQueue::iterator it = callbacks.begin();
+         it != callbacks.end();
+         ++it) {
+        (*it)();
+    }
+}
+
+void ShmChannelFactory::addRegistration(const RegistrationSp& registration,
+                                        int                   events)
+{
+    // executed by the *EVENT* thread
+
+    if (d_isStopping) {
+        // The resources of the operation are released with 'registration'.
+        return;  // RETURN
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    epoll_event event;
+    bsl::memset(&event, 0, sizeof(event));
+    event.events   = events;
+    event.data.u64 = registration->d_id;
+    if (::epoll_ctl(d_epollFd, EPOLL_CTL_ADD, registration->d_fd, &event) !=
+        0) {
+        BALL_LOG_ERROR << "Failed to monitor descriptor " << registration->d_fd
+                       << " [errno: " << errno << "]";
+        return;  // RETURN
+    }
+#else
+    (void)events;
+#endif
+
+    d_registrations.insert(bsl::make_pair(registration->d_id, registration));
+}
+
+void ShmChannelFactory::removeRegistration(bsls::Types::Uint64 id)
+{
+    // executed by the *EVENT* thread
+
+    RegistrationMap::iterator it = d_registrations.find(id);
+    if (it == d_registrations.end()) {
+        return;  // RETURN
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    ::epoll_ctl(d_epollFd, EPOLL_CTL_DEL, it->second->d_fd, 0);
+#endif
+    d_registrations.erase(it);
+}
+
+void ShmChannelFactory::removeChannel(BSLA_UNUSED const Status& status,
+                                      bsls::Types::Uint64       eventId,
+                                      bsls::Types::Uint64       socketId)
+{
+    // executed by the *EVENT* thread
+
+    removeRegistration(eventId);
+    removeRegistration(socketId);
+}
+
+void ShmChannelFactory::processTimeouts()
+{
+    // executed by the *EVENT* thread
+
+    bsl::vector<bsl::shared_ptr<ShmChannel> > channels(d_allocator_p);
+    for (RegistrationMap::const_iterator it = d_registrations.begin();
+         it != d_registrations.end();
+         ++it) {
+        if (it->second->d_type ==
+            ShmChannelFactory_Registration::e_CHANNEL_EVENT) {
+            channels.push_back(it->second->d_channel_sp);
+        }
+    }
+
+    const bsls::TimeInterval now = bsls::SystemTime::nowMonotonicClock();
+    for (bsl::size_t i = 0; i < channels.size(); ++i) {
+        channels[i]->processTimeouts(now);
+    }
+}
+
+void ShmChannelFactory::shutdown()
+{
+    // executed by the *EVENT* thread
+
+    d_isRunning  = false;
+    d_isStopping = true;
+
+    bsl::vector<bsls::Types::Uint64>          ids(d_allocator_p);
+    bsl::vector<bsl::shared_ptr<ShmChannel> > channels(d_allocator_p);
+    for (RegistrationMap::const_iterator it = d_registrations.begin();
+         it != d_registrations.end();
+         ++it) {
+        switch (it->second->d_type) {
+        case ShmChannelFactory_Registration::e_CHANNEL_EVENT: {
+            channels.push_back(it->second->d_channel_sp);
+        } break;
+        case ShmChannelFactory_Registration::e_CHANNEL_SOCKET: {
+            // Removed with the channel
+        } break;
+        case ShmChannelFactory_Registration::e_LISTENER:
+        case ShmChannelFactory_Registration::e_HANDSHAKE:
+        case ShmChannelFactory_Registration::e_CONNECTING:
+        default: {
+            ids.push_back(it->first);
+        } break;
+        }
+    }
+
+    for (bsl::size_t i = 0; i < ids.size(); ++i) {
+        removeRegistration(ids[i]);
+    }
+
+    // The event thread terminates once the channels completed their closing.
+    for (bsl::size_t i = 0; i < channels.size(); ++i) {
+        channels[i]->close();
+    }
+}
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+void ShmChannelFactory::eventLoop()
+{
+    // executed by the *EVENT* thread
+
+    epoll_event events[k_MAX_EVENTS];
+
+    while (!d_isStopping || !d_registrations.empty()) {
+        const int timeout   = d_numTimedReads > 0 ? k_TIMER_RESOLUTION_MS
+                                                  : -1;
+        const int numEvents = ::epoll_wait(d_epollFd,
+                                           events,
+                                           k_MAX_EVENTS,
+                                           timeout);
+        if (numEvents < 0) {
+            if (errno == EINTR) {
+                continue;  // CONTINUE
+            }
+
+            BALL_LOG_ERROR << "Failed to wait for events [errno: " << errno
+                           << "]";
+            break;  // BREAK
+        }
+
+        for (int i = 0; i < numEvents; ++i) {
+            const bsls::Types::Uint64 id = events[i].data.u64;
+            if (id == k_CONTROL_ID) {
+                processCallbacks();
+                continue;  // CONTINUE
+            }
+
+            RegistrationMap::iterator it = d_registrations.find(id);
+            if (it == d_registrations.end()) {
+                // Removed while processing this batch of events
+                continue;  // CONTINUE
+            }
+
+            const RegistrationSp registration = it->second;
+            switch (registration->d_type) {
+            case ShmChannelFactory_Registration::e_LISTENER: {
+                processAccept(registration);
+            } break;
+            case ShmChannelFactory_Registration::e_HANDSHAKE: {
+                processHandshake(registration);
+            } break;
+            case ShmChannelFactory_Registration::e_CONNECTING: {
+                processConnectAck(registration);
+            } break;
+            case ShmChannelFactory_Registration::e_CHANNEL_EVENT: {
+                registration->d_channel_sp->processEvents();
+            } break;
+            case ShmChannelFactory_Registration::e_CHANNEL_SOCKET: {
+                // Hang ups are level-triggered: stop monitoring the socket,
+                // the channel completes its closing on its own.
+                const bsl::shared_ptr<ShmChannel> channel =
+                    registration->d_channel_sp;
+                removeRegistration(id);
+                channel->processHangup();
+            } break;
+            default: {
+                BSLS_ASSERT_SAFE(false && "Unexpected registration type");
+            }
+            }
+        }
+
+        if (d_numTimedReads > 0) {
+            processTimeouts();
+        }
+    }
+}
+
+void ShmChannelFactory::processAccept(const RegistrationSp& registration)
+{
+    // executed by the *EVENT* thread
+
+    while (true) {
+        const int fd = ::accept4(registration->d_fd,
+                                 0,
+                                 0,
+                                 SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;  // CONTINUE
+            }
+
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                BALL_LOG_WARN << "Failed to accept a connection on '"
+                              << registration->d_path << "' [errno: " << errno
+                              << "]";
+            }
+            break;  // BREAK
+        }
+
+        RegistrationSp handshake;
+        handshake.createInplace(d_allocator_p,
+                                ShmChannelFactory_Registration::e_HANDSHAKE,
+                                d_nextId.add(1),
+                                fd,
+                                true,
+                                registration->d_path,
+                                registration->d_callback,
+                                d_allocator_p);
+        addRegistration(handshake, EPOLLIN);
+    }
+}
+
+void ShmChannelFactory::processHandshake(const RegistrationSp& registration)
+{
+    // executed by the *EVENT* thread
+
+    const int rc = acceptConnection(registration.get());
+    if (rc > 0) {
+        // Handshake not received yet
+        return;  // RETURN
+    }
+
+    if (rc != 0) {
+        BALL_LOG_WARN << "Rejecting shared memory connection on '"
+                      << registration->d_path << "' [rc: " << rc << "]";
+        removeRegistration(registration->d_id);
+        return;  // RETURN
+    }
+
+    createChannel(registration, ShmChannelUtil::e_ACCEPTOR);
+}
+
+void ShmChannelFactory::processConnectAck(const RegistrationSp& registration)
+{
+    // executed by the *EVENT* thread
+
+    char          ack      = 0;
+    const ssize_t received = ::recv(registration->d_fd,
+                                    &ack,
+                                    1,
+                                    MSG_DONTWAIT);
+    if (received < 0 && (errno == EAGAIN || errno == EINTR)) {
+        return;  // RETURN
+    }
+
+    if (received != 1 || ack != k_ACK) {
+        BALL_LOG_WARN << "Shared memory connection to '"
+                      << registration->d_path << "' was rejected";
+
+        removeRegistration(registration->d_id);
+        registration->d_callback(ChannelFactoryEvent::e_CONNECT_FAILED,
+                                 Status(StatusCategory::e_CONNECTION),
+                                 bsl::shared_ptr<Channel>());
+        return;  // RETURN
+    }
+
+    createChannel(registration, ShmChannelUtil::e_CONNECTOR);
+}
+
+void ShmChannelFactory::createChannel(const RegistrationSp& registration,
+                                      ShmChannelUtil::Side  side)
+{
+    // executed by the *EVENT* thread
+
+    const int localEventFd = registration->d_eventFds[side];
+    const int peerEventFd  = registration->d_eventFds[1 - side];
+
+    bsl::shared_ptr<ShmChannel> channel;
+    channel.createInplace(
+        d_allocator_p,
+        registration->d_segment_p,
+        registration->d_segmentSize,
+        side,
+        localEventFd,
+        peerEventFd,
+        registration->d_fd,
+        ShmChannelFactoryUtil::peerUri(registration->d_path,
+                                       registration->d_peerPid,
+                                       d_allocator_p),
+        d_blobBufferFactory_p,
+        d_lowWatermark,
+        d_highWatermark,
+        &d_numTimedReads,
+        d_allocator_p);
+
+    // The resources are now owned by the channel.
+    registration->release();
+    removeRegistration(registration->d_id);
+
+    RegistrationSp eventRegistration;
+    eventRegistration.createInplace(
+        d_allocator_p,
+        ShmChannelFactory_Registration::e_CHANNEL_EVENT,
+        d_nextId.add(1),
+        localEventFd,
+        false,
+        registration->d_path,
+        ChannelFactory::ResultCallback(),
+        d_allocator_p);
+    eventRegistration->d_channel_sp = channel;
+
+    RegistrationSp socketRegistration;
+    socketRegistration.createInplace(
+        d_allocator_p,
+        ShmChannelFactory_Registration::e_CHANNEL_SOCKET,
+        d_nextId.add(1),
+        channel->socketFd(),
+        false,
+        registration->d_path,
+        ChannelFactory::ResultCallback(),
+        d_allocator_p);
+    socketRegistration->d_channel_sp = channel;
+
+    addRegistration(eventRegistration, EPOLLIN);
+    addRegistration(socketRegistration, EPOLLRDHUP);
+
+    channel->onClose(bdlf::BindUtil::bind(&ShmChannelFactory::removeChannel,
+                                          this,
+                                          bdlf::PlaceHolders::_1,  // status
+                                          eventRegistration->d_id,
+                                          socketRegistration->d_id),
+                     k_CLOSE_GROUP);
+
+    BALL_LOG_INFO << "Shared memory channel to '" << channel->peerUri()
+                  << "' is up [ringSize: " << (registration->d_segmentSize -
+                                               ShmChannelUtil::k_HEADER_SIZE) /
+                                                  2
+                  << "]";
+
+    d_createSignaler(channel);
+
+    registration->d_callback(ChannelFactoryEvent::e_CHANNEL_UP,
+                             Status(),
+                             channel);
+}
+
+#endif  // BSLS_PLATFORM_OS_LINUX
+
+// CREATORS
+ShmChannelFactory::ShmChannelFactory(
+    bdlbb::BlobBufferFactory* blobBufferFactory,
+    int                       ringSize,
+    int                       lowWatermark,
+    int                       highWatermark,
+    bslma::Allocator*         basicAllocator)
+: d_blobBufferFactory_p(blobBufferFactory)
+, d_ringSize(ringSize)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_epollFd(-1)
+, d_controlFd(-1)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_isRunning(false)
+, d_isStopping(false)
+, d_mutex()
+, d_callbacks(basicAllocator)
+, d_registrations(basicAllocator)
+, d_nextId(k_CONTROL_ID)
+, d_numTimedReads(0)
+, d_createSignaler(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(blobBufferFactory);
+    BSLS_ASSERT_OPT(ShmChannelUtil::isValidRingSize(ringSize));
+}
+
+ShmChannelFactory::~ShmChannelFactory()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(d_epollFd < 0 && "Factory must be stopped");
+}
+
+// MANIPULATORS
+int ShmChannelFactory::start()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS         = 0,
+        rc_ALREADY_STARTED = -1,
+        rc_EPOLL           = -2,
+        rc_CONTROL         = -3,
+        rc_THREAD          = -4
+    };
+
+    if (d_epollFd >= 0) {
+        return rc_ALREADY_STARTED;  // RETURN
+    }
+
+    d_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (d_epollFd < 0) {
+        BALL_LOG_ERROR << "Failed to create epoll instance [errno: " << errno
+                       << "]";
+        return rc_EPOLL;  // RETURN
+    }
+
+    d_controlFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    epoll_event event;
+    bsl::memset(&event, 0, sizeof(event));
+    event.events   = EPOLLIN;
+    event.data.u64 = k_CONTROL_ID;
+    if (d_controlFd < 0 ||
+        ::epoll_ctl(d_epollFd, EPOLL_CTL_ADD, d_controlFd, &event) != 0) {
+        BALL_LOG_ERROR << "Failed to create control descriptor [errno: "
+                       << errno << "]";
+        if (d_controlFd >= 0) {
+            ::close(d_controlFd);
+            d_controlFd = -1;
+        }
+        ::close(d_epollFd);
+        d_epollFd = -1;
+        return rc_CONTROL;  // RETURN
+    }
+
+    d_isStopping = false;
+    d_isRunning  = true;
+
+    bslmt::ThreadAttributes attributes;
+    attributes.setThreadName("bmqShm");
+    const int rc = bslmt::ThreadUtil::createWithAllocator(
+        &d_threadHandle,
+        attributes,
+        bdlf::MemFnUtil::memFn(&ShmChannelFactory::eventLoop, this),
+        d_allocator_p);
+    if (rc != 0) {
+        BALL_LOG_ERROR << "Failed to create event thread [rc: " << rc << "]";
+        d_isRunning = false;
+        ::close(d_controlFd);
+        ::close(d_epollFd);
+        d_controlFd = -1;
+        d_epollFd   = -1;
+        return rc_THREAD;  // RETURN
+    }
+
+    return rc_SUCCESS;
+#else
+    BALL_LOG_ERROR << "Shared memory channels are not supported on this "
+                   << "platform";
+    return -1;
+#endif
+}
+
+void ShmChannelFactory::stop()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (d_epollFd < 0) {
+        return;  // RETURN
+    }
+
+    if (post(bdlf::MemFnUtil::memFn(&ShmChannelFactory::shutdown, this)) ==
+        0) {
+        bslmt::ThreadUtil::join(d_threadHandle);
+    }
+
+    d_callbacks.clear();
+    d_registrations.clear();
+
+    ::close(d_controlFd);
+    ::close(d_epollFd);
+    d_controlFd = -1;
+    d_epollFd   = -1;
+#endif
+}
+
+void ShmChannelFactory::listen(Status*                      status,
+                               bslma::ManagedPtr<OpHandle>* handle,
+                               const ListenOptions&         options,
+                               const ResultCallback&        cb)
+{
+    if (status) {
+        status->reset();
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bsl::string path(d_allocator_p);
+    sockaddr_un address;
+    if (ShmChannelFactoryUtil::parseEndpoint(&path, options.endpoint()) !=
+            0 ||
+        makeAddress(&address, path) != 0) {
+        fail(status, StatusCategory::e_GENERIC_ERROR, "endpoint");
+        return;  // RETURN
+    }
+
+    if (!d_isRunning) {
+        fail(status, StatusCategory::e_GENERIC_ERROR, "state");
+        return;  // RETURN
+    }
+
+    const int fd = ::socket(AF_UNIX,
+                            SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC,
+                            0);
+    if (fd < 0) {
+        fail(status, StatusCategory::e_GENERIC_ERROR, "socket");
+        return;  // RETURN
+    }
+
+    int rc = ::bind(fd,
+                    reinterpret_cast<const sockaddr*>(&address),
+                    sizeof(address));
+    if (rc != 0 && errno == EADDRINUSE && isStaleSocket(address)) {
+        // Left over by a process which did not terminate cleanly
+        BALL_LOG_INFO << "Removing stale shared memory endpoint '" << path
+                      << "'";
+        ::unlink(path.c_str());
+        rc = ::bind(fd,
+                    reinterpret_cast<const sockaddr*>(&address),
+                    sizeof(address));
+    }
+
+    if (rc != 0 || ::listen(fd, k_LISTEN_BACKLOG) != 0) {
+        BALL_LOG_ERROR << "Failed to listen on '" << path
+                       << "' [errno: " << errno << "]";
+        ::close(fd);
+        fail(status, StatusCategory::e_GENERIC_ERROR, "listen");
+        return;  // RETURN
+    }
+
+    RegistrationSp registration;
+    registration.createInplace(d_allocator_p,
+                               ShmChannelFactory_Registration::e_LISTENER,
+                               d_nextId.add(1),
+                               fd,
+                               true,
+                               path,
+                               cb,
+                               d_allocator_p);
+
+    if (handle) {
+        handle->load(new (*d_allocator_p)
+                         ShmChannelFactory_OpHandle(this,
+                                                    registration->d_id,
+                                                    d_allocator_p),
+                     d_allocator_p);
+    }
+
+    post(bdlf::BindUtil::bind(&ShmChannelFactory::addRegistration,
+                              this,
+                              registration,
+                              static_cast<int>(EPOLLIN)));
+
+    BALL_LOG_INFO << "Listening for shared memory connections on '" << path
+                  << "'";
+#else
+    (void)handle;
+    (void)options;
+    (void)cb;
+    fail(status, StatusCategory::e_GENERIC_ERROR, "unsupported");
+#endif
+}
+
+void ShmChannelFactory::connect(Status*                      status,
+                                bslma::ManagedPtr<OpHandle>* handle,
+                                const ConnectOptions&        options,
+                                const ResultCallback&        cb)
+{
+    if (status) {
+        status->reset();
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (options.autoReconnect()) {
+        fail(status, StatusCategory::e_GENERIC_ERROR, "autoReconnect");
+        return;  // RETURN
+    }
+
+    bsl::string path(d_allocator_p);
+    if (ShmChannelFactoryUtil::parseEndpoint(&path, options.endpoint()) !=
+        0) {
+        fail(status, StatusCategory::e_GENERIC_ERROR, "endpoint");
+        return;  // RETURN
+    }
+
+    if (!d_isRunning) {
+        fail(status, StatusCategory::e_GENERIC_ERROR, "state");
+        return;  // RETURN
+    }
+
+    RegistrationSp registration;
+    registration.createInplace(d_allocator_p,
+                               ShmChannelFactory_Registration::e_CONNECTING,
+                               d_nextId.add(1),
+                               -1,
+                               true,
+                               path,
+                               cb,
+                               d_allocator_p);
+
+    if (handle) {
+        handle->load(new (*d_allocator_p)
+                         ShmChannelFactory_OpHandle(this,
+                                                    registration->d_id,
+                                                    d_allocator_p),
+                     d_allocator_p);
+    }
+
+    const int rc = initiateConnection(registration.get(), d_ringSize);
+    if (rc != 0) {
+        // Like for a TCP connection, failing to reach the peer is reported
+        // asynchronously.
+        BALL_LOG_WARN << "Failed to connect to shared memory endpoint '"
+                      << path << "' [rc: " << rc << ", errno: " << errno
+                      << "]";
+        post(bdlf::BindUtil::bind(cb,
+                                  ChannelFactoryEvent::e_CONNECT_FAILED,
+                                  Status(StatusCategory::e_CONNECTION),
+                                  bsl::shared_ptr<Channel>()));
+        return;  // RETURN
+    }
+
+    post(bdlf::BindUtil::bind(&ShmChannelFactory::addRegistration,
+                              this,
+                              registration,
+                              static_cast<int>(EPOLLIN | EPOLLRDHUP)));
+#else
+    (void)handle;
+    (void)options;
+    (void)cb;
+    fail(status, StatusCategory::e_GENERIC_ERROR, "unsupported");
+#endif
+}
+
+bdlmt::SignalerConnection ShmChannelFactory::onCreate(const CreateFn& cb)
+{
+    return d_createSignaler.connect(cb);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,322 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQIO_SHMCHANNELFACTORY
+#define INCLUDED_BMQIO_SHMCHANNELFACTORY
+
+//@PURPOSE: Provide a 'bmqio::ShmChannel' factory for same-host peers.
+//
+//@CLASSES:
+//  bmqio::ShmChannelFactory:     factory of shared memory channels
+//  bmqio::ShmChannelFactoryUtil: utilities for shared memory endpoints
+//
+//@SEE_ALSO:
+//  bmqio_channelfactory
+//  bmqio_shmchannel
+//
+//@DESCRIPTION: This component defines a mechanism,
+// 'bmqio::ShmChannelFactory', that implements the 'bmqio::ChannelFactory'
+// protocol to produce and manage 'bmqio::ShmChannel' objects, exchanging data
+// with a peer process running on the same host through shared memory rings
+// rather than through the network stack.
+//
+// The endpoint of a listen or connect operation is the path of a Unix domain
+// socket, optionally prefixed with the 'shm://' scheme (for example
+// 'shm:///var/run/bmq/broker.shm').  The socket is only used as a rendezvous
+// point and to detect the termination of a peer: the connecting side creates
+// the shared memory segment of the channel and its two 'eventfd' descriptors,
+// and passes them to the listening side over the socket, which acknowledges
+// once it mapped the segment.  No data flows through the socket afterwards.
+// The URI of the peer of a channel has the form 'shm://<path>#<pid>'.
+//
+// All channels of a factory are driven by a single event thread, which
+// invokes the read, close and watermark callbacks of the channels as well as
+// the result callbacks of the operations.
+//
+// This component is only supported on Linux: 'start' fails on other
+// platforms.
+//
+/// Thread Safety
+///-------------
+// Thread safe.
+
+#include <bmqio_channelfactory.h>
+#include <bmqio_connectoptions.h>
+#include <bmqio_listenoptions.h>
+#include <bmqio_shmchannel.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlmt_signaler.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+#include <bslma_managedptr.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+#include <bslstl_stringref.h>
+
+namespace BloombergLP {
+namespace bmqio {
+
+// FORWARD DECLARATION
+class ShmChannelFactory_OpHandle;
+struct ShmChannelFactory_Registration;
+
+// ============================
+// struct ShmChannelFactoryUtil
+// ============================
+
+/// Utilities for the endpoints of a `ShmChannelFactory`.
+struct ShmChannelFactoryUtil {
+    // CLASS METHODS
+
+    /// Return true if the specified `uri` uses the `shm://` scheme, and
+    /// false otherwise.
+    static bool isShmUri(const bslstl::StringRef& uri);
+
+    /// Load into the specified `path` the path of the socket designated by
+    /// the specified `endpoint`, with or without the `shm://` scheme.
+    /// Return 0 on success, or a non-zero value if `endpoint` does not
+    /// designate a path.
+    static int parseEndpoint(bsl::string*             path,
+                             const bslstl::StringRef& endpoint);
+
+    /// Return the URI of a peer having the specified `pid`, connected
+    /// through the socket at the specified `path`.
+    static bsl::string peerUri(const bsl::string& path,
+                               int                pid,
+                               bslma::Allocator*  basicAllocator = 0);
+};
+
+// =======================
+// class ShmChannelFactory
+// =======================
+
+/// Factory of channels exchanging data through shared memory.
+class ShmChannelFactory : public ChannelFactory {
+  public:
+    // TYPES
+
+    /// This typedef defines the signature of a function invoked when a
+    /// channel has been created, before it is reported to the result
+    /// callback of its operation.
+    typedef void CreateFnType(const bsl::shared_ptr<ShmChannel>& channel);
+
+    /// This typedef defines a function invoked when a channel has been
+    /// created.
+    typedef bsl::function<CreateFnType> CreateFn;
+
+    // PUBLIC CONSTANTS
+    enum {
+        /// Default size of the data of each ring of a channel.
+        k_DEFAULT_RING_SIZE = 4 * 1024 * 1024,
+
+        /// Resolution, in milliseconds, of the timeouts of reads.
+        k_TIMER_RESOLUTION_MS = 10
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::shared_ptr<ShmChannelFactory_Registration> RegistrationSp;
+
+    /// Registrations of the event thread, keyed by their identifier.
+    typedef bsl::unordered_map<bsls::Types::Uint64, RegistrationSp>
+        RegistrationMap;
+
+    typedef bsl::function<void()> Callback;
+
+    typedef bsl::vector<Callback> CallbackQueue;
+
+    // FRIENDS
+    friend class ShmChannelFactory_OpHandle;
+
+    // DATA
+    bdlbb::BlobBufferFactory* d_blobBufferFactory_p;
+
+    /// Size of the data of each ring of the channels this factory creates.
+    int d_ringSize;
+
+    int d_lowWatermark;
+
+    int d_highWatermark;
+
+    /// Descriptor of the epoll instance of the event thread.
+    int d_epollFd;
+
+    /// Event descriptor waking up the event thread to run posted callbacks.
+    int d_controlFd;
+
+    bslmt::ThreadUtil::Handle d_threadHandle;
+
+    /// True while the event thread is running and accepting callbacks.
+    bsls::AtomicBool d_isRunning;
+
+    /// True once the event thread was asked to stop.  Only accessed from the
+    /// event thread.
+    bool d_isStopping;
+
+    /// Mutex protecting `d_callbacks`.
+    bslmt::Mutex d_mutex;
+
+    /// Callbacks posted to the event thread.
+    CallbackQueue d_callbacks;
+
+    /// Only accessed from the event thread.
+    RegistrationMap d_registrations;
+
+    bsls::AtomicUint64 d_nextId;
+
+    /// Number of pending reads with a timeout, across all channels.
+    bsls::AtomicInt d_numTimedReads;
+
+    bdlmt::Signaler<CreateFnType> d_createSignaler;
+
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    // NOT IMPLEMENTED
+    ShmChannelFactory(const ShmChannelFactory&) BSLS_KEYWORD_DELETED;
+    ShmChannelFactory&
+    operator=(const ShmChannelFactory&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Invoke the specified `callback` from the event thread.  Return 0 on
+    /// success, or a non-zero value if the event thread is not running.
+    int post(const Callback& callback);
+
+    /// Entry point of the event thread.
+    void eventLoop();
+
+    /// Run the callbacks posted to the event thread.
+    void processCallbacks();
+
+    /// Add the specified `registration` to the event thread, monitoring its
+    /// descriptor for the specified `events`.
+    void addRegistration(const RegistrationSp& registration, int events);
+
+    /// Remove the registration having the specified `id`, if any.
+    void removeRegistration(bsls::Types::Uint64 id);
+
+    /// Remove the registrations having the specified `eventId` and
+    /// `socketId` of a channel which closed with the specified `status`.
+    void removeChannel(const Status&       status,
+                       bsls::Types::Uint64 eventId,
+                       bsls::Types::Uint64 socketId);
+
+    /// Accept the pending connections of the specified listener
+    /// `registration`.
+    void processAccept(const RegistrationSp& registration);
+
+    /// Process the handshake received on the specified `registration` of an
+    /// accepted connection.
+    void processHandshake(const RegistrationSp& registration);
+
+    /// Process the acknowledgment, or the failure, of the connection of the
+    /// specified `registration`.
+    void processConnectAck(const RegistrationSp& registration);
+
+    /// Create a channel as the specified `side` from the resources of the
+    /// specified `registration`, report it to the result callback of the
+    /// registration, and remove the registration.
+    void createChannel(const RegistrationSp& registration,
+                       ShmChannelUtil::Side  side);
+
+    /// Fail the pending reads, of all channels, whose deadline is reached.
+    void processTimeouts();
+
+    /// Cancel all operations and close all channels, and let the event
+    /// thread terminate once all channels are closed.
+    void shutdown();
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ShmChannelFactory,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a factory of channels whose rings hold the specified
+    /// `ringSize` bytes each.  Allocate blob buffers for the data read
+    /// using the specified `blobBufferFactory`, and use the specified
+    /// `lowWatermark` and `highWatermark` for the write queue of the
+    /// channels.  Optionally specify a `basicAllocator` used to supply
+    /// memory.  If `basicAllocator` is 0, the currently installed default
+    /// allocator is used.  The behavior is undefined unless
+    /// `ShmChannelUtil::isValidRingSize(ringSize)`.
+    ShmChannelFactory(bdlbb::BlobBufferFactory* blobBufferFactory,
+                      int                       ringSize,
+                      int                       lowWatermark,
+                      int                       highWatermark,
+                      bslma::Allocator*         basicAllocator = 0);
+
+    /// Destroy this object.  The behavior is undefined unless this factory
+    /// is stopped.
+    ~ShmChannelFactory() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Start the event thread of this factory.  Return 0 on success and a
+    /// non-zero value otherwise.
+    int start() BSLS_KEYWORD_OVERRIDE;
+
+    /// Cancel all operations, close all channels and stop the event thread
+    /// of this factory.  The behavior is undefined if this method is called
+    /// from the event thread.
+    void stop() BSLS_KEYWORD_OVERRIDE;
+
+    /// Listen for connections on the socket at the path designated by the
+    /// endpoint of the specified `options`, and invoke the specified `cb`
+    /// when channels are created.  Load into the optionally-specified
+    /// `handle` a handle that can be used to cancel this operation.
+    /// Populate the optionally-specified `status` with the result of the
+    /// operation.
+    void listen(Status*                      status,
+                bslma::ManagedPtr<OpHandle>* handle,
+                const ListenOptions&         options,
+                const ResultCallback&        cb) BSLS_KEYWORD_OVERRIDE;
+
+    /// Connect to the socket at the path designated by the endpoint of the
+    /// specified `options`, and invoke the specified `cb` when the channel
+    /// is created or the connection fails.  Load into the
+    /// optionally-specified `handle` a handle that can be used to cancel
+    /// this operation.  Populate the optionally-specified `status` with the
+    /// result of the operation.  Note that this factory does not provide
+    /// automatic reconnection: the operation fails immediately if
+    /// `options.autoReconnect()` is true.
+    void connect(Status*                      status,
+                 bslma::ManagedPtr<OpHandle>* handle,
+                 const ConnectOptions&        options,
+                 const ResultCallback&        cb) BSLS_KEYWORD_OVERRIDE;
+
+    /// Register the specified `cb` to be invoked when a channel is
+    /// created.  Return a `bdlmt::SignalerConnection` object than can be
+    /// used to unregister the callback.
+    bdlmt::SignalerConnection onCreate(const CreateFn& cb);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
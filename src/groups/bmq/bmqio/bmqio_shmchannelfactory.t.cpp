@@ -0,0 +1,1086 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqio_shmchannelfactory.h>
+
+// BMQ
+#include <bmqio_ntcchannelfactory.h>
+
+// BDE
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bsla_annotations.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+// NTF
+#include <ntca_interfaceconfig.h>
+
+// SYSTEM
+#include <unistd.h>
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+const int k_BUFFER_SIZE = 4096;
+
+const int k_LOW_WATERMARK = 1024 * 1024;
+
+const int k_HIGH_WATERMARK = 64 * 1024 * 1024;
+
+/// Return a path, unique to this process, for the socket of a listener.
+bsl::string socketPath(bslma::Allocator* allocator)
+{
+    bsl::string path("/tmp/bmqio_shmchannelfactory.t.", allocator);
+    path.append(bsl::to_string(static_cast<int>(::getpid())));
+    path.append(".sock");
+    return path;
+}
+
+/// Result callback of a listen or connect operation: load the `channel` of
+/// the specified `event` into the specified `result`, the `event` into the
+/// specified `resultEvent`, and post on the specified `semaphore`.
+void onChannelResult(bslmt::Semaphore*                      semaphore,
+                     bsl::shared_ptr<bmqio::Channel>*       result,
+                     bmqio::ChannelFactoryEvent::Enum*      resultEvent,
+                     bmqio::ChannelFactoryEvent::Enum       event,
+                     BSLA_UNUSED const bmqio::Status&       status,
+                     const bsl::shared_ptr<bmqio::Channel>& channel)
+{
+    *result      = channel;
+    *resultEvent = event;
+    semaphore->post();
+}
+
+/// Read callback consuming the specified `numBytes` into the specified
+/// `received` string and posting on the specified `semaphore`.  Load the
+/// status category into the specified `category`.
+void onRead(bslmt::Semaphore*            semaphore,
+            bsl::string*                 received,
+            bmqio::StatusCategory::Enum* category,
+            int                          numBytes,
+            const bmqio::Status&         status,
+            int*                         numNeeded,
+            bdlbb::Blob*                 blob)
+{
+    *category = status.category();
+    if (status) {
+        bsl::vector<char> data(numBytes);
+        bdlbb::BlobUtil::copy(data.data(), *blob, 0, numBytes);
+        bdlbb::BlobUtil::erase(blob, 0, numBytes);
+        received->assign(data.begin(), data.end());
+        *numNeeded = 0;
+    }
+    semaphore->post();
+}
+
+/// Close callback posting on the specified `semaphore`.
+void onClose(bslmt::Semaphore* semaphore, BSLA_UNUSED const bmqio::Status&)
+{
+    semaphore->post();
+}
+
+/// Load into the specified `blob` the specified `payload`.
+void makeBlob(bdlbb::Blob* blob, const bsl::string& payload)
+{
+    bdlbb::BlobUtil::append(blob,
+                            payload.data(),
+                            static_cast<int>(payload.length()));
+}
+
+/// Return a payload of the specified `size`.
+bsl::string makePayload(int size, bslma::Allocator* allocator)
+{
+    bsl::string payload(allocator);
+    for (int i = 0; i < size; ++i) {
+        payload.push_back(static_cast<char>('a' + (i % 26)));
+    }
+    return payload;
+}
+
+/// Pair of channels connected to each other.
+struct ChannelPair {
+    bsl::shared_ptr<bmqio::Channel> d_client;
+
+    bsl::shared_ptr<bmqio::Channel> d_server;
+
+    bslma::ManagedPtr<bmqio::ChannelFactoryOperationHandle> d_listenHandle;
+};
+
+/// Listen on the specified `endpoint` with the specified `factory` and
+/// connect to it, loading the resulting channels into the specified `pair`.
+/// If the specified `isTcp` is true, connect to the port the listener is
+/// bound to.
+void connectPair(ChannelPair*           pair,
+                 bmqio::ChannelFactory* factory,
+                 const bsl::string&     endpoint,
+                 bool                   isTcp,
+                 bslma::Allocator*      allocator)
+{
+    bslmt::Semaphore                 listenSemaphore;
+    bslmt::Semaphore                 connectSemaphore;
+    bmqio::ChannelFactoryEvent::Enum listenEvent;
+    bmqio::ChannelFactoryEvent::Enum connectEvent;
+
+    bmqio::Status        status(allocator);
+    bmqio::ListenOptions listenOptions(allocator);
+    listenOptions.setEndpoint(endpoint);
+    factory->listen(&status,
+                    &pair->d_listenHandle,
+                    listenOptions,
+                    bdlf::BindUtil::bind(&onChannelResult,
+                                         &listenSemaphore,
+                                         &pair->d_server,
+                                         &listenEvent,
+                                         bdlf::PlaceHolders::_1,
+                                         bdlf::PlaceHolders::_2,
+                                         bdlf::PlaceHolders::_3));
+    BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
+
+    bmqio::ConnectOptions connectOptions(allocator);
+    connectOptions.setEndpoint(endpoint);
+    if (isTcp) {
+        int port = 0;
+        pair->d_listenHandle->properties().load(
+            &port,
+            bmqio::NtcChannelFactoryUtil::listenPortProperty());
+        connectOptions.setEndpoint("127.0.0.1:" + bsl::to_string(port));
+    }
+
+    factory->connect(&status,
+                     0,
+                     connectOptions,
+                     bdlf::BindUtil::bind(&onChannelResult,
+                                          &connectSemaphore,
+                                          &pair->d_client,
+                                          &connectEvent,
+                                          bdlf::PlaceHolders::_1,
+                                          bdlf::PlaceHolders::_2,
+                                          bdlf::PlaceHolders::_3));
+    BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
+
+    listenSemaphore.wait();
+    connectSemaphore.wait();
+    BMQTST_ASSERT_EQ(listenEvent, bmqio::ChannelFactoryEvent::e_CHANNEL_UP);
+    BMQTST_ASSERT_EQ(connectEvent, bmqio::ChannelFactoryEvent::e_CHANNEL_UP);
+}
+
+/// Write the specified `blob` to the specified `channel`, retrying while
+/// its write queue is full.
+void writeBlob(bmqio::Channel* channel, const bdlbb::Blob& blob)
+{
+    bmqio::Status status;
+    while (true) {
+        channel->write(&status, blob);
+        if (status.category() != bmqio::StatusCategory::e_LIMIT) {
+            break;  // BREAK
+        }
+        bslmt::ThreadUtil::yield();
+    }
+    BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
+}
+
+/// Read callback of the echo side of a ping-pong: write back to the
+/// specified `channel` all the data read.
+void onEchoRead(bmqio::Channel*      channel,
+                const bmqio::Status& status,
+                int*                 numNeeded,
+                bdlbb::Blob*         blob)
+{
+    if (!status) {
+        return;  // RETURN
+    }
+
+    bdlbb::Blob reply(*blob);
+    bdlbb::BlobUtil::erase(blob, 0, blob->length());
+    channel->write(0, reply);
+    *numNeeded = 1;
+}
+
+/// Make the server of the specified `pair` echo all the data it reads.
+void startEcho(ChannelPair* pair)
+{
+    bmqio::Status status;
+    pair->d_server->read(&status,
+                         1,
+                         bdlf::BindUtil::bind(&onEchoRead,
+                                              pair->d_server.get(),
+                                              bdlf::PlaceHolders::_1,
+                                              bdlf::PlaceHolders::_2,
+                                              bdlf::PlaceHolders::_3));
+    BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
+}
+
+/// Read callback of the sink side of a throughput measurement: consume the
+/// specified `numBytes` and post on the specified `semaphore` once the
+/// specified `remaining` number of messages is read.
+void onSinkRead(bslmt::Semaphore*    semaphore,
+                int*                 remaining,
+                int                  numBytes,
+                const bmqio::Status& status,
+                int*                 numNeeded,
+                bdlbb::Blob*         blob)
+{
+    if (!status) {
+        return;  // RETURN
+    }
+
+    bdlbb::BlobUtil::erase(blob, 0, numBytes);
+    *numNeeded = numBytes;
+    if (--(*remaining) == 0) {
+        semaphore->post();
+        *numNeeded = 0;
+    }
+}
+
+/// Return the average round trip time, in nanoseconds, of the specified
+/// `numIterations` messages of the specified `size` between the channels of
+/// the specified `pair`, whose server echoes the data it reads.
+bsls::Types::Int64 pingPong(ChannelPair*      pair,
+                            int               size,
+                            int               numIterations,
+                            bslma::Allocator* allocator)
+{
+    bdlbb::PooledBlobBufferFactory blobFactory(k_BUFFER_SIZE, allocator);
+    bdlbb::Blob                    blob(&blobFactory, allocator);
+    makeBlob(&blob, makePayload(size, allocator));
+
+    bmqio::Status               status(allocator);
+    bslmt::Semaphore            semaphore;
+    bsl::string                 received(allocator);
+    bmqio::StatusCategory::Enum category;
+
+    const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numIterations; ++i) {
+        pair->d_client->read(&status,
+                             size,
+                             bdlf::BindUtil::bind(&onRead,
+                                                  &semaphore,
+                                                  &received,
+                                                  &category,
+                                                  size,
+                                                  bdlf::PlaceHolders::_1,
+                                                  bdlf::PlaceHolders::_2,
+                                                  bdlf::PlaceHolders::_3));
+        writeBlob(pair->d_client.get(), blob);
+        semaphore.wait();
+    }
+    const bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+    return (end - begin) / numIterations;
+}
+
+/// Return the throughput, in megabytes per second, of the specified
+/// `numMessages` messages of the specified `size` written from the server
+/// to the client of the specified `pair`.
+double throughput(ChannelPair*      pair,
+                  int               size,
+                  int               numMessages,
+                  bslma::Allocator* allocator)
+{
+    bdlbb::PooledBlobBufferFactory blobFactory(k_BUFFER_SIZE, allocator);
+    bdlbb::Blob                    blob(&blobFactory, allocator);
+    makeBlob(&blob, makePayload(size, allocator));
+
+    bslmt::Semaphore semaphore;
+    int              remaining = numMessages;
+    bmqio::Status    status(allocator);
+    pair->d_client->read(&status,
+                         size,
+                         bdlf::BindUtil::bind(&onSinkRead,
+                                              &semaphore,
+                                              &remaining,
+                                              size,
+                                              bdlf::PlaceHolders::_1,
+                                              bdlf::PlaceHolders::_2,
+                                              bdlf::PlaceHolders::_3));
+
+    const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numMessages; ++i) {
+        writeBlob(pair->d_server.get(), blob);
+    }
+    semaphore.wait();
+    const bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+    const double seconds = static_cast<double>(end - begin) / 1.0e9;
+    return static_cast<double>(size) * numMessages / (1024 * 1024) / seconds;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   a) The size of a ring must be a power of 2 of at least the minimum
+//      size.
+//   b) A segment initialized for a ring size is validated for that ring
+//      size, and rejected if its size or its header do not match.
+//   c) Endpoints are parsed with or without the 'shm://' scheme.
+//
+// Testing:
+//   ShmChannelUtil
+//   ShmChannelFactoryUtil
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    // a) Ring sizes
+    BMQTST_ASSERT(bmqio::ShmChannelUtil::isValidRingSize(4096));
+    BMQTST_ASSERT(bmqio::ShmChannelUtil::isValidRingSize(1024 * 1024));
+    BMQTST_ASSERT(!bmqio::ShmChannelUtil::isValidRingSize(2048));
+    BMQTST_ASSERT(!bmqio::ShmChannelUtil::isValidRingSize(4097));
+    BMQTST_ASSERT(!bmqio::ShmChannelUtil::isValidRingSize(-4096));
+
+    // b) Segment
+    const int         ringSize = 4096;
+    const bsl::size_t size     = bmqio::ShmChannelUtil::segmentSize(ringSize);
+    BMQTST_ASSERT_EQ(size,
+                     static_cast<bsl::size_t>(
+                         bmqio::ShmChannelUtil::k_HEADER_SIZE +
+                         2 * ringSize));
+
+    // Use 64-bit words for the alignment of the header
+    bsl::vector<bsls::Types::Uint64> segment(
+        size / sizeof(bsls::Types::Uint64),
+        bmqtst::TestHelperUtil::allocator());
+    bmqio::ShmChannelUtil::initializeSegment(segment.data(), ringSize);
+    BMQTST_ASSERT_EQ(
+        bmqio::ShmChannelUtil::validateSegment(segment.data(), size),
+        ringSize);
+    BMQTST_ASSERT_LT(
+        bmqio::ShmChannelUtil::validateSegment(segment.data(), size - 8),
+        0);
+
+    segment[0] = 0;
+    BMQTST_ASSERT_LT(
+        bmqio::ShmChannelUtil::validateSegment(segment.data(), size),
+        0);
+
+    // c) Endpoints
+    bsl::string path(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT(
+        bmqio::ShmChannelFactoryUtil::isShmUri("shm:///tmp/broker.sock"));
+    BMQTST_ASSERT(
+        !bmqio::ShmChannelFactoryUtil::isShmUri("tcp://localhost:30114"));
+
+    BMQTST_ASSERT_EQ(
+        bmqio::ShmChannelFactoryUtil::parseEndpoint(&path,
+                                                    "shm:///tmp/b.sock"),
+        0);
+    BMQTST_ASSERT_EQ(path, "/tmp/b.sock");
+    BMQTST_ASSERT_EQ(
+        bmqio::ShmChannelFactoryUtil::parseEndpoint(&path, "/tmp/c.sock"),
+        0);
+    BMQTST_ASSERT_EQ(path, "/tmp/c.sock");
+    BMQTST_ASSERT_NE(bmqio::ShmChannelFactoryUtil::parseEndpoint(&path,
+                                                                 "shm://"),
+                     0);
+
+    BMQTST_ASSERT_EQ(
+        bmqio::ShmChannelFactoryUtil::peerUri("/tmp/b.sock",
+                                              1234,
+                                              bmqtst::TestHelperUtil::
+                                                  allocator()),
+        "shm:///tmp/b.sock#1234");
+}
+
+static void test2_loopback()
+// ------------------------------------------------------------------------
+// LOOPBACK
+//
+// Concerns:
+//   a) Connecting to a listener creates a channel on both ends.
+//   b) A blob of several buffers, larger than a ring, written on one end
+//      is received intact on the other end, in both directions.
+//   c) Closing one end closes the other end.
+//   d) Stopping the factory removes the socket of the listener.
+//
+// Plan:
+//   Use small rings so that the data written does not fit in a ring and
+//   goes through the write queue of the channel.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("LOOPBACK");
+
+    // Channels invoke callbacks from the event thread
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    bdlbb::PooledBlobBufferFactory blobFactory(k_BUFFER_SIZE, allocator);
+    bmqio::ShmChannelFactory       factory(&blobFactory,
+                                     bmqio::ShmChannelUtil::k_MIN_RING_SIZE,
+                                     k_LOW_WATERMARK,
+                                     k_HIGH_WATERMARK,
+                                     allocator);
+    BMQTST_ASSERT_EQ(factory.start(), 0);
+
+    const bsl::string path = socketPath(allocator);
+    {
+        // a) Connect
+        ChannelPair pair;
+        connectPair(&pair, &factory, "shm://" + path, false, allocator);
+        BMQTST_ASSERT(bmqio::ShmChannelFactoryUtil::isShmUri(
+            pair.d_client->peerUri()));
+        BMQTST_ASSERT(bmqio::ShmChannelFactoryUtil::isShmUri(
+            pair.d_server->peerUri()));
+
+        // b) Exchange data, in both directions
+        const int         k_PAYLOAD_SIZE = 5 * k_BUFFER_SIZE + 17;
+        const bsl::string payload = makePayload(k_PAYLOAD_SIZE, allocator);
+
+        bmqio::Channel* ends[2] = {pair.d_client.get(), pair.d_server.get()};
+        for (int i = 0; i < 2; ++i) {
+            bmqio::Channel* writer = ends[i];
+            bmqio::Channel* reader = ends[1 - i];
+
+            bslmt::Semaphore            semaphore;
+            bsl::string                 received(allocator);
+            bmqio::StatusCategory::Enum category;
+            bmqio::Status               status(allocator);
+            reader->read(&status,
+                         k_PAYLOAD_SIZE,
+                         bdlf::BindUtil::bind(&onRead,
+                                              &semaphore,
+                                              &received,
+                                              &category,
+                                              k_PAYLOAD_SIZE,
+                                              bdlf::PlaceHolders::_1,
+                                              bdlf::PlaceHolders::_2,
+                                              bdlf::PlaceHolders::_3));
+            BMQTST_ASSERT_EQ(status.category(),
+                             bmqio::StatusCategory::e_SUCCESS);
+
+            bdlbb::Blob blob(&blobFactory, allocator);
+            makeBlob(&blob, payload);
+            BMQTST_ASSERT_GT(blob.numDataBuffers(), 1);
+
+            writer->write(&status, blob);
+            BMQTST_ASSERT_EQ(status.category(),
+                             bmqio::StatusCategory::e_SUCCESS);
+
+            semaphore.wait();
+            BMQTST_ASSERT_EQ(category, bmqio::StatusCategory::e_SUCCESS);
+            BMQTST_ASSERT_EQ(received, payload);
+        }
+
+        // c) Close
+        bslmt::Semaphore closeSemaphore;
+        pair.d_server->onClose(
+            bdlf::BindUtil::bind(&onClose,
+                                 &closeSemaphore,
+                                 bdlf::PlaceHolders::_1));
+        pair.d_client->close();
+        closeSemaphore.wait();
+    }
+
+    // d) Stop
+    factory.stop();
+    BMQTST_ASSERT_NE(::access(path.c_str(), F_OK), 0);
+#else
+    cout << "Shared memory channels are not supported, skipping test" << endl;
+#endif
+}
+
+static void test3_connectFailures()
+// ------------------------------------------------------------------------
+// CONNECT FAILURES
+//
+// Concerns:
+//   a) Requesting automatic reconnection fails immediately.
+//   b) Connecting to a path nobody listens on fails asynchronously.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("CONNECT FAILURES");
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    bdlbb::PooledBlobBufferFactory blobFactory(k_BUFFER_SIZE, allocator);
+    bmqio::ShmChannelFactory       factory(&blobFactory,
+                                     bmqio::ShmChannelUtil::k_MIN_RING_SIZE,
+                                     k_LOW_WATERMARK,
+                                     k_HIGH_WATERMARK,
+                                     allocator);
+    BMQTST_ASSERT_EQ(factory.start(), 0);
+
+    bslmt::Semaphore                 semaphore;
+    bsl::shared_ptr<bmqio::Channel>  channel;
+    bmqio::ChannelFactoryEvent::Enum event;
+    bmqio::ChannelFactory::ResultCallback callback = bdlf::BindUtil::bind(
+        &onChannelResult,
+        &semaphore,
+        &channel,
+        &event,
+        bdlf::PlaceHolders::_1,
+        bdlf::PlaceHolders::_2,
+        bdlf::PlaceHolders::_3);
+
+    bmqio::Status         status(allocator);
+    bmqio::ConnectOptions options(allocator);
+    options.setEndpoint("shm://" + socketPath(allocator));
+
+    // a) Automatic reconnection
+    options.setAutoReconnect(true);
+    factory.connect(&status, 0, options, callback);
+    BMQTST_ASSERT_EQ(status.category(),
+                     bmqio::StatusCategory::e_GENERIC_ERROR);
+
+    // b) Nobody listening
+    options.setAutoReconnect(false);
+    factory.connect(&status, 0, options, callback);
+    BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
+
+    semaphore.wait();
+    BMQTST_ASSERT_EQ(event, bmqio::ChannelFactoryEvent::e_CONNECT_FAILED);
+    BMQTST_ASSERT(!channel);
+
+    factory.stop();
+#else
+    cout << "Shared memory channels are not supported, skipping test" << endl;
+#endif
+}
+
+static void test4_readTimeout()
+// ------------------------------------------------------------------------
+// READ TIMEOUT
+//
+// Concerns:
+//   a) A read with a timeout, for which no data is written, is completed
+//      with a 'e_TIMEOUT' status.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("READ TIMEOUT");
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    bdlbb::PooledBlobBufferFactory blobFactory(k_BUFFER_SIZE, allocator);
+    bmqio::ShmChannelFactory       factory(&blobFactory,
+                                     bmqio::ShmChannelUtil::k_MIN_RING_SIZE,
+                                     k_LOW_WATERMARK,
+                                     k_HIGH_WATERMARK,
+                                     allocator);
+    BMQTST_ASSERT_EQ(factory.start(), 0);
+
+    {
+        ChannelPair pair;
+        connectPair(&pair,
+                    &factory,
+                    "shm://" + socketPath(allocator),
+                    false,
+                    allocator);
+
+        bslmt::Semaphore            semaphore;
+        bsl::string                 received(allocator);
+        bmqio::StatusCategory::Enum category;
+        bmqio::Status               status(allocator);
+        pair.d_server->read(&status,
+                            1,
+                            bdlf::BindUtil::bind(&onRead,
+                                                 &semaphore,
+                                                 &received,
+                                                 &category,
+                                                 1,
+                                                 bdlf::PlaceHolders::_1,
+                                                 bdlf::PlaceHolders::_2,
+                                                 bdlf::PlaceHolders::_3),
+                            bsls::TimeInterval(0, 50 * 1000 * 1000));
+        BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
+
+        semaphore.wait();
+        BMQTST_ASSERT_EQ(category, bmqio::StatusCategory::e_TIMEOUT);
+    }
+
+    factory.stop();
+#else
+    cout << "Shared memory channels are not supported, skipping test" << endl;
+#endif
+}
+
+static void test5_unsealedSegment()
+// ------------------------------------------------------------------------
+// UNSEALED SEGMENT
+//
+// Concerns:
+//   a) A handshake carrying a segment which is not sealed against
+//      shrinking and growing is rejected by the listener, which closes
+//      the connection without acknowledging it.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("UNSEALED SEGMENT");
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    bdlbb::PooledBlobBufferFactory blobFactory(k_BUFFER_SIZE, allocator);
+    bmqio::ShmChannelFactory       factory(&blobFactory,
+                                     bmqio::ShmChannelUtil::k_MIN_RING_SIZE,
+                                     k_LOW_WATERMARK,
+                                     k_HIGH_WATERMARK,
+                                     allocator);
+    BMQTST_ASSERT_EQ(factory.start(), 0);
+
+    const bsl::string path = socketPath(allocator);
+
+    bslmt::Semaphore                 semaphore;
+    bsl::shared_ptr<bmqio::Channel>  channel;
+    bmqio::ChannelFactoryEvent::Enum event;
+    bmqio::Status                    status(allocator);
+    bmqio::ListenOptions             listenOptions(allocator);
+    listenOptions.setEndpoint("shm://" + path);
+    bslma::ManagedPtr<bmqio::ChannelFactoryOperationHandle> listenHandle;
+    factory.listen(&status,
+                   &listenHandle,
+                   listenOptions,
+                   bdlf::BindUtil::bind(&onChannelResult,
+                                        &semaphore,
+                                        &channel,
+                                        &event,
+                                        bdlf::PlaceHolders::_1,
+                                        bdlf::PlaceHolders::_2,
+                                        bdlf::PlaceHolders::_3));
+    BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
+
+    // Craft the handshake of a connector, with a segment which is valid but
+    // not sealed
+    const int         ringSize = bmqio::ShmChannelUtil::k_MIN_RING_SIZE;
+    const bsl::size_t size     = bmqio::ShmChannelUtil::segmentSize(ringSize);
+    const int         memFd    = ::memfd_create("test", MFD_CLOEXEC);
+    BMQTST_ASSERT_GE(memFd, 0);
+    BMQTST_ASSERT_EQ(::ftruncate(memFd, static_cast<off_t>(size)), 0);
+    void* segment = ::mmap(0,
+                           size,
+                           PROT_READ | PROT_WRITE,
+                           MAP_SHARED,
+                           memFd,
+                           0);
+    BMQTST_ASSERT_NE(segment, MAP_FAILED);
+    bmqio::ShmChannelUtil::initializeSegment(segment, ringSize);
+
+    const int fds[3] = {memFd,
+                        ::eventfd(0, EFD_CLOEXEC),
+                        ::eventfd(0, EFD_CLOEXEC)};
+
+    const int socketFd = ::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    sockaddr_un address;
+    bsl::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    bsl::strncpy(address.sun_path,
+                 path.c_str(),
+                 sizeof(address.sun_path) - 1);
+    BMQTST_ASSERT_EQ(::connect(socketFd,
+                               reinterpret_cast<const sockaddr*>(&address),
+                               sizeof(address)),
+                     0);
+
+    // Layout of the handshake: magic ("BMQSHMHI"), version and ring size
+    struct {
+        bsls::Types::Uint64 d_magic;
+        int                 d_version;
+        int                 d_ringSize;
+    } hello = {0x424D5153484D4849ULL, 1, ringSize};
+
+    union {
+        char    d_buffer[CMSG_SPACE(sizeof(fds))];
+        cmsghdr d_align;
+    } control;
+    bsl::memset(&control, 0, sizeof(control));
+
+    iovec iov;
+    iov.iov_base = &hello;
+    iov.iov_len  = sizeof(hello);
+
+    msghdr message;
+    bsl::memset(&message, 0, sizeof(message));
+    message.msg_iov        = &iov;
+    message.msg_iovlen     = 1;
+    message.msg_control    = control.d_buffer;
+    message.msg_controllen = sizeof(control.d_buffer);
+
+    cmsghdr* header    = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type  = SCM_RIGHTS;
+    header->cmsg_len   = CMSG_LEN(sizeof(fds));
+    bsl::memcpy(CMSG_DATA(header), fds, sizeof(fds));
+
+    BMQTST_ASSERT_EQ(::sendmsg(socketFd, &message, MSG_NOSIGNAL),
+                     static_cast<ssize_t>(sizeof(hello)));
+
+    // a) The connection is closed instead of being acknowledged
+    char ack = 0;
+    BMQTST_ASSERT_EQ(::recv(socketFd, &ack, 1, 0), 0);
+    BMQTST_ASSERT(!channel);
+
+    ::close(socketFd);
+    for (int i = 0; i < 3; ++i) {
+        ::close(fds[i]);
+    }
+    ::munmap(segment, size);
+
+    listenHandle->cancel();
+    factory.stop();
+#else
+    cout << "Shared memory channels are not supported, skipping test" << endl;
+#endif
+}
+
+static void test6_invalidRingPositions()
+// ------------------------------------------------------------------------
+// INVALID RING POSITIONS
+//
+// Concerns:
+//   a) A write position published by the peer more than one ring ahead of
+//      the read position closes the channel with an error instead of
+//      reading out of the bounds of the ring.
+//   b) A read position published by the peer ahead of the write position
+//      fails the write and closes the channel with an error.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("INVALID RING POSITIONS");
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    bdlbb::PooledBlobBufferFactory blobFactory(k_BUFFER_SIZE, allocator);
+
+    // Offsets, in the header of a segment, of the write position of the
+    // ring written by the connector, and of the read position of the ring
+    // written by the acceptor: each control block spans 3 cache lines,
+    // following the first cache line of the header.
+    const bsl::size_t k_RING0_WRITE_POSITION = 64;
+    const bsl::size_t k_RING1_READ_POSITION  = 64 + 3 * 64 + 64;
+
+    const int         ringSize = bmqio::ShmChannelUtil::k_MIN_RING_SIZE;
+    const bsl::size_t size     = bmqio::ShmChannelUtil::segmentSize(ringSize);
+
+    for (int concern = 0; concern < 2; ++concern) {
+        // Create a channel on the acceptor side of a segment, the test
+        // playing the connector by writing directly into the segment.
+        void* segment = ::mmap(0,
+                               size,
+                               PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_ANONYMOUS,
+                               -1,
+                               0);
+        BMQTST_ASSERT_NE(segment, MAP_FAILED);
+        bmqio::ShmChannelUtil::initializeSegment(segment, ringSize);
+
+        int sockets[2];
+        BMQTST_ASSERT_EQ(::socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets),
+                         0);
+
+        bsls::AtomicInt                     numTimedReads(0);
+        bsl::shared_ptr<bmqio::ShmChannel> channel;
+        channel.createInplace(allocator,
+                              segment,
+                              size,
+                              bmqio::ShmChannelUtil::e_ACCEPTOR,
+                              ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC),
+                              ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC),
+                              sockets[0],
+                              "test",
+                              &blobFactory,
+                              k_LOW_WATERMARK,
+                              k_HIGH_WATERMARK,
+                              &numTimedReads,
+                              allocator);
+
+        bslmt::Semaphore closeSemaphore;
+        channel->onClose(
+            bdlf::BindUtil::bind(&onClose,
+                                 &closeSemaphore,
+                                 bdlf::PlaceHolders::_1));
+
+        char* const header = static_cast<char*>(segment);
+        if (concern == 0) {
+            // a) Write position beyond the ring
+            *reinterpret_cast<bsls::Types::Uint64*>(
+                header + k_RING0_WRITE_POSITION) = ringSize + 1;
+
+            bslmt::Semaphore            semaphore;
+            bsl::string                 received(allocator);
+            bmqio::StatusCategory::Enum category;
+            bmqio::Status               status(allocator);
+            channel->read(&status,
+                          1,
+                          bdlf::BindUtil::bind(&onRead,
+                                               &semaphore,
+                                               &received,
+                                               &category,
+                                               1,
+                                               bdlf::PlaceHolders::_1,
+                                               bdlf::PlaceHolders::_2,
+                                               bdlf::PlaceHolders::_3));
+            BMQTST_ASSERT_EQ(status.category(),
+                             bmqio::StatusCategory::e_SUCCESS);
+        }
+        else {
+            // b) Read position ahead of the write position
+            *reinterpret_cast<bsls::Types::Uint64*>(
+                header + k_RING1_READ_POSITION) = 1;
+
+            bdlbb::Blob blob(&blobFactory, allocator);
+            makeBlob(&blob, "abc");
+
+            bmqio::Status status(allocator);
+            channel->write(&status, blob);
+            BMQTST_ASSERT_EQ(status.category(),
+                             bmqio::StatusCategory::e_GENERIC_ERROR);
+        }
+
+        // Process the events, as the event thread of a factory would
+        channel->processEvents();
+        BMQTST_ASSERT(closeSemaphore.tryWait() == 0);
+
+        channel.reset();
+        ::close(sockets[1]);
+    }
+#else
+    cout << "Shared memory channels are not supported, skipping test" << endl;
+#endif
+}
+
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+/// Create and start an NTC channel factory over loopback TCP using the
+/// specified `blobFactory`, for comparison with shared memory channels.
+static bsl::shared_ptr<bmqio::NtcChannelFactory>
+createTcpFactory(bdlbb::BlobBufferFactory* blobFactory,
+                 bslma::Allocator*         allocator)
+{
+    ntca::InterfaceConfig config(allocator);
+    config.setThreadName("bench");
+    config.setMinThreads(1);
+    config.setMaxThreads(1);
+    config.setWriteQueueLowWatermark(k_LOW_WATERMARK);
+    config.setWriteQueueHighWatermark(k_HIGH_WATERMARK);
+    config.setDriverMetrics(false);
+    config.setSocketMetrics(false);
+
+    bsl::shared_ptr<bmqio::NtcChannelFactory> factory;
+    factory.createInplace(allocator, config, blobFactory, allocator);
+    BMQTST_ASSERT_EQ(factory->start(), 0);
+    return factory;
+}
+
+static void testN1_performance()
+// ------------------------------------------------------------------------
+// PERFORMANCE
+//
+// Concerns:
+//   Compare the latency and the throughput of shared memory channels with
+//   the ones of channels over loopback TCP.
+//
+// Plan:
+//   For each message size, measure the average round trip time of a
+//   ping-pong, and the throughput of a one-way stream of messages.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PERFORMANCE");
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    bdlbb::PooledBlobBufferFactory blobFactory(k_BUFFER_SIZE, allocator);
+    bmqio::ShmChannelFactory       shmFactory(&blobFactory,
+                                        bmqio::ShmChannelFactory::
+                                            k_DEFAULT_RING_SIZE,
+                                        k_LOW_WATERMARK,
+                                        k_HIGH_WATERMARK,
+                                        allocator);
+    BMQTST_ASSERT_EQ(shmFactory.start(), 0);
+    bsl::shared_ptr<bmqio::NtcChannelFactory> tcpFactory = createTcpFactory(
+        &blobFactory,
+        allocator);
+
+    ChannelPair shmPair;
+    connectPair(&shmPair,
+                &shmFactory,
+                "shm://" + socketPath(allocator),
+                false,
+                allocator);
+    ChannelPair tcpPair;
+    connectPair(&tcpPair, tcpFactory.get(), "127.0.0.1:0", true, allocator);
+    startEcho(&shmPair);
+    startEcho(&tcpPair);
+
+    const int k_NUM_ITERATIONS = 10000;
+    const int k_NUM_MESSAGES   = 100000;
+    const int k_SIZES[]        = {64, 1024, 16 * 1024, 256 * 1024};
+
+    cout << "size\tshm rtt (ns)\ttcp rtt (ns)"
+         << "\tshm (MB/s)\ttcp (MB/s)\n";
+    for (bsl::size_t i = 0; i < sizeof(k_SIZES) / sizeof(*k_SIZES); ++i) {
+        const int size        = k_SIZES[i];
+        const int numMessages = bsl::max(100,
+                                         k_NUM_MESSAGES * 64 / size);
+
+        cout << size << "\t"
+             << pingPong(&shmPair, size, k_NUM_ITERATIONS, allocator)
+             << "\t\t"
+             << pingPong(&tcpPair, size, k_NUM_ITERATIONS, allocator)
+             << "\t\t" << throughput(&shmPair, size, numMessages, allocator)
+             << "\t\t" << throughput(&tcpPair, size, numMessages, allocator)
+             << "\n";
+    }
+
+    shmPair.d_client->close();
+    tcpPair.d_client->close();
+    shmFactory.stop();
+    tcpFactory->stop();
+}
+
+// Begin benchmarking tests
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void benchmarkPingPong(benchmark::State& state, bool isShm)
+{
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    bdlbb::PooledBlobBufferFactory blobFactory(k_BUFFER_SIZE, allocator);
+    bmqio::ShmChannelFactory       shmFactory(&blobFactory,
+                                        bmqio::ShmChannelFactory::
+                                            k_DEFAULT_RING_SIZE,
+                                        k_LOW_WATERMARK,
+                                        k_HIGH_WATERMARK,
+                                        allocator);
+    BMQTST_ASSERT_EQ(shmFactory.start(), 0);
+    bsl::shared_ptr<bmqio::NtcChannelFactory> tcpFactory = createTcpFactory(
+        &blobFactory,
+        allocator);
+
+    ChannelPair pair;
+    if (isShm) {
+        connectPair(&pair,
+                    &shmFactory,
+                    "shm://" + socketPath(allocator),
+                    false,
+                    allocator);
+    }
+    else {
+        connectPair(&pair, tcpFactory.get(), "127.0.0.1:0", true, allocator);
+    }
+    startEcho(&pair);
+
+    for (auto _ : state) {
+        pingPong(&pair, static_cast<int>(state.range(0)), 1000, allocator);
+    }
+
+    pair.d_client->close();
+    shmFactory.stop();
+    tcpFactory->stop();
+}
+
+static void testN1_shmPingPong_GoogleBenchmark(benchmark::State& state)
+{
+    bmqtst::TestHelper::printTestName("SHM PING-PONG GOOGLE BENCHMARK");
+    benchmarkPingPong(state, true);
+}
+
+static void testN1_tcpPingPong_GoogleBenchmark(benchmark::State& state)
+{
+    bmqtst::TestHelper::printTestName("TCP PING-PONG GOOGLE BENCHMARK");
+    benchmarkPingPong(state, false);
+}
+#endif  // BMQTST_BENCHMARK_ENABLED
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 6: test6_invalidRingPositions(); break;
+    case 5: test5_unsealedSegment(); break;
+    case 4: test4_readTimeout(); break;
+    case 3: test3_connectFailures(); break;
+    case 2: test2_loopback(); break;
+    case 1: test1_breathingTest(); break;
+    case -1:
+#ifdef BMQTST_BENCHMARK_ENABLED
+        BENCHMARK(testN1_shmPingPong_GoogleBenchmark)
+            ->RangeMultiplier(16)
+            ->Range(64, 256 * 1024)
+            ->Unit(benchmark::kMillisecond);
+        BENCHMARK(testN1_tcpPingPong_GoogleBenchmark)
+            ->RangeMultiplier(16)
+            ->Range(64, 256 * 1024)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+#else
+        testN1_performance();
+#endif
+        break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -22,7 +22,12 @@
 //@CLASSES:
 //  bmqp::BlobPoolUtil: mechanism to build bdlbb::Blob shared pointer pool.
 //
-//@DESCRIPTION:
+//@DESCRIPTION: 'bmqp::BlobPoolUtil' provides a utility to create pools of
+// shared pointers to 'bdlbb::Blob' objects, using a given blob buffer factory.
+// Pools are typically shared by many threads (IO threads, dispatcher
+// processors, event builders), in which case the blob buffer factory should
+// be a 'bmqp::ThreadCachingBlobBufferFactory', which keeps free blob buffers
+// in per-thread caches instead of a single shared pool.
 //
 
 // BDE
@@ -266,6 +266,8 @@ const char HighAvailabilityFeatures::k_GRACEFUL_SHUTDOWN[] =
     "GRACEFUL_SHUTDOWN";
 const char HighAvailabilityFeatures::k_GRACEFUL_SHUTDOWN_V2[] =
     "GRACEFUL_SHUTDOWN_V2";
+const char HighAvailabilityFeatures::k_CUMULATIVE_CSL_COMMIT[] =
+    "CUMULATIVE_CSL_COMMIT";
 
 // --------------------------------
 // struct MessagePropertiesFeatures
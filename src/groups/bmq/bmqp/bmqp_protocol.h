@@ -642,6 +642,11 @@ struct HighAvailabilityFeatures {
     static const char k_GRACEFUL_SHUTDOWN[];
 
     static const char k_GRACEFUL_SHUTDOWN_V2[];
+
+    /// Cumulative commits of the advisories of the cluster state ledger: a
+    /// commit record commits all the outstanding advisories up to the one it
+    /// refers to.
+    static const char k_CUMULATIVE_CSL_COMMIT[];
 };
 
 /// This struct defines feature names related to MessageProperties
@@ -0,0 +1,342 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqp_threadcachingblobbufferfactory.h>
+
+#include <bmqscm_version.h>
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_memory.h>
+#include <bsl_typeinfo.h>
+#include <bsla_annotations.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_sharedptrrep.h>
+#include <bslmt_lockguard.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_performancehint.h>
+
+namespace BloombergLP {
+namespace bmqp {
+
+namespace {
+
+/// Counter used to assign a cache index to each thread upon its first use of
+/// any factory.
+bsls::AtomicUint s_nextThreadIndex(0);
+
+/// Return the index assigned to the calling thread.
+unsigned int threadIndex()
+{
+    static BSLS_KEYWORD_THREAD_LOCAL unsigned int s_index = 0;
+    static BSLS_KEYWORD_THREAD_LOCAL bool         s_isAssigned = false;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!s_isAssigned)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        s_index      = s_nextThreadIndex.addRelaxed(1) - 1;
+        s_isAssigned = true;
+    }
+
+    return s_index;
+}
+
+/// Return the specified `size` rounded up to the maximum alignment.
+int roundUpToMaxAlignment(int size)
+{
+    return static_cast<int>(bsls::AlignmentUtil::roundUpToMaximalAlignment(
+        static_cast<bsl::size_t>(size)));
+}
+
+}  // close unnamed namespace
+
+// ===============================================
+// class ThreadCachingBlobBufferFactory::BufferRep
+// ===============================================
+
+/// Shared pointer representation of a buffer provided by a
+/// `ThreadCachingBlobBufferFactory`.  It is constructed at the start of the
+/// memory block holding the buffer, and returns that block to the factory
+/// once both the shared and weak reference counts reach zero.
+class ThreadCachingBlobBufferFactory::BufferRep BSLS_KEYWORD_FINAL
+: public bslma::SharedPtrRep {
+  private:
+    // DATA
+    ThreadCachingBlobBufferFactory* d_factory_p;
+
+  public:
+    // CLASS METHODS
+
+    /// Return the offset of the buffer from the start of a memory block.
+    static int headerSize();
+
+    // CREATORS
+
+    /// Create a representation for the buffer following it in memory,
+    /// owned by the specified `factory`.
+    explicit BufferRep(ThreadCachingBlobBufferFactory* factory);
+
+    // MANIPULATORS
+
+    /// Do nothing: the buffer holds plain characters.
+    void disposeObject() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the memory block of this representation to the factory.
+    void disposeRep() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return 0: this representation has no deleter.
+    void* getDeleter(const std::type_info& type) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the address of the buffer.
+    char* buffer();
+
+    // ACCESSORS
+
+    /// Return the address of the buffer.
+    void* originalPtr() const BSLS_KEYWORD_OVERRIDE;
+};
+
+// -----------------------------------------------
+// class ThreadCachingBlobBufferFactory::BufferRep
+// -----------------------------------------------
+
+// CLASS METHODS
+int ThreadCachingBlobBufferFactory::BufferRep::headerSize()
+{
+    return roundUpToMaxAlignment(static_cast<int>(
+        bsl::max<bsl::size_t>(sizeof(BufferRep), sizeof(FreeBlock))));
+}
+
+// CREATORS
+ThreadCachingBlobBufferFactory::BufferRep::BufferRep(
+    ThreadCachingBlobBufferFactory* factory)
+: bslma::SharedPtrRep()
+, d_factory_p(factory)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+void ThreadCachingBlobBufferFactory::BufferRep::disposeObject()
+{
+    // NOTHING
+}
+
+void ThreadCachingBlobBufferFactory::BufferRep::disposeRep()
+{
+    // The block is reused as a 'FreeBlock' from now on, this object is never
+    // used again.
+    d_factory_p->releaseBlock(this);
+}
+
+void* ThreadCachingBlobBufferFactory::BufferRep::getDeleter(
+    BSLA_UNUSED const std::type_info& type)
+{
+    return 0;
+}
+
+char* ThreadCachingBlobBufferFactory::BufferRep::buffer()
+{
+    return reinterpret_cast<char*>(this) + headerSize();
+}
+
+// ACCESSORS
+void* ThreadCachingBlobBufferFactory::BufferRep::originalPtr() const
+{
+    return const_cast<char*>(reinterpret_cast<const char*>(this)) +
+           headerSize();
+}
+
+// -------------------------------------------
+// struct ThreadCachingBlobBufferFactory::Cache
+// -------------------------------------------
+
+ThreadCachingBlobBufferFactory::Cache::Cache()
+: d_lock()
+, d_head_p(0)
+, d_numBlocks(0)
+{
+    // NOTHING
+}
+
+// ------------------------------------
+// class ThreadCachingBlobBufferFactory
+// ------------------------------------
+
+// PRIVATE MANIPULATORS
+ThreadCachingBlobBufferFactory::Cache&
+ThreadCachingBlobBufferFactory::currentCache()
+{
+    return d_caches[threadIndex() & (k_NUM_CACHES - 1)];
+}
+
+ThreadCachingBlobBufferFactory::FreeBlock*
+ThreadCachingBlobBufferFactory::acquireBatch()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_globalMutex);  // LOCK
+
+    if (d_batches_p == 0) {
+        // Global pool is empty, grow it by one batch.
+        char* slab = static_cast<char*>(
+            d_allocator_p->allocate(k_BATCH_SIZE * d_blockSize));
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(slab,
+                                                            d_allocator_p);
+        d_slabs.push_back(slab);
+        proctor.release();
+
+        FreeBlock* block = 0;
+        for (int i = k_BATCH_SIZE - 1; i >= 0; --i) {
+            FreeBlock* current = reinterpret_cast<FreeBlock*>(
+                slab + i * d_blockSize);
+            current->d_next_p      = block;
+            current->d_nextBatch_p = 0;
+            block                  = current;
+        }
+
+        d_batches_p = block;
+    }
+
+    FreeBlock* batch = d_batches_p;
+    d_batches_p      = batch->d_nextBatch_p;
+    return batch;
+}
+
+void ThreadCachingBlobBufferFactory::releaseBatch(FreeBlock* batch)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(batch);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_globalMutex);  // LOCK
+
+    batch->d_nextBatch_p = d_batches_p;
+    d_batches_p          = batch;
+}
+
+void ThreadCachingBlobBufferFactory::releaseBlock(void* address)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(address);
+
+    FreeBlock* block = static_cast<FreeBlock*>(address);
+    FreeBlock* batch = 0;
+    Cache&     cache = currentCache();
+
+    {
+        bsls::SpinLockGuard guard(&cache.d_lock);  // LOCK
+
+        block->d_next_p = cache.d_head_p;
+        cache.d_head_p  = block;
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(++cache.d_numBlocks >=
+                                                  k_MAX_CACHED_BUFFERS)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            // Cache is full, detach a batch to return to the global pool.
+            batch           = cache.d_head_p;
+            FreeBlock* tail = batch;
+            for (int i = 1; i < k_BATCH_SIZE; ++i) {
+                tail = tail->d_next_p;
+            }
+            cache.d_head_p = tail->d_next_p;
+            tail->d_next_p = 0;
+            cache.d_numBlocks -= k_BATCH_SIZE;
+        }
+    }  // UNLOCK
+
+    if (batch) {
+        releaseBatch(batch);
+    }
+}
+
+// CREATORS
+ThreadCachingBlobBufferFactory::ThreadCachingBlobBufferFactory(
+    int               bufferSize,
+    bslma::Allocator* allocator)
+: d_allocator_p(bslma::Default::allocator(allocator))
+, d_bufferSize(bufferSize)
+, d_blockSize(BufferRep::headerSize() + roundUpToMaxAlignment(bufferSize))
+, d_globalMutex()
+, d_batches_p(0)
+, d_slabs(d_allocator_p)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 < bufferSize);
+}
+
+ThreadCachingBlobBufferFactory::~ThreadCachingBlobBufferFactory()
+{
+    for (bsl::vector<void*>::iterator it = d_slabs.begin();
+         it != d_slabs.end();
+         ++it) {
+        d_allocator_p->deallocate(*it);
+    }
+}
+
+// MANIPULATORS
+void ThreadCachingBlobBufferFactory::allocate(bdlbb::BlobBuffer* buffer)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(buffer);
+
+    Cache&     cache = currentCache();
+    FreeBlock* block = 0;
+
+    {
+        bsls::SpinLockGuard guard(&cache.d_lock);  // LOCK
+
+        block = cache.d_head_p;
+        if (block) {
+            cache.d_head_p = block->d_next_p;
+            --cache.d_numBlocks;
+        }
+    }  // UNLOCK
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(block == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Cache is empty, refill it with a batch from the global pool and
+        // keep the first block of that batch for this allocation.
+        block                = acquireBatch();
+        FreeBlock* remaining = block->d_next_p;
+        FreeBlock* tail      = remaining;
+        int        count     = 1;
+        while (tail->d_next_p) {
+            tail = tail->d_next_p;
+            ++count;
+        }
+
+        bsls::SpinLockGuard guard(&cache.d_lock);  // LOCK
+        tail->d_next_p = cache.d_head_p;
+        cache.d_head_p = remaining;
+        cache.d_numBlocks += count;
+    }
+
+    BufferRep* rep = new (block) BufferRep(this);
+    buffer->reset(bsl::shared_ptr<char>(rep->buffer(), rep), d_bufferSize);
+}
+
+// ACCESSORS
+int ThreadCachingBlobBufferFactory::numAllocatedBuffers() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_globalMutex);  // LOCK
+
+    return static_cast<int>(d_slabs.size()) * k_BATCH_SIZE;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
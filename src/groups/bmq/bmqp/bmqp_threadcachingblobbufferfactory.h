@@ -0,0 +1,239 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQP_THREADCACHINGBLOBBUFFERFACTORY
+#define INCLUDED_BMQP_THREADCACHINGBLOBBUFFERFACTORY
+
+//@PURPOSE: Provide a blob buffer factory caching free buffers per thread.
+//
+//@CLASSES:
+//  bmqp::ThreadCachingBlobBufferFactory: thread-caching blob buffer factory
+//
+//@DESCRIPTION: 'bmqp::ThreadCachingBlobBufferFactory' is a concrete
+// implementation of 'bdlbb::BlobBufferFactory' that provides fixed-size blob
+// buffers, like 'bdlbb::PooledBlobBufferFactory', but is designed to be
+// shared by many threads allocating and releasing buffers concurrently (IO
+// threads, dispatcher processors, event builders, ...).
+//
+// Free buffers are kept in a set of small caches, and each thread uses its own
+// cache (threads are assigned a cache in a round-robin fashion upon their
+// first use of any factory, so that threads only share a cache when there are
+// more of them than caches).  Allocating a buffer pops it from the cache of
+// the calling thread and releasing a buffer (which happens when the last
+// reference to it goes away, on whichever thread that is) pushes it to the
+// cache of the releasing thread.  Buffers move between the caches and a
+// global pool in batches: an empty cache is refilled with a batch from the
+// global pool, and a cache holding too many buffers returns a batch to it.
+// The global pool therefore sees one lock acquisition per batch of buffers,
+// and the underlying allocator is only used to grow the global pool by one
+// batch at a time.
+//
+// The memory for the shared pointer representation of a buffer is allocated
+// together with the buffer, so that providing a buffer does not require any
+// other allocation.  Like 'bdlbb::PooledBlobBufferFactory', memory is never
+// returned to the allocator until the factory is destroyed.
+//
+/// Thread Safety
+///-------------
+// Thread safe.
+//
+/// Usage
+///-----
+//..
+//  bmqp::ThreadCachingBlobBufferFactory bufferFactory(4096, allocator);
+//  bmqp::BlobPoolUtil::BlobSpPoolSp     blobSpPool(
+//           bmqp::BlobPoolUtil::createBlobPool(&bufferFactory, allocator));
+//
+//  bsl::shared_ptr<bdlbb::Blob> blob = blobSpPool->getObject();
+//  blob->setLength(10000);  // Uses 3 buffers from 'bufferFactory'
+//..
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+#include <bsls_keyword.h>
+#include <bsls_spinlock.h>
+
+namespace BloombergLP {
+namespace bmqp {
+
+// ====================================
+// class ThreadCachingBlobBufferFactory
+// ====================================
+
+/// Blob buffer factory caching free buffers per thread.
+class ThreadCachingBlobBufferFactory BSLS_KEYWORD_FINAL
+: public bdlbb::BlobBufferFactory {
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        /// Number of buffers moved at once between a thread cache and the
+        /// global pool.
+        k_BATCH_SIZE = 32,
+
+        /// Maximum number of free buffers held by a thread cache; releasing
+        /// a buffer into a full cache returns a batch to the global pool.
+        k_MAX_CACHED_BUFFERS = 2 * k_BATCH_SIZE,
+
+        /// Number of thread caches (must be a power of 2).
+        k_NUM_CACHES = 64
+    };
+
+  private:
+    // PRIVATE CONSTANTS
+    enum { k_CACHE_LINE_SIZE = 64 };
+
+    // PRIVATE TYPES
+
+    /// Shared pointer representation of a buffer in use, laid out at the
+    /// start of the memory block of the buffer.
+    class BufferRep;
+    friend class BufferRep;
+
+    /// Header of a free memory block, laid out at the start of the block.
+    struct FreeBlock {
+        /// Next free block in the same cache or batch.
+        FreeBlock* d_next_p;
+
+        /// First block of the next batch in the global pool (only meaningful
+        /// for the first block of a batch in the global pool).
+        FreeBlock* d_nextBatch_p;
+    };
+
+    /// Cache of free blocks used by the threads assigned to it.  Padded so
+    /// that caches used by different threads do not share a cache line.
+    struct Cache {
+        /// Lock protecting this cache.  It is only contended when more threads
+        /// than caches are using the factory.
+        bsls::SpinLock d_lock;
+
+        /// List of free blocks in this cache.
+        FreeBlock* d_head_p;
+
+        /// Number of blocks in the `d_head_p` list.
+        int d_numBlocks;
+
+        char d_padding[k_CACHE_LINE_SIZE];
+
+        // CREATORS
+        Cache();
+    };
+
+    // DATA
+
+    /// Allocator used to grow the global pool.
+    bslma::Allocator* d_allocator_p;
+
+    /// Size of the buffers provided by this factory.
+    int d_bufferSize;
+
+    /// Size of a memory block: the buffer representation header followed by
+    /// the buffer.
+    int d_blockSize;
+
+    /// Thread caches of free blocks.
+    Cache d_caches[k_NUM_CACHES];
+
+    /// Mutex protecting the global pool and `d_slabs`.
+    mutable bslmt::Mutex d_globalMutex;
+
+    /// Global pool: stack of batches of `k_BATCH_SIZE` free blocks each.
+    FreeBlock* d_batches_p;
+
+    /// Memory slabs allocated from `d_allocator_p`, each holding
+    /// `k_BATCH_SIZE` blocks.
+    bsl::vector<void*> d_slabs;
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingBlobBufferFactory(const ThreadCachingBlobBufferFactory&)
+        BSLS_KEYWORD_DELETED;
+    ThreadCachingBlobBufferFactory&
+    operator=(const ThreadCachingBlobBufferFactory&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Return the cache assigned to the calling thread.
+    Cache& currentCache();
+
+    /// Return the first block of a batch of `k_BATCH_SIZE` free blocks taken
+    /// from the global pool, growing the global pool if it is empty.
+    FreeBlock* acquireBatch();
+
+    /// Return the specified `batch` of `k_BATCH_SIZE` free blocks to the
+    /// global pool.
+    void releaseBatch(FreeBlock* batch);
+
+    /// Return the block at the specified `address`, which is no longer in
+    /// use, to the cache of the calling thread.
+    void releaseBlock(void* address);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ThreadCachingBlobBufferFactory,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a factory providing blob buffers of the specified
+    /// `bufferSize`.  Use the optionally specified `allocator` to supply
+    /// memory.  The behavior is undefined unless `0 < bufferSize`.
+    explicit ThreadCachingBlobBufferFactory(int               bufferSize,
+                                            bslma::Allocator* allocator = 0);
+
+    /// Destroy this object and release all the memory it allocated.  The
+    /// behavior is undefined unless all the buffers provided by this factory
+    /// have been released.
+    ~ThreadCachingBlobBufferFactory() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Allocate a blob buffer from this factory and load it into the
+    /// specified `buffer`.
+    void allocate(bdlbb::BlobBuffer* buffer) BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+
+    /// Return the size of the buffers provided by this factory.
+    int bufferSize() const;
+
+    /// Return the number of buffers this factory has allocated memory for,
+    /// whether they are currently in use or free.
+    int numAllocatedBuffers() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ------------------------------------
+// class ThreadCachingBlobBufferFactory
+// ------------------------------------
+
+// ACCESSORS
+inline int ThreadCachingBlobBufferFactory::bufferSize() const
+{
+    return d_bufferSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,511 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqp_threadcachingblobbufferfactory.h>
+
+// BMQ
+#include <bmqp_ackeventbuilder.h>
+#include <bmqp_blobpoolutil.h>
+#include <bmqt_messageguid.h>
+
+#include <bmqu_printutil.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bdlf_bind.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef bmqp::ThreadCachingBlobBufferFactory Obj;
+
+/// Thread function: wait on the specified `barrier`, then repeatedly
+/// allocate a blob of a few buffers from the specified `blobSpPool`, fill it
+/// with the specified `pattern`, yield, and verify its content, for the
+/// specified `numIterations`.  Set the specified `failed` to true if any
+/// content verification failed.
+void fillAndVerifyThread(bmqp::BlobPoolUtil::BlobSpPool* blobSpPool,
+                         bslmt::Barrier*                 barrier,
+                         char                            pattern,
+                         int                             numIterations,
+                         bool*                           failed)
+{
+    barrier->wait();
+
+    for (int i = 0; i < numIterations; ++i) {
+        bsl::shared_ptr<bdlbb::Blob> blob = blobSpPool->getObject();
+        blob->setLength(1 + (i % 5) * 1000);
+
+        for (int b = 0; b < blob->numDataBuffers(); ++b) {
+            bsl::memset(blob->buffer(b).data(),
+                        pattern,
+                        blob->buffer(b).size());
+        }
+
+        bslmt::ThreadUtil::yield();
+
+        for (int b = 0; b < blob->numDataBuffers(); ++b) {
+            const char* data = blob->buffer(b).data();
+            for (int j = 0; j < blob->buffer(b).size(); ++j) {
+                if (data[j] != pattern) {
+                    *failed = true;
+                }
+            }
+        }
+    }
+}
+
+/// Thread function: wait on the specified `barrier`, then release all the
+/// specified `buffers`.
+void releaseThread(bsl::vector<bdlbb::BlobBuffer>* buffers,
+                   bslmt::Barrier*                 barrier)
+{
+    barrier->wait();
+    buffers->clear();
+}
+
+/// Thread function: wait on the specified `barrier`, then build the
+/// specified `numEvents` ACK events of the specified `numMessages` messages
+/// each, using the specified `blobSpPool`.  Each event blob is released
+/// right after being built.
+void buildEventsThread(bmqp::BlobPoolUtil::BlobSpPool* blobSpPool,
+                       bslmt::Barrier*                 barrier,
+                       int                             numEvents,
+                       int                             numMessages)
+{
+    bmqp::AckEventBuilder builder(blobSpPool,
+                                  bmqtst::TestHelperUtil::allocator());
+
+    barrier->wait();
+
+    for (int i = 0; i < numEvents; ++i) {
+        for (int j = 0; j < numMessages; ++j) {
+            builder.appendMessage(0, j, bmqt::MessageGUID(), i);
+        }
+        {
+            // Simulate the event being handed over to the IO layer.
+            bsl::shared_ptr<bdlbb::Blob> blob = builder.blob();
+            builder.reset();
+        }
+    }
+}
+
+/// Build the specified `numEvents` ACK events of the specified `numMessages`
+/// messages each, from each of the specified `numThreads` threads
+/// concurrently, all using blobs built from the specified `bufferFactory`.
+/// Return the time (in nanoseconds) it took.
+bsls::Types::Int64 buildEvents(bdlbb::BlobBufferFactory* bufferFactory,
+                               int                       numThreads,
+                               int                       numEvents,
+                               int                       numMessages)
+{
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+
+    bslmt::ThreadGroup threadGroup(bmqtst::TestHelperUtil::allocator());
+
+    // `+1` for this (main) thread
+    bslmt::Barrier barrier(numThreads + 1);
+
+    for (int i = 0; i < numThreads; ++i) {
+        int rc = threadGroup.addThread(
+            bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                  &buildEventsThread,
+                                  blobSpPool.get(),
+                                  &barrier,
+                                  numEvents,
+                                  numMessages));
+        BSLS_ASSERT_OPT(rc == 0);
+    }
+
+    const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+    barrier.wait();
+    threadGroup.joinAll();
+    return bsls::TimeUtil::getTimer() - begin;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Testing:
+//   Basic functionality
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    const int k_BUFFER_SIZE = 1000;
+
+    Obj obj(k_BUFFER_SIZE, bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(obj.bufferSize(), k_BUFFER_SIZE);
+    BMQTST_ASSERT_EQ(obj.numAllocatedBuffers(), 0);
+
+    {
+        bdlbb::BlobBuffer buffer;
+        obj.allocate(&buffer);
+
+        BMQTST_ASSERT_EQ(buffer.size(), k_BUFFER_SIZE);
+        BMQTST_ASSERT(buffer.data() != 0);
+        BMQTST_ASSERT_EQ(
+            0,
+            reinterpret_cast<bsls::Types::UintPtr>(buffer.data()) %
+                bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+        BMQTST_ASSERT_EQ(obj.numAllocatedBuffers(), Obj::k_BATCH_SIZE);
+
+        // Ensure the whole buffer is usable
+        bsl::memset(buffer.data(), 'x', buffer.size());
+
+        // Copies share the buffer
+        bdlbb::BlobBuffer copy(buffer);
+        BMQTST_ASSERT_EQ(copy.data(), buffer.data());
+    }
+
+    // Released buffer is reused
+    bdlbb::BlobBuffer buffer;
+    obj.allocate(&buffer);
+    BMQTST_ASSERT_EQ(obj.numAllocatedBuffers(), Obj::k_BATCH_SIZE);
+}
+
+static void test2_reuseAcrossBatches()
+// ------------------------------------------------------------------------
+// REUSE ACROSS BATCHES
+//
+// Concerns:
+//   Buffers released in excess of the cache capacity are returned to the
+//   global pool in batches, and are reused instead of allocating more
+//   memory.
+//
+// Plan:
+//   Allocate several batches worth of buffers, release them all and
+//   allocate them again: the number of allocated buffers should not grow.
+//
+// Testing:
+//   allocate
+//   numAllocatedBuffers
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("REUSE ACROSS BATCHES");
+
+    const int k_NUM_BUFFERS = 5 * Obj::k_BATCH_SIZE + 3;
+
+    Obj obj(64, bmqtst::TestHelperUtil::allocator());
+
+    bsl::vector<bdlbb::BlobBuffer> buffers(
+        bmqtst::TestHelperUtil::allocator());
+    buffers.resize(k_NUM_BUFFERS);
+
+    for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+        obj.allocate(&buffers[i]);
+        bsl::memset(buffers[i].data(), i % 128, buffers[i].size());
+    }
+
+    const int numAllocated = obj.numAllocatedBuffers();
+    PV("Allocated " << numAllocated << " buffers");
+    BMQTST_ASSERT_LE(k_NUM_BUFFERS, numAllocated);
+    BMQTST_ASSERT_LT(numAllocated, k_NUM_BUFFERS + Obj::k_BATCH_SIZE);
+
+    // Buffers are distinct and their content was not overwritten
+    for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+        BMQTST_ASSERT_EQ_D(i,
+                           buffers[i].data()[0],
+                           static_cast<char>(i % 128));
+        BMQTST_ASSERT_EQ_D(i,
+                           buffers[i].data()[buffers[i].size() - 1],
+                           static_cast<char>(i % 128));
+    }
+
+    // Release all, and allocate again
+    buffers.clear();
+    buffers.resize(k_NUM_BUFFERS);
+    for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+        obj.allocate(&buffers[i]);
+    }
+
+    BMQTST_ASSERT_EQ(obj.numAllocatedBuffers(), numAllocated);
+}
+
+static void test3_multithreaded()
+// ------------------------------------------------------------------------
+// MULTITHREADED
+//
+// Concerns:
+//   a) Buffers can concurrently be allocated and released by many threads,
+//      without two threads ever being provided the same buffer.
+//   b) Buffers allocated by a thread can be released by another thread.
+//
+// Plan:
+//   a) Spawn threads building blobs, filling them with a per-thread
+//      pattern and verifying the pattern after yielding.
+//   b) Allocate buffers in this thread, and release them from other
+//      threads while allocating more.
+//
+// Testing:
+//   Thread safety
+// ------------------------------------------------------------------------
+{
+    // Thread creation uses the default and global allocators
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    bmqtst::TestHelper::printTestName("MULTITHREADED");
+
+    const int k_NUM_THREADS    = 8;
+    const int k_NUM_ITERATIONS = 5000;
+
+    Obj obj(1024, bmqtst::TestHelperUtil::allocator());
+
+    {
+        PV("Concurrent allocation and release");
+
+        bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+            bmqp::BlobPoolUtil::createBlobPool(
+                &obj,
+                bmqtst::TestHelperUtil::allocator()));
+
+        bslmt::ThreadGroup threadGroup(bmqtst::TestHelperUtil::allocator());
+        bslmt::Barrier     barrier(k_NUM_THREADS + 1);
+        bool               failed[k_NUM_THREADS] = {false};
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            int rc = threadGroup.addThread(
+                bdlf::BindUtil::bind(&fillAndVerifyThread,
+                                     blobSpPool.get(),
+                                     &barrier,
+                                     static_cast<char>('a' + i),
+                                     k_NUM_ITERATIONS,
+                                     &failed[i]));
+            BMQTST_ASSERT_EQ_D(i, rc, 0);
+        }
+
+        barrier.wait();
+        threadGroup.joinAll();
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            BMQTST_ASSERT_EQ_D(i, failed[i], false);
+        }
+    }
+
+    {
+        PV("Release from other threads");
+
+        const int k_NUM_BUFFERS = 10 * Obj::k_BATCH_SIZE;
+
+        bsl::vector<bsl::vector<bdlbb::BlobBuffer> > buffers(
+            k_NUM_THREADS,
+            bmqtst::TestHelperUtil::allocator());
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            buffers[i].resize(k_NUM_BUFFERS);
+            for (int j = 0; j < k_NUM_BUFFERS; ++j) {
+                obj.allocate(&buffers[i][j]);
+            }
+        }
+
+        bslmt::ThreadGroup threadGroup(bmqtst::TestHelperUtil::allocator());
+        bslmt::Barrier     barrier(k_NUM_THREADS + 1);
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            int rc = threadGroup.addThread(
+                bdlf::BindUtil::bind(&releaseThread, &buffers[i], &barrier));
+            BMQTST_ASSERT_EQ_D(i, rc, 0);
+        }
+
+        barrier.wait();
+
+        // Allocate while the other threads are releasing
+        bsl::vector<bdlbb::BlobBuffer> mine(
+            bmqtst::TestHelperUtil::allocator());
+        mine.resize(k_NUM_BUFFERS);
+        for (int j = 0; j < k_NUM_BUFFERS; ++j) {
+            obj.allocate(&mine[j]);
+            bsl::memset(mine[j].data(), 'z', mine[j].size());
+        }
+
+        threadGroup.joinAll();
+
+        for (int j = 0; j < k_NUM_BUFFERS; ++j) {
+            BMQTST_ASSERT_EQ_D(j, mine[j].data()[0], 'z');
+        }
+
+        PV("Allocated " << obj.numAllocatedBuffers() << " buffers for "
+                        << (k_NUM_THREADS + 1) * k_NUM_BUFFERS
+                        << " buffers in use at most");
+    }
+}
+
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+static void testN1_performance()
+// ------------------------------------------------------------------------
+// PERFORMANCE TEST
+//
+// Concerns:
+//   Compare the throughput of building and releasing events from many
+//   threads sharing a blob pool, when blob buffers are provided by a
+//   'bdlbb::PooledBlobBufferFactory' or a
+//   'bmqp::ThreadCachingBlobBufferFactory'.
+//
+// Plan:
+//   For 1, 2, 4, 8, 16 and 32 threads, have each thread build and release
+//   a fixed number of ACK events spanning several blob buffers, and report
+//   the time it took with each factory.
+//
+// Testing:
+//   Performance
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    bmqtst::TestHelper::printTestName("PERFORMANCE TEST");
+
+    const int k_BUFFER_SIZE  = 1024;
+    const int k_NUM_EVENTS   = 100000;
+    const int k_NUM_MESSAGES = 200;  // ~5 buffers per event
+
+    for (int numThreads = 1; numThreads <= 32; numThreads *= 2) {
+        bsls::Types::Int64 pooledTime = 0;
+        bsls::Types::Int64 cachingTime = 0;
+
+        {
+            bdlbb::PooledBlobBufferFactory factory(
+                k_BUFFER_SIZE,
+                bmqtst::TestHelperUtil::allocator());
+            pooledTime = buildEvents(&factory,
+                                     numThreads,
+                                     k_NUM_EVENTS,
+                                     k_NUM_MESSAGES);
+        }
+        {
+            Obj factory(k_BUFFER_SIZE, bmqtst::TestHelperUtil::allocator());
+            cachingTime = buildEvents(&factory,
+                                      numThreads,
+                                      k_NUM_EVENTS,
+                                      k_NUM_MESSAGES);
+        }
+
+        cout << numThreads << " thread(s), "
+             << bmqu::PrintUtil::prettyNumber(k_NUM_EVENTS)
+             << " events per thread:\n"
+             << "  PooledBlobBufferFactory.......: "
+             << bmqu::PrintUtil::prettyTimeInterval(pooledTime) << "\n"
+             << "  ThreadCachingBlobBufferFactory: "
+             << bmqu::PrintUtil::prettyTimeInterval(cachingTime) << endl;
+    }
+}
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void
+testN1_pooledBlobBufferFactory_GoogleBenchmark(benchmark::State& state)
+{
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    bdlbb::PooledBlobBufferFactory factory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+
+    for (auto _ : state) {
+        buildEvents(&factory, static_cast<int>(state.range(0)), 10000, 200);
+    }
+}
+
+static void
+testN1_threadCachingBlobBufferFactory_GoogleBenchmark(benchmark::State& state)
+{
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    Obj factory(1024, bmqtst::TestHelperUtil::allocator());
+
+    for (auto _ : state) {
+        buildEvents(&factory, static_cast<int>(state.range(0)), 10000, 200);
+    }
+}
+#endif  // BMQTST_BENCHMARK_ENABLED
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_multithreaded(); break;
+    case 2: test2_reuseAcrossBatches(); break;
+    case 1: test1_breathingTest(); break;
+    case -1:
+#ifdef BMQTST_BENCHMARK_ENABLED
+        BENCHMARK(testN1_pooledBlobBufferFactory_GoogleBenchmark)
+            ->RangeMultiplier(2)
+            ->Range(1, 32)
+            ->Unit(benchmark::kMillisecond);
+        BENCHMARK(testN1_threadCachingBlobBufferFactory_GoogleBenchmark)
+            ->RangeMultiplier(2)
+            ->Range(1, 32)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+#else
+        testN1_performance();
+#endif
+        break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
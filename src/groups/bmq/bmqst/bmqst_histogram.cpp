@@ -0,0 +1,475 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqst_histogram.h>
+
+#include <bdlb_bitutil.h>
+#include <bmqscm_version.h>
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdint.h>
+#include <bsl_limits.h>
+#include <bsl_new.h>
+#include <bslim_printer.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace bmqst {
+
+namespace {
+
+// CONSTANTS
+
+/// Number of buckets dividing each power of two above the linear range.
+const int k_HALF_SUB_BUCKET_COUNT = 1 << (Histogram::k_SUB_BUCKET_BITS - 1);
+
+/// Lowest value counted in the unbounded last bucket.
+const bsls::Types::Int64 k_OVERFLOW_VALUE = static_cast<bsls::Types::Int64>(1)
+                                            << Histogram::k_MAX_VALUE_BITS;
+
+/// Return the shift of the values of the bucket of the specified `index`,
+/// i.e. the base 2 logarithm of the width of the bucket.
+int bucketShift(int index)
+{
+    return index < 2 * k_HALF_SUB_BUCKET_COUNT
+               ? 0
+               : index / k_HALF_SUB_BUCKET_COUNT - 1;
+}
+
+}  // close unnamed namespace
+
+// ---------------
+// class Histogram
+// ---------------
+
+// CLASS METHODS
+int Histogram::bucketIndex(bsls::Types::Int64 value)
+{
+    if (value <= 0) {
+        return 0;  // RETURN
+    }
+
+    if (value >= k_OVERFLOW_VALUE) {
+        return k_NUM_BUCKETS - 1;  // RETURN
+    }
+
+    const int msb = 63 - bdlb::BitUtil::numLeadingUnsetBits(
+                             static_cast<bsl::uint64_t>(value));
+    const int shift = bsl::max(0, msb - (k_SUB_BUCKET_BITS - 1));
+
+    return shift * k_HALF_SUB_BUCKET_COUNT + static_cast<int>(value >> shift);
+}
+
+bsls::Types::Int64 Histogram::bucketLowestValue(int index)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= index && index < k_NUM_BUCKETS);
+
+    if (index == k_NUM_BUCKETS - 1) {
+        return k_OVERFLOW_VALUE;  // RETURN
+    }
+
+    const int shift = bucketShift(index);
+    return static_cast<bsls::Types::Int64>(index -
+                                           shift * k_HALF_SUB_BUCKET_COUNT)
+           << shift;
+}
+
+bsls::Types::Int64 Histogram::bucketHighestValue(int index)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= index && index < k_NUM_BUCKETS);
+
+    if (index == k_NUM_BUCKETS - 1) {
+        return bsl::numeric_limits<bsls::Types::Int64>::max();  // RETURN
+    }
+
+    return bucketLowestValue(index) +
+           (static_cast<bsls::Types::Int64>(1) << bucketShift(index)) - 1;
+}
+
+bsls::Types::Int64 Histogram::percentileRank(double             percentile,
+                                             bsls::Types::Int64 count)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(0 <= percentile && percentile <= 100);
+    BSLS_ASSERT(0 < count);
+
+    return bsl::max(static_cast<bsls::Types::Int64>(1),
+                    static_cast<bsls::Types::Int64>(bsl::ceil(
+                        percentile / 100 * static_cast<double>(count))));
+}
+
+// CREATORS
+Histogram::Histogram(bslma::Allocator* basicAllocator)
+: d_buckets(basicAllocator)
+, d_count(0)
+{
+}
+
+Histogram::Histogram(const Histogram& other, bslma::Allocator* basicAllocator)
+: d_buckets(other.d_buckets, basicAllocator)
+, d_count(other.d_count)
+{
+}
+
+// MANIPULATORS
+Histogram& Histogram::operator=(const Histogram& rhs)
+{
+    d_buckets = rhs.d_buckets;
+    d_count   = rhs.d_count;
+
+    return *this;
+}
+
+void Histogram::record(bsls::Types::Int64 value, bsls::Types::Int64 count)
+{
+    addToBucket(bucketIndex(value), count);
+}
+
+void Histogram::addToBucket(int index, bsls::Types::Int64 count)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= index && index < k_NUM_BUCKETS);
+
+    if (count == 0) {
+        return;  // RETURN
+    }
+
+    d_count += count;
+
+    if (d_buckets.empty() || d_buckets.back().first < index) {
+        // Buckets are typically added in order.
+        d_buckets.push_back(Bucket(index, count));
+        return;  // RETURN
+    }
+
+    Buckets::iterator it = bsl::lower_bound(d_buckets.begin(),
+                                            d_buckets.end(),
+                                            Bucket(index, 0));
+    if (it->first == index) {
+        it->second += count;
+    }
+    else {
+        d_buckets.insert(it, Bucket(index, count));
+    }
+}
+
+void Histogram::add(const Histogram& other)
+{
+    if (other.isEmpty()) {
+        return;  // RETURN
+    }
+
+    if (isEmpty()) {
+        *this = other;
+        return;  // RETURN
+    }
+
+    Buckets merged(d_buckets.get_allocator());
+    merged.reserve(d_buckets.size() + other.d_buckets.size());
+
+    Buckets::const_iterator lhs = d_buckets.begin();
+    Buckets::const_iterator rhs = other.d_buckets.begin();
+    while (lhs != d_buckets.end() && rhs != other.d_buckets.end()) {
+        if (lhs->first < rhs->first) {
+            merged.push_back(*lhs++);
+        }
+        else if (rhs->first < lhs->first) {
+            merged.push_back(*rhs++);
+        }
+        else {
+            merged.push_back(Bucket(lhs->first, lhs->second + rhs->second));
+            ++lhs;
+            ++rhs;
+        }
+    }
+    merged.insert(merged.end(), lhs, d_buckets.cend());
+    merged.insert(merged.end(), rhs, other.d_buckets.cend());
+
+    d_buckets.swap(merged);
+    d_count += other.d_count;
+}
+
+void Histogram::reset()
+{
+    d_buckets.clear();
+    d_count = 0;
+}
+
+void Histogram::swap(Histogram& other)
+{
+    d_buckets.swap(other.d_buckets);
+    bsl::swap(d_count, other.d_count);
+}
+
+// ACCESSORS
+bsls::Types::Int64 Histogram::valueAtPercentile(double percentile) const
+{
+    if (isEmpty()) {
+        return 0;  // RETURN
+    }
+
+    const bsls::Types::Int64 rank = percentileRank(percentile, d_count);
+
+    bsls::Types::Int64 cumulated = 0;
+    for (Buckets::const_iterator it = d_buckets.begin(); it != d_buckets.end();
+         ++it) {
+        cumulated += it->second;
+        if (cumulated >= rank) {
+            return bucketHighestValue(it->first);  // RETURN
+        }
+    }
+
+    return bucketHighestValue(d_buckets.back().first);
+}
+
+bsl::ostream&
+Histogram::print(bsl::ostream& stream, int level, int spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;  // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("count", d_count);
+    for (Buckets::const_iterator it = d_buckets.begin(); it != d_buckets.end();
+         ++it) {
+        printer.printIndentation();
+        stream << "[" << bucketLowestValue(it->first) << ", "
+               << bucketHighestValue(it->first) << "]: " << it->second;
+        if (spacesPerLevel >= 0) {
+            stream << '\n';
+        }
+    }
+    printer.end();
+
+    return stream;
+}
+
+// ---------------------
+// class AtomicHistogram
+// ---------------------
+
+// PRIVATE MANIPULATORS
+AtomicHistogram::ChunkPtr* AtomicHistogram::chunks()
+{
+    ChunkPtr* chunks = d_chunks_p.loadAcquire();
+    if (chunks) {
+        return chunks;  // RETURN
+    }
+
+    chunks = static_cast<ChunkPtr*>(
+        d_allocator_p->allocate(k_NUM_CHUNKS * sizeof(ChunkPtr)));
+    for (int i = 0; i < k_NUM_CHUNKS; ++i) {
+        new (chunks + i) ChunkPtr(0);
+    }
+
+    // Another thread may have allocated the chunks concurrently.
+    ChunkPtr* previous = d_chunks_p.testAndSwap(0, chunks);
+    if (previous) {
+        d_allocator_p->deallocate(chunks);
+        return previous;  // RETURN
+    }
+
+    return chunks;
+}
+
+bsls::AtomicInt* AtomicHistogram::chunk(int chunkIndex)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= chunkIndex && chunkIndex < k_NUM_CHUNKS);
+
+    ChunkPtr&        chunkPtr = chunks()[chunkIndex];
+    bsls::AtomicInt* chunk    = chunkPtr.loadAcquire();
+    if (chunk) {
+        return chunk;  // RETURN
+    }
+
+    chunk = static_cast<bsls::AtomicInt*>(
+        d_allocator_p->allocate(k_CHUNK_SIZE * sizeof(bsls::AtomicInt)));
+    for (int i = 0; i < k_CHUNK_SIZE; ++i) {
+        new (chunk + i) bsls::AtomicInt(0);
+    }
+
+    // Another thread may have allocated the chunk concurrently.
+    bsls::AtomicInt* previous = chunkPtr.testAndSwap(0, chunk);
+    if (previous) {
+        d_allocator_p->deallocate(chunk);
+        return previous;  // RETURN
+    }
+
+    return chunk;
+}
+
+// CREATORS
+AtomicHistogram::AtomicHistogram(bslma::Allocator* basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_chunks_p(0)
+, d_isDirty(false)
+{
+}
+
+AtomicHistogram::AtomicHistogram(const AtomicHistogram& other,
+                                 bslma::Allocator*      basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_chunks_p(0)
+, d_isDirty(false)
+{
+    *this = other;
+}
+
+AtomicHistogram::~AtomicHistogram()
+{
+    ChunkPtr* chunks = d_chunks_p.load();
+    if (!chunks) {
+        return;  // RETURN
+    }
+
+    for (int i = 0; i < k_NUM_CHUNKS; ++i) {
+        bsls::AtomicInt* chunk = chunks[i].load();
+        if (chunk) {
+            d_allocator_p->deallocate(chunk);
+        }
+    }
+    d_allocator_p->deallocate(chunks);
+}
+
+// MANIPULATORS
+AtomicHistogram& AtomicHistogram::operator=(const AtomicHistogram& rhs)
+{
+    if (this == &rhs) {
+        return *this;  // RETURN
+    }
+
+    reset();
+
+    const ChunkPtr* rhsChunks = rhs.d_chunks_p.loadAcquire();
+    if (!rhsChunks) {
+        return *this;  // RETURN
+    }
+
+    for (int i = 0; i < k_NUM_CHUNKS; ++i) {
+        const bsls::AtomicInt* rhsChunk = rhsChunks[i].loadAcquire();
+        if (!rhsChunk) {
+            continue;  // CONTINUE
+        }
+
+        bsls::AtomicInt* lhsChunk = chunk(i);
+        for (int j = 0; j < k_CHUNK_SIZE; ++j) {
+            lhsChunk[j] = rhsChunk[j].load();
+        }
+    }
+    d_isDirty = rhs.d_isDirty.load();
+
+    return *this;
+}
+
+void AtomicHistogram::add(const Histogram& histogram)
+{
+    if (histogram.isEmpty()) {
+        return;  // RETURN
+    }
+
+    for (Histogram::Buckets::const_iterator it = histogram.buckets().begin();
+         it != histogram.buckets().end();
+         ++it) {
+        chunk(it->first >> k_CHUNK_BITS)[it->first & (k_CHUNK_SIZE - 1)].add(
+            static_cast<int>(it->second));
+    }
+
+    d_isDirty.storeRelease(true);
+}
+
+void AtomicHistogram::moveTo(Histogram* histogram)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(histogram);
+
+    histogram->reset();
+
+    if (!d_isDirty.swap(false)) {
+        // Nothing recorded since the last move.
+        return;  // RETURN
+    }
+
+    ChunkPtr* chunks = d_chunks_p.loadAcquire();
+    BSLS_ASSERT_SAFE(chunks);
+
+    for (int i = 0; i < k_NUM_CHUNKS; ++i) {
+        bsls::AtomicInt* chunk = chunks[i].loadAcquire();
+        if (!chunk) {
+            continue;  // CONTINUE
+        }
+
+        for (int j = 0; j < k_CHUNK_SIZE; ++j) {
+            if (chunk[j].load() != 0) {
+                histogram->addToBucket((i << k_CHUNK_BITS) + j,
+                                       chunk[j].swap(0));
+            }
+        }
+    }
+}
+
+void AtomicHistogram::reset()
+{
+    ChunkPtr* chunks = d_chunks_p.loadAcquire();
+    if (chunks) {
+        for (int i = 0; i < k_NUM_CHUNKS; ++i) {
+            bsls::AtomicInt* chunk = chunks[i].loadAcquire();
+            if (!chunk) {
+                continue;  // CONTINUE
+            }
+
+            for (int j = 0; j < k_CHUNK_SIZE; ++j) {
+                chunk[j] = 0;
+            }
+        }
+    }
+    d_isDirty = false;
+}
+
+// ACCESSORS
+void AtomicHistogram::loadHistogram(Histogram* histogram) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(histogram);
+
+    histogram->reset();
+
+    const ChunkPtr* chunks = d_chunks_p.loadAcquire();
+    if (!chunks) {
+        return;  // RETURN
+    }
+
+    for (int i = 0; i < k_NUM_CHUNKS; ++i) {
+        const bsls::AtomicInt* chunk = chunks[i].loadAcquire();
+        if (!chunk) {
+            continue;  // CONTINUE
+        }
+
+        for (int j = 0; j < k_CHUNK_SIZE; ++j) {
+            const int count = chunk[j].load();
+            if (count != 0) {
+                histogram->addToBucket((i << k_CHUNK_BITS) + j, count);
+            }
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,380 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQST_HISTOGRAM
+#define INCLUDED_BMQST_HISTOGRAM
+
+//@PURPOSE: Provide histograms of integer values with a bounded relative error.
+//
+//@CLASSES:
+// bmqst::Histogram       : value-semantic histogram of recorded values
+// bmqst::AtomicHistogram : mechanism recording values into a histogram
+//
+//@SEE_ALSO:
+//  bmqst_statvalue
+//
+//@DESCRIPTION: This component defines a value-semantic type,
+// 'bmqst::Histogram', counting recorded values into buckets following the
+// layout of an HDR (High Dynamic Range) histogram, and a mechanism,
+// 'bmqst::AtomicHistogram', recording values into such buckets from multiple
+// threads without locking.
+//
+// You probably should not use these classes directly.  Instead, you should
+// use a 'bmqst::StatValue' of type 'e_DISTRIBUTION', whose percentiles are
+// returned by 'bmqst::StatUtil::percentile'.
+//
+/// Bucket Layout
+///-------------
+// Values lower than '2^k_SUB_BUCKET_BITS' each have their own bucket.  Above
+// that, each power of two is divided into '2^(k_SUB_BUCKET_BITS - 1)' buckets
+// of equal width, so that the width of a bucket is at most 1/16th of its
+// lowest value.  Any value is therefore reported with a relative error of at
+// most 6.25%, whatever its magnitude, using a small, fixed number of buckets.
+// Negative values are counted as 0, and values of '2^k_MAX_VALUE_BITS' or
+// more (about 78 hours when counting nanoseconds) are counted in a last,
+// unbounded bucket.
+//
+// 'bmqst::Histogram' only stores the buckets having a non-zero count, so that
+// the histogram of a set of values concentrated around a few magnitudes,
+// such as latencies, remains small.
+//
+/// Memory Usage
+///-------------
+// 'bmqst::AtomicHistogram' groups its counters in chunks of
+// 'k_CHUNK_SIZE' (16) buckets, i.e. one power of two above the linear range,
+// each allocated on the first value recorded into it, along with an array of
+// 'k_NUM_CHUNKS' (46) pointers to them allocated on the first recorded value.
+// An object which never recorded a value allocates nothing.  Otherwise, it
+// costs 368 bytes plus 64 bytes per power of two recorded, typically well
+// under 1 KB for latencies, and at most about 3.3 KB.  Chunks are never freed
+// before the object is destroyed, since recording does not lock, and moving
+// the counts to a 'bmqst::Histogram' only scans the allocated chunks.
+//
+/// Thread Safety
+///-------------
+// 'bmqst::AtomicHistogram::record' and 'bmqst::AtomicHistogram::add' are
+// thread-safe.  All other functions are not.
+
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_atomic.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bmqst {
+
+// ===============
+// class Histogram
+// ===============
+
+/// Value-semantic histogram of recorded integer values.
+class Histogram {
+  public:
+    // PUBLIC TYPES
+
+    /// Index of a bucket and number of values counted in it.
+    typedef bsl::pair<int, bsls::Types::Int64> Bucket;
+
+    typedef bsl::vector<Bucket> Buckets;
+
+    // PUBLIC CONSTANTS
+
+    /// Number of bits distinguishing the buckets of a same power of two.
+    static const int k_SUB_BUCKET_BITS = 5;
+
+    /// Number of bits of the highest value having a bounded bucket.
+    static const int k_MAX_VALUE_BITS = 48;
+
+    /// Number of buckets, including the unbounded last one.
+    static const int k_NUM_BUCKETS =
+        (1 << (k_SUB_BUCKET_BITS - 1)) *
+            (k_MAX_VALUE_BITS - k_SUB_BUCKET_BITS) +
+        (1 << k_SUB_BUCKET_BITS) + 1;
+
+  private:
+    // DATA
+
+    /// Buckets having a non-zero count, ordered by index.
+    Buckets d_buckets;
+
+    /// Total number of values counted.
+    bsls::Types::Int64 d_count;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Histogram, bslma::UsesBslmaAllocator)
+
+    // CLASS METHODS
+
+    /// Return the index of the bucket counting the specified `value`.
+    static int bucketIndex(bsls::Types::Int64 value);
+
+    /// Return the lowest value counted in the bucket of the specified
+    /// `index`.  The behavior is undefined unless
+    /// `0 <= index < k_NUM_BUCKETS`.
+    static bsls::Types::Int64 bucketLowestValue(int index);
+
+    /// Return the highest value counted in the bucket of the specified
+    /// `index`, which is the maximum Int64 for the last bucket.  The
+    /// behavior is undefined unless `0 <= index < k_NUM_BUCKETS`.
+    static bsls::Types::Int64 bucketHighestValue(int index);
+
+    /// Return the rank, starting at 1, of the value at the specified
+    /// `percentile` among the specified `count` values ordered by
+    /// increasing value.  The behavior is undefined unless
+    /// `0 <= percentile <= 100` and `0 < count`.
+    static bsls::Types::Int64 percentileRank(double             percentile,
+                                             bsls::Types::Int64 count);
+
+    // CREATORS
+
+    /// Create an empty histogram.  Optionally specify a `basicAllocator`
+    /// used to supply memory.
+    explicit Histogram(bslma::Allocator* basicAllocator = 0);
+
+    /// Create a histogram having the same value as the specified `other`.
+    /// Optionally specify a `basicAllocator` used to supply memory.
+    Histogram(const Histogram& other, bslma::Allocator* basicAllocator = 0);
+
+    // MANIPULATORS
+    Histogram& operator=(const Histogram& rhs);
+
+    /// Count the specified `count` occurrences of the specified `value`.
+    /// Note that this method is meant for building test or reference
+    /// histograms: use `AtomicHistogram` to record values in a hot path.
+    void record(bsls::Types::Int64 value, bsls::Types::Int64 count = 1);
+
+    /// Add the specified `count` to the bucket of the specified `index`.
+    /// The behavior is undefined unless `0 <= index < k_NUM_BUCKETS`.
+    void addToBucket(int index, bsls::Types::Int64 count);
+
+    /// Add the counts of the specified `other` histogram to this one.
+    void add(const Histogram& other);
+
+    /// Remove all the counted values.
+    void reset();
+
+    /// Efficiently exchange the value of this object with the value of the
+    /// specified `other`.  The behavior is undefined unless both objects
+    /// use the same allocator.
+    void swap(Histogram& other);
+
+    // ACCESSORS
+
+    /// Return the total number of values counted.
+    bsls::Types::Int64 count() const;
+
+    /// Return `true` if no value was counted, and `false` otherwise.
+    bool isEmpty() const;
+
+    /// Return the buckets having a non-zero count, ordered by index.
+    const Buckets& buckets() const;
+
+    /// Return the highest value of the bucket counting the value at the
+    /// specified `percentile` of the counted values, i.e. the lowest value
+    /// which is higher than or equivalent to `percentile` percent of them,
+    /// or 0 if no value was counted.  The behavior is undefined unless
+    /// `0 <= percentile <= 100`.
+    bsls::Types::Int64 valueAtPercentile(double percentile) const;
+
+    /// Format this object to the specified output `stream` at the (absolute
+    /// value of) the optionally specified indentation `level` and return a
+    /// reference to `stream`.  If `level` is specified, optionally specify
+    /// `spacesPerLevel`, the number of spaces per indentation level for
+    /// this and all of its nested objects.  If `level` is negative,
+    /// suppress indentation of the first line.  If `spacesPerLevel` is
+    /// negative format the entire output on one line, suppressing all but
+    /// the initial indentation (as governed by `level`).  If `stream` is
+    /// not valid on entry, this operation has no effect.
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+};
+
+// FREE OPERATORS
+bool          operator==(const Histogram& lhs, const Histogram& rhs);
+bool          operator!=(const Histogram& lhs, const Histogram& rhs);
+bsl::ostream& operator<<(bsl::ostream& stream, const Histogram& histogram);
+
+// =====================
+// class AtomicHistogram
+// =====================
+
+/// Mechanism recording integer values into the buckets of a `Histogram`
+/// from multiple threads without locking.
+class AtomicHistogram {
+  public:
+    // PUBLIC CONSTANTS
+
+    /// Number of bits of the index of a bucket within its chunk.
+    static const int k_CHUNK_BITS = Histogram::k_SUB_BUCKET_BITS - 1;
+
+    /// Number of buckets per chunk of counters.
+    static const int k_CHUNK_SIZE = 1 << k_CHUNK_BITS;
+
+    /// Number of chunks covering all the buckets.
+    static const int k_NUM_CHUNKS =
+        (Histogram::k_NUM_BUCKETS + k_CHUNK_SIZE - 1) / k_CHUNK_SIZE;
+
+  private:
+    // PRIVATE TYPES
+
+    /// Pointer to a chunk of `k_CHUNK_SIZE` counters.  Note that 32 bits are
+    /// enough for a counter, as the counts are moved to a `Histogram` at
+    /// each snapshot.
+    typedef bsls::AtomicPointer<bsls::AtomicInt> ChunkPtr;
+
+    // DATA
+
+    /// Allocator used to supply memory.
+    bslma::Allocator* d_allocator_p;
+
+    /// Pointer to each chunk of counters, allocated on the first recorded
+    /// value.
+    bsls::AtomicPointer<ChunkPtr> d_chunks_p;
+
+    /// Whether a value was recorded since the counts were last moved.
+    bsls::AtomicBool d_isDirty;
+
+    // PRIVATE MANIPULATORS
+
+    /// Return the pointers to the chunks, allocating them if needed.
+    ChunkPtr* chunks();
+
+    /// Return the chunk of the specified `chunkIndex`, allocating it if
+    /// needed.
+    bsls::AtomicInt* chunk(int chunkIndex);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AtomicHistogram, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty histogram.  Optionally specify a `basicAllocator`
+    /// used to supply memory.
+    explicit AtomicHistogram(bslma::Allocator* basicAllocator = 0);
+
+    /// Create a histogram holding the same counts as the specified `other`.
+    /// Optionally specify a `basicAllocator` used to supply memory.
+    AtomicHistogram(const AtomicHistogram& other,
+                    bslma::Allocator*      basicAllocator = 0);
+
+    /// Destroy this object.
+    ~AtomicHistogram();
+
+    // MANIPULATORS
+
+    /// Set the counts of this histogram to those of the specified `rhs`.
+    AtomicHistogram& operator=(const AtomicHistogram& rhs);
+
+    /// Record the specified `value`.
+    void record(bsls::Types::Int64 value);
+
+    /// Add the counts of the specified `histogram` to this one.
+    void add(const Histogram& histogram);
+
+    /// Load into the specified `histogram` the counts of this one, and
+    /// reset them.  Values recorded concurrently are either loaded, or left
+    /// to be loaded by the next call.
+    void moveTo(Histogram* histogram);
+
+    /// Reset the counts of this histogram.
+    void reset();
+
+    // ACCESSORS
+
+    /// Load into the specified `histogram` the counts of this one.
+    void loadHistogram(Histogram* histogram) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------
+// class Histogram
+// ---------------
+
+// ACCESSORS
+inline bsls::Types::Int64 Histogram::count() const
+{
+    return d_count;
+}
+
+inline bool Histogram::isEmpty() const
+{
+    return d_count == 0;
+}
+
+inline const Histogram::Buckets& Histogram::buckets() const
+{
+    return d_buckets;
+}
+
+// ---------------------
+// class AtomicHistogram
+// ---------------------
+
+// MANIPULATORS
+inline void AtomicHistogram::record(bsls::Types::Int64 value)
+{
+    const int       index      = Histogram::bucketIndex(value);
+    const int       chunkIndex = index >> k_CHUNK_BITS;
+    const ChunkPtr* chunks     = d_chunks_p.loadAcquire();
+
+    bsls::AtomicInt* chunk = chunks ? chunks[chunkIndex].loadAcquire() : 0;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!chunk)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        chunk = this->chunk(chunkIndex);
+    }
+
+    chunk[index & (k_CHUNK_SIZE - 1)].add(1);
+
+    // Publish the count to 'moveTo'.  Only write the flag if needed, so that
+    // frequent recordings do not contend on it.  Note that the flag is only
+    // read after the count is added, so that a flag read as set was not yet
+    // cleared by 'moveTo', which then sees the count.
+    if (!d_isDirty.load()) {
+        d_isDirty.storeRelease(true);
+    }
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline bool bmqst::operator==(const Histogram& lhs, const Histogram& rhs)
+{
+    return lhs.count() == rhs.count() && lhs.buckets() == rhs.buckets();
+}
+
+inline bool bmqst::operator!=(const Histogram& lhs, const Histogram& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline bsl::ostream& bmqst::operator<<(bsl::ostream&    stream,
+                                       const Histogram& histogram)
+{
+    return histogram.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+#endif
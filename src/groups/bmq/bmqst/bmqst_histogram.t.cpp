@@ -0,0 +1,323 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqst_histogram.h>
+
+#include <bmqst_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+
+using namespace BloombergLP;
+using namespace bmqst;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                              *** Overview ***
+//
+// The components under test are a histogram of integer values and a
+// mechanism recording values into such a histogram from multiple threads.
+//
+// ----------------------------------------------------------------------------
+// [ 1] BUCKET LAYOUT TEST
+// [ 2] HISTOGRAM TEST
+// [ 3] ATOMIC HISTOGRAM TEST
+
+//=============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define L_ BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    int test    = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    // int veryVerbose = argc > 3;
+    // int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // Use test allocator
+    bslma::TestAllocator testAllocator;
+    testAllocator.setNoAbort(true);
+    bslma::Default::setDefaultAllocatorRaw(&testAllocator);
+
+    typedef bsls::Types::Int64 Int64;
+
+    switch (test) {
+    case 0:
+    case 3: {
+        // --------------------------------------------------------------------
+        // ATOMIC HISTOGRAM TEST
+        //
+        // Concerns:
+        //   That values recorded into an 'AtomicHistogram' are moved to a
+        //   'Histogram', which resets the counts, and that the counters are
+        //   only allocated, by chunk, when a value is recorded into it.
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "ATOMIC HISTOGRAM TEST" << endl
+                 << "=====================" << endl;
+
+        bslma::TestAllocator ta;
+        bslma::TestAllocator atomicAllocator;
+
+        AtomicHistogram atomic(&atomicAllocator);
+        Histogram       histogram(&ta);
+
+        // Nothing allocated until a value is recorded
+        atomic.moveTo(&histogram);
+        ASSERT(histogram.isEmpty());
+        ASSERT_EQUALS(atomicAllocator.numBlocksInUse(), 0);
+
+        Histogram expected(&ta);
+        bool      isChunkUsed[AtomicHistogram::k_NUM_CHUNKS] = {};
+        int       numChunks                                  = 0;
+        for (Int64 value = 0; value < 1000; value += 7) {
+            atomic.record(value);
+            expected.record(value);
+
+            const int chunk = Histogram::bucketIndex(value) /
+                              AtomicHistogram::k_CHUNK_SIZE;
+            if (!isChunkUsed[chunk]) {
+                isChunkUsed[chunk] = true;
+                ++numChunks;
+            }
+        }
+
+        // The pointers to the chunks, and the chunks recorded into
+        ASSERT_EQUALS(atomicAllocator.numBlocksInUse(), 1 + numChunks);
+        ASSERT_LESS(numChunks, AtomicHistogram::k_NUM_CHUNKS / 4);
+
+        // Values of a same magnitude only allocate one chunk
+        {
+            AtomicHistogram latencies(&ta);
+            const Int64     numBytes = ta.numBytesInUse();
+            for (Int64 value = 1 << 20; value < 1 << 21; value += 1000) {
+                latencies.record(value);
+            }
+            ASSERT_EQUALS(ta.numBytesInUse() - numBytes,
+                          static_cast<Int64>(
+                              AtomicHistogram::k_NUM_CHUNKS * sizeof(void*) +
+                              AtomicHistogram::k_CHUNK_SIZE * sizeof(int)));
+        }
+
+        // A copy holds the same counts
+        AtomicHistogram copy(atomic, &ta);
+        Histogram       copied(&ta);
+        copy.loadHistogram(&copied);
+        ASSERT_EQUALS(copied, expected);
+
+        atomic.moveTo(&histogram);
+        ASSERT_EQUALS(histogram, expected);
+
+        // Moving the counts reset them
+        atomic.moveTo(&histogram);
+        ASSERT(histogram.isEmpty());
+        atomic.loadHistogram(&histogram);
+        ASSERT(histogram.isEmpty());
+
+        // Adding a histogram
+        atomic.add(expected);
+        atomic.record(5);
+        expected.record(5);
+        atomic.moveTo(&histogram);
+        ASSERT_EQUALS(histogram, expected);
+
+        // Reset
+        atomic.record(3);
+        atomic.reset();
+        atomic.moveTo(&histogram);
+        ASSERT(histogram.isEmpty());
+    } break;
+    case 2: {
+        // --------------------------------------------------------------------
+        // HISTOGRAM TEST
+        //
+        // Concerns:
+        //   That a 'Histogram' counts the recorded values, merges other
+        //   histograms, and returns the values at percentiles within the
+        //   bounded relative error.
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "HISTOGRAM TEST" << endl
+                 << "==============" << endl;
+
+        bslma::TestAllocator ta;
+
+        Histogram histogram(&ta);
+        ASSERT(histogram.isEmpty());
+        ASSERT_EQUALS(histogram.valueAtPercentile(50), 0);
+
+        // Record 1..10000 in reverse order
+        for (Int64 value = 10000; value > 0; --value) {
+            histogram.record(value);
+        }
+        ASSERT_EQUALS(histogram.count(), 10000);
+
+        const double PERCENTILES[] = {0, 10, 50, 90, 99, 99.9, 100};
+        const int    NUM_PERCENTILES = sizeof(PERCENTILES) /
+                                    sizeof(*PERCENTILES);
+
+        for (int i = 0; i < NUM_PERCENTILES; ++i) {
+            const Int64 exact  = bsl::max(static_cast<Int64>(1),
+                                         static_cast<Int64>(PERCENTILES[i] *
+                                                            100));
+            const Int64 result = histogram.valueAtPercentile(PERCENTILES[i]);
+            LOOP_ASSERT_LE(i, exact, result);
+            LOOP_ASSERT_LE(i, result, exact + exact / 16);
+        }
+
+        // Buckets are ordered and hold non-zero counts
+        Int64 total = 0;
+        for (Histogram::Buckets::const_iterator it =
+                 histogram.buckets().begin();
+             it != histogram.buckets().end();
+             ++it) {
+            ASSERT_LESS(0, it->second);
+            if (it != histogram.buckets().begin()) {
+                ASSERT_LESS((it - 1)->first, it->first);
+            }
+            total += it->second;
+        }
+        ASSERT_EQUALS(total, histogram.count());
+
+        // Merging
+        Histogram low(&ta);
+        Histogram high(&ta);
+        Histogram both(&ta);
+        for (Int64 value = 1; value <= 100; ++value) {
+            low.record(value);
+            high.record(value * 1000, 2);
+            both.record(value);
+            both.record(value * 1000, 2);
+        }
+
+        Histogram merged(low, &ta);
+        ASSERT_EQUALS(merged, low);
+        merged.add(high);
+        ASSERT_EQUALS(merged, both);
+        ASSERT_EQUALS(merged.count(), 300);
+        ASSERT_NOT_EQUALS(merged, low);
+
+        merged.add(Histogram(&ta));
+        ASSERT_EQUALS(merged, both);
+
+        Histogram empty(&ta);
+        empty.add(high);
+        ASSERT_EQUALS(empty, high);
+
+        // Swap and reset
+        empty.swap(low);
+        ASSERT_EQUALS(low, high);
+        ASSERT_EQUALS(empty.count(), 100);
+
+        low.reset();
+        ASSERT(low.isEmpty());
+        ASSERT(low.buckets().empty());
+    } break;
+    case 1: {
+        // --------------------------------------------------------------------
+        // BUCKET LAYOUT TEST
+        //
+        // Concerns:
+        //   That buckets are contiguous, that each value is counted in the
+        //   bucket whose bounds contain it, and that the width of a bucket is
+        //   at most 1/16th of its lowest value.
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "BUCKET LAYOUT TEST" << endl
+                 << "==================" << endl;
+
+        ASSERT_EQUALS(Histogram::bucketLowestValue(0), 0);
+        ASSERT_EQUALS(Histogram::bucketIndex(0), 0);
+        ASSERT_EQUALS(Histogram::bucketIndex(-5), 0);
+        ASSERT_EQUALS(Histogram::bucketIndex(31), 31);
+
+        for (int i = 1; i < Histogram::k_NUM_BUCKETS; ++i) {
+            const Int64 lowest  = Histogram::bucketLowestValue(i);
+            const Int64 highest = Histogram::bucketHighestValue(i);
+
+            LOOP_ASSERT_EQUALS(i,
+                               lowest,
+                               Histogram::bucketHighestValue(i - 1) + 1);
+            LOOP_ASSERT_LE(i, lowest, highest);
+            LOOP_ASSERT_EQUALS(i, Histogram::bucketIndex(lowest), i);
+            LOOP_ASSERT_EQUALS(i, Histogram::bucketIndex(highest), i);
+
+            if (i < Histogram::k_NUM_BUCKETS - 1) {
+                LOOP_ASSERT_LE(i, (highest - lowest + 1) * 16, lowest);
+                LOOP_ASSERT_EQUALS(i,
+                                   Histogram::bucketIndex((lowest + highest) /
+                                                          2),
+                                   i);
+            }
+        }
+
+        const Int64 k_MAX = bsl::numeric_limits<Int64>::max();
+        ASSERT_EQUALS(Histogram::bucketIndex(k_MAX),
+                      Histogram::k_NUM_BUCKETS - 1);
+        ASSERT_EQUALS(Histogram::bucketHighestValue(
+                          Histogram::k_NUM_BUCKETS - 1),
+                      k_MAX);
+        ASSERT_EQUALS(Histogram::bucketLowestValue(
+                          Histogram::k_NUM_BUCKETS - 1),
+                      static_cast<Int64>(1) << Histogram::k_MAX_VALUE_BITS);
+    } break;
+
+    default: {
+        cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+    } break;
+    }
+
+    if (testStatus != 255) {
+        if ((testAllocator.numMismatches() != 0) ||
+            (testAllocator.numBytesInUse() != 0)) {
+            bsl::cout << "*** Error " << __FILE__ << "(" << __LINE__
+                      << "): test allocator: " << '\n';
+            testAllocator.print();
+            testStatus++;
+        }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
@@ -71,6 +71,16 @@ void snapshotValueVec(bsl::vector<StatValue>* vec,
     }
 }
 
+void repeatValueVec(bsl::vector<StatValue>* vec,
+                    bsls::Types::Int64      snapshotTime)
+{
+    if (vec) {
+        for (size_t i = 0; i < vec->size(); ++i) {
+            (*vec)[i].repeatSnapshot(snapshotTime);
+        }
+    }
+}
+
 void addValues(bsl::vector<StatValue>* dest, const bsl::vector<StatValue>* src)
 {
     if (dest) {
@@ -307,7 +317,7 @@ StatContext::ValueVec* StatContext::getTotalValuesVec()
     }
 }
 
-void StatContext::snapshotSubcontext(StatContext*       subcontext,
+bool StatContext::snapshotSubcontext(StatContext*       subcontext,
                                      bsls::Types::Int64 snapshotTime)
 {
     if (subcontext->d_numSnapshots == 0 && d_isTable && d_directValues_p) {
@@ -319,8 +329,11 @@ void StatContext::snapshotSubcontext(StatContext*       subcontext,
         syncValues(subcontext->d_expiredValues_p.ptr(), *d_directValues_p);
     }
 
-    subcontext->snapshotImp(snapshotTime);
+    return subcontext->snapshotImp(snapshotTime);
+}
 
+void StatContext::addSubcontextValues(const StatContext* subcontext)
+{
     // Don't just add the subcontext's total values because that will include
     // their expired children too, if it's keeping track of them
     addValues(d_activeChildrenTotalValues_p.ptr(),
@@ -329,12 +342,16 @@ void StatContext::snapshotSubcontext(StatContext*       subcontext,
               subcontext->d_activeChildrenTotalValues_p.ptr());
 }
 
-void StatContext::snapshotImp(bsls::Types::Int64 snapshotTime)
+bool StatContext::snapshotImp(bsls::Types::Int64 snapshotTime)
 {
     if (d_preSnapshotCallback) {
         d_preSnapshotCallback(*this);
     }
 
+    // Clear the dirty flag before reading any value, so that an update
+    // racing with this snapshot marks the context dirty for the next one.
+    bool isChanged = d_isDirty.swap(false);
+
     if (d_update_p) {
         // Update the timestamp, and clear our configuration and created flag
         // if this is our second snapshot.
@@ -348,31 +365,37 @@ void StatContext::snapshotImp(bsls::Types::Int64 snapshotTime)
         }
     }
 
-    moveNewSubcontexts();
+    if (isChanged) {
+        // Subcontexts are added only when the context is marked dirty.
+        moveNewSubcontexts();
+    }
 
     if (d_isTable && !d_subcontexts.empty() &&
         !d_activeChildrenTotalValues_p && d_directValues_p) {
         // Initialize 'd_activeChildrenTotalValues_p' if we have subtables
         initValues(d_activeChildrenTotalValues_p);
         syncValues(d_activeChildrenTotalValues_p.ptr(), *d_directValues_p);
+        isChanged = true;
     }
 
-    clearStats(d_activeChildrenTotalValues_p.ptr());
-
-    // Snapshot all subcontexts and, if we're a table, add them to our
-    // children's total
+    // Snapshot all subcontexts
     for (StatContextVector::iterator iter = d_deletedSubcontexts.begin();
          iter != d_deletedSubcontexts.end();
          ++iter) {
-        snapshotSubcontext(*iter, snapshotTime);
+        if (!snapshotSubcontext(*iter, snapshotTime)) {
+            isChanged = true;
+        }
     }
 
     for (StatContextMap::iterator iter = d_subcontexts.begin();
          iter != d_subcontexts.end();
          /*nothing*/) {
-        snapshotSubcontext(iter->second, snapshotTime);
+        if (!snapshotSubcontext(iter->second, snapshotTime)) {
+            isChanged = true;
+        }
 
         if (iter->second->isDeleted()) {
+            isChanged = true;
             d_deletedSubcontexts.push_back(iter->second);
             bmqstm::StatContextUpdate* update = iter->second->d_update_p;
             if (update) {
@@ -387,6 +410,34 @@ void StatContext::snapshotImp(bsls::Types::Int64 snapshotTime)
         }
     }
 
+    // If neither this context nor any subcontext changed during the last two
+    // snapshot intervals, the new snapshot is identical to the previous one.
+    const bool isRepeated = !isChanged && !d_wasChanged && !d_update_p &&
+                            d_numSnapshots > 0;
+    d_wasChanged          = isChanged;
+    if (isRepeated) {
+        repeatValueVec(d_activeChildrenTotalValues_p.ptr(), snapshotTime);
+        repeatValueVec(d_expiredValues_p.ptr(), snapshotTime);
+        repeatValueVec(d_directValues_p.ptr(), snapshotTime);
+        repeatValueVec(d_totalValues_p.ptr(), snapshotTime);
+
+        ++d_numSnapshots;
+        return true;  // RETURN
+    }
+
+    // If we're a table, add the subcontexts to our children's total
+    clearStats(d_activeChildrenTotalValues_p.ptr());
+    for (StatContextVector::iterator iter = d_deletedSubcontexts.begin();
+         iter != d_deletedSubcontexts.end();
+         ++iter) {
+        addSubcontextValues(*iter);
+    }
+    for (StatContextMap::iterator iter = d_subcontexts.begin();
+         iter != d_subcontexts.end();
+         ++iter) {
+        addSubcontextValues(iter->second);
+    }
+
     snapshotValueVec(d_activeChildrenTotalValues_p.ptr(), snapshotTime);
     snapshotValueVec(d_expiredValues_p.ptr(), snapshotTime);
     if (d_update_p) {
@@ -425,15 +476,19 @@ void StatContext::snapshotImp(bsls::Types::Int64 snapshotTime)
     snapshotValueVec(d_totalValues_p.ptr(), snapshotTime);
 
     ++d_numSnapshots;
+    return false;
 }
 
-void StatContext::cleanupImp(bsl::vector<ValueVec*>* expiredValuesVec)
+bool StatContext::cleanupImp(bsl::vector<ValueVec*>* expiredValuesVec)
 {
+    bool isChanged = !d_deletedSubcontexts.empty();
+
     // Only store expired values if we're a table.  Wouldn't make sense
     // otherwise
     if (d_isTable && d_storeExpiredValues && !d_expiredValues_p) {
         initValues(d_expiredValues_p);
         syncValues(d_expiredValues_p.ptr(), *d_directValues_p);
+        isChanged = true;
     }
 
     // Push our expiredValues onto the vector.  All children will add the
@@ -448,16 +503,28 @@ void StatContext::cleanupImp(bsl::vector<ValueVec*>* expiredValuesVec)
     for (StatContextMap::iterator iter = d_subcontexts.begin();
          iter != d_subcontexts.end();
          ++iter) {
-        iter->second->cleanupImp(expiredValuesVec);
+        if (iter->second->cleanupImp(expiredValuesVec)) {
+            isChanged = true;
+        }
     }
 
     if (expiredValuesVec) {
         expiredValuesVec->pop_back();
     }
+
+    if (isChanged) {
+        // The deleted subcontexts are no longer part of the totals, and the
+        // expired values of this context were created or updated.
+        markDirty();
+    }
+
+    return isChanged;
 }
 
 void StatContext::applyUpdate(const bmqstm::StatContextUpdate& update)
 {
+    markDirty();
+
     // Apply the update to all of our values.
 
     BSLS_ASSERT(update.directValues().size() == d_directValues_p->size());
@@ -532,6 +599,8 @@ StatContext::StatContext(const Config&     config,
                         basicAllocator,
                         config.d_preSnapshotCallback)
 , d_numSnapshots(0)
+, d_isDirty(true)
+, d_wasChanged(true)
 , d_update_p(config.d_updateCollector_p)
 , d_updateValueFieldMask(config.d_updateValueFieldMask)
 , d_statValueAllocator_p(config.d_statValueAllocator_p)
@@ -633,6 +702,7 @@ bslma::ManagedPtr<StatContext> StatContext::addSubcontext(const Config& config)
 
     bslmt::LockGuard<bslmt::Mutex> guard(&d_newSubcontextsLock);  // LOCK
     d_newSubcontexts.push_back(newContext);
+    markDirty();
 
     return ret;
 }
@@ -652,6 +722,7 @@ void StatContext::cleanup()
 
 void StatContext::clearValues()
 {
+    markDirty();
     moveNewSubcontexts();
     for (StatContextMap::iterator iter = d_subcontexts.begin();
          iter != d_subcontexts.end();
@@ -687,6 +758,7 @@ void StatContext::snapshotFromUpdate(const bmqstm::StatContextUpdate& update)
 
 void StatContext::clearSubcontexts()
 {
+    markDirty();
     moveNewSubcontexts();
 
     for (StatContextMap::iterator iter = d_subcontexts.begin();
@@ -768,8 +840,11 @@ void StatContext::initializeUpdate(bmqstm::StatContextUpdate* update) const
         bmqstm::StatValueDefinition& definition = config.values()[i];
         const StatValue& val = value(StatContext::e_DIRECT_VALUE, i);
         definition.name()    = valueName(i);
-        definition.type()    = static_cast<bmqstm::StatValueType::Value>(
-            val.type());
+        // The histograms of distribution values are not part of updates,
+        // which only convey their discrete stats.
+        definition.type() = val.type() == StatValue::e_CONTINUOUS
+                                ? bmqstm::StatValueType::E_CONTINUOUS
+                                : bmqstm::StatValueType::E_DISCRETE;
         definition.historySizes().resize(val.numLevels());
         for (int l = 0; l < val.numLevels(); ++l) {
             definition.historySizes()[l] = val.historySize(l);
@@ -119,6 +119,14 @@
 // knowing about any contexts that were created and destroyed between
 // calls to 'snapshot'.
 //
+// Each 'StatContext' tracks whether any of its values was updated since its
+// last snapshot.  The snapshot of a context which, like all its subcontexts,
+// was idle during the last two snapshot intervals is identical to its
+// previous one: it is therefore copied from the previous snapshot, without
+// reading the current values nor recomputing the totals of the
+// subcontexts, which makes the cost of snapshotting many idle contexts
+// (e.g. queues without traffic) much lower than the one of active ones.
+//
 // Third and finally, the application needs to use these statistics, like for
 // example log them on a regular basis, or publish them to some dashboard
 // monitoring function. To do this the application accesses all the snapshotted
@@ -500,6 +508,7 @@
 #include <bslmf_allocatorargt.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bslmt_mutex.h>
+#include <bsls_atomic.h>
 #include <bsls_spinlock.h>
 
 namespace BloombergLP {
@@ -656,6 +665,14 @@ class StatContext {
                                         // 'StatContext' had
                                         // 'snapshot' called on it
 
+    // `true` if a value of this context was updated, or a subcontext added
+    // or cleaned up, since the last snapshot
+    bsls::AtomicBool d_isDirty;
+
+    // `true` if the last snapshot of this context, or of any of its
+    // subcontexts, may differ from the one before it
+    bool d_wasChanged;
+
     // holds the update between the last two snapshots (not owned)
     bmqstm::StatContextUpdate* d_update_p;
 
@@ -686,16 +703,29 @@ class StatContext {
     /// StatContext.
     ValueVec* getTotalValuesVec();
 
-    /// Snapshot the specified `subcontext`
-    void snapshotSubcontext(StatContext*       subcontext,
+    /// Mark this context as updated since its last snapshot.
+    void markDirty();
+
+    /// Snapshot the specified `subcontext`, and return `true` if its new
+    /// snapshot is identical to its previous one, and `false` otherwise.
+    bool snapshotSubcontext(StatContext*       subcontext,
                             bsls::Types::Int64 snapshotTime);
 
-    /// Snapshot all values of all subcontexts.
-    void snapshotImp(bsls::Types::Int64 snapshotTime);
+    /// Add the latest snapshot of the values of the specified `subcontext`
+    /// to the total of the active subcontexts.
+    void addSubcontextValues(const StatContext* subcontext);
+
+    /// Snapshot all values of all subcontexts, and return `true` if the new
+    /// snapshot of this context and all its subcontexts is identical to
+    /// their previous one, and `false` otherwise.
+    bool snapshotImp(bsls::Types::Int64 snapshotTime);
 
     /// Imp of `cleanup`.  Add the direct values of all subcontexts
-    /// being deleted to the specified `expiredValuesVec`
-    void cleanupImp(bsl::vector<ValueVec*>* expiredValuesVec);
+    /// being deleted to the specified `expiredValuesVec`.  Return `true` if
+    /// the cleanup changed this context or any of its subcontexts, i.e. a
+    /// subcontext was deleted or expired values were created, and `false`
+    /// otherwise.
+    bool cleanupImp(bsl::vector<ValueVec*>* expiredValuesVec);
 
     /// Update the values of this context and all subcontexts based on the
     /// contents of the specified `update`.
@@ -754,7 +784,7 @@ class StatContext {
     /// @param value The value to report.
     /// @note Thread: any
     /// The behavior is undefined unless the value corresponding to the
-    /// `valueKey` is discrete.
+    /// `valueKey` is discrete or distribution.
     void reportValue(int valueKey, bsls::Types::Int64 value);
 
     /// @brief Snapshot all values of all subcontexts, then snapshot the
@@ -1083,22 +1113,36 @@ inline StatContext::~StatContext()
 }
 
 // MANIPULATORS
+inline void StatContext::markDirty()
+{
+    // Only write the flag once per snapshot interval, to avoid contention on
+    // its cache line between the threads updating this context.  The value
+    // is updated before the flag is set, so that an update racing with a
+    // snapshot is at worst taken into account by the next one.
+    if (!d_isDirty.loadRelaxed()) {
+        d_isDirty.storeRelease(true);
+    }
+}
+
 inline void StatContext::adjustValue(int valueKey, bsls::Types::Int64 delta)
 {
     BSLS_ASSERT(valueKey < static_cast<int>(d_directValues_p->size()));
     (*d_directValues_p)[valueKey].adjustValue(delta);
+    markDirty();
 }
 
 inline void StatContext::setValue(int valueKey, bsls::Types::Int64 value)
 {
     BSLS_ASSERT(valueKey < static_cast<int>(d_directValues_p->size()));
     (*d_directValues_p)[valueKey].setValue(value);
+    markDirty();
 }
 
 inline void StatContext::reportValue(int valueKey, bsls::Types::Int64 value)
 {
     BSLS_ASSERT(valueKey < static_cast<int>(d_directValues_p->size()));
     (*d_directValues_p)[valueKey].reportValue(value);
+    markDirty();
 }
 
 // ACCESSORS
@@ -14,6 +14,7 @@
 // limitations under the License.
 
 // Component under test
+#include <bmqst_histogram.h>
 #include <bmqst_printutil.h>
 #include <bmqst_statcontext.h>
 #include <bmqst_statcontexttableinfoprovider.h>
@@ -33,6 +34,7 @@
 #include <bslma_default.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
+#include <bsls_timeutil.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -56,6 +58,9 @@ using namespace bmqst;
 // [ 4] Usage example with value level
 // [ 4] Test updates
 // [ 5] Usage examples with updates
+// [ 9] Distribution value
+// [10] Idle snapshots
+// [-1] Idle snapshots performance
 //-----------------------------------------------------------------------------
 
 //=============================================================================
@@ -176,6 +181,67 @@ static const StatValue& direct(const StatContext& context, int index)
     return context.value(StatContext::e_DIRECT_VALUE, index);
 }
 
+/// Return `true` if the snapshots at every location of the specified
+/// `value` are identical, except for their time, to those of the specified
+/// `expected` value, and `false` otherwise.
+static bool isSameHistory(const StatValue& value, const StatValue& expected)
+{
+    bsl::vector<bsls::Types::Int64> snapshotValues;
+    bsl::vector<bsls::Types::Int64> expectedValues;
+    for (int level = 0; level < value.numLevels(); ++level) {
+        for (int index = 0; index < value.historySize(level); ++index) {
+            const StatValue::SnapshotLocation location(level, index);
+            const StatValue::Snapshot&        snapshot = value.snapshot(
+                location);
+            const StatValue::Snapshot& expectedSnapshot = expected.snapshot(
+                location);
+
+            snapshotValues.push_back(snapshot.value());
+            snapshotValues.push_back(snapshot.min());
+            snapshotValues.push_back(snapshot.max());
+            snapshotValues.push_back(snapshot.increments());
+            snapshotValues.push_back(snapshot.decrements());
+            expectedValues.push_back(expectedSnapshot.value());
+            expectedValues.push_back(expectedSnapshot.min());
+            expectedValues.push_back(expectedSnapshot.max());
+            expectedValues.push_back(expectedSnapshot.increments());
+            expectedValues.push_back(expectedSnapshot.decrements());
+
+            if (value.type() == StatValue::e_DISTRIBUTION) {
+                const Histogram& histogram = value.histogram(location);
+                const Histogram& expectedHistogram = expected.histogram(
+                    location);
+
+                snapshotValues.push_back(histogram.count());
+                snapshotValues.push_back(histogram.valueAtPercentile(50));
+                expectedValues.push_back(expectedHistogram.count());
+                expectedValues.push_back(
+                    expectedHistogram.valueAtPercentile(50));
+            }
+        }
+    }
+
+    ASSERT_EQUALS(expectedValues, snapshotValues);
+    return expectedValues == snapshotValues;
+}
+
+/// Return `true` if all the values of the specified `valueType` of the
+/// specified `context` have the same history as those of the specified
+/// `expected` context, and `false` otherwise.
+static bool isSameHistory(const StatContext&     context,
+                          const StatContext&     expected,
+                          StatContext::ValueType valueType)
+{
+    bool result = true;
+    for (int i = 0; i < context.numValues(); ++i) {
+        if (!isSameHistory(context.value(valueType, i),
+                           expected.value(valueType, i))) {
+            result = false;
+        }
+    }
+    return result;
+}
+
 //=============================================================================
 //                              TEST CASES
 //-----------------------------------------------------------------------------
@@ -1090,6 +1156,270 @@ static void testUserData(bslma::Allocator* allocator)
     ASSERT(NULL == ptr);
 }
 
+static void testDistribution(bslma::Allocator* allocator)
+{
+    // ------------------------------------------------------------------------
+    // DISTRIBUTION VALUE
+    //
+    // Concerns:
+    //   That the percentiles of the values reported to a distribution value
+    //   are returned for a range of snapshots, including aggregated ones,
+    //   within the bounded relative error of the histogram.
+    // ------------------------------------------------------------------------
+
+    typedef bmqst::StatValue::SnapshotLocation Location;
+
+    enum { e_LATENCY = 0 };
+    const int numSnapshots    = 10 + 1;
+    const int numAggSnapshots = 2 + 1;
+
+    bmqst::StatContext context(
+        bmqst::StatContextConfiguration("test")
+            .value("latency", bmqst::StatValue::e_DISTRIBUTION, numSnapshots)
+            .valueLevel(numAggSnapshots),
+        allocator);
+
+    const bmqst::StatValue& value =
+        context.value(bmqst::StatContext::e_DIRECT_VALUE, e_LATENCY);
+
+    // Nothing reported
+    context.snapshot();
+    ASSERT_EQUALS(bmqst::StatUtil::percentile(value, 0, 1, 50), 0);
+
+    // Report 1..100
+    for (int i = 1; i <= 100; ++i) {
+        context.reportValue(e_LATENCY, i);
+    }
+    context.snapshot();
+
+    ASSERT_EQUALS(bmqst::StatUtil::events(value, 0), 100);
+    ASSERT_LE(50, bmqst::StatUtil::percentile(value, 0, 1, 50));
+    ASSERT_LE(bmqst::StatUtil::percentile(value, 0, 1, 50), 50 + 50 / 16);
+    ASSERT_EQUALS(bmqst::StatUtil::percentile(value, 1, 0, 50),
+                  bmqst::StatUtil::percentile(value, 0, 1, 50));
+    ASSERT_EQUALS(bmqst::StatUtil::percentile(value, 0, 0, 50),
+                  bmqst::StatUtil::percentile(value, 0, 1, 50));
+
+    // The percentiles are capped by the maximum reported value
+    ASSERT_EQUALS(bmqst::StatUtil::percentile(value, 0, 1, 100), 100);
+
+    // Report 1001..1100
+    for (int i = 1001; i <= 1100; ++i) {
+        context.reportValue(e_LATENCY, i);
+    }
+    context.snapshot();
+
+    ASSERT_LE(1050, bmqst::StatUtil::percentile(value, 0, 1, 50));
+    ASSERT_LE(bmqst::StatUtil::percentile(value, 0, 1, 50),
+              1050 + 1050 / 16);
+
+    // Both snapshots
+    ASSERT_LE(100, bmqst::StatUtil::percentile(value, 0, 2, 50));
+    ASSERT_LE(bmqst::StatUtil::percentile(value, 0, 2, 50), 100 + 100 / 16);
+    ASSERT_LE(1090, bmqst::StatUtil::percentile(value, 0, 2, 95));
+    ASSERT_EQUALS(bmqst::StatUtil::percentile(value, 0, 3, 0), 1);
+
+    // Histograms of the snapshots are merged into the result
+    bmqst::Histogram histogram(allocator);
+    bmqst::StatUtil::loadHistogram(&histogram, value, 0, 1);
+    ASSERT_EQUALS(histogram.count(), 100);
+    ASSERT_EQUALS(histogram.valueAtPercentile(0),
+                  bmqst::Histogram::bucketHighestValue(
+                      bmqst::Histogram::bucketIndex(1001)));
+    bmqst::StatUtil::loadHistogram(&histogram, value, 1, 2);
+    ASSERT_EQUALS(histogram.count(), 200);
+    ASSERT_EQUALS(histogram.valueAtPercentile(0), 1);
+
+    // Aggregation of the first level
+    for (int i = 3; i < numSnapshots; ++i) {
+        context.snapshot();
+    }
+    ASSERT_EQUALS(bmqst::StatUtil::percentile(value, 0, 1, 50), 0);
+    ASSERT_EQUALS(
+        bmqst::StatUtil::percentile(value, Location(1, 0), Location(1, 0), 50),
+        bmqst::StatUtil::percentile(value, 0, numSnapshots - 1, 50));
+    ASSERT_EQUALS(
+        bmqst::StatUtil::percentile(value, Location(1, 0), Location(1, 0), 0),
+        1);
+}
+
+static void testIdleSnapshots(bslma::Allocator* allocator)
+{
+    // ------------------------------------------------------------------------
+    // IDLE SNAPSHOTS
+    //
+    // Concerns:
+    //   That the snapshot of a context idle during the last two snapshot
+    //   intervals, which is copied from its previous snapshot, is identical
+    //   to the one taken from its current stats, at every level of the
+    //   history, for every type of value, and while subcontexts are added
+    //   and deleted.
+    //
+    // Plan:
+    //   Report the same values to two identical tables, and mark every
+    //   context of the expected table as changed before each of its
+    //   snapshots by adjusting a value by '0'.  Verify that the histories of
+    //   both tables are the same after each snapshot.
+    // ------------------------------------------------------------------------
+
+    enum { e_IN = 0, e_MAX = 1, e_LATENCY = 2, e_POKE = 3 };
+
+    bmqst::StatContextConfiguration config("test", allocator);
+    config.isTable(true)
+        .storeExpiredSubcontextValues(true)
+        .value("In", 4)
+        .valueLevel(3)
+        .value("Max", bmqst::StatValue::e_DISCRETE, 4)
+        .valueLevel(3)
+        .value("Latency", bmqst::StatValue::e_DISTRIBUTION, 4)
+        .valueLevel(3)
+        .value("Poke", 4);
+
+    bmqst::StatContext context(config, allocator);
+    bmqst::StatContext expected(config, allocator);
+
+    bslma::ManagedPtr<bmqst::StatContext> a = context.addSubcontext(
+        bmqst::StatContextConfiguration("a", allocator));
+    bslma::ManagedPtr<bmqst::StatContext> expectedA = expected.addSubcontext(
+        bmqst::StatContextConfiguration("a", allocator));
+    bslma::ManagedPtr<bmqst::StatContext> b = context.addSubcontext(
+        bmqst::StatContextConfiguration("b", allocator));
+    bslma::ManagedPtr<bmqst::StatContext> expectedB = expected.addSubcontext(
+        bmqst::StatContextConfiguration("b", allocator));
+    bslma::ManagedPtr<bmqst::StatContext> c;
+    bslma::ManagedPtr<bmqst::StatContext> expectedC;
+
+    for (int i = 0; i < 40; ++i) {
+        // Bursts of activity separated by idle intervals
+        if (a && (i % 9 == 0 || i == 1)) {
+            a->adjustValue(e_IN, i + 1);
+            a->reportValue(e_MAX, i);
+            a->reportValue(e_LATENCY, 10 * i + 1);
+            expectedA->adjustValue(e_IN, i + 1);
+            expectedA->reportValue(e_MAX, i);
+            expectedA->reportValue(e_LATENCY, 10 * i + 1);
+        }
+        if (i == 5 || i == 6) {
+            b->reportValue(e_MAX, i);
+            expectedB->reportValue(e_MAX, i);
+        }
+        if (i == 12) {
+            c = context.addSubcontext(
+                bmqst::StatContextConfiguration("c", allocator));
+            expectedC = expected.addSubcontext(
+                bmqst::StatContextConfiguration("c", allocator));
+        }
+        if (i == 14 || i == 30) {
+            c->adjustValue(e_IN, -3);
+            c->reportValue(e_LATENCY, 1000);
+            expectedC->adjustValue(e_IN, -3);
+            expectedC->reportValue(e_LATENCY, 1000);
+        }
+        if (i == 17) {
+            context.adjustValue(e_IN, 7);
+            expected.adjustValue(e_IN, 7);
+        }
+        if (i == 20) {
+            a.reset();
+            expectedA.reset();
+        }
+
+        expected.adjustValue(e_POKE, 0);
+        if (expectedA) {
+            expectedA->adjustValue(e_POKE, 0);
+        }
+        expectedB->adjustValue(e_POKE, 0);
+        if (expectedC) {
+            expectedC->adjustValue(e_POKE, 0);
+        }
+
+        context.snapshot();
+        expected.snapshot();
+        context.cleanup();
+        expected.cleanup();
+
+        PV("Snapshot " << i);
+
+        ASSERT(isSameHistory(context, expected, StatContext::e_DIRECT_VALUE));
+        ASSERT(isSameHistory(context, expected, StatContext::e_TOTAL_VALUE));
+        ASSERT(isSameHistory(context,
+                             expected,
+                             StatContext::e_ACTIVE_CHILDREN_TOTAL_VALUE));
+        ASSERT(
+            isSameHistory(context, expected, StatContext::e_EXPIRED_VALUE));
+        if (a) {
+            ASSERT(isSameHistory(*a, *expectedA, StatContext::e_DIRECT_VALUE));
+        }
+        ASSERT(isSameHistory(*b, *expectedB, StatContext::e_DIRECT_VALUE));
+        if (c) {
+            ASSERT(isSameHistory(*c, *expectedC, StatContext::e_DIRECT_VALUE));
+        }
+    }
+
+    // The deleted subcontext was added to the expired values
+    ASSERT_EQUALS(context.numSubcontexts(), 2);
+    ASSERT_EQUALS(bmqst::StatUtil::events(
+                      context.value(StatContext::e_EXPIRED_VALUE, e_MAX),
+                      0),
+                  4);
+}
+
+static void testN1_idleSnapshotsPerformance(bslma::Allocator* allocator)
+{
+    // ------------------------------------------------------------------------
+    // IDLE SNAPSHOTS PERFORMANCE
+    //
+    // Concerns:
+    //   Compare the time to snapshot a table with many subcontexts when all
+    //   of them are active and when all of them are idle.
+    // ------------------------------------------------------------------------
+
+    const int k_NUM_SUBCONTEXTS = 50000;
+    const int k_NUM_SNAPSHOTS   = 20;
+
+    bmqst::StatContext context(
+        bmqst::StatContextConfiguration("test", allocator)
+            .isTable(true)
+            .value("In", 10)
+            .value("Latency", bmqst::StatValue::e_DISTRIBUTION, 10),
+        allocator);
+
+    bsl::vector<bslma::ManagedPtr<bmqst::StatContext> > subcontexts(
+        k_NUM_SUBCONTEXTS,
+        allocator);
+    for (int i = 0; i < k_NUM_SUBCONTEXTS; ++i) {
+        subcontexts[i] = context.addSubcontext(
+            bmqst::StatContextConfiguration(i, allocator));
+    }
+
+    // Active subcontexts
+    bsls::Types::Int64 activeTime = 0;
+    for (int n = 0; n < k_NUM_SNAPSHOTS; ++n) {
+        for (int i = 0; i < k_NUM_SUBCONTEXTS; ++i) {
+            subcontexts[i]->adjustValue(0, 1);
+            subcontexts[i]->reportValue(1, n);
+        }
+        const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+        context.snapshot();
+        activeTime += bsls::TimeUtil::getTimer() - begin;
+    }
+
+    // Idle subcontexts.  The first two snapshots are taken from the current
+    // stats.
+    context.snapshot();
+    context.snapshot();
+    bsls::Types::Int64 idleTime = 0;
+    for (int n = 0; n < k_NUM_SNAPSHOTS; ++n) {
+        const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+        context.snapshot();
+        idleTime += bsls::TimeUtil::getTimer() - begin;
+    }
+
+    cout << "Snapshot of " << k_NUM_SUBCONTEXTS << " subcontexts:" << endl
+         << "  active: " << activeTime / k_NUM_SNAPSHOTS << " ns" << endl
+         << "  idle  : " << idleTime / k_NUM_SNAPSHOTS << " ns" << endl;
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -1125,6 +1455,30 @@ int main(int argc, char** argv)
 
     switch (test) {
     case 0:  // Zero is always the leading case.
+    case 10: {
+        // --------------------------------------------------------------------
+        // TEST IDLE SNAPSHOTS
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "TEST IDLE SNAPSHOTS" << endl
+                 << "===================" << endl;
+        testIdleSnapshots(&ta);
+    } break;
+
+    case 9: {
+        // --------------------------------------------------------------------
+        // TEST DISTRIBUTION
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "TEST DISTRIBUTION" << endl
+                 << "=================" << endl;
+        testDistribution(&ta);
+    } break;
+
     case 8: {
         // --------------------------------------------------------------------
         // TEST USER DATA ABI COMPATIBILITY
@@ -1209,6 +1563,18 @@ int main(int argc, char** argv)
         usageExample(cout, &ta);
     } break;
 
+    case -1: {
+        // --------------------------------------------------------------------
+        // IDLE SNAPSHOTS PERFORMANCE
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "IDLE SNAPSHOTS PERFORMANCE" << endl
+                 << "==========================" << endl;
+        testN1_idleSnapshotsPerformance(&ta);
+    } break;
+
     default:
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
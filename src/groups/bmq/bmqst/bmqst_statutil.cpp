@@ -347,7 +347,7 @@ bsls::Types::Int64
 StatUtil::events(const StatValue&                   value,
                  const StatValue::SnapshotLocation& snapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::e_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::e_CONTINUOUS);
     return value.snapshot(snapshot).events();
 }
 
@@ -356,7 +356,7 @@ StatUtil::eventsDifference(const StatValue&                   value,
                            const StatValue::SnapshotLocation& firstSnapshot,
                            const StatValue::SnapshotLocation& secondSnapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::e_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::e_CONTINUOUS);
 
     return value.snapshot(firstSnapshot).events() -
            value.snapshot(secondSnapshot).events();
@@ -365,7 +365,7 @@ StatUtil::eventsDifference(const StatValue&                   value,
 bsls::Types::Int64 StatUtil::sum(const StatValue&                   value,
                                  const StatValue::SnapshotLocation& snapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::e_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::e_CONTINUOUS);
     return value.snapshot(snapshot).sum();
 }
 
@@ -374,7 +374,7 @@ StatUtil::sumDifference(const StatValue&                   value,
                         const StatValue::SnapshotLocation& firstSnapshot,
                         const StatValue::SnapshotLocation& secondSnapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::e_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::e_CONTINUOUS);
 
     return value.snapshot(firstSnapshot).sum() -
            value.snapshot(secondSnapshot).sum();
@@ -385,7 +385,7 @@ StatUtil::averagePerEvent(const StatValue&                   value,
                           const StatValue::SnapshotLocation& firstSnapshot,
                           const StatValue::SnapshotLocation& secondSnapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::e_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::e_CONTINUOUS);
 
     bsls::Types::Int64 events = eventsDifference(value,
                                                  firstSnapshot,
@@ -406,7 +406,7 @@ double StatUtil::averagePerEventReal(
     const StatValue::SnapshotLocation& firstSnapshot,
     const StatValue::SnapshotLocation& secondSnapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::e_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::e_CONTINUOUS);
 
     bsls::Types::Int64 events = eventsDifference(value,
                                                  firstSnapshot,
@@ -422,5 +422,79 @@ double StatUtil::averagePerEventReal(
     }
 }
 
+bsls::Types::Int64
+StatUtil::percentile(const StatValue&                   value,
+                     const StatValue::SnapshotLocation& firstSnapshot,
+                     const StatValue::SnapshotLocation& secondSnapshot,
+                     double                             percentile)
+{
+    BSLS_ASSERT(value.type() == StatValue::e_DISTRIBUTION);
+    BSLS_ASSERT(firstSnapshot.level() == secondSnapshot.level());
+
+    const int start = bsl::min(firstSnapshot.index(), secondSnapshot.index());
+    const int end   = bsl::max(bsl::max(firstSnapshot.index(),
+                                      secondSnapshot.index()),
+                             start + 1);
+
+    // The values reported between the two snapshots are those of the
+    // snapshots from the most recent one up to, but excluding, the oldest
+    // one.  Cumulate their histograms into a dense array of counts, which
+    // avoids allocating memory.
+    bsls::Types::Int64 counts[Histogram::k_NUM_BUCKETS] = {0};
+    bsls::Types::Int64 count = 0;
+    bsls::Types::Int64 max   = bsl::numeric_limits<bsls::Types::Int64>::min();
+    for (StatValue::SnapshotLocation loc(firstSnapshot.level(), start);
+         loc.index() < end;
+         loc.setIndex(loc.index() + 1)) {
+        const Histogram& histogram = value.histogram(loc);
+        for (Histogram::Buckets::const_iterator it =
+                 histogram.buckets().begin();
+             it != histogram.buckets().end();
+             ++it) {
+            counts[it->first] += it->second;
+        }
+        count += histogram.count();
+        max = bsl::max(max, value.snapshot(loc).max());
+    }
+
+    if (count == 0) {
+        return 0;  // RETURN
+    }
+
+    // The highest value of a bucket may exceed the maximum reported value.
+    const bsls::Types::Int64 rank = Histogram::percentileRank(percentile,
+                                                              count);
+    bsls::Types::Int64 cumulated = 0;
+    for (int i = 0; i < Histogram::k_NUM_BUCKETS; ++i) {
+        cumulated += counts[i];
+        if (cumulated >= rank) {
+            return bsl::min(Histogram::bucketHighestValue(i), max);  // RETURN
+        }
+    }
+
+    return max;
+}
+
+void StatUtil::loadHistogram(Histogram*                         result,
+                             const StatValue&                   value,
+                             const StatValue::SnapshotLocation& firstSnapshot,
+                             const StatValue::SnapshotLocation& secondSnapshot)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(value.type() == StatValue::e_DISTRIBUTION);
+    BSLS_ASSERT(firstSnapshot.level() == secondSnapshot.level());
+
+    const int start = bsl::min(firstSnapshot.index(), secondSnapshot.index());
+    const int end   = bsl::max(bsl::max(firstSnapshot.index(),
+                                      secondSnapshot.index()),
+                             start + 1);
+
+    for (StatValue::SnapshotLocation loc(firstSnapshot.level(), start);
+         loc.index() < end;
+         loc.setIndex(loc.index() + 1)) {
+        result->add(value.histogram(loc));
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -210,9 +210,9 @@ struct StatUtil {
     /// returned.
     static bsls::Types::Int64 absoluteMax(const StatValue& value);
 
-    // ** Discrete StatValue functions only       **
-    // ** The behavior is undefined unless        **
-    // ** 'value.type() == StatValue::e_DISCRETE' **
+    // ** Discrete and distribution StatValue functions only **
+    // ** The behavior is undefined unless                   **
+    // ** 'value.type() != StatValue::e_CONTINUOUS'          **
 
     /// Return the total number of events recorded by the
     /// specified `value` up to the specified `snapshot`.
@@ -256,6 +256,33 @@ struct StatUtil {
     averagePerEventReal(const StatValue&                   value,
                         const StatValue::SnapshotLocation& firstSnapshot,
                         const StatValue::SnapshotLocation& secondSnapshot);
+
+    // ** Distribution StatValue functions only       **
+    // ** The behavior is undefined unless            **
+    // ** 'value.type() == StatValue::e_DISTRIBUTION' **
+
+    /// Return the value at the specified `percentile` of the values
+    /// reported to the specified `value` between the specified
+    /// `firstSnapshot` and the specified `secondSnapshot`, or 0 if nothing
+    /// was reported.  The returned value is the highest value of the
+    /// histogram bucket containing the percentile, capped by the maximum
+    /// reported value, and is therefore at most 6.25% higher than the exact
+    /// percentile.  The behavior is undefined unless
+    /// `0 <= percentile <= 100`.
+    static bsls::Types::Int64
+    percentile(const StatValue&                   value,
+               const StatValue::SnapshotLocation& firstSnapshot,
+               const StatValue::SnapshotLocation& secondSnapshot,
+               double                             percentile);
+
+    /// Add to the specified `result` the histogram of the values reported
+    /// to the specified `value` between the specified `firstSnapshot` and
+    /// the specified `secondSnapshot`.
+    static void
+    loadHistogram(Histogram*                         result,
+                  const StatValue&                   value,
+                  const StatValue::SnapshotLocation& firstSnapshot,
+                  const StatValue::SnapshotLocation& secondSnapshot);
 };
 
 }  // close package namespace
@@ -70,6 +70,20 @@ void StatValue::aggregateLevel(int level, bsls::Types::Int64 snapshotTime)
         aggSnapshot.d_max        = bsl::max(aggSnapshot.d_max, snapshot.d_max);
     }
 
+    if (d_type == e_DISTRIBUTION) {
+        // The aggregated snapshot covers all the snapshots of the previous
+        // level.
+        Histogram& aggHistogram =
+            d_histograms[d_curSnapshotIndices[level + 1] +
+                         d_levelStartIndices[level + 1]];
+        aggHistogram.reset();
+        for (int i = d_levelStartIndices[level];
+             i < d_levelStartIndices[level + 1];
+             ++i) {
+            aggHistogram.add(d_histograms[i]);
+        }
+    }
+
     if (d_curSnapshotIndices[level + 1] == 0) {
         // Advance to the next aggregation level
         aggregateLevel(level + 1, snapshotTime);
@@ -85,6 +99,8 @@ StatValue::StatValue(bslma::Allocator* basicAllocator)
 , d_curSnapshotIndices(basicAllocator)
 , d_min(0)
 , d_max(0)
+, d_currentHistogram(basicAllocator)
+, d_histograms(basicAllocator)
 {
 }
 
@@ -99,6 +115,8 @@ StatValue::StatValue(const bsl::vector<int>& sizes,
 , d_curSnapshotIndices(basicAllocator)
 , d_min(0)
 , d_max(0)
+, d_currentHistogram(basicAllocator)
+, d_histograms(basicAllocator)
 {
     init(sizes, type, initTime);
 }
@@ -111,6 +129,8 @@ StatValue::StatValue(const StatValue& other, bslma::Allocator* basicAllocator)
 , d_curSnapshotIndices(other.d_curSnapshotIndices, basicAllocator)
 , d_min(other.d_min)
 , d_max(other.d_max)
+, d_currentHistogram(other.d_currentHistogram, basicAllocator)
+, d_histograms(other.d_histograms, basicAllocator)
 {
 }
 
@@ -123,6 +143,8 @@ StatValue& StatValue::operator=(const StatValue& rhs)
     d_curSnapshotIndices = rhs.d_curSnapshotIndices;
     d_min                = rhs.d_min;
     d_max                = rhs.d_max;
+    d_currentHistogram   = rhs.d_currentHistogram;
+    d_histograms         = rhs.d_histograms;
 
     return *this;
 }
@@ -163,6 +185,11 @@ void StatValue::addSnapshot(const StatValue& other)
 
     d_currentStats.d_incrementsOrEvents += otherSnapshot.d_incrementsOrEvents;
     d_currentStats.d_decrementsOrSum += otherSnapshot.d_decrementsOrSum;
+
+    if (d_type == e_DISTRIBUTION) {
+        d_currentHistogram.add(
+            other.d_histograms[other.d_curSnapshotIndices[0]]);
+    }
 }
 
 void StatValue::setFromUpdate(const bmqstm::StatValueUpdate& update)
@@ -242,6 +269,10 @@ void StatValue::takeSnapshot(bsls::Types::Int64 snapshotTime)
     snapshot.d_decrementsOrSum    = decrementsOrSum;
     snapshot.d_snapshotTime       = snapshotTime;
 
+    if (d_type == e_DISTRIBUTION) {
+        d_currentHistogram.moveTo(&d_histograms[d_curSnapshotIndices[0]]);
+    }
+
     if (d_curSnapshotIndices[0] == 0) {
         // We've performed enough snapshots to advance to the next aggregation
         // level
@@ -249,16 +280,42 @@ void StatValue::takeSnapshot(bsls::Types::Int64 snapshotTime)
     }
 }
 
+void StatValue::repeatSnapshot(bsls::Types::Int64 snapshotTime)
+{
+    const int latestIndex = d_curSnapshotIndices[0];
+    const int levelSize   = d_levelStartIndices[1] - d_levelStartIndices[0];
+    d_curSnapshotIndices[0] = (latestIndex + 1) % levelSize;
+
+    Snapshot& snapshot      = d_history[d_curSnapshotIndices[0]];
+    snapshot                = d_history[latestIndex];
+    snapshot.d_snapshotTime = snapshotTime;
+
+    if (d_type == e_DISTRIBUTION) {
+        // Nothing was reported during the latest snapshot either, so its
+        // histogram is empty.
+        d_histograms[d_curSnapshotIndices[0]].reset();
+    }
+
+    if (d_curSnapshotIndices[0] == 0) {
+        aggregateLevel(0, snapshotTime);
+    }
+}
+
 void StatValue::clear(bsls::Types::Int64 snapshotTime)
 {
-    d_currentStats.reset(d_type == e_DISCRETE, 0);
+    d_currentStats.reset(d_type != e_CONTINUOUS, 0);
     d_curSnapshotIndices.assign(d_curSnapshotIndices.size(), 0);
 
     for (size_t i = 0; i < d_history.size(); ++i) {
-        d_history[i].reset(d_type == e_DISCRETE, snapshotTime);
+        d_history[i].reset(d_type != e_CONTINUOUS, snapshotTime);
     }
 
-    if (d_type == e_DISCRETE) {
+    d_currentHistogram.reset();
+    for (size_t i = 0; i < d_histograms.size(); ++i) {
+        d_histograms[i].reset();
+    }
+
+    if (d_type != e_CONTINUOUS) {
         d_min = MAX_INT;
         d_max = MIN_INT;
     }
@@ -275,9 +332,9 @@ void StatValue::init(const bsl::vector<int>& sizes,
     d_type = type;
     d_levelStartIndices.resize(sizes.size() + 1);
     d_curSnapshotIndices.assign(sizes.size(), 0);
-    d_min = (d_type == e_DISCRETE ? MAX_INT : 0);
-    d_max = (d_type == e_DISCRETE ? MIN_INT : 0);
-    d_currentStats.reset(d_type == e_DISCRETE, 0);
+    d_min = (d_type != e_CONTINUOUS ? MAX_INT : 0);
+    d_max = (d_type != e_CONTINUOUS ? MIN_INT : 0);
+    d_currentStats.reset(d_type != e_CONTINUOUS, 0);
 
     int historySize = 0;
     for (size_t i = 0; i < sizes.size(); ++i) {
@@ -290,7 +347,13 @@ void StatValue::init(const bsl::vector<int>& sizes,
     d_history.resize(historySize);
 
     for (size_t i = 0; i < d_history.size(); ++i) {
-        d_history[i].reset(d_type == e_DISCRETE, snapshotTime);
+        d_history[i].reset(d_type != e_CONTINUOUS, snapshotTime);
+    }
+
+    d_currentHistogram.reset();
+    d_histograms.clear();
+    if (d_type == e_DISTRIBUTION) {
+        d_histograms.resize(historySize);
     }
 }
 
@@ -319,6 +382,9 @@ StatValue::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("CurSnapshotIndices", d_curSnapshotIndices);
     printer.printAttribute("Min", d_min);
     printer.printAttribute("Max", d_max);
+    if (d_type == e_DISTRIBUTION) {
+        printer.printAttribute("Histograms", d_histograms);
+    }
     printer.end();
 
     return stream;
@@ -408,14 +474,14 @@ void StatValueUtil::loadUpdateImp(bmqstm::StatValueUpdate* update,
                 }
             } break;
             case Fields::E_EVENTS: {
-                if (StatValue::e_DISCRETE == value.type() &&
+                if (StatValue::e_CONTINUOUS != value.type() &&
                     (full || current.events() != last->events())) {
                     update->fields().push_back(current.events());
                     mask = bdlb::BitUtil::withBitSet(mask, i);
                 }
             } break;
             case Fields::E_SUM: {
-                if (StatValue::e_DISCRETE == value.type() &&
+                if (StatValue::e_CONTINUOUS != value.type() &&
                     (full || current.sum() != last->sum())) {
                     update->fields().push_back(current.sum());
                     mask = bdlb::BitUtil::withBitSet(mask, i);
@@ -30,13 +30,25 @@
 // maintains a value and collects statistics about it and changes to it.  It
 // can be asked to calculate a number of statistics over its history.
 //
+// A distribution 'StatValue' additionally records the distribution of the
+// values reported to it in a 'bmqst::Histogram' per snapshot, from which
+// percentiles over any range of snapshots are computed by
+// 'bmqst::StatUtil::percentile'.  This costs, per 'StatValue', nothing until
+// a value is reported, then the live counters of a 'bmqst::AtomicHistogram'
+// (typically under 1 KB, at most about 3.3 KB) plus, in each snapshot, 16
+// bytes per non-empty bucket.  Distributions are therefore best enabled on
+// the few contexts which need percentiles rather than on every one.
+//
 // You probably should not use this class directly.  Instead, you should use
 // the 'bmqst::StatContext' component.  Refer to the usage examples in the
 // documentation of that component.
 //
 /// Thread Safety
 ///-------------
-// 'adjustValue' and 'setValue' are thread-safe.  All other functions are not.
+// 'adjustValue', 'setValue' and 'reportValue' are thread-safe.  All other
+// functions are not.
+
+#include <bmqst_histogram.h>
 
 #include <bslim_printer.h>
 #include <bslma_usesbslmaallocator.h>
@@ -198,7 +210,13 @@ class StatValue {
         /// are added, their set of reported events is simply considered as
         /// a single stream of events.  For example, the max of two added
         /// discrete values will be the max of all the individual maxes.
-        e_DISCRETE = 1
+        e_DISCRETE = 1,
+
+        /// A distribution value is a discrete value which also records the
+        /// histogram of the reported values, from which their percentiles
+        /// are computed.  When two distribution values are added, their
+        /// histograms are merged.
+        e_DISTRIBUTION = 2
     };
 
   private:
@@ -229,6 +247,17 @@ class StatValue {
 
     bsls::Types::Int64 d_max;  // max value since creation
 
+    AtomicHistogram d_currentHistogram;
+    // Histogram of the values reported
+    // since the last snapshot, if
+    // distribution value
+
+    bsl::vector<Histogram> d_histograms;
+    // Histogram of the values reported
+    // during each snapshot of
+    // 'd_history', if distribution
+    // value
+
     // PRIVATE MANIPULATORS
     void updateMinMax(bsls::Types::Int64 value);
 
@@ -236,6 +265,12 @@ class StatValue {
     /// aggregation level above it using the specified `snapshotTime`
     void aggregateLevel(int level, bsls::Types::Int64 snapshotTime);
 
+    // PRIVATE ACCESSORS
+
+    /// Return the index in `d_history` of the snapshot referred to by the
+    /// specified `location`.
+    int historyIndex(const SnapshotLocation& location) const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(StatValue, bslma::UsesBslmaAllocator)
@@ -260,7 +295,7 @@ class StatValue {
     void setValue(bsls::Types::Int64 value);
 
     /// Report the specified `value` to this StatValue.  The behavior is
-    /// undefined unless this is a discrete StatValue.
+    /// undefined unless this is a discrete or distribution StatValue.
     void reportValue(bsls::Types::Int64 value);
 
     /// Add the snapshot of the specified `other` StatValue to the current
@@ -274,6 +309,13 @@ class StatValue {
 
     void takeSnapshot(bsls::Types::Int64 snapshotTime);
 
+    /// Take a snapshot at the specified `snapshotTime` identical, except for
+    /// its time, to the latest one, without reading the current stats.  The
+    /// behavior is undefined unless `takeSnapshot` would produce the same
+    /// snapshot, i.e. nothing was reported to this value since the snapshot
+    /// before the latest one, and `takeSnapshot` was called at least once.
+    void repeatSnapshot(bsls::Types::Int64 snapshotTime);
+
     /// Clear all history and reset all snapshot's snapshotTime with the
     /// specified `clearTime`
     void clear(bsls::Types::Int64 clearTime);
@@ -317,6 +359,13 @@ class StatValue {
     /// `location.index() < historySize(location.level())`
     const Snapshot& snapshot(const SnapshotLocation& location) const;
 
+    /// Return the histogram of the values reported during the snapshot
+    /// referred to by the specified `location`, that is since the previous
+    /// snapshot of its level.  The behavior is undefined unless this is a
+    /// distribution StatValue, `location.level() < numLevels()` and
+    /// `location.index() < historySize(location.level())`.
+    const Histogram& histogram(const SnapshotLocation& location) const;
+
     /// Return the minimum value of this StatValue since creation.
     bsls::Types::Int64 min() const;
 
@@ -635,7 +684,11 @@ inline void StatValue::setValue(bsls::Types::Int64 value)
 
 inline void StatValue::reportValue(bsls::Types::Int64 value)
 {
-    BSLS_ASSERT(d_type == e_DISCRETE);
+    BSLS_ASSERT(d_type != e_CONTINUOUS);
+
+    if (d_type == e_DISTRIBUTION) {
+        d_currentHistogram.record(value);
+    }
 
     d_currentStats.d_decrementsOrSum += value;
     d_currentStats.d_incrementsOrEvents++;
@@ -645,7 +698,24 @@ inline void StatValue::reportValue(bsls::Types::Int64 value)
 
 inline void StatValue::clearCurrentStats()
 {
-    d_currentStats.reset(d_type == e_DISCRETE, 0);
+    d_currentStats.reset(d_type != e_CONTINUOUS, 0);
+    d_currentHistogram.reset();
+}
+
+// PRIVATE ACCESSORS
+inline int StatValue::historyIndex(const SnapshotLocation& location) const
+{
+    BSLS_ASSERT(location.level() < numLevels());
+    BSLS_ASSERT(location.index() < historySize(location.level()));
+
+    int snapshotIndex = d_curSnapshotIndices[location.level()];
+
+    int index = snapshotIndex - location.index();
+    if (index < 0) {
+        index += historySize(location.level());
+    }
+
+    return index + d_levelStartIndices[location.level()];
 }
 
 // ACCESSORS
@@ -671,17 +741,15 @@ inline int StatValue::historySize(int aggregationlevel) const
 inline const StatValue::Snapshot&
 StatValue::snapshot(const SnapshotLocation& location) const
 {
-    BSLS_ASSERT(location.level() < numLevels());
-    BSLS_ASSERT(location.index() < historySize(location.level()));
-
-    int snapshotIndex = d_curSnapshotIndices[location.level()];
+    return d_history[historyIndex(location)];
+}
 
-    int historyIndex = snapshotIndex - location.index();
-    if (historyIndex < 0) {
-        historyIndex += historySize(location.level());
-    }
+inline const Histogram&
+StatValue::histogram(const SnapshotLocation& location) const
+{
+    BSLS_ASSERT(d_type == e_DISTRIBUTION);
 
-    return d_history[historyIndex + d_levelStartIndices[location.level()]];
+    return d_histograms[historyIndex(location)];
 }
 
 inline bsls::Types::Int64 StatValue::min() const
@@ -18,6 +18,7 @@
 #include <bdlf_bind.h>
 #include <bdlma_localsequentialallocator.h>
 #include <bmqscm_version.h>
+#include <bmqst_statutil.h>
 #include <bsl_functional.h>
 #include <bslmf_allocatorargt.h>
 #include <bsls_alignedbuffer.h>
@@ -296,6 +297,28 @@ TableSchema::addColumn(const bslstl::StringRef& name,
     return addColumn(name, columnFn);
 }
 
+TableSchemaColumn& TableSchema::addPercentileColumn(
+    const bslstl::StringRef&           name,
+    int                                statIndex,
+    double                             percentile,
+    const StatValue::SnapshotLocation& snapshot1,
+    const StatValue::SnapshotLocation& snapshot2)
+{
+    IntFunc         intFn    = bdlf::BindUtil::bind(&StatUtil::percentile,
+                                         bdlf::PlaceHolders::_1,
+                                         snapshot1,
+                                         snapshot2,
+                                         percentile);
+    Column::ValueFn columnFn = bdlf::BindUtil::bind(&intFuncWrapper,
+                                                    bdlf::PlaceHolders::_1,
+                                                    bdlf::PlaceHolders::_2,
+                                                    bdlf::PlaceHolders::_4,
+                                                    statIndex,
+                                                    intFn);
+
+    return addColumn(name, columnFn);
+}
+
 // ACCESSORS
 int TableSchema::numColumns() const
 {
@@ -156,6 +156,17 @@ class TableSchema {
               const StatValue::SnapshotLocation& snapshot1,
               const StatValue::SnapshotLocation& snapshot2);
 
+    /// Add a column of the specified `name` holding the value at the
+    /// specified `percentile` of the values reported to the distribution
+    /// value of the specified `statIndex` between the specified `snapshot1`
+    /// and `snapshot2`, as returned by `StatUtil::percentile`.
+    TableSchemaColumn&
+    addPercentileColumn(const bslstl::StringRef&           name,
+                        int                                statIndex,
+                        double                             percentile,
+                        const StatValue::SnapshotLocation& snapshot1,
+                        const StatValue::SnapshotLocation& snapshot2);
+
     // ACCESSORS
     int                      numColumns() const;
     const TableSchemaColumn& column(int index) const;
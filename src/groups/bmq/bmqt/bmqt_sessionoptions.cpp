@@ -51,6 +51,8 @@ SessionOptions::SessionOptions(bslma::Allocator* allocator)
 , d_dtTracer_sp()
 , d_userAgentPrefix(allocator)
 , d_channelWriteTimeout(k_CHANNEL_WRITE_DEFAULT_TIMEOUT_SEC)
+, d_putLingerInterval()
+, d_putLingerMaxBytes(k_PUT_LINGER_DEFAULT_MAX_BYTES)
 {
     // NOTHING
 }
@@ -77,6 +79,8 @@ SessionOptions::SessionOptions(const SessionOptions& other,
 , d_dtTracer_sp(other.tracer())
 , d_userAgentPrefix(other.userAgentPrefix(), allocator)
 , d_channelWriteTimeout(other.d_channelWriteTimeout)
+, d_putLingerInterval(other.d_putLingerInterval)
+, d_putLingerMaxBytes(other.d_putLingerMaxBytes)
 {
     // NOTHING
 }
@@ -103,6 +107,8 @@ SessionOptions& SessionOptions::operator=(const SessionOptions& other)
         d_dtTracer_sp             = other.d_dtTracer_sp;
         d_userAgentPrefix         = other.d_userAgentPrefix;
         d_channelWriteTimeout     = other.d_channelWriteTimeout;
+        d_putLingerInterval       = other.d_putLingerInterval;
+        d_putLingerMaxBytes       = other.d_putLingerMaxBytes;
 
         // DEPRECATED: preserve current behavior from constructors.
         d_eventQueueSize = -1;
@@ -154,6 +160,9 @@ bsl::ostream& SessionOptions::print(bsl::ostream& stream,
                            d_hostHealthMonitor_sp != NULL);
     printer.printAttribute("hasDistributedTracing", d_dtTracer_sp != NULL);
     printer.printAttribute("userAgentPrefix", d_userAgentPrefix);
+    printer.printAttribute("putLingerInterval",
+                           d_putLingerInterval.totalSecondsAsDouble());
+    printer.printAttribute("putLingerMaxBytes", d_putLingerMaxBytes);
     printer.end();
 
     return stream;
@@ -45,6 +45,11 @@
 ///         immediately failover and reconnect to another entry from the
 ///         address list.
 ///
+///     Alternatively, when the broker runs on the same Linux host and is
+///     configured with a shared memory endpoint, the format
+///     `shm://<path>` connects to it through shared memory instead of TCP,
+///     where `path` is the path of the endpoint's socket.
+///
 ///     If the environment variable `BMQ_BROKER_URI` is set, then instances of
 ///     @bbref{bmqa::Session} will ignore the `brokerUri` field from the
 ///     provided @bbref{bmqt::SessionOptions} and use the value from this
@@ -127,6 +132,18 @@
 ///     characters long.  This is provided for libraries that are wrapping this
 ///     SDK.  Applications directly using the SDK are encouraged *NOT* to set
 ///     this value.
+///
+///   - *putLingerInterval*,
+///     *putLingerMaxBytes*:
+///     Latency budget granted to the SDK to coalesce PUT messages.  When
+///     `putLingerInterval` is not zero, messages posted by independent calls
+///     to `post` (possibly on different queues) are held for up to this
+///     interval, and sent to the broker as a single PUT event once the
+///     interval elapses or once the held messages reach `putLingerMaxBytes`
+///     bytes, whichever comes first.  This reduces the number of events (and
+///     system calls) for producers posting messages one at a time, at the
+///     cost of added latency.  Default is zero (disabled): every posted event
+///     is sent immediately.
 
 // BMQ
 #include <bmqt_authncredential.h>
@@ -197,6 +214,10 @@ class SessionOptions {
 
     static const unsigned int k_CHANNEL_WRITE_DEFAULT_TIMEOUT_SEC = 5;
 
+    /// Default value for the maximum size of the PUT messages held during
+    /// the linger interval.
+    static const int k_PUT_LINGER_DEFAULT_MAX_BYTES = 64 * 1024;
+
   private:
     // DATA
 
@@ -260,6 +281,14 @@ class SessionOptions {
     /// buffered data.
     bsls::TimeInterval d_channelWriteTimeout;
 
+    /// Maximum time a posted PUT message is held to be coalesced with
+    /// subsequently posted ones (zero to disable).
+    bsls::TimeInterval d_putLingerInterval;
+
+    /// Size of the held PUT messages at which they are sent without waiting
+    /// for the end of the linger interval.
+    int d_putLingerMaxBytes;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(SessionOptions, bslma::UsesBslmaAllocator)
@@ -366,6 +395,16 @@ class SessionOptions {
     /// Zero means no blocking.
     SessionOptions& setChannelWriteTimeout(const bsls::TimeInterval& value);
 
+    /// Set the maximum time posted PUT messages are held to be coalesced to
+    /// the specified `value`.  Zero disables coalescing.  The behavior is
+    /// undefined unless `value` is not negative and less than one second.
+    SessionOptions& setPutLingerInterval(const bsls::TimeInterval& value);
+
+    /// Set to the specified `value` the size (in bytes) of the held PUT
+    /// messages at which they are sent without waiting for the end of the
+    /// linger interval.  The behavior is undefined unless `0 < value`.
+    SessionOptions& setPutLingerMaxBytes(int value);
+
     // ACCESSORS
 
     /// Get the broker URI.
@@ -427,6 +466,12 @@ class SessionOptions {
     /// Get the timeout to block `post` when at high watermark.
     const bsls::TimeInterval& channelWriteTimeout() const;
 
+    /// Get the maximum time posted PUT messages are held to be coalesced.
+    const bsls::TimeInterval& putLingerInterval() const;
+
+    /// Get the size of the held PUT messages at which they are sent.
+    int putLingerMaxBytes() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -618,6 +663,28 @@ SessionOptions::setChannelWriteTimeout(const bsls::TimeInterval& value)
     return *this;
 }
 
+inline SessionOptions&
+SessionOptions::setPutLingerInterval(const bsls::TimeInterval& value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(value >= bsls::TimeInterval(0) &&
+                    value < bsls::TimeInterval(1));
+
+    d_putLingerInterval = value;
+
+    return *this;
+}
+
+inline SessionOptions& SessionOptions::setPutLingerMaxBytes(int value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(value > 0);
+
+    d_putLingerMaxBytes = value;
+
+    return *this;
+}
+
 // ACCESSORS
 inline const bsl::string& SessionOptions::brokerUri() const
 {
@@ -722,6 +789,16 @@ inline const bsls::TimeInterval& SessionOptions::channelWriteTimeout() const
     return d_channelWriteTimeout;
 }
 
+inline const bsls::TimeInterval& SessionOptions::putLingerInterval() const
+{
+    return d_putLingerInterval;
+}
+
+inline int SessionOptions::putLingerMaxBytes() const
+{
+    return d_putLingerMaxBytes;
+}
+
 }  // close package namespace
 
 // --------------------
@@ -745,7 +822,9 @@ inline bool bmqt::operator==(const bmqt::SessionOptions& lhs,
            lhs.hostHealthMonitor() == rhs.hostHealthMonitor() &&
            lhs.traceContext() == rhs.traceContext() &&
            lhs.tracer() == rhs.tracer() &&
-           lhs.userAgentPrefix() == rhs.userAgentPrefix();
+           lhs.userAgentPrefix() == rhs.userAgentPrefix() &&
+           lhs.putLingerInterval() == rhs.putLingerInterval() &&
+           lhs.putLingerMaxBytes() == rhs.putLingerMaxBytes();
 }
 
 inline bool bmqt::operator!=(const bmqt::SessionOptions& lhs,
@@ -209,6 +209,8 @@ static void test4_copyAssignmentTest()
     const int                eventQueueHighWatermark = 3001;
     const char* const        userAgentPrefix         = "wrapper-lib/1.2.3";
     const bsls::TimeInterval channelWriteTimeout(8);
+    const bsls::TimeInterval putLingerInterval(0, 250 * 1000);
+    const int                putLingerMaxBytes = 256 * 1024;
 
     bmqt::SessionOptions source(bmqtst::TestHelperUtil::allocator());
     source.setBrokerUri(brokerUri)
@@ -224,7 +226,9 @@ static void test4_copyAssignmentTest()
         .setCloseQueueTimeout(closeQueueTimeout)
         .configureEventQueue(eventQueueLowWatermark, eventQueueHighWatermark)
         .setUserAgentPrefix(userAgentPrefix)
-        .setChannelWriteTimeout(channelWriteTimeout);
+        .setChannelWriteTimeout(channelWriteTimeout)
+        .setPutLingerInterval(putLingerInterval)
+        .setPutLingerMaxBytes(putLingerMaxBytes);
 
     PVV("Copy assignment");
     bmqt::SessionOptions copyAssigned(bmqtst::TestHelperUtil::allocator());
@@ -249,6 +253,8 @@ static void test4_copyAssignmentTest()
                      eventQueueHighWatermark);
     BMQTST_ASSERT_EQ(copyAssigned.userAgentPrefix(), userAgentPrefix);
     BMQTST_ASSERT_EQ(copyAssigned.channelWriteTimeout(), channelWriteTimeout);
+    BMQTST_ASSERT_EQ(copyAssigned.putLingerInterval(), putLingerInterval);
+    BMQTST_ASSERT_EQ(copyAssigned.putLingerMaxBytes(), putLingerMaxBytes);
 }
 // ============================================================================
 //                                 MAIN PROGRAM
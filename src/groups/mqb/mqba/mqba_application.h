@@ -30,11 +30,11 @@
 
 // BMQ
 #include <bmqma_countingallocatorstore.h>
+#include <bmqp_threadcachingblobbufferfactory.h>
 
 // BDE
 #include <ball_log.h>
 #include <bdlbb_blob.h>
-#include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlcc_objectpool.h>
 #include <bdlcc_sharedobjectpool.h>
 #include <bdlmt_threadpool.h>
@@ -143,7 +143,7 @@ class Application {
     /// blocked ("deadlock").  Note that rerouted commands never route again.
     bdlmt::ThreadPool d_adminRerouteExecutionPool;
 
-    bdlbb::PooledBlobBufferFactory d_bufferFactory;
+    bmqp::ThreadCachingBlobBufferFactory d_bufferFactory;
 
     BlobSpPool d_blobSpPool;
 
@@ -162,6 +162,7 @@
 #include <mqbi_queue.h>
 #include <mqbnet_tcpsessionfactory.h>
 #include <mqbstat_brokerstats.h>
+#include <mqbstat_messagetracer.h>
 #include <mqbu_messageguidutil.h>
 
 // BMQ
@@ -388,6 +389,7 @@ ClientSessionState::ClientSessionState(
 , d_schemaEventBuilder(blobSpPool, encodingType, allocator)
 , d_pushBuilder(blobSpPool, allocator)
 , d_ackBuilder(blobSpPool, allocator)
+, d_tracedPushGUIDs(allocator)
 , d_throttledFailedAckMessages()
 , d_throttledFailedPutMessages()
 {
@@ -1843,6 +1845,15 @@ void ClientSession::onPushEvent(const mqbevt::PushEvent& event)
                                           cat,
                                           pushProperties);
 
+        // Remember the sampled messages to timestamp them when flushed.
+        const mqbstat::MessageTracer* tracer =
+            mqbstat::MessageTracer::instance();
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(tracer) &&
+            tracer->isSampled(event.guid())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            d_state.d_tracedPushGUIDs.push_back(event.guid());
+        }
+
         // Flush if the builder is 'full'
         if (d_state.d_pushBuilder.eventSize() >= k_NAGLE_PACKET_SIZE) {
             flush();
@@ -2173,6 +2184,9 @@ void ClientSession::onPutEvent(const mqbevt::PutEvent& event)
             }
         }
 
+        mqbstat::MessageTracer::trace(putIt.header().messageGUID(),
+                                      mqbstat::MessageTracer::Stage::e_PUT);
+
         BALL_LOG_TRACE << description() << ": PUT message #" << ++msgNum
                        << " [queue: "
                        << queueStatePtr->d_handle_p->queue()->uri()
@@ -2941,6 +2955,16 @@ void ClientSession::flush()
                        << " PUSH messages";
         sendPacketDispatched(d_state.d_pushBuilder.blob(), false);
         d_state.d_pushBuilder.reset();
+
+        for (bsl::vector<bmqt::MessageGUID>::const_iterator it =
+                 d_state.d_tracedPushGUIDs.begin();
+             it != d_state.d_tracedPushGUIDs.end();
+             ++it) {
+            mqbstat::MessageTracer::trace(
+                *it,
+                mqbstat::MessageTracer::Stage::e_PUSH_FLUSH);
+        }
+        d_state.d_tracedPushGUIDs.clear();
     }
 
     // Then flush the 'ACK' messages.
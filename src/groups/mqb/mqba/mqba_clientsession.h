@@ -42,6 +42,7 @@
 #include <bmqp_pusheventbuilder.h>
 #include <bmqp_queueid.h>
 #include <bmqp_schemaeventbuilder.h>
+#include <bmqt_messageguid.h>
 #include <bmqt_uri.h>
 
 #include <bmqio_channel.h>
@@ -65,6 +66,7 @@
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_atomic.h>
@@ -201,6 +203,11 @@ struct ClientSessionState {
     /// Builder for ack messages.  To be used only in client dispatcher thread.
     bmqp::AckEventBuilder d_ackBuilder;
 
+    /// GUIDs of the messages packed in `d_pushBuilder` which are sampled by
+    /// the `mqbstat::MessageTracer`, to trace when the PUSH is flushed.  To
+    /// be used only in client dispatcher thread.
+    bsl::vector<bmqt::MessageGUID> d_tracedPushGUIDs;
+
     /// Throttler for failed ACK messages.
     bdlmt::Throttle d_throttledFailedAckMessages;
 
@@ -21,6 +21,7 @@
 #include <mqba_dispatchereventsource.h>
 #include <mqbevt_callbackevent.h>
 #include <mqbevt_dispatcherevent.h>
+#include <mqbu_numautil.h>
 
 // BMQ
 #include <bmqu_memoutstream.h>
@@ -367,6 +368,26 @@ int Dispatcher::start(bsl::ostream& errorDescription)
                                             "bmqDispCluster"),
                        mqbi::DispatcherClientType::e_CLUSTER);
 
+    if (d_config.numaAware()) {
+        bsl::vector<int> nodes(d_allocator_p);
+        mqbu::NumaUtil::loadNodes(&nodes);
+        if (nodes.size() > 1) {
+            BALL_LOG_INFO << "Binding dispatcher processors to "
+                          << nodes.size() << " NUMA nodes";
+            bindProcessorsToNumaNodes(mqbi::DispatcherClientType::e_SESSION,
+                                      nodes);
+            bindProcessorsToNumaNodes(mqbi::DispatcherClientType::e_QUEUE,
+                                      nodes);
+            bindProcessorsToNumaNodes(mqbi::DispatcherClientType::e_CLUSTER,
+                                      nodes);
+        }
+        else {
+            BALL_LOG_INFO << "NUMA aware dispatcher requested, but the host "
+                          << "exposes a single NUMA node: not binding "
+                          << "processors";
+        }
+    }
+
     d_isStarted = true;
 
     return 0;
@@ -691,6 +712,53 @@ Dispatcher::eventCallbackCreator(mqbi::DispatcherClientType::Enum type,
         lastProcessingStartTime);
 }
 
+void Dispatcher::bindProcessorsToNumaNodes(
+    mqbi::DispatcherClientType::Enum type,
+    const bsl::vector<int>&          nodes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(type != mqbi::DispatcherClientType::e_UNDEFINED);
+    BSLS_ASSERT_SAFE(!nodes.empty());
+
+    const int numProcessors =
+        d_contexts[type]->d_processorPool_mp->numQueues();
+
+    for (int processorId = 0; processorId < numProcessors; ++processorId) {
+        const int node = nodes[mqbu::NumaUtil::nodeForProcessor(
+            processorId,
+            numProcessors,
+            static_cast<int>(nodes.size()))];
+
+        bsl::shared_ptr<mqbevt::DispatcherEvent> event_sp =
+            d_defaultEventSource_sp->getEvent<mqbevt::DispatcherEvent>();
+        event_sp->setEnqueueTime(bmqu::Time::highResolutionTimer());
+        event_sp->callback().set(bdlf::BindUtil::bind(&bindToNumaNode,
+                                                      type,
+                                                      processorId,
+                                                      node));
+
+        dispatchEvent(bslmf::MovableRefUtil::move(event_sp),
+                      type,
+                      processorId);
+    }
+}
+
+void Dispatcher::bindToNumaNode(mqbi::DispatcherClientType::Enum type,
+                                int                              processorId,
+                                int                              node)
+{
+    const int rc = mqbu::NumaUtil::bindCurrentThreadToNode(node);
+    if (rc != 0) {
+        BALL_LOG_WARN << "Failed to bind processor " << processorId << " of '"
+                      << type << "' to NUMA node " << node << " [rc: " << rc
+                      << "]";
+        return;  // RETURN
+    }
+
+    BALL_LOG_INFO << "Bound processor " << processorId << " of '" << type
+                  << "' to NUMA node " << node;
+}
+
 // -------------------------------
 // class Dispatcher::EventCallback
 // -------------------------------
@@ -356,6 +356,20 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
                          int                              queueId,
                          bsls::AtomicInt64* lastProcessingStartTime);
 
+    /// Bind each processor in charge of dispatcher clients of the specified
+    /// `type` to one of the NUMA nodes having the specified `nodes` ids,
+    /// spreading the processors in contiguous blocks across the nodes.  The
+    /// binding is performed asynchronously by each processor's thread.
+    void bindProcessorsToNumaNodes(mqbi::DispatcherClientType::Enum type,
+                                   const bsl::vector<int>&          nodes);
+
+    /// Bind the calling thread, which is the processor having the specified
+    /// `processorId` in charge of dispatcher clients of the specified `type`,
+    /// to the specified NUMA `node`, logging the outcome.
+    static void bindToNumaNode(mqbi::DispatcherClientType::Enum type,
+                               int                              processorId,
+                               int                              node);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Dispatcher, bslma::UsesBslmaAllocator)
@@ -124,7 +124,9 @@ void loadBrokerIdentity(bmqp_ctrlmsg::ClientIdentity* identity,
         .append(":")
         .append(bmqp::HighAvailabilityFeatures::k_GRACEFUL_SHUTDOWN)
         .append(",")
-        .append(bmqp::HighAvailabilityFeatures::k_GRACEFUL_SHUTDOWN_V2);
+        .append(bmqp::HighAvailabilityFeatures::k_GRACEFUL_SHUTDOWN_V2)
+        .append(",")
+        .append(bmqp::HighAvailabilityFeatures::k_CUMULATIVE_CSL_COMMIT);
 
     if (shouldBroadcastToProxies) {
         features.append(",").append(
@@ -714,7 +714,7 @@ void ClusterQueueHelper::onQueueAssignmentResponse(
                 QueueContextMapIter qit = d_queues.find(uri);
                 if (qit != d_queues.end()) {
                     finishAllOpening(qit->second, status);
-                    d_queues.erase(qit);
+                    eraseQueueContext(qit);
                 }
             }
         }
@@ -3686,7 +3686,7 @@ void ClusterQueueHelper::restoreStateRemote()
 
             if (!assignQueue(queueContext)) {
                 conditional.release();
-                cit = d_queues.erase(cit);
+                cit = eraseQueueContext(cit);
             }
 
             continue;  // CONTINUE
@@ -3822,11 +3822,18 @@ void ClusterQueueHelper::restoreStateCluster(int partitionId)
         d_clusterState_p->iterateDoubleAssignments(partitionId,
                                                    doubleAssignmentVisitor);
     }
-    ConditionalAdvance<QueueContextMapConstIter> conditional;
-    for (QueueContextMapConstIter cit = d_queues.cbegin();
-         cit != d_queues.cend();
-         conditional.advance(cit)) {
-        const QueueContextSp& queueContext = cit->second;
+
+    // Only visit the queues assigned to 'partitionId' (or all of them if
+    // restoring all partitions), working on a copy so that queues can be
+    // removed from 'd_queues' while iterating.
+    bsl::vector<QueueContextSp> queueContexts(d_allocator_p);
+    loadQueueContexts(&queueContexts, partitionId);
+
+    for (bsl::vector<QueueContextSp>::const_iterator cit =
+             queueContexts.cbegin();
+         cit != queueContexts.cend();
+         ++cit) {
+        const QueueContextSp& queueContext = *cit;
         QueueLiveState&       liveQInfo    = queueContext->d_liveQInfo;
         if (allPartitions) {
             // Attempt to re-issue open-queue requests for all appropriate
@@ -3850,8 +3857,11 @@ void ClusterQueueHelper::restoreStateCluster(int partitionId)
                 // Queue is not assigned to a partition; get it assigned.
 
                 if (!assignQueue(queueContext)) {
-                    conditional.release();
-                    cit = d_queues.erase(cit);
+                    QueueContextMapIter qit = d_queues.find(
+                        queueContext->uri());
+                    if (qit != d_queues.end()) {
+                        eraseQueueContext(qit);
+                    }
                 }
 
                 continue;  // CONTINUE
@@ -4156,7 +4166,7 @@ void ClusterQueueHelper::removeQueue(const QueueContextMapIter& it)
         deleteQueue(queueContextSp.get());
 
         // Delete the queue entry from cluster state.
-        d_queues.erase(it);
+        eraseQueueContext(it);
 
         return;  // RETURN
     }
@@ -4219,7 +4229,63 @@ void ClusterQueueHelper::removeQueueRaw(const QueueContextMapIter& it)
     if (!d_clusterState_p->isSelfPrimary(queueContextSp->partitionId())) {
         d_queuesById.erase(queueContextSp->d_liveQInfo.d_id);
     }
-    d_queues.erase(it);
+    eraseQueueContext(it);
+}
+
+void ClusterQueueHelper::indexQueueContext(QueueContext* queueContext)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(queueContext);
+
+    const int partitionId = queueContext->partitionId();
+    if (partitionId == queueContext->d_indexedPartitionId) {
+        return;  // RETURN
+    }
+
+    unindexQueueContext(queueContext);
+
+    if (partitionId < 0) {
+        return;  // RETURN
+    }
+
+    if (static_cast<size_t>(partitionId) >= d_queuesByPartition.size()) {
+        d_queuesByPartition.resize(partitionId + 1);
+    }
+    d_queuesByPartition[partitionId].insert(queueContext);
+    queueContext->d_indexedPartitionId = partitionId;
+}
+
+void ClusterQueueHelper::unindexQueueContext(QueueContext* queueContext)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(queueContext);
+
+    const int partitionId = queueContext->d_indexedPartitionId;
+    if (partitionId == mqbi::Storage::k_INVALID_PARTITION_ID) {
+        return;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(static_cast<size_t>(partitionId) <
+                     d_queuesByPartition.size());
+
+    d_queuesByPartition[partitionId].erase(queueContext);
+    queueContext->d_indexedPartitionId = mqbi::Storage::k_INVALID_PARTITION_ID;
+}
+
+ClusterQueueHelper::QueueContextMapIter
+ClusterQueueHelper::eraseQueueContext(QueueContextMapConstIter it)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(it != d_queues.cend());
+
+    unindexQueueContext(it->second.get());
+    return d_queues.erase(it);
 }
 
 void ClusterQueueHelper::onSelfNodeStatus(
@@ -4314,6 +4380,9 @@ void ClusterQueueHelper::onQueueAssigned(
             BSLS_ASSERT_SAFE(
                 !queueContext->d_stateQInfo_sp->pendingUnassignment());
 
+            // The assignment may have been updated in place.
+            indexQueueContext(queueContext.get());
+
             onQueueContextAssigned(queueContext);
             return;  // RETURN
         }
@@ -4343,6 +4412,7 @@ void ClusterQueueHelper::onQueueAssigned(
     domainState.adjustQueueCount(1);
 
     queueContext->d_stateQInfo_sp = info;
+    indexQueueContext(queueContext.get());
     // Queue assignment from the leader is honored per the info updated
     // above
 
@@ -4474,6 +4544,7 @@ void ClusterQueueHelper::onQueueUnassigned(
             // CQH will recreate 'queueContextSp->d_liveQInfo.d_queue_sp' upon
             // 'onOpenQueueResponse'
 
+            unindexQueueContext(queueContextSp.get());
             queueContextSp->d_stateQInfo_sp.reset();
         }
         else {
@@ -4604,10 +4675,14 @@ void ClusterQueueHelper::onUpstreamNodeChange(mqbnet::ClusterNode* node,
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_cluster_p->inDispatcherThread());
 
-    for (QueueContextMapConstIter cit = d_queues.begin();
-         cit != d_queues.end();
+    bsl::vector<QueueContextSp> queueContexts(d_allocator_p);
+    loadQueueContexts(&queueContexts, partitionId);
+
+    for (bsl::vector<QueueContextSp>::const_iterator cit =
+             queueContexts.cbegin();
+         cit != queueContexts.cend();
          ++cit) {
-        const QueueContextSp& queueContextSp = cit->second;
+        const QueueContextSp& queueContextSp = *cit;
         mqbi::Queue* queue = queueContextSp->d_liveQInfo.d_queue_sp.get();
 
         if (!queue) {
@@ -4673,6 +4748,7 @@ ClusterQueueHelper::ClusterQueueHelper(
 , d_storageManager_p(0)
 , d_queues(allocator)
 , d_queuesById(allocator)
+, d_queuesByPartition(allocator)
 , d_reopenCycles(allocator)
 , d_primaryNotLeaderAlarmRaised(false)
 , d_stopContexts(allocator)
@@ -4932,7 +5008,7 @@ void ClusterQueueHelper::openQueue(
     if (!isAssigned) {
         // Initiate the assignment.
         if (!assignQueue(queueContextIt->second)) {
-            d_queues.erase(queueContextIt);
+            eraseQueueContext(queueContextIt);
         }
     }
 }
@@ -6212,6 +6288,43 @@ void ClusterQueueHelper::convertToLocal(const QueueContextSp& queueContext,
     queueContext->d_liveQInfo.d_id = bmqp::QueueId::k_PRIMARY_QUEUE_ID;
 }
 
+void ClusterQueueHelper::loadQueueContexts(
+    bsl::vector<QueueContextSp>* contexts,
+    int                          partitionId) const
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(contexts);
+
+    if (partitionId == mqbi::Storage::k_ANY_PARTITION_ID) {
+        contexts->reserve(d_queues.size());
+        for (QueueContextMapConstIter cit = d_queues.cbegin();
+             cit != d_queues.cend();
+             ++cit) {
+            contexts->push_back(cit->second);
+        }
+        return;  // RETURN
+    }
+
+    if (partitionId < 0 ||
+        static_cast<size_t>(partitionId) >= d_queuesByPartition.size()) {
+        return;  // RETURN
+    }
+
+    const QueueContextSet& queues = d_queuesByPartition[partitionId];
+    contexts->reserve(queues.size());
+    for (QueueContextSet::const_iterator cit = queues.cbegin();
+         cit != queues.cend();
+         ++cit) {
+        QueueContextMapConstIter qit = d_queues.find((*cit)->uri());
+        BSLS_ASSERT_SAFE(qit != d_queues.cend());
+        BSLS_ASSERT_SAFE(qit->second.get() == *cit);
+
+        contexts->push_back(qit->second);
+    }
+}
+
 void ClusterQueueHelper::match(bsl::vector<bsl::string>*          added,
                                bsl::vector<bsl::string>*          removed,
                                const mqbc::ClusterStateQueueInfo& state,
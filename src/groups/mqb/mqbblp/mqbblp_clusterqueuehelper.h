@@ -391,6 +391,11 @@ class ClusterQueueHelper BSLS_KEYWORD_FINAL
         /// Persistent queue information (null if no queue created)
         ClusterStateQueueInfoCSp d_stateQInfo_sp;
 
+        /// Partition under which this context is registered in the
+        /// per-partition index of its owner, or
+        /// `mqbi::Storage::k_INVALID_PARTITION_ID` if it is not registered.
+        int d_indexedPartitionId;
+
       private:
         // DATA
 
@@ -436,6 +441,13 @@ class ClusterQueueHelper BSLS_KEYWORD_FINAL
     /// queue which have a proper valid unique queueId.
     typedef bsl::unordered_map<int, QueueContext*> QueueContextByIdMap;
 
+    /// Set of the QueueContexts assigned to one partition.
+    typedef bsl::unordered_set<QueueContext*> QueueContextSet;
+
+    /// QueueContextsByPartition[partitionId] -> contexts of the queues
+    /// assigned to that partition.
+    typedef bsl::vector<QueueContextSet> QueueContextsByPartition;
+
     struct PartitionReopenCycle {
         ClusterQueueHelper* d_owner_p;
         bsls::Types::Uint64 d_generationCount;
@@ -487,6 +499,12 @@ class ClusterQueueHelper BSLS_KEYWORD_FINAL
     /// the queues which are not local, since local queues all have a 0 id.
     QueueContextByIdMap d_queuesById;
 
+    /// Queues indexed by the partition they are assigned to, so that the
+    /// work triggered by a change of primary of one partition (reopening
+    /// queues, notifying upstream changes) only visits the queues of that
+    /// partition rather than all the queues of the cluster.
+    QueueContextsByPartition d_queuesByPartition;
+
     /// Track the state of partitions upon `restoreState`.
     /// `d_reopenCycles` is non empty if there are either Reopen requests in
     /// progress or some Reopen for some partition has failed.
@@ -822,6 +840,20 @@ class ClusterQueueHelper BSLS_KEYWORD_FINAL
 
     void removeQueueRaw(const QueueContextMapIter& it);
 
+    /// Register the specified `queueContext` in `d_queuesByPartition` under
+    /// the partition it is currently assigned to, moving it if it was
+    /// registered under another partition.
+    void indexQueueContext(QueueContext* queueContext);
+
+    /// Remove the specified `queueContext` from `d_queuesByPartition`, if
+    /// it is registered there.
+    void unindexQueueContext(QueueContext* queueContext);
+
+    /// Remove the queue context at the specified `it` from `d_queues` and
+    /// from `d_queuesByPartition`, and return an iterator to the element
+    /// following it.
+    QueueContextMapIter eraseQueueContext(QueueContextMapConstIter it);
+
     /// Invoked when the upstream connection (primary node in replica mode,
     /// active node in proxy) for the specified `partitionId` has changed
     /// availability.  Notify all affected queues.
@@ -889,6 +921,12 @@ class ClusterQueueHelper BSLS_KEYWORD_FINAL
                                  bsls::Types::Uint64*  genCount,
                                  int                   partitionId) const;
 
+    /// Load into the specified `contexts` the contexts of all the queues
+    /// assigned to the specified `partitionId`, or of all the known queues
+    /// if `partitionId` is `mqbi::Storage::k_ANY_PARTITION_ID`.
+    void loadQueueContexts(bsl::vector<QueueContextSp>* contexts,
+                           int                          partitionId) const;
+
     /// Compare the specified `state` and `domainConfig` and populate the
     //// specified `added` and `removed` with missing/extra Apps.
     void match(bsl::vector<bsl::string>*          added,
@@ -1172,6 +1210,7 @@ inline ClusterQueueHelper::QueueContext::QueueContext(
     bslma::Allocator* allocator)
 : d_liveQInfo(allocator)
 , d_stateQInfo_sp(0)
+, d_indexedPartitionId(mqbi::Storage::k_INVALID_PARTITION_ID)
 , d_uri(uri, allocator)
 {
     // PRECONDITIONS
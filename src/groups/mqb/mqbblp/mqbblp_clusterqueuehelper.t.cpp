@@ -0,0 +1,936 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbblp_clusterqueuehelper.t.cpp                                    -*-C++-*-
+#include <mqbblp_clusterqueuehelper.h>
+
+// MQB
+#include <mqbc_clusterdata.h>
+#include <mqbc_clusterstate.h>
+#include <mqbc_clusterstatemanager.h>
+#include <mqbc_clusterutil.h>
+#include <mqbc_electorinfo.h>
+#include <mqbcfg_brokerconfig.h>
+#include <mqbcfg_messages.h>
+#include <mqbcmd_messages.h>
+#include <mqbi_cluster.h>
+#include <mqbi_dispatcher.h>
+#include <mqbi_queue.h>
+#include <mqbmock_cluster.h>
+#include <mqbmock_clusterstateledger.h>
+#include <mqbmock_domain.h>
+#include <mqbmock_queue.h>
+#include <mqbmock_queueengine.h>
+#include <mqbmock_storagemanager.h>
+#include <mqbnet_cluster.h>
+#include <mqbnet_elector.h>
+#include <mqbu_storagekey.h>
+
+// BMQ
+#include <bmqio_testchannel.h>
+#include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_event.h>
+#include <bmqt_queueflags.h>
+#include <bmqt_uri.h>
+#include <bmqu_memoutstream.h>
+#include <bmqu_printutil.h>
+#include <bmqu_tempdirectory.h>
+#include <bmqu_time.h>
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bsla_maybeunused.h>
+#include <bslma_managedptr.h>
+#include <bsls_assert.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+// CONSTANTS
+static const bsls::Types::Int64 k_WATCHDOG_TIMEOUT_DURATION = 5 * 60;
+// 5 minutes
+
+static const int k_WATCHDOG_NUM_RETRIES = 5;
+
+static const char k_DOMAIN[] = "bmq://bmq.test.mem.priority/";
+
+// TYPES
+typedef mqbc::ClusterStateManager::ClusterStateLedgerMp ClusterStateLedgerMp;
+
+typedef bsl::shared_ptr<mqbmock::Queue> MockQueueSp;
+
+typedef bsl::shared_ptr<mqbi::QueueHandleRequesterContext> ClientContextSp;
+
+// FUNCTIONS
+
+/// Callback of the open queue requests of the tests, which does nothing as
+/// the mock queue engine never creates queue handles.
+void dummyOpenQueueCallback(
+    BSLA_MAYBE_UNUSED const bmqp_ctrlmsg::Status& status,
+    BSLA_MAYBE_UNUSED mqbi::QueueHandle* queueHandle,
+    BSLA_MAYBE_UNUSED const bmqp_ctrlmsg::OpenQueueResponse& openQueueResponse,
+    BSLA_MAYBE_UNUSED const mqbi::OpenQueueConfirmationCookieSp&
+                            confirmationCookie)
+{
+    // NOTHING
+}
+
+/// Return the uri of the queue of the specified `queueIndex`, as assigned
+/// by `Tester::assignQueues`.
+bmqt::Uri queueUri(int queueIndex)
+{
+    bmqu::MemOutStream uri(bmqtst::TestHelperUtil::allocator());
+    uri << k_DOMAIN << "queue" << queueIndex;
+
+    return bmqt::Uri(uri.str(), bmqtst::TestHelperUtil::allocator());
+}
+
+// =============
+// struct Tester
+// =============
+
+/// This class provides the mock cluster, the cluster state manager and the
+/// other components necessary to drive a `ClusterQueueHelper` of a replica
+/// in isolation, as well as some helper methods.  The queues opened through
+/// the helper are mock queues registered with a mock domain.
+struct Tester {
+  public:
+    // PUBLIC DATA
+    bmqu::TempDirectory                           d_tempDir;
+    bslma::ManagedPtr<mqbmock::Cluster>           d_cluster_mp;
+    bslma::ManagedPtr<mqbc::ClusterStateManager>  d_clusterStateManager_mp;
+    mqbmock::StorageManager                       d_storageManager;
+    bslma::ManagedPtr<mqbblp::ClusterQueueHelper> d_clusterQueueHelper_mp;
+    unsigned int                                  d_leaseId;
+    mqbmock::QueueEngine                          d_queueEngine;
+    bslma::ManagedPtr<mqbmock::Domain>            d_domain_mp;
+    bsl::vector<MockQueueSp>                      d_queues;
+    ClientContextSp                               d_clientContext;
+
+  public:
+    // CREATORS
+    Tester()
+    : d_tempDir(bmqtst::TestHelperUtil::allocator())
+    , d_cluster_mp(0)
+    , d_clusterStateManager_mp(0)
+    , d_storageManager()
+    , d_clusterQueueHelper_mp(0)
+    , d_leaseId(0)
+    , d_queueEngine(bmqtst::TestHelperUtil::allocator())
+    , d_domain_mp(0)
+    , d_queues(bmqtst::TestHelperUtil::allocator())
+    , d_clientContext()
+    {
+        bmqu::Time::initialize(bmqtst::TestHelperUtil::allocator());
+
+        // Create the cluster
+        mqbmock::Cluster::ClusterNodeDefs clusterNodeDefs(
+            bmqtst::TestHelperUtil::allocator());
+        mqbc::ClusterUtil::appendClusterNode(
+            &clusterNodeDefs,
+            "E1",
+            "US-EAST",
+            41234,
+            mqbmock::Cluster::k_LEADER_NODE_ID,
+            bmqtst::TestHelperUtil::allocator());
+        mqbc::ClusterUtil::appendClusterNode(
+            &clusterNodeDefs,
+            "E2",
+            "US-EAST",
+            41235,
+            mqbmock::Cluster::k_LEADER_NODE_ID + 1,
+            bmqtst::TestHelperUtil::allocator());
+        mqbc::ClusterUtil::appendClusterNode(
+            &clusterNodeDefs,
+            "W1",
+            "US-WEST",
+            41236,
+            mqbmock::Cluster::k_LEADER_NODE_ID + 2,
+            bmqtst::TestHelperUtil::allocator());
+        mqbc::ClusterUtil::appendClusterNode(
+            &clusterNodeDefs,
+            "W2",
+            "US-WEST",
+            41237,
+            mqbmock::Cluster::k_LEADER_NODE_ID + 3,
+            bmqtst::TestHelperUtil::allocator());
+
+        d_cluster_mp.load(
+            new (*bmqtst::TestHelperUtil::allocator())
+                mqbmock::Cluster(bmqtst::TestHelperUtil::allocator(),
+                                 true,   // isClusterMember
+                                 false,  // isLeader
+                                 true,   // isFSMWorkflow
+                                 false,  // doesFSMwriteQLIST
+                                 clusterNodeDefs,
+                                 "testCluster",
+                                 d_tempDir.path()),
+            bmqtst::TestHelperUtil::allocator());
+
+        d_cluster_mp->_clusterData()->stats().setIsMember(true);
+
+        // Create the domain of the queues, and the context of the client
+        // opening them
+        d_domain_mp.load(new (*bmqtst::TestHelperUtil::allocator())
+                             mqbmock::Domain(
+                                 d_cluster_mp.get(),
+                                 bmqtst::TestHelperUtil::allocator()),
+                         bmqtst::TestHelperUtil::allocator());
+
+        bmqp_ctrlmsg::ClientIdentity identity(
+            bmqtst::TestHelperUtil::allocator());
+        identity.clientType() = bmqp_ctrlmsg::ClientType::E_TCPCLIENT;
+
+        d_clientContext.createInplace(bmqtst::TestHelperUtil::allocator(),
+                                      bmqtst::TestHelperUtil::allocator());
+        d_clientContext->setIdentity(identity)
+            .setDescription("test.tsk:1")
+            .setRequesterId(mqbi::QueueHandleRequesterContext ::
+                                generateUniqueRequesterId());
+
+        // Create the cluster state manager
+        ClusterStateLedgerMp clusterStateLedger_mp(
+            new (*bmqtst::TestHelperUtil::allocator())
+                mqbmock::ClusterStateLedger(
+                    d_cluster_mp->_clusterData(),
+                    bmqtst::TestHelperUtil::allocator()),
+            bmqtst::TestHelperUtil::allocator());
+
+        d_clusterStateManager_mp.load(
+            new (*bmqtst::TestHelperUtil::allocator())
+                mqbc::ClusterStateManager(d_cluster_mp->_clusterDefinition(),
+                                          d_cluster_mp.get(),
+                                          d_cluster_mp->_clusterData(),
+                                          d_cluster_mp->_state(),
+                                          clusterStateLedger_mp,
+                                          k_WATCHDOG_TIMEOUT_DURATION,
+                                          k_WATCHDOG_NUM_RETRIES,
+                                          bmqtst::TestHelperUtil::allocator()),
+            bmqtst::TestHelperUtil::allocator());
+        d_clusterStateManager_mp->setStorageManager(&d_storageManager);
+
+        // To pass `inDispatcherThread` checks (allow ANY thread):
+        d_cluster_mp->setThreadId(mqbi::DispatcherClient::k_ANY_THREAD_ID);
+
+        bmqu::MemOutStream errorDescription;
+        int                rc = d_cluster_mp->start(errorDescription);
+        BSLS_ASSERT_OPT(rc == 0);
+        rc = d_clusterStateManager_mp->start(errorDescription);
+        BSLS_ASSERT_OPT(rc == 0);
+
+        // Create the cluster queue helper.  Note that the cluster state
+        // manager stays registered as an observer of the cluster state, so
+        // that changes of primary are forwarded to the helper.
+        d_clusterQueueHelper_mp.load(
+            new (*bmqtst::TestHelperUtil::allocator())
+                mqbblp::ClusterQueueHelper(
+                    d_cluster_mp->_clusterData(),
+                    d_cluster_mp->_state(),
+                    d_clusterStateManager_mp.get(),
+                    bmqtst::TestHelperUtil::allocator()),
+            bmqtst::TestHelperUtil::allocator());
+        d_clusterQueueHelper_mp->setStorageManager(&d_storageManager);
+        d_clusterQueueHelper_mp->initialize();
+
+        // All nodes are AVAILABLE
+        d_cluster_mp->_clusterData()->membership().setSelfNodeStatus(
+            bmqp_ctrlmsg::NodeStatus::E_AVAILABLE);
+        for (mqbnet::Cluster::NodesList::iterator iter =
+                 d_cluster_mp->netCluster().nodes().begin();
+             iter != d_cluster_mp->netCluster().nodes().end();
+             ++iter) {
+            d_cluster_mp->_clusterData()
+                ->membership()
+                .getClusterNodeSession(*iter)
+                ->setNodeStatus(bmqp_ctrlmsg::NodeStatus::E_AVAILABLE,
+                                bmqp_ctrlmsg::NodeStatus::E_AVAILABLE);
+        }
+    }
+
+    ~Tester()
+    {
+        // Cancel the requests the tests did not respond to, such as the
+        // ReopenQueue requests, while the helper can process the
+        // cancellation.
+        bmqp_ctrlmsg::ControlMessage response(
+            bmqtst::TestHelperUtil::allocator());
+        bmqp_ctrlmsg::Status& failure = response.choice().makeStatus();
+        failure.category() = bmqp_ctrlmsg::StatusCategory::E_CANCELED;
+        failure.code()     = mqbi::ClusterErrorCode::e_STOPPING;
+        failure.message()  = "Tester is being destroyed";
+        d_cluster_mp->requestManager().cancelAllRequests(response);
+
+        d_clusterQueueHelper_mp->teardown();
+        d_clusterQueueHelper_mp.reset();
+
+        // Unregister the queues still registered with the domain
+        for (size_t i = 0; i < d_queues.size(); ++i) {
+            bsl::shared_ptr<mqbi::Queue> registered;
+            if (d_domain_mp->lookupQueue(&registered, d_queues[i]->uri()) ==
+                    0 &&
+                registered.get() == d_queues[i].get()) {
+                d_domain_mp->unregisterQueue(d_queues[i].get());
+            }
+        }
+        d_queues.clear();
+        d_domain_mp.reset();
+
+        d_clusterStateManager_mp->stop();
+        d_cluster_mp->stop();
+
+        bmqu::Time::shutdown();
+    }
+
+    // MANIPULATORS
+
+    /// Make the leader node the ACTIVE leader of the cluster, self being a
+    /// follower.
+    void electLeader()
+    {
+        mqbnet::ClusterNode* leaderNode = this->leaderNode();
+
+        // It is prohibited to set leader status directly from e_UNDEFINED to
+        // e_ACTIVE.
+        d_cluster_mp->_clusterData()->electorInfo().setElectorInfo(
+            mqbnet::ElectorState::e_FOLLOWER,
+            1,
+            leaderNode,
+            mqbc::ElectorInfoLeaderStatus::e_PASSIVE);
+        d_cluster_mp->_clusterData()->electorInfo().setElectorInfo(
+            mqbnet::ElectorState::e_FOLLOWER,
+            1,
+            leaderNode,
+            mqbc::ElectorInfoLeaderStatus::e_ACTIVE);
+    }
+
+    /// Assign the queue of the specified `queueIndex` to the specified
+    /// `partitionId`.
+    void assignQueue(int queueIndex, int partitionId)
+    {
+        bmqp_ctrlmsg::QueueInfo advisory(bmqtst::TestHelperUtil::allocator());
+        advisory.uri() = queueUri(queueIndex).asString();
+        mqbu::StorageKey(static_cast<unsigned int>(queueIndex + 1))
+            .loadBinary(&advisory.key());
+        advisory.partitionId() = partitionId;
+
+        d_cluster_mp->_state()->assignQueue(advisory);
+    }
+
+    /// Assign the specified `numQueues` queues, round-robin across all the
+    /// partitions of the cluster.
+    void assignQueues(int numQueues)
+    {
+        const int numPartitions = static_cast<int>(
+            d_cluster_mp->_state()->partitions().size());
+
+        for (int i = 0; i < numQueues; ++i) {
+            assignQueue(i, i % numPartitions);
+        }
+    }
+
+    /// Open, as a reader, the queue of the specified `queueIndex` through
+    /// the helper, and respond to the OpenQueue request sent to the primary
+    /// of its partition.  The behavior is undefined unless the queue is
+    /// assigned to a partition having an ACTIVE primary.
+    void openQueue(int queueIndex)
+    {
+        const bmqt::Uri uri = queueUri(queueIndex);
+
+        // The helper uses the queue the domain already knows about instead
+        // of creating one.
+        MockQueueSp queue;
+        queue.createInplace(bmqtst::TestHelperUtil::allocator(),
+                            d_domain_mp.get(),
+                            bmqtst::TestHelperUtil::allocator());
+        queue->_setUri(uri)._setQueueEngine(&d_queueEngine);
+
+        int rc = d_domain_mp->registerQueue(queue);
+        BSLS_ASSERT_OPT(rc == 0);
+        d_queues.push_back(queue);
+
+        bsls::Types::Uint64 flags = 0;
+        bmqt::QueueFlagsUtil::setReader(&flags);
+
+        const unsigned int qId = static_cast<unsigned int>(queueIndex + 1);
+
+        bmqp_ctrlmsg::QueueHandleParameters handleParameters(
+            bmqtst::TestHelperUtil::allocator());
+        handleParameters.uri()       = uri.asString();
+        handleParameters.qId()       = qId;
+        handleParameters.flags()     = flags;
+        handleParameters.readCount() = 1;
+
+        d_clusterQueueHelper_mp->openQueue(uri,
+                                           d_domain_mp.get(),
+                                           handleParameters,
+                                           d_clientContext,
+                                           &dummyOpenQueueCallback);
+
+        bmqp_ctrlmsg::ControlMessage request(
+            bmqtst::TestHelperUtil::allocator());
+        bool found = popOpenQueueRequest(&request);
+        BSLS_ASSERT_OPT(found);
+
+        const bmqp_ctrlmsg::OpenQueue& openQueueRequest =
+            request.choice().openQueue();
+        BSLS_ASSERT_OPT(openQueueRequest.handleParameters().uri() ==
+                        uri.asString());
+
+        bmqp_ctrlmsg::ControlMessage response(
+            bmqtst::TestHelperUtil::allocator());
+        response.rId() = request.rId();
+        response.choice().makeOpenQueueResponse().originalRequest() =
+            openQueueRequest;
+        d_cluster_mp->requestManager().processResponse(response);
+
+        // The mock queue engine does not create the queue handle: account
+        // for the queue instance as 'createQueueFactory' does, and notify
+        // the creation of the handle.
+        d_cluster_mp->_state()->updatePartitionNumActiveQueues(
+            partitionId(uri),
+            1);
+        d_clusterQueueHelper_mp->onQueueHandleCreated(queue.get(), uri, true);
+    }
+
+    /// Open the specified `numQueues` queues assigned by `assignQueues`.
+    void openQueues(int numQueues)
+    {
+        for (int i = 0; i < numQueues; ++i) {
+            openQueue(i);
+        }
+    }
+
+    /// Load into the specified `request` the next OpenQueue request written
+    /// to the channel of the leader node, skipping any other message, and
+    /// return `true`; or return `false` if no such request is written
+    /// before a short timeout.
+    bool popOpenQueueRequest(bmqp_ctrlmsg::ControlMessage* request)
+    {
+        bmqio::TestChannel* channel = leaderChannel();
+
+        while (channel->waitFor(1)) {
+            bmqio::TestChannel::WriteCall writeCall = channel->popWriteCall();
+
+            bmqp::Event event(&writeCall.d_blob,
+                              bmqtst::TestHelperUtil::allocator());
+            if (!event.isControlEvent()) {
+                continue;  // CONTINUE
+            }
+
+            mqbc::ClusterUtil::extractMessage(
+                request,
+                writeCall.d_blob,
+                bmqtst::TestHelperUtil::allocator());
+            if (request->choice().isOpenQueueValue()) {
+                return true;  // RETURN
+            }
+        }
+
+        return false;
+    }
+
+    /// Pop up to the specified `numRequests` OpenQueue requests written to
+    /// the channel of the leader node, load the uris of their queues into
+    /// the optionally specified `uris`, and return the number of requests
+    /// popped, which is less than `numRequests` if no more requests are
+    /// written before a short timeout.
+    int popOpenQueueRequests(int                       numRequests,
+                             bsl::vector<bsl::string>* uris = 0)
+    {
+        bmqp_ctrlmsg::ControlMessage request(
+            bmqtst::TestHelperUtil::allocator());
+
+        int numPopped = 0;
+        while (numPopped < numRequests && popOpenQueueRequest(&request)) {
+            if (uris) {
+                uris->push_back(
+                    request.choice().openQueue().handleParameters().uri());
+            }
+            ++numPopped;
+        }
+
+        return numPopped;
+    }
+
+    /// Make the leader node the ACTIVE primary of the specified
+    /// `partitionId` under a new lease, as upon a failover.
+    void failoverPartition(int partitionId)
+    {
+        mqbc::ClusterNodeSession* ns =
+            d_cluster_mp->_clusterData()->membership().getClusterNodeSession(
+                leaderNode());
+        BSLS_ASSERT_OPT(ns);
+
+        d_cluster_mp->_state()
+            ->setPartitionPrimary(partitionId, ++d_leaseId, ns)
+            .setPartitionPrimaryStatus(partitionId,
+                                       bmqp_ctrlmsg::PrimaryStatus::E_ACTIVE);
+    }
+
+    /// Fail over all the partitions of the cluster, one at a time.
+    void failoverAllPartitions()
+    {
+        const int numPartitions = static_cast<int>(
+            d_cluster_mp->_state()->partitions().size());
+
+        for (int pid = 0; pid < numPartitions; ++pid) {
+            failoverPartition(pid);
+        }
+    }
+
+    // ACCESSORS
+    mqbnet::ClusterNode* leaderNode() const
+    {
+        mqbnet::ClusterNode* node = d_cluster_mp->netCluster().lookupNode(
+            mqbmock::Cluster::k_LEADER_NODE_ID);
+        BSLS_ASSERT_OPT(node);
+        return node;
+    }
+
+    /// Return the channel to the leader node, which is the primary of all
+    /// the partitions once failed over.
+    bmqio::TestChannel* leaderChannel() const
+    {
+        mqbmock::Cluster::TestChannelMapCIter cit =
+            d_cluster_mp->_channels().find(leaderNode());
+        BSLS_ASSERT_OPT(cit != d_cluster_mp->_channels().end());
+        return cit->second.get();
+    }
+
+    /// Return the partition the queue of the specified `uri` is assigned to
+    /// in the cluster state.
+    int partitionId(const bmqt::Uri& uri) const
+    {
+        const mqbc::ClusterStateQueueInfo* info =
+            d_cluster_mp->_state()->getAssigned(uri);
+        BSLS_ASSERT_OPT(info);
+        return info->partitionId();
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Plan:
+//   1. Create a ClusterQueueHelper of a replica and initialize it.
+//   2. Elect a leader and fail over all partitions without any queue.
+//
+// Testing:
+//   Basic functionality
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    Tester tester;
+
+    mqbcmd::ClusterQueueHelper state(bmqtst::TestHelperUtil::allocator());
+    tester.d_clusterQueueHelper_mp->loadState(&state);
+    BMQTST_ASSERT_EQ(state.numQueues(), 0);
+
+    tester.electLeader();
+    tester.failoverAllPartitions();
+
+    BMQTST_ASSERT_EQ(
+        tester.d_clusterQueueHelper_mp->numPendingReopenQueueRequests(),
+        0);
+}
+
+static void test2_queueAssignmentAndFailover()
+// ------------------------------------------------------------------------
+// QUEUE ASSIGNMENT AND FAILOVER
+//
+// Concerns:
+//   1. Queues assigned through the cluster state are tracked by the
+//      ClusterQueueHelper under their partition.
+//   2. Failing over each partition restores the state of that partition
+//      only, and completes without leaving pending reopen requests.
+//
+// Plan:
+//   1. Assign queues across all partitions and verify the queues info.
+//   2. Elect a leader, then fail over each partition one at a time.
+//
+// Testing:
+//   onQueueAssigned
+//   afterPartitionPrimaryAssignment
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("QUEUE ASSIGNMENT AND FAILOVER");
+
+    const int k_NUM_QUEUES = 10;
+
+    Tester tester;
+
+    const int numPartitions = static_cast<int>(
+        tester.d_cluster_mp->_state()->partitions().size());
+
+    tester.assignQueues(k_NUM_QUEUES);
+
+    mqbcmd::StorageContent content(bmqtst::TestHelperUtil::allocator());
+    tester.d_clusterQueueHelper_mp->loadQueuesInfo(&content);
+    BMQTST_ASSERT_EQ(content.storages().size(),
+                     static_cast<size_t>(k_NUM_QUEUES));
+
+    for (size_t i = 0; i < content.storages().size(); ++i) {
+        const mqbcmd::StorageQueueInfo& info = content.storages()[i];
+        const bsl::string               name = info.queueUri().substr(
+            sizeof(k_DOMAIN) - 1 + 5);  // skip "queue"
+        const int queueIndex = bsl::atoi(name.c_str());
+
+        BMQTST_ASSERT_EQ_D(info.queueUri(),
+                           info.partitionId(),
+                           queueIndex % numPartitions);
+    }
+
+    tester.electLeader();
+
+    for (int pid = 0; pid < numPartitions; ++pid) {
+        tester.failoverPartition(pid);
+
+        BMQTST_ASSERT_EQ_D(
+            pid,
+            tester.d_clusterQueueHelper_mp->numPendingReopenQueueRequests(),
+            0);
+    }
+
+    // Fail over again under a new lease.
+    tester.failoverAllPartitions();
+
+    mqbcmd::ClusterQueueHelper state(bmqtst::TestHelperUtil::allocator());
+    tester.d_clusterQueueHelper_mp->loadState(&state);
+    BMQTST_ASSERT_EQ(state.numQueues(), k_NUM_QUEUES);
+    BMQTST_ASSERT_EQ(state.numPendingReopenQueueRequests(), 0);
+}
+
+static void test3_partitionScopedRestore()
+// ------------------------------------------------------------------------
+// PARTITION SCOPED RESTORE
+//
+// Concerns:
+//   1. Failing over a partition reopens all the opened queues of that
+//      partition, by sending a ReopenQueue request to its new primary.
+//   2. No ReopenQueue request is sent for the queues of the other
+//      partitions.
+//
+// Plan:
+//   1. Assign queues across all partitions, elect a leader, fail over all
+//      partitions and open all the queues.
+//   2. Fail over each partition one at a time, and verify the queues of
+//      the ReopenQueue requests sent to the primary, as well as the number
+//      of pending ReopenQueue requests.
+//
+// Testing:
+//   restoreState
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PARTITION SCOPED RESTORE");
+
+    const int k_NUM_QUEUES = 10;
+
+    Tester tester;
+
+    const int numPartitions = static_cast<int>(
+        tester.d_cluster_mp->_state()->partitions().size());
+    BSLS_ASSERT_OPT(numPartitions <= k_NUM_QUEUES);
+
+    tester.assignQueues(k_NUM_QUEUES);
+    tester.electLeader();
+    tester.failoverAllPartitions();
+    tester.openQueues(k_NUM_QUEUES);
+
+    for (int pid = 0; pid < numPartitions; ++pid) {
+        const int numQueues = (k_NUM_QUEUES - pid + numPartitions - 1) /
+                              numPartitions;
+        const int numPendingRequests =
+            tester.d_clusterQueueHelper_mp->numPendingReopenQueueRequests();
+
+        tester.failoverPartition(pid);
+
+        // 1. All the queues of the partition are reopened
+        bsl::vector<bsl::string> uris(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ_D(pid,
+                           tester.popOpenQueueRequests(numQueues + 1, &uris),
+                           numQueues);
+        BMQTST_ASSERT_EQ_D(
+            pid,
+            tester.d_clusterQueueHelper_mp->numPendingReopenQueueRequests(),
+            numPendingRequests + numQueues);
+
+        // 2. Only the queues of the partition are reopened
+        for (size_t i = 0; i < uris.size(); ++i) {
+            const bmqt::Uri uri(uris[i], bmqtst::TestHelperUtil::allocator());
+            BMQTST_ASSERT_EQ_D(uris[i], tester.partitionId(uri), pid);
+        }
+    }
+}
+
+static void test4_queueUnassignmentAndReassignment()
+// ------------------------------------------------------------------------
+// QUEUE UNASSIGNMENT AND REASSIGNMENT
+//
+// Concerns:
+//   1. Once unassigned, an opened queue is no longer reopened upon a
+//      failover of its former partition.
+//   2. Once reassigned to another partition and opened again, the queue is
+//      reopened upon a failover of its new partition only.
+//
+// Plan:
+//   1. Assign queues across all partitions, elect a leader, fail over all
+//      partitions and open all the queues.
+//   2. Unassign a queue of partition 0, and fail over partition 0.
+//   3. Assign the queue to partition 1 and open it, then fail over
+//      partitions 0 and 1.
+//
+// Testing:
+//   onQueueUnassigned
+//   onQueueAssigned
+//   restoreState
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("QUEUE UNASSIGNMENT AND REASSIGNMENT");
+
+    const int k_NUM_QUEUES = 10;
+
+    Tester tester;
+
+    const int numPartitions = static_cast<int>(
+        tester.d_cluster_mp->_state()->partitions().size());
+    BSLS_ASSERT_OPT(2 <= numPartitions && numPartitions <= k_NUM_QUEUES);
+
+    const int numQueues0 = (k_NUM_QUEUES + numPartitions - 1) /
+                           numPartitions;
+    const int numQueues1 = (k_NUM_QUEUES + numPartitions - 2) /
+                           numPartitions;
+
+    tester.assignQueues(k_NUM_QUEUES);
+    tester.electLeader();
+    tester.failoverAllPartitions();
+    tester.openQueues(k_NUM_QUEUES);
+
+    // Queue 0 is on partition 0
+    const bmqt::Uri uri = queueUri(0);
+    BMQTST_ASSERT_EQ(tester.partitionId(uri), 0);
+
+    // 1. Unassign the queue
+    BMQTST_ASSERT(tester.d_cluster_mp->_state()->unassignQueue(uri));
+
+    tester.failoverPartition(0);
+
+    bsl::vector<bsl::string> uris(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(tester.popOpenQueueRequests(numQueues0, &uris),
+                     numQueues0 - 1);
+    BMQTST_ASSERT(bsl::find(uris.begin(), uris.end(), uri.asString()) ==
+                  uris.end());
+
+    // 2. Reassign the queue to partition 1, and open it again
+    tester.assignQueue(0, 1);
+    tester.openQueue(0);
+
+    mqbcmd::StorageContent content(bmqtst::TestHelperUtil::allocator());
+    tester.d_clusterQueueHelper_mp->loadQueuesInfo(&content);
+    BMQTST_ASSERT_EQ(content.storages().size(),
+                     static_cast<size_t>(k_NUM_QUEUES));
+    for (size_t i = 0; i < content.storages().size(); ++i) {
+        const mqbcmd::StorageQueueInfo& info = content.storages()[i];
+        if (info.queueUri() == uri.asString()) {
+            BMQTST_ASSERT_EQ(info.partitionId(), 1);
+        }
+    }
+
+    uris.clear();
+    tester.failoverPartition(0);
+    BMQTST_ASSERT_EQ(tester.popOpenQueueRequests(numQueues0, &uris),
+                     numQueues0 - 1);
+    BMQTST_ASSERT(bsl::find(uris.begin(), uris.end(), uri.asString()) ==
+                  uris.end());
+
+    uris.clear();
+    tester.failoverPartition(1);
+    BMQTST_ASSERT_EQ(tester.popOpenQueueRequests(numQueues1 + 2, &uris),
+                     numQueues1 + 1);
+    BMQTST_ASSERT(bsl::find(uris.begin(), uris.end(), uri.asString()) !=
+                  uris.end());
+}
+
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+BSLA_MAYBE_UNUSED
+static void testN1_reopenStormBenchmark()
+// ------------------------------------------------------------------------
+// REOPEN STORM BENCHMARK
+//
+// Concerns:
+//   Measure the time it takes a replica to restore its state after a
+//   failover of all the partitions of a cluster with a large number of
+//   opened queues, which is the cost of visiting the queues of each
+//   partition being restored and sending a ReopenQueue request for each of
+//   them.
+//
+// Plan:
+//   - Assign a large number of queues across all partitions, and open
+//     them.
+//   - Fail over all partitions, one at a time, timing each failover, and
+//     pop the ReopenQueue requests sent outside of the timed section.
+//
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("REOPEN STORM BENCHMARK");
+
+    const int k_NUM_QUEUES = 10000;
+    const int k_NUM_ROUNDS = 10;
+
+    Tester tester;
+    tester.assignQueues(k_NUM_QUEUES);
+    tester.electLeader();
+    tester.failoverAllPartitions();
+    tester.openQueues(k_NUM_QUEUES);
+
+    const int numPartitions = static_cast<int>(
+        tester.d_cluster_mp->_state()->partitions().size());
+
+    bsls::Types::Int64 elapsed = 0;
+    for (int i = 0; i < k_NUM_ROUNDS; ++i) {
+        for (int pid = 0; pid < numPartitions; ++pid) {
+            const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+            tester.failoverPartition(pid);
+            elapsed += bsls::TimeUtil::getTimer() - begin;
+        }
+
+        const int numRequests = tester.popOpenQueueRequests(k_NUM_QUEUES);
+        BMQTST_ASSERT_EQ(numRequests, k_NUM_QUEUES);
+    }
+
+    const bsls::Types::Int64 numFailovers = k_NUM_ROUNDS * numPartitions;
+
+    cout << "Failed over " << numFailovers << " partitions with "
+         << bmqu::PrintUtil::prettyNumber(
+                static_cast<bsls::Types::Int64>(k_NUM_QUEUES))
+         << " opened queues in "
+         << bmqu::PrintUtil::prettyTimeInterval(elapsed) << ".\n"
+         << "Above implies that 1 partition was restored in "
+         << bmqu::PrintUtil::prettyTimeInterval(elapsed / numFailovers)
+         << ".\n";
+}
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void
+testN1_reopenStormBenchmark_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// REOPEN STORM BENCHMARK
+//
+// Concerns:
+//   Measure the time it takes a replica to restore its state after a
+//   failover of all the partitions of a cluster with `state.range()`
+//   opened queues.
+//
+// Plan:
+//   - Assign `state.range()` queues across all partitions, and open them.
+//   - Fail over all partitions, one at a time, in a timed loop, and pop
+//     the ReopenQueue requests sent outside of the timed section.
+//
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK REOPEN STORM BENCHMARK");
+
+    const int numQueues = static_cast<int>(state.range());
+
+    Tester tester;
+    tester.assignQueues(numQueues);
+    tester.electLeader();
+    tester.failoverAllPartitions();
+    tester.openQueues(numQueues);
+
+    for (auto _ : state) {
+        tester.failoverAllPartitions();
+
+        state.PauseTiming();
+        tester.popOpenQueueRequests(numQueues);
+        state.ResumeTiming();
+    }
+}
+#endif  // BMQTST_BENCHMARK_ENABLED
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    {
+        mqbcfg::AppConfig brokerConfig(bmqtst::TestHelperUtil::allocator());
+        mqbcfg::BrokerConfig::set(brokerConfig);
+
+        switch (_testCase) {
+        case 0:
+        case 4: test4_queueUnassignmentAndReassignment(); break;
+        case 3: test3_partitionScopedRestore(); break;
+        case 2: test2_queueAssignmentAndFailover(); break;
+        case 1: test1_breathingTest(); break;
+        case -1:
+            BMQTST_BENCHMARK_WITH_ARGS(testN1_reopenStormBenchmark,
+                                       RangeMultiplier(10)
+                                           ->Range(100, 10000)
+                                           ->Unit(benchmark::kMillisecond));
+            break;
+        default: {
+            cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+            bmqtst::TestHelperUtil::testStatus() = -1;
+        } break;
+        }
+#ifdef BMQTST_BENCHMARK_ENABLED
+        if (_testCase < 0) {
+            benchmark::Initialize(&argc, argv);
+            benchmark::RunSpecifiedBenchmarks();
+        }
+#endif
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_DEFAULT);
+}
@@ -71,6 +71,8 @@ void ClusterStateManager::onCommit(
     BSLS_ASSERT_SAFE(d_cluster_p->inDispatcherThread());
     BSLS_ASSERT_SAFE(advisory.choice().isClusterMessageValue());
 
+    d_queueAssignmentBatcher.onCommit(advisory, status);
+
     if (status != mqbc::ClusterStateLedgerCommitStatus::e_SUCCESS) {
         BALL_LOG_ERROR << d_clusterData_p->identity().description()
                        << ": Failed to commit advisory: " << advisory
@@ -712,6 +714,11 @@ ClusterStateManager::ClusterStateManager(
 , d_clusterData_p(clusterData)
 , d_state_p(clusterState)
 , d_clusterStateLedger_mp(clusterStateLedger)
+, d_queueAssignmentBatcher(cluster,
+                           clusterData,
+                           clusterState,
+                           d_clusterStateLedger_mp.get(),
+                           allocator)
 , d_storageManager_p(0)
 {
     // executed by *ANY* thread
@@ -780,6 +787,8 @@ void ClusterStateManager::stop()
 
     d_isStarted = false;
 
+    d_queueAssignmentBatcher.cancel();
+
     const int rc = d_clusterStateLedger_mp->close();
     if (rc != 0) {
         BALL_LOG_ERROR << d_clusterData_p->identity().description()
@@ -866,13 +875,7 @@ bool ClusterStateManager::assignQueue(const bmqt::Uri&      uri,
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_cluster_p->inDispatcherThread());
 
-    return mqbc::ClusterUtil::assignQueue(d_state_p,
-                                          d_clusterData_p,
-                                          d_clusterStateLedger_mp.get(),
-                                          d_cluster_p,
-                                          uri,
-                                          d_allocator_p,
-                                          status);
+    return d_queueAssignmentBatcher.assignQueue(uri, status);
 }
 
 void ClusterStateManager::registerQueueInfo(
@@ -1137,12 +1140,14 @@ void ClusterStateManager::processQueueAssignmentRequest(
     BSLS_ASSERT_SAFE(d_cluster_p->inDispatcherThread());
 
     mqbc::ClusterUtil::processQueueAssignmentRequest(
-        d_state_p,
         d_clusterData_p,
-        d_clusterStateLedger_mp.get(),
         d_cluster_p,
         request,
         requester,
+        bdlf::BindUtil::bind(&mqbc::QueueAssignmentBatcher::assignQueue,
+                             &d_queueAssignmentBatcher,
+                             bdlf::PlaceHolders::_1,   // uri
+                             bdlf::PlaceHolders::_2),  // status
         d_allocator_p);
 }
 
@@ -37,6 +37,7 @@
 #include <mqbc_clusterstateledger.h>
 #include <mqbc_clusterutil.h>
 #include <mqbc_electorinfo.h>
+#include <mqbc_queueassignmentbatcher.h>
 #include <mqbcfg_messages.h>
 #include <mqbi_clusterstatemanager.h>
 #include <mqbi_dispatcher.h>
@@ -155,6 +156,10 @@ class ClusterStateManager BSLS_KEYWORD_FINAL
     ///       serve as the "single source of truth".
     ClusterStateLedgerMp d_clusterStateLedger_mp;
 
+    /// Batcher of the queue assignments of self as the leader, applying
+    /// them to `d_clusterStateLedger_mp`.
+    mqbc::QueueAssignmentBatcher d_queueAssignmentBatcher;
+
     mqbi::StorageManager* d_storageManager_p;
 
     AfterPartitionPrimaryAssignmentCb d_afterPartitionPrimaryAssignmentCb;
@@ -274,8 +274,10 @@ parseHandleParameters(bmqp_ctrlmsg::QueueHandleParameters* handleParams,
 /// are seperated by at least one soft delimiter (e.g. ` `) and no hard
 /// delimiters:
 ///   '[consumerPriority=<P>] [consumerPriorityCount=<C>]
-///    [maxUnconfirmedMessages=<M>] [maxUnconfirmedBytes=<B>]'
-/// The behavior is undefined unless `attributesStr` is formatted as above.
+///    [maxUnconfirmedMessages=<M>] [maxUnconfirmedBytes=<B>]
+///    [expression=<E>]'
+/// The behavior is undefined unless `attributesStr` is formatted as above,
+/// and the subscription expression `<E>` has neither spaces nor `=`.
 static int parseStreamParameters(bmqp_ctrlmsg::StreamParameters* streamParams,
                                  const bsl::string&              attributesStr)
 {
@@ -361,6 +363,21 @@ static int parseStreamParameters(bmqp_ctrlmsg::StreamParameters* streamParams,
 
             ++tokenizer;
         }
+        else if (bdlb::String::areEqualCaseless("expression", attribute)) {
+            bmqp_ctrlmsg::Expression& expression =
+                streamParams->subscriptions()[0].expression();
+            BSLS_ASSERT_OPT(expression.text().empty() &&
+                            "Duplicate expression in 'attributesStr'");
+
+            ++tokenizer;
+            BSLS_ASSERT_OPT(!tokenizer.isTrailingHard());
+
+            expression.version() =
+                bmqp_ctrlmsg::ExpressionVersion::E_VERSION_1;
+            expression.text() = tokenizer.token();
+
+            ++tokenizer;
+        }
         else {
             BSLS_ASSERT_OPT(false && "Format error in 'clientText'");
         }
@@ -939,6 +956,13 @@ QueueEngineTester::client(const bslstl::StringRef& clientKey)
 
 void QueueEngineTester::post(const bslstl::StringRef& messages,
                              RelayQueueEngine*        downstream)
+{
+    post(messages, bmqp::MessageProperties(d_allocator_p), downstream);
+}
+
+void QueueEngineTester::post(const bslstl::StringRef&       messages,
+                             const bmqp::MessageProperties& properties,
+                             RelayQueueEngine*              downstream)
 {
     // PRECONDITIONS
     BSLS_ASSERT_OPT(d_queueEngine_mp &&
@@ -981,6 +1005,16 @@ void QueueEngineTester::post(const bslstl::StringRef& messages,
         appData.createInplace(d_allocator_p,
                               d_mockCluster_mp->bufferFactory(),
                               d_allocator_p);
+        if (properties.numProperties()) {
+            // Properties precede the payload.
+            const bmqp::MessagePropertiesInfo info =
+                bmqp::MessagePropertiesInfo::makeNoSchema();
+            bdlbb::BlobUtil::append(
+                appData.get(),
+                properties.streamOut(d_mockCluster_mp->bufferFactory(),
+                                     info));
+            msgAttributes.setMessagePropertiesInfo(info);
+        }
         bdlbb::BlobUtil::append(appData.get(),
                                 msgs[i].data(),
                                 msgs[i].length());
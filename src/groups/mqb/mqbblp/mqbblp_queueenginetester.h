@@ -129,6 +129,7 @@
 
 // BMQ
 #include <bmqc_orderedhashmap.h>
+#include <bmqp_messageproperties.h>
 #include <bmqt_messageguid.h>
 #include <bmqu_time.h>
 
@@ -332,7 +333,8 @@ class QueueEngineTester {
     ///   '<clientKey>[\@<appId>] [consumerPriority=<P>]
     ///                          [consumerPriorityCount=<C>]
     ///                          [maxUnconfirmedMessages=<M>]
-    ///                          [maxUnconfirmedBytes=<B>]'
+    ///                          [maxUnconfirmedBytes=<B>]
+    ///                          [expression=<E>]'
     ///
     /// Return the result status code of the configureHandle operation (zero
     /// on success, non-zero otherwise).  The behavior is undefined unless
@@ -362,6 +364,16 @@ class QueueEngineTester {
     void post(const bslstl::StringRef& messages,
               RelayQueueEngine*        downstream = 0);
 
+    /// Post the specified `messages`, formatted as above, with each message
+    /// carrying the specified `properties`, and optionally involving the
+    /// specified `downstream` as above.  The behavior is undefined unless
+    /// `messages` is formatted as above and each message is unique (across
+    /// the lifetime of this object), or if `createQueueEngine()` was not
+    /// called.
+    void post(const bslstl::StringRef&       messages,
+              const bmqp::MessageProperties& properties,
+              RelayQueueEngine*              downstream = 0);
+
     /// Invoke the Queue Engine's `afterNewMessage()` method for the
     /// specified `numMessages` newly posted messages if `numMessages > 0`,
     /// or all newly posted messages if `numMessages == 0`.  The behavior is
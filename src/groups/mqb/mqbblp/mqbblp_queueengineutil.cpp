@@ -33,6 +33,7 @@
 #include <mqbi_domain.h>
 #include <mqbi_queue.h>
 #include <mqbs_storageutil.h>
+#include <mqbstat_messagetracer.h>
 #include <mqbstat_queuestats.h>
 
 #include <bmqtsk_alarmlog.h>
@@ -44,6 +45,7 @@
 #include <ball_logthrottle.h>
 #include <bdlbb_blob.h>
 #include <bdlbb_blobutil.h>
+#include <bdld_datum.h>
 #include <bdls_filesystemutil.h>
 #include <bsl_fstream.h>
 #include <bsl_string.h>
@@ -74,6 +76,14 @@ const bsls::Types::Int64 k_NS_PER_MESSAGE =
     bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MINUTE / k_MAX_INSTANT_MESSAGES;
 // Time interval between messages logged with throttling.
 
+const int k_NUM_PRIORITY_LANES = 3;
+// Number of priority lanes.  Messages with a priority higher than that share
+// the highest lane.
+
+const size_t k_MAX_PRIORITY_DELIVERIES = 16;
+// Maximum number of messages delivered out of the priority lanes before the
+// backlog (starting from the resume point) has to make progress.
+
 #define BMQ_LOGTHROTTLE_INFO                                                  \
     BALL_LOGTHROTTLE_INFO(k_MAX_INSTANT_MESSAGES, k_NS_PER_MESSAGE)           \
         << "[THROTTLED] "
@@ -756,16 +766,28 @@ QueueEngineUtil_AppsDeliveryContext::QueueEngineUtil_AppsDeliveryContext(
 , d_currentMessage_p(0)
 , d_queue_p(queue)
 , d_timeDelta()
+, d_priorityProperty(allocator)
+, d_priorityLane()
+, d_preader_p(0)
+, d_allocator_p(allocator)
 , d_revCounter(0)
 {
     BSLS_ASSERT_SAFE(queue);
 }
 
+void QueueEngineUtil_AppsDeliveryContext::setPriorityProperty(
+    const bsl::string& value)
+{
+    d_priorityProperty = value;
+}
+
 bool QueueEngineUtil_AppsDeliveryContext::reset(
     mqbi::StorageIterator* currentMessage)
 {
+    releaseReader();
     d_consumers.clear();
     d_timeDelta.reset();
+    d_priorityLane.reset();
 
     bool result = false;
 
@@ -794,6 +816,14 @@ bool QueueEngineUtil_AppsDeliveryContext::processApp(
 
     ++d_numApps;
 
+    if (!d_preader_p) {
+        // All Apps share the same routing context.  Prepare its properties
+        // reader for the duration of the message, so the subscriptions of
+        // all Apps are evaluated against the properties read once.
+        d_preader_p = app.routing()->d_queue_p->d_preader.get();
+        d_preader_p->next(d_currentMessage_p);
+    }
+
     if (d_queue_p->isDeliverAll()) {
         // collect all handles
         BroadcastVisitor visitor(&d_consumers);
@@ -809,6 +839,15 @@ bool QueueEngineUtil_AppsDeliveryContext::processApp(
             // The queue iterator can advance leaving the 'app' behind.
             app.setResumePoint(d_currentMessage_p->guid());
         }
+        else if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                     !d_priorityProperty.empty() && app.isAuthorized())) {
+            // The 'app' is behind.  Let a message with priority overtake
+            // the backlog (in 'deliverMessages').
+            const int lane = priorityLane(app);
+            if (lane) {
+                app.putForPriority(d_currentMessage_p->guid(), lane);
+            }
+        }
         ++d_numStops;
         // else the existing resumePoint is earlier (if authorized)
         return false;  // RETURN
@@ -871,6 +910,9 @@ void QueueEngineUtil_AppsDeliveryContext::deliverMessage()
     BSLS_ASSERT_SAFE(d_currentMessage_p);
 
     if (!d_consumers.empty()) {
+        mqbstat::MessageTracer::trace(d_currentMessage_p->guid(),
+                                      mqbstat::MessageTracer::Stage::e_ROUTE);
+
         for (Consumers::const_iterator it = d_consumers.begin();
              it != d_consumers.end();
              ++it) {
@@ -888,6 +930,9 @@ void QueueEngineUtil_AppsDeliveryContext::deliverMessage()
         }
     }
 
+    // Release the reader before advancing the iterator the reader refers to.
+    releaseReader();
+
     if (haveProgress()) {
         d_currentMessage_p->advance();
     }
@@ -918,6 +963,44 @@ int QueueEngineUtil_AppsDeliveryContext::revCounter() const
     return d_revCounter;
 }
 
+int QueueEngineUtil_AppsDeliveryContext::priorityLane(
+    QueueEngineUtil_AppState& app)
+{
+    BSLS_ASSERT_SAFE(d_preader_p);
+
+    if (!d_priorityLane.has_value()) {
+        // Use the properties reader shared by all Apps.  Reading counts as a
+        // subscription operation for the purpose of the flow control.
+        const bdld::Datum value = d_preader_p->get(d_priorityProperty,
+                                                   d_allocator_p);
+
+        bsls::Types::Int64 priority = 0;
+
+        if (value.isInteger()) {
+            priority = value.theInteger();
+        }
+        else if (value.isInteger64()) {
+            priority = value.theInteger64();
+        }
+        // else no (or not an integer) priority; FIFO
+
+        if (priority > app.numPriorityLanes()) {
+            priority = app.numPriorityLanes();
+        }
+        d_priorityLane = priority > 0 ? static_cast<int>(priority) : 0;
+    }
+    return d_priorityLane.value();
+}
+
+void QueueEngineUtil_AppsDeliveryContext::releaseReader()
+{
+    if (d_preader_p) {
+        // Keep the number of hits for the flow control.
+        d_preader_p->next(0);
+        d_preader_p = 0;
+    }
+}
+
 // -------------------------
 // struct AppConsumers_State
 // -------------------------
@@ -940,6 +1023,9 @@ QueueEngineUtil_AppState::QueueEngineUtil_AppState(
       bsl::allocate_shared<Routers::AppContext>(allocator, &queueContext))
 , d_redeliveryList(allocator)
 , d_putAsideList(allocator)
+, d_priorityLanes(k_NUM_PRIORITY_LANES, RedeliveryList(allocator), allocator)
+, d_priorityGuids(allocator)
+, d_numPriorityDeliveries(0)
 , d_priorityCount(0)
 , d_queue_p(queue)
 , d_isAuthorized(false)
@@ -1001,6 +1087,15 @@ size_t QueueEngineUtil_AppState::catchUp(
     size_t                       numMessages = 0;
     const mqbi::StorageIterator* current     = 0;
     while ((current = start->next())) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_priorityGuids.empty())) {
+            if (d_priorityGuids.erase(current->guid()) &&
+                !eraseFromPriorityLanes(current->guid())) {
+                // Already delivered out of a priority lane.
+                continue;  // CONTINUE
+            }
+            // else deliver the message here and now, in order.
+        }
+
         Routers::Result result = Routers::e_SUCCESS;
 
         if (QueueEngineUtil::isBroadcastMode(d_queue_p)) {
@@ -1034,6 +1129,20 @@ size_t QueueEngineUtil_AppState::catchUp(
         }
     }
 
+    if (numMessages) {
+        // The backlog has made progress, renew the budget of the lanes.
+        d_numPriorityDeliveries = 0;
+    }
+
+    if (d_resumePoint.isUnset() && !d_priorityGuids.empty()) {
+        // Caught up with the data stream.  Whatever is left in the lanes has
+        // been gc'ed or purged.
+        d_priorityGuids.clear();
+        for (size_t lane = 0; lane < d_priorityLanes.size(); ++lane) {
+            d_priorityLanes[lane].clear();
+        }
+    }
+
     return numMessages;
 }
 
@@ -1133,6 +1242,9 @@ QueueEngineUtil_AppState::processDeliveryLists(bsls::TimeInterval*    delay,
     size_t numMessages = processDeliveryList(delay, reader, d_redeliveryList);
     if (*delay == bsls::TimeInterval()) {
         // The only excuse for stopping the iteration is poisonous message
+        numMessages += processPriorityLanes(delay, reader);
+    }
+    if (*delay == bsls::TimeInterval()) {
         numMessages += processDeliveryList(delay, reader, d_putAsideList);
     }
 
@@ -1145,10 +1257,11 @@ QueueEngineUtil_AppState::processDeliveryLists(bsls::TimeInterval*    delay,
     return numMessages;
 }
 
-size_t
-QueueEngineUtil_AppState::processDeliveryList(bsls::TimeInterval*    delay,
-                                              mqbi::StorageIterator* reader,
-                                              RedeliveryList&        list)
+size_t QueueEngineUtil_AppState::processDeliveryList(
+    bsls::TimeInterval*    delay,
+    mqbi::StorageIterator* reader,
+    RedeliveryList&        list,
+    size_t                 maxMessages)
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(list.empty())) {
         return 0;  // RETURN
@@ -1159,7 +1272,7 @@ QueueEngineUtil_AppState::processDeliveryList(bsls::TimeInterval*    delay,
     bmqt::MessageGUID        firstGuid   = *it;
     size_t                   numMessages = 0;
 
-    while (!list.isEnd(it)) {
+    while (!list.isEnd(it) && numMessages < maxMessages) {
         Routers::Result result = Routers::e_INVALID;
 
         // Retrieve message from the storage
@@ -1469,6 +1582,24 @@ void QueueEngineUtil_AppState::clear()
     d_resumePoint = bmqt::MessageGUID();
     d_redeliveryList.clear();
     d_putAsideList.clear();
+    for (size_t lane = 0; lane < d_priorityLanes.size(); ++lane) {
+        d_priorityLanes[lane].clear();
+    }
+    d_priorityGuids.clear();
+    d_numPriorityDeliveries = 0;
+}
+
+void QueueEngineUtil_AppState::erasePriorityMessage(
+    const bmqt::MessageGUID& guid)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_priorityGuids.empty())) {
+        return;  // RETURN
+    }
+
+    if (d_priorityGuids.erase(guid)) {
+        // Not delivered yet if still waiting in a lane.
+        eraseFromPriorityLanes(guid);
+    }
 }
 
 void QueueEngineUtil_AppState::loadInternals(mqbcmd::AppState* out) const
@@ -1551,5 +1682,51 @@ bool QueueEngineUtil_AppState::getOldestMessageIteratorFromList(
     return false;
 }
 
+size_t
+QueueEngineUtil_AppState::processPriorityLanes(bsls::TimeInterval*    delay,
+                                               mqbi::StorageIterator* reader)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_priorityGuids.empty())) {
+        return 0;  // RETURN
+    }
+
+    size_t maxMessages = bsl::numeric_limits<size_t>::max();
+
+    if (!d_resumePoint.isUnset()) {
+        // Do not starve the backlog.  Once the budget is exhausted, wait for
+        // 'catchUp' to make progress.
+        if (d_numPriorityDeliveries >= k_MAX_PRIORITY_DELIVERIES) {
+            return 0;  // RETURN
+        }
+        maxMessages = k_MAX_PRIORITY_DELIVERIES - d_numPriorityDeliveries;
+    }
+
+    size_t numMessages = 0;
+
+    for (size_t lane = d_priorityLanes.size();
+         lane-- > 0 && numMessages < maxMessages &&
+         *delay == bsls::TimeInterval();) {
+        numMessages += processDeliveryList(delay,
+                                           reader,
+                                           d_priorityLanes[lane],
+                                           maxMessages - numMessages);
+    }
+
+    d_numPriorityDeliveries += numMessages;
+
+    return numMessages;
+}
+
+bool QueueEngineUtil_AppState::eraseFromPriorityLanes(
+    const bmqt::MessageGUID& guid)
+{
+    for (size_t lane = 0; lane < d_priorityLanes.size(); ++lane) {
+        if (d_priorityLanes[lane].erase(guid)) {
+            return true;  // RETURN
+        }
+    }
+    return false;
+}
+
 }  // close namespace mqbblp
 }  // close namespace BloombergLP
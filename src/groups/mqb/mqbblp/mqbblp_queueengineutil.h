@@ -39,8 +39,10 @@
 #include <bdlmt_eventscheduler.h>
 #include <bdlmt_throttle.h>
 #include <bsl_functional.h>
+#include <bsl_limits.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_string.h>
 #include <bsl_unordered_map.h>
 #include <bsl_unordered_set.h>
 #include <bsl_utility.h>
@@ -272,9 +274,17 @@ class RedeliveryList {
     void trim(iterator* cit) const;
 
   public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RedeliveryList, bslma::UsesBslmaAllocator)
+
     // PUBLIC CREATORS
     RedeliveryList(bslma::Allocator* allocator);
 
+    /// Create a list having the same items as the specified `other`, using
+    /// the optionally specified `allocator` to supply memory.
+    RedeliveryList(const RedeliveryList& other,
+                   bslma::Allocator*     allocator = 0);
+
     // PUBLIC MANIPULATORS
 
     /// Add the specified `guid` to the list.
@@ -286,8 +296,9 @@ class RedeliveryList {
     /// Erase the item referenced by specified `cit` from the list.
     iterator erase(const iterator& cit);
 
-    /// Erase the specified `guid` from the list.
-    void erase(const bmqt::MessageGUID& guid);
+    /// Erase the specified `guid` from the list.  Return `true` if the
+    /// `guid` was in the list, and `false` otherwise.
+    bool erase(const bmqt::MessageGUID& guid);
 
     /// Load into the specified `cit` an iterator to next enabled (not
     /// disabled) item.  If there are no such items, load the iterator
@@ -350,6 +361,24 @@ struct QueueEngineUtil_AppState {
     /// List of messages without matching Subscription.
     RedeliveryList d_putAsideList;
 
+    /// Lists of messages which have arrived while this App is behind and
+    /// which get delivered ahead of the resume point, one list per priority
+    /// lane.  The higher the index, the higher the priority.
+    bsl::vector<RedeliveryList> d_priorityLanes;
+
+    /// Messages put in the priority lanes which `catchUp` has not reached
+    /// yet, and which this App has neither confirmed nor got removed from
+    /// the storage.  `catchUp` skips those already delivered out of the
+    /// lanes, which are therefore kept until confirmed, in the limit of the
+    /// unconfirmed messages of the consumers.
+    bsl::unordered_set<bmqt::MessageGUID,
+                       bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+        d_priorityGuids;
+
+    /// Number of messages delivered out of the priority lanes since the last
+    /// time `catchUp` made progress.  Bounds the starvation of the backlog.
+    size_t d_numPriorityDeliveries;
+
     size_t d_priorityCount;
 
     mqbi::Queue* d_queue_p;
@@ -439,11 +468,14 @@ struct QueueEngineUtil_AppState {
 
     /// Process delivery of messages in the redelivery list.  The specified
     /// `getMessageCb` provides message details for redelivery.  Load the
-    /// lowest handle delay into the specified `delay`. Return number of
+    /// lowest handle delay into the specified `delay`.  Stop after
+    /// delivering the optionally specified `maxMessages`.  Return number of
     /// re-delivered messages.
-    size_t processDeliveryList(bsls::TimeInterval*    delay,
-                               mqbi::StorageIterator* reader,
-                               RedeliveryList&        list);
+    size_t processDeliveryList(
+        bsls::TimeInterval*    delay,
+        mqbi::StorageIterator* reader,
+        RedeliveryList&        list,
+        size_t maxMessages = bsl::numeric_limits<size_t>::max());
 
     /// Load into the specified `out` object' internal information about
     /// this consumers group and associated queue handles.
@@ -520,6 +552,17 @@ struct QueueEngineUtil_AppState {
     /// messages get delivered as Out-Of-Order.
     void putForRedelivery(const bmqt::MessageGUID& guid);
 
+    /// Save the specified `guid` in the specified priority `lane` so the
+    /// message gets delivered (Out-Of-Order) ahead of the data stream
+    /// starting from the resume point.  The behavior is undefined unless
+    /// `0 < lane <= numPriorityLanes()` and this App has a resume point.
+    void putForPriority(const bmqt::MessageGUID& guid, int lane);
+
+    /// Forget the specified `guid`, if put in a priority lane, because this
+    /// App confirmed it or it got removed from the storage, so that neither
+    /// the lanes deliver it nor `catchUp` needs to skip it.
+    void erasePriorityMessage(const bmqt::MessageGUID& guid);
+
     /// Save the current position in the data stream to resume the delivery (by
     /// `deliverMessages`).
     void setResumePoint(const bmqt::MessageGUID& guid);
@@ -553,6 +596,14 @@ struct QueueEngineUtil_AppState {
 
     size_t redeliveryListSize() const;
 
+    /// Return the number of priority lanes.
+    int numPriorityLanes() const;
+
+    /// Return the number of messages put in the priority lanes which are
+    /// still tracked, i.e., neither reached by `catchUp`, nor confirmed by
+    /// this App, nor removed from the storage.
+    size_t numPriorityMessages() const;
+
     Routers::Consumer* findQueueHandleContext(mqbi::QueueHandle* handle);
 
     unsigned int upstreamSubQueueId() const;
@@ -592,6 +643,18 @@ struct QueueEngineUtil_AppState {
     bool getOldestMessageIteratorFromList(
         bslma::ManagedPtr<mqbi::StorageIterator>* out,
         RedeliveryList&                           list);
+
+    /// Deliver messages from the priority lanes, highest lane first.  Unless
+    /// there is no resume point, deliver no more than the remaining budget
+    /// of out-of-order deliveries so the data stream is not starved.  Load
+    /// the lowest handle delay into the specified `delay`.  Return number of
+    /// delivered messages.
+    size_t processPriorityLanes(bsls::TimeInterval*    delay,
+                                mqbi::StorageIterator* reader);
+
+    /// Erase the specified `guid` from the priority lanes.  Return `true` if
+    /// the `guid` was still waiting in one of them.
+    bool eraseFromPriorityLanes(const bmqt::MessageGUID& guid);
 };
 
 // ==========================================
@@ -612,6 +675,20 @@ struct QueueEngineUtil_AppsDeliveryContext {
     mqbi::Queue*                      d_queue_p;
     bsl::optional<bsls::Types::Int64> d_timeDelta;
 
+    /// Name of the message property carrying the priority of the message.
+    /// Empty when the delivery is FIFO.
+    bsl::string d_priorityProperty;
+
+    /// Priority lane of the current message, read on demand.
+    bsl::optional<int> d_priorityLane;
+
+    /// Properties reader prepared for the current message and shared by all
+    /// Apps, so the properties are read once per message.  Null until the
+    /// first App is processed.
+    Routers::MessagePropertiesReader* d_preader_p;
+
+    bslma::Allocator* d_allocator_p;
+
     /// Count delivery attempts (as a means to invalidate `lastPush`)
     int d_revCounter;
 
@@ -627,6 +704,11 @@ struct QueueEngineUtil_AppsDeliveryContext {
     QueueEngineUtil_AppsDeliveryContext(mqbi::Queue*      queue,
                                         bslma::Allocator* allocator);
 
+    /// Set the name of the message property carrying the priority of the
+    /// message to the specified `value`.  The empty `value` disables the
+    /// priority lanes.
+    void setPriorityProperty(const bsl::string& value);
+
     /// Prepare the context to process next message.
     /// Return `true` if the delivery can continue iterating dataStream
     /// The `false` return value indicates either the end of the dataStream or
@@ -670,6 +752,15 @@ struct QueueEngineUtil_AppsDeliveryContext {
     int revCounter() const;
 
     bsls::Types::Int64 timeDelta();
+
+  private:
+    /// Return the priority lane of the current message for the specified
+    /// `app`, or `0` if the message has no priority.
+    int priorityLane(QueueEngineUtil_AppState& app);
+
+    /// Release the properties reader (if any) prepared for the current
+    /// message.
+    void releaseReader();
 };
 
 // ============================================================================
@@ -714,6 +805,14 @@ inline RedeliveryList::RedeliveryList(bslma::Allocator* allocator)
     // NOTHING
 }
 
+inline RedeliveryList::RedeliveryList(const RedeliveryList& other,
+                                      bslma::Allocator*     allocator)
+: d_map(other.d_map, allocator)
+, d_stamp(other.d_stamp)
+{
+    // NOTHING
+}
+
 inline void RedeliveryList::add(const bmqt::MessageGUID& guid)
 {
     d_map.insert(bsl::make_pair(guid, Item()));
@@ -733,9 +832,9 @@ inline RedeliveryList::iterator RedeliveryList::erase(const iterator& cit)
     return result;
 }
 
-inline void RedeliveryList::erase(const bmqt::MessageGUID& guid)
+inline bool RedeliveryList::erase(const bmqt::MessageGUID& guid)
 {
-    d_map.erase(guid);
+    return d_map.erase(guid) != 0;
 }
 
 inline RedeliveryList::iterator RedeliveryList::begin()
@@ -820,6 +919,16 @@ inline size_t QueueEngineUtil_AppState::redeliveryListSize() const
     return d_redeliveryList.size();
 }
 
+inline int QueueEngineUtil_AppState::numPriorityLanes() const
+{
+    return static_cast<int>(d_priorityLanes.size());
+}
+
+inline size_t QueueEngineUtil_AppState::numPriorityMessages() const
+{
+    return d_priorityGuids.size();
+}
+
 inline Routers::Consumer*
 QueueEngineUtil_AppState::findQueueHandleContext(mqbi::QueueHandle* handle)
 {
@@ -866,6 +975,17 @@ inline void QueueEngineUtil_AppState::putAside(const bmqt::MessageGUID& guid)
     d_putAsideList.add(guid);
 }
 
+inline void
+QueueEngineUtil_AppState::putForPriority(const bmqt::MessageGUID& guid,
+                                         int                      lane)
+{
+    BSLS_ASSERT_SAFE(0 < lane && lane <= numPriorityLanes());
+    BSLS_ASSERT_SAFE(!d_resumePoint.isUnset());
+
+    d_priorityLanes[lane - 1].add(guid);
+    d_priorityGuids.insert(guid);
+}
+
 inline void
 QueueEngineUtil_AppState::setResumePoint(const bmqt::MessageGUID& guid)
 {
@@ -22,6 +22,7 @@
 #include <mqbc_clusterdata.h>
 #include <mqbc_clusterutil.h>
 #include <mqbc_recoveryutil.h>
+#include <mqbcmd_messages.h>
 #include <mqbs_datafileiterator.h>
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_filestoreprotocolutil.h>
@@ -58,6 +59,7 @@
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
 #include <bdlt_epochutil.h>
+#include <bdlt_timeunitratio.h>
 #include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>  // for bsl::rand()
@@ -68,7 +70,10 @@
 #include <bslma_managedptr.h>
 #include <bslmf_assert.h>
 #include <bslmt_latch.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
 #include <bslmt_threadutil.h>
+#include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 
 namespace BloombergLP {
@@ -81,6 +86,11 @@ const char k_LOG_CATEGORY[] = "MQBBLP.RECOVERYMANAGER";
 const unsigned int k_STARTUP_WAIT_RETRIES  = 20;
 const unsigned int k_STARTUP_WAIT_RETRY_MS = 1000;
 
+/// Interval, in milliseconds, at which a file transfer waiting for the
+/// channel to the peer to release chunks checks whether the recovery manager
+/// was stopped.  Releasing a chunk wakes up the transfer immediately.
+const int k_FILE_CHUNKS_STOP_CHECK_INTERVAL_MS = 100;
+
 /// This class provides a custom comparator to compare two (sync-point,
 /// offset) pairs.
 class SyncPointOffsetPairComparator {
@@ -141,6 +151,82 @@ void RecoveryManager_FileTransferInfo::clear()
     d_qlistFd.reset();
     d_areFileMapped      = false;
     d_aliasedChunksCount = 0;
+    d_numBytesTotal      = 0;
+    d_numBytesSent       = 0;
+    d_startTime          = 0;
+}
+
+bsls::Types::Int64
+RecoveryManager_FileTransferInfo::releaseChunk(bsls::Types::Int64 numBytes)
+{
+    // executed by *ANY* thread
+
+    d_numBytesSent += numBytes;
+
+    // Decrement and signal under the mutex, so that the waiting transfer
+    // cannot miss the release, and this object is not accessed anymore once
+    // another thread observes the last reference going away.
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_chunksMutex);  // LOCK
+    const bsls::Types::Int64       remaining = --d_aliasedChunksCount;
+    if (0 != remaining) {
+        d_chunksCondition.signal();
+    }
+
+    return remaining;
+}
+
+bool RecoveryManager_FileTransferInfo::waitForChunksInFlight(
+    int                     maxChunksInFlight,
+    const bsls::AtomicBool& isStarted)
+{
+    // executed by the *FILE TRANSFER* thread pool
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < maxChunksInFlight);
+    BSLS_ASSERT_SAFE(0 < aliasedChunksCount());
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_chunksMutex);  // LOCK
+
+    // Do not count the reference held by the proctor of the transfer.
+    while (d_aliasedChunksCount - 1 >= maxChunksInFlight) {
+        if (!isStarted) {
+            return false;  // RETURN
+        }
+
+        d_chunksCondition.timedWait(
+            &d_chunksMutex,
+            bsls::SystemTime::nowRealtimeClock() +
+                bsls::TimeInterval().addMilliseconds(
+                    k_FILE_CHUNKS_STOP_CHECK_INTERVAL_MS));
+    }
+
+    return true;
+}
+
+// ACCESSORS
+void RecoveryManager_FileTransferInfo::loadProgress(
+    mqbcmd::PartitionSyncProgress* progress,
+    bsls::Types::Int64             now) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(progress);
+    BSLS_ASSERT_SAFE(0 != startTime());
+
+    const bsls::Types::Int64 elapsed  = now - startTime();
+    const bsls::Types::Int64 numBytes = numBytesSent();
+
+    // Note that the chunks still referenced by the channel to the peer are
+    // not accounted as sent.
+
+    progress->totalBytes()    = numBytesTotal();
+    progress->sentBytes()     = numBytes;
+    progress->elapsedTimeMs() = elapsed / bdlt::TimeUnitRatio::k_NS_PER_MS;
+    progress->throughputBytesPerSec() =
+        elapsed > 0 ? static_cast<bsls::Types::Uint64>(
+                          static_cast<double>(numBytes) *
+                          bdlt::TimeUnitRatio::k_NS_PER_S / elapsed)
+                    : 0;
 }
 
 // -----------------------------------------
@@ -256,7 +342,7 @@ void RecoveryManager_ChunkDeleter::operator()(
     // If we maintain the type of chunk 'ptr' (DATA/JOURNAL/QLIST), then we can
     // also assert the range of 'ptr' (similar to mqbs::FileStore).
 
-    if (0 != --fti->d_aliasedChunksCount) {
+    if (0 != fti->releaseChunk(d_numBytes)) {
         return;  // RETURN
     }
 
@@ -1531,11 +1617,13 @@ void RecoveryManager::stopDispatched(int partitionId, bslmt::Latch* latch)
     latch->arrive();
 }
 
-int RecoveryManager::sendFile(RequestContext*                   context,
-                              bsls::Types::Uint64               beginOffset,
-                              bsls::Types::Uint64               endOffset,
-                              unsigned int                      chunkSize,
-                              bmqp::RecoveryFileChunkType::Enum chunkFileType)
+int RecoveryManager::sendFile(
+    RequestContext*                   context,
+    bsls::Types::Uint64               beginOffset,
+    bsls::Types::Uint64               endOffset,
+    unsigned int                      chunkSize,
+    int                               maxChunksInFlight,
+    bmqp::RecoveryFileChunkType::Enum chunkFileType)
 
 {
     // executed by *ANY* thread
@@ -1544,8 +1632,14 @@ int RecoveryManager::sendFile(RequestContext*                   context,
     BSLS_ASSERT_SAFE(context);
     BSLS_ASSERT_SAFE(beginOffset <= endOffset);
     BSLS_ASSERT_SAFE(0 < chunkSize);
+    BSLS_ASSERT_SAFE(0 < maxChunksInFlight);
 
-    enum { rc_SUCCESS = 0, rc_BUILDER_FAILURE = -1, rc_WRITE_FAILURE = -2 };
+    enum {
+        rc_SUCCESS         = 0,
+        rc_BUILDER_FAILURE = -1,
+        rc_WRITE_FAILURE   = -2,
+        rc_STOPPED         = -3
+    };
 
     mqbs::MappedFileDescriptor* mfd = 0;
     FileTransferInfo&           fti = context->fileTransferInfo();
@@ -1583,8 +1677,16 @@ int RecoveryManager::sendFile(RequestContext*                   context,
     while ((currOffset + chunkSize) < endOffset) {
         BSLS_ASSERT_SAFE(currOffset < mfd->fileSize());
 
+        // Chunks alias the mapped file and are only released once written to
+        // the peer, so bound their number to keep the memory pinned by the
+        // channel under control while the next chunks are being queued.
+
+        if (!fti.waitForChunksInFlight(maxChunksInFlight, d_isStarted)) {
+            return rc_STOPPED;  // RETURN
+        }
+
         bsl::shared_ptr<char> chunkBufferSp(mfd->mapping() + currOffset,
-                                            ChunkDeleter(context));
+                                            ChunkDeleter(context, chunkSize));
         bdlbb::BlobBuffer     chunkBlobBuffer(chunkBufferSp, chunkSize);
 
         // Bump up aliased chunk counter now that 'chunkBufferSp' is referring
@@ -1632,9 +1734,14 @@ int RecoveryManager::sendFile(RequestContext*                   context,
 
     // Send remaining part of the file.
 
-    bsl::shared_ptr<char> chunkBufferSp(mfd->mapping() + currOffset,
-                                        ChunkDeleter(context));
-    bdlbb::BlobBuffer chunkBlobBuffer(chunkBufferSp, endOffset - currOffset);
+    if (!fti.waitForChunksInFlight(maxChunksInFlight, d_isStarted)) {
+        return rc_STOPPED;  // RETURN
+    }
+
+    const bsls::Types::Int64 numBytes = endOffset - currOffset;
+    bsl::shared_ptr<char>    chunkBufferSp(mfd->mapping() + currOffset,
+                                           ChunkDeleter(context, numBytes));
+    bdlbb::BlobBuffer        chunkBlobBuffer(chunkBufferSp, numBytes);
 
     // Bump up aliased chunk counter now that 'chunkBufferSp' is referring to
     // the mapped region of type 'chunkFileType' (DATA/QLIST/JOURNAL).
@@ -2894,6 +3001,12 @@ RecoveryManager::RecoveryManager(
 , d_primarySyncRequestContexts(allocator)
 , d_recoveryRequestContextLock(bsls::SpinLock::s_unlocked)
 , d_primarySyncRequestContextLock(bsls::SpinLock::s_unlocked)
+, d_fileTransferThreadPool(
+      bslmt::ThreadAttributes().setThreadName("bmqFileXfer"),
+      0,                                                // minThreads
+      clusterConfig.partitionConfig().numPartitions(),  // maxThreads
+      bsls::TimeInterval(120).totalMilliseconds(),      // idle time
+      allocator)
 {
     BSLS_ASSERT_SAFE(d_allocator_p);
     BSLS_ASSERT_SAFE(d_dispatcher_p);
@@ -2941,6 +3054,13 @@ int RecoveryManager::start(bsl::ostream& errorDescription)
     BSLS_ASSERT_SAFE(static_cast<int>(d_primarySyncContexts.size()) ==
                      d_clusterConfig.partitionConfig().numPartitions());
 
+    int rc = d_fileTransferThreadPool.start();
+    if (0 != rc) {
+        errorDescription << "Failed to start file transfer thread pool "
+                         << "[rc: " << rc << "]";
+        return rc;  // RETURN
+    }
+
     d_isStarted = true;
 
     d_clusterData_p->membership().netCluster()->registerObserver(this);
@@ -2978,6 +3098,12 @@ void RecoveryManager::stop()
     }
 
     latch.wait();
+
+    // Ongoing file transfers abort once they observe that this object is
+    // stopped.
+
+    d_fileTransferThreadPool.stop();
+
     BALL_LOG_INFO << d_clusterData_p->identity().description()
                   << " RecoveryManager stopped.";
 }
@@ -4249,30 +4375,95 @@ void RecoveryManager::processStorageSyncRequest(
 
     d_clusterData_p->messageTransmitter().sendMessageSafe(controlMsg, source);
 
+    // Send the files from the file transfer thread pool, so that a transfer,
+    // which can take a long time for large partitions, does not hold the
+    // dispatcher thread of the partition.  'contextProctor' is bound to the
+    // job to keep 'requestCtx' alive until the transfer is complete.
+
+    fti.setNumBytesTotal(
+        static_cast<bsls::Types::Int64>(dataFileEndOffset -
+                                        dataFileBeginOffset) +
+        static_cast<bsls::Types::Int64>(qlistFileEndOffset -
+                                        qlistFileBeginOffset) +
+        static_cast<bsls::Types::Int64>(journalFileEndOffset -
+                                        journalFileBeginOffset));
+    fti.setStartTime(bmqu::Time::highResolutionTimer());
+
+    rc = d_fileTransferThreadPool.enqueueJob(
+        bdlf::BindUtil::bind(&RecoveryManager::sendPartitionFiles,
+                             this,
+                             contextProctor,
+                             &requestCtx,
+                             dataFileBeginOffset,
+                             dataFileEndOffset,
+                             qlistFileBeginOffset,
+                             qlistFileEndOffset,
+                             journalFileBeginOffset,
+                             journalFileEndOffset));
+    if (0 != rc) {
+        BMQTSK_ALARMLOG_ALARM("RECOVERY")
+            << d_clusterData_p->identity().description()
+            << ": Failed to enqueue the transfer of the files of Partition ["
+            << req.partitionId() << "] to " << source->nodeDescription()
+            << ", while serving storage sync request: " << req
+            << ". [rc: " << rc << "]." << BMQTSK_ALARMLOG_END;
+        return;  // RETURN
+    }
+}
+
+void RecoveryManager::sendPartitionFiles(
+    BSLA_MAYBE_UNUSED const bsl::shared_ptr<char>& contextProctor,
+    RequestContext*                                context,
+    bsls::Types::Uint64                            dataFileBeginOffset,
+    bsls::Types::Uint64                            dataFileEndOffset,
+    bsls::Types::Uint64                            qlistFileBeginOffset,
+    bsls::Types::Uint64                            qlistFileEndOffset,
+    bsls::Types::Uint64                            journalFileBeginOffset,
+    bsls::Types::Uint64                            journalFileEndOffset)
+{
+    // executed by the *FILE TRANSFER* thread pool
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(contextProctor);
+    BSLS_ASSERT_SAFE(context);
+
+    const int            partitionId = context->partitionId();
+    mqbnet::ClusterNode* source      = context->requesterNode();
+
+    const mqbcfg::StorageSyncConfig& syncConfig =
+        d_clusterConfig.partitionConfig().syncConfig();
+    const int fileChunkSize     = syncConfig.fileChunkSize();
+    const int maxChunksInFlight = bsl::max(1,
+                                           syncConfig.maxFileChunksInFlight());
+
+    // Note that the requester expects the DATA, QLIST and JOURNAL files in
+    // this order, over the same channel, so they are sent one after another.
+    // The transfer is pipelined instead: up to 'maxChunksInFlight' chunks are
+    // queued to the channel while the previous ones are being written.
+
     // Send data file patch first, in chunks.
     const bsls::Types::Int64 dataFileSize = dataFileEndOffset -
                                             dataFileBeginOffset;
     BSLS_ASSERT_SAFE(dataFileSize >= 0);
     BALL_LOG_INFO << d_clusterData_p->identity().description()
-                  << " Partition [" << req.partitionId()
+                  << " Partition [" << partitionId
                   << "]: sending DATA patch/file of size: "
                   << bmqu::PrintUtil::prettyNumber(dataFileSize) << " bytes.";
 
-    const int fileChunkSize =
-        d_clusterConfig.partitionConfig().syncConfig().fileChunkSize();
-    rc = sendFile(&requestCtx,
-                  dataFileBeginOffset,
-                  dataFileEndOffset,
-                  fileChunkSize,
-                  bmqp::RecoveryFileChunkType::e_DATA);
+    int rc = sendFile(context,
+                      dataFileBeginOffset,
+                      dataFileEndOffset,
+                      fileChunkSize,
+                      maxChunksInFlight,
+                      bmqp::RecoveryFileChunkType::e_DATA);
     if (0 != rc) {
         BMQTSK_ALARMLOG_ALARM("RECOVERY")
             << d_clusterData_p->identity().description()
             << ": Failed to send DATA file/patch to "
             << source->nodeDescription()
-            << ", while serving storage sync request: " << req
-            << ", from: " << source->nodeDescription() << ". [rc: " << rc
-            << "]. " << "Sending error." << BMQTSK_ALARMLOG_END;
+            << ", while serving storage sync request for Partition ["
+            << partitionId << "]. [rc: " << rc << "]."
+            << BMQTSK_ALARMLOG_END;
         return;  // RETURN
     }
 
@@ -4281,23 +4472,24 @@ void RecoveryManager::processStorageSyncRequest(
                                              qlistFileBeginOffset;
     BSLS_ASSERT_SAFE(qlistFileSize >= 0);
     BALL_LOG_INFO << d_clusterData_p->identity().description()
-                  << " Partition [" << req.partitionId()
+                  << " Partition [" << partitionId
                   << "]: sending QLIST file/patch of size: "
                   << bmqu::PrintUtil::prettyNumber(qlistFileSize) << " bytes.";
 
-    rc = sendFile(&requestCtx,
+    rc = sendFile(context,
                   qlistFileBeginOffset,
                   qlistFileEndOffset,
                   fileChunkSize,
+                  maxChunksInFlight,
                   bmqp::RecoveryFileChunkType::e_QLIST);
     if (0 != rc) {
         BMQTSK_ALARMLOG_ALARM("RECOVERY")
             << d_clusterData_p->identity().description()
             << ": Failed to send QLIST file/patch to "
             << source->nodeDescription()
-            << ", while serving storage sync request: " << req
-            << ", from: " << source->nodeDescription() << ". [rc: " << rc
-            << "]. " << "Sending error." << BMQTSK_ALARMLOG_END;
+            << ", while serving storage sync request for Partition ["
+            << partitionId << "]. [rc: " << rc << "]."
+            << BMQTSK_ALARMLOG_END;
         return;  // RETURN
     }
 
@@ -4306,26 +4498,38 @@ void RecoveryManager::processStorageSyncRequest(
                                                journalFileBeginOffset;
     BSLS_ASSERT_SAFE(journalFileSize >= 0);
     BALL_LOG_INFO << d_clusterData_p->identity().description()
-                  << " Partition [" << req.partitionId()
+                  << " Partition [" << partitionId
                   << "]: sending JOURNAL file/patch of size: "
                   << bmqu::PrintUtil::prettyNumber(journalFileSize)
                   << " bytes.";
 
-    rc = sendFile(&requestCtx,
+    rc = sendFile(context,
                   journalFileBeginOffset,
                   journalFileEndOffset,
                   fileChunkSize,
+                  maxChunksInFlight,
                   bmqp::RecoveryFileChunkType::e_JOURNAL);
     if (0 != rc) {
         BMQTSK_ALARMLOG_ALARM("RECOVERY")
             << d_clusterData_p->identity().description()
             << ": Failed to send JOURNAL file/patch to "
             << source->nodeDescription()
-            << ", while serving storage sync request: " << req
-            << ", from: " << source->nodeDescription() << ". [rc: " << rc
-            << "]. " << "Sending error." << BMQTSK_ALARMLOG_END;
+            << ", while serving storage sync request for Partition ["
+            << partitionId << "]. [rc: " << rc << "]."
+            << BMQTSK_ALARMLOG_END;
         return;  // RETURN
     }
+
+    const FileTransferInfo&  fti     = context->fileTransferInfo();
+    const bsls::Types::Int64 elapsed = bmqu::Time::highResolutionTimer() -
+                                       fti.startTime();
+    BALL_LOG_INFO << d_clusterData_p->identity().description()
+                  << " Partition [" << partitionId << "]: queued "
+                  << bmqu::PrintUtil::prettyBytes(fti.numBytesTotal())
+                  << " to " << source->nodeDescription() << " in "
+                  << bmqu::PrintUtil::prettyTimeInterval(elapsed)
+                  << " (window of " << maxChunksInFlight << " chunks of "
+                  << bmqu::PrintUtil::prettyBytes(fileChunkSize) << ").";
 }
 
 void RecoveryManager::startPartitionPrimarySync(
@@ -5029,5 +5233,41 @@ void RecoveryManager::onNodeStateChange(mqbnet::ClusterNode* node,
     }
 }
 
+// ACCESSORS
+void RecoveryManager::loadPartitionSyncProgress(
+    bsl::vector<mqbcmd::PartitionSyncProgress>* out,
+    int                                         partitionId) const
+{
+    // executed by *ANY* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(out);
+
+    const bsls::Types::Int64 now = bmqu::Time::highResolutionTimer();
+
+    bsls::SpinLockGuard guard(&d_recoveryRequestContextLock);  // LOCK
+
+    for (RequestContexts::const_iterator cit =
+             d_recoveryRequestContexts.begin();
+         cit != d_recoveryRequestContexts.end();
+         ++cit) {
+        const FileTransferInfo& fti = cit->fileTransferInfo();
+        if (0 == fti.startTime()) {
+            // Transfer of the files not started yet.
+            continue;  // CONTINUE
+        }
+
+        if (-1 != partitionId && cit->partitionId() != partitionId) {
+            continue;  // CONTINUE
+        }
+
+        out->resize(out->size() + 1);
+        mqbcmd::PartitionSyncProgress& progress = out->back();
+        progress.partitionId() = cit->partitionId();
+        progress.peerNodeId()  = cit->requesterNode()->nodeId();
+        fti.loadProgress(&progress, now);
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
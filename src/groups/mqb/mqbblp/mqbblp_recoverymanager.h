@@ -45,6 +45,7 @@
 #include <ball_log.h>
 #include <bdlbb_blob.h>
 #include <bdlmt_eventscheduler.h>
+#include <bdlmt_threadpool.h>
 #include <bsl_functional.h>
 #include <bsl_list.h>
 #include <bsl_memory.h>
@@ -53,6 +54,8 @@
 #include <bsl_vector.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_spinlock.h>
@@ -67,6 +70,9 @@ class Latch;
 namespace mqbc {
 class ClusterData;
 }
+namespace mqbcmd {
+class PartitionSyncProgress;
+}
 
 namespace mqbblp {
 
@@ -132,6 +138,24 @@ class RecoveryManager_FileTransferInfo {
     /// desired.
     bsls::AtomicInt64 d_aliasedChunksCount;
 
+    /// Total number of bytes of the data/qlist/journal files to transfer.
+    bsls::AtomicInt64 d_numBytesTotal;
+
+    /// Number of bytes of the chunks released by the channel to the peer,
+    /// i.e. effectively sent to the peer.
+    bsls::AtomicInt64 d_numBytesSent;
+
+    /// High resolution timer value at the beginning of the transfer, or 0 if
+    /// the transfer has not started.
+    bsls::AtomicInt64 d_startTime;
+
+    /// Mutex and condition signaled whenever a chunk is released, to wake up
+    /// the transfer waiting for the number of chunks in flight to go down.
+    /// Not copied along with the other members.
+    bslmt::Mutex d_chunksMutex;
+
+    bslmt::Condition d_chunksCondition;
+
   public:
     // CREATORS
     RecoveryManager_FileTransferInfo();
@@ -144,10 +168,35 @@ class RecoveryManager_FileTransferInfo {
     operator=(const RecoveryManager_FileTransferInfo& rhs);
 
     bsls::Types::Int64          incrementAliasedChunksCount();
+
+    /// Account for the release of a chunk of the specified `numBytes` bytes,
+    /// effectively sent to the peer, wake up the transfer waiting in
+    /// `waitForChunksInFlight`, if any, and return the number of references
+    /// remaining, including the one held by the proctor of the transfer.
+    /// Note that this object stays alive as long as a reference remains:
+    /// only the caller for which this method returns 0, i.e. which released
+    /// the last reference, may clean up or destroy this object, and only
+    /// after this method returned.  A caller for which this method returns
+    /// a non-zero value no longer holds a reference, and must not access
+    /// this object afterwards since the last reference may be released, and
+    /// this object destroyed, by another thread at any time.
+    bsls::Types::Int64 releaseChunk(bsls::Types::Int64 numBytes);
+
+    /// Block until fewer than the specified `maxChunksInFlight` chunks are
+    /// referenced by the channel to the peer, so that at most
+    /// `maxChunksInFlight` chunks are in flight once the next one is added.
+    /// Return true once that is the case, or false if the specified
+    /// `isStarted` flag is cleared in the meantime.  The behavior is
+    /// undefined unless the proctor of the transfer holds a reference.
+    bool waitForChunksInFlight(int                     maxChunksInFlight,
+                               const bsls::AtomicBool& isStarted);
+
     mqbs::MappedFileDescriptor& journalFd();
     mqbs::MappedFileDescriptor& dataFd();
     mqbs::MappedFileDescriptor& qlistFd();
     void                        setAreFilesMapped(bool value);
+    void                        setNumBytesTotal(bsls::Types::Int64 value);
+    void                        setStartTime(bsls::Types::Int64 value);
     void                        clear();
 
     // ACCESSORS
@@ -156,6 +205,16 @@ class RecoveryManager_FileTransferInfo {
     const mqbs::MappedFileDescriptor& qlistFd() const;
     bsls::Types::Int64                aliasedChunksCount() const;
     bool                              areFilesMapped() const;
+    bsls::Types::Int64                numBytesTotal() const;
+    bsls::Types::Int64                numBytesSent() const;
+    bsls::Types::Int64                startTime() const;
+
+    /// Load into the specified `progress` the total and sent bytes, the
+    /// elapsed time and the throughput of the transfer, as of the specified
+    /// `now` high resolution timer value.  The behavior is undefined unless
+    /// the transfer has started.
+    void loadProgress(mqbcmd::PartitionSyncProgress* progress,
+                      bsls::Types::Int64             now) const;
 };
 
 // =====================================
@@ -662,9 +721,14 @@ class RecoveryManager_ChunkDeleter {
     RequestContext*     d_requestContext_p;
     PrimarySyncContext* d_primarySyncContext_p;
 
+    /// Number of bytes of the chunk, accounted as sent once the chunk is
+    /// released.
+    bsls::Types::Int64 d_numBytes;
+
   public:
     // CREATORS
-    explicit RecoveryManager_ChunkDeleter(RequestContext* requestContext);
+    explicit RecoveryManager_ChunkDeleter(RequestContext*    requestContext,
+                                          bsls::Types::Int64 numBytes = 0);
 
     explicit RecoveryManager_ChunkDeleter(
         PrimarySyncContext* primarySyncContext);
@@ -797,11 +861,16 @@ class RecoveryManager : public mqbnet::ClusterObserver {
     RequestContexts d_primarySyncRequestContexts;
 
     /// Lock to protect access to `d_recoveryRequestContexts`.
-    bsls::SpinLock d_recoveryRequestContextLock;
+    mutable bsls::SpinLock d_recoveryRequestContextLock;
 
     // Lock to protect access to `d_primarySyncRequestContexts`.
     bsls::SpinLock d_primarySyncRequestContextLock;
 
+    /// Thread pool sending the files of the partitions to the peers
+    /// requesting a storage sync, so that a transfer does not hold the
+    /// dispatcher thread of its partition.
+    bdlmt::ThreadPool d_fileTransferThreadPool;
+
   private:
     // NOT IMPLEMENTED
     RecoveryManager(const RecoveryManager&);
@@ -863,12 +932,35 @@ class RecoveryManager : public mqbnet::ClusterObserver {
 
     void stopDispatched(int partitionId, bslmt::Latch* latch);
 
+    /// Send the region of the specified `chunkFileType` file of the
+    /// specified `context` between the specified `beginOffset` and
+    /// `endOffset`, in chunks of the specified `chunkSize` aliasing the
+    /// mapped file, keeping at most the specified `maxChunksInFlight` chunks
+    /// written to the channel of the peer and not yet released by it.
+    /// Return 0 on success and a non-zero value otherwise.  Executed by any
+    /// thread.
     int sendFile(RequestContext*                   context,
                  bsls::Types::Uint64               beginOffset,
                  bsls::Types::Uint64               endOffset,
                  unsigned int                      chunkSize,
+                 int                               maxChunksInFlight,
                  bmqp::RecoveryFileChunkType::Enum chunkFileType);
 
+    /// Send the DATA, QLIST and JOURNAL files of the specified `context`,
+    /// between the specified respective begin and end offsets, to the
+    /// requester of `context`.  The specified `contextProctor` keeps
+    /// `context` alive until the transfer is complete.  Executed by the
+    /// file transfer thread pool.
+    void sendPartitionFiles(
+        const bsl::shared_ptr<char>& contextProctor,
+        RequestContext*              context,
+        bsls::Types::Uint64          dataFileBeginOffset,
+        bsls::Types::Uint64          dataFileEndOffset,
+        bsls::Types::Uint64          qlistFileBeginOffset,
+        bsls::Types::Uint64          qlistFileEndOffset,
+        bsls::Types::Uint64          journalFileBeginOffset,
+        bsls::Types::Uint64          journalFileEndOffset);
+
     int replayPartition(
         RequestContext*                              requestContext,
         PrimarySyncContext*                          primarySyncContext,
@@ -1015,6 +1107,14 @@ class RecoveryManager : public mqbnet::ClusterObserver {
     bool isPrimarySyncInProgress(int partitionId) const;
 
     mqbnet::ClusterNode* primarySyncPeer(int partitionId) const;
+
+    /// Load into the specified `out` the progress of the file transfers
+    /// served by this node to the peers requesting a storage sync of the
+    /// specified `partitionId`, or of all partitions if `partitionId` is -1.
+    /// Executed by any thread.
+    void loadPartitionSyncProgress(
+        bsl::vector<mqbcmd::PartitionSyncProgress>* out,
+        int                                         partitionId) const;
 };
 
 // ============================================================================
@@ -1081,6 +1181,11 @@ inline RecoveryManager_FileTransferInfo::RecoveryManager_FileTransferInfo()
 , d_qlistFd()
 , d_areFileMapped(false)
 , d_aliasedChunksCount(0)
+, d_numBytesTotal(0)
+, d_numBytesSent(0)
+, d_startTime(0)
+, d_chunksMutex()
+, d_chunksCondition()
 {
 }
 
@@ -1092,6 +1197,11 @@ inline RecoveryManager_FileTransferInfo::RecoveryManager_FileTransferInfo(
 , d_areFileMapped(other.d_areFileMapped)
 , d_aliasedChunksCount(
       static_cast<bsls::Types::Int64>(other.d_aliasedChunksCount))
+, d_numBytesTotal(static_cast<bsls::Types::Int64>(other.d_numBytesTotal))
+, d_numBytesSent(static_cast<bsls::Types::Int64>(other.d_numBytesSent))
+, d_startTime(static_cast<bsls::Types::Int64>(other.d_startTime))
+, d_chunksMutex()
+, d_chunksCondition()
 {
 }
 
@@ -1107,6 +1217,9 @@ RecoveryManager_FileTransferInfo::operator=(
         d_areFileMapped      = rhs.d_areFileMapped;
         d_aliasedChunksCount = static_cast<bsls::Types::Int64>(
             rhs.d_aliasedChunksCount);
+        d_numBytesTotal = static_cast<bsls::Types::Int64>(rhs.d_numBytesTotal);
+        d_numBytesSent  = static_cast<bsls::Types::Int64>(rhs.d_numBytesSent);
+        d_startTime     = static_cast<bsls::Types::Int64>(rhs.d_startTime);
     }
 
     return *this;
@@ -1139,6 +1252,18 @@ inline void RecoveryManager_FileTransferInfo::setAreFilesMapped(bool value)
     d_areFileMapped = value;
 }
 
+inline void
+RecoveryManager_FileTransferInfo::setNumBytesTotal(bsls::Types::Int64 value)
+{
+    d_numBytesTotal = value;
+}
+
+inline void
+RecoveryManager_FileTransferInfo::setStartTime(bsls::Types::Int64 value)
+{
+    d_startTime = value;
+}
+
 // ACCESSORS
 inline const mqbs::MappedFileDescriptor&
 RecoveryManager_FileTransferInfo::journalFd() const
@@ -1169,6 +1294,23 @@ RecoveryManager_FileTransferInfo::aliasedChunksCount() const
     return d_aliasedChunksCount;
 }
 
+inline bsls::Types::Int64
+RecoveryManager_FileTransferInfo::numBytesTotal() const
+{
+    return d_numBytesTotal;
+}
+
+inline bsls::Types::Int64
+RecoveryManager_FileTransferInfo::numBytesSent() const
+{
+    return d_numBytesSent;
+}
+
+inline bsls::Types::Int64 RecoveryManager_FileTransferInfo::startTime() const
+{
+    return d_startTime;
+}
+
 // -------------------------------------
 // class RecoveryManager_RecoveryContext
 // -------------------------------------
@@ -1788,9 +1930,11 @@ RecoveryManager_RequestContext::fileTransferInfo() const
 
 // CREATORS
 inline RecoveryManager_ChunkDeleter::RecoveryManager_ChunkDeleter(
-    RequestContext* requestContext)
+    RequestContext*    requestContext,
+    bsls::Types::Int64 numBytes)
 : d_requestContext_p(requestContext)
 , d_primarySyncContext_p(0)
+, d_numBytes(numBytes)
 {
 }
 
@@ -1798,6 +1942,7 @@ inline RecoveryManager_ChunkDeleter::RecoveryManager_ChunkDeleter(
     PrimarySyncContext* primarySyncContext)
 : d_requestContext_p(0)
 , d_primarySyncContext_p(primarySyncContext)
+, d_numBytes(0)
 {
 }
 
@@ -0,0 +1,302 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbblp_recoverymanager.h>
+
+// MQB
+#include <mqbcmd_messages.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bdlt_timeunitratio.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef mqbblp::RecoveryManager_FileTransferInfo FileTransferInfo;
+
+/// Channel to the peer of a transfer, releasing the chunks queued to it from
+/// its own thread, in order.
+struct TestChannel {
+    // DATA
+    FileTransferInfo* d_fti_p;
+
+    /// Signaled whenever a chunk is queued.
+    bslmt::Semaphore d_queuedSemaphore;
+
+    /// Size of each chunk.
+    bsls::Types::Int64 d_chunkSize;
+
+    /// Highest number of chunks observed in flight.
+    bsls::AtomicInt d_maxInFlight;
+
+    // CREATORS
+    TestChannel(FileTransferInfo* fti, bsls::Types::Int64 chunkSize)
+    : d_fti_p(fti)
+    , d_queuedSemaphore()
+    , d_chunkSize(chunkSize)
+    , d_maxInFlight(0)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+
+    /// Queue a chunk, already accounted in the file transfer info.
+    void queue()
+    {
+        // Do not count the reference held by the proctor of the transfer.
+        const int inFlight = static_cast<int>(d_fti_p->aliasedChunksCount() -
+                                              1);
+        if (inFlight > d_maxInFlight) {
+            d_maxInFlight = inFlight;
+        }
+
+        d_queuedSemaphore.post();
+    }
+
+    /// Release the specified `numChunks` chunks in order, like a slow peer:
+    /// wait for the specified `window` chunks to be queued before releasing
+    /// the first one, and then release a chunk each time another one is
+    /// queued.
+    void release(int numChunks, int window)
+    {
+        for (int i = 0; i < window; ++i) {
+            d_queuedSemaphore.wait();
+        }
+
+        for (int i = 0; i < numChunks; ++i) {
+            d_fti_p->releaseChunk(d_chunkSize);
+            if (i + window < numChunks) {
+                d_queuedSemaphore.wait();
+            }
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_chunksInFlightWindow()
+// ------------------------------------------------------------------------
+// CHUNKS IN FLIGHT WINDOW
+//
+// Concerns:
+//   a) The reference held by the proctor of the transfer is not counted
+//      as a chunk in flight: the transfer proceeds until exactly
+//      'maxChunksInFlight' chunks are in flight.
+//   b) A transfer waiting for the window is woken up by the release of a
+//      chunk.
+//   c) A transfer waiting for the window gives up once the recovery
+//      manager is stopped.
+//
+// Testing:
+//   RecoveryManager_FileTransferInfo::waitForChunksInFlight
+//   RecoveryManager_FileTransferInfo::releaseChunk
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("CHUNKS IN FLIGHT WINDOW");
+
+    const int        k_MAX_CHUNKS_IN_FLIGHT = 3;
+    FileTransferInfo fti;
+    bsls::AtomicBool isStarted(true);
+
+    // Proctor of the transfer
+    fti.incrementAliasedChunksCount();
+
+    // a) Fill the window
+    for (int i = 0; i < k_MAX_CHUNKS_IN_FLIGHT; ++i) {
+        BMQTST_ASSERT(
+            fti.waitForChunksInFlight(k_MAX_CHUNKS_IN_FLIGHT, isStarted));
+        fti.incrementAliasedChunksCount();
+    }
+    BMQTST_ASSERT_EQ(fti.aliasedChunksCount(), k_MAX_CHUNKS_IN_FLIGHT + 1);
+
+    // b) Released from another thread while waiting
+    bslmt::ThreadUtil::Handle handle;
+    int                       rc = bslmt::ThreadUtil::createWithAllocator(
+        &handle,
+        bdlf::BindUtil::bind(&FileTransferInfo::releaseChunk, &fti, 100),
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(rc, 0);
+
+    BMQTST_ASSERT(
+        fti.waitForChunksInFlight(k_MAX_CHUNKS_IN_FLIGHT, isStarted));
+    bslmt::ThreadUtil::join(handle);
+    BMQTST_ASSERT_EQ(fti.aliasedChunksCount(), k_MAX_CHUNKS_IN_FLIGHT);
+    BMQTST_ASSERT_EQ(fti.numBytesSent(), 100);
+
+    // c) Stopped while waiting
+    fti.incrementAliasedChunksCount();
+    isStarted = false;
+    BMQTST_ASSERT(
+        !fti.waitForChunksInFlight(k_MAX_CHUNKS_IN_FLIGHT, isStarted));
+
+    // Release the chunks, then the proctor
+    for (int i = 0; i < k_MAX_CHUNKS_IN_FLIGHT; ++i) {
+        BMQTST_ASSERT_NE(fti.releaseChunk(100), 0);
+    }
+    BMQTST_ASSERT_EQ(fti.releaseChunk(0), 0);
+}
+
+static void test2_pipelinedTransfer()
+// ------------------------------------------------------------------------
+// PIPELINED TRANSFER
+//
+// Concerns:
+//   a) While the channel to the peer releases chunks concurrently, a
+//      transfer fills the window but never has more than
+//      'maxChunksInFlight' chunks in flight.
+//   b) All the bytes of the released chunks are accounted as sent, and
+//      only the reference of the proctor remains at the end.
+//
+// Testing:
+//   RecoveryManager_FileTransferInfo::waitForChunksInFlight
+//   RecoveryManager_FileTransferInfo::releaseChunk
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PIPELINED TRANSFER");
+
+    const int                k_MAX_CHUNKS_IN_FLIGHT = 4;
+    const int                k_NUM_CHUNKS           = 1000;
+    const bsls::Types::Int64 k_CHUNK_SIZE           = 4096;
+
+    FileTransferInfo fti;
+    bsls::AtomicBool isStarted(true);
+    TestChannel      channel(&fti, k_CHUNK_SIZE);
+
+    fti.setNumBytesTotal(k_NUM_CHUNKS * k_CHUNK_SIZE);
+
+    // Proctor of the transfer
+    fti.incrementAliasedChunksCount();
+
+    bslmt::ThreadUtil::Handle handle;
+    int                       rc = bslmt::ThreadUtil::createWithAllocator(
+        &handle,
+        bdlf::BindUtil::bind(&TestChannel::release,
+                             &channel,
+                             k_NUM_CHUNKS,
+                             k_MAX_CHUNKS_IN_FLIGHT),
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(rc, 0);
+
+    // Send the chunks, as 'RecoveryManager::sendFile' does
+    for (int i = 0; i < k_NUM_CHUNKS; ++i) {
+        BMQTST_ASSERT(
+            fti.waitForChunksInFlight(k_MAX_CHUNKS_IN_FLIGHT, isStarted));
+        fti.incrementAliasedChunksCount();
+        channel.queue();
+    }
+
+    bslmt::ThreadUtil::join(handle);
+
+    // a) Window
+    BMQTST_ASSERT_EQ(channel.d_maxInFlight, k_MAX_CHUNKS_IN_FLIGHT);
+
+    // b) Accounting
+    BMQTST_ASSERT_EQ(fti.numBytesSent(), fti.numBytesTotal());
+    BMQTST_ASSERT_EQ(fti.aliasedChunksCount(), 1);
+    BMQTST_ASSERT_EQ(fti.releaseChunk(0), 0);
+}
+
+static void test3_partitionSyncProgress()
+// ------------------------------------------------------------------------
+// PARTITION SYNC PROGRESS
+//
+// Concerns:
+//   a) The progress of a transfer reports its total bytes, and as sent
+//      only the bytes of the chunks released by the channel to the peer.
+//   b) The elapsed time and the throughput are computed from the start
+//      time of the transfer.
+//   c) No throughput is reported before any time elapsed.
+//
+// Testing:
+//   RecoveryManager_FileTransferInfo::loadProgress
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PARTITION SYNC PROGRESS");
+
+    const bsls::Types::Int64 k_START = 1000 * bdlt::TimeUnitRatio::k_NS_PER_S;
+
+    FileTransferInfo fti;
+    fti.setNumBytesTotal(10000);
+    fti.setStartTime(k_START);
+
+    // Proctor of the transfer, and two chunks of which one is released
+    fti.incrementAliasedChunksCount();
+    fti.incrementAliasedChunksCount();
+    fti.incrementAliasedChunksCount();
+    fti.releaseChunk(2500);
+
+    mqbcmd::PartitionSyncProgress progress(
+        bmqtst::TestHelperUtil::allocator());
+
+    // a) and b) Half a second after the start
+    fti.loadProgress(&progress,
+                     k_START + 500 * bdlt::TimeUnitRatio::k_NS_PER_MS);
+    BMQTST_ASSERT_EQ(progress.totalBytes(), 10000u);
+    BMQTST_ASSERT_EQ(progress.sentBytes(), 2500u);
+    BMQTST_ASSERT_EQ(progress.elapsedTimeMs(), 500u);
+    BMQTST_ASSERT_EQ(progress.throughputBytesPerSec(), 5000u);
+
+    // c) At the start
+    fti.loadProgress(&progress, k_START);
+    BMQTST_ASSERT_EQ(progress.elapsedTimeMs(), 0u);
+    BMQTST_ASSERT_EQ(progress.throughputBytesPerSec(), 0u);
+
+    BMQTST_ASSERT_NE(fti.releaseChunk(7500), 0);
+    BMQTST_ASSERT_EQ(fti.releaseChunk(0), 0);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_partitionSyncProgress(); break;
+    case 2: test2_pipelinedTransfer(); break;
+    case 1: test1_chunksInFlightWindow(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_DEFAULT);
+    // Can't ensure no global memory is allocated because
+    // 'bslmt::ThreadUtil::create()' uses the global allocator to allocate
+    // memory.
+}
@@ -1563,6 +1563,7 @@ int RelayQueueEngine::onConfirmMessage(mqbi::QueueHandle*       handle,
     BSLS_ASSERT_SAFE(app);
 
     app->tryCancelThrottle(handle, msgGUID);
+    app->erasePriorityMessage(msgGUID);
 
     // If proxy, also inform the physical storage.
     if (d_queueState_p->domain()->cluster()->isRemote()) {
@@ -1681,6 +1682,10 @@ void RelayQueueEngine::beforeMessageRemoved(const bmqt::MessageGUID& msgGUID)
             del.advance();
         }
     }
+
+    for (AppsMap::iterator it = d_apps.begin(); it != d_apps.end(); ++it) {
+        it->second->erasePriorityMessage(msgGUID);
+    }
 }
 
 void RelayQueueEngine::afterQueuePurged(const bsl::string&      appId,
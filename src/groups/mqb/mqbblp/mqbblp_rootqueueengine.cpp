@@ -495,6 +495,8 @@ int RootQueueEngine::configure(bsl::ostream& errorDescription,
         d_consumptionMonitor.setMaxIdleTime(domainCfg->maxIdleTime());
     }
 
+    d_appsDeliveryContext.setPriorityProperty(domainCfg->priorityProperty());
+
     return rc_SUCCESS;
 }
 
@@ -1476,9 +1478,20 @@ void RootQueueEngine::afterNewMessage()
                     app->appId());
             }
         }
-        const unsigned int numHits =
+        unsigned int numHits =
             d_queueState_p->routingContext().d_preader->numHits();
 
+        if (numHits) {
+            // The properties reader counts the subscription operations of all
+            // Apps for the message.  Charge the flow control with those of
+            // one App, as when each App read the properties on its own, so
+            // that a fanout queue is not throttled as many times sooner as it
+            // has Apps.
+            const unsigned int numApps = static_cast<unsigned int>(
+                d_apps.size());
+            numHits = (numHits + numApps - 1) / numApps;
+        }
+
         if (!d_appsDeliveryContext.isEmpty()) {
             --numMessages;
             // Report 'queue time' metric for the entire queue
@@ -1577,6 +1590,7 @@ int RootQueueEngine::onConfirmMessage(mqbi::QueueHandle*       handle,
         bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()));
 
     app.tryCancelThrottle(handle, msgGUID);
+    app.erasePriorityMessage(msgGUID);
 
     if (rc == mqbi::StorageResult::e_NON_ZERO_REFERENCES) {
         return rc_NON_ZERO_REFERENCES;  // RETURN
@@ -1766,6 +1780,10 @@ void RootQueueEngine::beforeMessageRemoved(const bmqt::MessageGUID& msgGUID)
     if (!d_storageIter_mp->atEnd() && d_storageIter_mp->guid() == msgGUID) {
         d_storageIter_mp->advance();
     }
+
+    for (Apps::iterator it = d_apps.begin(); it != d_apps.end(); ++it) {
+        it->second->erasePriorityMessage(msgGUID);
+    }
 }
 
 void RootQueueEngine::afterQueuePurged(const bsl::string&      appId,
@@ -2325,6 +2343,19 @@ unsigned int RootQueueEngine::messageReferenceCount() const
     return refCount - numNegative;
 }
 
+size_t RootQueueEngine::numPriorityMessages(const bsl::string& appId) const
+{
+    // executed by the *QUEUE DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_queueState_p->queue()->inDispatcherThread());
+
+    Apps::const_iterator cit = d_apps.find(appId);
+    BSLS_ASSERT_SAFE(cit != d_apps.end());
+
+    return cit->second->numPriorityMessages();
+}
+
 void RootQueueEngine::loadInternals(mqbcmd::QueueEngine* out) const
 {
     // executed by the *QUEUE DISPATCHER* thread
@@ -452,6 +452,17 @@ class RootQueueEngine BSLS_KEYWORD_FINAL : public mqbi::QueueEngine {
                                          const bsl::string& appId) const
         BSLS_KEYWORD_OVERRIDE;
 
+    // ACCESSORS
+
+    /// Return the number of messages which the App with the specified
+    /// `appId` put in its priority lanes and which are still tracked, i.e.,
+    /// neither reached in the data stream, nor confirmed by the App, nor
+    /// removed from the storage.  The behavior is undefined unless `appId`
+    /// is registered.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    size_t numPriorityMessages(const bsl::string& appId) const;
+
   private:
     /// Log application subscription info for the specified `appState` into
     /// the specified `stream`.
@@ -25,7 +25,9 @@
 
 // BMQ
 #include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_messageproperties.h>
 #include <bmqp_protocol.h>
+#include <bmqp_protocolutil.h>
 #include <bmqp_routingconfigurationutils.h>
 
 // BDE
@@ -38,9 +40,12 @@
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
 #include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 #include <bmqtst_scopedlogobserver.h>
 #include <bmqu_memoutstream.h>
+#include <bmqu_printutil.h>
 #include <bmqu_time.h>
 
 // TEST DRIVER
@@ -635,6 +640,23 @@ mqbconfm::Domain priorityDomainConfig()
     return domainConfig;
 }
 
+/// Return the configuration of a priority domain reading the priority of
+/// each message from the `priority` property.
+mqbconfm::Domain priorityLanesDomainConfig()
+{
+    mqbconfm::Domain domainConfig   = priorityDomainConfig();
+    domainConfig.priorityProperty() = "priority";
+    return domainConfig;
+}
+
+/// Return message properties carrying the specified `priority`.
+bmqp::MessageProperties priorityProperties(int priority)
+{
+    bmqp::MessageProperties properties(bmqtst::TestHelperUtil::allocator());
+    properties.setPropertyAsInt32("priority", priority);
+    return properties;
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -5115,6 +5137,461 @@ static void test49_closeWithScheduledAlarm()
     //   BSLS_ASSERT_SAFE(!d_alarmEventHandle)
 }
 
+// ----------------------------------------------------------------------------
+//                            PRIORITY LANES TESTS
+// ----------------------------------------------------------------------------
+
+static void test50_priorityLanesOrder()
+// ------------------------------------------------------------------------
+// PRIORITY LANES ORDER
+//
+// Concerns:
+//   a) Once a consumer falls behind, messages carrying the priority
+//      property overtake the backlog, highest lane first and in arrival
+//      order within a lane.
+//   b) A priority above the number of lanes is clamped to the highest
+//      lane.
+//   c) The backlog is then delivered in order, without the messages
+//      already delivered out of a lane.
+//
+// Plan:
+//   1) Configure a priority queue with a priority property, and deliver a
+//      message to a consumer.
+//   2) Block the consumer, and post messages with and without priority.
+//   3) Unblock the consumer and verify the order of delivery.
+//
+// Testing:
+//   QueueEngineUtil_AppState::processPriorityLanes
+//   QueueEngineUtil_AppState::catchUp
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PRIORITY LANES ORDER");
+
+    mqbblp::QueueEngineTester tester(priorityLanesDomainConfig(),
+                                     false,  // start scheduler
+                                     bmqtst::TestHelperUtil::allocator());
+
+    mqbblp::QueueEngineTesterGuard<mqbblp::RootQueueEngine> guard(&tester);
+
+    // 1) Deliver a message to a consumer
+    mqbmock::QueueHandle* C1 = tester.getHandle("C1 readCount=1");
+    tester.configureHandle("C1 consumerPriority=1 consumerPriorityCount=1");
+
+    tester.post("a");
+    tester.afterNewMessage(0);
+
+    BMQTST_ASSERT_EQ(C1->_messages(), "a");
+
+    // 2) Block the consumer, and post messages with and without priority.
+    //    'b' becomes the resume point of the consumer.
+    C1->_setCanDeliver(false);
+
+    tester.post("b");
+    tester.post("c", priorityProperties(1));
+    tester.post("d", priorityProperties(3));
+    tester.post("e", priorityProperties(2));
+    tester.post("f");
+    tester.post("g", priorityProperties(5));
+    tester.afterNewMessage(0);
+
+    BMQTST_ASSERT_EQ(C1->_messages(), "a");
+
+    // 3) Unblock the consumer and verify the order of delivery
+    tester.confirm("C1", "a");
+    C1->_setCanDeliver(true);
+
+    BMQTST_ASSERT_EQ(C1->_messages(), "d,g,e,c,b,f");
+}
+
+static void test51_priorityLanesStarvationBound()
+// ------------------------------------------------------------------------
+// PRIORITY LANES STARVATION BOUND
+//
+// Concerns:
+//   While a consumer is behind, at most 'k_MAX_PRIORITY_DELIVERIES' (16)
+//   messages are delivered out of the lanes before the backlog makes
+//   progress.
+//
+// Plan:
+//   1) Deliver a message to a consumer, and block the consumer.
+//   2) Post a message without priority, followed by more priority
+//      messages than the bound.
+//   3) Unblock the consumer, and verify that the message without priority
+//      is delivered right after the first 16 priority messages, and the
+//      remaining priority messages after it, in order.
+//
+// Testing:
+//   QueueEngineUtil_AppState::processPriorityLanes
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PRIORITY LANES STARVATION BOUND");
+
+    const int k_MAX_PRIORITY_DELIVERIES = 16;
+    const int k_NUM_PRIORITY_MESSAGES   = k_MAX_PRIORITY_DELIVERIES + 4;
+
+    mqbblp::QueueEngineTester tester(priorityLanesDomainConfig(),
+                                     false,  // start scheduler
+                                     bmqtst::TestHelperUtil::allocator());
+
+    mqbblp::QueueEngineTesterGuard<mqbblp::RootQueueEngine> guard(&tester);
+
+    // 1) Deliver a message to a consumer, and block the consumer
+    mqbmock::QueueHandle* C1 = tester.getHandle("C1 readCount=1");
+    tester.configureHandle("C1 consumerPriority=1 consumerPriorityCount=1");
+
+    tester.post("a");
+    tester.afterNewMessage(0);
+
+    BMQTST_ASSERT_EQ(C1->_messages(), "a");
+
+    C1->_setCanDeliver(false);
+
+    // 2) Post a message without priority, followed by more priority messages
+    //    than the bound
+    tester.post("b");
+
+    bmqu::MemOutStream expected(bmqtst::TestHelperUtil::allocator());
+    for (int i = 1; i <= k_NUM_PRIORITY_MESSAGES; ++i) {
+        bmqu::MemOutStream name(bmqtst::TestHelperUtil::allocator());
+        name << "p" << i;
+        tester.post(name.str(), priorityProperties(1));
+
+        if (i > 1) {
+            expected << ",";
+        }
+        expected << name.str();
+        if (i == k_MAX_PRIORITY_DELIVERIES) {
+            // The backlog makes progress once the budget is exhausted.
+            expected << ",b";
+        }
+    }
+    tester.afterNewMessage(0);
+
+    // 3) Unblock the consumer, and verify the order of delivery
+    tester.confirm("C1", "a");
+    C1->_setCanDeliver(true);
+
+    BMQTST_ASSERT_EQ(C1->_messages(), expected.str());
+    BMQTST_ASSERT_EQ(C1->_numMessages(), k_NUM_PRIORITY_MESSAGES + 1);
+}
+
+static void test52_priorityLanesCatchUpSkipsDelivered()
+// ------------------------------------------------------------------------
+// PRIORITY LANES CATCH UP SKIPS DELIVERED
+//
+// Concerns:
+//   a) When catching up with the backlog, a consumer skips the messages
+//      already delivered out of a lane, even once they are confirmed.
+//   b) Once caught up, the lanes are empty and subsequent messages are
+//      delivered in order.
+//
+// Plan:
+//   1) Deliver a message to a consumer, and block the consumer.
+//   2) Post messages without priority interleaved with priority messages.
+//   3) Unblock the consumer, and verify that each message is delivered
+//      exactly once.
+//   4) Confirm all messages, block the consumer again, and post another
+//      round of messages.  Verify that the confirmed messages are not
+//      delivered again.
+//
+// Testing:
+//   QueueEngineUtil_AppState::catchUp
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName(
+        "PRIORITY LANES CATCH UP SKIPS DELIVERED");
+
+    mqbblp::QueueEngineTester tester(priorityLanesDomainConfig(),
+                                     false,  // start scheduler
+                                     bmqtst::TestHelperUtil::allocator());
+
+    mqbblp::QueueEngineTesterGuard<mqbblp::RootQueueEngine> guard(&tester);
+
+    // 1) Deliver a message to a consumer, and block the consumer
+    mqbmock::QueueHandle* C1 = tester.getHandle("C1 readCount=1");
+    tester.configureHandle("C1 consumerPriority=1 consumerPriorityCount=1");
+
+    tester.post("a");
+    tester.afterNewMessage(0);
+
+    BMQTST_ASSERT_EQ(C1->_messages(), "a");
+
+    C1->_setCanDeliver(false);
+
+    // 2) Post messages without priority interleaved with priority messages
+    tester.post("b");
+    tester.post("x1", priorityProperties(1));
+    tester.post("c");
+    tester.post("x2", priorityProperties(1));
+    tester.post("d");
+    tester.afterNewMessage(0);
+
+    // 3) Unblock the consumer, and verify that each message is delivered
+    //    exactly once
+    tester.confirm("C1", "a");
+    C1->_setCanDeliver(true);
+
+    BMQTST_ASSERT_EQ(C1->_messages(), "x1,x2,b,c,d");
+    BMQTST_ASSERT_EQ(C1->_numMessages(), 5);
+
+    // 4) Confirm all messages, block the consumer again, and post another
+    //    round of messages
+    tester.confirm("C1", "x1,x2,b,c,d");
+    BMQTST_ASSERT_EQ(C1->_numMessages(), 0);
+
+    tester.post("e");
+    tester.afterNewMessage(0);
+
+    BMQTST_ASSERT_EQ(C1->_messages(), "e");
+
+    C1->_setCanDeliver(false);
+
+    tester.post("f");
+    tester.post("y1", priorityProperties(2));
+    tester.post("g");
+    tester.afterNewMessage(0);
+
+    tester.confirm("C1", "e");
+    C1->_setCanDeliver(true);
+
+    BMQTST_ASSERT_EQ(C1->_messages(), "y1,f,g");
+    BMQTST_ASSERT_EQ(C1->_numMessages(), 3);
+}
+
+static void test54_priorityLanesForgetConfirmed()
+// ------------------------------------------------------------------------
+// PRIORITY LANES FORGET CONFIRMED
+//
+// Concerns:
+//   a) An App which stays behind the data stream does not keep track of
+//      the priority messages once they are confirmed.
+//   b) Confirmed priority messages are not delivered once the App catches
+//      up.
+//
+// Plan:
+//   1) Deliver a message to a consumer, and block the consumer.
+//   2) Post messages without priority followed by priority messages, and
+//      verify that the App tracks the priority messages.
+//   3) Confirm the priority messages while the consumer is still blocked,
+//      and verify that the App no longer tracks them.
+//   4) Unblock the consumer, and verify that only the message without
+//      priority is delivered.
+//
+// Testing:
+//   QueueEngineUtil_AppState::erasePriorityMessage
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PRIORITY LANES FORGET CONFIRMED");
+
+    mqbblp::QueueEngineTester tester(priorityLanesDomainConfig(),
+                                     false,  // start scheduler
+                                     bmqtst::TestHelperUtil::allocator());
+
+    mqbblp::QueueEngineTesterGuard<mqbblp::RootQueueEngine> guard(&tester);
+
+    const bsl::string& appId = bmqp::ProtocolUtil::k_DEFAULT_APP_ID;
+
+    // 1) Deliver a message to a consumer, and block the consumer
+    mqbmock::QueueHandle* C1 = tester.getHandle("C1 readCount=1");
+    tester.configureHandle("C1 consumerPriority=1 consumerPriorityCount=1");
+
+    tester.post("a");
+    tester.afterNewMessage(0);
+
+    BMQTST_ASSERT_EQ(C1->_messages(), "a");
+
+    C1->_setCanDeliver(false);
+
+    // 2) Post messages without priority followed by priority messages
+    tester.post("b");
+    tester.post("x1", priorityProperties(1));
+    tester.post("x2", priorityProperties(1));
+    tester.afterNewMessage(0);
+
+    BMQTST_ASSERT_EQ(guard.engine()->numPriorityMessages(appId), 2U);
+
+    // 3) Confirm the priority messages while the consumer is still blocked
+    tester.confirm("C1", "x1,x2");
+
+    BMQTST_ASSERT_EQ(guard.engine()->numPriorityMessages(appId), 0U);
+
+    // 4) Unblock the consumer, and verify that only the message without
+    //    priority is delivered
+    tester.confirm("C1", "a");
+    C1->_setCanDeliver(true);
+
+    BMQTST_ASSERT_EQ(C1->_messages(), "b");
+    BMQTST_ASSERT_EQ(C1->_numMessages(), 1);
+    BMQTST_ASSERT_EQ(guard.engine()->numPriorityMessages(appId), 0U);
+}
+
+// ----------------------------------------------------------------------------
+//                             FLOW CONTROL TESTS
+// ----------------------------------------------------------------------------
+
+static void test53_flowControlFanoutCost()
+// ------------------------------------------------------------------------
+// FLOW CONTROL FANOUT COST
+//
+// Concerns:
+//   The flow control of a fanout queue charges each message with the
+//   subscription operations of one App, regardless of the number of Apps
+//   evaluating their subscriptions against its properties.  Otherwise the
+//   bucket fills up as many times sooner as there are Apps, and the
+//   increments of the rate once the load drops are worth as many times
+//   fewer messages.
+//
+// Plan:
+//   1) Configure a fanout queue with several Apps, each with a consumer
+//      whose subscription reads a message property.
+//   2) Report a loaded dispatcher and deliver messages.  Verify that the
+//      flow control starts limiting after the first batch of messages.
+//   3) Report an idle dispatcher and deliver again.  Verify that the rate
+//      increment allows at least as many messages as it adds subscription
+//      operations.
+//
+// Testing:
+//   RootQueueEngine::afterNewMessage
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("FLOW CONTROL FANOUT COST");
+
+    // Constants of the flow control of 'RootQueueEngine'
+    const int k_LOW_WATERMARK = 10;
+    const int k_BATCH         = 100;
+    const int k_RATE_INCREASE = 100;
+
+    const int k_NUM_APPS     = 10;
+    const int k_NUM_MESSAGES = 3 * k_BATCH;
+
+    bmqu::MemOutStream appIds(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_APPS; ++i) {
+        appIds << (i ? "," : "") << "app" << i;
+    }
+
+    mqbblp::QueueEngineTester tester(fanoutConfig(appIds.str()),
+                                     false,  // start scheduler
+                                     bmqtst::TestHelperUtil::allocator());
+
+    mqbblp::QueueEngineTesterGuard<mqbblp::RootQueueEngine> guard(&tester);
+
+    // 1) One consumer per App, with a subscription reading a property
+    bsl::vector<mqbmock::QueueHandle*> handles(
+        bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_APPS; ++i) {
+        bmqu::MemOutStream handle(bmqtst::TestHelperUtil::allocator());
+        handle << "C" << i << "@app" << i;
+
+        handles.push_back(tester.getHandle(handle.str() + " readCount=1"));
+        tester.configureHandle(handle.str() +
+                               " consumerPriority=1 consumerPriorityCount=1"
+                               " expression=priority>0");
+    }
+
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        bmqu::MemOutStream name(bmqtst::TestHelperUtil::allocator());
+        name << "m" << i;
+        tester.post(name.str(), priorityProperties(1));
+    }
+
+    // 2) Loaded dispatcher.  The flow control starts limiting once the first
+    //    batch is delivered, with a burst of 75% of the average rate of the
+    //    last 4 seconds, that is 'k_BATCH * 1000 / 4001 * 3 / 4' operations.
+    tester.dispatcher()->_setNumProcessorEvents(k_LOW_WATERMARK + 2);
+    tester.afterNewMessage(1);
+
+    const int k_BURST = k_BATCH * 1000 / 4001 * 3 / 4;
+
+    for (int i = 0; i < k_NUM_APPS; ++i) {
+        bmqu::MemOutStream appId(bmqtst::TestHelperUtil::allocator());
+        appId << "app" << i;
+        BMQTST_ASSERT_EQ_D(i,
+                           handles[i]->_numMessages(appId.str()),
+                           k_BATCH + k_BURST + 1);
+    }
+
+    // 3) Idle dispatcher.  The flow control increases its rate and burst,
+    //    which allows at least 'k_RATE_INCREASE' more messages.
+    tester.dispatcher()->_setNumProcessorEvents(0);
+    tester.afterNewMessage(1);
+
+    for (int i = 0; i < k_NUM_APPS; ++i) {
+        bmqu::MemOutStream appId(bmqtst::TestHelperUtil::allocator());
+        appId << "app" << i;
+        BMQTST_ASSERT_GE_D(i,
+                           handles[i]->_numMessages(appId.str()),
+                           k_BATCH + k_BURST + 1 + k_RATE_INCREASE);
+    }
+}
+
+static void testN4_priorityLanesFifoPerformance()
+// ------------------------------------------------------------------------
+// PRIORITY LANES FIFO PERFORMANCE
+//
+// Concerns:
+//   Configuring a priority property does not slow down the delivery of a
+//   backlog of messages without priority.
+//
+// Plan:
+//   For a queue without and then with a priority property, time posting
+//   a backlog of messages without priority to a blocked consumer, and then
+//   delivering the backlog once the consumer is unblocked.
+//
+// Testing:
+//   Performance of the FIFO delivery with priority lanes configured.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PRIORITY LANES FIFO PERFORMANCE");
+
+    const int k_NUM_MESSAGES = 100000;
+
+    for (int withLanes = 0; withLanes < 2; ++withLanes) {
+        mqbblp::QueueEngineTester tester(withLanes
+                                             ? priorityLanesDomainConfig()
+                                             : priorityDomainConfig(),
+                                         false,  // start scheduler
+                                         bmqtst::TestHelperUtil::allocator());
+
+        mqbblp::QueueEngineTesterGuard<mqbblp::RootQueueEngine> guard(
+            &tester);
+
+        mqbmock::QueueHandle* C1 = tester.getHandle("C1 readCount=1");
+        tester.configureHandle(
+            "C1 consumerPriority=1 consumerPriorityCount=1");
+
+        C1->_setCanDeliver(false);
+
+        for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+            bmqu::MemOutStream name(bmqtst::TestHelperUtil::allocator());
+            name << i;
+            tester.post(name.str());
+        }
+
+        const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+
+        tester.afterNewMessage(0);
+
+        const bsls::Types::Int64 posted = bsls::TimeUtil::getTimer();
+
+        C1->_setCanDeliver(true);
+
+        const bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+        BMQTST_ASSERT_EQ(C1->_numMessages(), k_NUM_MESSAGES);
+
+        cout << (withLanes ? "With" : "Without") << " priority lanes:\n"
+             << "  Processed " << k_NUM_MESSAGES << " new messages in "
+             << bmqu::PrintUtil::prettyTimeInterval(posted - start)
+             << ".\n"
+             << "  Delivered the backlog in "
+             << bmqu::PrintUtil::prettyTimeInterval(end - posted) << ", "
+             << bmqu::PrintUtil::prettyNumber(
+                    static_cast<bsls::Types::Int64>(k_NUM_MESSAGES) *
+                    1000000000 / (end - posted))
+             << " messages per second." << endl;
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -5136,6 +5613,11 @@ int main(int argc, char* argv[])
 
         switch (_testCase) {
         case 0:
+        case 54: test54_priorityLanesForgetConfirmed(); break;
+        case 53: test53_flowControlFanoutCost(); break;
+        case 52: test52_priorityLanesCatchUpSkipsDelivered(); break;
+        case 51: test51_priorityLanesStarvationBound(); break;
+        case 50: test50_priorityLanesOrder(); break;
         case 49: test49_closeWithScheduledAlarm(); break;
         case 48: test48_unknownReject(); break;
         case 47: test47_handleParametersLimits(); break;
@@ -5194,6 +5676,7 @@ int main(int argc, char* argv[])
         case -1: testN1_broadcastExhaustiveSubscriptions(); break;
         case -2: testN2_broadcastExhaustiveCanDeliver(); break;
         case -3: testN3_broadcastExhaustiveConsumerPriority(); break;
+        case -4: testN4_priorityLanesFifoPerformance(); break;
         default: {
             cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
             bmqtst::TestHelperUtil::testStatus() = -1;
@@ -42,20 +42,31 @@ namespace mqbblp {
 
 namespace {
 
-/// VST to control the scope of Resolver
+/// VST to control the scope of Resolver.  If the reader is already prepared
+/// for the message (by the caller delivering the message to all Apps), leave
+/// it to the caller to release, so the properties are read once for all Apps.
 class ScopeExit {
     mqbblp::Routers::QueueRoutingContext* d_queue_p;
+    bool                                  d_isOwner;
 
   public:
     // CREATORS
     ScopeExit(mqbblp::Routers::QueueRoutingContext* queue,
               const mqbi::StorageIterator*          currentMessage)
     : d_queue_p(queue)
+    , d_isOwner(!queue->d_preader->isCurrent(currentMessage))
     {
-        d_queue_p->d_preader->next(currentMessage);
+        if (d_isOwner) {
+            d_queue_p->d_preader->next(currentMessage);
+        }
     }
 
-    ~ScopeExit() { d_queue_p->d_preader->next(0); }
+    ~ScopeExit()
+    {
+        if (d_isOwner) {
+            d_queue_p->d_preader->next(0);
+        }
+    }
 
   private:
     // NOT IMPLEMENTED
@@ -186,6 +197,12 @@ unsigned int Routers::MessagePropertiesReader::numHits() const
     return d_numHits;
 }
 
+bool Routers::MessagePropertiesReader::isCurrent(
+    const mqbi::StorageIterator* currentMessage) const
+{
+    return currentMessage && currentMessage == d_currentMessage_p;
+}
+
 // ==========================
 // struct Routers::Expression
 // ==========================
@@ -598,6 +598,10 @@ class Routers {
         void clear();
 
         unsigned int numHits() const;
+
+        /// Return `true` if this reader is prepared for the specified
+        /// `currentMessage`.
+        bool isCurrent(const mqbi::StorageIterator* currentMessage) const;
     };
 
     /// Mechanism to assist `Expression`s evaluation optimization to avoid
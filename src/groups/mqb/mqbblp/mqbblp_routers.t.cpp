@@ -536,6 +536,56 @@ static void test4_generate()
     }
 }
 
+static void test5_propertiesReaderScope()
+// ------------------------------------------------------------------------
+// Testing mqbblp::Routers::AppContext::iterateConsumers use of the
+// message properties reader
+//
+//  1. Without the reader prepared for the message by the caller, the
+//     evaluation prepares and releases the reader.
+//  2. With the reader prepared for the message by the caller (delivering
+//     the message to all Apps), the evaluation of each App keeps the
+//     reader, so the properties are read once per message.
+// ------------------------------------------------------------------------
+{
+    bmqp::SchemaLearner schemaLearner(bmqtst::TestHelperUtil::allocator());
+    mqbblp::Routers::QueueRoutingContext queueContext(
+        schemaLearner,
+        bmqtst::TestHelperUtil::allocator());
+    TestStorage storage(13, bmqtst::TestHelperUtil::allocator());
+    mqbblp::Routers::AppContext appContext1(
+        &queueContext,
+        bmqtst::TestHelperUtil::allocator());
+    mqbblp::Routers::AppContext appContext2(
+        &queueContext,
+        bmqtst::TestHelperUtil::allocator());
+
+    mqbblp::Routers::MessagePropertiesReader& reader = *queueContext.d_preader;
+
+    const mqbi::StorageIterator* message = storage.d_iterator.get();
+    Visitor                      visitor;
+
+    BMQTST_ASSERT(!reader.isCurrent(message));
+    BMQTST_ASSERT(!reader.isCurrent(0));
+
+    // 1. The evaluation owns the reader
+    appContext1.iterateConsumers(visitor, message);
+    BMQTST_ASSERT(!reader.isCurrent(message));
+
+    // 2. The caller owns the reader
+    reader.next(message);
+    BMQTST_ASSERT(reader.isCurrent(message));
+
+    appContext1.iterateConsumers(visitor, message);
+    BMQTST_ASSERT(reader.isCurrent(message));
+
+    appContext2.iterateConsumers(visitor, message);
+    BMQTST_ASSERT(reader.isCurrent(message));
+
+    reader.next(0);
+    BMQTST_ASSERT(!reader.isCurrent(message));
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -553,6 +603,7 @@ int main(int argc, char* argv[])
     case 2: test2_priority(); break;
     case 3: test3_parse(); break;
     case 4: test4_generate(); break;
+    case 5: test5_propertiesReaderScope(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
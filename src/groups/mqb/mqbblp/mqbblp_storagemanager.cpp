@@ -2043,6 +2043,18 @@ void StorageManager::processCommand(mqbcmd::StorageResult*        result,
         command,
         d_clusterConfig.partitionConfig().location(),
         d_allocator_p);
+
+    if (result->isClusterStorageSummaryValue()) {
+        // Report the progress of the partition files being sent by this node
+        // to the peers synchronizing their storage.
+
+        const int partitionId = command.isPartitionValue()
+                                    ? command.partition().partitionId()
+                                    : -1;
+        d_recoveryManager_mp->loadPartitionSyncProgress(
+            &result->clusterStorageSummary().partitionSyncs(),
+            partitionId);
+    }
 }
 
 void StorageManager::gcUnrecognizedDomainQueues()
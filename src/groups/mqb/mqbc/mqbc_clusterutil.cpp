@@ -532,8 +532,9 @@ void ClusterUtil::assignPartitions(
     BSLS_ASSERT_SAFE(partitions->size() == clusterState->partitions().size());
 }
 
-int ClusterUtil::getNextPartitionId(const ClusterState& clusterState,
-                                    const bmqt::Uri&    uri)
+int ClusterUtil::getNextPartitionId(const ClusterState&     clusterState,
+                                    const bmqt::Uri&        uri,
+                                    const bsl::vector<int>* numPendingQueues)
 {
     // Try to assign to the partition which has a primary and the least number
     // of queues assigned.  If no partitions have a primary, then assign to the
@@ -563,15 +564,27 @@ int ClusterUtil::getNextPartitionId(const ClusterState& clusterState,
         }
     }
 
+    BSLS_ASSERT_SAFE(!numPendingQueues ||
+                     numPendingQueues->size() ==
+                         clusterState.partitions().size());
+
+    // Number of queues mapped to each partition, including the pending ones.
+    bsl::vector<int> numQueues(clusterState.partitions().size(), 0);
+    for (size_t i = 0; i < clusterState.partitions().size(); ++i) {
+        numQueues[i] = clusterState.partitions()[i].numQueuesMapped();
+        if (numPendingQueues) {
+            numQueues[i] += (*numPendingQueues)[i];
+        }
+    }
+
     int minQueuesMapped = bsl::numeric_limits<int>::max();
     int res             = -1;
 
     for (size_t i = 0; i < clusterState.partitions().size(); ++i) {
         const mqbc::ClusterStatePartitionInfo& partitionInfo =
             clusterState.partitions()[i];
-        if (partitionInfo.primaryNode() &&
-            partitionInfo.numQueuesMapped() < minQueuesMapped) {
-            minQueuesMapped = partitionInfo.numQueuesMapped();
+        if (partitionInfo.primaryNode() && numQueues[i] < minQueuesMapped) {
+            minQueuesMapped = numQueues[i];
             res             = i;
         }
     }
@@ -581,8 +594,7 @@ int ClusterUtil::getNextPartitionId(const ClusterState& clusterState,
         // simply look for the least used partition.
         res = 0;
         for (size_t i = 1; i < clusterState.partitions().size(); ++i) {
-            if (clusterState.partitions()[i].numQueuesMapped() <
-                clusterState.partitions()[res].numQueuesMapped()) {
+            if (numQueues[i] < numQueues[res]) {
                 res = i;
             }
         }
@@ -686,12 +698,11 @@ void ClusterUtil::onPartitionPrimaryAssignment(
 }
 
 void ClusterUtil::processQueueAssignmentRequest(
-    ClusterState*                       clusterState,
     ClusterData*                        clusterData,
-    ClusterStateLedger*                 ledger,
     const mqbi::Cluster*                cluster,
     const bmqp_ctrlmsg::ControlMessage& request,
     mqbnet::ClusterNode*                requester,
+    const AssignQueueFn&                assignQueueFn,
     bslma::Allocator*                   allocator)
 {
     // executed by the cluster *DISPATCHER* thread
@@ -699,9 +710,8 @@ void ClusterUtil::processQueueAssignmentRequest(
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(cluster->inDispatcherThread());
     BSLS_ASSERT_SAFE(!cluster->isRemote());
-    BSLS_ASSERT_SAFE(clusterState);
     BSLS_ASSERT_SAFE(clusterData);
-    BSLS_ASSERT_SAFE(ledger && ledger->isOpen());
+    BSLS_ASSERT_SAFE(assignQueueFn);
     BSLS_ASSERT_SAFE(request.choice().isClusterMessageValue());
     BSLS_ASSERT_SAFE(request.choice()
                          .clusterMessage()
@@ -766,13 +776,7 @@ void ClusterUtil::processQueueAssignmentRequest(
     status.code()                = 0;
     status.message()             = "";
 
-    assignQueue(clusterState,
-                clusterData,
-                ledger,
-                cluster,
-                uri,
-                allocator,
-                &status);
+    assignQueueFn(uri, &status);
 
     clusterData->messageTransmitter().sendMessage(response, requester);
 }
@@ -850,27 +854,32 @@ void ClusterUtil::populateQueueUnAssignmentAdvisory(
                   << ": Populated QueueUnAssignmentAdvisory: " << *advisory;
 }
 
-bool ClusterUtil::assignQueue(ClusterState*         clusterState,
-                              ClusterData*          clusterData,
-                              ClusterStateLedger*   ledger,
-                              const mqbi::Cluster*  cluster,
-                              const bmqt::Uri&      uri,
-                              bslma::Allocator*     allocator,
-                              bmqp_ctrlmsg::Status* status)
+bool ClusterUtil::prepareQueueAssignment(
+    bmqp_ctrlmsg::QueueAssignmentAdvisory* advisory,
+    bool*                                  isAppended,
+    ClusterState*                          clusterState,
+    ClusterData*                           clusterData,
+    const mqbi::Cluster*                   cluster,
+    const bmqt::Uri&                       uri,
+    bslma::Allocator*                      allocator,
+    bmqp_ctrlmsg::Status*                  status)
 {
     // executed by the cluster *DISPATCHER* thread
 
     // PRECONDITIONS
+    BSLS_ASSERT_SAFE(advisory);
+    BSLS_ASSERT_SAFE(isAppended);
     BSLS_ASSERT_SAFE(cluster->inDispatcherThread());
     BSLS_ASSERT_SAFE(!cluster->isRemote());
     BSLS_ASSERT_SAFE(clusterState);
     BSLS_ASSERT_SAFE(clusterData);
     BSLS_ASSERT_SAFE(clusterData->electorInfo().isSelfActiveLeader());
-    BSLS_ASSERT_SAFE(ledger && ledger->isOpen());
     BSLS_ASSERT_SAFE(uri.isCanonical());
     BSLS_ASSERT_SAFE(allocator);
     BSLS_ASSERT_SAFE(status);
 
+    *isAppended = false;
+
     // We are the leader and received a request to assign a queue URI with a
     // partitionId and queueKey.  Note that we don't check the status of a
     // partition's primary (active vs passive) while assigning a queue to it.
@@ -1039,6 +1048,56 @@ bool ClusterUtil::assignQueue(ClusterState*         clusterState,
                   << ClusterStateQueueInfo::State::k_ASSIGNING << " for ["
                   << uri << "].";
 
+    // Account for the queues already pending in 'advisory' so that a batch
+    // of assignments is balanced across partitions.
+    bsl::vector<int> numPendingQueues(clusterState->partitions().size(),
+                                      0,
+                                      allocator);
+    for (size_t i = 0; i < advisory->queues().size(); ++i) {
+        const int partitionId = advisory->queues()[i].partitionId();
+        BSLS_ASSERT_SAFE(0 <= partitionId &&
+                         partitionId < static_cast<int>(
+                                           numPendingQueues.size()));
+        ++numPendingQueues[partitionId];
+    }
+
+    // Append to 'queueAssignmentAdvisory'.  Note that the generated key stays
+    // in 'ClusterState::queueKeys' until the advisory is applied, so that the
+    // queues of the same advisory are assigned distinct keys.
+    advisory->queues().resize(advisory->queues().size() + 1);
+
+    bmqp_ctrlmsg::QueueInfo& queueInfo = advisory->queues().back();
+    queueInfo.uri()                    = uri.asString();
+    queueInfo.partitionId() =
+        getNextPartitionId(*clusterState, uri, &numPendingQueues);
+
+    mqbu::StorageKey key;
+    mqbs::StorageUtil::generateStorageKey(&key,
+                                          &clusterState->queueKeys(),
+                                          uri.asString());
+    key.loadBinary(&queueInfo.key());
+
+    // Generate appIds and appKeys
+    populateAppInfos(&queueInfo.appIds(), domainCfg->mode());
+
+    *isAppended = true;
+    return true;
+}
+
+bool ClusterUtil::assignQueue(ClusterState*         clusterState,
+                              ClusterData*          clusterData,
+                              ClusterStateLedger*   ledger,
+                              const mqbi::Cluster*  cluster,
+                              const bmqt::Uri&      uri,
+                              bslma::Allocator*     allocator,
+                              bmqp_ctrlmsg::Status* status)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cluster->inDispatcherThread());
+    BSLS_ASSERT_SAFE(ledger && ledger->isOpen());
+
     // Populate 'queueAssignmentAdvisory'
     bdlma::LocalSequentialAllocator<1024>  localAllocator(allocator);
     bmqp_ctrlmsg::ControlMessage           controlMsg(&localAllocator);
@@ -1048,18 +1107,35 @@ bool ClusterUtil::assignQueue(ClusterState*         clusterState,
             .choice()
             .makeQueueAssignmentAdvisory();
 
-    mqbu::StorageKey key;
-    populateQueueAssignmentAdvisory(&queueAdvisory,
-                                    &key,
-                                    clusterState,
-                                    clusterData,
-                                    uri,
-                                    domainCfg->mode());
+    bool isAppended = false;
+    if (!prepareQueueAssignment(&queueAdvisory,
+                                &isAppended,
+                                clusterState,
+                                clusterData,
+                                cluster,
+                                uri,
+                                allocator,
+                                status)) {
+        // Permanent failure, cannot continue
+        return false;  // RETURN
+    }
+
+    if (!isAppended) {
+        return true;  // RETURN
+    }
+
+    clusterData->electorInfo().nextLeaderMessageSequence(
+        &queueAdvisory.sequenceNumber());
+
+    BALL_LOG_INFO << clusterData->identity().description()
+                  << ": Populated QueueAssignmentAdvisory: " << queueAdvisory;
 
     // 'ClusterQueueHelper::onQueueAssigned' (the 'onQueueAssigned' observer
     // callback) will insert the key to 'ClusterState::queueKeys'.
 
-    clusterState->queueKeys().erase(key);
+    clusterState->queueKeys().erase(mqbu::StorageKey(
+        mqbu::StorageKey::BinaryRepresentation(),
+        queueAdvisory.queues().back().key().data()));
 
     // Apply 'queueAssignmentAdvisory' to CSL
     BALL_LOG_INFO << clusterData->identity().description()
@@ -38,6 +38,7 @@
 #include <bmqp_ctrlmsg_messages.h>
 
 // BDE
+#include <bsl_functional.h>
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
@@ -107,6 +108,13 @@ struct ClusterUtil {
                                                 NumNewPartitionsMap;
     typedef NumNewPartitionsMap::const_iterator NumNewPartitionsMapCIter;
 
+    /// Function assigning the queue having the specified `uri`, populating
+    /// the specified `status` and returning `false` in the case of permanent
+    /// failure (see `assignQueue`).
+    typedef bsl::function<bool(const bmqt::Uri&      uri,
+                               bmqp_ctrlmsg::Status* status)>
+        AssignQueueFn;
+
   private:
     // PRIVATE TYPES
     typedef ClusterState::UriToQueueInfoMapIter UriToQueueInfoMapIter;
@@ -148,9 +156,13 @@ struct ClusterUtil {
 
     /// Return the partition id to use for a new queue, taking into account
     /// current load of each partition in the specified `clusterState` and
-    /// the specified `uri`.
-    static int getNextPartitionId(const ClusterState& clusterState,
-                                  const bmqt::Uri&    uri);
+    /// the specified `uri`.  Optionally specify `numPendingQueues`, the
+    /// number of queues per partition which are being assigned but not yet
+    /// reflected in `clusterState`, to account for in the load.
+    static int
+    getNextPartitionId(const ClusterState&     clusterState,
+                       const bmqt::Uri&        uri,
+                       const bsl::vector<int>* numPendingQueues = 0);
 
     /// Callback invoked when the specified 'partitionId' gets assigned to
     /// the specified 'primary' with the specified 'leaseId' and the
@@ -174,19 +186,19 @@ struct ClusterUtil {
                                  unsigned int oldLeaseId);
 
     /// Process the queue assignment in the specified `request`, received
-    /// from the specified `requester`, using the specified `clusterState`,
-    /// `clusterData`, `ledger`, `cluster`,  and `allocator`.  Return the queue
+    /// from the specified `requester`, using the specified `clusterData`,
+    /// `cluster` and `allocator`, and assigning the queue with the specified
+    /// `assignQueueFn`.  Respond to the `requester` with the queue
     /// assignment result.
     ///
     /// THREAD: This method is invoked in the associated cluster's
     ///         dispatcher thread.
     static void
-    processQueueAssignmentRequest(ClusterState*        clusterState,
-                                  ClusterData*         clusterData,
-                                  ClusterStateLedger*  ledger,
+    processQueueAssignmentRequest(ClusterData*         clusterData,
                                   const mqbi::Cluster* cluster,
                                   const bmqp_ctrlmsg::ControlMessage& request,
                                   mqbnet::ClusterNode* requester,
+                                  const AssignQueueFn& assignQueueFn,
                                   bslma::Allocator*    allocator);
 
     /// Populate the specified `advisory` with information describing a
@@ -231,6 +243,34 @@ struct ClusterUtil {
                             bslma::Allocator*     allocator,
                             bmqp_ctrlmsg::Status* status = 0);
 
+    /// Perform the assignment of the queue represented by the specified
+    /// `uri` like `assignQueue`, but append the corresponding queue
+    /// information to the specified `advisory` instead of applying an
+    /// advisory to CSL, using the specified `clusterState`, `clusterData`,
+    /// `cluster` and `allocator`.  The queues already in `advisory` are
+    /// accounted for when choosing the partition of the queue.  Load into
+    /// the specified `isAppended` whether the queue was appended to
+    /// `advisory`; note that it is not when the queue is already assigned
+    /// or being assigned.  Return `false` in the case of permanent failure,
+    /// populating the specified `status`, and `true` otherwise.  Note that
+    /// the sequence number of `advisory` is not populated, and that the key
+    /// generated for the queue is kept in `clusterState->queueKeys()`, so
+    /// that the queues of `advisory` have distinct keys, until the caller
+    /// removes it before applying `advisory`.  This method is called only on
+    /// the leader node.
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    static bool
+    prepareQueueAssignment(bmqp_ctrlmsg::QueueAssignmentAdvisory* advisory,
+                           bool*                                  isAppended,
+                           ClusterState*         clusterState,
+                           ClusterData*          clusterData,
+                           const mqbi::Cluster*  cluster,
+                           const bmqt::Uri&      uri,
+                           bslma::Allocator*     allocator,
+                           bmqp_ctrlmsg::Status* status);
+
     /// Register a queue info for the queue with the values in the specified
     /// `advisory` to the specified `clusterState` of the specified `cluster`.
     /// If the specified `forceUpdate` flag is true, update queue info even if
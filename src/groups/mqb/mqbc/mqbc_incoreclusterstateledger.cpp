@@ -39,11 +39,13 @@
 
 // BMQ
 #include <bmqp_protocol.h>
+#include <bmqp_protocolutil.h>
 
 #include <bmqio_status.h>
 #include <bmqtsk_alarmlog.h>
 #include <bmqu_blobobjectproxy.h>
 #include <bmqu_memoutstream.h>
+#include <bmqu_printutil.h>
 #include <bmqu_time.h>
 
 // BDE
@@ -57,6 +59,7 @@
 #include <bdlt_currenttime.h>
 #include <bdlt_datetimeutil.h>
 #include <bdlt_epochutil.h>
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>
 #include <bsl_ctime.h>
 #include <bsl_functional.h>
@@ -209,6 +212,14 @@ void IncoreClusterStateLeger_LogIdGenerator::generateLogId(
 // class IncoreClusterStateLedger
 // ------------------------------
 
+// PUBLIC CONSTANTS
+const bsls::Types::Int64
+    IncoreClusterStateLedger::k_SNAPSHOT_MIN_INTERVAL_BYTES = 4 * 1024 * 1024;
+
+const int IncoreClusterStateLedger::k_SNAPSHOT_INTERVAL_RATIO = 2;
+
+const int IncoreClusterStateLedger::k_SNAPSHOT_MIN_INTERVALS_PER_LOG = 4;
+
 // PRIVATE MANIPULATORS
 int IncoreClusterStateLedger::cleanupLog(const bsl::string& logPath)
 {
@@ -249,10 +260,12 @@ int IncoreClusterStateLedger::onLogRolloverCb(const mqbu::StorageKey& oldLogId,
         rc_SUCCESS = 0,
         /// Fail to write CSL file header to ledger
         rc_WRITE_HEADER_FAILURE = -1,
+        /// Fail to write snapshot to ledger
+        rc_WRITE_SNAPSHOT_FAILURE = -2,
         /// Fail to create record
-        rc_CREATE_RECORD_FAILURE = -2,
+        rc_CREATE_RECORD_FAILURE = -3,
         /// Fail to write record to ledger
-        rc_WRITE_RECORD_FAILURE = -3
+        rc_WRITE_RECORD_FAILURE = -4
     };
 
     BALL_LOG_INFO << description() << ": Rolling over from log with logId ["
@@ -269,6 +282,8 @@ int IncoreClusterStateLedger::onLogRolloverCb(const mqbu::StorageKey& oldLogId,
 
     if (oldLogId.isNull()) {
         // If this is a brand new ledger
+        d_numBytesSinceSnapshot = 0;
+        d_lastSnapshotNumBytes  = 0;
         return rc_SUCCESS;  // RETURN
     }
 
@@ -276,44 +291,17 @@ int IncoreClusterStateLedger::onLogRolloverCb(const mqbu::StorageKey& oldLogId,
     // broadcast the rollover snapshot record to the followers; the followers
     // must write their own snapshot upon rollover to ensure the integrity of
     // the new log file upon rollover completion.
-    bmqp_ctrlmsg::LeaderAdvisory leaderAdvisory;
-
+    //
     // The snapshot will have the same LSN as the record which
     // caused rollover.  We do not want to bump up LSN
     // because the snapshot will not be broadcasted,  Note that since we write
     // the snapshot before the uncommitted records, the records won't be in
     // monotonically increasing order.
-    leaderAdvisory.sequenceNumber() =
-        d_clusterData_p->electorInfo().leaderMessageSequence();
-    ClusterUtil::loadPartitionsInfo(&leaderAdvisory.partitions(),
-                                    *d_clusterState_p);
-    ClusterUtil::loadQueuesInfo(&leaderAdvisory.queues(), *d_clusterState_p);
-
-    // Write snapshot into ledger
-    bmqp_ctrlmsg::ClusterMessage clusterMessage;
-    clusterMessage.choice().makeLeaderAdvisory(leaderAdvisory);
-
-    bsl::shared_ptr<bdlbb::Blob> snapshotRecord = d_blobSpPool_p->getObject();
-    rc = ClusterStateLedgerUtil::appendRecord(
-        snapshotRecord.get(),
-        clusterMessage,
-        leaderAdvisory.sequenceNumber(),
-        currentTime(),
-        ClusterStateRecordType::e_SNAPSHOT);
+    rc = writeSnapshot();
     if (rc != 0) {
-        return 10 * rc + rc_CREATE_RECORD_FAILURE;  // RETURN
+        return 10 * rc + rc_WRITE_SNAPSHOT_FAILURE;  // RETURN
     }
 
-    mqbsi::LedgerRecordId snapshotRecordId;
-    rc = d_ledger_mp->writeRecord(&snapshotRecordId,
-                                  *snapshotRecord,
-                                  bmqu::BlobPosition(),
-                                  snapshotRecord->length());
-    if (rc != 0) {
-        return 10 * rc + rc_WRITE_RECORD_FAILURE;  // RETURN
-    }
-    d_clusterData_p->stats().addCslOffsetBytes(snapshotRecord->length());
-
     // Write uncommitted advisories into ledger
     for (AdvisoriesMapIter advisoryIt = d_uncommittedAdvisories.begin();
          advisoryIt != d_uncommittedAdvisories.end();
@@ -346,7 +334,7 @@ int IncoreClusterStateLedger::onLogRolloverCb(const mqbu::StorageKey& oldLogId,
         if (rc != 0) {
             return 10 * rc + rc_WRITE_RECORD_FAILURE;  // RETURN
         }
-        d_clusterData_p->stats().addCslOffsetBytes(record->length());
+        onRecordWritten(record->length());
     }
 
     return rc_SUCCESS;
@@ -374,6 +362,164 @@ void IncoreClusterStateLedger::onQuorumChangeCb(unsigned int ackQuorum)
     }
 }
 
+void IncoreClusterStateLedger::onNodeStateChangeDispatched(
+    mqbnet::ClusterNode* node,
+    bool                 isAvailable)
+{
+    // executed by the *CLUSTER DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_clusterData_p->cluster().inDispatcherThread());
+    BSLS_ASSERT_SAFE(node);
+
+    if (!isAvailable) {
+        // The node may restart before it comes back, so its next ack must not
+        // be cumulative with the ones it sent before going down.
+        d_ackedLsns.erase(node->nodeId());
+    }
+
+    updateCumulativeCommitSupport();
+}
+
+void IncoreClusterStateLedger::updateCumulativeCommitSupport()
+{
+    // executed by the *CLUSTER DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_clusterData_p->cluster().inDispatcherThread());
+
+    const mqbnet::ClusterNode* selfNode =
+        d_clusterData_p->membership().selfNode();
+    const mqbnet::Cluster::NodesList& nodes =
+        d_clusterData_p->membership().netCluster()->nodes();
+
+    // A node which is down does not receive the commit records, and negotiates
+    // again when it comes back.
+    bool isSupported = true;
+    for (mqbnet::Cluster::NodesList::const_iterator cit = nodes.cbegin();
+         cit != nodes.cend() && isSupported;
+         ++cit) {
+        if (*cit == selfNode || !(*cit)->isAvailable()) {
+            continue;  // CONTINUE
+        }
+
+        isSupported = bmqp::ProtocolUtil::hasFeature(
+            bmqp::HighAvailabilityFeatures::k_FIELD_NAME,
+            bmqp::HighAvailabilityFeatures::k_CUMULATIVE_CSL_COMMIT,
+            (*cit)->identity().features());
+    }
+
+    if (isSupported != d_isCumulativeCommitSupported) {
+        BALL_LOG_INFO << description()
+                      << (isSupported ? ": Enabling" : ": Disabling")
+                      << " cumulative commits of advisories, as "
+                      << (isSupported ? "all" : "not all")
+                      << " the available peers support them.";
+        d_isCumulativeCommitSupported = isSupported;
+
+        // The highest LSNs acked by the nodes are only recorded while acks
+        // are cumulative, and are stale after acks were not.
+        d_ackedLsns.clear();
+    }
+}
+
+int IncoreClusterStateLedger::writeSnapshot()
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        /// Success
+        rc_SUCCESS = 0,
+        /// Fail to create snapshot record
+        rc_CREATE_RECORD_FAILURE = -1,
+        /// Fail to write snapshot record to ledger
+        rc_WRITE_RECORD_FAILURE = -2
+    };
+
+    bmqp_ctrlmsg::LeaderAdvisory leaderAdvisory;
+    leaderAdvisory.sequenceNumber() =
+        d_clusterData_p->electorInfo().leaderMessageSequence();
+    ClusterUtil::loadPartitionsInfo(&leaderAdvisory.partitions(),
+                                    *d_clusterState_p);
+    ClusterUtil::loadQueuesInfo(&leaderAdvisory.queues(), *d_clusterState_p);
+
+    bmqp_ctrlmsg::ClusterMessage clusterMessage;
+    clusterMessage.choice().makeLeaderAdvisory(leaderAdvisory);
+
+    bsl::shared_ptr<bdlbb::Blob> snapshotRecord = d_blobSpPool_p->getObject();
+    int rc = ClusterStateLedgerUtil::appendRecord(
+        snapshotRecord.get(),
+        clusterMessage,
+        leaderAdvisory.sequenceNumber(),
+        currentTime(),
+        ClusterStateRecordType::e_SNAPSHOT);
+    if (rc != 0) {
+        return 10 * rc + rc_CREATE_RECORD_FAILURE;  // RETURN
+    }
+
+    mqbsi::LedgerRecordId snapshotRecordId;
+    rc = d_ledger_mp->writeRecord(&snapshotRecordId,
+                                  *snapshotRecord,
+                                  bmqu::BlobPosition(),
+                                  snapshotRecord->length());
+    if (rc != 0) {
+        return 10 * rc + rc_WRITE_RECORD_FAILURE;  // RETURN
+    }
+    d_clusterData_p->stats().addCslOffsetBytes(snapshotRecord->length());
+
+    d_numBytesSinceSnapshot = 0;
+    d_lastSnapshotNumBytes  = snapshotRecord->length();
+
+    return rc_SUCCESS;
+}
+
+void IncoreClusterStateLedger::writeSnapshotIfNeeded()
+{
+    // executed by the *CLUSTER DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_clusterData_p->cluster().inDispatcherThread());
+
+    if (!d_uncommittedAdvisories.empty() || !d_gatedUpdateLsns.empty()) {
+        // The cluster state does not reflect the outstanding advisories, which
+        // would be skipped upon loading from the snapshot.
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 minInterval = bsl::min(
+        k_SNAPSHOT_MIN_INTERVAL_BYTES,
+        d_ledgerConfig.maxLogSize() / k_SNAPSHOT_MIN_INTERVALS_PER_LOG);
+    const bsls::Types::Int64 threshold = bsl::max(
+        minInterval,
+        k_SNAPSHOT_INTERVAL_RATIO * d_lastSnapshotNumBytes);
+    if (d_numBytesSinceSnapshot < threshold) {
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 numBytesSinceSnapshot = d_numBytesSinceSnapshot;
+    const int                rc                    = writeSnapshot();
+    if (rc != 0) {
+        BALL_LOG_WARN << description()
+                      << ": Failed to write snapshot of cluster state, rc: "
+                      << rc;
+
+        // Wait for another interval before trying again.
+        d_numBytesSinceSnapshot = 0;
+        return;  // RETURN
+    }
+
+    BALL_LOG_INFO << description() << ": Wrote snapshot of cluster state ("
+                  << bmqu::PrintUtil::prettyBytes(d_lastSnapshotNumBytes)
+                  << ") after "
+                  << bmqu::PrintUtil::prettyBytes(numBytesSinceSnapshot)
+                  << " of records since the previous snapshot.";
+}
+
+void IncoreClusterStateLedger::onRecordWritten(bsls::Types::Int64 numBytes)
+{
+    d_clusterData_p->stats().addCslOffsetBytes(numBytes);
+    d_numBytesSinceSnapshot += numBytes;
+}
+
 int IncoreClusterStateLedger::applyAdvisoryInternal(
     const bmqp_ctrlmsg::ClusterMessage&        clusterMessage,
     const bmqp_ctrlmsg::LeaderMessageSequence& lsn,
@@ -509,8 +655,7 @@ int IncoreClusterStateLedger::applyRecordInternalImpl(
         if (!isSelfLeader()) {
             d_clusterData_p->electorInfo().setLeaderMessageSequence(lsn);
         }
-        d_clusterData_p->stats().addCslOffsetBytes(record.length() -
-                                                   recordOffset);
+        onRecordWritten(record.length() - recordOffset);
 
         ClusterMessageInfo info;
         info.d_clusterMessage = clusterMessage;
@@ -616,11 +761,12 @@ int IncoreClusterStateLedger::applyRecordInternalImpl(
         const bmqp_ctrlmsg::LeaderAdvisoryCommit& commit =
             clusterMessage.choice().leaderAdvisoryCommit();
 
-        AdvisoriesMapIter iter = d_uncommittedAdvisories.find(
-            commit.sequenceNumberCommitted());
-        if (iter == d_uncommittedAdvisories.end()) {
-            GatedUpdateLsnsIter git = d_gatedUpdateLsns.find(
-                commit.sequenceNumberCommitted());
+        const bmqp_ctrlmsg::LeaderMessageSequence& committedLsn =
+            commit.sequenceNumberCommitted();
+
+        if (d_uncommittedAdvisories.find(committedLsn) ==
+            d_uncommittedAdvisories.end()) {
+            GatedUpdateLsnsIter git = d_gatedUpdateLsns.find(committedLsn);
             if (git != d_gatedUpdateLsns.end()) {
                 BALL_LOG_INFO
                     << description()
@@ -654,15 +800,10 @@ int IncoreClusterStateLedger::applyRecordInternalImpl(
         if (!isSelfLeader()) {
             d_clusterData_p->electorInfo().setLeaderMessageSequence(lsn);
         }
-        d_clusterData_p->stats().addCslOffsetBytes(record.length() -
-                                                   recordOffset);
-
-        if (isSelfLeader()) {
-            bsls::Types::Int64 replicationTimeNs =
-                bdlt::CurrentTime::now().totalNanoseconds() -
-                iter->second.d_timestampNs;
-            d_clusterData_p->stats().setCslReplicationTime(replicationTimeNs);
+        onRecordWritten(record.length() - recordOffset);
 
+        const bool isLeader = isSelfLeader();
+        if (isLeader) {
             bsl::shared_ptr<bdlbb::Blob> commitEvent =
                 d_blobSpPool_p->getObject();
 
@@ -675,21 +816,41 @@ int IncoreClusterStateLedger::applyRecordInternalImpl(
                           << "' to all cluster nodes";
         }
 
-        // Enqueue commit callback invocation on cluster dispatcher thread
-        bmqp_ctrlmsg::ControlMessage committedControlMessage;
-        committedControlMessage.choice().makeClusterMessage(
-            iter->second.d_clusterMessage);
-        // NOTE: For now, the commit callback is invoked in place to reduce
-        //       state inconsistencies resulting from thread race conditions
-        //       while transitioning to using IncoreCSL.  Once transitioned,
-        //       the commit callback should be enqueued to be invoked from the
-        //       cluster dispatcher thread.
-        // TODO: In phase 2 of IncoreCSL, this can return to enqueueing on
-        //       the cluster dispatcher thread.
-        d_commitCb(committedControlMessage,
-                   ClusterStateLedgerCommitStatus::e_SUCCESS);
-
-        d_uncommittedAdvisories.erase(iter);
+        // A commit is cumulative: it commits, in order, all the uncommitted
+        // advisories up to and including the one it refers to.
+        const bsls::Types::Int64 nowNs =
+            isLeader ? bdlt::CurrentTime::now().totalNanoseconds() : 0;
+        while (!d_uncommittedAdvisories.empty() &&
+               d_uncommittedAdvisories.begin()->first <= committedLsn) {
+            AdvisoriesMapIter iter = d_uncommittedAdvisories.begin();
+
+            if (isLeader) {
+                d_clusterData_p->stats().setCslReplicationTime(
+                    nowNs - iter->second.d_timestampNs);
+            }
+
+            // Enqueue commit callback invocation on cluster dispatcher thread
+            bmqp_ctrlmsg::ControlMessage committedControlMessage;
+            committedControlMessage.choice().makeClusterMessage(
+                iter->second.d_clusterMessage);
+            // NOTE: For now, the commit callback is invoked in place to
+            //       reduce state inconsistencies resulting from thread race
+            //       conditions while transitioning to using IncoreCSL.  Once
+            //       transitioned, the commit callback should be enqueued to
+            //       be invoked from the cluster dispatcher thread.
+            // TODO: In phase 2 of IncoreCSL, this can return to enqueueing
+            //       on the cluster dispatcher thread.
+            d_commitCb(committedControlMessage,
+                       ClusterStateLedgerCommitStatus::e_SUCCESS);
+
+            d_uncommittedAdvisories.erase(iter);
+        }
+
+        // The gated updates up to the commit are covered by it as well.
+        d_gatedUpdateLsns.erase(d_gatedUpdateLsns.begin(),
+                                d_gatedUpdateLsns.upper_bound(committedLsn));
+
+        writeSnapshotIfNeeded();
     } break;  // BREAK
     case (ClusterStateRecordType::e_ACK): {
         // PRECONDITIONS
@@ -699,26 +860,21 @@ int IncoreClusterStateLedger::applyRecordInternalImpl(
         const bmqp_ctrlmsg::LeaderAdvisoryAck& ack =
             clusterMessage.choice().leaderAdvisoryAck();
 
-        AdvisoriesMapIter iter = d_uncommittedAdvisories.find(
-            ack.sequenceNumberAcked());
-        if (iter == d_uncommittedAdvisories.end()) {
+        if (d_uncommittedAdvisories.find(ack.sequenceNumberAcked()) ==
+            d_uncommittedAdvisories.end()) {
             BALL_LOG_ERROR << description()
                            << ": Failed to apply 'LeaderAdvisoryAck': " << ack
                            << ". Reason: associated advisory not found. ";
             return rc_ADVISORY_NOT_FOUND;  // RETURN
         }
 
-        iter->second.d_ackCount += 1;
-
-        const unsigned int ackQuorum = getAckQuorum();
-
-        if (iter->second.d_ackCount == ackQuorum) {
-            // Consistency level reached. Apply a commit message for the
-            // advisory, broadcast it, and invoke the 'CommitCb'.
-            rc = applyCommit(ack.sequenceNumberAcked(), ackQuorum);
-            if (0 != rc) {
-                return 10 * rc + rc_COMMIT_FAILURE;
-            }
+        // Records of type 'e_ACK' are only applied by the leader to
+        // acknowledge its own advisories.  The acks of the followers are
+        // applied in 'applyImpl'.
+        rc = applyAck(ack.sequenceNumberAcked(),
+                      d_clusterData_p->membership().selfNode()->nodeId());
+        if (rc != 0) {
+            return 10 * rc + rc_COMMIT_FAILURE;  // RETURN
         }
     } break;  // BREAK
     case ClusterStateRecordType::e_UNDEFINED:
@@ -775,6 +931,89 @@ int IncoreClusterStateLedger::applyRecordInternal(
                                    recordType);
 }
 
+int IncoreClusterStateLedger::applyAck(
+    const bmqp_ctrlmsg::LeaderMessageSequence& lsn,
+    int                                        nodeId)
+{
+    // executed by the *CLUSTER DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_clusterData_p->cluster().inDispatcherThread());
+    BSLS_ASSERT_SAFE(isSelfLeader());
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        /// Success
+        rc_SUCCESS = 0,
+        /// Fail to commit advisories
+        rc_COMMIT_FAILURE = -1
+    };
+
+    int numAcked = 0;
+    if (!d_isCumulativeCommitSupported) {
+        // Some peers only commit the advisory a commit record refers to: the
+        // ack only acknowledges the advisory it refers to.
+        AdvisoriesMapIter iter = d_uncommittedAdvisories.find(lsn);
+        if (iter != d_uncommittedAdvisories.end()) {
+            ++iter->second.d_ackCount;
+            ++numAcked;
+        }
+    }
+    else {
+        bsl::pair<AckedLsnsMap::iterator, bool> insertRc = d_ackedLsns.insert(
+            bsl::make_pair(nodeId, lsn));
+        const bool isFirstAck = insertRc.second;
+        const bmqp_ctrlmsg::LeaderMessageSequence previousLsn =
+            insertRc.first->second;
+        if (!isFirstAck) {
+            if (lsn <= previousLsn) {
+                // Duplicate or reordered ack, already accounted for.
+                return rc_SUCCESS;  // RETURN
+            }
+            insertRc.first->second = lsn;
+        }
+
+        // Walk back from the most recent advisory, as acks usually refer to
+        // one of the latest ones, and count the ack for 'lsn' and, unless
+        // this is the first ack from the node, for the advisories following
+        // the previous ack from the node.  A cumulative ack never extends
+        // beyond a snapshot.
+        AdvisoriesMapIter iter = d_uncommittedAdvisories.end();
+        while (iter != d_uncommittedAdvisories.begin()) {
+            --iter;
+            if (lsn < iter->first) {
+                continue;  // CONTINUE
+            }
+
+            if (isFirstAck ? iter->first < lsn : iter->first <= previousLsn) {
+                break;  // BREAK
+            }
+
+            ++iter->second.d_ackCount;
+            ++numAcked;
+
+            if (iter->second.d_clusterMessage.choice()
+                    .isLeaderAdvisoryValue()) {
+                break;  // BREAK
+            }
+        }
+    }
+
+    if (numAcked == 0) {
+        BALL_LOG_INFO << description() << ": Ignoring ack with LSN = "
+                      << printLSN(lsn) << " from node " << nodeId
+                      << ", as quorum of acks has already been reached.";
+        return rc_SUCCESS;  // RETURN
+    }
+
+    const int rc = commitAckedAdvisories(getAckQuorum());
+    if (rc != 0) {
+        return 10 * rc + rc_COMMIT_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
 int IncoreClusterStateLedger::applyCommit(
     const bmqp_ctrlmsg::LeaderMessageSequence& lsn,
     unsigned int                               ackQuorum)
@@ -802,7 +1041,8 @@ int IncoreClusterStateLedger::applyCommit(
                      commitAdvisory.sequenceNumberCommitted());
 
     BALL_LOG_INFO << description() << " Quorum of " << ackQuorum
-                  << " acks is achieved for advisory of LSN " << printLSN(lsn)
+                  << " acks is achieved for advisories up to LSN "
+                  << printLSN(lsn)
                   << ", creating and applying commit advisory: "
                   << commitMessage << ".";
 
@@ -859,6 +1099,7 @@ void IncoreClusterStateLedger::cancelUncommittedAdvisories()
         }
     }
     d_uncommittedAdvisories.clear();
+    d_ackedLsns.clear();
 }
 
 void IncoreClusterStateLedger::reviewUncommittedAdvisories(
@@ -870,31 +1111,52 @@ void IncoreClusterStateLedger::reviewUncommittedAdvisories(
     BSLS_ASSERT_SAFE(d_clusterData_p->cluster().inDispatcherThread());
 
     if (isSelfLeader()) {
-        bsl::vector<bmqp_ctrlmsg::LeaderMessageSequence> advisoriesToCommit(
-            d_allocator_p);
-        AdvisoriesMapCIter iter = d_uncommittedAdvisories.cbegin();
-        for (; iter != d_uncommittedAdvisories.cend(); ++iter) {
-            const ClusterMessageInfo& info = iter->second;
-            if (info.d_ackCount >= ackQuorum) {
-                // We have quorum, so we can commit this advisory. However we
-                // can't call `applyCommit()` from this for-loop, as inside
-                // this method the element of `d_uncommittedAdvisories` pointed
-                // by `iter` will be erased from the container, hence the
-                // iterator will be invalidated. So we just store the LSNs
-                // in the vector and run over it again.
-                advisoriesToCommit.push_back(iter->first);
-            }
+        const int rc = commitAckedAdvisories(ackQuorum);
+        if (rc != 0) {
+            BALL_LOG_ERROR << d_clusterData_p->identity().description()
+                           << ": Failed to commit advisories, rc: " << rc;
         }
-        bsl::vector<bmqp_ctrlmsg::LeaderMessageSequence>::const_iterator
-            secNumIter = advisoriesToCommit.cbegin();
-        for (; secNumIter != advisoriesToCommit.cend(); ++secNumIter) {
-            int rc = applyCommit(*secNumIter, ackQuorum);
-            if (rc != 0) {
-                BALL_LOG_ERROR << d_clusterData_p->identity().description()
-                               << ": Failed to commit advisory, rc: " << rc;
-            }
+    }
+}
+
+int IncoreClusterStateLedger::commitAckedAdvisories(unsigned int ackQuorum)
+{
+    // executed by the *CLUSTER DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_clusterData_p->cluster().inDispatcherThread());
+    BSLS_ASSERT_SAFE(isSelfLeader());
+
+    // Since acks are cumulative, the number of acks of the uncommitted
+    // advisories is non-increasing in the order they were applied, except
+    // around snapshots.  Commit the longest prefix having reached the quorum.
+    // Copy the LSNs, as the advisories are erased when committed.
+    bsl::vector<bmqp_ctrlmsg::LeaderMessageSequence> lsns(d_allocator_p);
+    for (AdvisoriesMapCIter iter = d_uncommittedAdvisories.cbegin();
+         iter != d_uncommittedAdvisories.cend() &&
+         iter->second.d_ackCount >= ackQuorum;
+         ++iter) {
+        lsns.push_back(iter->first);
+    }
+
+    if (lsns.empty()) {
+        return 0;  // RETURN
+    }
+
+    if (d_isCumulativeCommitSupported) {
+        // A single commit record commits the whole prefix.
+        return applyCommit(lsns.back(), ackQuorum);  // RETURN
+    }
+
+    // Some peers only commit the advisory a commit record refers to.
+    for (size_t i = 0; i < lsns.size(); ++i) {
+        const int rc = applyCommit(lsns[i], ackQuorum);
+        if (rc != 0) {
+            return rc;  // RETURN
         }
     }
+
+    return 0;
 }
 
 int IncoreClusterStateLedger::applyImpl(const bdlbb::Blob&   event,
@@ -1032,15 +1294,18 @@ int IncoreClusterStateLedger::applyImpl(const bdlbb::Blob&   event,
         BSLS_ASSERT_SAFE(
             lsn <= d_clusterData_p->electorInfo().leaderMessageSequence());
 
-        if (d_uncommittedAdvisories.find(lsn) ==
-            d_uncommittedAdvisories.end()) {
-            BALL_LOG_INFO << description()
-                          << ": Ignoring cluster state record ack with LSN = "
-                          << printLSN(lsn) << " from '"
+        // The LSN of an ack record is the LSN of the advisory it acks.  Note
+        // that the ack of an already committed advisory is still recorded as
+        // the highest LSN acked by the source node.
+        rc = applyAck(lsn, source->nodeId());
+        if (rc != 0) {
+            BALL_LOG_WARN << description() << ": Failed to apply ack from '"
                           << source->nodeDescription()
-                          << "', as quorum of acks has already been reached.";
-            return rc_SUCCESS;  // RETURN
+                          << "' [LSN: " << printLSN(lsn) << "]. rc: " << rc;
+            return rc * 10 + rc_APPLY_RECORD_FAILURE;  // RETURN
         }
+
+        return rc_SUCCESS;  // RETURN
     }
     else {
         // Follower should only receive advisories and commits.
@@ -1287,7 +1552,11 @@ IncoreClusterStateLedger::IncoreClusterStateLedger(
 , d_ledger_mp(0)
 , d_uncommittedAdvisories(allocator)
 , d_gatedUpdateLsns(allocator)
+, d_ackedLsns(allocator)
+, d_isCumulativeCommitSupported(false)
 , d_appliedSnapshotTerm(0)
+, d_numBytesSinceSnapshot(0)
+, d_lastSnapshotNumBytes(0)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(clusterState);
@@ -1372,6 +1641,8 @@ int IncoreClusterStateLedger::open()
         return rc_ALREADY_OPENED;  // RETURN
     }
 
+    const bsls::Types::Int64 startTime = bmqu::Time::highResolutionTimer();
+
     // Create and open the ledger
     d_ledger_mp.load(new (*d_allocator_p)
                          mqbsl::Ledger(d_ledgerConfig, d_allocator_p),
@@ -1382,10 +1653,30 @@ int IncoreClusterStateLedger::open()
     }
 
     // Iterator through the records to calculate the correct outstanding num
-    // bytes and write offset.
+    // bytes and write offset, as well as the number of bytes written since
+    // the latest snapshot.
     IncoreClusterStateLedgerIterator cslIter(d_ledger_mp.get());
+    bsls::Types::Int64 numRecords         = 0;
+    bsls::Types::Int64 numRecordsToReplay = 0;
+    d_numBytesSinceSnapshot               = 0;
+    d_lastSnapshotNumBytes                = 0;
     while (cslIter.next() == 0) {
-        continue;
+        const ClusterStateRecordHeader& header         = cslIter.header();
+        const bsls::Types::Int64        recordNumBytes =
+            static_cast<bsls::Types::Int64>(header.headerWords() +
+                                            header.leaderAdvisoryWords()) *
+            bmqp::Protocol::k_WORD_SIZE;
+
+        ++numRecords;
+        if (header.recordType() == ClusterStateRecordType::e_SNAPSHOT) {
+            numRecordsToReplay      = 1;
+            d_numBytesSinceSnapshot = 0;
+            d_lastSnapshotNumBytes  = recordNumBytes;
+        }
+        else {
+            ++numRecordsToReplay;
+            d_numBytesSinceSnapshot += recordNumBytes;
+        }
     }
     rc = d_ledger_mp->setOutstandingNumBytes(cslIter.currRecordId().logId(),
                                              cslIter.currRecordId().offset());
@@ -1399,6 +1690,24 @@ int IncoreClusterStateLedger::open()
     d_clusterData_p->stats().setCslOffsetBytes(
         d_ledger_mp->currentLog()->currentOffset());
 
+    const bsls::Types::Int64 loadTimeNs = bmqu::Time::highResolutionTimer() -
+                                          startTime;
+    d_clusterData_p->stats().setCslLoadTime(loadTimeNs);
+
+    BALL_LOG_INFO << description() << ": Loaded "
+                  << bmqu::PrintUtil::prettyNumber(numRecords)
+                  << " records, of which "
+                  << bmqu::PrintUtil::prettyNumber(numRecordsToReplay)
+                  << " starting at the latest snapshot ("
+                  << bmqu::PrintUtil::prettyBytes(d_lastSnapshotNumBytes)
+                  << " snapshot, "
+                  << bmqu::PrintUtil::prettyBytes(d_numBytesSinceSnapshot)
+                  << " of records since), in "
+                  << bmqu::PrintUtil::prettyTimeInterval(loadTimeNs);
+
+    d_clusterData_p->membership().netCluster()->registerObserver(this);
+    updateCumulativeCommitSupport();
+
     d_isOpen = true;
 
     return rc_SUCCESS;
@@ -1425,6 +1734,8 @@ int IncoreClusterStateLedger::close()
         return rc_NOT_OPENED;  // RETURN
     }
 
+    d_clusterData_p->membership().netCluster()->unregisterObserver(this);
+
     cancelUncommittedAdvisories();
 
     d_gatedUpdateLsns.clear();
@@ -1577,6 +1888,28 @@ int IncoreClusterStateLedger::apply(const bdlbb::Blob&   event,
     return applyImpl(event, source);
 }
 
+// MANIPULATORS
+//   (virtual mqbnet::ClusterObserver)
+void IncoreClusterStateLedger::onNodeStateChange(mqbnet::ClusterNode* node,
+                                                 bool isAvailable)
+{
+    // executed by *ANY* thread
+
+    if (d_clusterData_p->cluster().inDispatcherThread()) {
+        onNodeStateChangeDispatched(node, isAvailable);
+    }
+    else {
+        d_clusterData_p->cluster().dispatcher()->execute(
+            bdlf::BindUtil::bindS(
+                d_allocator_p,
+                &IncoreClusterStateLedger::onNodeStateChangeDispatched,
+                this,
+                node,
+                isAvailable),
+            &d_clusterData_p->cluster());
+    }
+}
+
 // ACCESSORS
 //   (virtual mqbc::ClusterStateLedger)
 void IncoreClusterStateLedger::uncommittedAdvisories(
@@ -29,13 +29,57 @@
 /// representation.  Leader will apply update to self's ledger, broadcast it
 /// asynchronously to cluster nodes, and also advertise the update to cluster
 /// state's observers when appropriate consistency level has been achieved.
-/// Note that leader advisories are acknowledged individually by follower nodes
-/// and committed individually by the leader (as opposed to in batches or
-/// chunks).  The desired consistency level (eventual vs. strong) is configured
-/// by the user.  This component is in-core because cluster state is persisted,
+/// The desired consistency level (eventual vs. strong) is configured by the
+/// user.  This component is in-core because cluster state is persisted,
 /// replicated and maintained by BlazingMQ cluster nodes themselves instead of
 /// being offloaded to an external meta data server (e.g., ZooKeeper).
 ///
+/// Pipelining                      {#mqbc_incoreclusterstateledger_pipelining}
+/// ==========
+///
+/// The leader does not wait for an advisory to be committed before
+/// broadcasting the next one, so that any number of advisories may be
+/// outstanding.  Since each follower applies the advisories in the order they
+/// are broadcast, an ack from a follower is cumulative: it acknowledges the
+/// advisory it refers to as well as all the outstanding advisories preceding
+/// it and following the previous advisory acked by that follower.  The first
+/// ack received from a follower only acknowledges the advisory it refers to,
+/// and an ack never extends beyond a snapshot advisory, which a follower
+/// applies first after it restarts.  Advisories are committed in order:
+/// whenever the longest prefix of outstanding advisories having reached the
+/// ack quorum grows, the leader broadcasts a single commit record for the last
+/// advisory of that prefix, and the followers commit all their outstanding
+/// advisories up to and including that one.  The throughput of the leader is
+/// therefore bounded by the bandwidth to the followers rather than by the
+/// round-trip time to them.
+///
+/// Older versions only commit the advisory a commit record refers to.  Hence,
+/// cumulative acks and commits are only used while all the available peers
+/// advertise the `CUMULATIVE_CSL_COMMIT` high-availability feature in their
+/// negotiation; otherwise, an ack only acknowledges the advisory it refers
+/// to, and each advisory of the prefix having reached the ack quorum is
+/// committed with its own commit record.  The highest LSN acked by a node is
+/// forgotten when the node goes down, so that its first ack after it comes
+/// back only acknowledges the advisory it refers to.
+///
+/// Snapshots                        {#mqbc_incoreclusterstateledger_snapshots}
+/// =========
+///
+/// Loading the cluster state from the ledger only replays the records starting
+/// at the latest snapshot record.  In addition to the snapshot written at the
+/// beginning of each new log upon rollover, each node periodically writes a
+/// compacted snapshot of the cluster state into its own ledger, once all
+/// outstanding advisories have been committed and the amount of bytes written
+/// since the latest snapshot exceeds the greater of a minimum interval and
+/// `k_SNAPSHOT_INTERVAL_RATIO` times the size of that snapshot.  The minimum
+/// interval is the lesser of `k_SNAPSHOT_MIN_INTERVAL_BYTES` and the maximum
+/// size of a log divided by `k_SNAPSHOT_MIN_INTERVALS_PER_LOG`, so that small
+/// logs also get periodic snapshots before they roll over.  This bounds the
+/// number of records to replay upon restart, while keeping the amount of bytes
+/// written for snapshots proportional to the amount of bytes written for
+/// updates.  Similarly to the rollover snapshot, these snapshots are not
+/// broadcast to the other nodes.
+///
 /// Thread Safety                       {#mqbc_incoreclusterstateledger_thread}
 /// =============
 ///
@@ -51,6 +95,7 @@
 #include <mqbcfg_messages.h>
 #include <mqbi_cluster.h>
 #include <mqbi_dispatcher.h>
+#include <mqbnet_cluster.h>
 #include <mqbsi_ledger.h>
 
 // BMQ
@@ -70,14 +115,9 @@
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_keyword.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
-
-// FORWARD DECLARATION
-namespace mqbnet {
-class ClusterNode;
-}
-
 namespace mqbc {
 
 /// Struct holding a cluster message and its associated state in the cluster
@@ -95,7 +135,8 @@ struct IncoreClusterStateLedger_ClusterMessageInfo {
     /// `ClusterMessage` started.
     bsls::Types::Uint64 d_timestampNs;
 
-    /// Number of ACKs received for this `ClusterMessage`.
+    /// Number of ACKs received for this `ClusterMessage`, including the
+    /// cumulative ACKs of subsequent messages.
     unsigned int d_ackCount;
 
     // TRAITS
@@ -138,7 +179,9 @@ struct IncoreClusterStateLedger_ClusterMessageInfo {
 /// @todo Apply the specified message to self and replicate if self is leader.
 ///
 /// @todo Notify via `commitCb` when consistency level has been achieved.
-class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
+class IncoreClusterStateLedger BSLS_KEYWORD_FINAL
+: public ClusterStateLedger,
+  public mqbnet::ClusterObserver {
   public:
     // TYPES
     typedef bmqp::BlobPoolUtil::BlobSpPool BlobSpPool;
@@ -159,6 +202,25 @@ class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
     typedef bsl::set<bmqp_ctrlmsg::LeaderMessageSequence> GatedUpdateLsns;
     typedef GatedUpdateLsns::iterator                     GatedUpdateLsnsIter;
 
+    /// Map from node id to the highest LSN acknowledged by that node.
+    typedef bsl::unordered_map<int, bmqp_ctrlmsg::LeaderMessageSequence>
+        AckedLsnsMap;
+
+    // PUBLIC CONSTANTS
+
+    /// Minimum number of bytes written to the ledger between two periodic
+    /// snapshots.
+    static const bsls::Types::Int64 k_SNAPSHOT_MIN_INTERVAL_BYTES;
+
+    /// Ratio of the number of bytes written to the ledger between two
+    /// periodic snapshots to the size of the latest snapshot.
+    static const int k_SNAPSHOT_INTERVAL_RATIO;
+
+    /// Number of minimum intervals between two periodic snapshots fitting in
+    /// a log of the maximum size, for logs too small for
+    /// `k_SNAPSHOT_MIN_INTERVAL_BYTES`.
+    static const int k_SNAPSHOT_MIN_INTERVALS_PER_LOG;
+
   private:
     // CLASS-SCOPE CATEGORY
     BALL_LOG_SET_CLASS_CATEGORY("MQBC.INCORECLUSTERSTATELEDGER");
@@ -206,10 +268,25 @@ class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
     /// arrives, or when a later snapshot supersedes its term.
     GatedUpdateLsns d_gatedUpdateLsns;
 
+    /// Highest LSN acknowledged by each node, used by the leader to apply
+    /// the cumulative acks of the followers.
+    AckedLsnsMap d_ackedLsns;
+
+    /// Whether all the available peers support cumulative acks and commits,
+    /// as described in the component documentation.
+    bool d_isCumulativeCommitSupported;
+
     /// Elector term of the last snapshot self follower applied (0 if none).
     /// An e_UPDATE whose term differs is gated, re-arming the gate each term.
     bsls::Types::Uint64 d_appliedSnapshotTerm;
 
+    /// Number of bytes written to the ledger since the latest snapshot
+    /// record.
+    bsls::Types::Int64 d_numBytesSinceSnapshot;
+
+    /// Size, in bytes, of the latest snapshot record written to the ledger.
+    bsls::Types::Int64 d_lastSnapshotNumBytes;
+
   private:
     // NOT IMPLEMENTED
     IncoreClusterStateLedger(const IncoreClusterStateLedger&)
@@ -237,6 +314,36 @@ class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
     /// value `ackQuorum`.
     void onQuorumChangeCb(unsigned int ackQuorum);
 
+    /// Process the change of state of the specified `node` to available (if
+    /// the specified `isAvailable` is true) or not available (otherwise).
+    ///
+    /// THREAD: This method can be invoked only in the associated cluster's
+    ///         dispatcher thread.
+    void onNodeStateChangeDispatched(mqbnet::ClusterNode* node,
+                                     bool                 isAvailable);
+
+    /// Update whether all the available peers support cumulative acks and
+    /// commits, from the features they advertised in their negotiation.
+    ///
+    /// THREAD: This method can be invoked only in the associated cluster's
+    ///         dispatcher thread.
+    void updateCumulativeCommitSupport();
+
+    /// Write into the ledger a snapshot record of the current cluster state,
+    /// having the current leader message sequence number.  Return 0 on
+    /// success and non-zero error value otherwise.  Note that the snapshot is
+    /// not broadcast to the other nodes.
+    int writeSnapshot();
+
+    /// Write a snapshot of the current cluster state into the ledger if there
+    /// is no outstanding advisory and enough bytes were written to the ledger
+    /// since the latest snapshot, as described in the component
+    /// documentation.
+    void writeSnapshotIfNeeded();
+
+    /// Record that the specified `numBytes` were written to the ledger.
+    void onRecordWritten(bsls::Types::Int64 numBytes);
+
     /// Internal helper method to apply the advisory in the specified
     /// `clusterMessage`, of the specified `recordType` and identified by
     /// the specified `lsn`.  Notify via `commitCb` when consistency
@@ -272,11 +379,28 @@ class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
                             const bmqp_ctrlmsg::LeaderMessageSequence& lsn,
                             ClusterStateRecordType::Enum recordType);
 
-    /// Internal helper method to apply commit for the advisory with the
-    /// specified `lsn` as the specified `ackQuorum` is reached.
+    /// Internal helper method to apply the ack of the advisory with the
+    /// specified `lsn` from the node having the specified `nodeId`, which,
+    /// if cumulative commits are supported, also acknowledges the advisories
+    /// preceding `lsn` and following the previous advisory acked by that
+    /// node, as described in the component documentation.  Commit the
+    /// advisories which reached the ack quorum.  Note that *only* a leader
+    /// node may invoke this routine.
+    int applyAck(const bmqp_ctrlmsg::LeaderMessageSequence& lsn, int nodeId);
+
+    /// Internal helper method to apply commit for the advisories up to and
+    /// including the one with the specified `lsn` as the specified
+    /// `ackQuorum` is reached.
     int applyCommit(const bmqp_ctrlmsg::LeaderMessageSequence& lsn,
                     unsigned int                               ackQuorum);
 
+    /// Commit the longest prefix of the uncommitted advisories having at
+    /// least the specified `ackQuorum` of acks, if not empty, with a single
+    /// commit record if cumulative commits are supported, and with one
+    /// commit record per advisory otherwise.  Return 0 on success and
+    /// non-zero error value otherwise.
+    int commitAckedAdvisories(unsigned int ackQuorum);
+
     /// Cancel all uncommitted advisories.
     ///
     /// THREAD: This method can be invoked only in the associated cluster's
@@ -284,7 +408,7 @@ class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
     void cancelUncommittedAdvisories();
 
     /// Review all uncommitted advisories and commit those which have more acks
-    /// then the new `ackQuorum`. Called upon quorum change.
+    /// then the new `ackQuorum`, in order. Called upon quorum change.
     ///
     /// THREAD: This method can be invoked only in the associated cluster's
     ///         dispatcher thread.
@@ -394,6 +518,17 @@ class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
     /// Set the commit callback to the specified `value`.
     void setCommitCb(const CommitCb& value) BSLS_KEYWORD_OVERRIDE;
 
+    // MANIPULATORS
+    //   (virtual mqbnet::ClusterObserver)
+
+    /// Notification method to indicate that the specified `node` is now
+    /// available (if the specified `isAvailable` is true) or not available
+    /// (if `isAvailable` is false).
+    ///
+    /// THREAD: This method can be invoked from any thread.
+    void onNodeStateChange(mqbnet::ClusterNode* node,
+                           bool isAvailable) BSLS_KEYWORD_OVERRIDE;
+
     // ACCESSORS
     //   (virtual mqbc::ClusterStateLedger)
 
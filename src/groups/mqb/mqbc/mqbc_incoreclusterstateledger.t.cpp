@@ -19,11 +19,13 @@
 #include <bmqp_crc32c.h>
 #include <bmqp_ctrlmsg_messages.h>
 #include <bmqp_event.h>
+#include <bmqp_protocol.h>
 #include <bmqt_uri.h>
 
 // MQB
 #include <mqbc_clusterstateledgeriterator.h>
 #include <mqbc_clusterstateledgerprotocol.h>
+#include <mqbc_clusterstate.h>
 #include <mqbc_clusterstateledgerutil.h>
 #include <mqbc_clusterutil.h>
 #include <mqbmock_cluster.h>
@@ -33,6 +35,7 @@
 
 #include <bmqio_testchannel.h>
 #include <bmqu_memoutstream.h>
+#include <bmqu_printutil.h>
 #include <bmqu_time.h>
 
 // BDE
@@ -51,6 +54,7 @@
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bsls_assert.h>
+#include <bsls_timeutil.h>
 #include <bsls_types.h>
 
 // SYS
@@ -61,6 +65,11 @@
 #include <bmqu_tempdirectory.h>
 #include <bsl_deque.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
 // CONVENIENCE
 using namespace BloombergLP;
 using namespace bsl;
@@ -390,6 +399,21 @@ struct Tester {
     void receiveAck(mqbc::IncoreClusterStateLedger*            ledger,
                     const bmqp_ctrlmsg::LeaderMessageSequence& sequenceNumber,
                     int                                        numAcks)
+    {
+        for (int i = 1; i <= numAcks; ++i) {
+            receiveAckFrom(ledger,
+                           sequenceNumber,
+                           mqbmock::Cluster::k_LEADER_NODE_ID + i);
+        }
+    }
+
+    /// Let the specified `ledger` receive from the node having the specified
+    /// `nodeId` an ack for the record having the specific `sequenceNumber`.
+    /// Behavior is undefined unless the caller is the leader node.
+    void
+    receiveAckFrom(mqbc::IncoreClusterStateLedger*            ledger,
+                   const bmqp_ctrlmsg::LeaderMessageSequence& sequenceNumber,
+                   int                                        nodeId)
     {
         // PRECONDITIONS
         BSLS_ASSERT_OPT(d_isLeader);
@@ -408,12 +432,51 @@ struct Tester {
                            123456,
                            mqbc::ClusterStateRecordType::e_ACK);
 
-        for (int i = 1; i <= numAcks; ++i) {
-            BMQTST_ASSERT_EQ(
-                ledger->apply(ackEvent,
-                              d_cluster_mp->netCluster().lookupNode(
-                                  mqbmock::Cluster::k_LEADER_NODE_ID + i)),
-                0);
+        BMQTST_ASSERT_EQ(
+            ledger->apply(ackEvent,
+                          d_cluster_mp->netCluster().lookupNode(nodeId)),
+            0);
+    }
+
+    /// Disconnect the node having the specified `nodeId` and connect it
+    /// again, advertising the `CUMULATIVE_CSL_COMMIT` feature in its
+    /// negotiation if the specified `supportsCumulativeCommit` is true.
+    void reconnectNode(int nodeId, bool supportsCumulativeCommit)
+    {
+        mqbnet::ClusterNode* node = d_cluster_mp->netCluster().lookupNode(
+            nodeId);
+        BSLS_ASSERT_OPT(node != 0);
+
+        const bsl::shared_ptr<bmqio::TestChannel>& channel =
+            d_cluster_mp->_channels().at(node);
+        node->resetChannel(channel);
+
+        bmqp_ctrlmsg::ClientIdentity identity(
+            bmqtst::TestHelperUtil::allocator());
+        if (supportsCumulativeCommit) {
+            identity.features()
+                .append(bmqp::HighAvailabilityFeatures::k_FIELD_NAME)
+                .append(":")
+                .append(
+                    bmqp::HighAvailabilityFeatures::k_CUMULATIVE_CSL_COMMIT);
+        }
+        node->setChannel(bsl::weak_ptr<bmqio::Channel>(channel),
+                         identity,
+                         bmqio::Channel::ReadCallback());
+    }
+
+    /// Reconnect all the peers of self node, as per `reconnectNode`, with
+    /// the specified `supportsCumulativeCommit`.
+    void reconnectPeers(bool supportsCumulativeCommit)
+    {
+        const int selfNodeId = d_cluster_mp->netCluster().selfNodeId();
+        for (TestChannelMapCIter citer = d_cluster_mp->_channels().cbegin();
+             citer != d_cluster_mp->_channels().cend();
+             ++citer) {
+            if (citer->first->nodeId() != selfNodeId) {
+                reconnectNode(citer->first->nodeId(),
+                              supportsCumulativeCommit);
+            }
         }
     }
 
@@ -578,6 +641,202 @@ struct Tester {
     }
 };
 
+/// Apply the specified `numAdvisories` queue assignment advisories to the
+/// ledger of the specified `tester`, which must be the leader, and let a
+/// quorum of followers acknowledge them with one cumulative ack per the
+/// specified `window` of advisories, so that up to `window` advisories are
+/// outstanding at any time.  Note that the first advisory is acknowledged on
+/// its own, since the first ack from a follower is not cumulative.
+void applyPipelinedAdvisories(Tester* tester, int numAdvisories, int window)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(tester->d_isLeader);
+    BSLS_ASSERT_OPT(window > 0);
+
+    mqbc::IncoreClusterStateLedger* obj =
+        tester->d_clusterStateLedger_mp.get();
+    const unsigned int quorum =
+        tester->d_cluster_mp->_clusterData()->quorumManager().quorum();
+
+    bmqp_ctrlmsg::QueueAssignmentAdvisory qadvisory(
+        bmqtst::TestHelperUtil::allocator());
+    qadvisory.queues().resize(1);
+    bmqp_ctrlmsg::QueueInfo& qinfo = qadvisory.queues().front();
+    qinfo.partitionId()            = 1U;
+
+    for (int i = 0; i < numAdvisories; ++i) {
+        tester->d_cluster_mp->_clusterData()
+            ->electorInfo()
+            .nextLeaderMessageSequence(&qadvisory.sequenceNumber());
+
+        bmqu::MemOutStream uri(bmqtst::TestHelperUtil::allocator());
+        uri << "bmq://bmq.test.mmap.priority/q" << i;
+        qinfo.uri() = uri.str();
+        mqbu::StorageKey(static_cast<unsigned int>(i)).loadBinary(
+            &qinfo.key());
+
+        BSLS_ASSERT_OPT(obj->apply(qadvisory) == 0);
+
+        if (i % window == 0 || i + 1 == numAdvisories) {
+            tester->receiveAck(obj, qadvisory.sequenceNumber(), quorum - 1);
+        }
+    }
+}
+
+/// Apply to the ledger of the specified `tester`, which must be the leader,
+/// an advisory assigning the queue having the specified `queueId` to
+/// partition 1, and return that advisory.  Note that the advisory is not
+/// acknowledged by the followers.
+bmqp_ctrlmsg::QueueAssignmentAdvisory applyQueueAssignment(Tester* tester,
+                                                           int     queueId)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(tester->d_isLeader);
+
+    bmqp_ctrlmsg::QueueAssignmentAdvisory qadvisory(
+        bmqtst::TestHelperUtil::allocator());
+    tester->d_cluster_mp->_clusterData()
+        ->electorInfo()
+        .nextLeaderMessageSequence(&qadvisory.sequenceNumber());
+
+    bmqp_ctrlmsg::QueueInfo qinfo(bmqtst::TestHelperUtil::allocator());
+    bmqu::MemOutStream      uri(bmqtst::TestHelperUtil::allocator());
+    uri << "bmq://bmq.test.mmap.priority/q" << queueId;
+    qinfo.uri()         = uri.str();
+    qinfo.partitionId() = 1U;
+    mqbu::StorageKey(static_cast<unsigned int>(queueId))
+        .loadBinary(&qinfo.key());
+    qadvisory.queues().push_back(qinfo);
+
+    BSLS_ASSERT_OPT(tester->d_clusterStateLedger_mp->apply(qadvisory) == 0);
+
+    return qadvisory;
+}
+
+// ====================
+// struct LedgerSummary
+// ====================
+
+/// Summary of the records of a ledger, in iteration order.
+struct LedgerSummary {
+    // PUBLIC DATA
+
+    /// Number of records.
+    int d_numRecords;
+
+    /// Number of bytes of the records.
+    bsls::Types::Int64 d_numBytes;
+
+    /// Number of snapshot records.
+    int d_numSnapshots;
+
+    /// Index of the latest snapshot record, or -1 if there is none.
+    int d_snapshotIndex;
+
+    /// Number of bytes of the records preceding the latest snapshot record.
+    bsls::Types::Int64 d_numBytesBeforeSnapshot;
+
+    /// Number of bytes of the records up to, and including, the
+    /// second-to-last commit record preceding the latest snapshot record.
+    bsls::Types::Int64 d_numBytesAtPreviousCommit;
+
+    /// Type of the record preceding the latest snapshot record.
+    mqbc::ClusterStateRecordType::Enum d_recordTypeBeforeSnapshot;
+};
+
+/// Load into the specified `summary` the summary of the records of the
+/// specified `ledger`.
+void loadLedgerSummary(LedgerSummary*                        summary,
+                       const mqbc::IncoreClusterStateLedger& ledger)
+{
+    summary->d_numRecords               = 0;
+    summary->d_numBytes                 = 0;
+    summary->d_numSnapshots             = 0;
+    summary->d_snapshotIndex            = -1;
+    summary->d_numBytesBeforeSnapshot   = 0;
+    summary->d_numBytesAtPreviousCommit = 0;
+    summary->d_recordTypeBeforeSnapshot =
+        mqbc::ClusterStateRecordType::e_UNDEFINED;
+
+    bsls::Types::Int64                 lastCommitNumBytes     = 0;
+    bsls::Types::Int64                 previousCommitNumBytes = 0;
+    mqbc::ClusterStateRecordType::Enum previousRecordType =
+        mqbc::ClusterStateRecordType::e_UNDEFINED;
+
+    bslma::ManagedPtr<mqbc::ClusterStateLedgerIterator> cslIter =
+        ledger.getIterator();
+    while (cslIter->next() == 0) {
+        const mqbc::ClusterStateRecordHeader& header = cslIter->header();
+
+        if (header.recordType() == mqbc::ClusterStateRecordType::e_SNAPSHOT) {
+            ++summary->d_numSnapshots;
+            summary->d_snapshotIndex            = summary->d_numRecords;
+            summary->d_numBytesBeforeSnapshot   = summary->d_numBytes;
+            summary->d_numBytesAtPreviousCommit = previousCommitNumBytes;
+            summary->d_recordTypeBeforeSnapshot = previousRecordType;
+        }
+
+        ++summary->d_numRecords;
+        summary->d_numBytes += static_cast<bsls::Types::Int64>(
+                                   header.headerWords() +
+                                   header.leaderAdvisoryWords()) *
+                               bmqp::Protocol::k_WORD_SIZE;
+
+        if (header.recordType() == mqbc::ClusterStateRecordType::e_COMMIT) {
+            previousCommitNumBytes = lastCommitNumBytes;
+            lastCommitNumBytes     = summary->d_numBytes;
+        }
+        previousRecordType = header.recordType();
+    }
+}
+
+/// Return the minimum number of bytes written to the ledger of the
+/// specified `tester` between two periodic snapshots, when the latest
+/// snapshot is small enough.
+bsls::Types::Int64 snapshotMinInterval(const Tester& tester)
+{
+    return bsl::min(
+        mqbc::IncoreClusterStateLedger::k_SNAPSHOT_MIN_INTERVAL_BYTES,
+        static_cast<bsls::Types::Int64>(tester.d_cluster_mp
+                                            ->_clusterDefinition()
+                                            .partitionConfig()
+                                            .maxCSLFileSize()) /
+            mqbc::IncoreClusterStateLedger::k_SNAPSHOT_MIN_INTERVALS_PER_LOG);
+}
+
+/// Apply to the ledger of the specified `tester`, which must be the leader,
+/// queue assignment advisories, each committed by a quorum of followers,
+/// until the ledger contains a snapshot record.  Append the applied
+/// advisories to the specified `advisories` and load into the specified
+/// `summary` the summary of the ledger.
+void applyUntilSnapshot(
+    bsl::vector<bmqp_ctrlmsg::QueueAssignmentAdvisory>* advisories,
+    LedgerSummary*                                      summary,
+    Tester*                                             tester)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(tester->d_isLeader);
+
+    const int          k_MAX_NUM_ADVISORIES = 1000;
+    const unsigned int quorum =
+        tester->d_cluster_mp->_clusterData()->quorumManager().quorum();
+
+    loadLedgerSummary(summary, *tester->d_clusterStateLedger_mp);
+    for (int i = 0; summary->d_numSnapshots == 0 && i < k_MAX_NUM_ADVISORIES;
+         ++i) {
+        advisories->push_back(
+            applyQueueAssignment(tester,
+                                 static_cast<int>(advisories->size())));
+        tester->receiveAck(tester->d_clusterStateLedger_mp.get(),
+                           advisories->back().sequenceNumber(),
+                           quorum - 1);
+
+        loadLedgerSummary(summary, *tester->d_clusterStateLedger_mp);
+    }
+
+    BSLS_ASSERT_OPT(summary->d_numSnapshots > 0);
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -2343,6 +2602,558 @@ static void test13_quorumChangeCb()
     BMQTST_ASSERT(tester.hasNoMoreBroadcastedMessages(2));
 }
 
+static void test14_cumulativeAcks()
+// ------------------------------------------------------------------------
+// CUMULATIVE ACKS
+//
+// Concerns:
+//   An ack from a follower acknowledges all the outstanding advisories
+//   since its previous ack, and the advisories having reached the quorum
+//   are committed, in order, by a single commit record.  A stale ack from
+//   a follower is ignored.
+//
+// Testing:
+//   int apply(const bdlbb::Blob& record)  // for 'record' of type
+//                                         // 'e_ACK'
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("CUMULATIVE ACKS");
+
+    Tester                          tester;
+    mqbc::IncoreClusterStateLedger* obj = tester.d_clusterStateLedger_mp.get();
+    BSLS_ASSERT_OPT(obj->open() == 0);
+
+    // All the peers support cumulative commits.
+    tester.reconnectPeers(true);
+
+    const unsigned int quorum =
+        tester.d_cluster_mp->_clusterData()->quorumManager().quorum();
+    BSLS_ASSERT_OPT(quorum > 1);
+
+    // Apply and commit the first advisory, acknowledged on its own.
+    applyPipelinedAdvisories(&tester, 1, 1);
+
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 1U);
+    BMQTST_ASSERT(tester.hasBroadcastedMessages(2));
+
+    // Apply 3 advisories without acks from the followers.
+    const int k_NUM_ADVISORIES = 3;
+
+    bsl::vector<bmqp_ctrlmsg::QueueAssignmentAdvisory> advisories(
+        bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_ADVISORIES; ++i) {
+        bmqp_ctrlmsg::QueueAssignmentAdvisory qadvisory;
+        tester.d_cluster_mp->_clusterData()
+            ->electorInfo()
+            .nextLeaderMessageSequence(&qadvisory.sequenceNumber());
+
+        bmqp_ctrlmsg::QueueInfo qinfo;
+        bmqu::MemOutStream      uri(bmqtst::TestHelperUtil::allocator());
+        uri << "bmq://bmq.test.mmap.priority/pipelined" << i;
+        qinfo.uri()         = uri.str();
+        qinfo.partitionId() = 1U;
+        mqbu::StorageKey(static_cast<unsigned int>(100 + i))
+            .loadBinary(&qinfo.key());
+        qadvisory.queues().push_back(qinfo);
+
+        BMQTST_ASSERT_EQ(obj->apply(qadvisory), 0);
+        advisories.push_back(qadvisory);
+    }
+
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 1U);
+    BMQTST_ASSERT(tester.hasBroadcastedMessages(2 + k_NUM_ADVISORIES));
+
+    // A single ack of the last advisory from a quorum of followers commits
+    // all of them, in order, with a single commit record.
+    tester.receiveAck(obj, advisories.back().sequenceNumber(), quorum - 1);
+
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(),
+                     static_cast<size_t>(1 + k_NUM_ADVISORIES));
+    for (int i = 0; i < k_NUM_ADVISORIES; ++i) {
+        bmqp_ctrlmsg::ControlMessage expected;
+        expected.choice()
+            .makeClusterMessage()
+            .choice()
+            .makeQueueAssignmentAdvisory(advisories[i]);
+        BMQTST_ASSERT_EQ(tester.committedMessage(1 + i), expected);
+    }
+
+    BMQTST_ASSERT(tester.hasBroadcastedMessages(3 + k_NUM_ADVISORIES));
+    const bmqp_ctrlmsg::ControlMessage commit = tester.broadcastedMessage(
+        2 + k_NUM_ADVISORIES);
+    BMQTST_ASSERT(commit.choice()
+                      .clusterMessage()
+                      .choice()
+                      .isLeaderAdvisoryCommitValue());
+    BMQTST_ASSERT_EQ(commit.choice()
+                         .clusterMessage()
+                         .choice()
+                         .leaderAdvisoryCommit()
+                         .sequenceNumberCommitted(),
+                     advisories.back().sequenceNumber());
+
+    // A stale ack is ignored.
+    tester.receiveAck(obj, advisories.front().sequenceNumber(), quorum - 1);
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(),
+                     static_cast<size_t>(1 + k_NUM_ADVISORIES));
+
+    BSLS_ASSERT_OPT(obj->close() == 0);
+    BMQTST_ASSERT(tester.hasNoMoreBroadcastedMessages(3 + k_NUM_ADVISORIES));
+}
+
+static void test15_periodicSnapshot()
+// ------------------------------------------------------------------------
+// PERIODIC SNAPSHOT
+//
+// Concerns:
+//   Once the bytes written to the ledger since the latest snapshot cross
+//   the snapshot interval, a snapshot of the cluster state is written
+//   right after the commit record which crossed it, in the middle of the
+//   current log, and is not broadcast to the followers.
+//
+// Testing:
+//   Periodic snapshots of the cluster state.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PERIODIC SNAPSHOT");
+
+    Tester                          tester;
+    mqbc::IncoreClusterStateLedger* obj = tester.d_clusterStateLedger_mp.get();
+    BSLS_ASSERT_OPT(obj->open() == 0);
+
+    const bsls::Types::Int64 threshold = snapshotMinInterval(tester);
+
+    bsl::vector<bmqp_ctrlmsg::QueueAssignmentAdvisory> advisories(
+        bmqtst::TestHelperUtil::allocator());
+    LedgerSummary summary;
+    applyUntilSnapshot(&advisories, &summary, &tester);
+
+    BMQTST_ASSERT_EQ(summary.d_numSnapshots, 1);
+    BMQTST_ASSERT_EQ(summary.d_snapshotIndex, summary.d_numRecords - 1);
+    BMQTST_ASSERT_EQ(summary.d_recordTypeBeforeSnapshot,
+                     mqbc::ClusterStateRecordType::e_COMMIT);
+    BMQTST_ASSERT_GE(summary.d_numBytesBeforeSnapshot, threshold);
+    BMQTST_ASSERT_LT(summary.d_numBytesAtPreviousCommit, threshold);
+
+    // Each advisory is broadcast along with its commit, but not the snapshot
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), advisories.size());
+    BMQTST_ASSERT(tester.hasNoMoreBroadcastedMessages(2 * advisories.size()));
+
+    // The snapshot is the latest record
+    bslma::ManagedPtr<mqbc::ClusterStateLedgerIterator> cslIter =
+        obj->getIterator();
+    for (int i = 0; i < summary.d_numRecords; ++i) {
+        BMQTST_ASSERT_EQ(cslIter->next(), 0);
+    }
+    verifyRecordHeader(*cslIter,
+                       mqbc::ClusterStateRecordType::e_SNAPSHOT,
+                       advisories.back().sequenceNumber());
+
+    bmqp_ctrlmsg::ClusterMessage msg;
+    BMQTST_ASSERT_EQ(cslIter->loadClusterMessage(&msg), 0);
+    BMQTST_ASSERT(msg.choice().isLeaderAdvisoryValue());
+    BMQTST_ASSERT_EQ(msg.choice().leaderAdvisory().queues().size(),
+                     advisories.size());
+
+    BSLS_ASSERT_OPT(obj->close() == 0);
+}
+
+static void test16_snapshotSkippedWhileUncommitted()
+// ------------------------------------------------------------------------
+// SNAPSHOT SKIPPED WHILE UNCOMMITTED
+//
+// Concerns:
+//   No snapshot is written while advisories are outstanding, even if the
+//   bytes written since the latest snapshot crossed the snapshot
+//   interval, since the cluster state does not reflect them yet.  The
+//   snapshot is written once the last outstanding advisory is committed.
+//
+// Testing:
+//   Periodic snapshots of the cluster state.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("SNAPSHOT SKIPPED WHILE UNCOMMITTED");
+
+    Tester                          tester;
+    mqbc::IncoreClusterStateLedger* obj = tester.d_clusterStateLedger_mp.get();
+    BSLS_ASSERT_OPT(obj->open() == 0);
+
+    const bsls::Types::Int64 threshold = snapshotMinInterval(tester);
+    const unsigned int       quorum =
+        tester.d_cluster_mp->_clusterData()->quorumManager().quorum();
+
+    // Apply advisories, without acks, until the interval is crossed
+    bsl::vector<bmqp_ctrlmsg::QueueAssignmentAdvisory> advisories(
+        bmqtst::TestHelperUtil::allocator());
+    LedgerSummary summary;
+    loadLedgerSummary(&summary, *obj);
+    while (summary.d_numBytes < threshold) {
+        const int queueId = static_cast<int>(advisories.size());
+        advisories.push_back(applyQueueAssignment(&tester, queueId));
+        loadLedgerSummary(&summary, *obj);
+    }
+    BMQTST_ASSERT_GT(advisories.size(), 1U);
+    BMQTST_ASSERT_EQ(summary.d_numSnapshots, 0);
+
+    // Commit all but the last advisory
+    for (size_t i = 0; i + 1 < advisories.size(); ++i) {
+        tester.receiveAck(obj, advisories[i].sequenceNumber(), quorum - 1);
+    }
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), advisories.size() - 1);
+
+    loadLedgerSummary(&summary, *obj);
+    BMQTST_ASSERT_EQ(summary.d_numSnapshots, 0);
+
+    // Commit the last advisory
+    tester.receiveAck(obj, advisories.back().sequenceNumber(), quorum - 1);
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), advisories.size());
+
+    loadLedgerSummary(&summary, *obj);
+    BMQTST_ASSERT_EQ(summary.d_numSnapshots, 1);
+    BMQTST_ASSERT_EQ(summary.d_snapshotIndex, summary.d_numRecords - 1);
+    BMQTST_ASSERT_EQ(summary.d_recordTypeBeforeSnapshot,
+                     mqbc::ClusterStateRecordType::e_COMMIT);
+
+    BSLS_ASSERT_OPT(obj->close() == 0);
+}
+
+static void test17_reloadFromPeriodicSnapshot()
+// ------------------------------------------------------------------------
+// RELOAD FROM PERIODIC SNAPSHOT
+//
+// Concerns:
+//   Loading the cluster state from a ledger having a periodic snapshot in
+//   the middle of its log, followed by more advisories, yields the same
+//   cluster state as the one built by applying all the committed
+//   advisories.
+//
+// Plan:
+//   1 Apply and commit advisories until a periodic snapshot is written
+//   2 Apply and commit more advisories, unassigning a queue assigned
+//     before the snapshot and assigning new queues
+//   3 Close and reopen the CSL
+//   4 Load a cluster state from the CSL and compare it to the cluster
+//     state of the tester
+//
+// Testing:
+//   ClusterUtil::load from a ledger having a periodic snapshot.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("RELOAD FROM PERIODIC SNAPSHOT");
+
+    Tester                          tester;
+    mqbc::IncoreClusterStateLedger* obj = tester.d_clusterStateLedger_mp.get();
+    BSLS_ASSERT_OPT(obj->open() == 0);
+
+    const unsigned int quorum =
+        tester.d_cluster_mp->_clusterData()->quorumManager().quorum();
+
+    // 1. Apply and commit advisories until a periodic snapshot is written
+    bsl::vector<bmqp_ctrlmsg::QueueAssignmentAdvisory> advisories(
+        bmqtst::TestHelperUtil::allocator());
+    LedgerSummary summary;
+    applyUntilSnapshot(&advisories, &summary, &tester);
+    BSLS_ASSERT_OPT(advisories.size() > 1);
+
+    // 2. Apply and commit more advisories
+    bmqp_ctrlmsg::QueueUnAssignmentAdvisory qUnassignedAdvisory(
+        bmqtst::TestHelperUtil::allocator());
+    tester.d_cluster_mp->_clusterData()
+        ->electorInfo()
+        .nextLeaderMessageSequence(&qUnassignedAdvisory.sequenceNumber());
+    qUnassignedAdvisory.queues().push_back(advisories.front().queues()[0]);
+
+    BSLS_ASSERT_OPT(obj->apply(qUnassignedAdvisory) == 0);
+    tester.receiveAck(obj, qUnassignedAdvisory.sequenceNumber(), quorum - 1);
+
+    const int k_NUM_NEW_QUEUES = 2;
+    for (int i = 0; i < k_NUM_NEW_QUEUES; ++i) {
+        const int queueId = static_cast<int>(advisories.size());
+        advisories.push_back(applyQueueAssignment(&tester, queueId));
+        tester.receiveAck(obj, advisories.back().sequenceNumber(), quorum - 1);
+    }
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), advisories.size() + 1);
+
+    // 3. Close and reopen the CSL
+    BSLS_ASSERT_OPT(obj->close() == 0);
+    BSLS_ASSERT_OPT(obj->open() == 0);
+
+    loadLedgerSummary(&summary, *obj);
+    BMQTST_ASSERT_EQ(summary.d_numSnapshots, 1);
+    BMQTST_ASSERT_GT(summary.d_snapshotIndex, 0);
+    BMQTST_ASSERT_EQ(summary.d_snapshotIndex,
+                     summary.d_numRecords - 2 * (1 + k_NUM_NEW_QUEUES) - 1);
+
+    // 4. Load a cluster state from the CSL and compare it
+    const mqbc::ClusterState& reference = *tester.d_cluster_mp->_state();
+    mqbc::ClusterState        state(tester.d_cluster_mp.get(),
+                                    reference.partitions().size(),
+                                    true,  // isTemporary
+                                    bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(
+        mqbc::ClusterUtil::load(&state,
+                                obj->getIterator().get(),
+                                *tester.d_cluster_mp->_clusterData(),
+                                bmqtst::TestHelperUtil::allocator()),
+        0);
+
+    bmqu::MemOutStream errorDescription(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ_D(errorDescription.str(),
+                       mqbc::ClusterUtil::validateState(errorDescription,
+                                                        state,
+                                                        reference),
+                       0);
+
+    bsl::vector<bmqp_ctrlmsg::QueueInfo> queues(
+        bmqtst::TestHelperUtil::allocator());
+    bsl::vector<bmqp_ctrlmsg::QueueInfo> expectedQueues(
+        bmqtst::TestHelperUtil::allocator());
+    mqbc::ClusterUtil::loadQueuesInfo(&queues, state);
+    mqbc::ClusterUtil::loadQueuesInfo(&expectedQueues, reference);
+    bsl::sort(queues.begin(), queues.end(), compareQueueInfo);
+    bsl::sort(expectedQueues.begin(), expectedQueues.end(), compareQueueInfo);
+
+    BMQTST_ASSERT_EQ(queues.size(), advisories.size() - 1);
+    BMQTST_ASSERT_EQ(queues.size(), expectedQueues.size());
+    for (size_t i = 0; i < queues.size() && i < expectedQueues.size(); ++i) {
+        BMQTST_ASSERT_EQ_D(i, queues[i], expectedQueues[i]);
+    }
+
+    BSLS_ASSERT_OPT(obj->close() == 0);
+}
+
+static void test18_perAdvisoryCommitsWithOlderPeers()
+// ------------------------------------------------------------------------
+// PER-ADVISORY COMMITS WITH OLDER PEERS
+//
+// Concerns:
+//   1. Unless all the available peers advertise the cumulative commit
+//      feature, an ack only acknowledges the advisory it refers to, and
+//      the advisories having reached the quorum are committed, in order,
+//      with one commit record each.
+//   2. Acks and commits become cumulative once all the peers advertise the
+//      feature.
+//
+// Testing:
+//   int apply(const bdlbb::Blob& record)  // for 'record' of type
+//                                         // 'e_ACK'
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PER-ADVISORY COMMITS WITH OLDER PEERS");
+
+    Tester                          tester;
+    mqbc::IncoreClusterStateLedger* obj = tester.d_clusterStateLedger_mp.get();
+    BSLS_ASSERT_OPT(obj->open() == 0);
+
+    const unsigned int quorum =
+        tester.d_cluster_mp->_clusterData()->quorumManager().quorum();
+    BSLS_ASSERT_OPT(quorum > 1);
+
+    // Only one of the peers supports cumulative commits.
+    tester.reconnectNode(mqbmock::Cluster::k_LEADER_NODE_ID + 1, true);
+
+    bsl::vector<bmqp_ctrlmsg::QueueAssignmentAdvisory> advisories(
+        bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < 3; ++i) {
+        advisories.push_back(applyQueueAssignment(&tester, i));
+    }
+
+    // 1. The ack of the second advisory does not acknowledge the first one,
+    //    so neither is committed.
+    tester.receiveAck(obj, advisories[1].sequenceNumber(), quorum - 1);
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 0U);
+
+    // The ack of the first advisory commits both, with one record each.
+    tester.receiveAck(obj, advisories[0].sequenceNumber(), quorum - 1);
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 2U);
+
+    tester.receiveAck(obj, advisories[2].sequenceNumber(), quorum - 1);
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 3U);
+
+    BMQTST_ASSERT(tester.hasBroadcastedMessages(6));
+    for (int i = 0; i < 3; ++i) {
+        const bmqp_ctrlmsg::ControlMessage commit =
+            tester.broadcastedMessage(3 + i);
+        BMQTST_ASSERT(commit.choice()
+                          .clusterMessage()
+                          .choice()
+                          .isLeaderAdvisoryCommitValue());
+        BMQTST_ASSERT_EQ(commit.choice()
+                             .clusterMessage()
+                             .choice()
+                             .leaderAdvisoryCommit()
+                             .sequenceNumberCommitted(),
+                         advisories[i].sequenceNumber());
+    }
+
+    // 2. All the peers support cumulative commits.
+    tester.reconnectPeers(true);
+
+    for (int i = 3; i < 6; ++i) {
+        advisories.push_back(applyQueueAssignment(&tester, i));
+    }
+
+    // The first ack of each peer after it reconnected is not cumulative.
+    tester.receiveAck(obj, advisories[3].sequenceNumber(), quorum - 1);
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 4U);
+
+    // A single commit record commits the last two advisories.
+    tester.receiveAck(obj, advisories[5].sequenceNumber(), quorum - 1);
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 6U);
+
+    BMQTST_ASSERT(tester.hasBroadcastedMessages(11));
+    const bmqp_ctrlmsg::ControlMessage commit = tester.broadcastedMessage(10);
+    BMQTST_ASSERT_EQ(commit.choice()
+                         .clusterMessage()
+                         .choice()
+                         .leaderAdvisoryCommit()
+                         .sequenceNumberCommitted(),
+                     advisories[5].sequenceNumber());
+
+    BSLS_ASSERT_OPT(obj->close() == 0);
+    BMQTST_ASSERT(tester.hasNoMoreBroadcastedMessages(11));
+}
+
+static void test19_ackedLsnsResetOnNodeDown()
+// ------------------------------------------------------------------------
+// ACKED LSNS RESET ON NODE DOWN
+//
+// Concerns:
+//   The highest LSN acked by a node is forgotten when the node goes down,
+//   so that its first ack after it comes back only acknowledges the
+//   advisory it refers to.
+//
+// Testing:
+//   void onNodeStateChange(mqbnet::ClusterNode* node, bool isAvailable);
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("ACKED LSNS RESET ON NODE DOWN");
+
+    Tester                          tester;
+    mqbc::IncoreClusterStateLedger* obj = tester.d_clusterStateLedger_mp.get();
+    BSLS_ASSERT_OPT(obj->open() == 0);
+    tester.reconnectPeers(true);
+
+    const int          k_DOWN_NODE_ID = mqbmock::Cluster::k_LEADER_NODE_ID + 1;
+    const unsigned int quorum =
+        tester.d_cluster_mp->_clusterData()->quorumManager().quorum();
+    const unsigned int nodesCount =
+        tester.d_cluster_mp->clusterConfig()->nodes().size();
+    BSLS_ASSERT_OPT(quorum > 1 && quorum < nodesCount);
+
+    // Commit a first advisory, acknowledged by the node going down.
+    bsl::vector<bmqp_ctrlmsg::QueueAssignmentAdvisory> advisories(
+        bmqtst::TestHelperUtil::allocator());
+    advisories.push_back(applyQueueAssignment(&tester, 0));
+    tester.receiveAck(obj, advisories[0].sequenceNumber(), quorum - 1);
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 1U);
+    BMQTST_ASSERT(tester.hasBroadcastedMessages(2));
+
+    tester.reconnectNode(k_DOWN_NODE_ID, true);
+
+    for (int i = 1; i <= 3; ++i) {
+        advisories.push_back(applyQueueAssignment(&tester, i));
+    }
+
+    // The ack of the last advisory from the node which went down does not
+    // acknowledge the previous ones, which do not reach the quorum.
+    tester.receiveAck(obj, advisories[3].sequenceNumber(), quorum - 1);
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 1U);
+
+    // Another node acknowledges them.
+    const int otherNodeId = mqbmock::Cluster::k_LEADER_NODE_ID +
+                            static_cast<int>(quorum);
+    tester.receiveAckFrom(obj, advisories[1].sequenceNumber(), otherNodeId);
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 2U);
+
+    tester.receiveAckFrom(obj, advisories[3].sequenceNumber(), otherNodeId);
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 4U);
+
+    BSLS_ASSERT_OPT(obj->close() == 0);
+}
+
+BSLA_MAYBE_UNUSED
+static void testN1_pipelinedCommitBenchmark()
+// ------------------------------------------------------------------------
+// PIPELINED COMMIT BENCHMARK
+//
+// Concerns:
+//   Measure the number of advisories committed per second by the leader
+//   depending on the number of advisories acknowledged by each cumulative
+//   ack of the followers, from one (lock-step) to many (pipelined).
+//
+// Plan:
+//   - For each window, apply a number of advisories and acknowledge them
+//     by window, and report the rate of committed advisories.
+//
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PIPELINED COMMIT BENCHMARK");
+
+    const int k_NUM_ADVISORIES = 10000;
+    const int k_WINDOWS[]      = {1, 16, 256};
+
+    for (size_t w = 0; w < sizeof(k_WINDOWS) / sizeof(*k_WINDOWS); ++w) {
+        Tester tester;
+        BSLS_ASSERT_OPT(tester.d_clusterStateLedger_mp->open() == 0);
+        tester.reconnectPeers(true);
+
+        const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+        applyPipelinedAdvisories(&tester, k_NUM_ADVISORIES, k_WINDOWS[w]);
+        const bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+        BMQTST_ASSERT_EQ(tester.numCommittedMessages(),
+                         static_cast<size_t>(k_NUM_ADVISORIES));
+
+        cout << "Window of " << k_WINDOWS[w] << " advisories: committed "
+             << k_NUM_ADVISORIES << " advisories in "
+             << bmqu::PrintUtil::prettyTimeInterval(end - begin) << ", i.e. "
+             << bmqu::PrintUtil::prettyNumber(static_cast<bsls::Types::Int64>(
+                    (k_NUM_ADVISORIES * 1000000000LL) / (end - begin)))
+             << " advisories per second.\n";
+
+        BSLS_ASSERT_OPT(tester.d_clusterStateLedger_mp->close() == 0);
+    }
+}
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void
+testN1_pipelinedCommitBenchmark_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// PIPELINED COMMIT BENCHMARK
+//
+// Concerns:
+//   Measure the number of advisories committed per second by the leader
+//   when the followers acknowledge them with one cumulative ack per window
+//   of `state.range(0)` advisories.
+//
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK PIPELINED COMMIT BENCHMARK");
+
+    const int k_NUM_ADVISORIES = 10000;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Tester tester;
+        BSLS_ASSERT_OPT(tester.d_clusterStateLedger_mp->open() == 0);
+        tester.reconnectPeers(true);
+        state.ResumeTiming();
+
+        applyPipelinedAdvisories(&tester,
+                                 k_NUM_ADVISORIES,
+                                 static_cast<int>(state.range(0)));
+
+        state.PauseTiming();
+        BSLS_ASSERT_OPT(tester.d_clusterStateLedger_mp->close() == 0);
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * k_NUM_ADVISORIES);
+}
+#endif  // BMQTST_BENCHMARK_ENABLED
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2355,6 +3166,12 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 19: test19_ackedLsnsResetOnNodeDown(); break;
+    case 18: test18_perAdvisoryCommitsWithOlderPeers(); break;
+    case 17: test17_reloadFromPeriodicSnapshot(); break;
+    case 16: test16_snapshotSkippedWhileUncommitted(); break;
+    case 15: test15_periodicSnapshot(); break;
+    case 14: test14_cumulativeAcks(); break;
     case 13: test13_quorumChangeCb(); break;
     // @TODO RENABLE AND FIX THIS TEST
     //
@@ -2372,12 +3189,25 @@ int main(int argc, char* argv[])
     case 3: test3_apply_QueueAssignmentAdvisory(); break;
     case 2: test2_apply_PartitionPrimaryAdvisory(); break;
     case 1: test1_breathingTest(); break;
+    case -1:
+        BMQTST_BENCHMARK_WITH_ARGS(testN1_pipelinedCommitBenchmark,
+                                   RangeMultiplier(4)
+                                       ->Range(1, 256)
+                                       ->Unit(benchmark::kMillisecond));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND.\n";
         bmqtst::TestHelperUtil::testStatus() = -1;
     } break;
     }
 
+#ifdef BMQTST_BENCHMARK_ENABLED
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
     bmqu::Time::shutdown();
 
     TEST_EPILOG(bmqtst::TestHelper::e_CHECK_GBL_ALLOC);
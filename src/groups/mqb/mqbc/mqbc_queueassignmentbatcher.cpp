@@ -0,0 +1,340 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbc_queueassignmentbatcher.h>
+
+#include <mqbscm_version.h>
+// MQB
+#include <mqbc_clusterutil.h>
+#include <mqbc_electorinfo.h>
+#include <mqbcfg_messages.h>
+#include <mqbi_dispatcher.h>
+#include <mqbstat_clusterstats.h>
+#include <mqbu_storagekey.h>
+
+// BMQ
+#include <bmqtsk_alarmlog.h>
+#include <bmqu_time.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bsls_assert.h>
+#include <bsls_timeinterval.h>
+
+namespace BloombergLP {
+namespace mqbc {
+
+// ----------------------------
+// class QueueAssignmentBatcher
+// ----------------------------
+
+// PRIVATE MANIPULATORS
+void QueueAssignmentBatcher::onFlushTimer(int generation)
+{
+    // executed by the *SCHEDULER* thread
+
+    d_cluster_p->dispatcher()->execute(
+        bdlf::BindUtil::bind(&QueueAssignmentBatcher::onFlushTimerDispatched,
+                             this,
+                             generation),
+        d_cluster_p);
+}
+
+void QueueAssignmentBatcher::onFlushTimerDispatched(int generation)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_cluster_p->inDispatcherThread());
+
+    if (generation != d_generation) {
+        // Batch was already flushed or cancelled.
+        return;  // RETURN
+    }
+
+    flush();
+}
+
+void QueueAssignmentBatcher::revertBatch()
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_cluster_p->inDispatcherThread());
+    BSLS_ASSERT_SAFE(d_advisory.queues().size() == d_startTimes.size());
+    BSLS_ASSERT_SAFE(d_advisory.queues().size() == d_previousStates.size());
+
+    for (size_t i = 0; i < d_advisory.queues().size(); ++i) {
+        const bmqp_ctrlmsg::QueueInfo& queueInfo = d_advisory.queues()[i];
+        const bmqt::Uri                uri(queueInfo.uri(), d_allocator_p);
+
+        // Release the key reserved for the queue.
+        d_state_p->queueKeys().erase(
+            mqbu::StorageKey(mqbu::StorageKey::BinaryRepresentation(),
+                             queueInfo.key().data()));
+
+        ClusterState::DomainStatesIter domIt = d_state_p->domainStates().find(
+            uri.qualifiedDomain());
+        if (domIt == d_state_p->domainStates().end()) {
+            continue;  // CONTINUE
+        }
+
+        ClusterState::UriToQueueInfoMapIter queueIt =
+            domIt->second->queuesInfo().find(uri);
+        if (queueIt == domIt->second->queuesInfo().end() ||
+            queueIt->second->state() !=
+                ClusterStateQueueInfo::State::k_ASSIGNING) {
+            continue;  // CONTINUE
+        }
+
+        BALL_LOG_INFO << d_clusterData_p->identity().description()
+                      << ": Transition: "
+                      << ClusterStateQueueInfo::State::k_ASSIGNING << " -> "
+                      << d_previousStates[i] << " for [" << uri << "].";
+
+        if (d_previousStates[i] == ClusterStateQueueInfo::State::k_NONE) {
+            domIt->second->queuesInfo().erase(queueIt);
+        }
+        else {
+            queueIt->second->setState(d_previousStates[i]);
+        }
+    }
+
+    d_advisory.queues().clear();
+    d_startTimes.clear();
+    d_previousStates.clear();
+}
+
+// CREATORS
+QueueAssignmentBatcher::QueueAssignmentBatcher(
+    mqbi::Cluster*      cluster,
+    ClusterData*        clusterData,
+    ClusterState*       clusterState,
+    ClusterStateLedger* ledger,
+    bslma::Allocator*   allocator)
+: d_allocator_p(allocator)
+, d_cluster_p(cluster)
+, d_clusterData_p(clusterData)
+, d_state_p(clusterState)
+, d_ledger_p(ledger)
+, d_advisory(allocator)
+, d_startTimes(allocator)
+, d_previousStates(allocator)
+, d_inFlight(allocator)
+, d_flushEventHandle()
+, d_generation(0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_allocator_p);
+    BSLS_ASSERT_SAFE(d_cluster_p);
+    BSLS_ASSERT_SAFE(d_clusterData_p);
+    BSLS_ASSERT_SAFE(d_state_p);
+    BSLS_ASSERT_SAFE(d_ledger_p);
+}
+
+QueueAssignmentBatcher::~QueueAssignmentBatcher()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_advisory.queues().empty() && "cancel() not called");
+}
+
+// MANIPULATORS
+bool QueueAssignmentBatcher::assignQueue(const bmqt::Uri&      uri,
+                                         bmqp_ctrlmsg::Status* status)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_cluster_p->inDispatcherThread());
+    BSLS_ASSERT_SAFE(d_ledger_p->isOpen());
+
+    const ClusterStateQueueInfo* previousInfo = d_state_p->getQueueInfo(uri);
+    const ClusterStateQueueInfo::State::Enum previousState =
+        previousInfo ? previousInfo->state()
+                     : ClusterStateQueueInfo::State::k_NONE;
+
+    bool isAppended = false;
+    if (!ClusterUtil::prepareQueueAssignment(&d_advisory,
+                                             &isAppended,
+                                             d_state_p,
+                                             d_clusterData_p,
+                                             d_cluster_p,
+                                             uri,
+                                             d_allocator_p,
+                                             status)) {
+        // Permanent failure, cannot continue
+        return false;  // RETURN
+    }
+
+    if (!isAppended) {
+        return true;  // RETURN
+    }
+
+    d_startTimes.push_back(bmqu::Time::highResolutionTimer());
+    d_previousStates.push_back(previousState);
+
+    const mqbcfg::QueueOperationsConfig& config =
+        d_clusterData_p->clusterConfig().queueOperations();
+
+    if (d_advisory.queues().size() >=
+        static_cast<size_t>(config.assignmentBatchMaxSize())) {
+        flush();
+    }
+    else if (d_advisory.queues().size() == 1) {
+        // First queue of the batch: schedule its flush.
+        d_flushEventHandle.release();
+        d_clusterData_p->scheduler().scheduleEvent(
+            &d_flushEventHandle,
+            d_clusterData_p->scheduler().now() +
+                bsls::TimeInterval().addMilliseconds(
+                    config.assignmentBatchWindowMs()),
+            bdlf::BindUtil::bind(&QueueAssignmentBatcher::onFlushTimer,
+                                 this,
+                                 d_generation));
+    }
+
+    return true;
+}
+
+void QueueAssignmentBatcher::flush()
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_cluster_p->inDispatcherThread());
+
+    // Invalidate the scheduled flush of the batch, if any.
+    ++d_generation;
+    d_clusterData_p->scheduler().cancelEvent(d_flushEventHandle);
+
+    if (d_advisory.queues().empty()) {
+        return;  // RETURN
+    }
+
+    if (!d_clusterData_p->electorInfo().isSelfActiveLeader() ||
+        !d_ledger_p->isOpen()) {
+        BMQTSK_ALARMLOG_ALARM("CLUSTER")
+            << d_clusterData_p->identity().description()
+            << ": Dropping the assignment of " << d_advisory.queues().size()
+            << " queues because self is no longer the active leader."
+            << BMQTSK_ALARMLOG_END;
+
+        revertBatch();
+        return;  // RETURN
+    }
+
+    d_clusterData_p->electorInfo().nextLeaderMessageSequence(
+        &d_advisory.sequenceNumber());
+
+    // 'ClusterQueueHelper::onQueueAssigned' (the 'onQueueAssigned' observer
+    // callback) will insert the keys to 'ClusterState::queueKeys'.
+    for (size_t i = 0; i < d_advisory.queues().size(); ++i) {
+        d_state_p->queueKeys().erase(
+            mqbu::StorageKey(mqbu::StorageKey::BinaryRepresentation(),
+                             d_advisory.queues()[i].key().data()));
+    }
+
+    BALL_LOG_INFO << d_clusterData_p->identity().description()
+                  << ": 'QueueAssignmentAdvisory' for "
+                  << d_advisory.queues().size()
+                  << " queues will be applied to cluster state ledger: "
+                  << d_advisory;
+
+    const int rc = d_ledger_p->apply(d_advisory);
+    if (rc != 0) {
+        BMQTSK_ALARMLOG_ALARM("CLUSTER")
+            << d_clusterData_p->identity().description()
+            << ": Failed to apply queue assignment advisory: " << d_advisory
+            << ", rc: " << rc << BMQTSK_ALARMLOG_END;
+
+        revertBatch();
+        return;  // RETURN
+    }
+
+    d_clusterData_p->stats().setQueueAssignmentsPerAdvisory(
+        d_advisory.queues().size());
+
+    d_inFlight.resize(d_inFlight.size() + 1);
+    d_inFlight.back().first = d_advisory.sequenceNumber();
+    d_inFlight.back().second.swap(d_startTimes);
+
+    d_advisory.queues().clear();
+    d_startTimes.clear();
+    d_previousStates.clear();
+}
+
+void QueueAssignmentBatcher::onCommit(
+    const bmqp_ctrlmsg::ControlMessage&        advisory,
+    mqbc::ClusterStateLedgerCommitStatus::Enum status)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_cluster_p->inDispatcherThread());
+
+    if (d_inFlight.empty() || !advisory.choice().isClusterMessageValue() ||
+        !advisory.choice()
+             .clusterMessage()
+             .choice()
+             .isQueueAssignmentAdvisoryValue()) {
+        return;  // RETURN
+    }
+
+    const bmqp_ctrlmsg::LeaderMessageSequence& sequenceNumber =
+        advisory.choice()
+            .clusterMessage()
+            .choice()
+            .queueAssignmentAdvisory()
+            .sequenceNumber();
+
+    // Advisories are committed in the order they are applied: discard the
+    // in-flight advisories which precede the committed one, as they will
+    // never be committed.
+    while (!d_inFlight.empty() && d_inFlight.front().first < sequenceNumber) {
+        d_inFlight.pop_front();
+    }
+
+    if (d_inFlight.empty() || d_inFlight.front().first != sequenceNumber) {
+        return;  // RETURN
+    }
+
+    if (status == mqbc::ClusterStateLedgerCommitStatus::e_SUCCESS) {
+        const bsls::Types::Int64 now = bmqu::Time::highResolutionTimer();
+        const StartTimes&        startTimes = d_inFlight.front().second;
+        for (size_t i = 0; i < startTimes.size(); ++i) {
+            d_clusterData_p->stats().setQueueAssignmentTime(now -
+                                                            startTimes[i]);
+        }
+    }
+
+    d_inFlight.pop_front();
+}
+
+void QueueAssignmentBatcher::cancel()
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_cluster_p->inDispatcherThread());
+
+    ++d_generation;
+    d_clusterData_p->scheduler().cancelEventAndWait(&d_flushEventHandle);
+
+    revertBatch();
+    d_inFlight.clear();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
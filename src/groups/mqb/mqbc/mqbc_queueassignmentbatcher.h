@@ -0,0 +1,260 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MQBC_QUEUEASSIGNMENTBATCHER
+#define INCLUDED_MQBC_QUEUEASSIGNMENTBATCHER
+
+/// @file mqbc_queueassignmentbatcher.h
+///
+/// @brief Coalesce queue assignments of the leader into batched advisories.
+///
+/// @bbref{mqbc::QueueAssignmentBatcher} is a mechanism used by the leader
+/// node of a cluster to assign queues.  Rather than applying one
+/// `QueueAssignmentAdvisory` to the cluster state ledger (CSL) per queue, the
+/// assignments requested during a short window are accumulated in a single
+/// advisory, so that one CSL commit covers all of them.
+///
+/// Batching                             {#mqbc_queueassignmentbatcher_batch}
+/// ========
+///
+/// The first assignment added to an empty batch schedules a flush of the
+/// batch `assignmentBatchWindowMs` milliseconds later; the batch is flushed
+/// immediately once it contains `assignmentBatchMaxSize` queues.  Both values
+/// are read from the `queueOperations` configuration of the cluster each time
+/// an assignment is added, and default to 5 milliseconds and 512 queues: the
+/// window is short compared to the round-trip of a CSL commit, and an
+/// advisory of 512 queues remains far below the maximum size of a control
+/// message.  Until the batch is flushed, the queues it contains are in the
+/// `k_ASSIGNING` state, so that subsequent assignments of the same queue are
+/// no-ops, and the partition of each queue is chosen accounting for the queues
+/// already in the batch.
+///
+/// Failure                            {#mqbc_queueassignmentbatcher_failure}
+/// =======
+///
+/// The validation of a queue assignment (domain creation, queue limits) is
+/// performed when the queue is added to the batch, and its permanent failure
+/// is reported synchronously.  If the batch cannot be applied to the CSL when
+/// it is flushed, for example because self is no longer the active leader,
+/// the queues of the batch are reverted to the state they were in before
+/// being added to the batch, and will be assigned again by the next leader.
+///
+/// Metrics                            {#mqbc_queueassignmentbatcher_metrics}
+/// =======
+///
+/// The number of queues of each applied advisory, and the time from the
+/// request of each queue assignment to the commit of its advisory, are
+/// reported to the stats of the cluster.
+///
+/// Thread Safety                       {#mqbc_queueassignmentbatcher_thread}
+/// =============
+///
+/// This object must be manipulated from the cluster's dispatcher thread.
+
+// MQB
+#include <mqbc_clusterdata.h>
+#include <mqbc_clusterstate.h>
+#include <mqbc_clusterstateledger.h>
+#include <mqbi_cluster.h>
+
+// BMQ
+#include <bmqp_ctrlmsg_messages.h>
+#include <bmqt_uri.h>
+
+// BDE
+#include <ball_log.h>
+#include <bdlmt_eventscheduler.h>
+#include <bsl_deque.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbc {
+
+// ============================
+// class QueueAssignmentBatcher
+// ============================
+
+/// Mechanism coalescing the queue assignments of the leader into batched
+/// queue assignment advisories.
+class QueueAssignmentBatcher {
+  private:
+    // CLASS-SCOPE CATEGORY
+    BALL_LOG_SET_CLASS_CATEGORY("MQBC.QUEUEASSIGNMENTBATCHER");
+
+  private:
+    // PRIVATE TYPES
+
+    /// Times, in nanoseconds, at which the assignments of the queues of an
+    /// advisory were requested, in the order of the queues.
+    typedef bsl::vector<bsls::Types::Int64> StartTimes;
+
+    /// States of the queues of an advisory prior to being added to it, in
+    /// the order of the queues.
+    typedef bsl::vector<ClusterStateQueueInfo::State::Enum> PreviousStates;
+
+    /// Advisory applied to the CSL and pending commit, identified by its
+    /// sequence number.
+    typedef bsl::pair<bmqp_ctrlmsg::LeaderMessageSequence, StartTimes>
+        InFlightAdvisory;
+
+    typedef bsl::deque<InFlightAdvisory> InFlightAdvisories;
+
+  private:
+    // DATA
+
+    /// Allocator used to supply memory.
+    bslma::Allocator* d_allocator_p;
+
+    /// Associated cluster.
+    mqbi::Cluster* d_cluster_p;
+
+    /// Associated non-persistent cluster data.
+    ClusterData* d_clusterData_p;
+
+    /// Associated cluster state.
+    ClusterState* d_state_p;
+
+    /// Cluster state ledger to which the advisories are applied.
+    ClusterStateLedger* d_ledger_p;
+
+    /// Advisory accumulating the queue assignments of the current batch.
+    /// Its sequence number is populated when the batch is flushed.
+    bmqp_ctrlmsg::QueueAssignmentAdvisory d_advisory;
+
+    /// Request times of the queues of `d_advisory`.
+    StartTimes d_startTimes;
+
+    /// States of the queues of `d_advisory` to revert to if the batch
+    /// cannot be applied.
+    PreviousStates d_previousStates;
+
+    /// Advisories applied to the CSL and not yet committed, in the order
+    /// they were applied.
+    InFlightAdvisories d_inFlight;
+
+    /// Handle to the scheduled flush of the current batch, if any.
+    bdlmt::EventSchedulerEventHandle d_flushEventHandle;
+
+    /// Generation of the current batch, used to ignore the stale scheduled
+    /// flushes of the batches already flushed or cancelled.
+    int d_generation;
+
+  private:
+    // NOT IMPLEMENTED
+    QueueAssignmentBatcher(const QueueAssignmentBatcher&)
+        BSLS_KEYWORD_DELETED;
+    QueueAssignmentBatcher&
+    operator=(const QueueAssignmentBatcher&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Invoked by the scheduler when the window of the batch having the
+    /// specified `generation` expires.
+    ///
+    /// THREAD: This method is invoked in the scheduler's dispatcher thread.
+    void onFlushTimer(int generation);
+
+    /// Flush the current batch if it has the specified `generation`.
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    void onFlushTimerDispatched(int generation);
+
+    /// Revert the queues of the current batch to their state prior to being
+    /// added to the batch, and clear the batch.
+    void revertBatch();
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(QueueAssignmentBatcher,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an instance assigning the queues of the specified `cluster`
+    /// having the specified `clusterData` and `clusterState`, by applying
+    /// advisories to the specified `ledger`.  Use the specified `allocator`
+    /// for memory allocations.
+    QueueAssignmentBatcher(mqbi::Cluster*      cluster,
+                           ClusterData*        clusterData,
+                           ClusterState*       clusterState,
+                           ClusterStateLedger* ledger,
+                           bslma::Allocator*   allocator);
+
+    /// Destroy this object.  The behavior is undefined unless the batch is
+    /// empty, see `cancel`.
+    ~QueueAssignmentBatcher();
+
+    // MANIPULATORS
+
+    /// Add the assignment of the queue having the specified `uri` to the
+    /// current batch.  Return `false`, populating the specified `status`, in
+    /// the case of permanent failure, and `true` otherwise.  See
+    /// `ClusterUtil::assignQueue`.  This method is called only on the leader
+    /// node.
+    bool assignQueue(const bmqt::Uri& uri, bmqp_ctrlmsg::Status* status);
+
+    /// Apply the current batch, if not empty, to the CSL.
+    void flush();
+
+    /// Notify this object that the specified `advisory` was committed, or
+    /// failed to be committed, with the specified `status`.
+    void onCommit(const bmqp_ctrlmsg::ControlMessage&        advisory,
+                  mqbc::ClusterStateLedgerCommitStatus::Enum status);
+
+    /// Cancel the scheduled flush, revert the queues of the current batch,
+    /// and forget the advisories pending commit.
+    void cancel();
+
+    // ACCESSORS
+
+    /// Return the number of queues in the current batch.
+    int numPending() const;
+
+    /// Return the number of advisories applied to the CSL and not yet
+    /// committed.
+    int numInFlight() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ----------------------------
+// class QueueAssignmentBatcher
+// ----------------------------
+
+// ACCESSORS
+inline int QueueAssignmentBatcher::numPending() const
+{
+    return static_cast<int>(d_advisory.queues().size());
+}
+
+inline int QueueAssignmentBatcher::numInFlight() const
+{
+    return static_cast<int>(d_inFlight.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,546 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbc_queueassignmentbatcher.h>
+
+// MQB
+#include <mqbc_clusterdata.h>
+#include <mqbc_clusterstate.h>
+#include <mqbc_clusterstateledger.h>
+#include <mqbc_clusterutil.h>
+#include <mqbc_electorinfo.h>
+#include <mqbcfg_messages.h>
+#include <mqbconfm_messages.h>
+#include <mqbi_dispatcher.h>
+#include <mqbmock_cluster.h>
+#include <mqbmock_clusterstateledger.h>
+#include <mqbmock_domain.h>
+#include <mqbnet_cluster.h>
+#include <mqbnet_elector.h>
+
+// BMQ
+#include <bmqp_ctrlmsg_messages.h>
+#include <bmqt_uri.h>
+#include <bmqu_memoutstream.h>
+#include <bmqu_tempdirectory.h>
+#include <bmqu_time.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bsl_algorithm.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_managedptr.h>
+#include <bsls_assert.h>
+#include <bsls_timeinterval.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+// CONSTANTS
+static const char k_DOMAIN[] = "bmq.test.mem.priority";
+
+// TYPES
+typedef mqbc::ClusterStateLedger::ClusterMessageCRefList
+    ClusterMessageCRefList;
+
+// =============
+// struct Tester
+// =============
+
+/// This class provides the mock cluster, ledger and domain necessary to
+/// test the queue assignment batcher of the leader in isolation.
+struct Tester {
+  public:
+    // PUBLIC DATA
+    bmqu::TempDirectory                             d_tempDir;
+    bslma::ManagedPtr<mqbmock::Cluster>             d_cluster_mp;
+    bslma::ManagedPtr<mqbmock::Domain>              d_domain_mp;
+    bslma::ManagedPtr<mqbmock::ClusterStateLedger>  d_ledger_mp;
+    bslma::ManagedPtr<mqbc::QueueAssignmentBatcher> d_batcher_mp;
+
+  public:
+    // CREATORS
+    Tester()
+    : d_tempDir(bmqtst::TestHelperUtil::allocator())
+    , d_cluster_mp(0)
+    , d_domain_mp(0)
+    , d_ledger_mp(0)
+    , d_batcher_mp(0)
+    {
+        bmqu::Time::initialize(bmqtst::TestHelperUtil::allocator());
+
+        // Create the cluster, self being the leader
+        mqbmock::Cluster::ClusterNodeDefs clusterNodeDefs(
+            bmqtst::TestHelperUtil::allocator());
+        mqbc::ClusterUtil::appendClusterNode(
+            &clusterNodeDefs,
+            "E1",
+            "US-EAST",
+            41234,
+            mqbmock::Cluster::k_LEADER_NODE_ID,
+            bmqtst::TestHelperUtil::allocator());
+        mqbc::ClusterUtil::appendClusterNode(
+            &clusterNodeDefs,
+            "E2",
+            "US-EAST",
+            41235,
+            mqbmock::Cluster::k_LEADER_NODE_ID + 1,
+            bmqtst::TestHelperUtil::allocator());
+        mqbc::ClusterUtil::appendClusterNode(
+            &clusterNodeDefs,
+            "W1",
+            "US-WEST",
+            41236,
+            mqbmock::Cluster::k_LEADER_NODE_ID + 2,
+            bmqtst::TestHelperUtil::allocator());
+
+        d_cluster_mp.load(
+            new (*bmqtst::TestHelperUtil::allocator())
+                mqbmock::Cluster(bmqtst::TestHelperUtil::allocator(),
+                                 true,   // isClusterMember
+                                 true,   // isLeader
+                                 true,   // isFSMWorkflow
+                                 false,  // doesFSMwriteQLIST
+                                 clusterNodeDefs,
+                                 "testCluster",
+                                 d_tempDir.path()),
+            bmqtst::TestHelperUtil::allocator());
+
+        d_cluster_mp->_clusterData()->stats().setIsMember(true);
+
+        // To pass `inDispatcherThread` checks (allow ANY thread):
+        d_cluster_mp->setThreadId(mqbi::DispatcherClient::k_ANY_THREAD_ID);
+
+        bmqu::MemOutStream errorDescription;
+        int                rc = d_cluster_mp->start(errorDescription);
+        BSLS_ASSERT_OPT(rc == 0);
+
+        // Create the domain of the queues
+        d_domain_mp.load(
+            new (*bmqtst::TestHelperUtil::allocator())
+                mqbmock::Domain(d_cluster_mp.get(),
+                                bmqtst::TestHelperUtil::allocator()),
+            bmqtst::TestHelperUtil::allocator());
+
+        mqbconfm::Domain domainConfig(bmqtst::TestHelperUtil::allocator());
+        domainConfig.mode().makePriority();
+        rc = d_domain_mp->configure(errorDescription, domainConfig);
+        BSLS_ASSERT_OPT(rc == 0);
+
+        d_cluster_mp->_state()->getDomainState(k_DOMAIN).setDomain(
+            d_domain_mp.get());
+
+        // Create and open the cluster state ledger
+        d_ledger_mp.load(new (*bmqtst::TestHelperUtil::allocator())
+                             mqbmock::ClusterStateLedger(
+                                 d_cluster_mp->_clusterData(),
+                                 bmqtst::TestHelperUtil::allocator()),
+                         bmqtst::TestHelperUtil::allocator());
+        rc = d_ledger_mp->open();
+        BSLS_ASSERT_OPT(rc == 0);
+
+        // Create the batcher
+        d_batcher_mp.load(new (*bmqtst::TestHelperUtil::allocator())
+                              mqbc::QueueAssignmentBatcher(
+                                  d_cluster_mp.get(),
+                                  d_cluster_mp->_clusterData(),
+                                  d_cluster_mp->_state(),
+                                  d_ledger_mp.get(),
+                                  bmqtst::TestHelperUtil::allocator()),
+                          bmqtst::TestHelperUtil::allocator());
+
+        d_ledger_mp->setCommitCb(
+            bdlf::BindUtil::bind(&mqbc::QueueAssignmentBatcher::onCommit,
+                                 d_batcher_mp.get(),
+                                 bdlf::PlaceHolders::_1,    // advisory
+                                 bdlf::PlaceHolders::_2));  // status
+
+        setSelfActiveLeader();
+    }
+
+    ~Tester()
+    {
+        d_batcher_mp->cancel();
+        d_batcher_mp.reset();
+
+        d_ledger_mp->close();
+        d_ledger_mp.reset();
+
+        d_cluster_mp->_state()->domainStates().clear();
+        d_domain_mp.reset();
+
+        d_cluster_mp->stop();
+
+        bmqu::Time::shutdown();
+    }
+
+    // MANIPULATORS
+
+    /// Make self the ACTIVE leader of the cluster.
+    void setSelfActiveLeader()
+    {
+        mqbnet::ClusterNode* selfNode = d_cluster_mp->netCluster().lookupNode(
+            mqbmock::Cluster::k_LEADER_NODE_ID);
+        BSLS_ASSERT_OPT(selfNode != 0);
+
+        // It is prohibited to set leader status directly from e_UNDEFINED to
+        // e_ACTIVE.
+        d_cluster_mp->_clusterData()->electorInfo().setElectorInfo(
+            mqbnet::ElectorState::e_LEADER,
+            1,
+            selfNode,
+            mqbc::ElectorInfoLeaderStatus::e_PASSIVE);
+        d_cluster_mp->_clusterData()->electorInfo().setElectorInfo(
+            mqbnet::ElectorState::e_LEADER,
+            1,
+            selfNode,
+            mqbc::ElectorInfoLeaderStatus::e_ACTIVE);
+    }
+
+    /// Add the assignment of the queue having the specified `name` to the
+    /// batch, and return the result.
+    bool assignQueue(const bsl::string& name)
+    {
+        bmqu::MemOutStream uriStr(bmqtst::TestHelperUtil::allocator());
+        uriStr << "bmq://" << k_DOMAIN << "/" << name;
+        bmqt::Uri uri(uriStr.str(), bmqtst::TestHelperUtil::allocator());
+
+        bmqp_ctrlmsg::Status status(bmqtst::TestHelperUtil::allocator());
+        status.category() = bmqp_ctrlmsg::StatusCategory::E_SUCCESS;
+
+        return d_batcher_mp->assignQueue(uri, &status);
+    }
+
+    /// Make the scheduled flush of the batch, if any, fire.
+    void expireBatchWindow()
+    {
+        d_cluster_mp->advanceTime(bsls::TimeInterval().addMilliseconds(
+            queueOperationsConfig().assignmentBatchWindowMs()));
+        d_cluster_mp->waitForScheduler();
+    }
+
+    /// Return a reference to the modifiable queue operations configuration
+    /// of the cluster.
+    mqbcfg::QueueOperationsConfig& queueOperationsConfig()
+    {
+        return d_cluster_mp->_clusterData()->clusterConfig().queueOperations();
+    }
+
+    // ACCESSORS
+
+    /// Return the state of the queue having the specified `name`, or
+    /// `k_NONE` if the queue is unknown.
+    mqbc::ClusterStateQueueInfo::State::Enum
+    queueState(const bsl::string& name) const
+    {
+        bmqu::MemOutStream uriStr(bmqtst::TestHelperUtil::allocator());
+        uriStr << "bmq://" << k_DOMAIN << "/" << name;
+        bmqt::Uri uri(uriStr.str(), bmqtst::TestHelperUtil::allocator());
+
+        const mqbc::ClusterStateQueueInfo* info =
+            d_cluster_mp->_state()->getQueueInfo(uri);
+        return info ? info->state()
+                    : mqbc::ClusterStateQueueInfo::State::k_NONE;
+    }
+
+    /// Load into the specified `advisories` the advisories applied to the
+    /// ledger and not yet committed.
+    void uncommitted(ClusterMessageCRefList* advisories) const
+    {
+        d_ledger_mp->uncommittedAdvisories(advisories);
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise basic functionality before beginning testing in earnest.
+//
+// Testing:
+//   Basic functionality
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    Tester tester;
+
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numPending(), 0);
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numInFlight(), 0);
+
+    // Flushing an empty batch applies nothing
+    tester.d_batcher_mp->flush();
+
+    ClusterMessageCRefList advisories(bmqtst::TestHelperUtil::allocator());
+    tester.uncommitted(&advisories);
+    BMQTST_ASSERT(advisories.empty());
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numInFlight(), 0);
+}
+
+static void test2_batchingWindow()
+// ------------------------------------------------------------------------
+// BATCHING WINDOW
+//
+// Concerns:
+//   1. The assignments requested during the batch window are applied to
+//      the ledger as a single advisory once the window expires.
+//   2. Assigning a queue already in the batch is a no-op.
+//   3. The queues of a batch are balanced across the partitions.
+//   4. The advisory is no longer in flight once committed.
+//
+// Testing:
+//   assignQueue
+//   onCommit
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BATCHING WINDOW");
+
+    Tester tester;
+
+    const int k_NUM_QUEUES  = 12;
+    const int numPartitions = static_cast<int>(
+        tester.d_cluster_mp->_state()->partitions().size());
+
+    for (int i = 0; i < k_NUM_QUEUES; ++i) {
+        bmqu::MemOutStream name(bmqtst::TestHelperUtil::allocator());
+        name << "queue" << i;
+        BMQTST_ASSERT(tester.assignQueue(name.str()));
+        BMQTST_ASSERT_EQ(tester.queueState(name.str()),
+                         mqbc::ClusterStateQueueInfo::State::k_ASSIGNING);
+    }
+
+    // Duplicate assignment
+    BMQTST_ASSERT(tester.assignQueue("queue0"));
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numPending(), k_NUM_QUEUES);
+
+    // Nothing is applied until the window expires
+    ClusterMessageCRefList advisories(bmqtst::TestHelperUtil::allocator());
+    tester.uncommitted(&advisories);
+    BMQTST_ASSERT(advisories.empty());
+
+    tester.expireBatchWindow();
+
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numPending(), 0);
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numInFlight(), 1);
+
+    tester.uncommitted(&advisories);
+    BMQTST_ASSERT_EQ(advisories.size(), 1U);
+    BMQTST_ASSERT(
+        advisories.front().get().choice().isQueueAssignmentAdvisoryValue());
+
+    const bmqp_ctrlmsg::QueueAssignmentAdvisory& advisory =
+        advisories.front().get().choice().queueAssignmentAdvisory();
+    BMQTST_ASSERT_EQ(static_cast<int>(advisory.queues().size()),
+                     k_NUM_QUEUES);
+
+    bsl::vector<int> numQueues(numPartitions,
+                               0,
+                               bmqtst::TestHelperUtil::allocator());
+    for (size_t i = 0; i < advisory.queues().size(); ++i) {
+        ++numQueues[advisory.queues()[i].partitionId()];
+    }
+    BMQTST_ASSERT_LE(*bsl::max_element(numQueues.begin(), numQueues.end()) -
+                         *bsl::min_element(numQueues.begin(), numQueues.end()),
+                     1);
+
+    tester.d_ledger_mp->_commitAdvisories(
+        mqbc::ClusterStateLedgerCommitStatus::e_SUCCESS);
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numInFlight(), 0);
+}
+
+static void test3_maxBatchSize()
+// ------------------------------------------------------------------------
+// MAX BATCH SIZE
+//
+// Concerns:
+//   1. A batch reaching the maximum size is applied immediately, without
+//      waiting for the window to expire.
+//   2. The maximum size and the window are read from the configuration of
+//      the cluster.
+//
+// Testing:
+//   assignQueue
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("MAX BATCH SIZE");
+
+    Tester tester;
+
+    // 1. Default configuration
+    const int k_DEFAULT_MAX_BATCH_SIZE =
+        mqbcfg::QueueOperationsConfig::
+            DEFAULT_INITIALIZER_ASSIGNMENT_BATCH_MAX_SIZE;
+    BMQTST_ASSERT_EQ(tester.queueOperationsConfig().assignmentBatchMaxSize(),
+                     k_DEFAULT_MAX_BATCH_SIZE);
+
+    const int k_NUM_QUEUES = k_DEFAULT_MAX_BATCH_SIZE + 1;
+
+    for (int i = 0; i < k_NUM_QUEUES; ++i) {
+        bmqu::MemOutStream name(bmqtst::TestHelperUtil::allocator());
+        name << "queue" << i;
+        BMQTST_ASSERT(tester.assignQueue(name.str()));
+    }
+
+    ClusterMessageCRefList advisories(bmqtst::TestHelperUtil::allocator());
+    tester.uncommitted(&advisories);
+    BMQTST_ASSERT_EQ(advisories.size(), 1U);
+    BMQTST_ASSERT_EQ(static_cast<int>(advisories.front()
+                                          .get()
+                                          .choice()
+                                          .queueAssignmentAdvisory()
+                                          .queues()
+                                          .size()),
+                     k_DEFAULT_MAX_BATCH_SIZE);
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numPending(), 1);
+
+    tester.expireBatchWindow();
+
+    tester.uncommitted(&advisories);
+    BMQTST_ASSERT_EQ(advisories.size(), 2U);
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numPending(), 0);
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numInFlight(), 2);
+
+    tester.d_ledger_mp->_commitAdvisories(
+        mqbc::ClusterStateLedgerCommitStatus::e_SUCCESS);
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numInFlight(), 0);
+
+    // 2. Custom configuration
+    const int                      k_MAX_BATCH_SIZE = 4;
+    mqbcfg::QueueOperationsConfig& config = tester.queueOperationsConfig();
+    config.assignmentBatchMaxSize()       = k_MAX_BATCH_SIZE;
+    config.assignmentBatchWindowMs()      = 50;
+
+    const int numQueues = 2 * k_MAX_BATCH_SIZE + 1;
+    for (int i = 0; i < numQueues; ++i) {
+        bmqu::MemOutStream name(bmqtst::TestHelperUtil::allocator());
+        name << "custom" << i;
+        BMQTST_ASSERT(tester.assignQueue(name.str()));
+    }
+
+    tester.uncommitted(&advisories);
+    BMQTST_ASSERT_EQ(advisories.size(), 2U);
+    for (size_t i = 0; i < advisories.size(); ++i) {
+        BMQTST_ASSERT_EQ(static_cast<int>(advisories[i]
+                                              .get()
+                                              .choice()
+                                              .queueAssignmentAdvisory()
+                                              .queues()
+                                              .size()),
+                         k_MAX_BATCH_SIZE);
+    }
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numPending(), 1);
+
+    // The default window is not enough to flush the last batch
+    tester.d_cluster_mp->advanceTime(bsls::TimeInterval().addMilliseconds(
+        mqbcfg::QueueOperationsConfig::
+            DEFAULT_INITIALIZER_ASSIGNMENT_BATCH_WINDOW_MS));
+    tester.d_cluster_mp->waitForScheduler();
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numPending(), 1);
+
+    tester.expireBatchWindow();
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numPending(), 0);
+
+    tester.uncommitted(&advisories);
+    BMQTST_ASSERT_EQ(advisories.size(), 3U);
+}
+
+static void test4_revertOnLostLeadership()
+// ------------------------------------------------------------------------
+// REVERT ON LOST LEADERSHIP
+//
+// Concerns:
+//   If self is no longer the active leader when the batch is flushed, the
+//   batch is not applied and its queues are reverted.
+//
+// Testing:
+//   flush
+//   cancel
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("REVERT ON LOST LEADERSHIP");
+
+    Tester tester;
+
+    BMQTST_ASSERT(tester.assignQueue("queue0"));
+    BMQTST_ASSERT(tester.assignQueue("queue1"));
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numPending(), 2);
+
+    tester.d_cluster_mp->_clusterData()->electorInfo().setElectorInfo(
+        mqbnet::ElectorState::e_FOLLOWER,
+        2,  // term
+        0,  // leaderNode
+        mqbc::ElectorInfoLeaderStatus::e_UNDEFINED);
+
+    tester.d_batcher_mp->flush();
+
+    ClusterMessageCRefList advisories(bmqtst::TestHelperUtil::allocator());
+    tester.uncommitted(&advisories);
+    BMQTST_ASSERT(advisories.empty());
+    BMQTST_ASSERT_EQ(tester.d_batcher_mp->numPending(), 0);
+    BMQTST_ASSERT_EQ(tester.queueState("queue0"),
+                     mqbc::ClusterStateQueueInfo::State::k_NONE);
+    BMQTST_ASSERT_EQ(tester.queueState("queue1"),
+                     mqbc::ClusterStateQueueInfo::State::k_NONE);
+    BMQTST_ASSERT(tester.d_cluster_mp->_state()->queueKeys().empty());
+
+    // A stale scheduled flush is a no-op
+    tester.expireBatchWindow();
+    tester.uncommitted(&advisories);
+    BMQTST_ASSERT(advisories.empty());
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 4: test4_revertOnLostLeadership(); break;
+    case 3: test3_maxBatchSize(); break;
+    case 2: test2_batchingWindow(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_GBL_ALLOC);
+    // Can't ensure no default memory is allocated because
+    // 'bdlmt::EventSchedulerTestTimeSource' inside 'mqbmock::Cluster' uses
+    // the default allocator in its constructor.
+}
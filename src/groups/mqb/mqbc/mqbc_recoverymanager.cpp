@@ -58,6 +58,8 @@
 #include <bmqu_blob.h>
 #include <bmqu_blobobjectproxy.h>
 #include <bmqu_memoutstream.h>
+#include <bmqu_printutil.h>
+#include <bmqu_time.h>
 
 // BDE
 #include <bdlb_scopeexit.h>
@@ -117,6 +119,8 @@ void RecoveryManager::ReceiveDataContext::reset()
     d_beginPSN.reset();
     d_endPSN.reset();
     d_currPSN.reset();
+    d_startTime = 0;
+    d_numBytes  = 0;
 }
 
 // ---------------------
@@ -150,6 +154,28 @@ RecoveryManager::~RecoveryManager()
     // NOTHING
 }
 
+// PRIVATE ACCESSORS
+void RecoveryManager::logReceivedDataChunks(int partitionId) const
+{
+    // executed by the *QUEUE DISPATCHER* thread associated with 'partitionId'
+
+    const ReceiveDataContext& receiveDataCtx =
+        d_recoveryContextVec[partitionId].d_receiveDataContext;
+
+    BALL_LOG_INFO << d_clusterData.identity().description() << " Partition ["
+                  << partitionId << "]: " << "Received data chunks from "
+                  << mqbs::printPSN(receiveDataCtx.d_beginPSN) << " to "
+                  << mqbs::printPSN(receiveDataCtx.d_endPSN) << " from "
+                  << receiveDataCtx.d_recoveryDataSource_p->nodeDescription()
+                  << " ("
+                  << bmqu::PrintUtil::prettyBytes(receiveDataCtx.d_numBytes)
+                  << " in "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         bmqu::Time::highResolutionTimer() -
+                         receiveDataCtx.d_startTime)
+                  << ").";
+}
+
 // MANIPULATORS
 int RecoveryManager::start(BSLA_MAYBE_UNUSED bsl::ostream& errorDescription)
 {
@@ -228,6 +254,8 @@ void RecoveryManager::setExpectedDataChunkRange(
     receiveDataCtx.d_beginPSN             = beginSeqNum;
     receiveDataCtx.d_endPSN               = endSeqNum;
     receiveDataCtx.d_currPSN              = beginSeqNum;
+    receiveDataCtx.d_startTime            = bmqu::Time::highResolutionTimer();
+    receiveDataCtx.d_numBytes             = 0;
     if (fs.isOpen()) {
         BSLS_ASSERT_SAFE(receiveDataCtx.d_currPSN.primaryLeaseId() ==
                          fs.writeHeadLeaseId());
@@ -298,6 +326,9 @@ int RecoveryManager::processSendDataChunks(
         return rc_SUCCESS;  // RETURN
     }
 
+    const bsls::Types::Int64 startTime = bmqu::Time::highResolutionTimer();
+    bsls::Types::Int64       numBytes  = 0;
+
     BALL_LOG_INFO << d_clusterData.identity().description() << " Partition ["
                   << partitionId << "]: sending data chunks from "
                   << mqbs::printPSN(beginSeqNum) << " to "
@@ -392,6 +423,29 @@ int RecoveryManager::processSendDataChunks(
         mqbu::ExitUtil::terminate(mqbu::ExitCode::e_RECOVERY_FAILURE);  // EXIT
     }
 
+    if (fs.isOpen()) {
+        // Only the records after 'beginSeqNum' need to be sent: use the sync
+        // points of the journal to skip most of the records preceding it,
+        // rather than iterating over the journal from its beginning.
+        rc = RecoveryUtil::seekToSyncPoint(&journalIt,
+                                           fs.syncPoints(),
+                                           beginSeqNum);
+        if (rc != 0) {
+            BMQTSK_ALARMLOG_ALARM("FILE_IO")
+                << d_clusterData.identity().description() << " Partition ["
+                << partitionId << "]: "
+                << "While sending data chunks, failed to seek journal "
+                   "iterator to the sync point preceding "
+                << mqbs::printPSN(beginSeqNum) << ", rc: " << rc
+                << BMQTSK_ALARMLOG_END;
+
+            // Failure to access our own storage files is non-transient, will
+            // terminate
+            mqbu::ExitUtil::terminate(
+                mqbu::ExitCode::e_RECOVERY_FAILURE);  // EXIT
+        }
+    }
+
     bmqp_ctrlmsg::PartitionSequenceNumber currentSeqNum;
     rc = RecoveryUtil::bootstrapCurrentSeqNum(&currentSeqNum,
                                               journalIt,
@@ -520,6 +574,7 @@ int RecoveryManager::processSendDataChunks(
                        rc_WRITE_FAILURE;  // RETURN
             }
 
+            numBytes += builder.eventSize();
             builder.reset();
         }
 
@@ -576,13 +631,19 @@ int RecoveryManager::processSendDataChunks(
             return static_cast<int>(writeRc) * 10 +
                    rc_WRITE_FAILURE;  // RETURN
         }
+
+        numBytes += builder.eventSize();
     }
 
     BALL_LOG_INFO << d_clusterData.identity().description() << " Partition ["
                   << partitionId << "]: " << "Sent data chunks from "
                   << mqbs::printPSN(beginSeqNum) << " to "
                   << mqbs::printPSN(endSeqNum)
-                  << " to node: " << destination->nodeDescription() << ".";
+                  << " to node: " << destination->nodeDescription() << " ("
+                  << bmqu::PrintUtil::prettyBytes(numBytes) << " in "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         bmqu::Time::highResolutionTimer() - startTime)
+                  << ").";
 
     return rc_SUCCESS;
 }
@@ -642,6 +703,8 @@ int RecoveryManager::processReceiveDataChunks(
         return rc_INVALID_RECOVERY_PEER;  // RETURN
     }
 
+    receiveDataCtx.d_numBytes += blob->length();
+
     if (fs->isOpen()) {
         BSLS_ASSERT_SAFE(receiveDataCtx.d_currPSN.primaryLeaseId() ==
                          fs->writeHeadLeaseId());
@@ -655,6 +718,7 @@ int RecoveryManager::processReceiveDataChunks(
 
         if (receiveDataCtx.d_currPSN == receiveDataCtx.d_endPSN) {
             receiveDataCtx.d_expectChunks = false;
+            logReceivedDataChunks(partitionId);
             return rc_LAST_DATA_CHUNK;  // RETURN
         }
         else if (receiveDataCtx.d_currPSN > receiveDataCtx.d_endPSN) {
@@ -862,6 +926,7 @@ int RecoveryManager::processReceiveDataChunks(
         receiveDataCtx.d_currPSN = recordPSN;
         if (receiveDataCtx.d_currPSN == receiveDataCtx.d_endPSN) {
             receiveDataCtx.d_expectChunks = false;
+            logReceivedDataChunks(partitionId);
             return rc_LAST_DATA_CHUNK;  // RETURN
         }
     }  // end: while loop
@@ -138,6 +138,13 @@ class RecoveryManager {
         /// Self's current PSN.
         bmqp_ctrlmsg::PartitionSequenceNumber d_currPSN;
 
+        /// High resolution timer value when self started expecting recovery
+        /// data chunks.
+        bsls::Types::Int64 d_startTime;
+
+        /// Number of bytes of recovery data chunks received so far.
+        bsls::Types::Int64 d_numBytes;
+
       public:
         // CREATORS
 
@@ -266,6 +273,13 @@ class RecoveryManager {
     RecoveryManager(const RecoveryManager&) BSLS_KEYWORD_DELETED;
     RecoveryManager& operator=(const RecoveryManager&) BSLS_KEYWORD_DELETED;
 
+    // PRIVATE ACCESSORS
+
+    /// Log the amount of recovery data received for the specified
+    /// `partitionId`, and the time it took, once the last data chunk has
+    /// been received.
+    void logReceivedDataChunks(int partitionId) const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(RecoveryManager, bslma::UsesBslmaAllocator)
@@ -496,6 +510,8 @@ inline RecoveryManager::ReceiveDataContext::ReceiveDataContext()
 , d_beginPSN()
 , d_endPSN()
 , d_currPSN()
+, d_startTime(0)
+, d_numBytes(0)
 {
     // NOTHING
 }
@@ -508,6 +524,8 @@ inline RecoveryManager::ReceiveDataContext::ReceiveDataContext(
 , d_beginPSN(other.d_beginPSN)
 , d_endPSN(other.d_endPSN)
 , d_currPSN(other.d_currPSN)
+, d_startTime(other.d_startTime)
+, d_numBytes(other.d_numBytes)
 {
     // NOTHING
 }
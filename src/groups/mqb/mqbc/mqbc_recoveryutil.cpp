@@ -28,6 +28,7 @@
 #include <bmqu_memoutstream.h>
 
 // BDE
+#include <bsl_algorithm.h>
 #include <bsl_string.h>
 #include <bsla_annotations.h>
 #include <bsls_assert.h>
@@ -35,6 +36,29 @@
 namespace BloombergLP {
 namespace mqbc {
 
+namespace {
+
+// ====================
+// struct SyncPointLess
+// ====================
+
+/// Comparator of a partition sequence number with the sync point of a
+/// `SyncPointOffsetPair`.
+struct SyncPointLess {
+    bool operator()(const bmqp_ctrlmsg::PartitionSequenceNumber& psn,
+                    const bmqp_ctrlmsg::SyncPointOffsetPair&     spoPair) const
+    {
+        const bmqp_ctrlmsg::SyncPoint& syncPoint = spoPair.syncPoint();
+        if (psn.primaryLeaseId() != syncPoint.primaryLeaseId()) {
+            return psn.primaryLeaseId() < syncPoint.primaryLeaseId();
+        }
+
+        return psn.sequenceNumber() < syncPoint.sequenceNum();
+    }
+};
+
+}  // close unnamed namespace
+
 // ===================
 // struct RecoveryUtil
 // ===================
@@ -138,6 +162,52 @@ int RecoveryUtil::bootstrapCurrentSeqNum(
     return -1;
 }
 
+int RecoveryUtil::seekToSyncPoint(
+    mqbs::JournalFileIterator*                   journalIt,
+    const mqbs::FileStore::SyncPointOffsetPairs& syncPoints,
+    const bmqp_ctrlmsg::PartitionSequenceNumber& beginSeqNum)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(journalIt);
+    BSLS_ASSERT_SAFE(journalIt->isValid());
+
+    enum {
+        rc_SUCCESS                  = 0,
+        rc_JOURNAL_ITERATOR_FAILURE = -1
+    };
+
+    // Sync points are ordered by sequence number: find the first one past
+    // 'beginSeqNum', and step back to the one preceding it.
+    mqbs::FileStore::SyncPointOffsetConstIter cit = bsl::upper_bound(
+        syncPoints.begin(),
+        syncPoints.end(),
+        beginSeqNum,
+        SyncPointLess());
+    if (cit == syncPoints.begin()) {
+        return rc_SUCCESS;  // RETURN
+    }
+    --cit;
+
+    const bsls::Types::Uint64 currentOffset = journalIt->recordOffset();
+    if (cit->offset() <= currentOffset) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(0 == (cit->offset() - currentOffset) %
+                              mqbs::FileStoreProtocol::k_JOURNAL_RECORD_SIZE);
+
+    const int rc = journalIt->advance(
+        (cit->offset() - currentOffset) /
+        mqbs::FileStoreProtocol::k_JOURNAL_RECORD_SIZE);
+    if (rc != 1) {
+        return rc * 10 + rc_JOURNAL_ITERATOR_FAILURE;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(journalIt->recordOffset() == cit->offset());
+
+    return rc_SUCCESS;
+}
+
 int RecoveryUtil::incrementCurrentSeqNum(
     bmqp_ctrlmsg::PartitionSequenceNumber* currentSeqNum,
     mqbs::JournalFileIterator&             journalIt)
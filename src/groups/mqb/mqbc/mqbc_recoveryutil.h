@@ -88,6 +88,20 @@ struct RecoveryUtil {
         mqbs::JournalFileIterator&                   journalIt,
         const bmqp_ctrlmsg::PartitionSequenceNumber& beginSeqNum);
 
+    /// Advance the specified `journalIt` to the latest of the specified
+    /// `syncPoints` whose sequence number is lower than or equal to the
+    /// specified `beginSeqNum`, so that `bootstrapCurrentSeqNum` does not
+    /// have to iterate over all the preceding records.  Leave `journalIt`
+    /// unchanged if there is no such sync point or if it is not ahead of
+    /// the current record.  This assumes initial 'journalIt.nextRecord()'
+    /// call has been done, and that `syncPoints` belong to the journal of
+    /// `journalIt`.  The function return zero if successful and non-zero
+    /// for failure scenarios.
+    static int seekToSyncPoint(
+        mqbs::JournalFileIterator*                   journalIt,
+        const mqbs::FileStore::SyncPointOffsetPairs& syncPoints,
+        const bmqp_ctrlmsg::PartitionSequenceNumber& beginSeqNum);
+
     /// Increment the specified `currentSeqNum` using the specified
     /// `journalIt`.  Return 0 on successful, 1 if the end of the
     /// journal file is reached, and non-zero for failure scenarios.
@@ -49,6 +49,7 @@
 #include <bmqu_blob.h>
 #include <bmqu_blobobjectproxy.h>
 #include <bmqu_memoutstream.h>
+#include <bmqu_printutil.h>
 #include <bmqu_time.h>
 
 // BDE
@@ -276,13 +277,19 @@ struct TestHelper {
         }
     }
 
-    void verifyPrimarySendsDataChunks(
+    /// Verify that self sends to each of the specified
+    /// `destinationReplicas` exactly the records it is missing up to the
+    /// specified `selfSeqNum`, and return the total number of bytes of data
+    /// chunks sent.
+    bsls::Types::Int64 verifyPrimarySendsDataChunks(
         int                                          partitionId,
         const bmqp_ctrlmsg::PartitionSequenceNumber& selfSeqNum,
         const NodeIdToPSNMap&                        destinationReplicas)
     // const mqbs::FileStore&                          fs,
     // const bsl::vector<mqbs::DataStoreRecordHandle>& handles)
     {
+        bsls::Types::Int64 numBytes = 0;
+
         for (TestChannelMapCIter cit = d_cluster_mp->_channels().cbegin();
              cit != d_cluster_mp->_channels().cend();
              ++cit) {
@@ -335,7 +342,10 @@ struct TestHelper {
                 event.loadStorageMessageIterator(&iter);
                 BSLS_ASSERT_SAFE(iter.isValid());
 
+                numBytes += writeCall.d_blob.length();
+
                 // Iterate over each message and validate a few things.
+                bsls::Types::Uint64 numRecords = 0;
                 while (1 == iter.next()) {
                     const bmqp::StorageHeader& header = iter.header();
                     BMQTST_ASSERT_EQ(static_cast<unsigned int>(partitionId),
@@ -363,8 +373,14 @@ struct TestHelper {
                         recHeader->sequenceNumber();
                     BMQTST_ASSERT_GT(recordSeqNum, replicaCit->second);
                     BMQTST_ASSERT_LE(recordSeqNum, selfSeqNum);
+                    ++numRecords;
                 }
 
+                // Only the records missing from the replica are sent
+                BMQTST_ASSERT_EQ(numRecords,
+                                 selfSeqNum.sequenceNumber() -
+                                     replicaCit->second.sequenceNumber());
+
                 /*int recordOffset = 0;
                 for (bmqp_ctrlmsg::PartitionSequenceNumber currSeqNum
                                                           = replicaCit->second;
@@ -415,6 +431,8 @@ struct TestHelper {
                 BMQTST_ASSERT(!cit->second->waitFor(1));
             }
         }
+
+        return numBytes;
     }
 
     void verifyReplicaSendsDataChunksAndReplicaDataRspnPull(
@@ -2702,6 +2720,10 @@ static void test16_primaryHealingStage1SelfHighestSendsDataChunks()
     replicaStateResponse.latestSequenceNumber() = k_REPLICA_SEQ_NUM_2;
     helper.d_cluster_mp->requestManager().processResponse(message);
 
+    // The last ReplicaStateResponse triggers the partition sync
+    const bsls::Types::Int64 syncStartTime =
+        bmqu::Time::highResolutionTimer();
+
     message.rId()                               = k_REQUEST_ID + 2;
     replicaStateResponse.latestSequenceNumber() = selfSeqNum;
     helper.d_cluster_mp->requestManager().processResponse(message);
@@ -2731,9 +2753,18 @@ static void test16_primaryHealingStage1SelfHighestSendsDataChunks()
                                                  destinationReplicas,
                                                  selfSeqNum);
 
-    helper.verifyPrimarySendsDataChunks(k_PARTITION_ID,
-                                        selfSeqNum,
-                                        destinationReplicas);
+    const bsls::Types::Int64 numBytes = helper.verifyPrimarySendsDataChunks(
+        k_PARTITION_ID,
+        selfSeqNum,
+        destinationReplicas);
+    const bsls::Types::Int64 syncDuration =
+        bmqu::Time::highResolutionTimer() - syncStartTime;
+
+    BMQTST_ASSERT_GT(numBytes, 0);
+    PV("Partition sync sent " << bmqu::PrintUtil::prettyBytes(numBytes)
+                              << " in "
+                              << bmqu::PrintUtil::prettyTimeInterval(
+                                     syncDuration));
 
     // Stop the cluster
     storageManager.stopPFSMs();
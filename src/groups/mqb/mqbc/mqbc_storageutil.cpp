@@ -1395,6 +1395,8 @@ int StorageUtil::assignPartitionDispatcherThreads(
             .setMaxJournalFileSize(config.maxJournalFileSize())
             .setMaxQlistFileSize(config.maxQlistFileSize())
             .setMaxArchivedFileSets(config.maxArchivedFileSets())
+            .setGroupSyncIntervalUs(config.groupSyncIntervalUs())
+            .setGroupSyncBytes(config.groupSyncBytes())
             .setRecoveredQueuesCb(recoveredQueuesCb)
             .setQueueCreationCb(queueCreationCb)
             .setQueueDeletionCb(queueDeletionCb);
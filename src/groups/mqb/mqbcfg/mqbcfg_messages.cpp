@@ -2188,6 +2188,12 @@ const int QueueOperationsConfig::DEFAULT_INITIALIZER_SHUTDOWN_TIMEOUT_MS =
 
 const int QueueOperationsConfig::DEFAULT_INITIALIZER_ACK_WINDOW_SIZE = 500;
 
+const int
+    QueueOperationsConfig::DEFAULT_INITIALIZER_ASSIGNMENT_BATCH_WINDOW_MS = 5;
+
+const int
+    QueueOperationsConfig::DEFAULT_INITIALIZER_ASSIGNMENT_BATCH_MAX_SIZE = 512;
+
 const bdlat_AttributeInfo QueueOperationsConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_OPEN_TIMEOUT_MS,
      "openTimeoutMs",
@@ -2248,6 +2254,16 @@ const bdlat_AttributeInfo QueueOperationsConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "ackWindowSize",
      sizeof("ackWindowSize") - 1,
      "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_ASSIGNMENT_BATCH_WINDOW_MS,
+     "assignmentBatchWindowMs",
+     sizeof("assignmentBatchWindowMs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_ASSIGNMENT_BATCH_MAX_SIZE,
+     "assignmentBatchMaxSize",
+     sizeof("assignmentBatchMaxSize") - 1,
+     "",
      bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
@@ -2255,7 +2271,7 @@ const bdlat_AttributeInfo QueueOperationsConfig::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo*
 QueueOperationsConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 12; ++i) {
+    for (int i = 0; i < 14; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             QueueOperationsConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -2296,6 +2312,12 @@ const bdlat_AttributeInfo* QueueOperationsConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SHUTDOWN_TIMEOUT_MS];
     case ATTRIBUTE_ID_ACK_WINDOW_SIZE:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ACK_WINDOW_SIZE];
+    case ATTRIBUTE_ID_ASSIGNMENT_BATCH_WINDOW_MS:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_ASSIGNMENT_BATCH_WINDOW_MS];
+    case ATTRIBUTE_ID_ASSIGNMENT_BATCH_MAX_SIZE:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_ASSIGNMENT_BATCH_MAX_SIZE];
     default: return 0;
     }
 }
@@ -2316,6 +2338,8 @@ QueueOperationsConfig::QueueOperationsConfig()
 , d_stopTimeoutMs(DEFAULT_INITIALIZER_STOP_TIMEOUT_MS)
 , d_shutdownTimeoutMs(DEFAULT_INITIALIZER_SHUTDOWN_TIMEOUT_MS)
 , d_ackWindowSize(DEFAULT_INITIALIZER_ACK_WINDOW_SIZE)
+, d_assignmentBatchWindowMs(DEFAULT_INITIALIZER_ASSIGNMENT_BATCH_WINDOW_MS)
+, d_assignmentBatchMaxSize(DEFAULT_INITIALIZER_ASSIGNMENT_BATCH_MAX_SIZE)
 {
 }
 
@@ -2336,6 +2360,8 @@ void QueueOperationsConfig::reset()
     d_stopTimeoutMs     = DEFAULT_INITIALIZER_STOP_TIMEOUT_MS;
     d_shutdownTimeoutMs = DEFAULT_INITIALIZER_SHUTDOWN_TIMEOUT_MS;
     d_ackWindowSize     = DEFAULT_INITIALIZER_ACK_WINDOW_SIZE;
+    d_assignmentBatchWindowMs = DEFAULT_INITIALIZER_ASSIGNMENT_BATCH_WINDOW_MS;
+    d_assignmentBatchMaxSize  = DEFAULT_INITIALIZER_ASSIGNMENT_BATCH_MAX_SIZE;
 }
 
 // ACCESSORS
@@ -2360,6 +2386,10 @@ bsl::ostream& QueueOperationsConfig::print(bsl::ostream& stream,
     printer.printAttribute("stopTimeoutMs", this->stopTimeoutMs());
     printer.printAttribute("shutdownTimeoutMs", this->shutdownTimeoutMs());
     printer.printAttribute("ackWindowSize", this->ackWindowSize());
+    printer.printAttribute("assignmentBatchWindowMs",
+                           this->assignmentBatchWindowMs());
+    printer.printAttribute("assignmentBatchMaxSize",
+                           this->assignmentBatchMaxSize());
     printer.end();
     return stream;
 }
@@ -2609,6 +2639,9 @@ const int StorageSyncConfig::DEFAULT_INITIALIZER_FILE_CHUNK_SIZE = 4194304;
 const int StorageSyncConfig::DEFAULT_INITIALIZER_PARTITION_SYNC_EVENT_SIZE =
     4194304;
 
+const int StorageSyncConfig::DEFAULT_INITIALIZER_MAX_FILE_CHUNKS_IN_FLIGHT =
+    16;
+
 const bdlat_AttributeInfo StorageSyncConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_STARTUP_RECOVERY_MAX_DURATION_MS,
      "startupRecoveryMaxDurationMs",
@@ -2654,6 +2687,11 @@ const bdlat_AttributeInfo StorageSyncConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "partitionSyncEventSize",
      sizeof("partitionSyncEventSize") - 1,
      "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_MAX_FILE_CHUNKS_IN_FLIGHT,
+     "maxFileChunksInFlight",
+     sizeof("maxFileChunksInFlight") - 1,
+     "",
      bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
@@ -2661,7 +2699,7 @@ const bdlat_AttributeInfo StorageSyncConfig::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo*
 StorageSyncConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 9; ++i) {
+    for (int i = 0; i < 10; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             StorageSyncConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -2702,6 +2740,9 @@ const bdlat_AttributeInfo* StorageSyncConfig::lookupAttributeInfo(int id)
     case ATTRIBUTE_ID_PARTITION_SYNC_EVENT_SIZE:
         return &ATTRIBUTE_INFO_ARRAY
             [ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE];
+    case ATTRIBUTE_ID_MAX_FILE_CHUNKS_IN_FLIGHT:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_MAX_FILE_CHUNKS_IN_FLIGHT];
     default: return 0;
     }
 }
@@ -2721,6 +2762,7 @@ StorageSyncConfig::StorageSyncConfig()
 , d_startupWaitDurationMs(DEFAULT_INITIALIZER_STARTUP_WAIT_DURATION_MS)
 , d_fileChunkSize(DEFAULT_INITIALIZER_FILE_CHUNK_SIZE)
 , d_partitionSyncEventSize(DEFAULT_INITIALIZER_PARTITION_SYNC_EVENT_SIZE)
+, d_maxFileChunksInFlight(DEFAULT_INITIALIZER_MAX_FILE_CHUNKS_IN_FLIGHT)
 {
 }
 
@@ -2742,6 +2784,7 @@ void StorageSyncConfig::reset()
     d_startupWaitDurationMs  = DEFAULT_INITIALIZER_STARTUP_WAIT_DURATION_MS;
     d_fileChunkSize          = DEFAULT_INITIALIZER_FILE_CHUNK_SIZE;
     d_partitionSyncEventSize = DEFAULT_INITIALIZER_PARTITION_SYNC_EVENT_SIZE;
+    d_maxFileChunksInFlight  = DEFAULT_INITIALIZER_MAX_FILE_CHUNKS_IN_FLIGHT;
 }
 
 // ACCESSORS
@@ -2769,6 +2812,8 @@ bsl::ostream& StorageSyncConfig::print(bsl::ostream& stream,
     printer.printAttribute("fileChunkSize", this->fileChunkSize());
     printer.printAttribute("partitionSyncEventSize",
                            this->partitionSyncEventSize());
+    printer.printAttribute("maxFileChunksInFlight",
+                           this->maxFileChunksInFlight());
     printer.end();
     return stream;
 }
@@ -4452,6 +4497,10 @@ const bool PartitionConfig::DEFAULT_INITIALIZER_PREFAULT_PAGES = false;
 
 const bool PartitionConfig::DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN = true;
 
+const int PartitionConfig::DEFAULT_INITIALIZER_GROUP_SYNC_INTERVAL_US = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_GROUP_SYNC_BYTES = 1048576;
+
 const bdlat_AttributeInfo PartitionConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NUM_PARTITIONS,
      "numPartitions",
@@ -4512,14 +4561,24 @@ const bdlat_AttributeInfo PartitionConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "syncConfig",
      sizeof("syncConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_GROUP_SYNC_INTERVAL_US,
+     "groupSyncIntervalUs",
+     sizeof("groupSyncIntervalUs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_GROUP_SYNC_BYTES,
+     "groupSyncBytes",
+     sizeof("groupSyncBytes") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 PartitionConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 12; ++i) {
+    for (int i = 0; i < 14; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             PartitionConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4559,6 +4618,10 @@ const bdlat_AttributeInfo* PartitionConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN];
     case ATTRIBUTE_ID_SYNC_CONFIG:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG];
+    case ATTRIBUTE_ID_GROUP_SYNC_INTERVAL_US:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_SYNC_INTERVAL_US];
+    case ATTRIBUTE_ID_GROUP_SYNC_BYTES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_SYNC_BYTES];
     default: return 0;
     }
 }
@@ -4575,6 +4638,8 @@ PartitionConfig::PartitionConfig(bslma::Allocator* basicAllocator)
 , d_syncConfig()
 , d_numPartitions()
 , d_maxArchivedFileSets()
+, d_groupSyncIntervalUs(DEFAULT_INITIALIZER_GROUP_SYNC_INTERVAL_US)
+, d_groupSyncBytes(DEFAULT_INITIALIZER_GROUP_SYNC_BYTES)
 , d_preallocate(DEFAULT_INITIALIZER_PREALLOCATE)
 , d_prefaultPages(DEFAULT_INITIALIZER_PREFAULT_PAGES)
 , d_flushAtShutdown(DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN)
@@ -4592,6 +4657,8 @@ PartitionConfig::PartitionConfig(const PartitionConfig& original,
 , d_syncConfig(original.d_syncConfig)
 , d_numPartitions(original.d_numPartitions)
 , d_maxArchivedFileSets(original.d_maxArchivedFileSets)
+, d_groupSyncIntervalUs(original.d_groupSyncIntervalUs)
+, d_groupSyncBytes(original.d_groupSyncBytes)
 , d_preallocate(original.d_preallocate)
 , d_prefaultPages(original.d_prefaultPages)
 , d_flushAtShutdown(original.d_flushAtShutdown)
@@ -4610,6 +4677,8 @@ PartitionConfig::PartitionConfig(PartitionConfig&& original) noexcept
   d_syncConfig(bsl::move(original.d_syncConfig)),
   d_numPartitions(bsl::move(original.d_numPartitions)),
   d_maxArchivedFileSets(bsl::move(original.d_maxArchivedFileSets)),
+  d_groupSyncIntervalUs(bsl::move(original.d_groupSyncIntervalUs)),
+  d_groupSyncBytes(bsl::move(original.d_groupSyncBytes)),
   d_preallocate(bsl::move(original.d_preallocate)),
   d_prefaultPages(bsl::move(original.d_prefaultPages)),
   d_flushAtShutdown(bsl::move(original.d_flushAtShutdown))
@@ -4627,6 +4696,8 @@ PartitionConfig::PartitionConfig(PartitionConfig&& original,
 , d_syncConfig(bsl::move(original.d_syncConfig))
 , d_numPartitions(bsl::move(original.d_numPartitions))
 , d_maxArchivedFileSets(bsl::move(original.d_maxArchivedFileSets))
+, d_groupSyncIntervalUs(bsl::move(original.d_groupSyncIntervalUs))
+, d_groupSyncBytes(bsl::move(original.d_groupSyncBytes))
 , d_preallocate(bsl::move(original.d_preallocate))
 , d_prefaultPages(bsl::move(original.d_prefaultPages))
 , d_flushAtShutdown(bsl::move(original.d_flushAtShutdown))
@@ -4655,6 +4726,8 @@ PartitionConfig& PartitionConfig::operator=(const PartitionConfig& rhs)
         d_prefaultPages       = rhs.d_prefaultPages;
         d_flushAtShutdown     = rhs.d_flushAtShutdown;
         d_syncConfig          = rhs.d_syncConfig;
+        d_groupSyncIntervalUs = rhs.d_groupSyncIntervalUs;
+        d_groupSyncBytes      = rhs.d_groupSyncBytes;
     }
 
     return *this;
@@ -4677,6 +4750,8 @@ PartitionConfig& PartitionConfig::operator=(PartitionConfig&& rhs)
         d_prefaultPages       = bsl::move(rhs.d_prefaultPages);
         d_flushAtShutdown     = bsl::move(rhs.d_flushAtShutdown);
         d_syncConfig          = bsl::move(rhs.d_syncConfig);
+        d_groupSyncIntervalUs = bsl::move(rhs.d_groupSyncIntervalUs);
+        d_groupSyncBytes      = bsl::move(rhs.d_groupSyncBytes);
     }
 
     return *this;
@@ -4697,6 +4772,8 @@ void PartitionConfig::reset()
     d_prefaultPages   = DEFAULT_INITIALIZER_PREFAULT_PAGES;
     d_flushAtShutdown = DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN;
     bdlat_ValueTypeFunctions::reset(&d_syncConfig);
+    d_groupSyncIntervalUs = DEFAULT_INITIALIZER_GROUP_SYNC_INTERVAL_US;
+    d_groupSyncBytes      = DEFAULT_INITIALIZER_GROUP_SYNC_BYTES;
 }
 
 // ACCESSORS
@@ -4719,6 +4796,8 @@ bsl::ostream& PartitionConfig::print(bsl::ostream& stream,
     printer.printAttribute("prefaultPages", this->prefaultPages());
     printer.printAttribute("flushAtShutdown", this->flushAtShutdown());
     printer.printAttribute("syncConfig", this->syncConfig());
+    printer.printAttribute("groupSyncIntervalUs", this->groupSyncIntervalUs());
+    printer.printAttribute("groupSyncBytes", this->groupSyncBytes());
     printer.end();
     return stream;
 }
@@ -4871,6 +4950,9 @@ const char StatPluginConfigPrometheus::DEFAULT_INITIALIZER_HOST[] =
 
 const int StatPluginConfigPrometheus::DEFAULT_INITIALIZER_PORT = 8080;
 
+const bool StatPluginConfigPrometheus::DEFAULT_INITIALIZER_EXPORT_HISTOGRAMS =
+    false;
+
 const bdlat_AttributeInfo StatPluginConfigPrometheus::ATTRIBUTE_INFO_ARRAY[] =
     {{ATTRIBUTE_ID_MODE,
       "mode",
@@ -4886,7 +4968,17 @@ const bdlat_AttributeInfo StatPluginConfigPrometheus::ATTRIBUTE_INFO_ARRAY[] =
       "port",
       sizeof("port") - 1,
       "",
-      bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
+      bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+     {ATTRIBUTE_ID_AGGREGATED_DOMAINS,
+      "aggregatedDomains",
+      sizeof("aggregatedDomains") - 1,
+      "",
+      bdlat_FormattingMode::e_TEXT},
+     {ATTRIBUTE_ID_EXPORT_HISTOGRAMS,
+      "exportHistograms",
+      sizeof("exportHistograms") - 1,
+      "",
+      bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
@@ -4894,7 +4986,7 @@ const bdlat_AttributeInfo*
 StatPluginConfigPrometheus::lookupAttributeInfo(const char* name,
                                                 int         nameLength)
 {
-    for (int i = 0; i < 3; ++i) {
+    for (int i = 0; i < 5; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             StatPluginConfigPrometheus::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4914,6 +5006,10 @@ StatPluginConfigPrometheus::lookupAttributeInfo(int id)
     case ATTRIBUTE_ID_MODE: return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MODE];
     case ATTRIBUTE_ID_HOST: return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HOST];
     case ATTRIBUTE_ID_PORT: return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PORT];
+    case ATTRIBUTE_ID_AGGREGATED_DOMAINS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AGGREGATED_DOMAINS];
+    case ATTRIBUTE_ID_EXPORT_HISTOGRAMS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EXPORT_HISTOGRAMS];
     default: return 0;
     }
 }
@@ -4922,18 +5018,22 @@ StatPluginConfigPrometheus::lookupAttributeInfo(int id)
 
 StatPluginConfigPrometheus::StatPluginConfigPrometheus(
     bslma::Allocator* basicAllocator)
-: d_host(DEFAULT_INITIALIZER_HOST, basicAllocator)
+: d_aggregatedDomains(basicAllocator)
+, d_host(DEFAULT_INITIALIZER_HOST, basicAllocator)
 , d_port(DEFAULT_INITIALIZER_PORT)
 , d_mode(DEFAULT_INITIALIZER_MODE)
+, d_exportHistograms(DEFAULT_INITIALIZER_EXPORT_HISTOGRAMS)
 {
 }
 
 StatPluginConfigPrometheus::StatPluginConfigPrometheus(
     const StatPluginConfigPrometheus& original,
     bslma::Allocator*                 basicAllocator)
-: d_host(original.d_host, basicAllocator)
+: d_aggregatedDomains(original.d_aggregatedDomains, basicAllocator)
+, d_host(original.d_host, basicAllocator)
 , d_port(original.d_port)
 , d_mode(original.d_mode)
+, d_exportHistograms(original.d_exportHistograms)
 {
 }
 
@@ -4941,18 +5041,22 @@ StatPluginConfigPrometheus::StatPluginConfigPrometheus(
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
 StatPluginConfigPrometheus::StatPluginConfigPrometheus(
     StatPluginConfigPrometheus&& original) noexcept
-: d_host(bsl::move(original.d_host)),
+: d_aggregatedDomains(bsl::move(original.d_aggregatedDomains)),
+  d_host(bsl::move(original.d_host)),
   d_port(bsl::move(original.d_port)),
-  d_mode(bsl::move(original.d_mode))
+  d_mode(bsl::move(original.d_mode)),
+  d_exportHistograms(bsl::move(original.d_exportHistograms))
 {
 }
 
 StatPluginConfigPrometheus::StatPluginConfigPrometheus(
     StatPluginConfigPrometheus&& original,
     bslma::Allocator*            basicAllocator)
-: d_host(bsl::move(original.d_host), basicAllocator)
+: d_aggregatedDomains(bsl::move(original.d_aggregatedDomains), basicAllocator)
+, d_host(bsl::move(original.d_host), basicAllocator)
 , d_port(bsl::move(original.d_port))
 , d_mode(bsl::move(original.d_mode))
+, d_exportHistograms(bsl::move(original.d_exportHistograms))
 {
 }
 #endif
@@ -4967,9 +5071,11 @@ StatPluginConfigPrometheus&
 StatPluginConfigPrometheus::operator=(const StatPluginConfigPrometheus& rhs)
 {
     if (this != &rhs) {
-        d_mode = rhs.d_mode;
-        d_host = rhs.d_host;
-        d_port = rhs.d_port;
+        d_mode              = rhs.d_mode;
+        d_host              = rhs.d_host;
+        d_port              = rhs.d_port;
+        d_aggregatedDomains = rhs.d_aggregatedDomains;
+        d_exportHistograms  = rhs.d_exportHistograms;
     }
 
     return *this;
@@ -4981,9 +5087,11 @@ StatPluginConfigPrometheus&
 StatPluginConfigPrometheus::operator=(StatPluginConfigPrometheus&& rhs)
 {
     if (this != &rhs) {
-        d_mode = bsl::move(rhs.d_mode);
-        d_host = bsl::move(rhs.d_host);
-        d_port = bsl::move(rhs.d_port);
+        d_mode              = bsl::move(rhs.d_mode);
+        d_host              = bsl::move(rhs.d_host);
+        d_port              = bsl::move(rhs.d_port);
+        d_aggregatedDomains = bsl::move(rhs.d_aggregatedDomains);
+        d_exportHistograms  = bsl::move(rhs.d_exportHistograms);
     }
 
     return *this;
@@ -4995,6 +5103,8 @@ void StatPluginConfigPrometheus::reset()
     d_mode = DEFAULT_INITIALIZER_MODE;
     d_host = DEFAULT_INITIALIZER_HOST;
     d_port = DEFAULT_INITIALIZER_PORT;
+    bdlat_ValueTypeFunctions::reset(&d_aggregatedDomains);
+    d_exportHistograms = DEFAULT_INITIALIZER_EXPORT_HISTOGRAMS;
 }
 
 // ACCESSORS
@@ -5008,6 +5118,8 @@ bsl::ostream& StatPluginConfigPrometheus::print(bsl::ostream& stream,
     printer.printAttribute("mode", this->mode());
     printer.printAttribute("host", this->host());
     printer.printAttribute("port", this->port());
+    printer.printAttribute("aggregatedDomains", this->aggregatedDomains());
+    printer.printAttribute("exportHistograms", this->exportHistograms());
     printer.end();
     return stream;
 }
@@ -5229,6 +5341,10 @@ const bsls::Types::Int64
 
 const int TcpInterfaceConfig::DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS = 3000;
 
+const bool TcpInterfaceConfig::DEFAULT_INITIALIZER_IO_RING = false;
+
+const char TcpInterfaceConfig::DEFAULT_INITIALIZER_SHM_ENDPOINT[] = "";
+
 const bdlat_AttributeInfo TcpInterfaceConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NAME,
      "name",
@@ -5279,14 +5395,24 @@ const bdlat_AttributeInfo TcpInterfaceConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "listeners",
      sizeof("listeners") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_IO_RING,
+     "ioRing",
+     sizeof("ioRing") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_SHM_ENDPOINT,
+     "shmEndpoint",
+     sizeof("shmEndpoint") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 TcpInterfaceConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 10; ++i) {
+    for (int i = 0; i < 12; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             TcpInterfaceConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -5320,6 +5446,10 @@ const bdlat_AttributeInfo* TcpInterfaceConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HEARTBEAT_INTERVAL_MS];
     case ATTRIBUTE_ID_LISTENERS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LISTENERS];
+    case ATTRIBUTE_ID_IO_RING:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_IO_RING];
+    case ATTRIBUTE_ID_SHM_ENDPOINT:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SHM_ENDPOINT];
     default: return 0;
     }
 }
@@ -5333,10 +5463,12 @@ TcpInterfaceConfig::TcpInterfaceConfig(bslma::Allocator* basicAllocator)
 , d_nodeHighWatermark(DEFAULT_INITIALIZER_NODE_HIGH_WATERMARK)
 , d_listeners(basicAllocator)
 , d_name(basicAllocator)
+, d_shmEndpoint(DEFAULT_INITIALIZER_SHM_ENDPOINT, basicAllocator)
 , d_port()
 , d_ioThreads()
 , d_maxConnections(DEFAULT_INITIALIZER_MAX_CONNECTIONS)
 , d_heartbeatIntervalMs(DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS)
+, d_ioRing(DEFAULT_INITIALIZER_IO_RING)
 {
 }
 
@@ -5348,10 +5480,12 @@ TcpInterfaceConfig::TcpInterfaceConfig(const TcpInterfaceConfig& original,
 , d_nodeHighWatermark(original.d_nodeHighWatermark)
 , d_listeners(original.d_listeners, basicAllocator)
 , d_name(original.d_name, basicAllocator)
+, d_shmEndpoint(original.d_shmEndpoint, basicAllocator)
 , d_port(original.d_port)
 , d_ioThreads(original.d_ioThreads)
 , d_maxConnections(original.d_maxConnections)
 , d_heartbeatIntervalMs(original.d_heartbeatIntervalMs)
+, d_ioRing(original.d_ioRing)
 {
 }
 
@@ -5364,10 +5498,12 @@ TcpInterfaceConfig::TcpInterfaceConfig(TcpInterfaceConfig&& original) noexcept
   d_nodeHighWatermark(bsl::move(original.d_nodeHighWatermark)),
   d_listeners(bsl::move(original.d_listeners)),
   d_name(bsl::move(original.d_name)),
+  d_shmEndpoint(bsl::move(original.d_shmEndpoint)),
   d_port(bsl::move(original.d_port)),
   d_ioThreads(bsl::move(original.d_ioThreads)),
   d_maxConnections(bsl::move(original.d_maxConnections)),
-  d_heartbeatIntervalMs(bsl::move(original.d_heartbeatIntervalMs))
+  d_heartbeatIntervalMs(bsl::move(original.d_heartbeatIntervalMs)),
+  d_ioRing(bsl::move(original.d_ioRing))
 {
 }
 
@@ -5379,10 +5515,12 @@ TcpInterfaceConfig::TcpInterfaceConfig(TcpInterfaceConfig&& original,
 , d_nodeHighWatermark(bsl::move(original.d_nodeHighWatermark))
 , d_listeners(bsl::move(original.d_listeners), basicAllocator)
 , d_name(bsl::move(original.d_name), basicAllocator)
+, d_shmEndpoint(bsl::move(original.d_shmEndpoint), basicAllocator)
 , d_port(bsl::move(original.d_port))
 , d_ioThreads(bsl::move(original.d_ioThreads))
 , d_maxConnections(bsl::move(original.d_maxConnections))
 , d_heartbeatIntervalMs(bsl::move(original.d_heartbeatIntervalMs))
+, d_ioRing(bsl::move(original.d_ioRing))
 {
 }
 #endif
@@ -5407,6 +5545,8 @@ TcpInterfaceConfig::operator=(const TcpInterfaceConfig& rhs)
         d_nodeHighWatermark   = rhs.d_nodeHighWatermark;
         d_heartbeatIntervalMs = rhs.d_heartbeatIntervalMs;
         d_listeners           = rhs.d_listeners;
+        d_ioRing              = rhs.d_ioRing;
+        d_shmEndpoint         = rhs.d_shmEndpoint;
     }
 
     return *this;
@@ -5427,6 +5567,8 @@ TcpInterfaceConfig& TcpInterfaceConfig::operator=(TcpInterfaceConfig&& rhs)
         d_nodeHighWatermark   = bsl::move(rhs.d_nodeHighWatermark);
         d_heartbeatIntervalMs = bsl::move(rhs.d_heartbeatIntervalMs);
         d_listeners           = bsl::move(rhs.d_listeners);
+        d_ioRing              = bsl::move(rhs.d_ioRing);
+        d_shmEndpoint         = bsl::move(rhs.d_shmEndpoint);
     }
 
     return *this;
@@ -5445,6 +5587,8 @@ void TcpInterfaceConfig::reset()
     d_nodeHighWatermark   = DEFAULT_INITIALIZER_NODE_HIGH_WATERMARK;
     d_heartbeatIntervalMs = DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS;
     bdlat_ValueTypeFunctions::reset(&d_listeners);
+    d_ioRing      = DEFAULT_INITIALIZER_IO_RING;
+    d_shmEndpoint = DEFAULT_INITIALIZER_SHM_ENDPOINT;
 }
 
 // ACCESSORS
@@ -5465,6 +5609,8 @@ bsl::ostream& TcpInterfaceConfig::print(bsl::ostream& stream,
     printer.printAttribute("nodeHighWatermark", this->nodeHighWatermark());
     printer.printAttribute("heartbeatIntervalMs", this->heartbeatIntervalMs());
     printer.printAttribute("listeners", this->listeners());
+    printer.printAttribute("ioRing", this->ioRing());
+    printer.printAttribute("shmEndpoint", this->shmEndpoint());
     printer.end();
     return stream;
 }
@@ -6039,6 +6185,8 @@ const int DispatcherConfig::DEFAULT_INITIALIZER_ALARM_TIMEOUT_MS = 180000;
 
 const int DispatcherConfig::DEFAULT_INITIALIZER_WARNING_TIMEOUT_MS = 10000;
 
+const bool DispatcherConfig::DEFAULT_INITIALIZER_NUMA_AWARE = false;
+
 const bdlat_AttributeInfo DispatcherConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_SESSIONS,
      "sessions",
@@ -6064,14 +6212,19 @@ const bdlat_AttributeInfo DispatcherConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "warningTimeoutMs",
      sizeof("warningTimeoutMs") - 1,
      "",
-     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_NUMA_AWARE,
+     "numaAware",
+     sizeof("numaAware") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 DispatcherConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 5; ++i) {
+    for (int i = 0; i < 6; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             DispatcherConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -6097,6 +6250,8 @@ const bdlat_AttributeInfo* DispatcherConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ALARM_TIMEOUT_MS];
     case ATTRIBUTE_ID_WARNING_TIMEOUT_MS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WARNING_TIMEOUT_MS];
+    case ATTRIBUTE_ID_NUMA_AWARE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUMA_AWARE];
     default: return 0;
     }
 }
@@ -6109,6 +6264,7 @@ DispatcherConfig::DispatcherConfig()
 , d_clusters()
 , d_alarmTimeoutMs(DEFAULT_INITIALIZER_ALARM_TIMEOUT_MS)
 , d_warningTimeoutMs(DEFAULT_INITIALIZER_WARNING_TIMEOUT_MS)
+, d_numaAware(DEFAULT_INITIALIZER_NUMA_AWARE)
 {
 }
 
@@ -6121,6 +6277,7 @@ void DispatcherConfig::reset()
     bdlat_ValueTypeFunctions::reset(&d_clusters);
     d_alarmTimeoutMs   = DEFAULT_INITIALIZER_ALARM_TIMEOUT_MS;
     d_warningTimeoutMs = DEFAULT_INITIALIZER_WARNING_TIMEOUT_MS;
+    d_numaAware        = DEFAULT_INITIALIZER_NUMA_AWARE;
 }
 
 // ACCESSORS
@@ -6136,6 +6293,7 @@ bsl::ostream& DispatcherConfig::print(bsl::ostream& stream,
     printer.printAttribute("clusters", this->clusters());
     printer.printAttribute("alarmTimeoutMs", this->alarmTimeoutMs());
     printer.printAttribute("warningTimeoutMs", this->warningTimeoutMs());
+    printer.printAttribute("numaAware", this->numaAware());
     printer.end();
     return stream;
 }
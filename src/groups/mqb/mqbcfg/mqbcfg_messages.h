@@ -3591,7 +3591,11 @@ namespace mqbcfg {
 /// may not reply to stopRequest (otherwise, this timeout is not expected to be
 /// reached).  ackWindowSize..............: number of PUTs without ACK
 /// requested after which we request an ACK.  This is to remove pending
-/// broadcast PUTs.
+/// broadcast PUTs.  assignmentBatchWindowMs....: duration, in milliseconds,
+/// during which the leader accumulates queue assignments before broadcasting
+/// them in a single advisory.  assignmentBatchMaxSize.....: number of queue
+/// assignments after which the pending advisory is broadcast without waiting
+/// for the end of the batching window.
 class QueueOperationsConfig {
     // INSTANCE DATA
 
@@ -3607,6 +3611,8 @@ class QueueOperationsConfig {
     int d_stopTimeoutMs;
     int d_shutdownTimeoutMs;
     int d_ackWindowSize;
+    int d_assignmentBatchWindowMs;
+    int d_assignmentBatchMaxSize;
 
     // PRIVATE ACCESSORS
 
@@ -3630,10 +3636,12 @@ class QueueOperationsConfig {
         ATTRIBUTE_ID_CONSUMPTION_MONITOR_PERIOD_MS = 8,
         ATTRIBUTE_ID_STOP_TIMEOUT_MS               = 9,
         ATTRIBUTE_ID_SHUTDOWN_TIMEOUT_MS           = 10,
-        ATTRIBUTE_ID_ACK_WINDOW_SIZE               = 11
+        ATTRIBUTE_ID_ACK_WINDOW_SIZE               = 11,
+        ATTRIBUTE_ID_ASSIGNMENT_BATCH_WINDOW_MS    = 12,
+        ATTRIBUTE_ID_ASSIGNMENT_BATCH_MAX_SIZE     = 13
     };
 
-    enum { NUM_ATTRIBUTES = 12 };
+    enum { NUM_ATTRIBUTES = 14 };
 
     enum {
         ATTRIBUTE_INDEX_OPEN_TIMEOUT_MS               = 0,
@@ -3647,7 +3655,9 @@ class QueueOperationsConfig {
         ATTRIBUTE_INDEX_CONSUMPTION_MONITOR_PERIOD_MS = 8,
         ATTRIBUTE_INDEX_STOP_TIMEOUT_MS               = 9,
         ATTRIBUTE_INDEX_SHUTDOWN_TIMEOUT_MS           = 10,
-        ATTRIBUTE_INDEX_ACK_WINDOW_SIZE               = 11
+        ATTRIBUTE_INDEX_ACK_WINDOW_SIZE               = 11,
+        ATTRIBUTE_INDEX_ASSIGNMENT_BATCH_WINDOW_MS    = 12,
+        ATTRIBUTE_INDEX_ASSIGNMENT_BATCH_MAX_SIZE     = 13
     };
 
     // CONSTANTS
@@ -3678,6 +3688,10 @@ class QueueOperationsConfig {
 
     static const int DEFAULT_INITIALIZER_ACK_WINDOW_SIZE;
 
+    static const int DEFAULT_INITIALIZER_ASSIGNMENT_BATCH_WINDOW_MS;
+
+    static const int DEFAULT_INITIALIZER_ASSIGNMENT_BATCH_MAX_SIZE;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -3782,6 +3796,14 @@ class QueueOperationsConfig {
     /// object.
     int& ackWindowSize();
 
+    /// Return a reference to the modifiable "AssignmentBatchWindowMs"
+    /// attribute of this object.
+    int& assignmentBatchWindowMs();
+
+    /// Return a reference to the modifiable "AssignmentBatchMaxSize"
+    /// attribute of this object.
+    int& assignmentBatchMaxSize();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -3864,6 +3886,14 @@ class QueueOperationsConfig {
     /// Return the value of the "AckWindowSize" attribute of this object.
     int ackWindowSize() const;
 
+    /// Return the value of the "AssignmentBatchWindowMs" attribute of this
+    /// object.
+    int assignmentBatchWindowMs() const;
+
+    /// Return the value of the "AssignmentBatchMaxSize" attribute of this
+    /// object.
+    int assignmentBatchMaxSize() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -4277,6 +4307,9 @@ namespace mqbcfg {
 /// in bytes, to send in one go to the peer when serving a storage sync request
 /// from it partitionSyncEventSize.........: maximum size, in bytes, of
 /// bmqp::EventType::PARTITION_SYNC before we send it to the peer
+/// maxFileChunksInFlight..........: maximum number of file chunks written to
+/// the peer, and not yet flushed by the channel, when serving a storage sync
+/// request from it
 class StorageSyncConfig {
     // INSTANCE DATA
 
@@ -4289,6 +4322,7 @@ class StorageSyncConfig {
     int d_startupWaitDurationMs;
     int d_fileChunkSize;
     int d_partitionSyncEventSize;
+    int d_maxFileChunksInFlight;
 
     // PRIVATE ACCESSORS
 
@@ -4309,10 +4343,11 @@ class StorageSyncConfig {
         ATTRIBUTE_ID_PARTITION_SYNC_DATA_REQ_TIMEOUT_MS  = 5,
         ATTRIBUTE_ID_STARTUP_WAIT_DURATION_MS            = 6,
         ATTRIBUTE_ID_FILE_CHUNK_SIZE                     = 7,
-        ATTRIBUTE_ID_PARTITION_SYNC_EVENT_SIZE           = 8
+        ATTRIBUTE_ID_PARTITION_SYNC_EVENT_SIZE           = 8,
+        ATTRIBUTE_ID_MAX_FILE_CHUNKS_IN_FLIGHT           = 9
     };
 
-    enum { NUM_ATTRIBUTES = 9 };
+    enum { NUM_ATTRIBUTES = 10 };
 
     enum {
         ATTRIBUTE_INDEX_STARTUP_RECOVERY_MAX_DURATION_MS    = 0,
@@ -4323,7 +4358,8 @@ class StorageSyncConfig {
         ATTRIBUTE_INDEX_PARTITION_SYNC_DATA_REQ_TIMEOUT_MS  = 5,
         ATTRIBUTE_INDEX_STARTUP_WAIT_DURATION_MS            = 6,
         ATTRIBUTE_INDEX_FILE_CHUNK_SIZE                     = 7,
-        ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE           = 8
+        ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE           = 8,
+        ATTRIBUTE_INDEX_MAX_FILE_CHUNKS_IN_FLIGHT           = 9
     };
 
     // CONSTANTS
@@ -4348,6 +4384,8 @@ class StorageSyncConfig {
 
     static const int DEFAULT_INITIALIZER_PARTITION_SYNC_EVENT_SIZE;
 
+    static const int DEFAULT_INITIALIZER_MAX_FILE_CHUNKS_IN_FLIGHT;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -4439,6 +4477,10 @@ class StorageSyncConfig {
     /// of this object.
     int& partitionSyncEventSize();
 
+    /// Return a reference to the modifiable "MaxFileChunksInFlight" attribute
+    /// of this object.
+    int& maxFileChunksInFlight();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -4518,6 +4560,10 @@ class StorageSyncConfig {
     /// object.
     int partitionSyncEventSize() const;
 
+    /// Return the value of the "MaxFileChunksInFlight" attribute of this
+    /// object.
+    int maxFileChunksInFlight() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -6850,7 +6896,11 @@ namespace mqbcfg {
 /// to populate (prefault) page tables for a mapping.  flushAtShutdown......:
 /// flag to indicate whether broker should flush storage files to disk at
 /// shutdown syncConfig...........: configuration for storage synchronization
-/// and recovery
+/// and recovery groupSyncIntervalUs..: maximum time, in microseconds, during
+/// which writes to the partition are accumulated before being synced to disk
+/// together, or 0 to disable group sync groupSyncBytes.......: number of
+/// bytes written to the partition after which accumulated writes are synced
+/// to disk without waiting for `groupSyncIntervalUs`
 class PartitionConfig {
     // INSTANCE DATA
 
@@ -6863,6 +6913,8 @@ class PartitionConfig {
     StorageSyncConfig   d_syncConfig;
     int                 d_numPartitions;
     int                 d_maxArchivedFileSets;
+    int                 d_groupSyncIntervalUs;
+    int                 d_groupSyncBytes;
     bool                d_preallocate;
     bool                d_prefaultPages;
     bool                d_flushAtShutdown;
@@ -6889,10 +6941,12 @@ class PartitionConfig {
         ATTRIBUTE_ID_MAX_ARCHIVED_FILE_SETS = 8,
         ATTRIBUTE_ID_PREFAULT_PAGES         = 9,
         ATTRIBUTE_ID_FLUSH_AT_SHUTDOWN      = 10,
-        ATTRIBUTE_ID_SYNC_CONFIG            = 11
+        ATTRIBUTE_ID_SYNC_CONFIG            = 11,
+        ATTRIBUTE_ID_GROUP_SYNC_INTERVAL_US = 12,
+        ATTRIBUTE_ID_GROUP_SYNC_BYTES       = 13
     };
 
-    enum { NUM_ATTRIBUTES = 12 };
+    enum { NUM_ATTRIBUTES = 14 };
 
     enum {
         ATTRIBUTE_INDEX_NUM_PARTITIONS         = 0,
@@ -6906,7 +6960,9 @@ class PartitionConfig {
         ATTRIBUTE_INDEX_MAX_ARCHIVED_FILE_SETS = 8,
         ATTRIBUTE_INDEX_PREFAULT_PAGES         = 9,
         ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN      = 10,
-        ATTRIBUTE_INDEX_SYNC_CONFIG            = 11
+        ATTRIBUTE_INDEX_SYNC_CONFIG            = 11,
+        ATTRIBUTE_INDEX_GROUP_SYNC_INTERVAL_US = 12,
+        ATTRIBUTE_INDEX_GROUP_SYNC_BYTES       = 13
     };
 
     // CONSTANTS
@@ -6921,6 +6977,10 @@ class PartitionConfig {
 
     static const bool DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN;
 
+    static const int DEFAULT_INITIALIZER_GROUP_SYNC_INTERVAL_US;
+
+    static const int DEFAULT_INITIALIZER_GROUP_SYNC_BYTES;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -7065,6 +7125,14 @@ class PartitionConfig {
     /// object.
     StorageSyncConfig& syncConfig();
 
+    /// Return a reference to the modifiable "GroupSyncIntervalUs" attribute of
+    /// this object.
+    int& groupSyncIntervalUs();
+
+    /// Return a reference to the modifiable "GroupSyncBytes" attribute of this
+    /// object.
+    int& groupSyncBytes();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -7148,6 +7216,12 @@ class PartitionConfig {
     /// attribute of this object.
     const StorageSyncConfig& syncConfig() const;
 
+    /// Return the value of the "GroupSyncIntervalUs" attribute of this object.
+    int groupSyncIntervalUs() const;
+
+    /// Return the value of the "GroupSyncBytes" attribute of this object.
+    int groupSyncBytes() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -7435,9 +7509,11 @@ namespace mqbcfg {
 class StatPluginConfigPrometheus {
     // INSTANCE DATA
 
-    bsl::string       d_host;
-    int               d_port;
-    ExportMode::Value d_mode;
+    bsl::vector<bsl::string> d_aggregatedDomains;
+    bsl::string              d_host;
+    int                      d_port;
+    ExportMode::Value        d_mode;
+    bool                     d_exportHistograms;
 
     // PRIVATE ACCESSORS
 
@@ -7448,17 +7524,21 @@ class StatPluginConfigPrometheus {
     // TYPES
 
     enum {
-        ATTRIBUTE_ID_MODE = 0,
-        ATTRIBUTE_ID_HOST = 1,
-        ATTRIBUTE_ID_PORT = 2
+        ATTRIBUTE_ID_MODE               = 0,
+        ATTRIBUTE_ID_HOST               = 1,
+        ATTRIBUTE_ID_PORT               = 2,
+        ATTRIBUTE_ID_AGGREGATED_DOMAINS = 3,
+        ATTRIBUTE_ID_EXPORT_HISTOGRAMS  = 4
     };
 
-    enum { NUM_ATTRIBUTES = 3 };
+    enum { NUM_ATTRIBUTES = 5 };
 
     enum {
-        ATTRIBUTE_INDEX_MODE = 0,
-        ATTRIBUTE_INDEX_HOST = 1,
-        ATTRIBUTE_INDEX_PORT = 2
+        ATTRIBUTE_INDEX_MODE               = 0,
+        ATTRIBUTE_INDEX_HOST               = 1,
+        ATTRIBUTE_INDEX_PORT               = 2,
+        ATTRIBUTE_INDEX_AGGREGATED_DOMAINS = 3,
+        ATTRIBUTE_INDEX_EXPORT_HISTOGRAMS  = 4
     };
 
     // CONSTANTS
@@ -7471,6 +7551,8 @@ class StatPluginConfigPrometheus {
 
     static const int DEFAULT_INITIALIZER_PORT;
 
+    static const bool DEFAULT_INITIALIZER_EXPORT_HISTOGRAMS;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -7577,6 +7659,14 @@ class StatPluginConfigPrometheus {
     /// Return a reference to the modifiable "Port" attribute of this object.
     int& port();
 
+    /// Return a reference to the modifiable "AggregatedDomains" attribute of
+    /// this object.
+    bsl::vector<bsl::string>& aggregatedDomains();
+
+    /// Return a reference to the modifiable "ExportHistograms" attribute of
+    /// this object.
+    bool& exportHistograms();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -7631,6 +7721,13 @@ class StatPluginConfigPrometheus {
     /// Return the value of the "Port" attribute of this object.
     int port() const;
 
+    /// Return a reference offering non-modifiable access to the
+    /// "AggregatedDomains" attribute of this object.
+    const bsl::vector<bsl::string>& aggregatedDomains() const;
+
+    /// Return the value of the "ExportHistograms" attribute of this object.
+    bool exportHistograms() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -7640,7 +7737,9 @@ class StatPluginConfigPrometheus {
                            const StatPluginConfigPrometheus& rhs)
     {
         return lhs.mode() == rhs.mode() && lhs.host() == rhs.host() &&
-               lhs.port() == rhs.port();
+               lhs.port() == rhs.port() &&
+               lhs.aggregatedDomains() == rhs.aggregatedDomains() &&
+               lhs.exportHistograms() == rhs.exportHistograms();
     }
 
     /// Return `true` if the specified `lhs` and `rhs` objects do not have the
@@ -7994,10 +8093,12 @@ class TcpInterfaceConfig {
     bsls::Types::Int64                d_nodeHighWatermark;
     bsl::vector<TcpInterfaceListener> d_listeners;
     bsl::string                       d_name;
+    bsl::string                       d_shmEndpoint;
     int                               d_port;
     int                               d_ioThreads;
     int                               d_maxConnections;
     int                               d_heartbeatIntervalMs;
+    bool                              d_ioRing;
 
     // PRIVATE ACCESSORS
 
@@ -8019,10 +8120,12 @@ class TcpInterfaceConfig {
         ATTRIBUTE_ID_NODE_LOW_WATERMARK    = 6,
         ATTRIBUTE_ID_NODE_HIGH_WATERMARK   = 7,
         ATTRIBUTE_ID_HEARTBEAT_INTERVAL_MS = 8,
-        ATTRIBUTE_ID_LISTENERS             = 9
+        ATTRIBUTE_ID_LISTENERS             = 9,
+        ATTRIBUTE_ID_IO_RING               = 10,
+        ATTRIBUTE_ID_SHM_ENDPOINT          = 11
     };
 
-    enum { NUM_ATTRIBUTES = 10 };
+    enum { NUM_ATTRIBUTES = 12 };
 
     enum {
         ATTRIBUTE_INDEX_NAME                  = 0,
@@ -8034,7 +8137,9 @@ class TcpInterfaceConfig {
         ATTRIBUTE_INDEX_NODE_LOW_WATERMARK    = 6,
         ATTRIBUTE_INDEX_NODE_HIGH_WATERMARK   = 7,
         ATTRIBUTE_INDEX_HEARTBEAT_INTERVAL_MS = 8,
-        ATTRIBUTE_INDEX_LISTENERS             = 9
+        ATTRIBUTE_INDEX_LISTENERS             = 9,
+        ATTRIBUTE_INDEX_IO_RING               = 10,
+        ATTRIBUTE_INDEX_SHM_ENDPOINT          = 11
     };
 
     // CONSTANTS
@@ -8049,6 +8154,10 @@ class TcpInterfaceConfig {
 
     static const int DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS;
 
+    static const bool DEFAULT_INITIALIZER_IO_RING;
+
+    static const char DEFAULT_INITIALIZER_SHM_ENDPOINT[];
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -8183,6 +8292,13 @@ class TcpInterfaceConfig {
     /// object.
     bsl::vector<TcpInterfaceListener>& listeners();
 
+    /// Return a reference to the modifiable "IoRing" attribute of this object.
+    bool& ioRing();
+
+    /// Return a reference to the modifiable "ShmEndpoint" attribute of this
+    /// object.
+    bsl::string& shmEndpoint();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -8259,6 +8375,13 @@ class TcpInterfaceConfig {
     /// attribute of this object.
     const bsl::vector<TcpInterfaceListener>& listeners() const;
 
+    /// Return the value of the "IoRing" attribute of this object.
+    bool ioRing() const;
+
+    /// Return a reference offering non-modifiable access to the
+    /// "ShmEndpoint" attribute of this object.
+    const bsl::string& shmEndpoint() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -9281,6 +9404,7 @@ class DispatcherConfig {
     DispatcherProcessorConfig d_clusters;
     int                       d_alarmTimeoutMs;
     int                       d_warningTimeoutMs;
+    bool                      d_numaAware;
 
     // PRIVATE ACCESSORS
 
@@ -9297,17 +9421,19 @@ class DispatcherConfig {
         ATTRIBUTE_ID_QUEUES             = 1,
         ATTRIBUTE_ID_CLUSTERS           = 2,
         ATTRIBUTE_ID_ALARM_TIMEOUT_MS   = 3,
-        ATTRIBUTE_ID_WARNING_TIMEOUT_MS = 4
+        ATTRIBUTE_ID_WARNING_TIMEOUT_MS = 4,
+        ATTRIBUTE_ID_NUMA_AWARE         = 5
     };
 
-    enum { NUM_ATTRIBUTES = 5 };
+    enum { NUM_ATTRIBUTES = 6 };
 
     enum {
         ATTRIBUTE_INDEX_SESSIONS           = 0,
         ATTRIBUTE_INDEX_QUEUES             = 1,
         ATTRIBUTE_INDEX_CLUSTERS           = 2,
         ATTRIBUTE_INDEX_ALARM_TIMEOUT_MS   = 3,
-        ATTRIBUTE_INDEX_WARNING_TIMEOUT_MS = 4
+        ATTRIBUTE_INDEX_WARNING_TIMEOUT_MS = 4,
+        ATTRIBUTE_INDEX_NUMA_AWARE         = 5
     };
 
     // CONSTANTS
@@ -9318,6 +9444,8 @@ class DispatcherConfig {
 
     static const int DEFAULT_INITIALIZER_WARNING_TIMEOUT_MS;
 
+    static const bool DEFAULT_INITIALIZER_NUMA_AWARE;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -9392,6 +9520,10 @@ class DispatcherConfig {
     /// this object.
     int& warningTimeoutMs();
 
+    /// Return a reference to the modifiable "NumaAware" attribute of this
+    /// object.
+    bool& numaAware();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -9454,6 +9586,9 @@ class DispatcherConfig {
     /// Return the value of the "WarningTimeoutMs" attribute of this object.
     int warningTimeoutMs() const;
 
+    /// Return the value of the "NumaAware" attribute of this object.
+    bool numaAware() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -15478,6 +15613,8 @@ void QueueOperationsConfig::hashAppendImpl(
     hashAppend(hashAlgorithm, this->stopTimeoutMs());
     hashAppend(hashAlgorithm, this->shutdownTimeoutMs());
     hashAppend(hashAlgorithm, this->ackWindowSize());
+    hashAppend(hashAlgorithm, this->assignmentBatchWindowMs());
+    hashAppend(hashAlgorithm, this->assignmentBatchMaxSize());
 }
 
 inline bool
@@ -15495,7 +15632,9 @@ QueueOperationsConfig::isEqualTo(const QueueOperationsConfig& rhs) const
                rhs.consumptionMonitorPeriodMs() &&
            this->stopTimeoutMs() == rhs.stopTimeoutMs() &&
            this->shutdownTimeoutMs() == rhs.shutdownTimeoutMs() &&
-           this->ackWindowSize() == rhs.ackWindowSize();
+           this->ackWindowSize() == rhs.ackWindowSize() &&
+           this->assignmentBatchWindowMs() == rhs.assignmentBatchWindowMs() &&
+           this->assignmentBatchMaxSize() == rhs.assignmentBatchMaxSize();
 }
 
 // CLASS METHODS
@@ -15584,6 +15723,20 @@ int QueueOperationsConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_assignmentBatchWindowMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ASSIGNMENT_BATCH_WINDOW_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_assignmentBatchMaxSize,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ASSIGNMENT_BATCH_MAX_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -15655,6 +15808,16 @@ int QueueOperationsConfig::manipulateAttribute(t_MANIPULATOR& manipulator,
             &d_ackWindowSize,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ACK_WINDOW_SIZE]);
     }
+    case ATTRIBUTE_ID_ASSIGNMENT_BATCH_WINDOW_MS: {
+        return manipulator(
+            &d_assignmentBatchWindowMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ASSIGNMENT_BATCH_WINDOW_MS]);
+    }
+    case ATTRIBUTE_ID_ASSIGNMENT_BATCH_MAX_SIZE: {
+        return manipulator(
+            &d_assignmentBatchMaxSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ASSIGNMENT_BATCH_MAX_SIZE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -15735,6 +15898,16 @@ inline int& QueueOperationsConfig::ackWindowSize()
     return d_ackWindowSize;
 }
 
+inline int& QueueOperationsConfig::assignmentBatchWindowMs()
+{
+    return d_assignmentBatchWindowMs;
+}
+
+inline int& QueueOperationsConfig::assignmentBatchMaxSize()
+{
+    return d_assignmentBatchMaxSize;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int QueueOperationsConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -15817,6 +15990,20 @@ int QueueOperationsConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_assignmentBatchWindowMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ASSIGNMENT_BATCH_WINDOW_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_assignmentBatchMaxSize,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ASSIGNMENT_BATCH_MAX_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -15883,6 +16070,16 @@ int QueueOperationsConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_ackWindowSize,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ACK_WINDOW_SIZE]);
     }
+    case ATTRIBUTE_ID_ASSIGNMENT_BATCH_WINDOW_MS: {
+        return accessor(
+            d_assignmentBatchWindowMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ASSIGNMENT_BATCH_WINDOW_MS]);
+    }
+    case ATTRIBUTE_ID_ASSIGNMENT_BATCH_MAX_SIZE: {
+        return accessor(
+            d_assignmentBatchMaxSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ASSIGNMENT_BATCH_MAX_SIZE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -15963,6 +16160,16 @@ inline int QueueOperationsConfig::ackWindowSize() const
     return d_ackWindowSize;
 }
 
+inline int QueueOperationsConfig::assignmentBatchWindowMs() const
+{
+    return d_assignmentBatchWindowMs;
+}
+
+inline int QueueOperationsConfig::assignmentBatchMaxSize() const
+{
+    return d_assignmentBatchMaxSize;
+}
+
 // --------------------
 // class ResolvedDomain
 // --------------------
@@ -16137,6 +16344,7 @@ void StorageSyncConfig::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->startupWaitDurationMs());
     hashAppend(hashAlgorithm, this->fileChunkSize());
     hashAppend(hashAlgorithm, this->partitionSyncEventSize());
+    hashAppend(hashAlgorithm, this->maxFileChunksInFlight());
 }
 
 inline bool StorageSyncConfig::isEqualTo(const StorageSyncConfig& rhs) const
@@ -16152,7 +16360,8 @@ inline bool StorageSyncConfig::isEqualTo(const StorageSyncConfig& rhs) const
                rhs.partitionSyncDataReqTimeoutMs() &&
            this->startupWaitDurationMs() == rhs.startupWaitDurationMs() &&
            this->fileChunkSize() == rhs.fileChunkSize() &&
-           this->partitionSyncEventSize() == rhs.partitionSyncEventSize();
+           this->partitionSyncEventSize() == rhs.partitionSyncEventSize() &&
+           this->maxFileChunksInFlight() == rhs.maxFileChunksInFlight();
 }
 
 // CLASS METHODS
@@ -16226,6 +16435,13 @@ int StorageSyncConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_maxFileChunksInFlight,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_FILE_CHUNKS_IN_FLIGHT]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -16283,6 +16499,11 @@ int StorageSyncConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_partitionSyncEventSize,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE]);
     }
+    case ATTRIBUTE_ID_MAX_FILE_CHUNKS_IN_FLIGHT: {
+        return manipulator(
+            &d_maxFileChunksInFlight,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_FILE_CHUNKS_IN_FLIGHT]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -16348,6 +16569,11 @@ inline int& StorageSyncConfig::partitionSyncEventSize()
     return d_partitionSyncEventSize;
 }
 
+inline int& StorageSyncConfig::maxFileChunksInFlight()
+{
+    return d_maxFileChunksInFlight;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int StorageSyncConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -16416,6 +16642,13 @@ int StorageSyncConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_maxFileChunksInFlight,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_FILE_CHUNKS_IN_FLIGHT]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -16472,6 +16705,11 @@ int StorageSyncConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
             d_partitionSyncEventSize,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE]);
     }
+    case ATTRIBUTE_ID_MAX_FILE_CHUNKS_IN_FLIGHT: {
+        return accessor(
+            d_maxFileChunksInFlight,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_FILE_CHUNKS_IN_FLIGHT]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -16537,6 +16775,11 @@ inline int StorageSyncConfig::partitionSyncEventSize() const
     return d_partitionSyncEventSize;
 }
 
+inline int StorageSyncConfig::maxFileChunksInFlight() const
+{
+    return d_maxFileChunksInFlight;
+}
+
 // ------------------
 // class SyslogConfig
 // ------------------
@@ -18257,6 +18500,8 @@ void PartitionConfig::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->prefaultPages());
     hashAppend(hashAlgorithm, this->flushAtShutdown());
     hashAppend(hashAlgorithm, this->syncConfig());
+    hashAppend(hashAlgorithm, this->groupSyncIntervalUs());
+    hashAppend(hashAlgorithm, this->groupSyncBytes());
 }
 
 inline bool PartitionConfig::isEqualTo(const PartitionConfig& rhs) const
@@ -18272,7 +18517,9 @@ inline bool PartitionConfig::isEqualTo(const PartitionConfig& rhs) const
            this->maxArchivedFileSets() == rhs.maxArchivedFileSets() &&
            this->prefaultPages() == rhs.prefaultPages() &&
            this->flushAtShutdown() == rhs.flushAtShutdown() &&
-           this->syncConfig() == rhs.syncConfig();
+           this->syncConfig() == rhs.syncConfig() &&
+           this->groupSyncIntervalUs() == rhs.groupSyncIntervalUs() &&
+           this->groupSyncBytes() == rhs.groupSyncBytes();
 }
 
 // CLASS METHODS
@@ -18359,6 +18606,19 @@ int PartitionConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_groupSyncIntervalUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_SYNC_INTERVAL_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_groupSyncBytes,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_SYNC_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -18425,6 +18685,16 @@ int PartitionConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_syncConfig,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG]);
     }
+    case ATTRIBUTE_ID_GROUP_SYNC_INTERVAL_US: {
+        return manipulator(
+            &d_groupSyncIntervalUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_SYNC_INTERVAL_US]);
+    }
+    case ATTRIBUTE_ID_GROUP_SYNC_BYTES: {
+        return manipulator(
+            &d_groupSyncBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_SYNC_BYTES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -18505,6 +18775,16 @@ inline StorageSyncConfig& PartitionConfig::syncConfig()
     return d_syncConfig;
 }
 
+inline int& PartitionConfig::groupSyncIntervalUs()
+{
+    return d_groupSyncIntervalUs;
+}
+
+inline int& PartitionConfig::groupSyncBytes()
+{
+    return d_groupSyncBytes;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int PartitionConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -18584,6 +18864,19 @@ int PartitionConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_groupSyncIntervalUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_SYNC_INTERVAL_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_groupSyncBytes,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_SYNC_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -18648,6 +18941,16 @@ int PartitionConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_syncConfig,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG]);
     }
+    case ATTRIBUTE_ID_GROUP_SYNC_INTERVAL_US: {
+        return accessor(
+            d_groupSyncIntervalUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_SYNC_INTERVAL_US]);
+    }
+    case ATTRIBUTE_ID_GROUP_SYNC_BYTES: {
+        return accessor(
+            d_groupSyncBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_SYNC_BYTES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -18728,6 +19031,16 @@ inline const StorageSyncConfig& PartitionConfig::syncConfig() const
     return d_syncConfig;
 }
 
+inline int PartitionConfig::groupSyncIntervalUs() const
+{
+    return d_groupSyncIntervalUs;
+}
+
+inline int PartitionConfig::groupSyncBytes() const
+{
+    return d_groupSyncBytes;
+}
+
 // ---------------------------
 // class PluginSettingKeyValue
 // ---------------------------
@@ -18870,6 +19183,8 @@ void StatPluginConfigPrometheus::hashAppendImpl(
     hashAppend(hashAlgorithm, this->mode());
     hashAppend(hashAlgorithm, this->host());
     hashAppend(hashAlgorithm, this->port());
+    hashAppend(hashAlgorithm, this->aggregatedDomains());
+    hashAppend(hashAlgorithm, this->exportHistograms());
 }
 
 // CLASS METHODS
@@ -18895,6 +19210,19 @@ int StatPluginConfigPrometheus::manipulateAttributes(
         return ret;
     }
 
+    ret = manipulator(
+        &d_aggregatedDomains,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AGGREGATED_DOMAINS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_exportHistograms,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EXPORT_HISTOGRAMS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -18917,6 +19245,16 @@ int StatPluginConfigPrometheus::manipulateAttribute(t_MANIPULATOR& manipulator,
         return manipulator(&d_port,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PORT]);
     }
+    case ATTRIBUTE_ID_AGGREGATED_DOMAINS: {
+        return manipulator(
+            &d_aggregatedDomains,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AGGREGATED_DOMAINS]);
+    }
+    case ATTRIBUTE_ID_EXPORT_HISTOGRAMS: {
+        return manipulator(
+            &d_exportHistograms,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EXPORT_HISTOGRAMS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -18952,6 +19290,17 @@ inline int& StatPluginConfigPrometheus::port()
     return d_port;
 }
 
+inline bsl::vector<bsl::string>&
+StatPluginConfigPrometheus::aggregatedDomains()
+{
+    return d_aggregatedDomains;
+}
+
+inline bool& StatPluginConfigPrometheus::exportHistograms()
+{
+    return d_exportHistograms;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int StatPluginConfigPrometheus::accessAttributes(t_ACCESSOR& accessor) const
@@ -18973,6 +19322,18 @@ int StatPluginConfigPrometheus::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_aggregatedDomains,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AGGREGATED_DOMAINS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_exportHistograms,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EXPORT_HISTOGRAMS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -18992,6 +19353,16 @@ int StatPluginConfigPrometheus::accessAttribute(t_ACCESSOR& accessor,
     case ATTRIBUTE_ID_PORT: {
         return accessor(d_port, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PORT]);
     }
+    case ATTRIBUTE_ID_AGGREGATED_DOMAINS: {
+        return accessor(
+            d_aggregatedDomains,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AGGREGATED_DOMAINS]);
+    }
+    case ATTRIBUTE_ID_EXPORT_HISTOGRAMS: {
+        return accessor(
+            d_exportHistograms,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EXPORT_HISTOGRAMS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -19027,6 +19398,17 @@ inline int StatPluginConfigPrometheus::port() const
     return d_port;
 }
 
+inline const bsl::vector<bsl::string>&
+StatPluginConfigPrometheus::aggregatedDomains() const
+{
+    return d_aggregatedDomains;
+}
+
+inline bool StatPluginConfigPrometheus::exportHistograms() const
+{
+    return d_exportHistograms;
+}
+
 // ------------------------
 // class StatsPrinterConfig
 // ------------------------
@@ -19321,6 +19703,8 @@ void TcpInterfaceConfig::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->nodeHighWatermark());
     hashAppend(hashAlgorithm, this->heartbeatIntervalMs());
     hashAppend(hashAlgorithm, this->listeners());
+    hashAppend(hashAlgorithm, this->ioRing());
+    hashAppend(hashAlgorithm, this->shmEndpoint());
 }
 
 inline bool TcpInterfaceConfig::isEqualTo(const TcpInterfaceConfig& rhs) const
@@ -19333,7 +19717,9 @@ inline bool TcpInterfaceConfig::isEqualTo(const TcpInterfaceConfig& rhs) const
            this->nodeLowWatermark() == rhs.nodeLowWatermark() &&
            this->nodeHighWatermark() == rhs.nodeHighWatermark() &&
            this->heartbeatIntervalMs() == rhs.heartbeatIntervalMs() &&
-           this->listeners() == rhs.listeners();
+           this->listeners() == rhs.listeners() &&
+           this->ioRing() == rhs.ioRing() &&
+           this->shmEndpoint() == rhs.shmEndpoint();
 }
 
 // CLASS METHODS
@@ -19404,6 +19790,18 @@ int TcpInterfaceConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_ioRing,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_IO_RING]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_shmEndpoint,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SHM_ENDPOINT]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -19459,6 +19857,14 @@ int TcpInterfaceConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_listeners,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LISTENERS]);
     }
+    case ATTRIBUTE_ID_IO_RING: {
+        return manipulator(&d_ioRing,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_IO_RING]);
+    }
+    case ATTRIBUTE_ID_SHM_ENDPOINT: {
+        return manipulator(&d_shmEndpoint,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SHM_ENDPOINT]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -19529,6 +19935,16 @@ inline bsl::vector<TcpInterfaceListener>& TcpInterfaceConfig::listeners()
     return d_listeners;
 }
 
+inline bool& TcpInterfaceConfig::ioRing()
+{
+    return d_ioRing;
+}
+
+inline bsl::string& TcpInterfaceConfig::shmEndpoint()
+{
+    return d_shmEndpoint;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int TcpInterfaceConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -19594,6 +20010,17 @@ int TcpInterfaceConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_ioRing, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_IO_RING]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_shmEndpoint,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SHM_ENDPOINT]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -19644,6 +20071,14 @@ int TcpInterfaceConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_listeners,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LISTENERS]);
     }
+    case ATTRIBUTE_ID_IO_RING: {
+        return accessor(d_ioRing,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_IO_RING]);
+    }
+    case ATTRIBUTE_ID_SHM_ENDPOINT: {
+        return accessor(d_shmEndpoint,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SHM_ENDPOINT]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -19715,6 +20150,16 @@ TcpInterfaceConfig::listeners() const
     return d_listeners;
 }
 
+inline bool TcpInterfaceConfig::ioRing() const
+{
+    return d_ioRing;
+}
+
+inline const bsl::string& TcpInterfaceConfig::shmEndpoint() const
+{
+    return d_shmEndpoint;
+}
+
 // -------------------------------
 // class AuthenticatorPluginConfig
 // -------------------------------
@@ -20337,6 +20782,7 @@ void DispatcherConfig::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->clusters());
     hashAppend(hashAlgorithm, this->alarmTimeoutMs());
     hashAppend(hashAlgorithm, this->warningTimeoutMs());
+    hashAppend(hashAlgorithm, this->numaAware());
 }
 
 inline bool DispatcherConfig::isEqualTo(const DispatcherConfig& rhs) const
@@ -20345,7 +20791,8 @@ inline bool DispatcherConfig::isEqualTo(const DispatcherConfig& rhs) const
            this->queues() == rhs.queues() &&
            this->clusters() == rhs.clusters() &&
            this->alarmTimeoutMs() == rhs.alarmTimeoutMs() &&
-           this->warningTimeoutMs() == rhs.warningTimeoutMs();
+           this->warningTimeoutMs() == rhs.warningTimeoutMs() &&
+           this->numaAware() == rhs.numaAware();
 }
 
 // CLASS METHODS
@@ -20385,6 +20832,12 @@ int DispatcherConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_numaAware,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUMA_AWARE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -20416,6 +20869,10 @@ int DispatcherConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_warningTimeoutMs,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WARNING_TIMEOUT_MS]);
     }
+    case ATTRIBUTE_ID_NUMA_AWARE: {
+        return manipulator(&d_numaAware,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUMA_AWARE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -20461,6 +20918,11 @@ inline int& DispatcherConfig::warningTimeoutMs()
     return d_warningTimeoutMs;
 }
 
+inline bool& DispatcherConfig::numaAware()
+{
+    return d_numaAware;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int DispatcherConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -20494,6 +20956,12 @@ int DispatcherConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_numaAware,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUMA_AWARE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -20525,6 +20993,10 @@ int DispatcherConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
             d_warningTimeoutMs,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WARNING_TIMEOUT_MS]);
     }
+    case ATTRIBUTE_ID_NUMA_AWARE: {
+        return accessor(d_numaAware,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUMA_AWARE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -20570,6 +21042,11 @@ inline int DispatcherConfig::warningTimeoutMs() const
     return d_warningTimeoutMs;
 }
 
+inline bool DispatcherConfig::numaAware() const
+{
+    return d_numaAware;
+}
+
 // -----------------------
 // class NetworkInterfaces
 // -----------------------
@@ -29,6 +29,7 @@
 // BDE
 #include <bdlb_print.h>
 #include <bdlb_string.h>
+#include <bdlt_timeunitratio.h>
 #include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_iomanip.h>
@@ -512,6 +513,30 @@ void printClusterStorageSummary(bsl::ostream&                os,
                               spacesPerLevel);
         os << "\n";
     }
+
+    typedef bsl::vector<PartitionSyncProgress> PartitionSyncs;
+    const PartitionSyncs& partitionSyncs = summary.partitionSyncs();
+    for (PartitionSyncs::const_iterator cit = partitionSyncs.cbegin();
+         cit != partitionSyncs.cend();
+         ++cit) {
+        const bsls::Types::Uint64 percent =
+            cit->totalBytes() == 0
+                ? 100
+                : (cit->sentBytes() * 100) / cit->totalBytes();
+
+        os << bmqu::PrintUtil::newlineAndIndent(level, spacesPerLevel)
+           << "Partition [" << cit->partitionId()
+           << "]: syncing node [" << cit->peerNodeId() << "]: "
+           << bmqu::PrintUtil::prettyBytes(cit->sentBytes()) << " / "
+           << bmqu::PrintUtil::prettyBytes(cit->totalBytes()) << " ("
+           << percent << " %) in "
+           << bmqu::PrintUtil::prettyTimeInterval(
+                  static_cast<bsls::Types::Int64>(cit->elapsedTimeMs()) *
+                  bdlt::TimeUnitRatio::k_NS_PER_MS)
+           << ", "
+           << bmqu::PrintUtil::prettyBytes(cit->throughputBytesPerSec())
+           << "/s.";
+    }
 }
 
 void printClusterQueueHelper(bsl::ostream&             os,
@@ -2961,6 +2961,126 @@ const char* PrimaryStatus::toString(PrimaryStatus::Value value)
     return 0;
 }
 
+// ---------------------------
+// class PartitionSyncProgress
+// ---------------------------
+
+// CONSTANTS
+
+const char PartitionSyncProgress::CLASS_NAME[] = "PartitionSyncProgress";
+
+const bdlat_AttributeInfo PartitionSyncProgress::ATTRIBUTE_INFO_ARRAY[] = {
+    {ATTRIBUTE_ID_PARTITION_ID,
+     "partitionId",
+     sizeof("partitionId") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_PEER_NODE_ID,
+     "peerNodeId",
+     sizeof("peerNodeId") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_TOTAL_BYTES,
+     "totalBytes",
+     sizeof("totalBytes") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_SENT_BYTES,
+     "sentBytes",
+     sizeof("sentBytes") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_ELAPSED_TIME_MS,
+     "elapsedTimeMs",
+     sizeof("elapsedTimeMs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_THROUGHPUT_BYTES_PER_SEC,
+     "throughputBytesPerSec",
+     sizeof("throughputBytesPerSec") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
+
+// CLASS METHODS
+
+const bdlat_AttributeInfo*
+PartitionSyncProgress::lookupAttributeInfo(const char* name, int nameLength)
+{
+    for (int i = 0; i < 6; ++i) {
+        const bdlat_AttributeInfo& attributeInfo =
+            PartitionSyncProgress::ATTRIBUTE_INFO_ARRAY[i];
+
+        if (nameLength == attributeInfo.d_nameLength &&
+            0 == bsl::memcmp(attributeInfo.d_name_p, name, nameLength)) {
+            return &attributeInfo;
+        }
+    }
+
+    return 0;
+}
+
+const bdlat_AttributeInfo* PartitionSyncProgress::lookupAttributeInfo(int id)
+{
+    switch (id) {
+    case ATTRIBUTE_ID_PARTITION_ID:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_ID];
+    case ATTRIBUTE_ID_PEER_NODE_ID:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PEER_NODE_ID];
+    case ATTRIBUTE_ID_TOTAL_BYTES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TOTAL_BYTES];
+    case ATTRIBUTE_ID_SENT_BYTES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SENT_BYTES];
+    case ATTRIBUTE_ID_ELAPSED_TIME_MS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ELAPSED_TIME_MS];
+    case ATTRIBUTE_ID_THROUGHPUT_BYTES_PER_SEC:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_THROUGHPUT_BYTES_PER_SEC];
+    default: return 0;
+    }
+}
+
+// CREATORS
+
+PartitionSyncProgress::PartitionSyncProgress()
+: d_totalBytes()
+, d_sentBytes()
+, d_elapsedTimeMs()
+, d_throughputBytesPerSec()
+, d_partitionId()
+, d_peerNodeId()
+{
+}
+
+// MANIPULATORS
+
+void PartitionSyncProgress::reset()
+{
+    bdlat_ValueTypeFunctions::reset(&d_partitionId);
+    bdlat_ValueTypeFunctions::reset(&d_peerNodeId);
+    bdlat_ValueTypeFunctions::reset(&d_totalBytes);
+    bdlat_ValueTypeFunctions::reset(&d_sentBytes);
+    bdlat_ValueTypeFunctions::reset(&d_elapsedTimeMs);
+    bdlat_ValueTypeFunctions::reset(&d_throughputBytesPerSec);
+}
+
+// ACCESSORS
+
+bsl::ostream& PartitionSyncProgress::print(bsl::ostream& stream,
+                                           int           level,
+                                           int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("partitionId", this->partitionId());
+    printer.printAttribute("peerNodeId", this->peerNodeId());
+    printer.printAttribute("totalBytes", this->totalBytes());
+    printer.printAttribute("sentBytes", this->sentBytes());
+    printer.printAttribute("elapsedTimeMs", this->elapsedTimeMs());
+    printer.printAttribute("throughputBytesPerSec",
+                           this->throughputBytesPerSec());
+    printer.end();
+    return stream;
+}
+
 // ------------------------
 // class PurgedQueueDetails
 // ------------------------
@@ -15895,6 +16015,11 @@ const bdlat_AttributeInfo ClusterStorageSummary::ATTRIBUTE_INFO_ARRAY[] = {
      "fileStores",
      sizeof("fileStores") - 1,
      "",
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_PARTITION_SYNCS,
+     "partitionSyncs",
+     sizeof("partitionSyncs") - 1,
+     "",
      bdlat_FormattingMode::e_DEFAULT}};
 
 // CLASS METHODS
@@ -15902,7 +16027,7 @@ const bdlat_AttributeInfo ClusterStorageSummary::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo*
 ClusterStorageSummary::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 2; ++i) {
+    for (int i = 0; i < 3; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             ClusterStorageSummary::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -15923,6 +16048,8 @@ const bdlat_AttributeInfo* ClusterStorageSummary::lookupAttributeInfo(int id)
             [ATTRIBUTE_INDEX_CLUSTER_FILE_STORE_LOCATION];
     case ATTRIBUTE_ID_FILE_STORES:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FILE_STORES];
+    case ATTRIBUTE_ID_PARTITION_SYNCS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_SYNCS];
     default: return 0;
     }
 }
@@ -15931,6 +16058,7 @@ const bdlat_AttributeInfo* ClusterStorageSummary::lookupAttributeInfo(int id)
 
 ClusterStorageSummary::ClusterStorageSummary(bslma::Allocator* basicAllocator)
 : d_fileStores(basicAllocator)
+, d_partitionSyncs(basicAllocator)
 , d_clusterFileStoreLocation(basicAllocator)
 {
 }
@@ -15939,6 +16067,7 @@ ClusterStorageSummary::ClusterStorageSummary(
     const ClusterStorageSummary& original,
     bslma::Allocator*            basicAllocator)
 : d_fileStores(original.d_fileStores, basicAllocator)
+, d_partitionSyncs(original.d_partitionSyncs, basicAllocator)
 , d_clusterFileStoreLocation(original.d_clusterFileStoreLocation,
                              basicAllocator)
 {
@@ -15949,6 +16078,7 @@ ClusterStorageSummary::ClusterStorageSummary(
 ClusterStorageSummary::ClusterStorageSummary(
     ClusterStorageSummary&& original) noexcept
 : d_fileStores(bsl::move(original.d_fileStores)),
+  d_partitionSyncs(bsl::move(original.d_partitionSyncs)),
   d_clusterFileStoreLocation(bsl::move(original.d_clusterFileStoreLocation))
 {
 }
@@ -15956,6 +16086,7 @@ ClusterStorageSummary::ClusterStorageSummary(
 ClusterStorageSummary::ClusterStorageSummary(ClusterStorageSummary&& original,
                                              bslma::Allocator* basicAllocator)
 : d_fileStores(bsl::move(original.d_fileStores), basicAllocator)
+, d_partitionSyncs(bsl::move(original.d_partitionSyncs), basicAllocator)
 , d_clusterFileStoreLocation(bsl::move(original.d_clusterFileStoreLocation),
                              basicAllocator)
 {
@@ -15974,6 +16105,7 @@ ClusterStorageSummary::operator=(const ClusterStorageSummary& rhs)
     if (this != &rhs) {
         d_clusterFileStoreLocation = rhs.d_clusterFileStoreLocation;
         d_fileStores               = rhs.d_fileStores;
+        d_partitionSyncs           = rhs.d_partitionSyncs;
     }
 
     return *this;
@@ -15987,6 +16119,7 @@ ClusterStorageSummary::operator=(ClusterStorageSummary&& rhs)
     if (this != &rhs) {
         d_clusterFileStoreLocation = bsl::move(rhs.d_clusterFileStoreLocation);
         d_fileStores               = bsl::move(rhs.d_fileStores);
+        d_partitionSyncs           = bsl::move(rhs.d_partitionSyncs);
     }
 
     return *this;
@@ -15997,6 +16130,7 @@ void ClusterStorageSummary::reset()
 {
     bdlat_ValueTypeFunctions::reset(&d_clusterFileStoreLocation);
     bdlat_ValueTypeFunctions::reset(&d_fileStores);
+    bdlat_ValueTypeFunctions::reset(&d_partitionSyncs);
 }
 
 // ACCESSORS
@@ -16010,6 +16144,7 @@ bsl::ostream& ClusterStorageSummary::print(bsl::ostream& stream,
     printer.printAttribute("clusterFileStoreLocation",
                            this->clusterFileStoreLocation());
     printer.printAttribute("fileStores", this->fileStores());
+    printer.printAttribute("partitionSyncs", this->partitionSyncs());
     printer.end();
     return stream;
 }
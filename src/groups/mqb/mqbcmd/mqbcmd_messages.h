@@ -120,6 +120,9 @@ namespace mqbcmd {
 class Message;
 }
 namespace mqbcmd {
+class PartitionSyncProgress;
+}
+namespace mqbcmd {
 class PurgedQueueDetails;
 }
 namespace mqbcmd {
@@ -4961,6 +4964,243 @@ BDLAT_DECL_ENUMERATION_TRAITS(mqbcmd::PrimaryStatus);
 
 namespace mqbcmd {
 
+// ===========================
+// class PartitionSyncProgress
+// ===========================
+
+class PartitionSyncProgress {
+    // Progress of the transfer of the files of a partition from this node
+    // to a peer being synchronized.
+
+    // INSTANCE DATA
+    bsls::Types::Uint64 d_totalBytes;
+    bsls::Types::Uint64 d_sentBytes;
+    bsls::Types::Uint64 d_elapsedTimeMs;
+    bsls::Types::Uint64 d_throughputBytesPerSec;
+    int                 d_partitionId;
+    int                 d_peerNodeId;
+
+    // PRIVATE ACCESSORS
+    template <typename t_HASH_ALGORITHM>
+    void hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const;
+
+  public:
+    // TYPES
+    enum {
+        ATTRIBUTE_ID_PARTITION_ID             = 0,
+        ATTRIBUTE_ID_PEER_NODE_ID             = 1,
+        ATTRIBUTE_ID_TOTAL_BYTES              = 2,
+        ATTRIBUTE_ID_SENT_BYTES               = 3,
+        ATTRIBUTE_ID_ELAPSED_TIME_MS          = 4,
+        ATTRIBUTE_ID_THROUGHPUT_BYTES_PER_SEC = 5
+    };
+
+    enum { NUM_ATTRIBUTES = 6 };
+
+    enum {
+        ATTRIBUTE_INDEX_PARTITION_ID             = 0,
+        ATTRIBUTE_INDEX_PEER_NODE_ID             = 1,
+        ATTRIBUTE_INDEX_TOTAL_BYTES              = 2,
+        ATTRIBUTE_INDEX_SENT_BYTES               = 3,
+        ATTRIBUTE_INDEX_ELAPSED_TIME_MS          = 4,
+        ATTRIBUTE_INDEX_THROUGHPUT_BYTES_PER_SEC = 5
+    };
+
+    // CONSTANTS
+    static const char CLASS_NAME[];
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+  public:
+    // CLASS METHODS
+    static const bdlat_AttributeInfo* lookupAttributeInfo(int id);
+    // Return attribute information for the attribute indicated by the
+    // specified 'id' if the attribute exists, and 0 otherwise.
+
+    static const bdlat_AttributeInfo* lookupAttributeInfo(const char* name,
+                                                          int nameLength);
+    // Return attribute information for the attribute indicated by the
+    // specified 'name' of the specified 'nameLength' if the attribute
+    // exists, and 0 otherwise.
+
+    // CREATORS
+    PartitionSyncProgress();
+    // Create an object of type 'PartitionSyncProgress' having the default
+    // value.
+
+    // MANIPULATORS
+    void reset();
+    // Reset this object to the default value (i.e., its value upon
+    // default construction).
+
+    template <typename t_MANIPULATOR>
+    int manipulateAttributes(t_MANIPULATOR& manipulator);
+    // Invoke the specified 'manipulator' sequentially on the address of
+    // each (modifiable) attribute of this object, supplying 'manipulator'
+    // with the corresponding attribute information structure until such
+    // invocation returns a non-zero value.  Return the value from the
+    // last invocation of 'manipulator' (i.e., the invocation that
+    // terminated the sequence).
+
+    template <typename t_MANIPULATOR>
+    int manipulateAttribute(t_MANIPULATOR& manipulator, int id);
+    // Invoke the specified 'manipulator' on the address of
+    // the (modifiable) attribute indicated by the specified 'id',
+    // supplying 'manipulator' with the corresponding attribute
+    // information structure.  Return the value returned from the
+    // invocation of 'manipulator' if 'id' identifies an attribute of this
+    // class, and -1 otherwise.
+
+    template <typename t_MANIPULATOR>
+    int manipulateAttribute(t_MANIPULATOR& manipulator,
+                            const char*    name,
+                            int            nameLength);
+    // Invoke the specified 'manipulator' on the address of
+    // the (modifiable) attribute indicated by the specified 'name' of the
+    // specified 'nameLength', supplying 'manipulator' with the
+    // corresponding attribute information structure.  Return the value
+    // returned from the invocation of 'manipulator' if 'name' identifies
+    // an attribute of this class, and -1 otherwise.
+
+    int& partitionId();
+    // Return a reference to the modifiable "PartitionId" attribute of
+    // this object.
+
+    int& peerNodeId();
+    // Return a reference to the modifiable "PeerNodeId" attribute of
+    // this object.
+
+    bsls::Types::Uint64& totalBytes();
+    // Return a reference to the modifiable "TotalBytes" attribute of
+    // this object.
+
+    bsls::Types::Uint64& sentBytes();
+    // Return a reference to the modifiable "SentBytes" attribute of
+    // this object.
+
+    bsls::Types::Uint64& elapsedTimeMs();
+    // Return a reference to the modifiable "ElapsedTimeMs" attribute of
+    // this object.
+
+    bsls::Types::Uint64& throughputBytesPerSec();
+    // Return a reference to the modifiable "ThroughputBytesPerSec"
+    // attribute of this object.
+
+    // ACCESSORS
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+    // Format this object to the specified output 'stream' at the
+    // optionally specified indentation 'level' and return a reference to
+    // the modifiable 'stream'.  If 'level' is specified, optionally
+    // specify 'spacesPerLevel', the number of spaces per indentation level
+    // for this and all of its nested objects.  Each line is indented by
+    // the absolute value of 'level * spacesPerLevel'.  If 'level' is
+    // negative, suppress indentation of the first line.  If
+    // 'spacesPerLevel' is negative, suppress line breaks and format the
+    // entire output on one line.  If 'stream' is initially invalid, this
+    // operation has no effect.  Note that a trailing newline is provided
+    // in multiline mode only.
+
+    template <typename t_ACCESSOR>
+    int accessAttributes(t_ACCESSOR& accessor) const;
+    // Invoke the specified 'accessor' sequentially on each
+    // (non-modifiable) attribute of this object, supplying 'accessor'
+    // with the corresponding attribute information structure until such
+    // invocation returns a non-zero value.  Return the value from the
+    // last invocation of 'accessor' (i.e., the invocation that terminated
+    // the sequence).
+
+    template <typename t_ACCESSOR>
+    int accessAttribute(t_ACCESSOR& accessor, int id) const;
+    // Invoke the specified 'accessor' on the (non-modifiable) attribute
+    // of this object indicated by the specified 'id', supplying 'accessor'
+    // with the corresponding attribute information structure.  Return the
+    // value returned from the invocation of 'accessor' if 'id' identifies
+    // an attribute of this class, and -1 otherwise.
+
+    template <typename t_ACCESSOR>
+    int accessAttribute(t_ACCESSOR& accessor,
+                        const char* name,
+                        int         nameLength) const;
+    // Invoke the specified 'accessor' on the (non-modifiable) attribute
+    // of this object indicated by the specified 'name' of the specified
+    // 'nameLength', supplying 'accessor' with the corresponding attribute
+    // information structure.  Return the value returned from the
+    // invocation of 'accessor' if 'name' identifies an attribute of this
+    // class, and -1 otherwise.
+
+    int partitionId() const;
+    // Return the value of the "PartitionId" attribute of this object.
+
+    int peerNodeId() const;
+    // Return the value of the "PeerNodeId" attribute of this object.
+
+    bsls::Types::Uint64 totalBytes() const;
+    // Return the value of the "TotalBytes" attribute of this object.
+
+    bsls::Types::Uint64 sentBytes() const;
+    // Return the value of the "SentBytes" attribute of this object.
+
+    bsls::Types::Uint64 elapsedTimeMs() const;
+    // Return the value of the "ElapsedTimeMs" attribute of this object.
+
+    bsls::Types::Uint64 throughputBytesPerSec() const;
+    // Return the value of the "ThroughputBytesPerSec" attribute of this
+    // object.
+
+    // HIDDEN FRIENDS
+    friend bool operator==(const PartitionSyncProgress& lhs,
+                           const PartitionSyncProgress& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' attribute objects
+    // have the same value, and 'false' otherwise.  Two attribute objects
+    // have the same value if each respective attribute has the same value.
+    {
+        return lhs.partitionId() == rhs.partitionId() &&
+               lhs.peerNodeId() == rhs.peerNodeId() &&
+               lhs.totalBytes() == rhs.totalBytes() &&
+               lhs.sentBytes() == rhs.sentBytes() &&
+               lhs.elapsedTimeMs() == rhs.elapsedTimeMs() &&
+               lhs.throughputBytesPerSec() == rhs.throughputBytesPerSec();
+    }
+
+    friend bool operator!=(const PartitionSyncProgress& lhs,
+                           const PartitionSyncProgress& rhs)
+    // Returns '!(lhs == rhs)'
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bsl::ostream& operator<<(bsl::ostream&                stream,
+                                    const PartitionSyncProgress& rhs)
+    // Format the specified 'rhs' to the specified output 'stream' and
+    // return a reference to the modifiable 'stream'.
+    {
+        return rhs.print(stream, 0, -1);
+    }
+
+    template <typename t_HASH_ALGORITHM>
+    friend void hashAppend(t_HASH_ALGORITHM&            hashAlg,
+                           const PartitionSyncProgress& object)
+    // Pass the specified 'object' to the specified 'hashAlg'.  This
+    // function integrates with the 'bslh' modular hashing system and
+    // effectively provides a 'bsl::hash' specialization for
+    // 'PartitionSyncProgress'.
+    {
+        object.hashAppendImpl(hashAlg);
+    }
+};
+
+}  // close package namespace
+
+// TRAITS
+
+BDLAT_DECL_SEQUENCE_WITH_BITWISEMOVEABLE_TRAITS(mqbcmd::PartitionSyncProgress);
+template <>
+struct bdlat_UsesDefaultValueFlag<mqbcmd::PartitionSyncProgress>
+: bsl::true_type {};
+
+namespace mqbcmd {
+
 // ========================
 // class PurgedQueueDetails
 // ========================
@@ -20772,21 +21012,24 @@ namespace mqbcmd {
 
 class ClusterStorageSummary {
     // INSTANCE DATA
-    bsl::vector<FileStore> d_fileStores;
-    bsl::string            d_clusterFileStoreLocation;
+    bsl::vector<FileStore>             d_fileStores;
+    bsl::vector<PartitionSyncProgress> d_partitionSyncs;
+    bsl::string                        d_clusterFileStoreLocation;
 
   public:
     // TYPES
     enum {
         ATTRIBUTE_ID_CLUSTER_FILE_STORE_LOCATION = 0,
-        ATTRIBUTE_ID_FILE_STORES                 = 1
+        ATTRIBUTE_ID_FILE_STORES                 = 1,
+        ATTRIBUTE_ID_PARTITION_SYNCS             = 2
     };
 
-    enum { NUM_ATTRIBUTES = 2 };
+    enum { NUM_ATTRIBUTES = 3 };
 
     enum {
         ATTRIBUTE_INDEX_CLUSTER_FILE_STORE_LOCATION = 0,
-        ATTRIBUTE_INDEX_FILE_STORES                 = 1
+        ATTRIBUTE_INDEX_FILE_STORES                 = 1,
+        ATTRIBUTE_INDEX_PARTITION_SYNCS             = 2
     };
 
     // CONSTANTS
@@ -20893,6 +21136,10 @@ class ClusterStorageSummary {
     // Return a reference to the modifiable "FileStores" attribute of this
     // object.
 
+    bsl::vector<PartitionSyncProgress>& partitionSyncs();
+    // Return a reference to the modifiable "PartitionSyncs" attribute of
+    // this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -20944,6 +21191,10 @@ class ClusterStorageSummary {
     // Return a reference offering non-modifiable access to the
     // "FileStores" attribute of this object.
 
+    const bsl::vector<PartitionSyncProgress>& partitionSyncs() const;
+    // Return a reference offering non-modifiable access to the
+    // "PartitionSyncs" attribute of this object.
+
     // HIDDEN FRIENDS
     friend bool operator==(const ClusterStorageSummary& lhs,
                            const ClusterStorageSummary& rhs)
@@ -20953,7 +21204,8 @@ class ClusterStorageSummary {
     {
         return lhs.clusterFileStoreLocation() ==
                    rhs.clusterFileStoreLocation() &&
-               lhs.fileStores() == rhs.fileStores();
+               lhs.fileStores() == rhs.fileStores() &&
+               lhs.partitionSyncs() == rhs.partitionSyncs();
     }
 
     friend bool operator!=(const ClusterStorageSummary& lhs,
@@ -20982,6 +21234,7 @@ class ClusterStorageSummary {
         using bslh::hashAppend;
         hashAppend(hashAlg, object.clusterFileStoreLocation());
         hashAppend(hashAlg, object.fileStores());
+        hashAppend(hashAlg, object.partitionSyncs());
     }
 };
 
@@ -34562,6 +34815,282 @@ inline bsl::ostream& PrimaryStatus::print(bsl::ostream&        stream,
     return stream << toString(value);
 }
 
+// ---------------------------
+// class PartitionSyncProgress
+// ---------------------------
+
+// PRIVATE ACCESSORS
+template <typename t_HASH_ALGORITHM>
+void PartitionSyncProgress::hashAppendImpl(
+    t_HASH_ALGORITHM& hashAlgorithm) const
+{
+    using bslh::hashAppend;
+    hashAppend(hashAlgorithm, this->partitionId());
+    hashAppend(hashAlgorithm, this->peerNodeId());
+    hashAppend(hashAlgorithm, this->totalBytes());
+    hashAppend(hashAlgorithm, this->sentBytes());
+    hashAppend(hashAlgorithm, this->elapsedTimeMs());
+    hashAppend(hashAlgorithm, this->throughputBytesPerSec());
+}
+
+// CLASS METHODS
+// MANIPULATORS
+template <typename t_MANIPULATOR>
+int PartitionSyncProgress::manipulateAttributes(t_MANIPULATOR& manipulator)
+{
+    int ret;
+
+    ret = manipulator(&d_partitionId,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_ID]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_peerNodeId,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PEER_NODE_ID]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_totalBytes,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TOTAL_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_sentBytes,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SENT_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_elapsedTimeMs,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ELAPSED_TIME_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_throughputBytesPerSec,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_THROUGHPUT_BYTES_PER_SEC]);
+    if (ret) {
+        return ret;
+    }
+
+    return 0;
+}
+
+template <typename t_MANIPULATOR>
+int PartitionSyncProgress::manipulateAttribute(t_MANIPULATOR& manipulator,
+                                               int            id)
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_PARTITION_ID: {
+        return manipulator(&d_partitionId,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_ID]);
+    }
+    case ATTRIBUTE_ID_PEER_NODE_ID: {
+        return manipulator(&d_peerNodeId,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PEER_NODE_ID]);
+    }
+    case ATTRIBUTE_ID_TOTAL_BYTES: {
+        return manipulator(&d_totalBytes,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TOTAL_BYTES]);
+    }
+    case ATTRIBUTE_ID_SENT_BYTES: {
+        return manipulator(&d_sentBytes,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SENT_BYTES]);
+    }
+    case ATTRIBUTE_ID_ELAPSED_TIME_MS: {
+        return manipulator(
+            &d_elapsedTimeMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ELAPSED_TIME_MS]);
+    }
+    case ATTRIBUTE_ID_THROUGHPUT_BYTES_PER_SEC: {
+        return manipulator(
+            &d_throughputBytesPerSec,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_THROUGHPUT_BYTES_PER_SEC]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <typename t_MANIPULATOR>
+int PartitionSyncProgress::manipulateAttribute(t_MANIPULATOR& manipulator,
+                                               const char*    name,
+                                               int            nameLength)
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return manipulateAttribute(manipulator, attributeInfo->d_id);
+}
+
+inline int& PartitionSyncProgress::partitionId()
+{
+    return d_partitionId;
+}
+
+inline int& PartitionSyncProgress::peerNodeId()
+{
+    return d_peerNodeId;
+}
+
+inline bsls::Types::Uint64& PartitionSyncProgress::totalBytes()
+{
+    return d_totalBytes;
+}
+
+inline bsls::Types::Uint64& PartitionSyncProgress::sentBytes()
+{
+    return d_sentBytes;
+}
+
+inline bsls::Types::Uint64& PartitionSyncProgress::elapsedTimeMs()
+{
+    return d_elapsedTimeMs;
+}
+
+inline bsls::Types::Uint64& PartitionSyncProgress::throughputBytesPerSec()
+{
+    return d_throughputBytesPerSec;
+}
+
+// ACCESSORS
+template <typename t_ACCESSOR>
+int PartitionSyncProgress::accessAttributes(t_ACCESSOR& accessor) const
+{
+    int ret;
+
+    ret = accessor(d_partitionId,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_ID]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_peerNodeId,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PEER_NODE_ID]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_totalBytes,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TOTAL_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_sentBytes,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SENT_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_elapsedTimeMs,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ELAPSED_TIME_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_throughputBytesPerSec,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_THROUGHPUT_BYTES_PER_SEC]);
+    if (ret) {
+        return ret;
+    }
+
+    return 0;
+}
+
+template <typename t_ACCESSOR>
+int PartitionSyncProgress::accessAttribute(t_ACCESSOR& accessor,
+                                           int         id) const
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_PARTITION_ID: {
+        return accessor(d_partitionId,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_ID]);
+    }
+    case ATTRIBUTE_ID_PEER_NODE_ID: {
+        return accessor(d_peerNodeId,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PEER_NODE_ID]);
+    }
+    case ATTRIBUTE_ID_TOTAL_BYTES: {
+        return accessor(d_totalBytes,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TOTAL_BYTES]);
+    }
+    case ATTRIBUTE_ID_SENT_BYTES: {
+        return accessor(d_sentBytes,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SENT_BYTES]);
+    }
+    case ATTRIBUTE_ID_ELAPSED_TIME_MS: {
+        return accessor(d_elapsedTimeMs,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ELAPSED_TIME_MS]);
+    }
+    case ATTRIBUTE_ID_THROUGHPUT_BYTES_PER_SEC: {
+        return accessor(
+            d_throughputBytesPerSec,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_THROUGHPUT_BYTES_PER_SEC]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <typename t_ACCESSOR>
+int PartitionSyncProgress::accessAttribute(t_ACCESSOR& accessor,
+                                           const char* name,
+                                           int         nameLength) const
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return accessAttribute(accessor, attributeInfo->d_id);
+}
+
+inline int PartitionSyncProgress::partitionId() const
+{
+    return d_partitionId;
+}
+
+inline int PartitionSyncProgress::peerNodeId() const
+{
+    return d_peerNodeId;
+}
+
+inline bsls::Types::Uint64 PartitionSyncProgress::totalBytes() const
+{
+    return d_totalBytes;
+}
+
+inline bsls::Types::Uint64 PartitionSyncProgress::sentBytes() const
+{
+    return d_sentBytes;
+}
+
+inline bsls::Types::Uint64 PartitionSyncProgress::elapsedTimeMs() const
+{
+    return d_elapsedTimeMs;
+}
+
+inline bsls::Types::Uint64 PartitionSyncProgress::throughputBytesPerSec() const
+{
+    return d_throughputBytesPerSec;
+}
+
 // ------------------------
 // class PurgedQueueDetails
 // ------------------------
@@ -46060,6 +46589,12 @@ int ClusterStorageSummary::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_partitionSyncs,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_SYNCS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -46079,6 +46614,11 @@ int ClusterStorageSummary::manipulateAttribute(t_MANIPULATOR& manipulator,
         return manipulator(&d_fileStores,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FILE_STORES]);
     }
+    case ATTRIBUTE_ID_PARTITION_SYNCS: {
+        return manipulator(
+            &d_partitionSyncs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_SYNCS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -46109,6 +46649,12 @@ inline bsl::vector<FileStore>& ClusterStorageSummary::fileStores()
     return d_fileStores;
 }
 
+inline bsl::vector<PartitionSyncProgress>&
+ClusterStorageSummary::partitionSyncs()
+{
+    return d_partitionSyncs;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int ClusterStorageSummary::accessAttributes(t_ACCESSOR& accessor) const
@@ -46128,6 +46674,12 @@ int ClusterStorageSummary::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_partitionSyncs,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_SYNCS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -46146,6 +46698,10 @@ int ClusterStorageSummary::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_fileStores,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FILE_STORES]);
     }
+    case ATTRIBUTE_ID_PARTITION_SYNCS: {
+        return accessor(d_partitionSyncs,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_SYNCS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -46177,6 +46733,12 @@ inline const bsl::vector<FileStore>& ClusterStorageSummary::fileStores() const
     return d_fileStores;
 }
 
+inline const bsl::vector<PartitionSyncProgress>&
+ClusterStorageSummary::partitionSyncs() const
+{
+    return d_partitionSyncs;
+}
+
 // ------------
 // class Domain
 // ------------
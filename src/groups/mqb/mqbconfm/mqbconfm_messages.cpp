@@ -2034,6 +2034,8 @@ const int Domain::DEFAULT_INITIALIZER_MAX_DELIVERY_ATTEMPTS = 0;
 
 const int Domain::DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS = 300000;
 
+const char Domain::DEFAULT_INITIALIZER_PRIORITY_PROPERTY[] = "";
+
 const bdlat_AttributeInfo Domain::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NAME,
      "name",
@@ -2099,14 +2101,19 @@ const bdlat_AttributeInfo Domain::ATTRIBUTE_INFO_ARRAY[] = {
      "subscriptions",
      sizeof("subscriptions") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_PRIORITY_PROPERTY,
+     "priorityProperty",
+     sizeof("priorityProperty") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo* Domain::lookupAttributeInfo(const char* name,
                                                        int         nameLength)
 {
-    for (int i = 0; i < 13; ++i) {
+    for (int i = 0; i < 14; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             Domain::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -2146,6 +2153,8 @@ const bdlat_AttributeInfo* Domain::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENCY];
     case ATTRIBUTE_ID_SUBSCRIPTIONS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS];
+    case ATTRIBUTE_ID_PRIORITY_PROPERTY:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY];
     default: return 0;
     }
 }
@@ -2156,6 +2165,7 @@ Domain::Domain(bslma::Allocator* basicAllocator)
 : d_messageTtl()
 , d_subscriptions(basicAllocator)
 , d_name(basicAllocator)
+, d_priorityProperty(DEFAULT_INITIALIZER_PRIORITY_PROPERTY, basicAllocator)
 , d_msgGroupIdConfig()
 , d_storage()
 , d_mode(basicAllocator)
@@ -2173,6 +2183,7 @@ Domain::Domain(const Domain& original, bslma::Allocator* basicAllocator)
 : d_messageTtl(original.d_messageTtl)
 , d_subscriptions(original.d_subscriptions, basicAllocator)
 , d_name(original.d_name, basicAllocator)
+, d_priorityProperty(original.d_priorityProperty, basicAllocator)
 , d_msgGroupIdConfig(original.d_msgGroupIdConfig)
 , d_storage(original.d_storage)
 , d_mode(original.d_mode, basicAllocator)
@@ -2192,6 +2203,7 @@ Domain::Domain(Domain&& original) noexcept
 : d_messageTtl(bsl::move(original.d_messageTtl)),
   d_subscriptions(bsl::move(original.d_subscriptions)),
   d_name(bsl::move(original.d_name)),
+  d_priorityProperty(bsl::move(original.d_priorityProperty)),
   d_msgGroupIdConfig(bsl::move(original.d_msgGroupIdConfig)),
   d_storage(bsl::move(original.d_storage)),
   d_mode(bsl::move(original.d_mode)),
@@ -2209,6 +2221,7 @@ Domain::Domain(Domain&& original, bslma::Allocator* basicAllocator)
 : d_messageTtl(bsl::move(original.d_messageTtl))
 , d_subscriptions(bsl::move(original.d_subscriptions), basicAllocator)
 , d_name(bsl::move(original.d_name), basicAllocator)
+, d_priorityProperty(bsl::move(original.d_priorityProperty), basicAllocator)
 , d_msgGroupIdConfig(bsl::move(original.d_msgGroupIdConfig))
 , d_storage(bsl::move(original.d_storage))
 , d_mode(bsl::move(original.d_mode), basicAllocator)
@@ -2245,6 +2258,7 @@ Domain& Domain::operator=(const Domain& rhs)
         d_deduplicationTimeMs = rhs.d_deduplicationTimeMs;
         d_consistency         = rhs.d_consistency;
         d_subscriptions       = rhs.d_subscriptions;
+        d_priorityProperty    = rhs.d_priorityProperty;
     }
 
     return *this;
@@ -2268,6 +2282,7 @@ Domain& Domain::operator=(Domain&& rhs)
         d_deduplicationTimeMs = bsl::move(rhs.d_deduplicationTimeMs);
         d_consistency         = bsl::move(rhs.d_consistency);
         d_subscriptions       = bsl::move(rhs.d_subscriptions);
+        d_priorityProperty    = bsl::move(rhs.d_priorityProperty);
     }
 
     return *this;
@@ -2289,6 +2304,7 @@ void Domain::reset()
     d_deduplicationTimeMs = DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
     bdlat_ValueTypeFunctions::reset(&d_consistency);
     bdlat_ValueTypeFunctions::reset(&d_subscriptions);
+    d_priorityProperty = DEFAULT_INITIALIZER_PRIORITY_PROPERTY;
 }
 
 // ACCESSORS
@@ -2311,6 +2327,7 @@ Domain::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("deduplicationTimeMs", this->deduplicationTimeMs());
     printer.printAttribute("consistency", this->consistency());
     printer.printAttribute("subscriptions", this->subscriptions());
+    printer.printAttribute("priorityProperty", this->priorityProperty());
     printer.end();
     return stream;
 }
@@ -3190,11 +3190,17 @@ class Domain {
     // timeout, in milliseconds, to keep GUID of PUT message for the purpose of
     // detecting duplicate PUTs.  consistency.........: optional consistency
     // mode.  subscriptions.......: optional application subscriptions
+    // priorityProperty....: name of the integer message property carrying
+    // the delivery priority of a message.  Empty (the default) means FIFO
+    // delivery.  Otherwise, messages with a positive priority are delivered
+    // ahead of the backlog of consumers which are behind, in a small number
+    // of lanes (higher values first)
 
     // INSTANCE DATA
     bsls::Types::Int64                    d_messageTtl;
     bsl::vector<Subscription>             d_subscriptions;
     bsl::string                           d_name;
+    bsl::string                           d_priorityProperty;
     bdlb::NullableValue<MsgGroupIdConfig> d_msgGroupIdConfig;
     StorageDefinition                     d_storage;
     QueueMode                             d_mode;
@@ -3227,10 +3233,11 @@ class Domain {
         ATTRIBUTE_ID_MAX_DELIVERY_ATTEMPTS = 9,
         ATTRIBUTE_ID_DEDUPLICATION_TIME_MS = 10,
         ATTRIBUTE_ID_CONSISTENCY           = 11,
-        ATTRIBUTE_ID_SUBSCRIPTIONS         = 12
+        ATTRIBUTE_ID_SUBSCRIPTIONS         = 12,
+        ATTRIBUTE_ID_PRIORITY_PROPERTY     = 13
     };
 
-    enum { NUM_ATTRIBUTES = 13 };
+    enum { NUM_ATTRIBUTES = 14 };
 
     enum {
         ATTRIBUTE_INDEX_NAME                  = 0,
@@ -3245,7 +3252,8 @@ class Domain {
         ATTRIBUTE_INDEX_MAX_DELIVERY_ATTEMPTS = 9,
         ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS = 10,
         ATTRIBUTE_INDEX_CONSISTENCY           = 11,
-        ATTRIBUTE_INDEX_SUBSCRIPTIONS         = 12
+        ATTRIBUTE_INDEX_SUBSCRIPTIONS         = 12,
+        ATTRIBUTE_INDEX_PRIORITY_PROPERTY     = 13
     };
 
     // CONSTANTS
@@ -3263,6 +3271,8 @@ class Domain {
 
     static const int DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
 
+    static const char DEFAULT_INITIALIZER_PRIORITY_PROPERTY[];
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -3406,6 +3416,10 @@ class Domain {
     // Return a reference to the modifiable "Subscriptions" attribute of
     // this object.
 
+    bsl::string& priorityProperty();
+    // Return a reference to the modifiable "PriorityProperty" attribute of
+    // this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -3496,6 +3510,10 @@ class Domain {
     // Return a reference offering non-modifiable access to the
     // "Subscriptions" attribute of this object.
 
+    const bsl::string& priorityProperty() const;
+    // Return a reference offering non-modifiable access to the
+    // "PriorityProperty" attribute of this object.
+
     // HIDDEN FRIENDS
     friend bool operator==(const Domain& lhs, const Domain& rhs)
     // Return 'true' if the specified 'lhs' and 'rhs' attribute objects
@@ -5897,6 +5915,7 @@ void Domain::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->deduplicationTimeMs());
     hashAppend(hashAlgorithm, this->consistency());
     hashAppend(hashAlgorithm, this->subscriptions());
+    hashAppend(hashAlgorithm, this->priorityProperty());
 }
 
 inline bool Domain::isEqualTo(const Domain& rhs) const
@@ -5912,7 +5931,8 @@ inline bool Domain::isEqualTo(const Domain& rhs) const
            this->maxDeliveryAttempts() == rhs.maxDeliveryAttempts() &&
            this->deduplicationTimeMs() == rhs.deduplicationTimeMs() &&
            this->consistency() == rhs.consistency() &&
-           this->subscriptions() == rhs.subscriptions();
+           this->subscriptions() == rhs.subscriptions() &&
+           this->priorityProperty() == rhs.priorityProperty();
 }
 
 // CLASS METHODS
@@ -6001,6 +6021,13 @@ int Domain::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_priorityProperty,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -6069,6 +6096,11 @@ int Domain::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_subscriptions,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_PRIORITY_PROPERTY: {
+        return manipulator(
+            &d_priorityProperty,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -6154,6 +6186,11 @@ inline bsl::vector<Subscription>& Domain::subscriptions()
     return d_subscriptions;
 }
 
+inline bsl::string& Domain::priorityProperty()
+{
+    return d_priorityProperty;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int Domain::accessAttributes(t_ACCESSOR& accessor) const
@@ -6237,6 +6274,12 @@ int Domain::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_priorityProperty,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -6299,6 +6342,11 @@ int Domain::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_subscriptions,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_PRIORITY_PROPERTY: {
+        return accessor(
+            d_priorityProperty,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -6385,6 +6433,11 @@ inline const bsl::vector<Subscription>& Domain::subscriptions() const
     return d_subscriptions;
 }
 
+inline const bsl::string& Domain::priorityProperty() const
+{
+    return d_priorityProperty;
+}
+
 // ----------------------
 // class DomainDefinition
 // ----------------------
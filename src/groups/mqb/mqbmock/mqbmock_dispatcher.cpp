@@ -45,6 +45,7 @@ Dispatcher::Dispatcher(bslma::Allocator* allocator)
 , d_mutex()
 , d_queue(allocator)
 , d_enqueueOnly(false)
+, d_numProcessorEvents(0)
 , d_customEventSources(allocator)
 , d_customEventSources_mtx()
 {
@@ -141,18 +142,30 @@ void Dispatcher::setEnqueueOnly(bool value)
 
 void Dispatcher::processQueue()
 {
-    while (true) {
-        mqbi::Dispatcher::VoidFunction next;
-        {
-            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-            if (d_queue.empty()) {
-                return;  // RETURN
-            }
-            next = d_queue.front();
-            d_queue.pop();
+    while (processOne()) {
+        // NOTHING
+    }
+}
+
+bool Dispatcher::processOne()
+{
+    mqbi::Dispatcher::VoidFunction next;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        if (d_queue.empty()) {
+            return false;  // RETURN
         }
-        next();
+        next = d_queue.front();
+        d_queue.pop();
     }
+    next();
+
+    return true;
+}
+
+void Dispatcher::_setNumProcessorEvents(bsls::Types::Int64 value)
+{
+    d_numProcessorEvents = value;
 }
 
 void Dispatcher::synchronize(BSLA_MAYBE_UNUSED mqbi::DispatcherClient* client)
@@ -204,7 +217,7 @@ bsls::Types::Int64 Dispatcher::numProcessorEvents(
 {
     BSLS_ASSERT_SAFE(client);
 
-    return 0;
+    return d_numProcessorEvents;
 }
 
 // ---------------------------------
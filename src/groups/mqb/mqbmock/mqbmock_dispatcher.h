@@ -53,6 +53,7 @@
 #include <bslmt_mutex.h>
 #include <bsls_atomic.h>
 #include <bsls_cpp11.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace mqbmock {
@@ -90,6 +91,9 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
     /// When true, `_execute` only enqueues without running.
     bsls::AtomicBool d_enqueueOnly;
 
+    /// Value returned by `numProcessorEvents`.
+    bsls::Types::Int64 d_numProcessorEvents;
+
     /// All the event sources allocated by `createEventSource`.
     /// Cached to ensure their lifetime is at least until destructor is called.
     bsl::vector<bsl::shared_ptr<mqbi::DispatcherEventSource> >
@@ -257,6 +261,14 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
 
     /// Execute all queued functors in the calling thread.
     void processQueue();
+
+    /// Execute the first queued functor, if any, in the calling thread.
+    /// Return true if a functor was executed, and false otherwise.
+    bool processOne();
+
+    /// Set the number of events reported by `numProcessorEvents`, to mimic
+    /// a loaded processor, to the specified `value`.
+    void _setNumProcessorEvents(bsls::Types::Int64 value);
 };
 
 // ======================
@@ -410,6 +410,17 @@ Queue& Queue::_setDispatcher(mqbi::Dispatcher* value)
     return *this;
 }
 
+Queue& Queue::_setUri(const bmqt::Uri& value)
+{
+    d_uri = value;
+
+    bmqu::MemOutStream ss(d_description.get_allocator().mechanism());
+    ss << "|mock-queue|" << d_uri.asString();
+    d_description.assign(ss.str());
+
+    return *this;
+}
+
 Queue& Queue::_setQueueEngine(mqbi::QueueEngine* value)
 {
     d_queueEngine_p = value;
@@ -355,6 +355,13 @@ class Queue : public mqbi::Queue {
     // MANIPULATORS
     //   (specific to mqbmock::Queue)
     Queue& _setDispatcher(mqbi::Dispatcher* value);
+
+    /// Set the uri of this queue, and its description accordingly, to the
+    /// specified `value` and return a reference offering modifiable access
+    /// to this object.  Note that the statistics of this queue keep the uri
+    /// the queue was created with.
+    Queue& _setUri(const bmqt::Uri& value);
+
     Queue& _setQueueEngine(mqbi::QueueEngine* value);
     Queue& _setStorage(mqbi::Storage* value);
     Queue& _setAtMostOnce(const bool value);
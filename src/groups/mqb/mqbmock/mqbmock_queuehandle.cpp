@@ -23,12 +23,15 @@
 #include <mqbu_storagekey.h>
 
 // BMQ
+#include <bmqp_protocolutil.h>
 #include <bmqt_queueflags.h>
+#include <bmqu_blob.h>
 #include <bmqu_memoutstream.h>
 #include <bmqu_outstreamformatsaver.h>
 #include <bmqu_printutil.h>
 
 // BDE
+#include <bdlbb_blob.h>
 #include <bdlbb_blobutil.h>
 #include <bsl_algorithm.h>
 #include <bsl_iostream.h>
@@ -307,6 +310,23 @@ void QueueHandle::deliverMessage(
         BSLS_ASSERT_OPT(canDeliver(subscriptions[i].id()));
     }
 
+    // Keep only the payload, so that '_messages' lists the messages
+    // regardless of their properties.
+    bsl::shared_ptr<bdlbb::Blob> payload = message.appData();
+    if (message.attributes().messagePropertiesInfo().isPresent()) {
+        int propertiesSize = 0;
+        BSLA_MAYBE_UNUSED const int rc =
+            bmqp::ProtocolUtil::readPropertiesSize(&propertiesSize,
+                                                   *payload,
+                                                   bmqu::BlobPosition());
+        BSLS_ASSERT_OPT(rc == 0);
+
+        payload.createInplace(d_allocator_p, d_allocator_p);
+        bdlbb::BlobUtil::append(payload.get(),
+                                *message.appData(),
+                                propertiesSize);
+    }
+
     for (bmqp::Protocol::SubQueueInfosArray::size_type i = 0;
          i < subscriptions.size();
          ++i) {
@@ -320,7 +340,7 @@ void QueueHandle::deliverMessage(
         BSLA_MAYBE_UNUSED bsl::pair<GUIDMap::iterator, bool> insertRC =
             guids.insert(
                 bsl::make_pair(message.guid(),
-                               bsl::make_pair(message.appData(), sId)));
+                               bsl::make_pair(payload, sId)));
         BSLS_ASSERT_OPT(insertRC.second || isOutOfOrder);
     }
 }
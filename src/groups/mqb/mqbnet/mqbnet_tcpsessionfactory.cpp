@@ -51,6 +51,8 @@
 #include <bmqio_reconnectingchannelfactory.h>
 #include <bmqio_resolveutil.h>
 #include <bmqio_resolvingchannelfactory.h>
+#include <bmqio_shmchannel.h>
+#include <bmqio_shmchannelfactory.h>
 #include <bmqio_statchannel.h>
 #include <bmqio_statchannelfactory.h>
 #include <bmqio_status.h>
@@ -101,6 +103,7 @@
 #include <ntcf_system.h>
 #include <ntsa_error.h>
 #include <ntsa_ipaddress.h>
+#include <ntsa_ipv4address.h>
 
 namespace BloombergLP {
 namespace mqbnet {
@@ -197,6 +200,20 @@ void ntcChannelPreCreation(
                               channel->channelId());
 }
 
+/// Callback invoked when the specified shared memory `channel` is created.
+/// Set the properties that `ntcChannelPreCreation` sets on TCP channels, so
+/// that higher levels treat the channel as a local one accepted on the
+/// specified `localPort`.
+void shmChannelPreCreation(const bsl::shared_ptr<bmqio::ShmChannel>& channel,
+                           int                                       localPort)
+{
+    channel->properties().set(
+        TCPSessionFactory::k_CHANNEL_PROPERTY_PEER_IP,
+        static_cast<int>(ntsa::Ipv4Address::loopback().value()));
+    channel->properties().set(TCPSessionFactory::k_CHANNEL_PROPERTY_LOCAL_PORT,
+                              localPort);
+}
+
 /// Create the ntca::InterfaceConfig to use given the specified
 /// `tcpConfig`
 ntca::InterfaceConfig
@@ -221,6 +238,10 @@ ntcCreateInterfaceConfig(const mqbcfg::TcpInterfaceConfig& tcpConfig)
     config.setKeepAlive(true);
     config.setKeepHalfOpen(false);
 
+    if (tcpConfig.ioRing()) {
+        config.setDriverName(bmqio::NtcChannelFactoryUtil::ioRingDriverName());
+    }
+
     return config;
 }
 
@@ -293,6 +314,25 @@ struct ChannelFactoryBuilders {
         return factory;
     }
 
+    static bsl::shared_ptr<bmqio::ShmChannelFactory>
+    shmChannelFactory(bslma::Allocator*                 allocator,
+                      const mqbcfg::TcpInterfaceConfig& tcpConfig,
+                      bdlbb::BlobBufferFactory*         blobBufferFactory)
+    {
+        bsl::shared_ptr<bmqio::ShmChannelFactory> factory =
+            bsl::allocate_shared<bmqio::ShmChannelFactory>(
+                allocator,
+                blobBufferFactory,
+                static_cast<int>(
+                    bmqio::ShmChannelFactory::k_DEFAULT_RING_SIZE),
+                static_cast<int>(tcpConfig.lowWatermark()),
+                static_cast<int>(tcpConfig.highWatermark()));
+        factory->onCreate(bdlf::BindUtil::bind(&shmChannelPreCreation,
+                                               bdlf::PlaceHolders::_1,
+                                               tcpConfig.port()));
+        return factory;
+    }
+
     static ChannelFactorySP resolvingChannelFactory(
         bslma::Allocator*                                allocator,
         ChannelFactorySP&                                prev,
@@ -1225,6 +1265,12 @@ void TCPSessionFactory::cancelListeners()
 
     d_listeningHandles.clear();
     d_listenContexts.clear();
+
+    if (d_shmListeningHandle_sp) {
+        d_shmListeningHandle_sp->cancel();
+        d_shmListeningHandle_sp.reset();
+    }
+    d_shmListenContext_sp.reset();
 }
 
 int TCPSessionFactory::start(bsl::ostream& errorDescription)
@@ -1304,9 +1350,51 @@ int TCPSessionFactory::start(bsl::ostream& errorDescription)
     if (rc != 0) {
         errorDescription << d_name << ": failed starting stat channel factory "
                          << "[rc: " << rc << "]";
+        if (d_config_mp->ioRing()) {
+            errorDescription << " (io_uring driver requested: make sure it "
+                             << "is supported by the host and enabled in "
+                             << "the networking library)";
+        }
         return rc;  // RETURN
     }
 
+    if (d_config_mp->ioRing()) {
+        BALL_LOG_INFO << d_name << ": sockets driven by io_uring";
+    }
+
+    if (!d_config_mp->shmEndpoint().empty()) {
+        // Same-host peers connecting through shared memory bypass DNS
+        // resolution (the peer URI already identifies the local process) and
+        // reconnection (the broker never initiates such connections), but
+        // share the channel statistics of the TCP channels.
+        bmqio::ChannelFactoryPipeline::Config config(
+            ChannelFactoryBuilders::shmChannelFactory(d_allocator_p,
+                                                      *d_config_mp,
+                                                      d_blobBufferFactory_p),
+            d_allocator_p);
+        config.addWith(statChannelFactoryBuilder);
+        d_shmChannelFactoryPipeline_mp =
+            bslma::ManagedPtrUtil::allocateManaged<
+                bmqio::ChannelFactoryPipeline>(
+                d_allocator_p,
+                bslmf::MovableRefUtil::move(config));
+
+        rc = d_shmChannelFactoryPipeline_mp->start();
+        if (rc != 0) {
+            errorDescription << d_name << ": failed starting shared memory "
+                             << "channel factory [rc: " << rc << "]";
+
+            // Undo the start of the TCP channel factory: this object is not
+            // started, so 'stop()' would not do it.
+            d_shmChannelFactoryPipeline_mp.reset();
+            d_channelFactoryPipeline_mp->stop();
+            d_channelFactoryPipeline_mp.reset();
+            d_resolutionContext_sp->stop();
+            d_resolutionContext_sp->join();
+            return rc;  // RETURN
+        }
+    }
+
     if (d_config_mp->heartbeatIntervalMs() != 0) {
         BALL_LOG_INFO
             << d_name << ": heartbeat enabled (interval: "
@@ -1371,6 +1459,17 @@ int TCPSessionFactory::startListening(bsl::ostream&         errorDescription,
         }
     }
 
+    if (d_shmChannelFactoryPipeline_mp) {
+        int rc = listenShm(resultCallback);
+        if (rc != 0) {
+            errorDescription << d_name << ": failed listening to '"
+                             << d_config_mp->shmEndpoint() << "' [rc: " << rc
+                             << "]";
+            cancelListeners();
+            return rc;  // RETURN
+        }
+    }
+
     d_isListening = true;
     return 0;
 }
@@ -1465,6 +1564,10 @@ void TCPSessionFactory::stop()
         d_channelFactoryPipeline_mp->stop();
     }
 
+    if (d_shmChannelFactoryPipeline_mp) {
+        d_shmChannelFactoryPipeline_mp->stop();
+    }
+
     // Wait for all sessions to have been destroyed
     d_mutex.lock();
 
@@ -1509,6 +1612,7 @@ void TCPSessionFactory::stop()
 
     // DESTROY
     d_channelFactoryPipeline_mp.reset();
+    d_shmChannelFactoryPipeline_mp.reset();
 
     BALL_LOG_INFO << d_name << ": stopped";
 }
@@ -1571,6 +1675,54 @@ int TCPSessionFactory::listen(const mqbcfg::TcpInterfaceListener& listener,
     return 0;
 }
 
+int TCPSessionFactory::listenShm(const ResultCallback& resultCallback)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_shmChannelFactoryPipeline_mp);
+    BSLS_ASSERT_SAFE(!d_shmListeningHandle_sp);
+
+    bsl::shared_ptr<OperationContext> context =
+        bsl::allocate_shared<OperationContext>(d_allocator_p);
+    d_shmListenContext_sp = context;
+
+    context->d_resultCb      = resultCallback;
+    context->d_isIncoming    = true;
+    context->d_resultState_p = 0;
+
+    bmqio::ListenOptions listenOptions;
+    listenOptions.setEndpoint(d_config_mp->shmEndpoint());
+
+    bslma::ManagedPtr<bmqio::ChannelFactory::OpHandle> listeningHandle_mp;
+    bmqio::Status                                      status;
+    d_shmChannelFactoryPipeline_mp->listen(
+        &status,
+        &listeningHandle_mp,
+        listenOptions,
+        bdlf::BindUtil::bind(&TCPSessionFactory::channelStateCallback,
+                             this,
+                             bdlf::PlaceHolders::_1,  // event
+                             bdlf::PlaceHolders::_2,  // status
+                             bdlf::PlaceHolders::_3,  // channel
+                             context));
+    if (!status) {
+        BALL_LOG_ERROR << "#TCP_LISTEN_FAILED " << d_name
+                       << ": failed listening to '"
+                       << d_config_mp->shmEndpoint() << "' [status: "
+                       << status << "]";
+        d_shmListenContext_sp.reset();
+        return status.category();  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(listeningHandle_mp);
+
+    d_shmListeningHandle_sp = OpHandleSp(listeningHandle_mp, d_allocator_p);
+
+    BALL_LOG_INFO << d_name << ": successfully listening to '"
+                  << d_config_mp->shmEndpoint() << "'";
+
+    return 0;
+}
+
 int TCPSessionFactory::connect(
     bsl::string_view                            endpoint,
     const ResultCallback&                       resultCallback,
@@ -371,6 +371,11 @@ class TCPSessionFactory {
 
     bslma::ManagedPtr<bmqio::StatChannelFactory> d_statChannelFactory_mp;
 
+    /// Pipeline of the channels accepted on the shared memory endpoint of
+    /// this interface, if any.  Null unless `shmEndpoint` is configured.
+    bslma::ManagedPtr<bmqio::ChannelFactoryPipeline>
+        d_shmChannelFactoryPipeline_mp;
+
     /// Cache of shared pointers to @bbref{mqbnet::InitialConnectionContext} to
     /// preserve their lifetime while an initial connection
     /// (authentication/negotiation) is in progress.  Each context is added by
@@ -442,6 +447,14 @@ class TCPSessionFactory {
     bsl::unordered_map<int, bsl::shared_ptr<OperationContext> >
         d_listenContexts;
 
+    /// Handle that can be used to stop listening on the shared memory
+    /// endpoint.  Empty unless listening on it.
+    OpHandleSp d_shmListeningHandle_sp;
+
+    /// Context of the listen operation on the shared memory endpoint, owned
+    /// for the same reason as `d_listenContexts`.
+    bsl::shared_ptr<OperationContext> d_shmListenContext_sp;
+
     /// Map of HiRes timestamp of the session beginning per channel.
     TimestampMap d_timestampMap;
 
@@ -637,6 +650,12 @@ class TCPSessionFactory {
     int listen(const mqbcfg::TcpInterfaceListener& listener,
                const ResultCallback&               resultCallback);
 
+    /// Listen for incoming connections from same-host peers on the
+    /// configured shared memory endpoint, and invoke the specified
+    /// `resultCallback` when a connection has been negotiated.  Return 0 on
+    /// success, or non-zero on error.
+    int listenShm(const ResultCallback& resultCallback);
+
     /// Initiate a connection to the specified `endpoint` and return 0 if
     /// the connection has successfully been started; with the result being
     /// provided by a call to the specified `resultCallback`; or return a
@@ -122,6 +122,8 @@ DataStoreConfig::DataStoreConfig()
 , d_maxJournalFileSize(0)
 , d_maxQlistFileSize(0)
 , d_maxArchivedFileSets(0)
+, d_groupSyncIntervalUs(0)
+, d_groupSyncBytes(0)
 {
     // NOTHING
 }
@@ -153,6 +155,8 @@ bsl::ostream& DataStoreConfig::print(bsl::ostream& stream,
     printer.printAttribute("hasRecoveredQueuesCb",
                            (recoveredQueuesCb() ? "yes" : "no"));
     printer.printAttribute("maxArchiveFileSets", maxArchivedFileSets());
+    printer.printAttribute("groupSyncIntervalUs", groupSyncIntervalUs());
+    printer.printAttribute("groupSyncBytes", groupSyncBytes());
     printer.end();
     return stream;
 }
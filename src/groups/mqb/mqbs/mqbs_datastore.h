@@ -446,6 +446,18 @@ class DataStoreConfig {
 
     int d_maxArchivedFileSets;
 
+    int d_groupSyncIntervalUs;
+    // Maximum time, in microseconds, during
+    // which writes are accumulated before
+    // being synced to disk together, or 0
+    // if group sync is disabled
+
+    int d_groupSyncBytes;
+    // Number of accumulated bytes after
+    // which writes are synced to disk
+    // without waiting for
+    // 'd_groupSyncIntervalUs'
+
   public:
     // CREATORS
     DataStoreConfig();
@@ -471,6 +483,11 @@ class DataStoreConfig {
     /// reference offering modifiable access to this object.
     DataStoreConfig& setMaxArchivedFileSets(int value);
 
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setGroupSyncIntervalUs(int value);
+    DataStoreConfig& setGroupSyncBytes(int value);
+
     // ACCESSORS
     bdlbb::BlobBufferFactory* bufferFactory() const;
     bdlmt::EventScheduler*    scheduler() const;
@@ -491,6 +508,10 @@ class DataStoreConfig {
     /// Return the value of the corresponding member.
     int maxArchivedFileSets() const;
 
+    /// Return the value of the corresponding member.
+    int groupSyncIntervalUs() const;
+    int groupSyncBytes() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -1069,6 +1090,18 @@ inline DataStoreConfig& DataStoreConfig::setMaxArchivedFileSets(int value)
     return *this;
 }
 
+inline DataStoreConfig& DataStoreConfig::setGroupSyncIntervalUs(int value)
+{
+    d_groupSyncIntervalUs = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setGroupSyncBytes(int value)
+{
+    d_groupSyncBytes = value;
+    return *this;
+}
+
 // ACCESSORS
 inline bdlbb::BlobBufferFactory* DataStoreConfig::bufferFactory() const
 {
@@ -1153,6 +1186,16 @@ inline int DataStoreConfig::maxArchivedFileSets() const
     return d_maxArchivedFileSets;
 }
 
+inline int DataStoreConfig::groupSyncIntervalUs() const
+{
+    return d_groupSyncIntervalUs;
+}
+
+inline int DataStoreConfig::groupSyncBytes() const
+{
+    return d_groupSyncBytes;
+}
+
 // ---------------------------
 // class DataStoreRecordHandle
 // ---------------------------
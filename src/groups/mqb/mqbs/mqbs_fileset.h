@@ -64,6 +64,10 @@ struct FileSet BSLS_KEYWORD_FINAL {
         bsls::Types::Uint64  d_filePosition;
         bsls::Types::Uint64  d_outstandingBytes;
 
+        /// Position up to which the file was handed over to be synced to
+        /// disk, when group sync is enabled.
+        bsls::Types::Uint64 d_syncPosition;
+
         // TRAITS
         BSLMF_NESTED_TRAIT_DECLARATION(FileInfo, bslma::UsesBslmaAllocator)
 
@@ -138,6 +142,7 @@ inline FileSet::FileInfo::FileInfo(bslma::Allocator* allocator)
 , d_fileName(allocator)
 , d_filePosition(0)
 , d_outstandingBytes(0)
+, d_syncPosition(0)
 {
 }
 
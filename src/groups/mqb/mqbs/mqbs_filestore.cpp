@@ -40,6 +40,7 @@
 #include <mqbs_replicatedstorage.h>
 #include <mqbs_storageutil.h>
 #include <mqbstat_clusterstats.h>
+#include <mqbstat_messagetracer.h>
 #include <mqbstat_statmonitorsnapshotrecorder.h>
 #include <mqbu_exit.h>
 
@@ -106,6 +107,16 @@ const double k_PARTITION_AVAILABLESPACE_SECS = 20;
 
 const int k_NAGLE_PACKET_COUNT = 100;
 
+/// Maximum number of messages expired due to TTL by a single dispatcher event
+/// across all the storages of a partition.  Remaining expired messages are
+/// processed by subsequent events, to avoid latency spikes in the partition
+/// dispatcher thread.
+const int k_GC_EXPIRED_MESSAGES_BATCH_SIZE = 1000;
+
+/// Number of records a replica confirms with a single cumulative Receipt
+/// before sending it without waiting for its dispatcher queue to drain.
+const int k_RECEIPT_BATCH_SIZE = 64;
+
 const int k_KEY_LEN = FileStoreProtocol::k_KEY_LENGTH;
 
 /// k_RESERVED1_SYNC_POINT_SIZE is the space in the end of the JOURNAL file
@@ -325,6 +336,38 @@ void FileStore::cancelUnreceipted(const DataStoreRecordKey& recordKey)
     d_unreceipted.erase(it);
 }
 
+void FileStore::cancelUnsynced(bsls::Types::Uint64 fromToken,
+                               bsls::Types::Uint64 toToken)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    // Records synced by earlier groups may still be pending Receipts from
+    // the replicas, so only cancel the ones covered by the failed sync.
+    Unreceipted::iterator it = d_unreceipted.begin();
+    while (it != d_unreceipted.end()) {
+        const ReceiptContext& context = it->second;
+        if (context.d_syncToken <= fromToken ||
+            context.d_syncToken > toToken) {
+            ++it;
+            continue;  // CONTINUE
+        }
+
+        StorageMapIter sit = d_storages.find(context.d_queueKey);
+        if (sit != d_storages.end()) {
+            BSLS_ASSERT_SAFE(sit->second->queue());
+
+            sit->second->queue()->onRemoval(context.d_guid,
+                                            context.d_qH,
+                                            bmqt::AckResult::e_UNKNOWN);
+        }
+        // else the queue and its storage are gone; ignore the failure
+        it = d_unreceipted.erase(it);
+    }
+}
+
 int FileStore::openInNonRecoveryMode()
 {
     // executed by the *DISPATCHER* thread
@@ -2928,7 +2971,12 @@ int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
     }
 
     // Irrespective of the aliased blob buffer counter, file set can be
-    // truncated because nothing else will be written to the file.
+    // truncated because nothing else will be written to the file.  Complete
+    // the group syncs of the file set first, as they refer to its mappings.
+
+    if (d_syncer_mp) {
+        d_syncer_mp->drain();
+    }
 
     truncate(activeFileSet);
     BALL_LOG_INFO_BLOCK
@@ -4166,98 +4214,47 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
         return;  // RETURN
     }
 
-    const DataStoreRecordKey recordKey(primaryLeaseId, sequenceNumber);
-    Unreceipted::iterator    to = d_unreceipted.find(recordKey);
-    // end of of Receipt range
-
-    if (to == d_unreceipted.end()) {
-        // ignore
-        return;  // RETURN
-    }
-
-    // `to` is the end of Receipt range.  Find the start of the range
-    // using prior 'source' history and making sure not to count anything
-    // twice.
+    // Receipts are cumulative: a Receipt from 'source' confirms every record
+    // up to 'recordKey'.  Only keep the highest Receipt of each node, and
+    // derive from these the records confirmed by a quorum, so that the cost
+    // of a Receipt does not depend on the number of records it confirms.
 
-    int                           nodeId = source->nodeId();
+    const DataStoreRecordKey      recordKey(primaryLeaseId, sequenceNumber);
+    const int                     nodeId = source->nodeId();
     NodeReceiptContexts::iterator itNode = d_nodes.find(nodeId);
-    Unreceipted::iterator         from;  // start of Receipt range
 
     if (itNode == d_nodes.end()) {
         // no prior history about this node
         d_nodes.insert(
             bsl::make_pair(nodeId, NodeContext(d_blobSpPool_p, recordKey)));
-        from = d_unreceipted.begin();
     }
     else if (itNode->second.d_key < recordKey) {
-        from = d_unreceipted.find(itNode->second.d_key);
-
-        if (from == d_unreceipted.end()) {
-            // we went past the last Receipt from this node
-            from = d_unreceipted.begin();
-        }
-        else {
-            ++from;  // `itNode->second` was the last Receipt
-        }
-
         itNode->second.d_key = recordKey;
-        // next range starts at (d_unreceipted.find(itNode->second) + 1)
     }
     else {
         // This Receipt is about something already Receipted.  Ignore
         return;  // RETURN
     }
 
-    // everything in [from, to] is Receipt'ed
-    bool                             isEndOfRange = false;
-    mqbu::StorageKey                 lastKey;
-    bsl::unordered_set<mqbi::Queue*> affectedQueues(d_allocator_p);
-    mqbi::Queue*                     lastQueue = 0;
+    Records::const_iterator recordIt = d_records.find(recordKey);
+    if (primaryLeaseId == d_writeHeadLeaseId && recordIt != d_records.end()) {
+        // Calculate time it took for the last record confirmed by this
+        // Receipt to be stored and Receipted by 'source'.  Receipts of
+        // records of prior leases (e.g. implicit Receipts) are ignored, as
+        // these records did not arrive at self.
+        d_partitionStats_sp->setReceiptTime(
+            bmqu::Time::highResolutionTimer() -
+            recordIt->second.d_arrivalTimepoint);
+    }
 
-    while (from != d_unreceipted.end() && !isEndOfRange) {
-        if (from->first == recordKey) {
-            // This is the last in the range
-            isEndOfRange = true;
-        }
-        if (++(from->second.d_count) >= d_replicationFactor) {
-            from->second.d_handle->second.d_hasReceipt = true;
+    processQuorumReceipts();
 
-            // Calculate time it took for the message to be stored and
-            // replicated.
-            const bsls::Types::Int64 timeDelta =
-                bmqu::Time::highResolutionTimer() -
-                from->second.d_handle->second.d_arrivalTimepoint;
-            d_partitionStats_sp->setReplicationTime(timeDelta);
-
-            // notify the queue
-            const mqbu::StorageKey& queueKey  = from->second.d_queueKey;
-            bool                    haveQueue = (queueKey == lastKey);
-            if (!haveQueue) {
-                StorageMapIter sit = d_storages.find(queueKey);
-                if (sit != d_storages.end()) {
-                    haveQueue = true;
-                    lastKey   = queueKey;
-                    lastQueue = sit->second->queue();
-                    BSLS_ASSERT_SAFE(lastQueue);
-                    affectedQueues.insert(lastQueue);
-                }
-                // else the queue and its storage are gone; ignore the receipt
-            }
-            if (haveQueue) {
-                lastQueue->onReceipt(from->second.d_guid, from->second.d_qH);
-            }  // else the queue is gone
-            from = d_unreceipted.erase(from);
-        }
-        else {
-            ++from;
-        }
-    }
-    for (bsl::unordered_set<mqbi::Queue*>::iterator it =
-             affectedQueues.begin();
-         it != affectedQueues.end();
+    for (bsl::vector<mqbi::Queue*>::iterator it = d_receiptedQueues.begin();
+         it != d_receiptedQueues.end();
          ++it) {
         (*it)->onReplicatedBatch();
     }
+    d_receiptedQueues.clear();
 }
 
 int FileStore::writeMessageRecord(const bmqp::StorageHeader& header,
@@ -5311,6 +5308,11 @@ FileStore::FileStore(
 , d_replicationNotifications(allocator)
 , d_replicationFactor(replicationFactor)
 , d_nodes(allocator)
+, d_receiptKeys(allocator)
+, d_receiptedQueues(allocator)
+, d_pendingReceiptNode_p(0)
+, d_pendingReceipt_p(0)
+, d_numPendingReceiptRecords(0)
 , d_lastRecoveredStrongConsistency()
 , d_fileSets(allocator)
 , d_cluster_p(cluster)
@@ -5322,6 +5324,8 @@ FileStore::FileStore(
 , d_writeHeadLeaseId(0)
 , d_syncPoints(allocator)
 , d_storages(allocator)
+, d_gcExpiredResumeKey()
+, d_isGcExpiredPending(false)
 , d_isFSMWorkflow(isFSMWorkflow)
 , d_qListAware(!d_isFSMWorkflow || doesFSMwriteQLIST)
 , d_storageEventBuilder(FileStoreProtocol::k_VERSION,
@@ -5331,6 +5335,8 @@ FileStore::FileStore(
 , d_firstSyncPointAfterRolloverSeqNum()
 , d_highestSeqNums(allocator)
 , d_messageTransmitter(blobSpPool, cluster, allocator)
+, d_syncer_mp()
+, d_syncedToken(0)
 {
     // PRECONDITIONS
     BSLS_ASSERT(allocator);
@@ -5349,6 +5355,19 @@ FileStore::FileStore(
 
     d_alarmSoftLimiter.initialize(1, 15 * bdlt::TimeUnitRatio::k_NS_PER_M);
     // Throttling of one maximum alarm per 15 minutes
+
+    if (0 < d_config.groupSyncIntervalUs()) {
+        d_syncer_mp.load(
+            new (*d_allocator_p) FileSyncer(
+                d_config.groupSyncIntervalUs(),
+                static_cast<bsls::Types::Uint64>(d_config.groupSyncBytes()),
+                bdlf::BindUtil::bind(&FileStore::onGroupSynced,
+                                     this,
+                                     bdlf::PlaceHolders::_1,   // token
+                                     bdlf::PlaceHolders::_2),  // status
+                d_allocator_p),
+            d_allocator_p);
+    }
 }
 
 FileStore::~FileStore()
@@ -5428,8 +5447,24 @@ int FileStore::open(QueueKeyInfoMap* queueKeyInfoMap)
 
     BSLS_ASSERT_SAFE(d_isOpen);
 
+    FileSet* fs = d_fileSets[0].get();
+
+    if (d_syncer_mp) {
+        // The contents of the files at this point are already on disk.
+        fs->d_data.d_syncPosition    = fs->d_data.d_filePosition;
+        fs->d_journal.d_syncPosition = fs->d_journal.d_filePosition;
+
+        rc = d_syncer_mp->start();
+        if (0 != rc) {
+            BMQTSK_ALARMLOG_ALARM("FILE_IO")
+                << partitionDesc() << "Failed to start group sync, rc: " << rc
+                << ". Messages will be acknowledged without waiting for "
+                << "their sync to disk." << BMQTSK_ALARMLOG_END;
+            d_syncer_mp.reset();
+        }
+    }
+
     // Report cluster's partition stats
-    const FileSet* fs = d_fileSets[0].get();
     d_partitionStats_sp->setPartitionBytes(fs->d_data.d_outstandingBytes,
                                            fs->d_journal.d_outstandingBytes,
                                            fs->d_data.d_filePosition,
@@ -5450,6 +5485,11 @@ int FileStore::close(bool flush, bool archive)
     // The FileStore might be not opened by the time we call `close()`
     cancelTimersAndWait();
 
+    if (d_syncer_mp) {
+        // Sync the pending writes before the files are unmapped.
+        d_syncer_mp->stop();
+    }
+
     if (!d_isOpen) {
         return rc_SUCCESS;  // RETURN
     }
@@ -5463,6 +5503,7 @@ int FileStore::close(bool flush, bool archive)
     BALL_LOG_INFO << partitionDesc() << "Closing partition. ";
 
     // Clear 'd_records' so that gc logic is invoked on all mapped data files.
+    clearPendingReceipt();
     d_unreceipted.clear();
     d_records.clear();
 
@@ -5760,16 +5801,33 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
     insertDataStoreRecord(&recordIt, key, record);
     recordIteratorToHandle(handle, recordIt);
 
-    int flags = 0;
+    mqbstat::MessageTracer::trace(
+        guid,
+        mqbstat::MessageTracer::Stage::e_STORAGE_WRITE);
+
+    int                 flags            = 0;
+    const bool          needsReplication = !attributes->hasReceipt();
+    bsls::Types::Uint64 syncToken        = 0;
+    if (d_syncer_mp) {
+        syncToken = requestGroupSync(activeFileSet);
+
+        // The message is acknowledged once synced to disk, when Receipted.
+        attributes->setReceipt(false);
+    }
+
     // If this requires Receipt
-    if (!attributes->hasReceipt()) {
+    if (needsReplication || syncToken) {
         d_unreceipted.insert(
             bsl::make_pair(key,
                            ReceiptContext(queueKey,
                                           guid,
                                           recordIt,
-                                          1,  // receipt count
-                                          attributes->queueHandle())));
+                                          attributes->queueHandle(),
+                                          needsReplication,
+                                          syncToken)));
+    }
+
+    if (needsReplication) {
         flags = bmqp::StorageHeaderFlags::e_RECEIPT_REQUESTED;
     }
     else {
@@ -6364,6 +6422,7 @@ void FileStore::processStorageEvent(const bsl::shared_ptr<bdlbb::Blob>& blob,
     }
     const unsigned int      pid         = iter.header().partitionId();
     FileStore::NodeContext* nodeContext = 0;
+    int                     numReceipts = 0;
 
     do {
         const bmqp::StorageHeader& header = iter.header();
@@ -6446,6 +6505,7 @@ void FileStore::processStorageEvent(const bsl::shared_ptr<bdlbb::Blob>& blob,
                                                   source,
                                                   recHeader->primaryLeaseId(),
                                                   recHeader->sequenceNumber());
+                    ++numReceipts;
                 }
             }
         }
@@ -6510,7 +6570,25 @@ void FileStore::processStorageEvent(const bsl::shared_ptr<bdlbb::Blob>& blob,
         }
     } while (1 == iter.next());
 
-    sendReceipt(source, nodeContext);
+    if (nodeContext == 0) {
+        return;  // RETURN
+    }
+
+    // Receipts are cumulative: rather than sending one Receipt per storage
+    // event, accumulate them until the dispatcher queue drains (see 'flush'),
+    // or enough records are confirmed.  Under low load, this sends a Receipt
+    // after each storage event, and under high load this coalesces the
+    // Receipts of back-to-back storage events.
+    if (d_pendingReceipt_p && d_pendingReceiptNode_p != source) {
+        sendPendingReceipt();
+    }
+    d_pendingReceiptNode_p = source;
+    d_pendingReceipt_p     = nodeContext;
+    d_numPendingReceiptRecords += numReceipts;
+
+    if (d_numPendingReceiptRecords >= k_RECEIPT_BATCH_SIZE) {
+        sendPendingReceipt();
+    }
 }
 
 int FileStore::processRecoveryEvent(const bsl::shared_ptr<bdlbb::Blob>& blob)
@@ -6775,6 +6853,192 @@ void FileStore::sendReceipt(mqbnet::ClusterNode* node,
     }
 }
 
+void FileStore::sendPendingReceipt()
+{
+    if (d_pendingReceipt_p == 0) {
+        return;  // RETURN
+    }
+
+    sendReceipt(d_pendingReceiptNode_p, d_pendingReceipt_p);
+    d_partitionStats_sp->setRecordsPerReceipt(d_numPendingReceiptRecords);
+
+    clearPendingReceipt();
+}
+
+void FileStore::clearPendingReceipt()
+{
+    d_pendingReceiptNode_p     = 0;
+    d_pendingReceipt_p         = 0;
+    d_numPendingReceiptRecords = 0;
+}
+
+void FileStore::processQuorumReceipts()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isPrimary);
+    BSLS_ASSERT_SAFE(d_receiptedQueues.empty());
+
+    if (d_unreceipted.empty()) {
+        return;  // RETURN
+    }
+
+    // Self counts as one of the 'd_replicationFactor' nodes.  A record is
+    // confirmed by a quorum if its key is not greater than the
+    // 'numReplicas'-th highest last Receipt of the replicas.
+    const size_t numReplicas = d_replicationFactor > 1
+                                   ? static_cast<size_t>(d_replicationFactor -
+                                                         1)
+                                   : 0;
+
+    // Without Receipts from enough replicas, no record needing replication is
+    // confirmed.
+    const DataStoreRecordKey* quorumKey = 0;
+    if (numReplicas > 0 && d_nodes.size() >= numReplicas) {
+        d_receiptKeys.clear();
+        for (NodeReceiptContexts::const_iterator it = d_nodes.begin();
+             it != d_nodes.end();
+             ++it) {
+            d_receiptKeys.push_back(it->second.d_key);
+        }
+
+        // Partition the keys so that the last 'numReplicas' ones are the
+        // highest, with the lowest of them first.
+        const size_t quorumIndex = d_receiptKeys.size() - numReplicas;
+        bsl::nth_element(d_receiptKeys.begin(),
+                         d_receiptKeys.begin() + quorumIndex,
+                         d_receiptKeys.end());
+        quorumKey = &d_receiptKeys[quorumIndex];
+    }
+
+    // Records pending Receipt are ordered by key, so the ones confirmed by
+    // the quorum, and synced to disk if group sync is enabled, are a prefix
+    // of 'd_unreceipted'.
+    const bsls::Types::Int64 now = bmqu::Time::highResolutionTimer();
+    mqbu::StorageKey         lastKey;
+    mqbi::Queue*             lastQueue = 0;
+
+    Unreceipted::iterator it = d_unreceipted.begin();
+    while (it != d_unreceipted.end()) {
+        const ReceiptContext& context = it->second;
+        if (context.d_needsReplication && numReplicas > 0 &&
+            (quorumKey == 0 || *quorumKey < it->first)) {
+            break;  // BREAK
+        }
+
+        if (context.d_syncToken > d_syncedToken) {
+            // Not yet synced to disk.
+            break;  // BREAK
+        }
+
+        if (context.d_needsReplication) {
+            context.d_handle->second.d_hasReceipt = true;
+
+            // Calculate time it took for the message to be stored and
+            // replicated.
+            d_partitionStats_sp->setReplicationTime(
+                now - context.d_handle->second.d_arrivalTimepoint);
+        }
+
+        // notify the queue
+        const mqbu::StorageKey& queueKey  = context.d_queueKey;
+        bool                    haveQueue = (queueKey == lastKey);
+        if (!haveQueue) {
+            StorageMapIter sit = d_storages.find(queueKey);
+            if (sit != d_storages.end()) {
+                haveQueue = true;
+                lastKey   = queueKey;
+                lastQueue = sit->second->queue();
+                BSLS_ASSERT_SAFE(lastQueue);
+                d_receiptedQueues.push_back(lastQueue);
+            }
+            // else the queue and its storage are gone; ignore the receipt
+        }
+        if (haveQueue) {
+            mqbstat::MessageTracer::trace(
+                context.d_guid,
+                mqbstat::MessageTracer::Stage::e_RECEIPT);
+            lastQueue->onReceipt(context.d_guid, context.d_qH);
+        }  // else the queue is gone
+        it = d_unreceipted.erase(it);
+    }
+
+    // Records of a queue are mostly contiguous: remove the queues which
+    // alternated with others.
+    bsl::sort(d_receiptedQueues.begin(), d_receiptedQueues.end());
+    d_receiptedQueues.erase(
+        bsl::unique(d_receiptedQueues.begin(), d_receiptedQueues.end()),
+        d_receiptedQueues.end());
+}
+
+bsls::Types::Uint64 FileStore::requestGroupSync(FileSet* fileSet)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_syncer_mp);
+    BSLS_ASSERT_SAFE(fileSet);
+
+    FileSet::FileInfo* files[] = {&fileSet->d_data, &fileSet->d_journal};
+    for (size_t i = 0; i < sizeof(files) / sizeof(*files); ++i) {
+        FileSet::FileInfo& file = *files[i];
+        BSLS_ASSERT_SAFE(file.d_syncPosition <= file.d_filePosition);
+
+        d_syncer_mp->addRange(file.d_file.mapping() + file.d_syncPosition,
+                              file.d_filePosition - file.d_syncPosition);
+        file.d_syncPosition = file.d_filePosition;
+    }
+
+    return d_syncer_mp->commit();
+}
+
+void FileStore::onGroupSynced(bsls::Types::Uint64 token, int status)
+{
+    // executed by the *SYNCER* thread
+
+    execute(bdlf::BindUtil::bind(&FileStore::onGroupSyncedDispatched,
+                                 this,
+                                 token,
+                                 status));
+}
+
+void FileStore::onGroupSyncedDispatched(bsls::Types::Uint64 token,
+                                        int                 status)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    if (0 != status) {
+        BMQTSK_ALARMLOG_ALARM("FILE_IO")
+            << partitionDesc()
+            << "Failed to sync partition files to disk, rc: " << status
+            << ". Messages pending this sync are NACKed."
+            << BMQTSK_ALARMLOG_END;
+    }
+
+    const bsls::Types::Uint64 previousToken = d_syncedToken;
+    d_syncedToken                           = bsl::max(d_syncedToken, token);
+
+    if (!d_isOpen || !d_isPrimary) {
+        return;  // RETURN
+    }
+
+    if (0 != status) {
+        // The messages may not be on disk: do not ACK them.
+        cancelUnsynced(previousToken, token);
+    }
+
+    processQuorumReceipts();
+
+    for (bsl::vector<mqbi::Queue*>::iterator it = d_receiptedQueues.begin();
+         it != d_receiptedQueues.end();
+         ++it) {
+        (*it)->onReplicatedBatch();
+    }
+    d_receiptedQueues.clear();
+}
+
 void FileStore::sendImplicitReceipt()
 {
     if (!d_primaryNode_p) {
@@ -6901,6 +7165,10 @@ void FileStore::setActivePrimary(mqbnet::ClusterNode* primaryNode,
     d_writeHeadLeaseId = primaryLeaseId;
     d_primaryNode_p    = primaryNode;
 
+    // Receipts accumulated for the previous primary are of no use to the new
+    // one, which learns of them via the implicit Receipt below.
+    clearPendingReceipt();
+
     BALL_LOG_INFO << partitionDesc() << "Primary node is now "
                   << primaryNode->nodeDescription() << " with PSN: "
                   << printPSN(d_writeHeadLeaseId, writeHeadSeqNum()) << ".";
@@ -6973,6 +7241,7 @@ void FileStore::clearPrimary()
                   << d_primaryNode_p->nodeDescription() << ". Current PSN: "
                   << printPSN(d_writeHeadLeaseId, writeHeadSeqNum()) << ".";
     d_primaryNode_p = 0;
+    clearPendingReceipt();
 
     // If self has a valid leaseId and zero sequence number (ie, previous
     // primary went away after issuing active primary stats advisory, but
@@ -7056,19 +7325,19 @@ void FileStore::notifyQueuesOnReplicatedBatch()
     }
 }
 
-void FileStore::gcExpiredMessages()
+bool FileStore::gcExpiredMessages()
 {
     if (!d_isOpen) {
-        return;  // RETURN
+        return false;  // RETURN
     }
 
     if (!d_isPrimary) {
-        return;  // RETURN
+        return false;  // RETURN
     }
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_isStopping)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return;  // RETURN
+        return false;  // RETURN
     }
 
     BSLS_ASSERT_SAFE(0 < d_fileSets.size());
@@ -7076,25 +7345,49 @@ void FileStore::gcExpiredMessages()
     BSLS_ASSERT_SAFE(activeFileSet);
 
     if (!activeFileSet->d_journalFileAvailable) {
-        return;  // RETURN
+        return false;  // RETURN
     }
 
     // Go over each file-backed storage registered with this partition and
-    // indicate it to GC any applicable messages.
+    // indicate it to GC any applicable messages.  Each storage keeps its
+    // messages in arrival order, which is also their TTL expiration order,
+    // so that it stops at the first message which has not expired yet.  The
+    // number of messages expired by this call is bounded by
+    // 'k_GC_EXPIRED_MESSAGES_BATCH_SIZE', and the next call resumes from the
+    // storage following the one at which the batch got exhausted, so that a
+    // storage with many expired messages does not starve the others.
 
     const bdlt::Datetime      currentTimeUtc = bdlt::CurrentTime::utc();
     const bsls::Types::Uint64 currentSecondsFromEpoch =
         static_cast<bsls::Types::Uint64>(
             bdlt::EpochUtil::convertToTimeT64(currentTimeUtc));
 
+    StorageMapIter it = d_storages.find(d_gcExpiredResumeKey);
+    if (it == d_storages.end()) {
+        it = d_storages.begin();
+    }
+    d_gcExpiredResumeKey.reset();
+
+    int  budget      = k_GC_EXPIRED_MESSAGES_BATCH_SIZE;
     bool needToFlush = false;
-    for (StorageMapIter it = d_storages.begin(); it != d_storages.end();
-         ++it) {
+    for (size_t i = 0; i < d_storages.size(); ++i) {
         ReplicatedStorage* rs        = it->second;
         const int          numMsgsGc = rs->gcExpiredMessages(currentTimeUtc,
-                                                    currentSecondsFromEpoch);
+                                                    currentSecondsFromEpoch,
+                                                    budget);
         if (numMsgsGc > 0) {
             needToFlush = true;
+            budget -= numMsgsGc;
+        }
+
+        if (++it == d_storages.end()) {
+            it = d_storages.begin();
+        }
+
+        if (0 >= budget) {
+            // The storages from this one on may have more expired messages.
+            d_gcExpiredResumeKey = it->first;
+            break;  // BREAK
         }
     }
 
@@ -7106,6 +7399,28 @@ void FileStore::gcExpiredMessages()
 
         flushStorage();
     }
+
+    return !d_gcExpiredResumeKey.isNull();
+}
+
+void FileStore::gcExpiredMessagesDispatched()
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    d_isGcExpiredPending = false;
+
+    if (gcExpiredMessages()) {
+        // Yield to the other events of this partition before expiring the
+        // next batch of messages.
+
+        d_isGcExpiredPending = true;
+        execute(
+            bdlf::BindUtil::bind(&FileStore::gcExpiredMessagesDispatched,
+                                 this));
+    }
 }
 
 void FileStore::gcHistory()
@@ -7249,6 +7564,10 @@ void FileStore::flush()
 
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    // The dispatcher queue of this partition drained: send the Receipts
+    // accumulated by the storage events processed since the last flush.
+    sendPendingReceipt();
 }
 
 void FileStore::scheduledCleanupStorages()
@@ -7265,7 +7584,9 @@ void FileStore::scheduledCleanupStorages()
         return;  // RETURN
     }
 
-    gcExpiredMessages();
+    if (!d_isGcExpiredPending) {
+        gcExpiredMessagesDispatched();
+    }
     gcHistory();
 }
 
@@ -7284,57 +7605,16 @@ void FileStore::setReplicationFactor(int value)
         return;
     }
 
-    // Build a set of unreceipted messages whose count of persisted replicas
-    // meets the new threshold replication factor.
-    bsl::unordered_set<mqbi::Queue*> affectedQueues(d_allocator_p);
+    // Notify the queues of the records pending Receipt which meet the new
+    // replication factor.
+    processQuorumReceipts();
 
-    Unreceipted::iterator it = d_unreceipted.begin();
-    mqbu::StorageKey      lastKey;
-    mqbi::Queue*          lastQueue = 0;
-    while (it != d_unreceipted.end()) {
-        if (it->second.d_count >= d_replicationFactor) {
-            it->second.d_handle->second.d_hasReceipt = true;
-
-            // Calculate time it took for the message to be stored and
-            // replicated.
-            const bsls::Types::Int64 timeDelta =
-                bmqu::Time::highResolutionTimer() -
-                it->second.d_handle->second.d_arrivalTimepoint;
-            d_partitionStats_sp->setReplicationTime(timeDelta);
-
-            // notify the queue.
-            const mqbu::StorageKey& queueKey  = it->second.d_queueKey;
-            bool                    haveQueue = (queueKey == lastKey);
-            if (!haveQueue) {
-                StorageMapIter sit = d_storages.find(queueKey);
-                if (sit != d_storages.end()) {
-                    haveQueue = true;
-                    lastKey   = queueKey;
-                    lastQueue = sit->second->queue();
-                    BSLS_ASSERT_SAFE(lastQueue);
-                    affectedQueues.insert(lastQueue);
-                }
-                // else the queue and its storage are gone; ignore the receipt
-            }
-            if (haveQueue) {
-                lastQueue->onReceipt(it->second.d_guid, it->second.d_qH);
-            }  // else the queue is gone
-            it = d_unreceipted.erase(it);
-        }
-        else {
-            // Since we have as an invariant that
-            //   unreceipted[k].d_count > unreceipted[k+1].d_count,
-            // We can safely break, once we find an entry whose count does not
-            // meet the replication factor.
-            break;
-        }
-    }
-    for (bsl::unordered_set<mqbi::Queue*>::iterator qit =
-             affectedQueues.begin();
-         qit != affectedQueues.end();
-         ++qit) {
-        (*qit)->queueEngine()->afterNewMessage();
+    for (bsl::vector<mqbi::Queue*>::iterator it = d_receiptedQueues.begin();
+         it != d_receiptedQueues.end();
+         ++it) {
+        (*it)->queueEngine()->afterNewMessage();
     }
+    d_receiptedQueues.clear();
 }
 
 void FileStore::getStorages(StorageList*          storages,
@@ -40,6 +40,7 @@
 #include <mqbs_datastore.h>
 #include <mqbs_fileset.h>
 #include <mqbs_filestoreprotocol.h>
+#include <mqbs_filesyncer.h>
 #include <mqbs_mappedfiledescriptor.h>
 #include <mqbs_storagecollectionutil.h>
 #include <mqbu_storagekey.h>
@@ -74,6 +75,7 @@
 #include <bsl_vector.h>
 #include <bslh_hash.h>
 #include <bslma_allocator.h>
+#include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_assert.h>
@@ -200,22 +202,27 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
         const bmqt::MessageGUID d_guid;
         const RecordIterator    d_handle;
         mqbi::QueueHandle*      d_qH;
-        int                     d_count;  // Primary initializes this as
-                                          // zero and increments for each
-                                          // Receipt. When it reaches
-                                          // 'd_replicationFactor', the
-                                          // Receipt'ed messages are
-                                          // strong consistent.
+
+        /// Whether the record needs Receipts from the replicas (strong
+        /// consistency), as opposed to only being synced to disk.
+        const bool d_needsReplication;
+
+        /// Token of the group sync covering the record, or 0 if group sync
+        /// is disabled.
+        const bsls::Types::Uint64 d_syncToken;
 
         ReceiptContext(const mqbu::StorageKey&  queueKey,
                        const bmqt::MessageGUID& guid,
                        const RecordIterator&    handle,
-                       int                      count,
-                       mqbi::QueueHandle*       qH);
+                       mqbi::QueueHandle*       qH,
+                       bool                     needsReplication,
+                       bsls::Types::Uint64      syncToken);
     };
 
     struct NodeContext {
-        /// Last Receipt from/to this node (Replica/Primary).
+        /// Last Receipt from/to this node (Replica/Primary).  Receipts are
+        /// cumulative: on the primary, this is the highest record key the
+        /// replica has confirmed, covering every record up to it.
         DataStoreRecordKey d_key;
 
         /// Receipt to this node.
@@ -311,6 +318,29 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
 
     NodeReceiptContexts d_nodes;
 
+    /// For strong consistency only.
+    /// Scratch buffer of the last Receipts from the replicas, reused to find
+    /// the highest record key confirmed by a quorum without allocating.
+    bsl::vector<DataStoreRecordKey> d_receiptKeys;
+
+    /// For strong consistency only.
+    /// Scratch buffer of the queues having records which reached the
+    /// replication factor, reused across Receipts.
+    bsl::vector<mqbi::Queue*> d_receiptedQueues;
+
+    /// Node to which the cumulative Receipt in `d_pendingReceipt_p` is yet to
+    /// be sent, if any.  Replicas accumulate Receipts across storage events
+    /// and send them on `flush` or once `k_RECEIPT_BATCH_SIZE` records are
+    /// pending.
+    mqbnet::ClusterNode* d_pendingReceiptNode_p;
+
+    /// Cumulative Receipt yet to be sent to `d_pendingReceiptNode_p`, if
+    /// any.
+    NodeContext* d_pendingReceipt_p;
+
+    /// Number of records confirmed by `d_pendingReceipt_p`.
+    int d_numPendingReceiptRecords;
+
     DataStoreRecordKey d_lastRecoveredStrongConsistency;
 
     FileSets d_fileSets;
@@ -353,6 +383,16 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     StoragesMap d_storages;
     // Map [QueueKey->ReplicatedStorage*]
 
+    mqbu::StorageKey d_gcExpiredResumeKey;
+    // Key of the storage from which the
+    // next TTL expiration batch resumes,
+    // or null to start from any storage.
+
+    bool d_isGcExpiredPending;
+    // Whether the continuation of an
+    // unfinished TTL expiration pass is
+    // enqueued in the dispatcher thread.
+
     bdlmt::Throttle d_alarmSoftLimiter;
     // Throttler for alarming on soft
     // limits of partition files
@@ -382,6 +422,14 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// Control message transmitter to use.
     mqbnet::ControlMessageTransmitter d_messageTransmitter;
 
+    /// Syncer of the writes of the primary to the files of the partition,
+    /// if group sync is enabled.  When enabled, records are not Receipted,
+    /// and so not acknowledged, until their group is synced to disk.
+    bslma::ManagedPtr<FileSyncer> d_syncer_mp;
+
+    /// Last token synced by `d_syncer_mp`.
+    bsls::Types::Uint64 d_syncedToken;
+
   private:
     // NOT IMPLEMENTED
     FileStore(const FileStore&) BSLS_CPP11_DELETED;
@@ -627,6 +675,12 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// still pending receipt of quorum Receipts.
     void cancelUnreceipted(const DataStoreRecordKey& recordKey);
 
+    /// Nack (as UNKNOWN) the messages still pending receipt whose group sync
+    /// token is greater than the specified `fromToken` and less than or
+    /// equal to the specified `toToken`, as their sync to disk failed.
+    void cancelUnsynced(bsls::Types::Uint64 fromToken,
+                        bsls::Types::Uint64 toToken);
+
     /// Generate Replication Receipt for the specified `node` confirming the
     /// receipt of message with the specified `primaryLeaseId` and
     /// `sequenceNumber`.  Store cumulative receipt in the specified
@@ -640,6 +694,40 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// using the specified `nodeContext`.
     void sendReceipt(mqbnet::ClusterNode* node, NodeContext* nodeContext);
 
+    /// Send the cumulative Receipt accumulated since the last call, if any,
+    /// and report the number of records it confirms.
+    void sendPendingReceipt();
+
+    /// Discard the cumulative Receipt accumulated since the last call to
+    /// `sendPendingReceipt`, if any.
+    void clearPendingReceipt();
+
+    /// Mark as replicated all the records pending Receipt which have been
+    /// confirmed by `d_replicationFactor` nodes (self included), in order,
+    /// notifying their queues, and load the queues having such records into
+    /// `d_receiptedQueues`.  This method has a cost proportional to the
+    /// number of nodes plus the number of records marked as replicated.
+    void processQuorumReceipts();
+
+    /// Hand the data and journal ranges of the specified `fileSet` written
+    /// since the last call over to `d_syncer_mp`, and return the token of
+    /// the group sync covering them.
+    bsls::Types::Uint64 requestGroupSync(FileSet* fileSet);
+
+    /// Callback invoked by `d_syncer_mp` once the writes up to the specified
+    /// `token` are synced to disk, with the specified `status`.
+    ///
+    /// THREAD: This method is invoked in the syncer thread.
+    void onGroupSynced(bsls::Types::Uint64 token, int status);
+
+    /// Mark as Receipted the records pending Receipt which are synced to
+    /// disk up to the specified `token` and have been confirmed by the
+    /// replicas.  If the specified `status` is non-zero, raise an alarm and
+    /// NACK the records covered by the failed sync instead.
+    ///
+    /// THREAD: This method is invoked in the dispatcher thread.
+    void onGroupSyncedDispatched(bsls::Types::Uint64 token, int status);
+
     /// Generate and send Replication Receipt for the
     /// `d_lastRecoveredStrongConsistency`, if any, to the current primary.
     void sendImplicitReceipt();
@@ -687,9 +775,19 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
                       bsl::shared_ptr<bdlbb::Blob>* options,
                       const DataStoreRecord&        record) const;
 
-    /// Attempt to garbage-collect messages for which TTL has expired.
-    /// Note that this routine is no-op unless at the primary node.
-    void gcExpiredMessages();
+    /// Attempt to garbage-collect a batch of messages for which TTL has
+    /// expired, visiting the storages in a round-robin fashion so that a
+    /// storage with a large number of expired messages does not starve the
+    /// others.  Return true if the batch was exhausted and more messages may
+    /// have expired, and false otherwise.  Note that this routine is no-op
+    /// unless at the primary node.
+    bool gcExpiredMessages();
+
+    /// Garbage-collect a batch of messages for which TTL has expired and, if
+    /// there may be more of them, enqueue the continuation of this routine
+    /// in the dispatcher thread so that other events get processed between
+    /// the batches.
+    void gcExpiredMessagesDispatched();
 
     /// Delete an history of guids or messages maintained by this data
     /// store.  Note that this routine is invoked at primary as well as
@@ -877,9 +975,11 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
         BSLS_KEYWORD_OVERRIDE;
 
     /// Process Receipt for the specified `primaryLeaseId` and
-    /// `sequenceNum`.  The behavior is undefined unless the event belongs
-    /// to this partition and unless the `primaryLeaseId` and `sequenceNum`
-    /// match a record of the `StorageMessageType::e_DATA` type.
+    /// `sequenceNum` from the specified `source`.  The Receipt is
+    /// cumulative: it confirms every record up to the specified one.  The
+    /// behavior is undefined unless the event belongs to this partition and
+    /// unless the `primaryLeaseId` and `sequenceNum` match a record of the
+    /// `StorageMessageType::e_DATA` type.
     void
     processReceiptEvent(unsigned int         primaryLeaseId,
                         bsls::Types::Uint64  sequenceNum,
@@ -1134,13 +1234,15 @@ inline FileStore::ReceiptContext::ReceiptContext(
     const mqbu::StorageKey&  queueKey,
     const bmqt::MessageGUID& guid,
     const RecordIterator&    handle,
-    int                      count,
-    mqbi::QueueHandle*       qH)
+    mqbi::QueueHandle*       qH,
+    bool                     needsReplication,
+    bsls::Types::Uint64      syncToken)
 : d_queueKey(queueKey)
 , d_guid(guid)
 , d_handle(handle)
 , d_qH(qH)
-, d_count(count)
+, d_needsReplication(needsReplication)
+, d_syncToken(syncToken)
 {
     // NOTHING
 }
@@ -23,6 +23,7 @@
 #include <mqbmock_dispatcher.h>
 #include <mqbmock_domain.h>
 #include <mqbmock_queue.h>
+#include <mqbmock_queueengine.h>
 #include <mqbnet_mockcluster.h>
 #include <mqbs_datastore.h>
 #include <mqbs_filestoreprotocol.h>
@@ -69,6 +70,7 @@
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_threadutil.h>
 #include <bsls_platform.h>
 #include <bsls_systemclocktype.h>
 #include <bsls_types.h>
@@ -118,9 +120,10 @@ class StoragePoster {
     {
     }
 
-    /// Post a dummy message to the underlying storage. Return the result
-    /// of the put operation.
-    mqbi::StorageResult::Enum postMessage()
+    /// Post a dummy message, which arrived the optionally specified
+    /// `ageSeconds` ago, to the underlying storage. Return the result of the
+    /// put operation.
+    mqbi::StorageResult::Enum postMessage(bsls::Types::Uint64 ageSeconds = 0)
     {
         bmqt::MessageGUID guid;
         mqbu::MessageGUIDUtil::generateGUID(&guid);
@@ -134,8 +137,9 @@ class StoragePoster {
                                 payload.c_str(),
                                 payload.length());
 
-        bsls::Types::Uint64 timestamp = bdlt::EpochUtil::convertToTimeT64(
-            bdlt::CurrentTime::utc());
+        bsls::Types::Uint64 timestamp =
+            bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()) -
+            ageSeconds;
 
         mqbi::StorageMessageAttributes attributes(
             timestamp,
@@ -254,7 +258,11 @@ class Tester {
 
   public:
     // CREATORS
-    explicit Tester(bsl::string_view location)
+    /// Create a tester for a partition at the specified `location`,
+    /// syncing the writes of the primary to disk in groups every
+    /// optionally specified `groupSyncIntervalUs` microseconds, or not
+    /// waiting for them to be synced if it is 0.
+    explicit Tester(bsl::string_view location, int groupSyncIntervalUs = 0)
     : d_allocator_p(bmqtst::TestHelperUtil::allocator())
     , d_scheduler(bsls::SystemClockType::e_MONOTONIC, d_allocator_p)
     , d_bufferFactory(1024, d_allocator_p)
@@ -334,6 +342,8 @@ class Tester {
             .setMaxDataFileSize(d_partitionCfg.maxDataFileSize())
             .setMaxJournalFileSize(d_partitionCfg.maxJournalFileSize())
             .setMaxQlistFileSize(d_partitionCfg.maxQlistFileSize())
+            .setGroupSyncIntervalUs(groupSyncIntervalUs)
+            .setGroupSyncBytes(1024 * 1024)
             .setRecoveredQueuesCb(bdlf::BindUtil::bind(
                 &recoveredQueuesCb,
                 bdlf::PlaceHolders::_1,    // partitionId
@@ -1543,8 +1553,383 @@ static void test6_leaseTransitionWithoutSeal()
     BMQTST_ASSERT_EQ(0, rc);
 }
 
+static void test7_cumulativeReceipts()
+// ------------------------------------------------------------------------
+// CUMULATIVE RECEIPTS
+//
+// Concerns:
+//   A Receipt from a replica confirms every record up to the one it names.
+//   A record pending Receipt is marked as replicated once confirmed by
+//   'replicationFactor' nodes (self included), irrespective of the order in
+//   which the replicas' Receipts arrive, and outdated Receipts are ignored.
+//
+// Testing:
+//   processReceiptEvent, setReplicationFactor
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    Tester           tester("./test-cluster123-7");
+    mqbs::FileStore& fs = tester.fileStore();
+
+    int rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+
+    // Set primary with leaseId 1; a sync point is issued -> [1, 1].
+    fs.setActivePrimary(tester.node(), 1);
+    fs.setReplicationFactor(3);
+
+    // Two replicas sending Receipts.
+    mqbcfg::ClusterDefinition replicasCfg(bmqtst::TestHelperUtil::allocator());
+    replicasCfg.name().assign("replicas");
+    for (int nodeId = 1; nodeId <= 2; ++nodeId) {
+        mqbcfg::ClusterNode nodeCfg(bmqtst::TestHelperUtil::allocator());
+        nodeCfg.id() = nodeId;
+        bmqu::MemOutStream name(bmqtst::TestHelperUtil::allocator());
+        name << "replica" << nodeId;
+        nodeCfg.name().assign(name.str().data(), name.str().length());
+        nodeCfg.dataCenter() = "US-WEST";
+        nodeCfg.transport().makeTcp().endpoint().assign(
+            "tcp://localhost:34567");
+        replicasCfg.nodes().push_back(nodeCfg);
+    }
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    mqbnet::MockCluster  replicas(replicasCfg,
+                                 &bufferFactory,
+                                 bmqtst::TestHelperUtil::allocator());
+    mqbnet::ClusterNode* replica1 = replicas.lookupNode(1);
+    mqbnet::ClusterNode* replica2 = replicas.lookupNode(2);
+
+    // Write 4 message records pending Receipt -> [1, 2] to [1, 5].
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "ABCDE");
+    const int              k_NUM_MESSAGES = 4;
+    mqbs::DataStoreRecordHandle handles[k_NUM_MESSAGES];
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        bmqt::MessageGUID guid;
+        mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+        bsl::shared_ptr<bdlbb::Blob> appData_sp;
+        appData_sp.createInplace(bmqtst::TestHelperUtil::allocator(),
+                                 &bufferFactory,
+                                 bmqtst::TestHelperUtil::allocator());
+        bdlbb::BlobUtil::append(appData_sp.get(), "payload", 7);
+
+        mqbi::StorageMessageAttributes attributes(
+            bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+            1,  // refCount
+            static_cast<unsigned int>(appData_sp->length()),
+            bmqp::MessagePropertiesInfo(),
+            bmqt::CompressionAlgorithmType::e_NONE,
+            false,  // hasReceipt
+            0,      // queueHandle
+            bmqp::Crc32c::calculate(*appData_sp));
+
+        rc = fs.writeMessageRecord(&attributes,
+                                   &handles[i],
+                                   guid,
+                                   appData_sp,
+                                   bsl::shared_ptr<bdlbb::Blob>(),
+                                   queueKey);
+        BMQTST_ASSERT_EQ(0, rc);
+        BMQTST_ASSERT_EQ(false, fs.hasReceipt(handles[i]));
+    }
+
+    // A single replica is not a quorum.
+    fs.processReceiptEvent(1, 3, replica1);
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        BMQTST_ASSERT_EQ_D(i, false, fs.hasReceipt(handles[i]));
+    }
+
+    // The second replica confirms all the records, so that the records
+    // confirmed by the first replica reach the replication factor.
+    fs.processReceiptEvent(1, 5, replica2);
+    BMQTST_ASSERT_EQ(true, fs.hasReceipt(handles[0]));
+    BMQTST_ASSERT_EQ(true, fs.hasReceipt(handles[1]));
+    BMQTST_ASSERT_EQ(false, fs.hasReceipt(handles[2]));
+    BMQTST_ASSERT_EQ(false, fs.hasReceipt(handles[3]));
+
+    // An outdated Receipt is ignored.
+    fs.processReceiptEvent(1, 2, replica1);
+    BMQTST_ASSERT_EQ(false, fs.hasReceipt(handles[2]));
+
+    // Cumulative Receipt for a subset of the remaining records.
+    fs.processReceiptEvent(1, 4, replica1);
+    BMQTST_ASSERT_EQ(true, fs.hasReceipt(handles[2]));
+    BMQTST_ASSERT_EQ(false, fs.hasReceipt(handles[3]));
+
+    // Lowering the replication factor marks the records confirmed by the
+    // second replica only.
+    fs.setReplicationFactor(2);
+    BMQTST_ASSERT_EQ(true, fs.hasReceipt(handles[3]));
+
+    rc = fs.close();
+    BMQTST_ASSERT_EQ(0, rc);
+}
+
+static void test8_gcExpiredMessagesInBatches()
+// ------------------------------------------------------------------------
+// GC EXPIRED MESSAGES IN BATCHES
+//
+// Concerns:
+//   Messages for which TTL has expired are garbage-collected by batches of
+//   bounded size, the continuation of an unfinished pass being enqueued in
+//   the dispatcher thread, until all the expired messages are removed.
+//   A batch exhausted by a storage is followed by a batch starting at the
+//   next storage, so that a storage with many expired messages does not
+//   starve the others.  A scheduled cleanup does not start another pass
+//   while a continuation is pending, and messages for which TTL has not
+//   expired are kept.
+//
+// Testing:
+//   scheduledCleanupStorages
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    Tester           tester("./test-cluster123-8");
+    mqbs::FileStore& fs = tester.fileStore();
+
+    // Enqueue the continuations of GC passes, so that they can be observed.
+    tester.dispatcher().setEnqueueOnly(true);
+
+    int rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    if (rc) {
+        cout << "Failed to open partition, rc: " << rc << endl;
+        return;  // RETURN
+    }
+
+    fs.setActivePrimary(tester.node(), 1);
+
+    // Create two storages with a TTL of one minute and register them with
+    // the FileStore.
+    const int   k_NUM_STORAGES               = 2;
+    const char* k_QUEUE_URIS[k_NUM_STORAGES] = {
+        "bmq://si.amw.bmq.stats/testQueue1",
+        "bmq://si.amw.bmq.stats/testQueue2"};
+    const char* k_QUEUE_KEYS[k_NUM_STORAGES] = {"ABCDE", "FGHIJ"};
+
+    mqbmock::Cluster mockCluster(bmqtst::TestHelperUtil::allocator());
+    mqbmock::Domain  mockDomain(&mockCluster,
+                               bmqtst::TestHelperUtil::allocator());
+    mqbconfm::Domain domainCfg(bmqtst::TestHelperUtil::allocator());
+    domainCfg.messageTtl() = 60;
+    domainCfg.storage().config().makeFileBacked();
+    bmqu::MemOutStream errDesc(bmqtst::TestHelperUtil::allocator());
+    mockDomain.configure(errDesc, domainCfg);
+
+    mqbconfm::Limits limits;
+    limits.messages() = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.bytes()    = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.messagesWatermarkRatio() = 0.8;
+    limits.bytesWatermarkRatio()    = 0.8;
+
+    mqbmock::QueueEngine mockQueueEngine(bmqtst::TestHelperUtil::allocator());
+    mqbmock::Queue mockQueue1(&mockDomain,
+                              bmqtst::TestHelperUtil::allocator());
+    mqbmock::Queue mockQueue2(&mockDomain,
+                              bmqtst::TestHelperUtil::allocator());
+    mqbmock::Queue* mockQueues[k_NUM_STORAGES] = {&mockQueue1, &mockQueue2};
+
+    bsl::shared_ptr<mqbs::ReplicatedStorage> storages[k_NUM_STORAGES];
+    const bsls::Types::Uint64 timestamp = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+    for (int i = 0; i < k_NUM_STORAGES; ++i) {
+        bmqt::Uri        queueUri(k_QUEUE_URIS[i],
+                           bmqtst::TestHelperUtil::allocator());
+        mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                  k_QUEUE_KEYS[i]);
+
+        fs.createStorage(&storages[i], queueUri, queueKey, &mockDomain);
+        storages[i]->configure(domainCfg.storage().config(),
+                               limits,
+                               domainCfg.messageTtl(),
+                               0);  // maxDeliveryAttempts
+
+        fs.registerStorage(storages[i].get());
+
+        mockQueues[i]->_setQueueEngine(&mockQueueEngine);
+        storages[i]->setQueue(mockQueues[i]);
+
+        mqbs::DataStoreRecordHandle queueHandle;
+        rc = fs.writeQueueCreationRecord(&queueHandle,
+                                         queueUri,
+                                         queueKey,
+                                         AppInfos(),
+                                         timestamp,
+                                         true);  // isNewQueue
+        BMQTST_ASSERT_EQ_D(i, 0, rc);
+    }
+
+    // Post to each storage messages which arrived an hour ago, followed by
+    // fresh messages.
+    const bsls::Types::Int64 k_NUM_EXPIRED = 2500;
+    const bsls::Types::Int64 k_NUM_ALIVE   = 10;
+
+    for (int i = 0; i < k_NUM_STORAGES; ++i) {
+        StoragePoster poster(storages[i],
+                             bmqtst::TestHelperUtil::allocator());
+        for (bsls::Types::Int64 j = 0; j < k_NUM_EXPIRED; ++j) {
+            BMQTST_ASSERT_EQ_D(i,
+                               mqbi::StorageResult::e_SUCCESS,
+                               poster.postMessage(3600));
+        }
+        for (bsls::Types::Int64 j = 0; j < k_NUM_ALIVE; ++j) {
+            BMQTST_ASSERT_EQ_D(i,
+                               mqbi::StorageResult::e_SUCCESS,
+                               poster.postMessage());
+        }
+    }
+    tester.dispatcher().processQueue();
+
+    bsls::Types::Int64 numMessages[k_NUM_STORAGES];
+    for (int i = 0; i < k_NUM_STORAGES; ++i) {
+        numMessages[i] = storages[i]->numMessages(
+            mqbu::StorageKey::k_NULL_KEY);
+        BMQTST_ASSERT_EQ_D(i, k_NUM_EXPIRED + k_NUM_ALIVE, numMessages[i]);
+    }
+
+    // The first pass expires a single batch, exhausted by one of the
+    // storages, and enqueues its continuation.
+    fs.scheduledCleanupStorages();
+    const bsls::Types::Int64 numMessagesAfterBatch1 =
+        storages[0]->numMessages(mqbu::StorageKey::k_NULL_KEY) +
+        storages[1]->numMessages(mqbu::StorageKey::k_NULL_KEY);
+    BMQTST_ASSERT_GT(numMessagesAfterBatch1, 2 * k_NUM_ALIVE);
+    BMQTST_ASSERT_LT(numMessagesAfterBatch1,
+                     2 * (k_NUM_EXPIRED + k_NUM_ALIVE));
+
+    // Another scheduled cleanup leaves expiration to the pending
+    // continuation.
+    fs.scheduledCleanupStorages();
+    BMQTST_ASSERT_EQ(numMessagesAfterBatch1,
+                     storages[0]->numMessages(mqbu::StorageKey::k_NULL_KEY) +
+                         storages[1]->numMessages(
+                             mqbu::StorageKey::k_NULL_KEY));
+
+    // The second batch starts at the other storage, so that both storages
+    // have expired messages removed while they both still have some left.
+    BMQTST_ASSERT(tester.dispatcher().processOne());
+    for (int i = 0; i < k_NUM_STORAGES; ++i) {
+        numMessages[i] = storages[i]->numMessages(
+            mqbu::StorageKey::k_NULL_KEY);
+        BMQTST_ASSERT_LT_D(i, numMessages[i], k_NUM_EXPIRED + k_NUM_ALIVE);
+        BMQTST_ASSERT_GT_D(i, numMessages[i], k_NUM_ALIVE);
+    }
+
+    // The continuations expire all the remaining expired messages.
+    tester.dispatcher().processQueue();
+    for (int i = 0; i < k_NUM_STORAGES; ++i) {
+        BMQTST_ASSERT_EQ_D(
+            i,
+            k_NUM_ALIVE,
+            storages[i]->numMessages(mqbu::StorageKey::k_NULL_KEY));
+    }
+
+    tester.scheduler().cancelAllEventsAndWait();
+    tester.dispatcher().processQueue();
+    for (int i = 0; i < k_NUM_STORAGES; ++i) {
+        fs.unregisterStorage(storages[i].get());
+    }
+    rc = fs.close();
+    BMQTST_ASSERT_EQ(0, rc);
+}
+
 }  // close unnamed namespace
 
+static void test9_groupSyncHoldsReceipts()
+// ------------------------------------------------------------------------
+// GROUP SYNC HOLDS RECEIPTS
+//
+// Concerns:
+//   With group sync enabled, a message record written by the primary is
+//   not Receipted, and so not acknowledged, until the group sync covering
+//   it completes, even if it needs no Receipt from any replica.  All the
+//   records written during the interval complete with the same sync.
+//
+// Testing:
+//   writeMessageRecord, with 'groupSyncIntervalUs' > 0
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const int        k_GROUP_SYNC_INTERVAL_US = 10 * 1000;
+    Tester           tester("./test-cluster123-9", k_GROUP_SYNC_INTERVAL_US);
+    mqbs::FileStore& fs = tester.fileStore();
+
+    // Enqueue the completions of the group syncs, so that they can be
+    // observed.
+    tester.dispatcher().setEnqueueOnly(true);
+
+    int rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    if (rc) {
+        cout << "Failed to open partition, rc: " << rc << endl;
+        return;  // RETURN
+    }
+
+    fs.setActivePrimary(tester.node(), 1);
+    tester.dispatcher().processQueue();
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "ABCDE");
+    const int              k_NUM_MESSAGES = 4;
+    mqbs::DataStoreRecordHandle handles[k_NUM_MESSAGES];
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        bmqt::MessageGUID guid;
+        mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+        bsl::shared_ptr<bdlbb::Blob> appData_sp;
+        appData_sp.createInplace(bmqtst::TestHelperUtil::allocator(),
+                                 &bufferFactory,
+                                 bmqtst::TestHelperUtil::allocator());
+        bdlbb::BlobUtil::append(appData_sp.get(), "payload", 7);
+
+        mqbi::StorageMessageAttributes attributes(
+            bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+            1,  // refCount
+            static_cast<unsigned int>(appData_sp->length()),
+            bmqp::MessagePropertiesInfo(),
+            bmqt::CompressionAlgorithmType::e_NONE,
+            false,  // hasReceipt
+            0,      // queueHandle
+            bmqp::Crc32c::calculate(*appData_sp));
+
+        rc = fs.writeMessageRecord(&attributes,
+                                   &handles[i],
+                                   guid,
+                                   appData_sp,
+                                   bsl::shared_ptr<bdlbb::Blob>(),
+                                   queueKey);
+        BMQTST_ASSERT_EQ(0, rc);
+    }
+
+    // The replication factor of 1 is reached by self alone, but the records
+    // are not synced yet.
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        BMQTST_ASSERT_EQ_D(i, false, fs.hasReceipt(handles[i]));
+    }
+
+    // Wait for the completion of the group sync.
+    for (int i = 0; i < 500 && !fs.hasReceipt(handles[0]); ++i) {
+        bslmt::ThreadUtil::microSleep(k_GROUP_SYNC_INTERVAL_US);
+        tester.dispatcher().processQueue();
+    }
+
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        BMQTST_ASSERT_EQ_D(i, true, fs.hasReceipt(handles[i]));
+    }
+
+    rc = fs.close();
+    BMQTST_ASSERT_EQ(0, rc);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1557,6 +1942,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 9: test9_groupSyncHoldsReceipts(); break;
+    case 8: test8_gcExpiredMessagesInBatches(); break;
+    case 7: test7_cumulativeReceipts(); break;
     case 6: test6_leaseTransitionWithoutSeal(); break;
     case 5: test5_writeHeadFollowsAppliedLease(); break;
     case 4: test4_recoverMessagesAcrossLeaseIds(); break;
@@ -0,0 +1,282 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbs_filesyncer.h>
+
+#include <mqbscm_version.h>
+// MQB
+#include <mqbs_filesystemutil.h>
+
+// BMQ
+#include <bmqu_memoutstream.h>
+
+// BDE
+#include <bdlf_memfn.h>
+#include <bdls_memoryutil.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
+#include <bsls_assert.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_systemtime.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// ----------------
+// class FileSyncer
+// ----------------
+
+// PRIVATE MANIPULATORS
+void FileSyncer::threadFn()
+{
+    // executed by the *SYNCER* thread
+
+    Ranges ranges(d_allocator_p);
+
+    while (true) {
+        bsls::Types::Uint64 token = 0;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+            while (d_committedToken == d_takenToken && !d_isStopping) {
+                d_condition.wait(&d_mutex);
+            }
+
+            if (d_committedToken == d_takenToken) {
+                // Stopping, and nothing left to sync.
+                break;  // BREAK
+            }
+
+            // Keep accumulating the ranges committed until the interval of the
+            // group elapses, unless enough bytes are pending or the group is
+            // needed immediately.
+            const bsls::TimeInterval deadline = d_firstCommitTime +
+                                                d_interval;
+            while (!d_isStopping && d_numDrainers == 0 &&
+                   d_pendingBytes < d_maxPendingBytes) {
+                if (0 != d_condition.timedWait(&d_mutex, deadline)) {
+                    break;  // BREAK
+                }
+            }
+
+            token        = d_committedToken;
+            d_takenToken = token;
+            ranges.swap(d_pendingRanges);
+            d_pendingBytes = 0;
+        }
+
+        const int rc = syncRanges(ranges);
+        ranges.clear();
+
+        d_syncCb(token, rc);
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+            d_syncedToken = token;
+        }
+        d_syncedCondition.broadcast();
+    }
+}
+
+int FileSyncer::syncRanges(const Ranges& ranges)
+{
+    // executed by the *SYNCER* thread
+
+    static const bsls::Types::UintPtr k_PAGE_SIZE =
+        static_cast<bsls::Types::UintPtr>(bdls::MemoryUtil::pageSize());
+
+    int                rc = 0;
+    bmqu::MemOutStream errorDesc(d_allocator_p);
+    for (Ranges::const_iterator it = ranges.begin(); it != ranges.end();
+         ++it) {
+        // 'msync' requires a page-aligned address.  Note that a mapping
+        // always starts at a page boundary, so the aligned address is still
+        // within the mapping of the range.
+        char* begin = it->d_begin_p -
+                      reinterpret_cast<bsls::Types::UintPtr>(it->d_begin_p) %
+                          k_PAGE_SIZE;
+
+        const int syncRc = FileSystemUtil::flush(
+            begin,
+            static_cast<bsls::Types::Uint64>(it->d_end_p - begin),
+            errorDesc);
+        if (0 != syncRc) {
+            BALL_LOG_ERROR << "Failed to sync range of "
+                           << (it->d_end_p - it->d_begin_p)
+                           << " bytes: " << errorDesc.str();
+            errorDesc.reset();
+            rc = syncRc;
+        }
+    }
+
+    return rc;
+}
+
+// CREATORS
+FileSyncer::FileSyncer(int                 intervalUs,
+                       bsls::Types::Uint64 maxPendingBytes,
+                       const SyncCb&       syncCb,
+                       bslma::Allocator*   allocator)
+: d_allocator_p(allocator)
+, d_interval(0, intervalUs * 1000)
+, d_maxPendingBytes(maxPendingBytes)
+, d_syncCb(bsl::allocator_arg, allocator, syncCb)
+, d_mutex()
+, d_condition(bsls::SystemClockType::e_MONOTONIC)
+, d_syncedCondition()
+, d_pendingRanges(allocator)
+, d_pendingBytes(0)
+, d_committedToken(0)
+, d_takenToken(0)
+, d_syncedToken(0)
+, d_firstCommitTime()
+, d_numDrainers(0)
+, d_isStopping(false)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_isStarted(false)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < intervalUs);
+    BSLS_ASSERT_SAFE(syncCb);
+}
+
+FileSyncer::~FileSyncer()
+{
+    stop();
+}
+
+// MANIPULATORS
+int FileSyncer::start()
+{
+    enum RcEnum { rc_SUCCESS = 0, rc_THREAD_CREATION_FAILURE = -1 };
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_isStarted);
+
+    d_isStopping = false;
+
+    bslmt::ThreadAttributes attributes;
+    attributes.setThreadName("bmqFileSyncer");
+    const int rc = bslmt::ThreadUtil::createWithAllocator(
+        &d_threadHandle,
+        attributes,
+        bdlf::MemFnUtil::memFn(&FileSyncer::threadFn, this),
+        d_allocator_p);
+    if (0 != rc) {
+        BALL_LOG_ERROR << "Failed to create the syncer thread, rc: " << rc;
+        return rc_THREAD_CREATION_FAILURE;  // RETURN
+    }
+
+    d_isStarted = true;
+    return rc_SUCCESS;
+}
+
+void FileSyncer::stop()
+{
+    if (!d_isStarted) {
+        return;  // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        d_isStopping = true;
+    }
+    d_condition.signal();
+
+    bslmt::ThreadUtil::join(d_threadHandle);
+    d_isStarted = false;
+}
+
+void FileSyncer::addRange(char* address, bsls::Types::Uint64 length)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(address);
+
+    if (0 == length) {
+        return;  // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    d_pendingBytes += length;
+
+    if (!d_pendingRanges.empty() &&
+        d_pendingRanges.back().d_end_p == address) {
+        // Contiguous to the last range: extend it.
+        d_pendingRanges.back().d_end_p += length;
+        return;  // RETURN
+    }
+
+    Range range;
+    range.d_begin_p = address;
+    range.d_end_p   = address + length;
+    d_pendingRanges.push_back(range);
+}
+
+bsls::Types::Uint64 FileSyncer::commit()
+{
+    bool                notify = false;
+    bsls::Types::Uint64 token  = 0;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        if (d_committedToken == d_takenToken) {
+            // First commit of the group: start its interval.
+            d_firstCommitTime = bsls::SystemTime::nowMonotonicClock();
+            notify            = true;
+        }
+        else {
+            notify = d_pendingBytes >= d_maxPendingBytes;
+        }
+
+        token = ++d_committedToken;
+    }
+
+    if (notify) {
+        d_condition.signal();
+    }
+
+    return token;
+}
+
+void FileSyncer::drain()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isStarted);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    const bsls::Types::Uint64 token = d_committedToken;
+    if (d_syncedToken >= token) {
+        return;  // RETURN
+    }
+
+    ++d_numDrainers;
+    d_condition.signal();
+    while (d_syncedToken < token) {
+        d_syncedCondition.wait(&d_mutex);
+    }
+    --d_numDrainers;
+}
+
+// ACCESSORS
+bsls::Types::Uint64 FileSyncer::syncedToken() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+    return d_syncedToken;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
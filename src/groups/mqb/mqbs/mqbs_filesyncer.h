@@ -0,0 +1,222 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MQBS_FILESYNCER
+#define INCLUDED_MQBS_FILESYNCER
+
+/// @file mqbs_filesyncer.h
+///
+/// @brief Provide a mechanism syncing batches of memory-mapped file writes.
+///
+/// @bbref{mqbs::FileSyncer} is a mechanism owning a thread which syncs to
+/// disk the ranges of memory-mapped files written by its user, in groups.
+/// The user appends the ranges it wrote with `addRange`, and then calls
+/// `commit` to obtain a token identifying everything appended so far.  The
+/// thread accumulates committed ranges until either the configured interval
+/// has elapsed since the first of them was committed, or the configured
+/// number of bytes is pending, then syncs all of them at once and invokes the
+/// sync callback with the highest token covered.  A single callback therefore
+/// completes all the writes committed during the interval, amortizing the
+/// cost of the sync over all of them.
+///
+/// Contiguous ranges are merged when appended, so that a user appending the
+/// ranges written sequentially to a file syncs that file with a single
+/// system call per group.
+///
+/// Lifetime                                        {#mqbs_filesyncer_lifetime}
+/// ========
+///
+/// The memory of the ranges appended must remain mapped until they are
+/// synced.  `drain` blocks until all the committed ranges are synced, and is
+/// meant to be called before unmapping a file whose ranges may be pending.
+/// `stop` syncs all pending ranges before joining the thread.
+///
+/// Thread Safety                                     {#mqbs_filesyncer_thread}
+/// =============
+///
+/// `addRange`, `commit` and `drain` must be called from a single thread.
+/// The sync callback is invoked from the thread owned by this object.
+
+// BDE
+#include <ball_log.h>
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// ================
+// class FileSyncer
+// ================
+
+/// Mechanism syncing batches of memory-mapped file writes from a dedicated
+/// thread.
+class FileSyncer {
+  public:
+    // TYPES
+
+    /// Callback invoked when all the ranges committed up to and including
+    /// the specified `token` have been synced, with the specified `status`
+    /// being 0 on success and non-zero if any of them failed to sync.
+    typedef bsl::function<void(bsls::Types::Uint64 token, int status)>
+        SyncCb;
+
+  private:
+    // CLASS-SCOPE CATEGORY
+    BALL_LOG_SET_CLASS_CATEGORY("MQBS.FILESYNCER");
+
+  private:
+    // PRIVATE TYPES
+
+    /// Range `[d_begin_p, d_end_p)` of a memory-mapped file.
+    struct Range {
+        char* d_begin_p;
+        char* d_end_p;
+    };
+
+    typedef bsl::vector<Range> Ranges;
+
+  private:
+    // DATA
+
+    /// Allocator used to supply memory.
+    bslma::Allocator* d_allocator_p;
+
+    /// Maximum time during which committed ranges are accumulated.
+    bsls::TimeInterval d_interval;
+
+    /// Number of pending bytes after which ranges are synced without
+    /// waiting for `d_interval`.
+    bsls::Types::Uint64 d_maxPendingBytes;
+
+    /// Callback invoked after each group of ranges is synced.
+    SyncCb d_syncCb;
+
+    /// Mutex protecting the state below.
+    mutable bslmt::Mutex d_mutex;
+
+    /// Condition signaled to wake up the thread.
+    bslmt::Condition d_condition;
+
+    /// Condition signaled when a group of ranges is synced.
+    bslmt::Condition d_syncedCondition;
+
+    /// Ranges appended and not yet taken by the thread.
+    Ranges d_pendingRanges;
+
+    /// Number of bytes of `d_pendingRanges`.
+    bsls::Types::Uint64 d_pendingBytes;
+
+    /// Last token returned by `commit`.
+    bsls::Types::Uint64 d_committedToken;
+
+    /// Last token taken by the thread.
+    bsls::Types::Uint64 d_takenToken;
+
+    /// Last token synced.
+    bsls::Types::Uint64 d_syncedToken;
+
+    /// Monotonic time at which the first token not yet taken by the thread
+    /// was committed.
+    bsls::TimeInterval d_firstCommitTime;
+
+    /// Number of threads blocked in `drain`.
+    int d_numDrainers;
+
+    /// Whether the thread was asked to stop.
+    bool d_isStopping;
+
+    /// Handle to the thread, if started.
+    bslmt::ThreadUtil::Handle d_threadHandle;
+
+    /// Whether the thread is started.
+    bool d_isStarted;
+
+  private:
+    // NOT IMPLEMENTED
+    FileSyncer(const FileSyncer&) BSLS_KEYWORD_DELETED;
+    FileSyncer& operator=(const FileSyncer&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Main function of the thread.
+    void threadFn();
+
+    /// Sync the specified `ranges`.  Return 0 on success and a non-zero
+    /// value if any of them failed to sync.
+    int syncRanges(const Ranges& ranges);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FileSyncer, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a stopped instance syncing the committed ranges once the
+    /// specified `intervalUs` microseconds have elapsed since the first of
+    /// them was committed, or once they total the specified
+    /// `maxPendingBytes`, and invoking the specified `syncCb` after each
+    /// sync.  Use the specified `allocator` for memory allocations.
+    FileSyncer(int                 intervalUs,
+               bsls::Types::Uint64 maxPendingBytes,
+               const SyncCb&       syncCb,
+               bslma::Allocator*   allocator);
+
+    /// Stop and destroy this object.
+    ~FileSyncer();
+
+    // MANIPULATORS
+
+    /// Start the thread.  Return 0 on success and a non-zero value
+    /// otherwise.
+    int start();
+
+    /// Sync all the pending ranges and join the thread.  This method has no
+    /// effect if the thread is not started.
+    void stop();
+
+    /// Append the range of the specified `length` starting at the specified
+    /// `address` of a memory-mapped file to the next group.
+    void addRange(char* address, bsls::Types::Uint64 length);
+
+    /// Commit all the ranges appended so far and return the token
+    /// identifying them, which is passed to the sync callback once they
+    /// are synced.  Tokens are strictly increasing.
+    bsls::Types::Uint64 commit();
+
+    /// Block until all the ranges committed so far are synced, syncing them
+    /// immediately.  The behavior is undefined unless the thread is started.
+    void drain();
+
+    // ACCESSORS
+
+    /// Return the last token synced.
+    bsls::Types::Uint64 syncedToken() const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
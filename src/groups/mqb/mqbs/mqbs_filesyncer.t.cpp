@@ -0,0 +1,549 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbs_filesyncer.h>
+
+// MQB
+#include <mqbs_filesystemutil.h>
+#include <mqbs_mappedfiledescriptor.h>
+
+// BMQ
+#include <bmqu_memoutstream.h>
+#include <bmqu_printutil.h>
+#include <bmqu_tempdirectory.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bdls_memoryutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bsla_annotations.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef mqbs::FileSyncer Obj;
+
+/// Memory-mapped file of a given size in a temporary directory.
+struct MappedFile {
+    bmqu::TempDirectory        d_tempDir;
+    mqbs::MappedFileDescriptor d_mfd;
+
+    MappedFile(bsls::Types::Uint64 size, bslma::Allocator* allocator)
+    : d_tempDir(allocator)
+    , d_mfd()
+    {
+        const bsl::string  path = d_tempDir.path() + "/file";
+        bmqu::MemOutStream errorDesc(allocator);
+
+        int rc = mqbs::FileSystemUtil::open(&d_mfd,
+                                            path.c_str(),
+                                            size,
+                                            false,  // readOnly
+                                            errorDesc);
+        BSLS_ASSERT_OPT(rc == 0);
+
+        rc = mqbs::FileSystemUtil::grow(&d_mfd,
+                                        false,  // reserveOnDisk
+                                        errorDesc);
+        BSLS_ASSERT_OPT(rc == 0);
+    }
+
+    ~MappedFile() { mqbs::FileSystemUtil::close(&d_mfd); }
+
+    char* mapping() const { return d_mfd.mapping(); }
+};
+
+/// Sync callback recording the tokens and statuses it is invoked with.
+struct SyncRecorder {
+    bslmt::Mutex                     d_mutex;
+    bsl::vector<bsls::Types::Uint64> d_tokens;
+    bsl::vector<int>                 d_statuses;
+
+    explicit SyncRecorder(bslma::Allocator* allocator)
+    : d_mutex()
+    , d_tokens(allocator)
+    , d_statuses(allocator)
+    {
+    }
+
+    void onSync(bsls::Types::Uint64 token, int status)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        d_tokens.push_back(token);
+        d_statuses.push_back(status);
+    }
+
+    Obj::SyncCb callback()
+    {
+        return bdlf::BindUtil::bind(&SyncRecorder::onSync,
+                                    this,
+                                    bdlf::PlaceHolders::_1,   // token
+                                    bdlf::PlaceHolders::_2);  // status
+    }
+};
+
+/// Result of a run of `runWrites`.
+struct RunResult {
+    bsls::Types::Int64 d_elapsedNs;
+    bsls::Types::Int64 d_avgAckLatencyNs;
+    bsls::Types::Int64 d_maxAckLatencyNs;
+    int                d_numSyncs;
+};
+
+/// Sync callback computing the acknowledgement latency of every write
+/// covered by the synced token.
+struct AckRecorder {
+    const bsl::vector<bsls::Types::Int64>* d_commitTimes_p;
+    bsls::Types::Uint64                    d_lastToken;
+    bsls::Types::Int64                     d_totalLatency;
+    bsls::Types::Int64                     d_maxLatency;
+    int                                    d_numSyncs;
+
+    void onSync(bsls::Types::Uint64 token, BSLA_MAYBE_UNUSED int status)
+    {
+        const bsls::Types::Int64 now = bsls::TimeUtil::getTimer();
+        for (bsls::Types::Uint64 i = d_lastToken + 1; i <= token; ++i) {
+            const bsls::Types::Int64 latency = now - (*d_commitTimes_p)[i];
+            d_totalLatency += latency;
+            d_maxLatency = bsl::max(d_maxLatency, latency);
+        }
+        d_lastToken = token;
+        ++d_numSyncs;
+    }
+};
+
+/// Write the specified `numWrites` chunks of the specified `writeSize`
+/// sequentially to the specified `file`, waiting for each of them to be
+/// synced by a `FileSyncer` having the specified `intervalUs` and
+/// `maxPendingBytes`, or, if `intervalUs` is 0, by syncing each of them
+/// inline.  Return the elapsed time and the acknowledgement latencies.
+RunResult runWrites(MappedFile*         file,
+                    int                 intervalUs,
+                    bsls::Types::Uint64 maxPendingBytes,
+                    int                 numWrites,
+                    int                 writeSize,
+                    bslma::Allocator*   allocator)
+{
+    bsl::vector<bsls::Types::Int64> commitTimes(numWrites + 1, 0, allocator);
+    RunResult                       result = {0, 0, 0, 0};
+    char*                           base   = file->mapping();
+
+    const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+
+    if (intervalUs == 0) {
+        // Baseline: sync each write before acknowledging it.
+        const int          pageSize = bdls::MemoryUtil::pageSize();
+        bmqu::MemOutStream errorDesc(allocator);
+        for (int i = 0; i < numWrites; ++i) {
+            const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+            char* address = base + static_cast<bsls::Types::Uint64>(i) *
+                                       writeSize;
+            bsl::memset(address, 'a' + i % 26, writeSize);
+
+            // 'msync' requires a page-aligned address.
+            char* page = base + (address - base) / pageSize * pageSize;
+            mqbs::FileSystemUtil::flush(page,
+                                        address + writeSize - page,
+                                        errorDesc);
+
+            const bsls::Types::Int64 latency = bsls::TimeUtil::getTimer() -
+                                               start;
+            result.d_avgAckLatencyNs += latency;
+            result.d_maxAckLatencyNs = bsl::max(result.d_maxAckLatencyNs,
+                                                latency);
+        }
+        result.d_numSyncs = numWrites;
+    }
+    else {
+        AckRecorder recorder = {&commitTimes, 0, 0, 0, 0};
+
+        Obj syncer(intervalUs,
+                   maxPendingBytes,
+                   bdlf::BindUtil::bind(&AckRecorder::onSync,
+                                        &recorder,
+                                        bdlf::PlaceHolders::_1,   // token
+                                        bdlf::PlaceHolders::_2),  // status
+                   allocator);
+        const int rc = syncer.start();
+        BSLS_ASSERT_OPT(rc == 0);
+
+        for (int i = 0; i < numWrites; ++i) {
+            char* address = base + static_cast<bsls::Types::Uint64>(i) *
+                                       writeSize;
+            bsl::memset(address, 'a' + i % 26, writeSize);
+            syncer.addRange(address, writeSize);
+
+            // Tokens are assigned sequentially, starting at 1.
+            commitTimes[i + 1] = bsls::TimeUtil::getTimer();
+            syncer.commit();
+        }
+        syncer.drain();
+        syncer.stop();
+
+        result.d_avgAckLatencyNs = recorder.d_totalLatency;
+        result.d_maxAckLatencyNs = recorder.d_maxLatency;
+        result.d_numSyncs        = recorder.d_numSyncs;
+    }
+
+    result.d_elapsedNs = bsls::TimeUtil::getTimer() - begin;
+    result.d_avgAckLatencyNs /= numWrites;
+    return result;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Testing:
+//   Basic functionality
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    SyncRecorder recorder(bmqtst::TestHelperUtil::allocator());
+
+    {
+        Obj obj(1000,
+                1024 * 1024,
+                recorder.callback(),
+                bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(obj.syncedToken(), 0U);
+
+        // Stopping a syncer which was never started is a no-op.
+        obj.stop();
+
+        BMQTST_ASSERT_EQ(obj.start(), 0);
+        obj.drain();
+        obj.stop();
+
+        // A syncer can be restarted.
+        BMQTST_ASSERT_EQ(obj.start(), 0);
+    }
+
+    BMQTST_ASSERT(recorder.d_tokens.empty());
+}
+
+static void test2_drain()
+// ------------------------------------------------------------------------
+// DRAIN
+//
+// Concerns:
+//   1. Committed ranges are not synced before their interval elapses.
+//   2. 'drain' syncs all the committed ranges at once, and invokes the
+//      callback once with the highest token.
+//   3. Tokens are strictly increasing.
+//
+// Plan:
+//   Use an interval long enough to never elapse during the test, commit
+//   a few ranges of a mapped file, and drain the syncer.
+//
+// Testing:
+//   addRange
+//   commit
+//   drain
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("DRAIN");
+
+    MappedFile   file(64 * 1024, bmqtst::TestHelperUtil::allocator());
+    SyncRecorder recorder(bmqtst::TestHelperUtil::allocator());
+
+    Obj obj(60 * 1000 * 1000,  // 1 minute
+            1024 * 1024,
+            recorder.callback(),
+            bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(obj.start(), 0);
+
+    bsls::Types::Uint64 lastToken = 0;
+    for (int i = 0; i < 3; ++i) {
+        // Contiguous ranges
+        obj.addRange(file.mapping() + i * 100, 100);
+        const bsls::Types::Uint64 token = obj.commit();
+        BMQTST_ASSERT_GT(token, lastToken);
+        lastToken = token;
+    }
+    // Range in a different page
+    obj.addRange(file.mapping() + 32 * 1024 + 10, 100);
+    lastToken = obj.commit();
+
+    bslmt::ThreadUtil::microSleep(10 * 1000);  // 10ms
+    BMQTST_ASSERT_EQ(obj.syncedToken(), 0U);
+
+    obj.drain();
+    BMQTST_ASSERT_EQ(obj.syncedToken(), lastToken);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&recorder.d_mutex);  // LOCK
+        BMQTST_ASSERT_EQ(recorder.d_tokens.size(), 1U);
+        BMQTST_ASSERT_EQ(recorder.d_tokens[0], lastToken);
+        BMQTST_ASSERT_EQ(recorder.d_statuses[0], 0);
+    }
+
+    // Draining without anything committed returns immediately.
+    obj.drain();
+
+    obj.stop();
+    BMQTST_ASSERT_EQ(recorder.d_tokens.size(), 1U);
+}
+
+static void test3_groupTriggers()
+// ------------------------------------------------------------------------
+// GROUP TRIGGERS
+//
+// Concerns:
+//   1. Committed ranges are synced once the interval elapses.
+//   2. Committed ranges are synced without waiting for the interval once
+//      they total the maximum number of pending bytes.
+//   3. 'stop' syncs the committed ranges.
+//
+// Plan:
+//   Commit ranges with a short interval and wait for the callback.  Then
+//   commit ranges exceeding the maximum pending bytes with a long
+//   interval and wait for the callback.  Finally commit a range and stop
+//   the syncer.
+//
+// Testing:
+//   commit
+//   stop
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("GROUP TRIGGERS");
+
+    MappedFile file(64 * 1024, bmqtst::TestHelperUtil::allocator());
+
+    // Interval elapses
+    {
+        SyncRecorder recorder(bmqtst::TestHelperUtil::allocator());
+
+        Obj obj(1000,  // 1ms
+                1024 * 1024,
+                recorder.callback(),
+                bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(obj.start(), 0);
+
+        obj.addRange(file.mapping(), 100);
+        const bsls::Types::Uint64 token = obj.commit();
+
+        for (int i = 0; i < 1000 && obj.syncedToken() < token; ++i) {
+            bslmt::ThreadUtil::microSleep(10 * 1000);  // 10ms
+        }
+        BMQTST_ASSERT_EQ(obj.syncedToken(), token);
+        obj.stop();
+    }
+
+    // Maximum pending bytes reached
+    {
+        SyncRecorder recorder(bmqtst::TestHelperUtil::allocator());
+
+        Obj obj(60 * 1000 * 1000,  // 1 minute
+                1000,
+                recorder.callback(),
+                bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(obj.start(), 0);
+
+        obj.addRange(file.mapping(), 600);
+        obj.commit();
+        obj.addRange(file.mapping() + 600, 600);
+        const bsls::Types::Uint64 token = obj.commit();
+
+        for (int i = 0; i < 1000 && obj.syncedToken() < token; ++i) {
+            bslmt::ThreadUtil::microSleep(10 * 1000);  // 10ms
+        }
+        BMQTST_ASSERT_EQ(obj.syncedToken(), token);
+        obj.stop();
+    }
+
+    // Stop
+    {
+        SyncRecorder recorder(bmqtst::TestHelperUtil::allocator());
+
+        Obj obj(60 * 1000 * 1000,  // 1 minute
+                1024 * 1024,
+                recorder.callback(),
+                bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(obj.start(), 0);
+
+        obj.addRange(file.mapping(), 100);
+        const bsls::Types::Uint64 token = obj.commit();
+        obj.stop();
+
+        BMQTST_ASSERT_EQ(obj.syncedToken(), token);
+        BMQTST_ASSERT_EQ(recorder.d_tokens.size(), 1U);
+    }
+}
+
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+static void testN1_ackLatencyVsThroughput()
+// ------------------------------------------------------------------------
+// ACK LATENCY VS THROUGHPUT
+//
+// Concerns:
+//   Measure the trade-off between the throughput of durable writes and
+//   their acknowledgement latency for different group sync intervals.
+//
+// Plan:
+//   Write chunks sequentially to a mapped file, and acknowledge each of
+//   them once it is synced to disk: first by syncing each write inline
+//   (the baseline), then with a 'FileSyncer' for increasing intervals.
+//   Report the throughput, the number of syncs, and the average and
+//   maximum acknowledgement latencies of each run.
+//
+// Testing:
+//   Performance
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    bmqtst::TestHelper::printTestName("ACK LATENCY VS THROUGHPUT");
+
+    const int k_NUM_WRITES     = 20000;
+    const int k_WRITE_SIZE     = 1024;
+    const int k_INTERVALS_US[] = {0, 50, 100, 500, 1000, 5000};
+
+    MappedFile file(static_cast<bsls::Types::Uint64>(k_NUM_WRITES) *
+                        k_WRITE_SIZE,
+                    bmqtst::TestHelperUtil::allocator());
+
+    for (size_t i = 0; i < sizeof(k_INTERVALS_US) / sizeof(*k_INTERVALS_US);
+         ++i) {
+        const RunResult result = runWrites(
+            &file,
+            k_INTERVALS_US[i],
+            8 * 1024 * 1024,
+            k_NUM_WRITES,
+            k_WRITE_SIZE,
+            bmqtst::TestHelperUtil::allocator());
+
+        cout << "Interval " << k_INTERVALS_US[i] << "us"
+             << (k_INTERVALS_US[i] == 0 ? " (sync per write)" : "") << ":\n"
+             << "  throughput.....: "
+             << bmqu::PrintUtil::prettyNumber(static_cast<bsls::Types::Int64>(
+                    k_NUM_WRITES * 1.0e9 / result.d_elapsedNs))
+             << " writes/s\n"
+             << "  syncs..........: "
+             << bmqu::PrintUtil::prettyNumber(result.d_numSyncs) << "\n"
+             << "  avg ACK latency: "
+             << bmqu::PrintUtil::prettyTimeInterval(result.d_avgAckLatencyNs)
+             << "\n"
+             << "  max ACK latency: "
+             << bmqu::PrintUtil::prettyTimeInterval(result.d_maxAckLatencyNs)
+             << endl;
+    }
+}
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void testN1_ackLatencyVsThroughput_GoogleBenchmark(
+    benchmark::State& state)
+{
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const int k_NUM_WRITES = 10000;
+    const int k_WRITE_SIZE = 1024;
+
+    MappedFile file(static_cast<bsls::Types::Uint64>(k_NUM_WRITES) *
+                        k_WRITE_SIZE,
+                    bmqtst::TestHelperUtil::allocator());
+
+    RunResult result = {0, 0, 0, 0};
+    for (auto _ : state) {
+        result = runWrites(&file,
+                           static_cast<int>(state.range(0)),
+                           8 * 1024 * 1024,
+                           k_NUM_WRITES,
+                           k_WRITE_SIZE,
+                           bmqtst::TestHelperUtil::allocator());
+    }
+
+    state.SetItemsProcessed(state.iterations() * k_NUM_WRITES);
+    state.counters["syncs"]    = result.d_numSyncs;
+    state.counters["avgAckUs"] = result.d_avgAckLatencyNs / 1000.0;
+    state.counters["maxAckUs"] = result.d_maxAckLatencyNs / 1000.0;
+}
+#endif  // BMQTST_BENCHMARK_ENABLED
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_groupTriggers(); break;
+    case 2: test2_drain(); break;
+    case 1: test1_breathingTest(); break;
+    case -1:
+#ifdef BMQTST_BENCHMARK_ENABLED
+        BENCHMARK(testN1_ackLatencyVsThroughput_GoogleBenchmark)
+            ->Arg(0)
+            ->Arg(100)
+            ->Arg(1000)
+            ->Arg(5000)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+#else
+        testN1_ackLatencyVsThroughput();
+#endif
+        break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
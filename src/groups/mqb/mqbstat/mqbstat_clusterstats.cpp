@@ -92,6 +92,14 @@ bsls::Types::Int64 ClusterStats::getValue(const bmqst::StatContext& context,
         latestSnapshot,                                                       \
         OLDEST_SNAPSHOT(STAT))
 
+#define STAT_PERCENTILE(STAT, PERCENTILE)                                     \
+    bmqst::StatUtil::percentile(                                              \
+        context.value(bmqst::StatContext::e_DIRECT_VALUE,                     \
+                      ClusterStatsIndex::STAT),                               \
+        latestSnapshot,                                                       \
+        OLDEST_SNAPSHOT(STAT),                                                \
+        PERCENTILE)
+
     switch (stat) {
     case Stat::e_CLUSTER_STATUS: {
         // We want to favor reporting 'unhealthiness', that is, if the cluster
@@ -135,6 +143,37 @@ bsls::Types::Int64 ClusterStats::getValue(const bmqst::StatContext& context,
     case Stat::e_CSL_CFG_BYTES: {
         return STAT_SINGLE(value, e_CSL_CFG_BYTES);
     }
+    case Stat::e_CSL_LOAD_TIME_NS: {
+        return STAT_SINGLE(value, e_CSL_LOAD_TIME_NS);
+    }
+    case Stat::e_QUEUE_ASSIGNMENTS_PER_ADVISORY_AVG: {
+        const bsls::Types::Int64 value = STAT_RANGE(
+            averagePerEvent,
+            e_QUEUE_ASSIGNMENTS_PER_ADVISORY);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0
+                                                                       : value;
+    }
+    case Stat::e_QUEUE_ASSIGNMENTS_PER_ADVISORY_MAX: {
+        const bsls::Types::Int64 value = STAT_RANGE(
+            rangeMax,
+            e_QUEUE_ASSIGNMENTS_PER_ADVISORY);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
+    case Stat::e_QUEUE_ASSIGNMENT_TIME_NS_AVG: {
+        const bsls::Types::Int64 value = STAT_RANGE(
+            averagePerEvent,
+            e_QUEUE_ASSIGNMENT_TIME_NS);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0
+                                                                       : value;
+    }
+    case Stat::e_QUEUE_ASSIGNMENT_TIME_NS_MAX: {
+        const bsls::Types::Int64 value = STAT_RANGE(
+            rangeMax,
+            e_QUEUE_ASSIGNMENT_TIME_NS);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
 
     case Stat::e_PARTITION_CFG_JOURNAL_BYTES: {
         return STAT_SINGLE(value, e_PARTITION_CFG_JOURNAL_BYTES);
@@ -210,6 +249,36 @@ bsls::Types::Int64 ClusterStats::getValue(const bmqst::StatContext& context,
         return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
                                                                        : value;
     }
+    case Stat::e_PARTITION_REPLICATION_TIME_NS_P99: {
+        return STAT_PERCENTILE(e_PARTITION_REPLICATION_TIME_NS, 99);
+    }
+    case Stat::e_PARTITION_RECEIPT_TIME_NS_AVG: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(averagePerEvent, e_PARTITION_RECEIPT_TIME_NS);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_RECEIPT_TIME_NS_MAX: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(rangeMax, e_PARTITION_RECEIPT_TIME_NS);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_RECEIPT_TIME_NS_P99: {
+        return STAT_PERCENTILE(e_PARTITION_RECEIPT_TIME_NS, 99);
+    }
+    case Stat::e_PARTITION_RECORDS_PER_RECEIPT_AVG: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(averagePerEvent, e_PARTITION_RECORDS_PER_RECEIPT);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_RECORDS_PER_RECEIPT_MAX: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(rangeMax, e_PARTITION_RECORDS_PER_RECEIPT);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
 
     default: {
         BSLS_ASSERT_SAFE(false && "Attempting to access an unknown stat");
@@ -217,6 +286,7 @@ bsls::Types::Int64 ClusterStats::getValue(const bmqst::StatContext& context,
     }
 
     return 0;
+#undef STAT_PERCENTILE
 #undef STAT_RANGE
 #undef STAT_SINGLE
 #undef OLDEST_SNAPSHOT
@@ -390,6 +460,15 @@ const char* ClusterStats::Stat::toString(Stat::Enum value)
         MQBSTAT_CASE(e_CSL_LOG_OFFSET_BYTES, "cluster_csl_offset_bytes")
         MQBSTAT_CASE(e_CSL_WRITE_BYTES, "cluster_csl_write_bytes")
         MQBSTAT_CASE(e_CSL_CFG_BYTES, "cluster_csl_cfg_bytes")
+        MQBSTAT_CASE(e_CSL_LOAD_TIME_NS, "cluster_csl_load_time_ns")
+        MQBSTAT_CASE(e_QUEUE_ASSIGNMENTS_PER_ADVISORY_AVG,
+                     "cluster_queue_assignments_per_advisory_avg")
+        MQBSTAT_CASE(e_QUEUE_ASSIGNMENTS_PER_ADVISORY_MAX,
+                     "cluster_queue_assignments_per_advisory_max")
+        MQBSTAT_CASE(e_QUEUE_ASSIGNMENT_TIME_NS_AVG,
+                     "cluster_queue_assignment_time_avg_ns")
+        MQBSTAT_CASE(e_QUEUE_ASSIGNMENT_TIME_NS_MAX,
+                     "cluster_queue_assignment_time_max_ns")
         MQBSTAT_CASE(e_PARTITION_CFG_DATA_BYTES,
                      "cluster_partition_cfg_data_bytes")
         MQBSTAT_CASE(e_PARTITION_CFG_JOURNAL_BYTES,
@@ -411,6 +490,18 @@ const char* ClusterStats::Stat::toString(Stat::Enum value)
                      "partition_replication_time_avg_ns")
         MQBSTAT_CASE(e_PARTITION_REPLICATION_TIME_NS_MAX,
                      "partition_replication_time_max_ns")
+        MQBSTAT_CASE(e_PARTITION_REPLICATION_TIME_NS_P99,
+                     "partition_replication_time_p99_ns")
+        MQBSTAT_CASE(e_PARTITION_RECEIPT_TIME_NS_AVG,
+                     "partition_receipt_time_avg_ns")
+        MQBSTAT_CASE(e_PARTITION_RECEIPT_TIME_NS_MAX,
+                     "partition_receipt_time_max_ns")
+        MQBSTAT_CASE(e_PARTITION_RECEIPT_TIME_NS_P99,
+                     "partition_receipt_time_p99_ns")
+        MQBSTAT_CASE(e_PARTITION_RECORDS_PER_RECEIPT_AVG,
+                     "partition_records_per_receipt_avg")
+        MQBSTAT_CASE(e_PARTITION_RECORDS_PER_RECEIPT_MAX,
+                     "partition_records_per_receipt_max")
     default:
         BSLS_ASSERT(false && "invalid enumerator");
         BSLS_ASSERT_INVOKE_NORETURN("");
@@ -454,6 +545,11 @@ ClusterStatsUtil::initializeStatContextCluster(int               historySize,
         .value("cluster_csl_offset_bytes")
         .value("cluster_csl_write_bytes")
         .value("cluster_csl_cfg_bytes")
+        .value("cluster_csl_load_time_ns")
+        .value("cluster_queue_assignments_per_advisory",
+               bmqst::StatValue::e_DISCRETE)
+        .value("cluster_queue_assignment_time_ns",
+               bmqst::StatValue::e_DISCRETE)
         .value("cluster.partition.cfg_data_bytes")
         .value("cluster.partition.cfg_journal_bytes")
         .value("partition_status")
@@ -463,7 +559,11 @@ ClusterStatsUtil::initializeStatContextCluster(int               historySize,
         .value("partition.data_offset_bytes")
         .value("partition.journal_offset_bytes")
         .value("partition.sequence_number")
-        .value("partition.replication_time_ns", bmqst::StatValue::e_DISCRETE);
+        .value("partition.replication_time_ns",
+               bmqst::StatValue::e_DISTRIBUTION)
+        .value("partition.receipt_time_ns",
+               bmqst::StatValue::e_DISTRIBUTION)
+        .value("partition.records_per_receipt", bmqst::StatValue::e_DISCRETE);
 
     // NOTE: For the clusters, the stat context will have two levels of
     //       children, first level is per cluster, and second level is per
@@ -84,6 +84,22 @@ class ClusterStats {
             e_CSL_WRITE_BYTES,
             /// Configured maximum size of the CSL file.
             e_CSL_CFG_BYTES,
+            /// Time in nanoseconds it took to load the CSL upon opening it.
+            e_CSL_LOAD_TIME_NS,
+            /// Number of queues assigned by a single queue assignment
+            /// advisory. Average observed during the report interval.
+            e_QUEUE_ASSIGNMENTS_PER_ADVISORY_AVG,
+            /// Number of queues assigned by a single queue assignment
+            /// advisory. Maximum observed during the report interval.
+            e_QUEUE_ASSIGNMENTS_PER_ADVISORY_MAX,
+            /// Time in nanoseconds from the request of a queue assignment to
+            /// the commit of its advisory. Average observed during the report
+            /// interval.
+            e_QUEUE_ASSIGNMENT_TIME_NS_AVG,
+            /// Time in nanoseconds from the request of a queue assignment to
+            /// the commit of its advisory. Maximum observed during the report
+            /// interval.
+            e_QUEUE_ASSIGNMENT_TIME_NS_MAX,
             /// Configured maximum size of the data file.
             e_PARTITION_CFG_DATA_BYTES,
             /// Configured maximum size of the journal file.
@@ -128,7 +144,29 @@ class ClusterStats {
             /// Maximum observed time in nanoseconds it took to store a message
             /// record at primary and replicate it to a majority of nodes in
             /// the cluster.
-            e_PARTITION_REPLICATION_TIME_NS_MAX
+            e_PARTITION_REPLICATION_TIME_NS_MAX,
+            /// 99th percentile of the observed time in nanoseconds it took to
+            /// store a message record at primary and replicate it to a
+            /// majority of nodes in the cluster.
+            e_PARTITION_REPLICATION_TIME_NS_P99,
+            /// Average observed time in nanoseconds from the arrival of a
+            /// message record at primary to the receipt of that record from
+            /// a replica.
+            e_PARTITION_RECEIPT_TIME_NS_AVG,
+            /// Maximum observed time in nanoseconds from the arrival of a
+            /// message record at primary to the receipt of that record from
+            /// a replica.
+            e_PARTITION_RECEIPT_TIME_NS_MAX,
+            /// 99th percentile of the observed time in nanoseconds from the
+            /// arrival of a message record at primary to the receipt of that
+            /// record from a replica.
+            e_PARTITION_RECEIPT_TIME_NS_P99,
+            /// Average observed number of message records acknowledged by a
+            /// single receipt sent by a replica.
+            e_PARTITION_RECORDS_PER_RECEIPT_AVG,
+            /// Maximum observed number of message records acknowledged by a
+            /// single receipt sent by a replica.
+            e_PARTITION_RECORDS_PER_RECEIPT_MAX
         };
 
         // CLASS METHODS
@@ -207,6 +245,14 @@ class ClusterStats {
             e_CSL_WRITE_BYTES,
             /// Value: Configured maximum size of the CSL file.
             e_CSL_CFG_BYTES,
+            /// Value: Time in nanoseconds it took to load the CSL file.
+            e_CSL_LOAD_TIME_NS,
+            /// Value: Number of queues assigned by a queue assignment
+            ///        advisory.
+            e_QUEUE_ASSIGNMENTS_PER_ADVISORY,
+            /// Value: Time in nanoseconds from the request of a queue
+            ///        assignment to the commit of its advisory.
+            e_QUEUE_ASSIGNMENT_TIME_NS,
             /// Value: Configured size of partitions' data file.
             e_PARTITION_CFG_DATA_BYTES,
             /// Value: Configured size of partitions' journal file.
@@ -231,7 +277,12 @@ class ClusterStats {
             e_PARTITION_SEQUENCE_NUMBER,
             /// Value: Time in nanoseconds it took for replication of a new
             /// entry in journal file.
-            e_PARTITION_REPLICATION_TIME_NS
+            e_PARTITION_REPLICATION_TIME_NS,
+            /// Value: Time in nanoseconds from the arrival of a message
+            ///        record at primary to its receipt from a replica.
+            e_PARTITION_RECEIPT_TIME_NS,
+            /// Value: Number of message records acknowledged by a receipt.
+            e_PARTITION_RECORDS_PER_RECEIPT
         };
     };
 
@@ -333,6 +384,19 @@ class ClusterStats {
     /// this object by the specified `delta`.
     void addCslOffsetBytes(bsls::Types::Int64 delta);
 
+    /// Set the csl load time of the StatContext being referred to by this
+    /// object to be the specified `value`.
+    void setCslLoadTime(bsls::Types::Int64 value);
+
+    /// Report the specified `value` as the number of queues assigned by a
+    /// queue assignment advisory in the StatContext being referred to by
+    /// this object.
+    void setQueueAssignmentsPerAdvisory(bsls::Types::Int64 value);
+
+    /// Report the specified `value` as the time, in nanoseconds, it took to
+    /// assign a queue in the StatContext being referred to by this object.
+    void setQueueAssignmentTime(bsls::Types::Int64 value);
+
     /// Return a pointer to the statcontext.
     bmqst::StatContext* statContext();
 };
@@ -382,6 +446,14 @@ class PartitionStats {
     /// in journal file to the specified `value`.
     void setReplicationTime(bsls::Types::Int64 value);
 
+    /// Report the specified `value` as the time in nanoseconds from the
+    /// arrival of a message record at primary to its receipt from a replica.
+    void setReceiptTime(bsls::Types::Int64 value);
+
+    /// Report the specified `value` as the number of message records
+    /// acknowledged by a receipt sent to the primary.
+    void setRecordsPerReceipt(bsls::Types::Int64 value);
+
     /// Set the primary status of the partition to the specified `value`.
     void setNodeRole(PrimaryStatus::Enum value);
 
@@ -463,6 +535,26 @@ inline void ClusterStats::addCslOffsetBytes(bsls::Types::Int64 delta)
                                   delta);
 }
 
+inline void ClusterStats::setCslLoadTime(bsls::Types::Int64 value)
+{
+    d_statContext_mp->setValue(ClusterStatsIndex::e_CSL_LOAD_TIME_NS, value);
+}
+
+inline void
+ClusterStats::setQueueAssignmentsPerAdvisory(bsls::Types::Int64 value)
+{
+    d_statContext_mp->reportValue(
+        ClusterStatsIndex::e_QUEUE_ASSIGNMENTS_PER_ADVISORY,
+        value);
+}
+
+inline void ClusterStats::setQueueAssignmentTime(bsls::Types::Int64 value)
+{
+    d_statContext_mp->reportValue(
+        ClusterStatsIndex::e_QUEUE_ASSIGNMENT_TIME_NS,
+        value);
+}
+
 inline bmqst::StatContext* ClusterStats::statContext()
 {
     return d_statContext_mp.get();
@@ -486,6 +578,20 @@ inline void PartitionStats::setReplicationTime(bsls::Types::Int64 value)
         value);
 }
 
+inline void PartitionStats::setReceiptTime(bsls::Types::Int64 value)
+{
+    d_statContext_sp->reportValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_RECEIPT_TIME_NS,
+        value);
+}
+
+inline void PartitionStats::setRecordsPerReceipt(bsls::Types::Int64 value)
+{
+    d_statContext_sp->reportValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_RECORDS_PER_RECEIPT,
+        value);
+}
+
 inline void PartitionStats::setNodeRole(PrimaryStatus::Enum value)
 {
     d_statContext_sp->setValue(
@@ -99,6 +99,13 @@ bsls::Types::Int64 DispatcherStats::getValue(const bmqst::StatContext& context,
         latestSnapshot,                                                       \
         OLDEST_SNAPSHOT(STAT))
 
+#define STAT_PERCENTILE(STAT, PERCENTILE)                                     \
+    bmqst::StatUtil::percentile(                                              \
+        context.value(bmqst::StatContext::e_DIRECT_VALUE, STAT),              \
+        latestSnapshot,                                                       \
+        OLDEST_SNAPSHOT(STAT),                                                \
+        PERCENTILE)
+
 #define CASE_PROCESSING(EVENT_NAME)                                           \
     case Stat::e_PROCESSING_TIME_##EVENT_NAME##_MAX: {                        \
         const bsls::Types::Int64 max = STAT_RANGE(                            \
@@ -161,6 +168,15 @@ bsls::Types::Int64 DispatcherStats::getValue(const bmqst::StatContext& context,
     }
     case Stat::e_QUEUE_TIME_ABS_MAX: {
         return STAT_SINGLE_ABS(absoluteMax, DispatcherStatsIndex::e_STAT_TIME);
+    }
+    case Stat::e_QUEUE_TIME_P50: {
+        return STAT_PERCENTILE(DispatcherStatsIndex::e_STAT_TIME, 50);
+    }
+    case Stat::e_QUEUE_TIME_P99: {
+        return STAT_PERCENTILE(DispatcherStatsIndex::e_STAT_TIME, 99);
+    }
+    case Stat::e_QUEUE_TIME_P999: {
+        return STAT_PERCENTILE(DispatcherStatsIndex::e_STAT_TIME, 99.9);
     }
         CASE_PROCESSING(UNDEFINED)
         CASE_PROCESSING(DISPATCHER)
@@ -183,6 +199,7 @@ bsls::Types::Int64 DispatcherStats::getValue(const bmqst::StatContext& context,
     return 0;
 
 #undef CASE_PROCESSING
+#undef STAT_PERCENTILE
 #undef STAT_RANGE
 #undef STAT_SINGLE_ABS
 #undef STAT_SINGLE
@@ -220,7 +237,7 @@ DispatcherStatsUtil::initializeStatContext(int               historySize,
         .value("processing_time_replication_receipt",
                bmqst::StatValue::e_DISCRETE)
         .value("queued_count")
-        .value("queued_time", bmqst::StatValue::e_DISCRETE);
+        .value("queued_time", bmqst::StatValue::e_DISTRIBUTION);
 
     return bsl::shared_ptr<bmqst::StatContext>(
         new (*allocator) bmqst::StatContext(config, allocator),
@@ -114,6 +114,9 @@ class DispatcherStats {
             e_PROCESSING_TIME_REPLICATION_RECEIPT_AVG,
             e_PROCESSING_TIME_REPLICATION_RECEIPT_SUM,
             e_PROCESSED_COUNT_REPLICATION_RECEIPT,
+            e_QUEUE_TIME_P50,
+            e_QUEUE_TIME_P99,
+            e_QUEUE_TIME_P999,
         };
     };
 
@@ -190,16 +190,25 @@ class DomainQueuesVisitor {
         metric(ctx, Stat::e_ACK_ABS);
         metric(ctx, Stat::e_ACK_TIME_AVG);
         metric(ctx, Stat::e_ACK_TIME_MAX);
+        metric(ctx, Stat::e_ACK_TIME_P50);
+        metric(ctx, Stat::e_ACK_TIME_P99);
+        metric(ctx, Stat::e_ACK_TIME_P999);
         metric(ctx, Stat::e_NACK_DELTA);
         metric(ctx, Stat::e_NACK_ABS);
         metric(ctx, Stat::e_CONFIRM_DELTA);
         metric(ctx, Stat::e_CONFIRM_ABS);
         metric(ctx, Stat::e_CONFIRM_TIME_AVG);
         metric(ctx, Stat::e_CONFIRM_TIME_MAX);
+        metric(ctx, Stat::e_CONFIRM_TIME_P50);
+        metric(ctx, Stat::e_CONFIRM_TIME_P99);
+        metric(ctx, Stat::e_CONFIRM_TIME_P999);
         metric(ctx, Stat::e_REJECT_ABS);
         metric(ctx, Stat::e_REJECT_DELTA);
         metric(ctx, Stat::e_QUEUE_TIME_AVG);
         metric(ctx, Stat::e_QUEUE_TIME_MAX);
+        metric(ctx, Stat::e_QUEUE_TIME_P50);
+        metric(ctx, Stat::e_QUEUE_TIME_P99);
+        metric(ctx, Stat::e_QUEUE_TIME_P999);
         metric(ctx, Stat::e_GC_MSGS_DELTA);
         metric(ctx, Stat::e_GC_MSGS_ABS);
         metric(ctx, Stat::e_ROLE);
@@ -320,6 +329,11 @@ class ClustersVisitor {
             metric(ctx, Stat::e_CSL_LOG_OFFSET_BYTES);
             metric(ctx, Stat::e_CSL_WRITE_BYTES);
             metric(ctx, Stat::e_CSL_CFG_BYTES);
+            metric(ctx, Stat::e_CSL_LOAD_TIME_NS);
+            metric(ctx, Stat::e_QUEUE_ASSIGNMENTS_PER_ADVISORY_AVG);
+            metric(ctx, Stat::e_QUEUE_ASSIGNMENTS_PER_ADVISORY_MAX);
+            metric(ctx, Stat::e_QUEUE_ASSIGNMENT_TIME_NS_AVG);
+            metric(ctx, Stat::e_QUEUE_ASSIGNMENT_TIME_NS_MAX);
             metric(ctx, Stat::e_PARTITION_CFG_DATA_BYTES);
             metric(ctx, Stat::e_PARTITION_CFG_JOURNAL_BYTES);
         }
@@ -338,6 +352,12 @@ class ClustersVisitor {
             metric(ctx, Stat::e_PARTITION_SEQUENCE_NUMBER);
             metric(ctx, Stat::e_PARTITION_REPLICATION_TIME_NS_AVG);
             metric(ctx, Stat::e_PARTITION_REPLICATION_TIME_NS_MAX);
+            metric(ctx, Stat::e_PARTITION_REPLICATION_TIME_NS_P99);
+            metric(ctx, Stat::e_PARTITION_RECEIPT_TIME_NS_AVG);
+            metric(ctx, Stat::e_PARTITION_RECEIPT_TIME_NS_MAX);
+            metric(ctx, Stat::e_PARTITION_RECEIPT_TIME_NS_P99);
+            metric(ctx, Stat::e_PARTITION_RECORDS_PER_RECEIPT_AVG);
+            metric(ctx, Stat::e_PARTITION_RECORDS_PER_RECEIPT_MAX);
         }
         d_os << "}" << bsl::endl;
     }
@@ -0,0 +1,399 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbstat_messagetracer.h>
+
+#include <mqbscm_version.h>
+// BMQ
+#include <bmqst_basictableinfoprovider.h>
+#include <bmqst_statutil.h>
+#include <bmqst_statvalue.h>
+#include <bmqst_table.h>
+#include <bmqst_tablerecords.h>
+#include <bmqst_tableschema.h>
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_new.h>
+#include <bsl_utility.h>
+#include <bslmf_assert.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mqbstat {
+
+namespace {
+
+// CONSTANTS
+const char k_MESSAGE_TRACING_STAT_NAME[] = "messageTracing";
+
+/// Index of the latency value of the stat context of a stage.
+const int k_STAT_LATENCY = 0;
+
+/// Mask of the index of a ring buffer.
+const unsigned int k_BUFFER_MASK = MessageTracer::k_NUM_BUFFERS - 1;
+
+/// Mask of the index of an entry of a ring buffer.
+const bsls::Types::Uint64 k_ENTRY_MASK = MessageTracer::k_BUFFER_SIZE - 1;
+
+bsls::AtomicUint s_nextThreadIndex(0);
+
+/// Return the index assigned to the calling thread.
+unsigned int threadIndex()
+{
+    static BSLS_KEYWORD_THREAD_LOCAL unsigned int s_index = 0;
+    static BSLS_KEYWORD_THREAD_LOCAL bool         s_isAssigned = false;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!s_isAssigned)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        s_index      = s_nextThreadIndex.addRelaxed(1) - 1;
+        s_isAssigned = true;
+    }
+
+    return s_index;
+}
+
+/// Functor method returning `true`, i.e., keep, if the specified `record`
+/// represents the stats of a stage.
+bool filterStages(const bmqst::TableRecords::Record& record)
+{
+    return record.type() == bmqst::StatContext::e_TOTAL_VALUE &&
+           record.level() > 0;
+}
+
+}  // close unnamed namespace
+
+// ---------------------------
+// struct MessageTracer::Stage
+// ---------------------------
+
+const char* MessageTracer::Stage::toAscii(Stage::Enum value)
+{
+#define CASE(X, STR)                                                          \
+    case e_##X: return STR;
+
+    switch (value) {
+        CASE(PUT, "put")
+        CASE(STORAGE_WRITE, "storage_write")
+        CASE(RECEIPT, "receipt")
+        CASE(ROUTE, "route")
+        CASE(PUSH_FLUSH, "push_flush")
+    default: return "(* UNKNOWN *)";
+    }
+
+#undef CASE
+}
+
+// -------------------
+// class MessageTracer
+// -------------------
+
+// CLASS DATA
+bsls::AtomicPointer<MessageTracer> MessageTracer::s_instance_p(0);
+
+// PRIVATE MANIPULATORS
+void MessageTracer::joinEntry(const bmqt::MessageGUID& guid,
+                              Stage::Enum              stage,
+                              bsls::Types::Int64       timestamp,
+                              bsls::Types::Int64       now)
+{
+    Traces::iterator it = d_traces.find(guid);
+    if (it == d_traces.end()) {
+        if (d_traces.size() >= static_cast<size_t>(k_MAX_TRACES)) {
+            ++d_numDropped;
+            return;  // RETURN
+        }
+
+        Trace trace;
+        bsl::fill(trace.d_timestamps, trace.d_timestamps + k_NUM_STAGES, 0);
+        trace.d_reportedStages = 0;
+        it = d_traces.insert(bsl::make_pair(guid, trace)).first;
+    }
+
+    // A message may reach a stage more than once (e.g. when redelivered, or
+    // pushed to several consumers): keep the earliest.
+    bsls::Types::Int64& stageTimestamp = it->second.d_timestamps[stage];
+    if (stageTimestamp == 0 || timestamp < stageTimestamp) {
+        stageTimestamp = timestamp;
+    }
+    it->second.d_lastUpdate = now;
+}
+
+// CLASS METHODS
+void MessageTracer::setInstance(MessageTracer* tracer)
+{
+    s_instance_p.storeRelease(tracer);
+}
+
+// CREATORS
+MessageTracer::MessageTracer(bmqst::StatContext* statContext,
+                             bslma::Allocator*   allocator)
+: d_allocator_p(allocator)
+, d_samplingRate(0)
+, d_buffers_p(0)
+, d_traces(allocator)
+, d_stageContexts(allocator)
+, d_numDropped(0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(statContext);
+    BSLS_ASSERT_SAFE(allocator);
+
+    d_buffers_p = static_cast<Buffer*>(
+        d_allocator_p->allocate(k_NUM_BUFFERS * sizeof(Buffer)));
+    for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+        new (d_buffers_p + i) Buffer();
+        d_buffers_p[i].d_readPosition = 0;
+    }
+
+    d_stageContexts.reserve(k_NUM_STAGES);
+    d_stageContexts.emplace_back();  // No latency for 'e_PUT'
+    for (int stage = Stage::e_PUT + 1; stage < k_NUM_STAGES; ++stage) {
+        bmqst::StatContextConfiguration config(
+            Stage::toAscii(static_cast<Stage::Enum>(stage)),
+            allocator);
+        d_stageContexts.emplace_back(statContext->addSubcontext(config));
+    }
+}
+
+MessageTracer::~MessageTracer()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(instance() != this);
+
+    for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+        d_buffers_p[i].~Buffer();
+    }
+    d_allocator_p->deallocate(d_buffers_p);
+}
+
+// MANIPULATORS
+void MessageTracer::setSamplingRate(int rate)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= rate);
+
+    d_samplingRate.storeRelaxed(rate);
+}
+
+void MessageTracer::record(const bmqt::MessageGUID& guid,
+                           Stage::Enum              stage,
+                           bsls::Types::Int64       timestamp)
+{
+    Buffer& buffer = d_buffers_p[threadIndex() & k_BUFFER_MASK];
+
+    const bsls::Types::Uint64 position = buffer.d_writePosition.add(1) - 1;
+    Entry& entry = buffer.d_entries[position & k_ENTRY_MASK];
+
+    bsls::Types::Uint64 guidWords[2];
+    BSLMF_ASSERT(sizeof(guidWords) == bmqt::MessageGUID::e_SIZE_BINARY);
+    guid.toBinary(reinterpret_cast<unsigned char*>(guidWords));
+
+    // Only sampled messages are recorded, so that the cost of sequentially
+    // consistent operations is not a concern here.  Invalidate the entry
+    // while writing it, so that 'collect' does not read a torn entry.
+    entry.d_sequence.store(0);
+    entry.d_guid[0].store(guidWords[0]);
+    entry.d_guid[1].store(guidWords[1]);
+    entry.d_stage.store(stage);
+    entry.d_timestamp.store(timestamp);
+    entry.d_sequence.store(position + 1);
+}
+
+void MessageTracer::collect(bsls::Types::Int64 now)
+{
+    // Drain the ring buffers.
+    for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+        Buffer&                   buffer        = d_buffers_p[i];
+        const bsls::Types::Uint64 writePosition = buffer.d_writePosition;
+        bsls::Types::Uint64       position      = buffer.d_readPosition;
+
+        if (writePosition - position > static_cast<bsls::Types::Uint64>(
+                                           k_BUFFER_SIZE)) {
+            // The oldest entries were overwritten.
+            d_numDropped += writePosition - position - k_BUFFER_SIZE;
+            position = writePosition - k_BUFFER_SIZE;
+        }
+
+        for (; position < writePosition; ++position) {
+            const Entry& entry = buffer.d_entries[position & k_ENTRY_MASK];
+
+            const bsls::Types::Uint64 sequence = entry.d_sequence;
+            if (sequence < position + 1) {
+                // Still being written: read it at the next collection.
+                break;  // BREAK
+            }
+
+            bsls::Types::Uint64 guidWords[2];
+            guidWords[0]                       = entry.d_guid[0];
+            guidWords[1]                       = entry.d_guid[1];
+            const int                stage     = entry.d_stage;
+            const bsls::Types::Int64 timestamp = entry.d_timestamp;
+
+            if (sequence != position + 1 || entry.d_sequence != sequence ||
+                stage < 0 || stage >= k_NUM_STAGES) {
+                // Overwritten, or being overwritten.
+                ++d_numDropped;
+                continue;  // CONTINUE
+            }
+
+            bmqt::MessageGUID guid;
+            guid.fromBinary(reinterpret_cast<unsigned char*>(guidWords));
+            joinEntry(guid, static_cast<Stage::Enum>(stage), timestamp, now);
+        }
+
+        buffer.d_readPosition = position;
+    }
+
+    // Report the latencies of the stages joined to their PUT, and expire the
+    // traces.
+    for (Traces::iterator it = d_traces.begin(); it != d_traces.end();) {
+        Trace&                   trace = it->second;
+        const bsls::Types::Int64 putTs = trace.d_timestamps[Stage::e_PUT];
+
+        if (putTs != 0) {
+            for (int stage = Stage::e_PUT + 1; stage < k_NUM_STAGES;
+                 ++stage) {
+                const int stageBit = 1 << stage;
+                if (trace.d_timestamps[stage] == 0 ||
+                    (trace.d_reportedStages & stageBit)) {
+                    continue;  // CONTINUE
+                }
+
+                d_stageContexts[stage]->reportValue(
+                    k_STAT_LATENCY,
+                    bsl::max(static_cast<bsls::Types::Int64>(0),
+                             trace.d_timestamps[stage] - putTs));
+                trace.d_reportedStages |= stageBit;
+            }
+        }
+
+        if ((trace.d_reportedStages & (1 << Stage::e_PUSH_FLUSH)) ||
+            now - trace.d_lastUpdate > k_TRACE_TIMEOUT_NS) {
+            // Either the last stage was reached, or no further stage is
+            // expected anymore.
+            it = d_traces.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+// ------------------------
+// struct MessageTracerUtil
+// ------------------------
+
+bsl::shared_ptr<bmqst::StatContext>
+MessageTracerUtil::initializeStatContext(int               historySize,
+                                         bslma::Allocator* allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(allocator);
+
+    bmqst::StatContextConfiguration config(k_MESSAGE_TRACING_STAT_NAME,
+                                           allocator);
+    config.isTable(true)
+        .defaultHistorySize(historySize)
+        .statValueAllocator(allocator)
+        .value("latency", bmqst::StatValue::e_DISTRIBUTION);
+
+    return bsl::shared_ptr<bmqst::StatContext>(
+        new (*allocator) bmqst::StatContext(config, allocator),
+        allocator);
+}
+
+void MessageTracerUtil::initializeTableAndTip(
+    bmqst::Table*                  table,
+    bmqst::BasicTableInfoProvider* tip,
+    int                            historySize,
+    bmqst::StatContext*            statContext)
+{
+    // Use only one level for now ...
+    bmqst::StatValue::SnapshotLocation start(0, 0);
+    bmqst::StatValue::SnapshotLocation end(0, historySize - 1);
+
+    // Create table
+    bmqst::TableSchema& schema = table->schema();
+
+    schema.addDefaultIdColumn("id");
+    schema.addColumn("messages",
+                     k_STAT_LATENCY,
+                     bmqst::StatUtil::eventsDifference,
+                     start,
+                     end);
+    schema.addColumn("latency_avg",
+                     k_STAT_LATENCY,
+                     bmqst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addPercentileColumn("latency_p50",
+                               k_STAT_LATENCY,
+                               50,
+                               start,
+                               end);
+    schema.addPercentileColumn("latency_p99",
+                               k_STAT_LATENCY,
+                               99,
+                               start,
+                               end);
+    schema.addPercentileColumn("latency_p999",
+                               k_STAT_LATENCY,
+                               99.9,
+                               start,
+                               end);
+    schema.addColumn("latency_max",
+                     k_STAT_LATENCY,
+                     bmqst::StatUtil::rangeMax,
+                     start,
+                     end);
+
+    // Configure records
+    bmqst::TableRecords& records = table->records();
+    records.setContext(statContext);
+    records.setFilter(&filterStages);
+    records.considerChildrenOfFilteredContexts(true);
+
+    // Create the tip
+    tip->setTable(table);
+    tip->setColumnGroup("");
+    tip->addColumn("id", "").justifyLeft();
+
+    tip->setColumnGroup("Since PUT");
+    tip->addColumn("messages", "msgs").zeroString("");
+    tip->addColumn("latency_avg", "avg")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("latency_p50", "p50")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("latency_p99", "p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("latency_p999", "p999")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("latency_max", "max")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
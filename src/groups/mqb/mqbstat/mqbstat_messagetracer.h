@@ -0,0 +1,366 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MQBSTAT_MESSAGETRACER
+#define INCLUDED_MQBSTAT_MESSAGETRACER
+
+//@PURPOSE: Provide a mechanism timestamping the stages of sampled messages.
+//
+//@CLASSES:
+//  mqbstat::MessageTracer: Mechanism tracing sampled messages in the broker
+//  mqbstat::MessageTracerUtil: Utilities to initialize the statistics
+//
+//@DESCRIPTION: 'mqbstat::MessageTracer' records the time at which a sample of
+// the messages reach each stage of their lifecycle in the broker (PUT
+// received, written to storage, receipted by the replicas, routed to
+// consumers and PUSH flushed), and reports the latency of each stage since
+// the PUT to a distribution stat value, from which percentiles are printed.
+// 'mqbstat::MessageTracerUtil' is a utility namespace exposing methods to
+// initialize the stat context and the table printing it.
+//
+/// Sampling
+///--------
+// One message out of every 'samplingRate' is traced, as decided by the hash
+// of its GUID, so that every stage makes the same decision for a message
+// without any state being carried along with it.  Tracing is disabled when
+// the sampling rate is 0, which is the default: the cost of a tracing point
+// is then a single atomic load of the installed instance.
+//
+/// Recording
+///---------
+// Tracing points record a stage of a sampled message by writing its GUID,
+// its stage and a timestamp to an entry of one of a fixed number of ring
+// buffers, picked by the calling thread, without locking nor allocating.
+// The entries are read by 'collect', typically at each snapshot of the
+// stats, which joins the stages of a message by GUID and reports their
+// latency once the PUT of the message is known.  Entries overwritten before
+// being collected are dropped, as are the traces of messages not reaching a
+// further stage within 'k_TRACE_TIMEOUT_NS'.  Note that only the stages
+// observed by this broker are joined.
+//
+/// Thread Safety
+///-------------
+// 'trace' and 'record' are thread-safe and lock-free.  'collect' must not be
+// called concurrently with itself.
+
+// BMQ
+#include <bmqst_statcontext.h>
+#include <bmqt_messageguid.h>
+#include <bmqu_time.h>
+
+// BDE
+#include <bsl_memory.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+#include <bslh_hash.h>
+#include <bslma_allocator.h>
+#include <bslma_managedptr.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+// FORWARD DECLARATION
+namespace bmqst {
+class BasicTableInfoProvider;
+}
+namespace bmqst {
+class Table;
+}
+
+namespace mqbstat {
+
+// ===================
+// class MessageTracer
+// ===================
+
+/// Mechanism timestamping the stages of sampled messages.
+class MessageTracer {
+  public:
+    // TYPES
+
+    /// Enum representing the traced stages of the lifecycle of a message.
+    struct Stage {
+        // TYPES
+        enum Enum {
+            e_PUT           = 0,
+            e_STORAGE_WRITE = 1,
+            e_RECEIPT       = 2,
+            e_ROUTE         = 3,
+            e_PUSH_FLUSH    = 4
+        };
+
+        /// Return the non-modifiable string representation corresponding
+        /// to the specified enumeration `value`.
+        static const char* toAscii(Stage::Enum value);
+    };
+
+    // PUBLIC CONSTANTS
+
+    /// Number of traced stages.
+    static const int k_NUM_STAGES = Stage::e_PUSH_FLUSH + 1;
+
+    /// Number of ring buffers shared by the recording threads.  Must be a
+    /// power of 2.
+    static const int k_NUM_BUFFERS = 16;
+
+    /// Number of entries of each ring buffer.  Must be a power of 2.
+    static const int k_BUFFER_SIZE = 2048;
+
+    /// Maximum number of messages whose stages are being joined.
+    static const int k_MAX_TRACES = 16384;
+
+    /// Time, in nanoseconds, after which the trace of a message not
+    /// reaching a further stage is dropped.
+    static const bsls::Types::Int64 k_TRACE_TIMEOUT_NS =
+        60LL * 1000 * 1000 * 1000;
+
+  private:
+    // PRIVATE TYPES
+
+    /// Stage of a message recorded to a ring buffer.  The entry of the
+    /// position `p` of a buffer is valid when its sequence is `p + 1`, and
+    /// the sequence is 0 while the entry is being written.
+    struct Entry {
+        bsls::AtomicUint64 d_sequence;
+        bsls::AtomicUint64 d_guid[2];
+        bsls::AtomicInt    d_stage;
+        bsls::AtomicInt64  d_timestamp;
+    };
+
+    /// Ring buffer of entries.
+    struct Buffer {
+        /// Position of the next entry to write.
+        bsls::AtomicUint64 d_writePosition;
+
+        /// Position of the next entry to read, only used by `collect`.
+        bsls::Types::Uint64 d_readPosition;
+
+        Entry d_entries[k_BUFFER_SIZE];
+    };
+
+    /// Timestamps of the stages of a message being joined.
+    struct Trace {
+        /// Timestamp of each stage, or 0 if not yet recorded.
+        bsls::Types::Int64 d_timestamps[k_NUM_STAGES];
+
+        /// Bitmask of the stages whose latency was reported.
+        int d_reportedStages;
+
+        /// Time at which a stage was last joined to this trace.
+        bsls::Types::Int64 d_lastUpdate;
+    };
+
+    typedef bsl::unordered_map<bmqt::MessageGUID,
+                               Trace,
+                               bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+        Traces;
+
+    typedef bslma::ManagedPtr<bmqst::StatContext> StatContextMp;
+
+    // CLASS DATA
+
+    /// Instance receiving the stages recorded by `trace`, if any.
+    static bsls::AtomicPointer<MessageTracer> s_instance_p;
+
+    // DATA
+
+    /// Allocator used to supply memory.
+    bslma::Allocator* d_allocator_p;
+
+    /// One message out of this number is traced, or none if 0.
+    bsls::AtomicInt d_samplingRate;
+
+    /// Ring buffers of recorded entries.
+    Buffer* d_buffers_p;
+
+    /// Stages of the messages being joined, by GUID.
+    Traces d_traces;
+
+    /// Stat context of each stage, reporting its latency since the PUT.
+    /// The context of `e_PUT` is null.
+    bsl::vector<StatContextMp> d_stageContexts;
+
+    /// Number of entries dropped, either overwritten before being
+    /// collected, or because too many traces were being joined.
+    bsls::Types::Uint64 d_numDropped;
+
+  private:
+    // NOT IMPLEMENTED
+    MessageTracer(const MessageTracer&) BSLS_KEYWORD_DELETED;
+    MessageTracer& operator=(const MessageTracer&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+
+    /// Join the specified `stage` of the message with the specified `guid`,
+    /// recorded at the specified `timestamp`, to the traces at the
+    /// specified `now`.
+    void joinEntry(const bmqt::MessageGUID& guid,
+                   Stage::Enum              stage,
+                   bsls::Types::Int64       timestamp,
+                   bsls::Types::Int64       now);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MessageTracer, bslma::UsesBslmaAllocator)
+
+    // CLASS METHODS
+
+    /// Record the specified `stage` of the message with the specified
+    /// `guid` at the current time to the installed instance, if any, and if
+    /// the message is sampled.
+    static void trace(const bmqt::MessageGUID& guid, Stage::Enum stage);
+
+    /// Return the installed instance, or 0 if none is installed.
+    static MessageTracer* instance();
+
+    /// Install the specified `tracer` as the instance receiving the stages
+    /// recorded by `trace`, or uninstall the current instance if `tracer`
+    /// is 0.  The behavior is undefined if an instance is destroyed while
+    /// installed.
+    static void setInstance(MessageTracer* tracer);
+
+    // CREATORS
+
+    /// Create a tracer reporting the latency of each stage to a subcontext
+    /// of the specified `statContext`, as created by
+    /// `MessageTracerUtil::initializeStatContext`.  Use the specified
+    /// `allocator` to supply memory.  Note that the tracer does not sample
+    /// any message until `setSamplingRate` is called.
+    MessageTracer(bmqst::StatContext* statContext,
+                  bslma::Allocator*   allocator);
+
+    /// Destroy this object.
+    ~MessageTracer();
+
+    // MANIPULATORS
+
+    /// Trace one message out of every specified `rate`, or none if `rate`
+    /// is 0.  The behavior is undefined unless `0 <= rate`.
+    void setSamplingRate(int rate);
+
+    /// Record the specified `stage` of the message with the specified
+    /// `guid` at the specified `timestamp`, in nanoseconds of the high
+    /// resolution timer, whether or not the message is sampled.
+    void record(const bmqt::MessageGUID& guid,
+                Stage::Enum              stage,
+                bsls::Types::Int64       timestamp);
+
+    /// Join the stages recorded since the last call, using the specified
+    /// `now` to expire the traces, and report the latency of each stage
+    /// joined to the PUT of its message.
+    void collect(bsls::Types::Int64 now);
+
+    // ACCESSORS
+
+    /// Return the sampling rate.
+    int samplingRate() const;
+
+    /// Return `true` if the message with the specified `guid` is sampled,
+    /// and `false` otherwise.
+    bool isSampled(const bmqt::MessageGUID& guid) const;
+
+    /// Return the number of messages whose stages are being joined.
+    int numTraces() const;
+
+    /// Return the number of recorded stages which were dropped.
+    bsls::Types::Uint64 numDropped() const;
+};
+
+// ========================
+// struct MessageTracerUtil
+// ========================
+
+/// Utility namespace of methods to initialize the message tracing stats.
+struct MessageTracerUtil {
+    // CLASS METHODS
+
+    /// Initialize the statistics for the message tracing keeping the
+    /// specified `historySize` of history.  Return the created top level
+    /// stat context to use for the message tracer.  Use the specified
+    /// `allocator` for all stat context and stat values.
+    static bsl::shared_ptr<bmqst::StatContext>
+    initializeStatContext(int historySize, bslma::Allocator* allocator);
+
+    /// Load in the specified `table` and `tip` the objects to print the
+    /// specified `statContext` for the specified `historySize`.
+    static void
+    initializeTableAndTip(bmqst::Table*                  table,
+                          bmqst::BasicTableInfoProvider* tip,
+                          int                            historySize,
+                          bmqst::StatContext*            statContext);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -------------------
+// class MessageTracer
+// -------------------
+
+// CLASS METHODS
+inline void MessageTracer::trace(const bmqt::MessageGUID& guid,
+                                 Stage::Enum              stage)
+{
+    MessageTracer* tracer = s_instance_p.loadAcquire();
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(!tracer)) {
+        // Tracing is disabled.
+        return;  // RETURN
+    }
+
+    if (tracer->isSampled(guid)) {
+        tracer->record(guid, stage, bmqu::Time::highResolutionTimer());
+    }
+}
+
+inline MessageTracer* MessageTracer::instance()
+{
+    return s_instance_p.loadAcquire();
+}
+
+// ACCESSORS
+inline int MessageTracer::samplingRate() const
+{
+    return d_samplingRate.loadRelaxed();
+}
+
+inline bool MessageTracer::isSampled(const bmqt::MessageGUID& guid) const
+{
+    const int rate = d_samplingRate.loadRelaxed();
+    return rate > 0 &&
+           bslh::Hash<bmqt::MessageGUIDHashAlgo>()(guid) %
+                   static_cast<unsigned int>(rate) ==
+               0;
+}
+
+inline int MessageTracer::numTraces() const
+{
+    return static_cast<int>(d_traces.size());
+}
+
+inline bsls::Types::Uint64 MessageTracer::numDropped() const
+{
+    return d_numDropped;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
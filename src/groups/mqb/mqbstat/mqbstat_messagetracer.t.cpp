@@ -0,0 +1,270 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbstat_messagetracer.h>
+
+// BMQ
+#include <bmqst_statcontext.h>
+#include <bmqst_statutil.h>
+#include <bmqst_statvalue.h>
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bsl_cstring.h>
+#include <bsl_memory.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef mqbstat::MessageTracer::Stage Stage;
+
+/// Return a GUID built from the specified `value`.
+bmqt::MessageGUID makeGUID(unsigned int value)
+{
+    unsigned char buffer[bmqt::MessageGUID::e_SIZE_BINARY] = {0};
+    buffer[0] = static_cast<unsigned char>(value);
+    buffer[1] = static_cast<unsigned char>(value >> 8);
+    buffer[2] = static_cast<unsigned char>(value >> 16);
+    buffer[3] = static_cast<unsigned char>(value >> 24);
+
+    bmqt::MessageGUID guid;
+    guid.fromBinary(buffer);
+    return guid;
+}
+
+/// Return the latency value of the specified `stage` in the specified
+/// `statContext`.
+const bmqst::StatValue& latency(const bmqst::StatContext& statContext,
+                                Stage::Enum               stage)
+{
+    const bmqst::StatContext* stageContext = statContext.getSubcontext(
+        Stage::toAscii(stage));
+    BSLS_ASSERT_OPT(stageContext);
+    return stageContext->value(bmqst::StatContext::e_DIRECT_VALUE, 0);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_sampling()
+// ------------------------------------------------------------------------
+// SAMPLING
+//
+// Concerns:
+//   - No message is sampled, nor traced, unless a sampling rate is set.
+//   - The sampling decision only depends on the GUID.
+//   - About one message out of the sampling rate is sampled.
+//
+// Testing:
+//   setSamplingRate
+//   isSampled
+//   setInstance
+//   instance
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("SAMPLING");
+
+    bsl::shared_ptr<bmqst::StatContext> statContext =
+        mqbstat::MessageTracerUtil::initializeStatContext(
+            2,
+            bmqtst::TestHelperUtil::allocator());
+    mqbstat::MessageTracer tracer(statContext.get(),
+                                  bmqtst::TestHelperUtil::allocator());
+
+    BMQTST_ASSERT(mqbstat::MessageTracer::instance() == 0);
+    BMQTST_ASSERT_EQ(tracer.samplingRate(), 0);
+    BMQTST_ASSERT(!tracer.isSampled(makeGUID(1)));
+
+    // Tracing without an installed instance has no effect
+    mqbstat::MessageTracer::trace(makeGUID(1), Stage::e_PUT);
+
+    tracer.setSamplingRate(1);
+    BMQTST_ASSERT(tracer.isSampled(makeGUID(1)));
+    BMQTST_ASSERT(tracer.isSampled(makeGUID(2)));
+
+    const int k_NUM_GUIDS = 10000;
+    const int k_RATE      = 10;
+    tracer.setSamplingRate(k_RATE);
+
+    int numSampled = 0;
+    for (int i = 0; i < k_NUM_GUIDS; ++i) {
+        const bool isSampled = tracer.isSampled(makeGUID(i));
+        BMQTST_ASSERT_EQ(isSampled, tracer.isSampled(makeGUID(i)));
+        numSampled += isSampled;
+    }
+    BMQTST_ASSERT_LT(k_NUM_GUIDS / k_RATE / 2, numSampled);
+    BMQTST_ASSERT_LT(numSampled, 2 * k_NUM_GUIDS / k_RATE);
+
+    mqbstat::MessageTracer::setInstance(&tracer);
+    BMQTST_ASSERT(mqbstat::MessageTracer::instance() == &tracer);
+    mqbstat::MessageTracer::setInstance(0);
+    BMQTST_ASSERT(mqbstat::MessageTracer::instance() == 0);
+
+    BMQTST_ASSERT_EQ(
+        0,
+        bsl::strcmp("storage_write", Stage::toAscii(Stage::e_STORAGE_WRITE)));
+}
+
+static void test2_collect()
+// ------------------------------------------------------------------------
+// COLLECT
+//
+// Concerns:
+//   - The stages of a message are joined to its PUT, and their latency
+//     reported once.
+//   - The earliest timestamp of a stage reached several times is kept.
+//   - Traces are dropped once the last stage is reached, or after the
+//     timeout.
+//
+// Testing:
+//   record
+//   collect
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COLLECT");
+
+    bsl::shared_ptr<bmqst::StatContext> statContext =
+        mqbstat::MessageTracerUtil::initializeStatContext(
+            2,
+            bmqtst::TestHelperUtil::allocator());
+    mqbstat::MessageTracer tracer(statContext.get(),
+                                  bmqtst::TestHelperUtil::allocator());
+
+    const bmqt::MessageGUID guid1 = makeGUID(1);
+    const bmqt::MessageGUID guid2 = makeGUID(2);
+
+    // Stages recorded out of order, as from different threads
+    tracer.record(guid1, Stage::e_STORAGE_WRITE, 1500);
+    tracer.record(guid1, Stage::e_PUT, 1000);
+    tracer.record(guid1, Stage::e_ROUTE, 3500);
+    tracer.record(guid1, Stage::e_ROUTE, 3000);
+
+    // No PUT: never reported
+    tracer.record(guid2, Stage::e_STORAGE_WRITE, 2000);
+
+    tracer.collect(10000);
+    BMQTST_ASSERT_EQ(tracer.numTraces(), 2);
+    BMQTST_ASSERT_EQ(tracer.numDropped(), 0u);
+
+    // Reported stages are not reported again
+    tracer.record(guid1, Stage::e_PUSH_FLUSH, 4000);
+    tracer.collect(20000);
+    BMQTST_ASSERT_EQ(tracer.numTraces(), 1);
+
+    statContext->snapshot();
+
+    const bmqst::StatValue::SnapshotLocation k_LATEST(0, 0);
+    const bmqst::StatValue::SnapshotLocation k_PREVIOUS(0, 1);
+
+    const bmqst::StatValue& storage = latency(*statContext,
+                                              Stage::e_STORAGE_WRITE);
+    BMQTST_ASSERT_EQ(bmqst::StatUtil::events(storage, k_LATEST), 1);
+    BMQTST_ASSERT_EQ(bmqst::StatUtil::sum(storage, k_LATEST), 500);
+
+    const bmqst::StatValue& route = latency(*statContext, Stage::e_ROUTE);
+    BMQTST_ASSERT_EQ(bmqst::StatUtil::events(route, k_LATEST), 1);
+    BMQTST_ASSERT_EQ(bmqst::StatUtil::sum(route, k_LATEST), 2000);
+    BMQTST_ASSERT_EQ(
+        bmqst::StatUtil::percentile(route, k_LATEST, k_PREVIOUS, 99),
+        2000);
+
+    const bmqst::StatValue& push = latency(*statContext, Stage::e_PUSH_FLUSH);
+    BMQTST_ASSERT_EQ(bmqst::StatUtil::events(push, k_LATEST), 1);
+    BMQTST_ASSERT_EQ(bmqst::StatUtil::sum(push, k_LATEST), 3000);
+
+    const bmqst::StatValue& receipt = latency(*statContext, Stage::e_RECEIPT);
+    BMQTST_ASSERT_EQ(bmqst::StatUtil::events(receipt, k_LATEST), 0);
+
+    // Expire the trace without PUT
+    tracer.collect(20000 + mqbstat::MessageTracer::k_TRACE_TIMEOUT_NS + 1);
+    BMQTST_ASSERT_EQ(tracer.numTraces(), 0);
+}
+
+static void test3_overflow()
+// ------------------------------------------------------------------------
+// OVERFLOW
+//
+// Concerns:
+//   - Entries overwritten before being collected are dropped, and the
+//     remaining ones are still collected.
+//
+// Testing:
+//   record
+//   collect
+//   numDropped
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("OVERFLOW");
+
+    bsl::shared_ptr<bmqst::StatContext> statContext =
+        mqbstat::MessageTracerUtil::initializeStatContext(
+            2,
+            bmqtst::TestHelperUtil::allocator());
+    mqbstat::MessageTracer tracer(statContext.get(),
+                                  bmqtst::TestHelperUtil::allocator());
+
+    // All the entries of this thread go to the same buffer.
+    const int k_NUM_OVERWRITTEN = 10;
+    const int k_NUM_ENTRIES     = mqbstat::MessageTracer::k_BUFFER_SIZE +
+                              k_NUM_OVERWRITTEN;
+    for (int i = 0; i < k_NUM_ENTRIES; ++i) {
+        tracer.record(makeGUID(i), Stage::e_PUT, 1000);
+    }
+
+    tracer.collect(2000);
+    BMQTST_ASSERT_EQ(tracer.numDropped(),
+                     static_cast<bsls::Types::Uint64>(k_NUM_OVERWRITTEN));
+    BMQTST_ASSERT_EQ(tracer.numTraces(),
+                     mqbstat::MessageTracer::k_BUFFER_SIZE);
+
+    // Nothing new to collect
+    tracer.collect(3000);
+    BMQTST_ASSERT_EQ(tracer.numDropped(),
+                     static_cast<bsls::Types::Uint64>(k_NUM_OVERWRITTEN));
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_overflow(); break;
+    case 2: test2_collect(); break;
+    case 1: test1_sampling(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_DEFAULT);
+}
@@ -142,16 +142,25 @@ const char* QueueStatsDomain::Stat::toString(Stat::Enum value)
         MQBSTAT_CASE(e_ACK_ABS, "queue_ack_msgs_abs")
         MQBSTAT_CASE(e_ACK_TIME_AVG, "queue_ack_time_avg")
         MQBSTAT_CASE(e_ACK_TIME_MAX, "queue_ack_time_max")
+        MQBSTAT_CASE(e_ACK_TIME_P50, "queue_ack_time_p50")
+        MQBSTAT_CASE(e_ACK_TIME_P99, "queue_ack_time_p99")
+        MQBSTAT_CASE(e_ACK_TIME_P999, "queue_ack_time_p999")
         MQBSTAT_CASE(e_NACK_DELTA, "queue_nack_msgs")
         MQBSTAT_CASE(e_NACK_ABS, "queue_nack_msgs_abs")
         MQBSTAT_CASE(e_CONFIRM_DELTA, "queue_confirm_msgs")
         MQBSTAT_CASE(e_CONFIRM_ABS, "queue_confirm_msgs_abs")
         MQBSTAT_CASE(e_CONFIRM_TIME_AVG, "queue_confirm_time_avg")
         MQBSTAT_CASE(e_CONFIRM_TIME_MAX, "queue_confirm_time_max")
+        MQBSTAT_CASE(e_CONFIRM_TIME_P50, "queue_confirm_time_p50")
+        MQBSTAT_CASE(e_CONFIRM_TIME_P99, "queue_confirm_time_p99")
+        MQBSTAT_CASE(e_CONFIRM_TIME_P999, "queue_confirm_time_p999")
         MQBSTAT_CASE(e_REJECT_ABS, "queue_reject_msgs_abs")
         MQBSTAT_CASE(e_REJECT_DELTA, "queue_reject_msgs")
         MQBSTAT_CASE(e_QUEUE_TIME_AVG, "queue_queue_time_avg")
         MQBSTAT_CASE(e_QUEUE_TIME_MAX, "queue_queue_time_max")
+        MQBSTAT_CASE(e_QUEUE_TIME_P50, "queue_queue_time_p50")
+        MQBSTAT_CASE(e_QUEUE_TIME_P99, "queue_queue_time_p99")
+        MQBSTAT_CASE(e_QUEUE_TIME_P999, "queue_queue_time_p999")
         MQBSTAT_CASE(e_GC_MSGS_DELTA, "queue_gc_msgs")
         MQBSTAT_CASE(e_GC_MSGS_ABS, "queue_gc_msgs_abs")
         MQBSTAT_CASE(e_ROLE, "queue_role")
@@ -228,6 +237,13 @@ QueueStatsDomain::getValue(const bmqst::StatContext& context,
         latestSnapshot,                                                       \
         OLDEST_SNAPSHOT(STAT))
 
+#define STAT_PERCENTILE(STAT, PERCENTILE)                                     \
+    bmqst::StatUtil::percentile(                                              \
+        context.value(bmqst::StatContext::e_DIRECT_VALUE, STAT),              \
+        latestSnapshot,                                                       \
+        OLDEST_SNAPSHOT(STAT),                                                \
+        PERCENTILE)
+
     switch (stat) {
     case QueueStatsDomain::Stat::e_NB_PRODUCER: {
         return STAT_SINGLE(value, DomainQueueStats::e_STAT_NB_PRODUCER);
@@ -286,6 +302,15 @@ QueueStatsDomain::getValue(const bmqst::StatContext& context,
             STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_ACK_TIME);
         return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
     }
+    case QueueStatsDomain::Stat::e_ACK_TIME_P50: {
+        return STAT_PERCENTILE(DomainQueueStats::e_STAT_ACK_TIME, 50);
+    }
+    case QueueStatsDomain::Stat::e_ACK_TIME_P99: {
+        return STAT_PERCENTILE(DomainQueueStats::e_STAT_ACK_TIME, 99);
+    }
+    case QueueStatsDomain::Stat::e_ACK_TIME_P999: {
+        return STAT_PERCENTILE(DomainQueueStats::e_STAT_ACK_TIME, 99.9);
+    }
     case QueueStatsDomain::Stat::e_NACK_ABS: {
         return STAT_SINGLE(value, DomainQueueStats::e_STAT_NACK);
     }
@@ -305,6 +330,15 @@ QueueStatsDomain::getValue(const bmqst::StatContext& context,
             STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_CONFIRM_TIME);
         return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
     }
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P50: {
+        return STAT_PERCENTILE(DomainQueueStats::e_STAT_CONFIRM_TIME, 50);
+    }
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P99: {
+        return STAT_PERCENTILE(DomainQueueStats::e_STAT_CONFIRM_TIME, 99);
+    }
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P999: {
+        return STAT_PERCENTILE(DomainQueueStats::e_STAT_CONFIRM_TIME, 99.9);
+    }
     case QueueStatsDomain::Stat::e_QUEUE_TIME_AVG: {
         const bsls::Types::Int64 avg =
             STAT_RANGE(averagePerEvent, DomainQueueStats::e_STAT_QUEUE_TIME);
@@ -315,6 +349,15 @@ QueueStatsDomain::getValue(const bmqst::StatContext& context,
             STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_QUEUE_TIME);
         return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
     }
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P50: {
+        return STAT_PERCENTILE(DomainQueueStats::e_STAT_QUEUE_TIME, 50);
+    }
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P99: {
+        return STAT_PERCENTILE(DomainQueueStats::e_STAT_QUEUE_TIME, 99);
+    }
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P999: {
+        return STAT_PERCENTILE(DomainQueueStats::e_STAT_QUEUE_TIME, 99.9);
+    }
     case QueueStatsDomain::Stat::e_GC_MSGS_ABS: {
         return STAT_SINGLE(value, DomainQueueStats::e_STAT_GC_MSGS);
     }
@@ -377,10 +420,68 @@ QueueStatsDomain::getValue(const bmqst::StatContext& context,
 
     return 0;
 
+#undef STAT_PERCENTILE
 #undef STAT_RANGE
 #undef STAT_SINGLE
 }
 
+bsls::Types::Int64
+QueueStatsDomain::loadDistribution(bmqst::Histogram*         result,
+                                   const bmqst::StatContext& context,
+                                   int                       snapshotId,
+                                   const Stat::Enum&         stat)
+{
+    // invoked from the SNAPSHOT thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(snapshotId >= -1);  // do not support other negatives yet
+
+    int distribution;
+    switch (stat) {
+    case QueueStatsDomain::Stat::e_ACK_TIME_AVG:
+    case QueueStatsDomain::Stat::e_ACK_TIME_MAX:
+    case QueueStatsDomain::Stat::e_ACK_TIME_P50:
+    case QueueStatsDomain::Stat::e_ACK_TIME_P99:
+    case QueueStatsDomain::Stat::e_ACK_TIME_P999: {
+        distribution = DomainQueueStats::e_STAT_ACK_TIME;
+    } break;
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_AVG:
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_MAX:
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P50:
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P99:
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P999: {
+        distribution = DomainQueueStats::e_STAT_CONFIRM_TIME;
+    } break;
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_AVG:
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_MAX:
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P50:
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P99:
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P999: {
+        distribution = DomainQueueStats::e_STAT_QUEUE_TIME;
+    } break;
+    default: {
+        BSLS_ASSERT_SAFE(false && "Not a latency stat");
+        return 0;  // RETURN
+    }
+    }
+
+    const bmqst::StatValue& value =
+        context.value(bmqst::StatContext::e_DIRECT_VALUE, distribution);
+    const bmqst::StatValue::SnapshotLocation latestSnapshot(0, 0);
+    const bmqst::StatValue::SnapshotLocation oldestSnapshot(
+        0,
+        snapshotId >= 0 ? snapshotId : value.historySize(0) - 1);
+
+    bmqst::StatUtil::loadHistogram(result,
+                                   value,
+                                   latestSnapshot,
+                                   oldestSnapshot);
+    return bmqst::StatUtil::sumDifference(value,
+                                          latestSnapshot,
+                                          oldestSnapshot);
+}
+
 QueueStatsDomain::QueueStatsDomain(bslma::Allocator* allocator)
 : d_allocator_p(bslma::Default::allocator(allocator))
 , d_statContext_mp(0)
@@ -782,12 +883,12 @@ QueueStatsUtil::initializeStatContextDomains(int               historySize,
         .value("messages")
         .value("bytes")
         .value("ack")
-        .value("ack_time", bmqst::StatValue::e_DISCRETE)
+        .value("ack_time", bmqst::StatValue::e_DISTRIBUTION)
         .value("nack")
         .value("confirm")
-        .value("confirm_time", bmqst::StatValue::e_DISCRETE)
+        .value("confirm_time", bmqst::StatValue::e_DISTRIBUTION)
         .value("reject")
-        .value("queue_time", bmqst::StatValue::e_DISCRETE)
+        .value("queue_time", bmqst::StatValue::e_DISTRIBUTION)
         .value("gc")
         .value("push")
         .value("put")
@@ -922,6 +1023,21 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      bmqst::StatUtil::rangeMax,
                      start,
                      end);
+    schema.addPercentileColumn("ack_time_p50",
+                               DomainQueueStats::e_STAT_ACK_TIME,
+                               50,
+                               start,
+                               end);
+    schema.addPercentileColumn("ack_time_p99",
+                               DomainQueueStats::e_STAT_ACK_TIME,
+                               99,
+                               start,
+                               end);
+    schema.addPercentileColumn("ack_time_p999",
+                               DomainQueueStats::e_STAT_ACK_TIME,
+                               99.9,
+                               start,
+                               end);
     schema.addColumn("nack_delta",
                      DomainQueueStats::e_STAT_NACK,
                      bmqst::StatUtil::valueDifference,
@@ -950,6 +1066,21 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      bmqst::StatUtil::rangeMax,
                      start,
                      end);
+    schema.addPercentileColumn("confirm_time_p50",
+                               DomainQueueStats::e_STAT_CONFIRM_TIME,
+                               50,
+                               start,
+                               end);
+    schema.addPercentileColumn("confirm_time_p99",
+                               DomainQueueStats::e_STAT_CONFIRM_TIME,
+                               99,
+                               start,
+                               end);
+    schema.addPercentileColumn("confirm_time_p999",
+                               DomainQueueStats::e_STAT_CONFIRM_TIME,
+                               99.9,
+                               start,
+                               end);
     schema.addColumn("reject_delta",
                      DomainQueueStats::e_STAT_REJECT,
                      bmqst::StatUtil::valueDifference,
@@ -969,6 +1100,21 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      bmqst::StatUtil::rangeMax,
                      start,
                      end);
+    schema.addPercentileColumn("queue_time_p50",
+                               DomainQueueStats::e_STAT_QUEUE_TIME,
+                               50,
+                               start,
+                               end);
+    schema.addPercentileColumn("queue_time_p99",
+                               DomainQueueStats::e_STAT_QUEUE_TIME,
+                               99,
+                               start,
+                               end);
+    schema.addPercentileColumn("queue_time_p999",
+                               DomainQueueStats::e_STAT_QUEUE_TIME,
+                               99.9,
+                               start,
+                               end);
     schema.addColumn("gc_msgs_delta",
                      DomainQueueStats::e_STAT_GC_MSGS,
                      bmqst::StatUtil::valueDifference,
@@ -1031,6 +1177,10 @@ void QueueStatsUtil::initializeTableAndTipDomains(
         .zeroString("")
         .extremeValueString("")
         .printAsNsTimeInterval();
+    tip->addColumn("queue_time_p99", "p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
 
     tip->setColumnGroup("Ack");
     tip->addColumn("ack_delta", "delta").zeroString("");
@@ -1043,6 +1193,10 @@ void QueueStatsUtil::initializeTableAndTipDomains(
         .zeroString("")
         .extremeValueString("")
         .printAsNsTimeInterval();
+    tip->addColumn("ack_time_p99", "time p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
     tip->setColumnGroup("Nack");
     tip->addColumn("nack_delta", "delta").zeroString("");
     tip->addColumn("nack_abs", "abs").zeroString("");
@@ -1058,6 +1212,10 @@ void QueueStatsUtil::initializeTableAndTipDomains(
         .zeroString("")
         .extremeValueString("")
         .printAsNsTimeInterval();
+    tip->addColumn("confirm_time_p99", "time p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
     tip->setColumnGroup("Reject");
     tip->addColumn("reject_delta", "delta").zeroString("");
     tip->addColumn("reject_abs", "abs").zeroString("");
@@ -56,6 +56,7 @@ class Uri;
 }
 namespace bmqst {
 class BasicTableInfoProvider;
+class Histogram;
 class StatContext;
 class Table;
 }
@@ -129,16 +130,25 @@ class QueueStatsDomain {
             e_ACK_ABS,
             e_ACK_TIME_AVG,
             e_ACK_TIME_MAX,
+            e_ACK_TIME_P50,
+            e_ACK_TIME_P99,
+            e_ACK_TIME_P999,
             e_NACK_DELTA,
             e_NACK_ABS,
             e_CONFIRM_DELTA,
             e_CONFIRM_ABS,
             e_CONFIRM_TIME_AVG,
             e_CONFIRM_TIME_MAX,
+            e_CONFIRM_TIME_P50,
+            e_CONFIRM_TIME_P99,
+            e_CONFIRM_TIME_P999,
             e_REJECT_ABS,
             e_REJECT_DELTA,
             e_QUEUE_TIME_AVG,
             e_QUEUE_TIME_MAX,
+            e_QUEUE_TIME_P50,
+            e_QUEUE_TIME_P99,
+            e_QUEUE_TIME_P999,
             e_GC_MSGS_DELTA,
             e_GC_MSGS_ABS,
             e_ROLE,
@@ -243,6 +253,21 @@ class QueueStatsDomain {
                                        int                       snapshotId,
                                        const Stat::Enum&         stat);
 
+    /// Add to the specified `result` the histogram of the latencies reported
+    /// to the queue represented by its associated specified `context`
+    /// between the latest snapshot and the specified `snapshotId` snapshots
+    /// ago, as for `getValue`, and return their sum.  The latencies are the
+    /// ones of the distribution the specified `stat` is computed from, which
+    /// must be one of the `e_ACK_TIME_*`, `e_CONFIRM_TIME_*` or
+    /// `e_QUEUE_TIME_*` stats.
+    ///
+    /// THREAD: This method can only be invoked from the `snapshot` thread.
+    static bsls::Types::Int64
+    loadDistribution(bmqst::Histogram*         result,
+                     const bmqst::StatContext& context,
+                     int                       snapshotId,
+                     const Stat::Enum&         stat);
+
     // CREATORS
 
     /// Create a new object in an uninitialized state, using the specified
@@ -679,6 +679,20 @@ static void test5_appIdMetrics()
                 *bazSc,
                 -1,
                 mqbstat::QueueStatsDomain::Stat::e_CONFIRM_TIME_MAX));
+
+        // Percentiles are capped by the maximum reported value
+        BMQTST_ASSERT_EQ(
+            900,
+            mqbstat::QueueStatsDomain::getValue(
+                *barSc,
+                -1,
+                mqbstat::QueueStatsDomain::Stat::e_CONFIRM_TIME_P99));
+        BMQTST_ASSERT_EQ(
+            500,
+            mqbstat::QueueStatsDomain::getValue(
+                *bazSc,
+                -1,
+                mqbstat::QueueStatsDomain::Stat::e_CONFIRM_TIME_P99));
     }
 }
 
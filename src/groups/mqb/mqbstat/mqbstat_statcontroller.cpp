@@ -31,6 +31,7 @@
 #include <mqbstat_domainstats.h>
 #include <mqbstat_flatjsonprinter.h>
 #include <mqbstat_jsonprinter.h>
+#include <mqbstat_messagetracer.h>
 #include <mqbstat_queuestats.h>
 #include <mqbstat_statmonitor.h>
 #include <mqbstat_statsfilelogger.h>
@@ -63,6 +64,7 @@
 #include <bsl_ctime.h>
 #include <bsl_exception.h>
 #include <bsl_iostream.h>
+#include <bsl_limits.h>
 #include <bsl_utility.h>
 #include <bslma_allocator.h>
 #include <bslmt_semaphore.h>
@@ -87,6 +89,8 @@ const bsls::Types::Int64 k_NS_PER_MESSAGE = 15 *
 
 const char k_PUBLISHINTERVAL_SUFFIX[] = ".PUBLISHINTERVAL";
 
+const char k_SAMPLINGRATE_TUNABLE[] = "MESSAGETRACING.SAMPLINGRATE";
+
 typedef bsl::unordered_set<mqbplug::PluginFactory*> PluginFactories;
 
 /// Post on the optionally specified `semaphore`.
@@ -304,6 +308,17 @@ void StatController::initializeStats()
             ClusterStatsUtil::initializeStatContextCluster(historySize,
                                                            clustersAllocator),
             false)));
+
+    // --------------
+    // MessageTracing
+    bslma::Allocator* messageTracingAllocator = d_allocators.get(
+        "MessageTracingStats");
+    d_statContextsMap.insert(bsl::make_pair(
+        bsl::string("messageTracing"),
+        StatContextDetails(
+            MessageTracerUtil::initializeStatContext(historySize,
+                                                     messageTracingAllocator),
+            false)));
 }
 
 void StatController::captureStatsAndSemaphorePost(
@@ -370,6 +385,60 @@ void StatController::setTunable(mqbcmd::StatResult*       result,
     const int                  snapshotInterval = statsCfg.snapshotInterval();
     const int maxPublishInterval = d_statConsumerMaxPublishInterval;
 
+    // Handle 'MESSAGETRACING.SAMPLINGRATE' tunable.
+    if (bdlb::StringRefUtil::areEqualCaseless(tunable.name(),
+                                              k_SAMPLINGRATE_TUNABLE)) {
+        StatContextDetailsMap::const_iterator ctxIt = d_statContextsMap.find(
+            "messageTracing");
+        if (ctxIt == d_statContextsMap.end()) {
+            result->makeError();
+            result->error().message() = "Message tracing is unavailable "
+                                        "when statistics are disabled";
+            return;  // RETURN
+        }
+
+        if (!tunable.value().isTheIntegerValue() ||
+            tunable.value().theInteger() < 0 ||
+            tunable.value().theInteger() > bsl::numeric_limits<int>::max()) {
+            bmqu::MemOutStream output;
+            output << "MESSAGETRACING.SAMPLINGRATE must be a non-negative "
+                   << "integer, tracing one message out of that number, or "
+                   << "0 to disable the tracing, but instead the following "
+                   << "was specified: " << tunable.value();
+            result->makeError();
+            result->error().message() = output.str();
+            return;  // RETURN
+        }
+
+        const int newValue = static_cast<int>(tunable.value().theInteger());
+        const int oldValue = d_messageTracer_mp
+                                 ? d_messageTracer_mp->samplingRate()
+                                 : 0;
+
+        if (newValue != 0 && !d_messageTracer_mp) {
+            // Only allocate the ring buffers once the tracing is enabled.
+            d_messageTracer_mp =
+                bslma::ManagedPtrUtil::allocateManaged<MessageTracer>(
+                    d_allocator_p,
+                    ctxIt->second.d_statContext_sp.get(),
+                    d_allocators.get("MessageTracer"));
+            MessageTracer::setInstance(d_messageTracer_mp.get());
+        }
+        if (d_messageTracer_mp) {
+            d_messageTracer_mp->setSamplingRate(newValue);
+        }
+
+        BALL_LOG_INFO << "Set message tracing sampling rate to " << newValue
+                      << " [previous: " << oldValue << "]";
+
+        mqbcmd::TunableConfirmation& tunableConfirmation =
+            result->makeTunableConfirmation();
+        tunableConfirmation.name() = "messageTracing.samplingRate";
+        tunableConfirmation.oldValue().makeTheInteger(oldValue);
+        tunableConfirmation.newValue().makeTheInteger(newValue);
+        return;  // RETURN
+    }
+
     // Handle '<STATCONSUMER>.PUBLISHINTERVAL' tunable.
     size_t suffixPos = tunable.name().size() -
                        (sizeof(k_PUBLISHINTERVAL_SUFFIX) - 1);
@@ -495,6 +564,15 @@ void StatController::getTunable(mqbcmd::StatResult* result,
     bdlb::ScopeExitAny semaphorePost(
         bdlf::BindUtil::bind(&optionalSemaphorePost, semaphore));
 
+    if (bdlb::StringRefUtil::areEqualCaseless(tunable,
+                                              k_SAMPLINGRATE_TUNABLE)) {
+        mqbcmd::Tunable& tunableObj = result->makeTunable();
+        tunableObj.name()           = "messageTracing.samplingRate";
+        tunableObj.value().makeTheInteger(
+            d_messageTracer_mp ? d_messageTracer_mp->samplingRate() : 0);
+        return;  // RETURN
+    }
+
     size_t suffixPos = tunable.size() - (sizeof(k_PUBLISHINTERVAL_SUFFIX) - 1);
     if (tunable.size() > sizeof(k_PUBLISHINTERVAL_SUFFIX) &&
         bdlb::StringRefUtil::areEqualCaseless(
@@ -559,6 +637,17 @@ void StatController::listTunables(mqbcmd::StatResult* result,
 
     mqbcmd::Tunables& tunables = result->makeTunables();
 
+    {
+        mqbcmd::Tunable& tunable = tunables.tunables().emplace_back();
+        tunable.name()           = k_SAMPLINGRATE_TUNABLE;
+        tunable.value().makeTheInteger(
+            d_messageTracer_mp ? d_messageTracer_mp->samplingRate() : 0);
+        tunable.description() =
+            "non-negative integer value N to trace the stages of one message "
+            "out of every N, reported in the 'MESSAGE TRACING' section of the "
+            "stats, or 0 to disable the tracing.";
+    }
+
     bsl::vector<StatConsumerMp>::const_iterator it = d_statConsumers.begin();
     for (; it != d_statConsumers.end(); ++it) {
         mqbcmd::Tunable& tunable = tunables.tunables().emplace_back();
@@ -602,6 +691,11 @@ bool StatController::snapshot()
 
     d_lastSnapshotTime = now;
 
+    // Report the latencies of the messages traced since the last snapshot
+    if (d_messageTracer_mp) {
+        d_messageTracer_mp->collect(now);
+    }
+
     // Snapshot all root stat contexts
     for (StatContextDetailsMap::iterator mit = d_statContextsMap.begin();
          mit != d_statContextsMap.end();
@@ -762,6 +856,7 @@ StatController::StatController(const CommandProcessorFn& commandProcessor,
 , d_flatJsonPrinter_mp(0)
 , d_statConsumers(allocator)
 , d_statConsumerMaxPublishInterval(0)
+, d_messageTracer_mp(0)
 , d_eventScheduler_p(eventScheduler)
 , d_allocator_p(allocator)
 {
@@ -997,6 +1092,12 @@ void StatController::stop()
         d_scheduler_mp->stop();
     }
 
+    // Stop tracing messages.  Note that the tracer is only destroyed with
+    // this object, as tracing points may still be using it.
+    if (d_messageTracer_mp) {
+        MessageTracer::setInstance(0);
+    }
+
     // Stop everything
     bsl::vector<StatConsumerMp>::iterator it = d_statConsumers.begin();
     for (; it != d_statConsumers.end(); ++it) {
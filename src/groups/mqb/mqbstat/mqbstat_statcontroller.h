@@ -82,6 +82,7 @@ namespace mqbstat {
 // FORWARD DECLARATION
 class FlatJsonPrinter;
 class JsonPrinter;
+class MessageTracer;
 class StatMonitor;
 class StatsFileLogger;
 class TablePrinter;
@@ -120,6 +121,7 @@ class StatController {
     typedef bslma::ManagedPtr<FlatJsonPrinter>            FlatJsonPrinterMp;
     typedef bslma::ManagedPtr<JsonPrinter>                JsonPrinterMp;
     typedef bslma::ManagedPtr<mqbplug::StatConsumer>      StatConsumerMp;
+    typedef bslma::ManagedPtr<MessageTracer>              MessageTracerMp;
 
     /// Tracks snapshot IDs and the action counter that determines when
     /// periodic stats output should be produced.
@@ -245,6 +247,11 @@ class StatController {
     /// StatConsumer max publish interval
     int d_statConsumerMaxPublishInterval;
 
+    /// Tracer of the stages of sampled messages, created when message
+    /// tracing is first enabled with the `MESSAGETRACING.SAMPLINGRATE`
+    /// tunable, and installed as the `MessageTracer` instance until `stop`.
+    MessageTracerMp d_messageTracer_mp;
+
     /// Event scheduler passed in from application
     bdlmt::EventScheduler* d_eventScheduler_p;
 
@@ -367,6 +374,9 @@ class StatController {
     /// Retrieve the clusters top-level stat context.
     bmqst::StatContext* clustersStatContext();
 
+    /// Retrieve the message tracing top-level stat context.
+    bmqst::StatContext* messageTracingStatContext();
+
     /// Retrieve the local channels stat context.
     bmqst::StatContext* localChannelsStatContext();
 
@@ -397,6 +407,11 @@ inline bmqst::StatContext* StatController::domainQueuesStatContext()
     return d_statContextsMap["domainQueues"].d_statContext_sp.get();
 }
 
+inline bmqst::StatContext* StatController::messageTracingStatContext()
+{
+    return d_statContextsMap["messageTracing"].d_statContext_sp.get();
+}
+
 inline bmqst::StatContext* StatController::clientsStatContext()
 {
     return d_statContextsMap["clients"].d_statContext_sp.get();
@@ -17,6 +17,7 @@
 
 #include <mqbscm_version.h>
 // MQB
+#include <mqbstat_messagetracer.h>
 #include <mqbstat_queuestats.h>
 
 #include <bmqio_statchannelfactory.h>
@@ -43,6 +44,9 @@ namespace {
 // Subcontext names
 const char k_SUBCONTEXT_ALLOCATORS[] = "allocators";
 
+// Context names
+const char k_CONTEXT_MESSAGE_TRACING[] = "messageTracing";
+
 }  // close unnamed namespace
 
 // ------------------
@@ -93,6 +97,15 @@ void TablePrinter::initializeTablesAndTips(int historySize)
         context->d_statContext_p,
         start,
         end);
+
+    it = d_contexts.find(k_CONTEXT_MESSAGE_TRACING);
+    if (it != d_contexts.end()) {
+        context = it->second.get();
+        MessageTracerUtil::initializeTableAndTip(&context->d_table,
+                                                 &context->d_tip,
+                                                 historySize,
+                                                 context->d_statContext_p);
+    }
 }
 
 TablePrinter::TablePrinter(const StatContextsMap& statContextsMap,
@@ -158,10 +171,23 @@ void TablePrinter::printStats(bsl::ostream& stream, int statId)
     context->d_table.records().update();
     bmqst::TableUtil::printTable(stream, context->d_tip);
 
+    // MESSAGE TRACING
+    ContextsMap::iterator it = d_contexts.find(k_CONTEXT_MESSAGE_TRACING);
+    if (it != d_contexts.end()) {
+        context = it->second.get();
+        context->d_table.records().update();
+        if (context->d_table.records().numRecords() != 0) {
+            // Only print once message tracing was enabled.
+            stream << "\n"
+                   << ":::::::::: :::::::::: MESSAGE TRACING >>";
+            bmqst::TableUtil::printTable(stream, context->d_tip);
+        }
+    }
+
     // ALLOCATORS
     stream << "\n"
            << ":::::::::: :::::::::: ALLOCATORS >>";
-    ContextsMap::iterator it = d_contexts.find("allocators");
+    it = d_contexts.find("allocators");
     if (it == d_contexts.end()) {
         stream << " Unavailable\n";
         return;  // RETURN
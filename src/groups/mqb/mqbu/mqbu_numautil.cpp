@@ -0,0 +1,287 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbu_numautil.h>
+
+#include <mqbscm_version.h>
+// IMPLEMENTATION NOTES
+//
+/// Why not libnuma
+///---------------
+//
+// The broker only needs a handful of operations: enumerate the nodes and
+// their CPUs, restrict a thread to a node and set its memory policy.  The
+// first is read from sysfs and the last two are single syscalls, so the code
+// below issues them directly instead of adding a link-time dependency on
+// 'libnuma' (which is not installed on all hosts).
+//
+/// Memory policy of mapped files
+///-----------------------------
+//
+// 'mbind()' is ignored for 'MAP_SHARED' file mappings: the kernel allocates
+// page cache pages according to the memory policy of the thread causing the
+// allocation.  This is why 'bindCurrentThreadToNode' sets the *thread* memory
+// policy, rather than exposing a way to bind a specific memory range.
+
+// BMQ
+#include <bmqu_memoutstream.h>
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_cerrno.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_string.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+// SYSTEM
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace BloombergLP {
+namespace mqbu {
+
+namespace {
+
+// CONSTANTS
+const char k_SYSFS_NODE_PATH[] = "/sys/devices/system/node/node";
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+/// Upper bound on the number of nodes we look for.
+const int k_MAX_NODES = 64;
+
+/// Value of `MPOL_PREFERRED` from `<numaif.h>`, which is only available
+/// along with `libnuma`.
+const int k_MPOL_PREFERRED = 1;
+#endif
+
+/// Load into the specified `out` the content of the `cpulist` file of the
+/// specified `node`.  Return 0 on success, non-zero otherwise.
+int readCpuListFile(bsl::string* out, int node)
+{
+    bmqu::MemOutStream path;
+    path << k_SYSFS_NODE_PATH << node << "/cpulist";
+
+    bsl::ifstream file(path.str().data());
+    if (!file.is_open()) {
+        return -1;  // RETURN
+    }
+
+    bsl::getline(file, *out);
+    return file.bad() ? -2 : 0;
+}
+
+}  // close unnamed namespace
+
+// ---------------
+// struct NumaUtil
+// ---------------
+
+int NumaUtil::numNodes()
+{
+    bsl::vector<int> nodes;
+    loadNodes(&nodes);
+
+    return static_cast<int>(nodes.size());
+}
+
+void NumaUtil::loadNodes(bsl::vector<int>* nodes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(nodes);
+
+    nodes->clear();
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bsl::vector<int> cpus;
+    for (int node = 0; node < k_MAX_NODES; ++node) {
+        // Node ids need not be contiguous: keep scanning past missing nodes
+        // and nodes without CPUs.
+        if (0 == loadNodeCpus(&cpus, node) && !cpus.empty()) {
+            nodes->push_back(node);
+        }
+    }
+#endif
+
+    if (nodes->empty()) {
+        nodes->push_back(0);
+    }
+}
+
+int NumaUtil::loadNodeCpus(bsl::vector<int>* cpus, int node)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cpus);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS     = 0,
+        rc_READ_FAILED = -1,
+        rc_PARSE_ERROR = -2
+    };
+
+    cpus->clear();
+
+    bsl::string cpuList;
+    if (0 != readCpuListFile(&cpuList, node)) {
+        return rc_READ_FAILED;  // RETURN
+    }
+
+    if (0 != parseCpuList(cpus, cpuList.c_str())) {
+        return rc_PARSE_ERROR;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int NumaUtil::parseCpuList(bsl::vector<int>* cpus, const char* cpuList)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cpus);
+    BSLS_ASSERT_SAFE(cpuList);
+
+    cpus->clear();
+
+    const char* p = cpuList;
+    while (*p != '\0' && *p != '\n') {
+        char* end   = 0;
+        long  first = bsl::strtol(p, &end, 10);
+        if (end == p || first < 0) {
+            return -1;  // RETURN
+        }
+
+        long last = first;
+        p         = end;
+        if (*p == '-') {
+            ++p;
+            last = bsl::strtol(p, &end, 10);
+            if (end == p || last < first) {
+                return -2;  // RETURN
+            }
+            p = end;
+        }
+
+        for (long cpu = first; cpu <= last; ++cpu) {
+            cpus->push_back(static_cast<int>(cpu));
+        }
+
+        if (*p == ',') {
+            ++p;
+        }
+        else if (*p != '\0' && *p != '\n') {
+            return -3;  // RETURN
+        }
+    }
+
+    bsl::sort(cpus->begin(), cpus->end());
+    return 0;
+}
+
+int NumaUtil::nodeForProcessor(int processorId,
+                               int numProcessors,
+                               int numNodes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= processorId && processorId < numProcessors);
+    BSLS_ASSERT_SAFE(0 < numNodes);
+
+    return static_cast<int>(
+        (static_cast<bsls::Types::Int64>(processorId) * numNodes) /
+        numProcessors);
+}
+
+int NumaUtil::bindCurrentThreadToNode(int node)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS              = 0,
+        rc_NOT_SUPPORTED        = -1,
+        rc_INVALID_NODE         = -2,
+        rc_AFFINITY_FAILED      = -3,
+        rc_MEMORY_POLICY_FAILED = -4
+    };
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bsl::vector<int> cpus;
+    if (node < 0 || node >= k_MAX_NODES || 0 != loadNodeCpus(&cpus, node) ||
+        cpus.empty()) {
+        return rc_INVALID_NODE;  // RETURN
+    }
+
+    cpu_set_t previous;
+    CPU_ZERO(&previous);
+    if (0 != ::sched_getaffinity(0, sizeof(previous), &previous)) {
+        return rc_AFFINITY_FAILED;  // RETURN
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (bsl::vector<int>::const_iterator cit = cpus.begin();
+         cit != cpus.end();
+         ++cit) {
+        if (*cit < CPU_SETSIZE) {
+            CPU_SET(*cit, &cpuSet);
+        }
+    }
+
+    // 'sched_setaffinity' with a pid of 0 applies to the calling thread only.
+    if (0 != ::sched_setaffinity(0, sizeof(cpuSet), &cpuSet)) {
+        BALL_LOG_WARN << "sched_setaffinity() failed for node " << node
+                      << ", errno: " << errno << " [" << bsl::strerror(errno)
+                      << "]";
+        return rc_AFFINITY_FAILED;  // RETURN
+    }
+
+    unsigned long nodeMask = 1UL << node;
+    if (0 != ::syscall(SYS_set_mempolicy,
+                       k_MPOL_PREFERRED,
+                       &nodeMask,
+                       sizeof(nodeMask) * 8)) {
+        BALL_LOG_WARN << "set_mempolicy() failed for node " << node
+                      << ", errno: " << errno << " [" << bsl::strerror(errno)
+                      << "]";
+        ::sched_setaffinity(0, sizeof(previous), &previous);
+        return rc_MEMORY_POLICY_FAILED;  // RETURN
+    }
+
+    return rc_SUCCESS;
+#else
+    (void)node;
+    return rc_NOT_SUPPORTED;
+#endif
+}
+
+int NumaUtil::currentNode()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    unsigned int cpu  = 0;
+    unsigned int node = 0;
+    if (0 != ::syscall(SYS_getcpu, &cpu, &node, 0)) {
+        return -1;  // RETURN
+    }
+    return static_cast<int>(node);
+#else
+    return -1;
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,110 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MQBU_NUMAUTIL
+#define INCLUDED_MQBU_NUMAUTIL
+
+/// @file mqbu_numautil.h
+///
+/// @brief Provide utilities to discover the NUMA topology and bind threads.
+///
+/// @bbref{mqbu::NumaUtil} provides a set of functions to query the NUMA
+/// topology of the host and to bind the calling thread (both its CPU affinity
+/// and its memory allocation policy) to a given NUMA node.  The topology is
+/// read from `/sys/devices/system/node`, so no dependency on `libnuma` is
+/// required.  On platforms other than Linux, or on hosts exposing a single
+/// node, the host is reported as having one node and binding is a no-op
+/// returning a non-zero value.
+///
+/// Binding a thread also sets its memory policy to *prefer* the node.  Since
+/// the kernel ignores `mbind` on shared file mappings and instead allocates
+/// page cache pages according to the policy of the faulting thread, this is
+/// what keeps the pages of memory-mapped files written by that thread (e.g.,
+/// the partition files written by a queue dispatcher thread) local to the
+/// node.
+///
+/// Thread Safety                                       {#mqbu_numautil_thread}
+/// =============
+///
+/// All functions are thread-safe.  `bindCurrentThreadToNode` only affects the
+/// calling thread.
+
+// BDE
+#include <ball_log.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace mqbu {
+
+// ===============
+// struct NumaUtil
+// ===============
+
+/// Utilities to discover the NUMA topology and bind threads to nodes.
+struct NumaUtil {
+  private:
+    // CLASS-SCOPE CATEGORY
+    BALL_LOG_SET_CLASS_CATEGORY("MQBU.NUMAUTIL");
+
+  public:
+    // CLASS METHODS
+
+    /// Return the number of NUMA nodes with CPUs on this host.  Return 1 if
+    /// the topology cannot be determined or the platform is not supported.
+    static int numNodes();
+
+    /// Load into the specified `nodes` the (sorted) ids of the NUMA nodes
+    /// with CPUs on this host.  Every possible node id is checked, so gaps
+    /// in the numbering (e.g., offline or memory-only nodes) do not hide the
+    /// nodes that follow.  Load the single node 0 if the topology cannot be
+    /// determined or the platform is not supported.
+    static void loadNodes(bsl::vector<int>* nodes);
+
+    /// Load into the specified `cpus` the (sorted) list of CPUs belonging to
+    /// the specified NUMA `node`.  Return 0 on success, or a non-zero value
+    /// if the topology cannot be read for `node`.
+    static int loadNodeCpus(bsl::vector<int>* cpus, int node);
+
+    /// Parse the specified `cpuList`, in the Linux `cpulist` format (e.g.,
+    /// `0-3,8,10-11`), into the specified `cpus`.  Return 0 on success, or a
+    /// non-zero value if `cpuList` is malformed.
+    static int parseCpuList(bsl::vector<int>* cpus, const char* cpuList);
+
+    /// Return the NUMA node to use for the processor having the specified
+    /// `processorId` out of the specified `numProcessors`, on a host with
+    /// the specified `numNodes`.  Processors are assigned to nodes in
+    /// contiguous blocks, so that consecutive processors share a node and
+    /// each node receives the same number of processors (plus or minus one).
+    /// The behavior is undefined unless `0 <= processorId < numProcessors`
+    /// and `0 < numNodes`.
+    static int
+    nodeForProcessor(int processorId, int numProcessors, int numNodes);
+
+    /// Bind the calling thread to the specified NUMA `node`: restrict its CPU
+    /// affinity to the CPUs of `node` and set its memory policy to prefer
+    /// allocations from `node`.  Return 0 on success, or a non-zero value
+    /// otherwise, in which case the affinity and memory policy of the
+    /// calling thread are left unchanged.
+    static int bindCurrentThreadToNode(int node);
+
+    /// Return the NUMA node of the CPU the calling thread is currently
+    /// running on, or -1 if it cannot be determined.
+    static int currentNode();
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,167 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbu_numautil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    // Reading the topology uses temporary strings and streams.
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const int numNodes = mqbu::NumaUtil::numNodes();
+    PV("Number of NUMA nodes: " << numNodes);
+    BMQTST_ASSERT_LE(1, numNodes);
+
+    bsl::vector<int> cpus(bmqtst::TestHelperUtil::allocator());
+    if (0 == mqbu::NumaUtil::loadNodeCpus(&cpus, 0)) {
+        PV("CPUs of node 0: " << cpus.size());
+        BMQTST_ASSERT(!cpus.empty());
+    }
+
+    bsl::vector<int> nodes(bmqtst::TestHelperUtil::allocator());
+    mqbu::NumaUtil::loadNodes(&nodes);
+    BMQTST_ASSERT_EQ(static_cast<size_t>(numNodes), nodes.size());
+    for (size_t i = 1; i < nodes.size(); ++i) {
+        BMQTST_ASSERT_LT(nodes[i - 1], nodes[i]);
+    }
+
+    const int node = mqbu::NumaUtil::currentNode();
+    PV("Current node: " << node);
+    BMQTST_ASSERT_LE(-1, node);
+    BMQTST_ASSERT(node == -1 || bsl::find(nodes.begin(), nodes.end(), node) !=
+                                    nodes.end());
+}
+
+static void test2_parseCpuList()
+{
+    bmqtst::TestHelper::printTestName("PARSE CPU LIST");
+
+    struct Test {
+        int         d_line;
+        const char* d_cpuList;
+        int         d_expectedRc;
+        int         d_expectedCount;
+        int         d_expectedFirst;
+        int         d_expectedLast;
+    } k_DATA[] = {
+        {L_, "", 0, 0, -1, -1},
+        {L_, "0", 0, 1, 0, 0},
+        {L_, "0-3", 0, 4, 0, 3},
+        {L_, "0-3\n", 0, 4, 0, 3},
+        {L_, "8,0-1", 0, 3, 0, 8},
+        {L_, "0-15,32-47", 0, 32, 0, 47},
+        {L_, "3-1", -2, 0, -1, -1},
+        {L_, "a", -1, 0, -1, -1},
+        {L_, "1;2", -3, 0, -1, -1},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test&      test = k_DATA[idx];
+        bsl::vector<int> cpus(bmqtst::TestHelperUtil::allocator());
+
+        PVV(test.d_line << ": parsing '" << test.d_cpuList << "'");
+
+        const int rc = mqbu::NumaUtil::parseCpuList(&cpus, test.d_cpuList);
+        BMQTST_ASSERT_EQ_D(test.d_line, rc, test.d_expectedRc);
+        if (rc != 0) {
+            continue;  // CONTINUE
+        }
+
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           static_cast<int>(cpus.size()),
+                           test.d_expectedCount);
+        if (!cpus.empty()) {
+            BMQTST_ASSERT_EQ_D(test.d_line,
+                               cpus.front(),
+                               test.d_expectedFirst);
+            BMQTST_ASSERT_EQ_D(test.d_line,
+                               cpus.back(),
+                               test.d_expectedLast);
+        }
+    }
+}
+
+static void test3_nodeForProcessor()
+{
+    bmqtst::TestHelper::printTestName("NODE FOR PROCESSOR");
+
+    // Single node: everything on node 0
+    for (int i = 0; i < 4; ++i) {
+        BMQTST_ASSERT_EQ(mqbu::NumaUtil::nodeForProcessor(i, 4, 1), 0);
+    }
+
+    // Two nodes, even number of processors: contiguous halves
+    BMQTST_ASSERT_EQ(mqbu::NumaUtil::nodeForProcessor(0, 4, 2), 0);
+    BMQTST_ASSERT_EQ(mqbu::NumaUtil::nodeForProcessor(1, 4, 2), 0);
+    BMQTST_ASSERT_EQ(mqbu::NumaUtil::nodeForProcessor(2, 4, 2), 1);
+    BMQTST_ASSERT_EQ(mqbu::NumaUtil::nodeForProcessor(3, 4, 2), 1);
+
+    // More nodes than processors: every processor on a distinct node
+    BMQTST_ASSERT_EQ(mqbu::NumaUtil::nodeForProcessor(0, 2, 4), 0);
+    BMQTST_ASSERT_EQ(mqbu::NumaUtil::nodeForProcessor(1, 2, 4), 2);
+
+    // Balanced distribution of 7 processors over 3 nodes
+    int perNode[3] = {0, 0, 0};
+    for (int i = 0; i < 7; ++i) {
+        const int node = mqbu::NumaUtil::nodeForProcessor(i, 7, 3);
+        BMQTST_ASSERT_LE(0, node);
+        BMQTST_ASSERT_LT(node, 3);
+        ++perNode[node];
+    }
+    for (int n = 0; n < 3; ++n) {
+        BMQTST_ASSERT_LE(2, perNode[n]);
+        BMQTST_ASSERT_LE(perNode[n], 3);
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_nodeForProcessor(); break;
+    case 2: test2_parseCpuList(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -132,6 +132,15 @@ def pytest_addoption(parser):
         )
         parser.addini(PYTEST_LOG_SPEC_VAR, help_, type=None, default=None)
 
+    help_ = "run the benchmarks and append their results to FILE"
+    parser.addoption(
+        "--bmq-benchmark",
+        dest="bmq_benchmark",
+        action="store",
+        metavar="FILE",
+        help=help_,
+    )
+
     help_ = "run only with the specified order"
     parser.addoption(
         "--bmq-wave",
@@ -156,6 +165,13 @@ def pytest_configure(config):
 
 
 def pytest_collection_modifyitems(config, items):
+    if config.getoption("bmq_benchmark") is None:
+        for item in items:
+            if item.get_closest_marker("benchmark") is not None:
+                item.add_marker(
+                    pytest.mark.skip(reason="benchmarks run with --bmq-benchmark only")
+                )
+
     active_wave = config.getoption("bmq_wave")
     if active_wave is None:
         return
@@ -0,0 +1,140 @@
+# Copyright 2026 Bloomberg Finance L.P.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Benchmarks measuring the throughput and latency of a multi-node cluster for
+various routing modes, consistencies and message sizes.  They only run with
+'--bmq-benchmark=FILE', and append their results to FILE; see
+'blazingmq.dev.it.benchmark' to compare the results of two runs.
+"""
+
+from itertools import islice
+
+import pytest
+
+import blazingmq.dev.it.testconstants as tc
+from blazingmq.dev.it import benchmark
+from blazingmq.dev.it.fixtures import (
+    Cluster,
+    order,
+)
+
+pytestmark = [order(99), pytest.mark.benchmark]
+
+
+@pytest.fixture(
+    params=[
+        # Message size, and number of messages posted every millisecond
+        pytest.param((1024, 10), id="1KiB"),
+        pytest.param((64 * 1024, 1), id="64KiB"),
+    ]
+)
+def message_size(request):
+    return request.param
+
+
+def run(request, cluster: Cluster, message_size, **kwargs):
+    """
+    Run a workload with the specified 'kwargs' on the specified 'cluster',
+    with the producer and the consumers connected to proxies in different
+    data centers, and append its result to the benchmark results file.
+    """
+
+    producer_proxy, consumer_proxy = islice(cluster.proxy_cycle(), 2)
+    msg_size, post_rate = message_size
+
+    result = benchmark.run_workload(
+        cluster,
+        producer_proxy,
+        consumer_proxy,
+        benchmark.Workload(
+            name=request.node.name,
+            msg_size=msg_size,
+            post_rate=post_rate,
+            **kwargs,
+        ),
+    )
+    benchmark.append_result(request.config.getoption("bmq_benchmark"), result)
+
+
+def test_priority(
+    request, multi_node: Cluster, domain_urls: tc.DomainUrls, message_size
+):
+    """
+    Two consumers sharing the messages of a priority queue.
+    """
+
+    run(
+        request,
+        multi_node,
+        message_size,
+        producer_uri=domain_urls.uri_priority,
+        consumer_uris=[domain_urls.uri_priority] * 2,
+        deliveries_per_message=1,
+    )
+
+
+def test_fanout(
+    request, multi_node: Cluster, domain_urls: tc.DomainUrls, message_size
+):
+    """
+    One consumer for each of the three apps of a fanout queue.
+    """
+
+    run(
+        request,
+        multi_node,
+        message_size,
+        producer_uri=domain_urls.uri_fanout,
+        consumer_uris=[
+            domain_urls.uri_fanout_foo,
+            domain_urls.uri_fanout_bar,
+            domain_urls.uri_fanout_baz,
+        ],
+        deliveries_per_message=3,
+    )
+
+
+def test_broadcast(request, multi_node: Cluster, message_size):
+    """
+    Two consumers each receiving all the messages of a broadcast queue.
+    """
+
+    run(
+        request,
+        multi_node,
+        message_size,
+        producer_uri=tc.URI_BROADCAST,
+        consumer_uris=[tc.URI_BROADCAST] * 2,
+        deliveries_per_message=2,
+    )
+
+
+def test_priority_multiple_producers(
+    request, multi_node: Cluster, domain_urls: tc.DomainUrls, message_size
+):
+    """
+    Four producer threads posting to a priority queue with two consumers.
+    """
+
+    run(
+        request,
+        multi_node,
+        message_size,
+        producer_uri=domain_urls.uri_priority,
+        consumer_uris=[domain_urls.uri_priority] * 2,
+        deliveries_per_message=1,
+        producer_threads=4,
+    )
@@ -760,6 +760,36 @@ def test_multi_interface_share_queues(
     _stop_clients([producer, consumer])
 
 
+@tweak.broker.app_config.network_interfaces.tcp_interface.shm_endpoint(
+    "shm://bmqbrkr.shm"
+)
+def test_shm_listener(cluster: Cluster, domain_urls: tc.DomainUrls):
+    """Check that a client on the same host can connect to the shared memory
+    listener of a broker, and exchange messages with a TCP client."""
+    uri_priority = domain_urls.uri_priority
+    broker = next(cluster.proxy_cycle())
+
+    # The client runs in the working directory of the broker, so the relative
+    # socket path designates the endpoint of this broker.
+    producer = broker.create_client("producer", uri="shm://bmqbrkr.shm")
+    consumer = broker.create_client("consumer")
+    producer.open(uri_priority, flags=["write", "ack"], succeed=True)
+    consumer.open(
+        uri_priority,
+        flags=["read"],
+        consumer_priority=1,
+        max_unconfirmed_messages=1,
+        succeed=True,
+    )
+    producer.post(uri_priority, payload=["shm"], succeed=True, wait_ack=True)
+    assert consumer.wait_push_event()
+    msgs = consumer.list(block=True)
+    assert len(msgs) == 1
+    assert msgs[0].payload == "shm"
+    consumer.confirm(uri_priority, msgs[0].guid, succeed=True)
+    _stop_clients([producer, consumer])
+
+
 @start_cluster(True, True, True)
 @tweak.cluster.queue_operations.open_timeout_ms(2)
 def test_command_timeout(multi_node: Cluster, domain_urls: tc.DomainUrls):
@@ -37,6 +37,7 @@
 #include <bdld_manageddatum.h>
 #include <bdlf_bind.h>
 #include <bdlt_currenttime.h>
+#include <bsl_algorithm.h>
 #include <bsl_atomic.h>
 #include <bsl_cstddef.h>
 #include <bsl_exception.h>
@@ -46,16 +47,20 @@
 #include <bsl_vector.h>
 #include <bsla_annotations.h>
 #include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bslmt_threadattributes.h>
 #include <bslmt_threadutil.h>
 #include <bsls_performancehint.h>
 
 // PROMETHEUS
+#include "prometheus/collectable.h"
 #include "prometheus/exposer.h"
 #include "prometheus/gateway.h"
 #include "prometheus/gauge.h"
+#include "prometheus/histogram.h"
 #include "prometheus/labels.h"
+#include "prometheus/metric_family.h"
 
 namespace BloombergLP {
 namespace bmqprometheus {
@@ -149,6 +154,116 @@ class Tagger {
     ::prometheus::Labels& getLabels() { return labels; }
 };
 
+/// Value of a metric accumulated over the queues of an aggregated domain.
+struct AggregatedValue {
+    bsl::string          d_name;
+    ::prometheus::Labels d_labels;
+    bsls::Types::Int64   d_value;
+};
+
+/// Latency distribution accumulated over the queues of an aggregated
+/// domain.
+struct AggregatedDistribution {
+    bsl::string          d_name;
+    ::prometheus::Labels d_labels;
+    bmqst::Histogram     d_histogram;
+    bsls::Types::Int64   d_sum;
+};
+
+using AggregatedValues = bsl::unordered_map<bsl::string, AggregatedValue>;
+using AggregatedDistributions =
+    bsl::unordered_map<bsl::string, AggregatedDistribution>;
+
+/// Load into the specified 'key' a string identifying the series of the
+/// specified 'name' and 'labels'.
+void makeSeriesKey(bsl::string*                key,
+                   const char*                 name,
+                   const ::prometheus::Labels& labels)
+{
+    key->assign(name);
+    for (::prometheus::Labels::const_iterator it = labels.cbegin();
+         it != labels.cend();
+         ++it) {
+        key->push_back('\0');
+        key->append(it->first.data(), it->first.size());
+        key->push_back('\0');
+        key->append(it->second.data(), it->second.size());
+    }
+}
+
+/// Return true if the values of the specified queue 'stat' of the queues of
+/// a domain are summed when aggregated, and false if their maximum is kept.
+bool isAdditive(mqbstat::QueueStatsDomain::Stat::Enum stat)
+{
+    typedef mqbstat::QueueStatsDomain::Stat Stat;  // Shortcut
+
+    switch (stat) {
+    case Stat::e_ACK_TIME_AVG:
+    case Stat::e_ACK_TIME_MAX:
+    case Stat::e_ACK_TIME_P50:
+    case Stat::e_ACK_TIME_P99:
+    case Stat::e_ACK_TIME_P999:
+    case Stat::e_CONFIRM_TIME_AVG:
+    case Stat::e_CONFIRM_TIME_MAX:
+    case Stat::e_CONFIRM_TIME_P50:
+    case Stat::e_CONFIRM_TIME_P99:
+    case Stat::e_CONFIRM_TIME_P999:
+    case Stat::e_QUEUE_TIME_AVG:
+    case Stat::e_QUEUE_TIME_MAX:
+    case Stat::e_QUEUE_TIME_P50:
+    case Stat::e_QUEUE_TIME_P99:
+    case Stat::e_QUEUE_TIME_P999:
+    case Stat::e_MESSAGES_UTILIZATION_MAX:
+    case Stat::e_BYTES_UTILIZATION_MAX: return false;  // RETURN
+    default: return true;                              // RETURN
+    }
+}
+
+/// Accumulate the specified 'value' of the metric of the specified 'name'
+/// and 'labels' into the specified 'values', by summing it if the specified
+/// 'additive' is true, or by keeping the maximum otherwise.
+void aggregateValue(AggregatedValues*           values,
+                    const char*                 name,
+                    const ::prometheus::Labels& labels,
+                    bsls::Types::Int64          value,
+                    bool                        additive)
+{
+    bsl::string key;
+    makeSeriesKey(&key, name, labels);
+
+    bsl::pair<AggregatedValues::iterator, bool> result = values->emplace(
+        key,
+        AggregatedValue());
+    AggregatedValue& aggregated = result.first->second;
+    if (result.second) {
+        aggregated.d_name   = name;
+        aggregated.d_labels = labels;
+        aggregated.d_value  = value;
+    }
+    else if (additive) {
+        aggregated.d_value += value;
+    }
+    else {
+        aggregated.d_value = bsl::max(aggregated.d_value, value);
+    }
+}
+
+/// Remove from their family, and from the specified 'seriesMap', the series
+/// whose generation differs from the specified 'generation'.
+template <class SERIES_MAP>
+void removeStale(SERIES_MAP* seriesMap, bsls::Types::Uint64 generation)
+{
+    typename SERIES_MAP::iterator it = seriesMap->begin();
+    while (it != seriesMap->end()) {
+        if (it->second.d_generation == generation) {
+            ++it;
+            continue;  // CONTINUE
+        }
+        it->second.d_family_p->Remove(it->second.d_metric_p);
+        it = seriesMap->erase(it);
+    }
+}
+
 bsl::unique_ptr<PrometheusStatExporter>
 makeExporter(const mqbcfg::ExportMode::Value&          mode,
              const bsl::string&                        host,
@@ -177,7 +292,7 @@ PrometheusStatConsumer::~PrometheusStatConsumer()
 
 PrometheusStatConsumer::PrometheusStatConsumer(
     const StatContextsMap& statContextsMap,
-    BSLA_MAYBE_UNUSED bslma::Allocator* allocator)
+    bslma::Allocator*      allocator)
 : d_contextsMap(statContextsMap)
 , d_publishInterval(0)
 , d_snapshotInterval(0)
@@ -185,7 +300,35 @@ PrometheusStatConsumer::PrometheusStatConsumer(
 , d_actionCounter(0)
 , d_isStarted(false)
 , d_prometheusRegistry_p(std::make_shared< ::prometheus::Registry>())
+, d_gauges(allocator)
+, d_histograms(allocator)
+, d_generation(0)
+, d_seriesKey(allocator)
+, d_aggregatedDomains(allocator)
+, d_exportHistograms(false)
+, d_histogramBucketIndices(allocator)
+, d_histogram(allocator)
 {
+    // The buckets of the exported histograms follow a 1-2-5 progression from
+    // 1 microsecond to 50 seconds, and each bucket of 'bmqst::Histogram' is
+    // counted in the first one whose upper bound is higher than or equal to
+    // its highest value.
+    for (double decade = 1e3; decade < 1e11; decade *= 10) {
+        d_histogramBoundaries.push_back(decade);
+        d_histogramBoundaries.push_back(2 * decade);
+        d_histogramBoundaries.push_back(5 * decade);
+    }
+    d_histogramBucketIndices.resize(bmqst::Histogram::k_NUM_BUCKETS);
+    for (int i = 0; i < bmqst::Histogram::k_NUM_BUCKETS; ++i) {
+        d_histogramBucketIndices[i] = static_cast<int>(
+            bsl::lower_bound(d_histogramBoundaries.begin(),
+                             d_histogramBoundaries.end(),
+                             static_cast<double>(
+                                 bmqst::Histogram::bucketHighestValue(i))) -
+            d_histogramBoundaries.begin());
+    }
+    d_histogramIncrements.resize(d_histogramBoundaries.size() + 1);
+
     // Initialize stat contexts
     d_systemStatContext_p       = getStatContext("system");
     d_brokerStatContext_p       = getStatContext("broker");
@@ -227,6 +370,11 @@ int PrometheusStatConsumer::start(
         return -2;  // RETURN
     }
 
+    d_aggregatedDomains.clear();
+    d_aggregatedDomains.insert(prometheusCfg->aggregatedDomains().begin(),
+                               prometheusCfg->aggregatedDomains().end());
+    d_exportHistograms = prometheusCfg->exportHistograms();
+
     if (!d_prometheusStatExporter_p) {
         d_prometheusStatExporter_p = makeExporter(prometheusCfg->mode(),
                                                   prometheusCfg->host(),
@@ -265,6 +413,8 @@ void PrometheusStatConsumer::onSnapshot()
 
     setActionCounter();
 
+    ++d_generation;
+
     captureSystemStats();
     captureNetworkStats();
     captureBrokerStats();
@@ -276,6 +426,8 @@ void PrometheusStatConsumer::onSnapshot()
     captureQueueStats();
     captureDispatcherStats();
 
+    removeStaleSeries();
+
     d_prometheusStatExporter_p->onData();
 }
 
@@ -288,6 +440,11 @@ void PrometheusStatConsumer::captureQueueStats()
 
     typedef mqbstat::QueueStatsDomain::Stat Stat;  // Shortcut
 
+    // Metrics of the queues of aggregated domains, reported once all the
+    // queues have been visited.
+    AggregatedValues        aggregatedValues;
+    AggregatedDistributions aggregatedDistributions;
+
     for (bmqst::StatContextIterator domainIt =
              domainsStatContext.subcontextIterator();
          domainIt;
@@ -304,18 +461,89 @@ void PrometheusStatConsumer::captureQueueStats()
                 d_snapshotId,
                 mqbstat::QueueStatsDomain::Stat::e_ROLE);
 
+            const bsl::string_view domain = map.find("domain")->theString();
+            const bool             isAggregated =
+                !d_aggregatedDomains.empty() &&
+                d_aggregatedDomains.count(bsl::string(domain)) > 0;
+
             Tagger tagger;
             tagger.setCluster(map.find("cluster")->theString())
-                .setDomain(map.find("domain")->theString())
+                .setDomain(domain)
                 .setTier(map.find("tier")->theString())
-                .setQueue(map.find("queue")->theString())
                 .setRole(mqbstat::QueueStatsDomain::Role::toAscii(
                     static_cast<mqbstat::QueueStatsDomain::Role::Enum>(role)))
                 .setInstance(mqbcfg::BrokerConfig::get().brokerInstanceName())
                 .setDataType("host-data");
+            if (!isAggregated) {
+                tagger.setQueue(map.find("queue")->theString());
+            }
 
             const auto labels = tagger.getLabels();
 
+            // Report the specified 'value' of the metric of the specified
+            // 'name' and 'seriesLabels', or accumulate it with the ones of the
+            // other queues of the domain, by summing it if the specified
+            // 'additive' is true or keeping the maximum otherwise, if it is
+            // aggregated.
+            auto report = [&](const char*                 name,
+                              const ::prometheus::Labels& seriesLabels,
+                              bsls::Types::Int64          value,
+                              bool                        additive) {
+                if (isAggregated) {
+                    aggregateValue(&aggregatedValues,
+                                   name,
+                                   seriesLabels,
+                                   value,
+                                   additive);
+                }
+                else {
+                    updateMetric(name, seriesLabels, value);
+                }
+            };
+
+            // Report the distribution of the latencies of the specified
+            // 'stat' of the specified 'context' as the histogram of the
+            // specified 'name' and 'seriesLabels', or accumulate it with the
+            // ones of the other queues of the domain if it is aggregated.
+            auto reportDistribution =
+                [&](const char*                 name,
+                    const ::prometheus::Labels& seriesLabels,
+                    const bmqst::StatContext&   context,
+                    Stat::Enum                  stat) {
+                if (isAggregated) {
+                    makeSeriesKey(&d_seriesKey, name, seriesLabels);
+                    bsl::pair<AggregatedDistributions::iterator, bool> result =
+                        aggregatedDistributions.emplace(
+                            d_seriesKey,
+                            AggregatedDistribution());
+                    AggregatedDistribution& aggregated = result.first->second;
+                    if (result.second) {
+                        aggregated.d_name   = name;
+                        aggregated.d_labels = seriesLabels;
+                        aggregated.d_sum    = 0;
+                    }
+                    aggregated.d_sum +=
+                        mqbstat::QueueStatsDomain::loadDistribution(
+                            &aggregated.d_histogram,
+                            context,
+                            d_snapshotId,
+                            stat);
+                }
+                else {
+                    d_histogram.reset();
+                    const bsls::Types::Int64 sum =
+                        mqbstat::QueueStatsDomain::loadDistribution(
+                            &d_histogram,
+                            context,
+                            d_snapshotId,
+                            stat);
+                    observeDistribution(name,
+                                        seriesLabels,
+                                        d_histogram,
+                                        sum);
+                }
+            };
+
             // Heartbeat metric
             {
                 // This metric is *always* reported for every queue, so that
@@ -323,10 +551,7 @@ void PrometheusStatConsumer::captureQueueStats()
                 // a time series containing all the tags that can be leveraged
                 // in Grafana.
 
-                auto& heartbeatGauge = ::prometheus::BuildGauge()
-                                           .Name("queue_heartbeat")
-                                           .Register(*d_prometheusRegistry_p);
-                heartbeatGauge.Add(labels).Set(0);
+                report("queue_heartbeat", labels, 0, false);
             }
 
             // Queue metrics
@@ -346,20 +571,29 @@ void PrometheusStatConsumer::captureQueueStats()
                     {"queue_ack_msgs", Stat::e_ACK_ABS},
                     {"queue_ack_time_avg", Stat::e_ACK_TIME_AVG},
                     {"queue_ack_time_max", Stat::e_ACK_TIME_MAX},
+                    {"queue_ack_time_p50", Stat::e_ACK_TIME_P50},
+                    {"queue_ack_time_p99", Stat::e_ACK_TIME_P99},
+                    {"queue_ack_time_p999", Stat::e_ACK_TIME_P999},
                     {"queue_nack_msgs_delta", Stat::e_NACK_DELTA},
                     {"queue_nack_msgs", Stat::e_NACK_ABS},
-                    {"queue_confirm_msgs", Stat::e_CONFIRM_DELTA},
+                    {"queue_confirm_msgs_delta", Stat::e_CONFIRM_DELTA},
                     {"queue_confirm_msgs", Stat::e_CONFIRM_ABS},
                     {"queue_confirm_time_avg", Stat::e_CONFIRM_TIME_AVG},
-                    {"queue_confirm_time_max", Stat::e_CONFIRM_TIME_MAX}};
+                    {"queue_confirm_time_max", Stat::e_CONFIRM_TIME_MAX},
+                    {"queue_confirm_time_p50", Stat::e_CONFIRM_TIME_P50},
+                    {"queue_confirm_time_p99", Stat::e_CONFIRM_TIME_P99},
+                    {"queue_confirm_time_p999", Stat::e_CONFIRM_TIME_P999}};
 
                 for (DatapointDefCIter dpIt = bdlb::ArrayUtil::begin(defs);
                      dpIt != bdlb::ArrayUtil::end(defs);
                      ++dpIt) {
-                    // If there are subcontexts, skip 'confirm_time_max'
-                    // metric, it will be processed later.
-                    if (static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
-                            dpIt->d_stat) == Stat::e_CONFIRM_TIME_MAX &&
+                    // If there are subcontexts, skip 'confirm_time_max' and
+                    // 'confirm_time_p99' metrics, they will be processed
+                    // later.
+                    const Stat::Enum stat = static_cast<Stat::Enum>(
+                        dpIt->d_stat);
+                    if ((stat == Stat::e_CONFIRM_TIME_MAX ||
+                         stat == Stat::e_CONFIRM_TIME_P99) &&
                         queueIt->numSubcontexts() > 0) {
                         continue;
                     }
@@ -370,7 +604,7 @@ void PrometheusStatConsumer::captureQueueStats()
                             d_snapshotId,
                             static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
                                 dpIt->d_stat));
-                    updateMetric(dpIt->d_name, labels, value);
+                    report(dpIt->d_name, labels, value, isAdditive(stat));
                 }
             }
 
@@ -390,6 +624,9 @@ void PrometheusStatConsumer::captureQueueStats()
                      Stat::e_BYTES_UTILIZATION_MAX},
                     {"queue_queue_time_avg", Stat::e_QUEUE_TIME_AVG},
                     {"queue_queue_time_max", Stat::e_QUEUE_TIME_MAX},
+                    {"queue_queue_time_p50", Stat::e_QUEUE_TIME_P50},
+                    {"queue_queue_time_p99", Stat::e_QUEUE_TIME_P99},
+                    {"queue_queue_time_p999", Stat::e_QUEUE_TIME_P999},
                     {"queue_reject_msgs_delta", Stat::e_REJECT_DELTA},
                     {"queue_reject_msgs", Stat::e_REJECT_ABS},
                     {"queue_nack_noquorum_msgs_delta",
@@ -400,10 +637,12 @@ void PrometheusStatConsumer::captureQueueStats()
                 for (DatapointDefCIter dpIt = bdlb::ArrayUtil::begin(defs);
                      dpIt != bdlb::ArrayUtil::end(defs);
                      ++dpIt) {
-                    // If there are subcontexts, skip 'cqueue_time_max' metric,
-                    // it will be processed later.
-                    if (static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
-                            dpIt->d_stat) == Stat::e_QUEUE_TIME_MAX &&
+                    // If there are subcontexts, skip 'queue_time_max' and
+                    // 'queue_time_p99' metrics, they will be processed later.
+                    const Stat::Enum stat = static_cast<Stat::Enum>(
+                        dpIt->d_stat);
+                    if ((stat == Stat::e_QUEUE_TIME_MAX ||
+                         stat == Stat::e_QUEUE_TIME_P99) &&
                         queueIt->numSubcontexts() > 0) {
                         continue;
                     }
@@ -414,7 +653,29 @@ void PrometheusStatConsumer::captureQueueStats()
                             d_snapshotId,
                             static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
                                 dpIt->d_stat));
-                    updateMetric(dpIt->d_name, labels, value);
+                    report(dpIt->d_name, labels, value, isAdditive(stat));
+                }
+            }
+
+            // Latency histograms.  As for the maximum and 99th percentile,
+            // confirm and queue times are reported per appId if there are
+            // subcontexts.
+            if (d_exportHistograms) {
+                reportDistribution("queue_ack_time",
+                                   labels,
+                                   *queueIt,
+                                   Stat::e_ACK_TIME_AVG);
+                if (queueIt->numSubcontexts() == 0) {
+                    reportDistribution("queue_confirm_time",
+                                       labels,
+                                       *queueIt,
+                                       Stat::e_CONFIRM_TIME_AVG);
+                    if (role == mqbstat::QueueStatsDomain::Role::e_PRIMARY) {
+                        reportDistribution("queue_queue_time",
+                                           labels,
+                                           *queueIt,
+                                           Stat::e_QUEUE_TIME_AVG);
+                    }
                 }
             }
 
@@ -423,11 +684,13 @@ void PrometheusStatConsumer::captureQueueStats()
             // These per-appId metrics exist for both primary and replica
             static const DatapointDef defsCommon[] = {
                 {"queue_confirm_time_max", Stat::e_CONFIRM_TIME_MAX},
+                {"queue_confirm_time_p99", Stat::e_CONFIRM_TIME_P99},
             };
 
             // These per-appId metrics exist only for primary
             static const DatapointDef defsPrimary[] = {
                 {"queue_queue_time_max", Stat::e_QUEUE_TIME_MAX},
+                {"queue_queue_time_p99", Stat::e_QUEUE_TIME_P99},
                 {"queue_content_msgs_max", Stat::e_MESSAGES_MAX},
                 {"queue_content_bytes_max", Stat::e_BYTES_MAX},
             };
@@ -442,13 +705,13 @@ void PrometheusStatConsumer::captureQueueStats()
                          bdlb::ArrayUtil::begin(defsCommon);
                      dpIt != bdlb::ArrayUtil::end(defsCommon);
                      ++dpIt) {
+                    const Stat::Enum stat = static_cast<Stat::Enum>(
+                        dpIt->d_stat);
                     const bsls::Types::Int64 value =
-                        mqbstat::QueueStatsDomain::getValue(
-                            *appIdIt,
-                            d_snapshotId,
-                            static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
-                                dpIt->d_stat));
-                    updateMetric(dpIt->d_name, labels, value);
+                        mqbstat::QueueStatsDomain::getValue(*appIdIt,
+                                                            d_snapshotId,
+                                                            stat);
+                    report(dpIt->d_name, labels, value, isAdditive(stat));
                 }
 
                 if (role == mqbstat::QueueStatsDomain::Role::e_PRIMARY) {
@@ -456,19 +719,49 @@ void PrometheusStatConsumer::captureQueueStats()
                              bdlb::ArrayUtil::begin(defsPrimary);
                          dpIt != bdlb::ArrayUtil::end(defsPrimary);
                          ++dpIt) {
+                        const Stat::Enum stat = static_cast<Stat::Enum>(
+                            dpIt->d_stat);
                         const bsls::Types::Int64 value =
-                            mqbstat::QueueStatsDomain::getValue(
-                                *appIdIt,
-                                d_snapshotId,
-                                static_cast<
-                                    mqbstat::QueueStatsDomain::Stat::Enum>(
-                                    dpIt->d_stat));
-                        updateMetric(dpIt->d_name, labels, value);
+                            mqbstat::QueueStatsDomain::getValue(*appIdIt,
+                                                                d_snapshotId,
+                                                                stat);
+                        report(dpIt->d_name, labels, value, isAdditive(stat));
+                    }
+                }
+
+                if (d_exportHistograms) {
+                    reportDistribution("queue_confirm_time",
+                                       labels,
+                                       *appIdIt,
+                                       Stat::e_CONFIRM_TIME_AVG);
+                    if (role == mqbstat::QueueStatsDomain::Role::e_PRIMARY) {
+                        reportDistribution("queue_queue_time",
+                                           labels,
+                                           *appIdIt,
+                                           Stat::e_QUEUE_TIME_AVG);
                     }
                 }
             }
         }
     }
+
+    for (AggregatedValues::const_iterator it = aggregatedValues.cbegin();
+         it != aggregatedValues.cend();
+         ++it) {
+        updateMetric(it->second.d_name.c_str(),
+                     it->second.d_labels,
+                     it->second.d_value);
+    }
+
+    for (AggregatedDistributions::const_iterator it =
+             aggregatedDistributions.cbegin();
+         it != aggregatedDistributions.cend();
+         ++it) {
+        observeDistribution(it->second.d_name.c_str(),
+                            it->second.d_labels,
+                            it->second.d_histogram,
+                            it->second.d_sum);
+    }
 }
 
 void PrometheusStatConsumer::captureSystemStats()
@@ -684,6 +977,15 @@ void PrometheusStatConsumer::captureClusterStats(const LeaderSet& leaders)
                 {"cluster_csl_offset_bytes", Stat::e_CSL_LOG_OFFSET_BYTES},
                 {"cluster_csl_write_bytes", Stat::e_CSL_WRITE_BYTES},
                 {"cluster_csl_cfg_bytes", Stat::e_CSL_CFG_BYTES},
+                {"cluster_csl_load_time_ns", Stat::e_CSL_LOAD_TIME_NS},
+                {"cluster_queue_assignments_per_advisory_avg",
+                 Stat::e_QUEUE_ASSIGNMENTS_PER_ADVISORY_AVG},
+                {"cluster_queue_assignments_per_advisory_max",
+                 Stat::e_QUEUE_ASSIGNMENTS_PER_ADVISORY_MAX},
+                {"cluster_queue_assignment_time_ns_avg",
+                 Stat::e_QUEUE_ASSIGNMENT_TIME_NS_AVG},
+                {"cluster_queue_assignment_time_ns_max",
+                 Stat::e_QUEUE_ASSIGNMENT_TIME_NS_MAX},
             };
 
             Tagger tagger;
@@ -753,6 +1055,14 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
                                                      "replication_time_ns_avg";
             const bsl::string replication_time_max = prefix +
                                                      "replication_time_ns_max";
+            const bsl::string receipt_time_avg = prefix +
+                                                 "receipt_time_ns_avg";
+            const bsl::string replication_time_p99 = prefix +
+                                                     "replication_time_ns_p99";
+            const bsl::string receipt_time_max = prefix +
+                                                 "receipt_time_ns_max";
+            const bsl::string receipt_time_p99 = prefix +
+                                                 "receipt_time_ns_p99";
 
             const DatapointDef defs[] = {
                 {rollover_time.c_str(), Stat::e_PARTITION_ROLLOVER_TIME},
@@ -771,7 +1081,15 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
                 {replication_time_avg.c_str(),
                  Stat::e_PARTITION_REPLICATION_TIME_NS_AVG},
                 {replication_time_max.c_str(),
-                 Stat::e_PARTITION_REPLICATION_TIME_NS_MAX}};
+                 Stat::e_PARTITION_REPLICATION_TIME_NS_MAX},
+                {replication_time_p99.c_str(),
+                 Stat::e_PARTITION_REPLICATION_TIME_NS_P99},
+                {receipt_time_avg.c_str(),
+                 Stat::e_PARTITION_RECEIPT_TIME_NS_AVG},
+                {receipt_time_max.c_str(),
+                 Stat::e_PARTITION_RECEIPT_TIME_NS_MAX},
+                {receipt_time_p99.c_str(),
+                 Stat::e_PARTITION_RECEIPT_TIME_NS_P99}};
 
             Tagger tagger;
             tagger.setCluster(clusterIt->name())
@@ -879,6 +1197,9 @@ void PrometheusStatConsumer::captureDispatcherStats()
                 {"dispatcher_queue_time_avg", Stat::e_QUEUE_TIME_AVG},
                 {"dispatcher_queue_time_max", Stat::e_QUEUE_TIME_MAX},
                 {"dispatcher_queue_time_abs_max", Stat::e_QUEUE_TIME_ABS_MAX},
+                {"dispatcher_queue_time_p50", Stat::e_QUEUE_TIME_P50},
+                {"dispatcher_queue_time_p99", Stat::e_QUEUE_TIME_P99},
+                {"dispatcher_queue_time_p999", Stat::e_QUEUE_TIME_P999},
                 {"dispatcher_processing_time_undefined_max",
                  Stat::e_PROCESSING_TIME_UNDEFINED_MAX},
                 {"dispatcher_processing_time_undefined_avg",
@@ -1003,9 +1324,52 @@ void PrometheusStatConsumer::updateMetric(const char*                 name,
                                           const ::prometheus::Labels& labels,
                                           const bsls::Types::Int64    value)
 {
-    auto& gauge = ::prometheus::BuildGauge().Name(name).Register(
-        *d_prometheusRegistry_p);
-    gauge.Add(labels).Set(static_cast<double>(value));
+    makeSeriesKey(&d_seriesKey, name, labels);
+    Series< ::prometheus::Gauge>& series = d_gauges[d_seriesKey];
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!series.d_metric_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        series.d_family_p = &::prometheus::BuildGauge().Name(name).Register(
+            *d_prometheusRegistry_p);
+        series.d_metric_p = &series.d_family_p->Add(labels);
+    }
+    series.d_generation = d_generation;
+    series.d_metric_p->Set(static_cast<double>(value));
+}
+
+void PrometheusStatConsumer::observeDistribution(
+    const char*                 name,
+    const ::prometheus::Labels& labels,
+    const bmqst::Histogram&     histogram,
+    bsls::Types::Int64          sum)
+{
+    makeSeriesKey(&d_seriesKey, name, labels);
+    Series< ::prometheus::Histogram>& series = d_histograms[d_seriesKey];
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!series.d_metric_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        series.d_family_p =
+            &::prometheus::BuildHistogram().Name(name).Register(
+                *d_prometheusRegistry_p);
+        series.d_metric_p = &series.d_family_p->Add(labels,
+                                                    d_histogramBoundaries);
+    }
+    series.d_generation = d_generation;
+
+    bsl::fill(d_histogramIncrements.begin(), d_histogramIncrements.end(), 0);
+    for (bmqst::Histogram::Buckets::const_iterator it =
+             histogram.buckets().begin();
+         it != histogram.buckets().end();
+         ++it) {
+        d_histogramIncrements[d_histogramBucketIndices[it->first]] +=
+            static_cast<double>(it->second);
+    }
+    series.d_metric_p->ObserveMultiple(d_histogramIncrements,
+                                       static_cast<double>(sum));
+}
+
+void PrometheusStatConsumer::removeStaleSeries()
+{
+    removeStale(&d_gauges, d_generation);
+    removeStale(&d_histograms, d_generation);
 }
 
 void PrometheusStatConsumer::setPublishInterval(
@@ -1082,12 +1446,43 @@ bslma::ManagedPtr<StatConsumer> PrometheusStatConsumerPluginFactory::create(
     return result;
 }
 
+// ---------------------------
+// class CachedStatCollectable
+// ---------------------------
+
+/// Collectable returning the metric families collected from another one at
+/// the last call to 'update', so that collecting them does not contend with
+/// the updates of the metrics, nor walk their families.
+class CachedStatCollectable : public ::prometheus::Collectable {
+    mutable bslmt::Mutex                    d_mutex;
+    std::vector< ::prometheus::MetricFamily> d_families;
+
+  public:
+    /// Replace the cached metric families by the ones of the specified
+    /// 'collectable'.
+    void update(const ::prometheus::Collectable& collectable)
+    {
+        std::vector< ::prometheus::MetricFamily> families =
+            collectable.Collect();
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        d_families.swap(families);
+    }
+
+    std::vector< ::prometheus::MetricFamily> Collect() const override
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        return d_families;
+    }
+};
+
 // --------------------------------
 // class PrometheusPullStatExporter
 // --------------------------------
 
 class PrometheusPullStatExporter : public PrometheusStatExporter {
     std::weak_ptr< ::prometheus::Registry>  d_registry_p;
+    std::shared_ptr<CachedStatCollectable>  d_cache_p;
     bsl::unique_ptr< ::prometheus::Exposer> d_exposer_p;
     bsl::string                             d_exposerEndpoint;
 
@@ -1097,6 +1492,7 @@ class PrometheusPullStatExporter : public PrometheusStatExporter {
         const bsl::size_t                               port,
         const std::shared_ptr< ::prometheus::Registry>& registry)
     : d_registry_p(registry)
+    , d_cache_p(std::make_shared<CachedStatCollectable>())
     {
         bsl::ostringstream endpoint;
         endpoint << host << ":" << port;
@@ -1108,7 +1504,7 @@ class PrometheusPullStatExporter : public PrometheusStatExporter {
         try {
             d_exposer_p = bsl::make_unique< ::prometheus::Exposer>(
                 d_exposerEndpoint);
-            d_exposer_p->RegisterCollectable(d_registry_p);
+            d_exposer_p->RegisterCollectable(d_cache_p);
             return 0;  // RETURN
         }
         catch (const bsl::exception& e) {
@@ -1119,6 +1515,17 @@ class PrometheusPullStatExporter : public PrometheusStatExporter {
         }
     }
 
+    void onData() override
+    {
+        // Scrapes are served from the metric families collected once per
+        // publish.
+        std::shared_ptr< ::prometheus::Registry> registry =
+            d_registry_p.lock();
+        if (registry) {
+            d_cache_p->update(*registry);
+        }
+    }
+
     void stop() override { d_exposer_p.reset(); }
 };
 
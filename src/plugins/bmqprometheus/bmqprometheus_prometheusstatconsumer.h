@@ -24,6 +24,23 @@
 //
 //@DESCRIPTION: 'bmqprometheus::PrometheusStatConsumer' handles the publishing
 // of statistics to Prometheus.
+//
+// Every publish interval, the stat contexts are walked and the value of each
+// series (i.e. metric and set of labels) is updated through a handle cached
+// at its creation, so that updating a series does not lookup its family in
+// the registry.  Series which are not updated during a publish (e.g. the ones
+// of a deleted queue) are removed from the registry.  In 'E_PULL' mode, the
+// metric families are collected once per publish, and scrapes are served
+// from this snapshot instead of walking the registry.
+//
+// The queues of the domains listed in 'aggregatedDomains' of the
+// configuration are not labelled with their name: their metrics are
+// aggregated per domain, role and appId, by summing counters and taking the
+// maximum of latencies and utilizations, which bounds the number of series
+// of domains having many queues.  If 'exportHistograms' is set, the
+// distributions of the ack, confirm and queue times are also exported as
+// Prometheus histograms, 'queue_ack_time', 'queue_confirm_time' and
+// 'queue_queue_time', in nanoseconds.
 
 // MQB
 #include <mqbcfg_brokerconfig.h>
@@ -32,6 +49,7 @@
 
 // BMQ
 #include <bmqc_monitoredqueue_bdlccfixedqueue.h>
+#include <bmqst_histogram.h>
 #include <bmqst_statcontext.h>
 #include <bmqu_throttledaction.h>
 
@@ -42,17 +60,23 @@
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
 #include <bsl_unordered_set.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bsls_keyword.h>
 #include <bsls_timeinterval.h>
+#include <bsls_types.h>
 #include <bslstl_stringref.h>
 
 // PROMETHEUS
 #include <bsl_ostream.h>
+#include <prometheus/family.h>
+#include <prometheus/gauge.h>
+#include <prometheus/histogram.h>
 #include <prometheus/labels.h>
 #include <prometheus/registry.h>
+#include <vector>
 
 namespace BloombergLP {
 
@@ -104,6 +128,23 @@ class PrometheusStatConsumer : public mqbplug::StatConsumer {
 
     using DatapointDefCIter = const DatapointDef*;
 
+    /// Series of type `METRIC` of the Prometheus registry.
+    template <class METRIC>
+    struct Series {
+        ::prometheus::Family<METRIC>* d_family_p = 0;
+        // Family the series belongs to
+
+        METRIC* d_metric_p = 0;
+        // Metric of the series
+
+        bsls::Types::Uint64 d_generation = 0;
+        // Generation of the last publish updating the series
+    };
+
+    /// Map of the series of type `METRIC`, by name and labels.
+    template <class METRIC>
+    using SeriesMap = bsl::unordered_map<bsl::string, Series<METRIC> >;
+
     const bmqst::StatContext* d_systemStatContext_p;
     // The system stat context
 
@@ -161,6 +202,41 @@ class PrometheusStatConsumer : public mqbplug::StatConsumer {
     std::shared_ptr< ::prometheus::Registry> d_prometheusRegistry_p;
     // Container for storing statistics in Prometheus format
 
+    SeriesMap< ::prometheus::Gauge> d_gauges;
+    // Gauges of the registry, by name and labels
+
+    SeriesMap< ::prometheus::Histogram> d_histograms;
+    // Histograms of the registry, by name and labels
+
+    bsls::Types::Uint64 d_generation;
+    // Generation of the current publish, incremented every publish
+
+    bsl::string d_seriesKey;
+    // Buffer of the key of the series being updated, reused to avoid
+    // allocating memory for each update
+
+    bsl::unordered_set<bsl::string> d_aggregatedDomains;
+    // Names of the domains whose queue metrics are aggregated, instead of
+    // being reported per queue
+
+    bool d_exportHistograms;
+    // Whether the latency distributions of the queues are exported as
+    // histograms
+
+    std::vector<double> d_histogramBoundaries;
+    // Upper bounds, in nanoseconds, of the buckets of the exported
+    // histograms
+
+    bsl::vector<int> d_histogramBucketIndices;
+    // Index of the bucket of the exported histograms counting the values
+    // of each bucket of 'bmqst::Histogram'
+
+    std::vector<double> d_histogramIncrements;
+    // Buffer of the counts to add to the buckets of an exported histogram
+
+    bmqst::Histogram d_histogram;
+    // Buffer of the latency distribution of a queue
+
   private:
     // PRIVATE ACCESSORS
 
@@ -214,6 +290,18 @@ class PrometheusStatConsumer : public mqbplug::StatConsumer {
                       const ::prometheus::Labels& labels,
                       const bsls::Types::Int64    value);
 
+    /// Add the values counted by the specified 'histogram', whose sum is the
+    /// specified 'sum', to the histogram of the specified 'name' and
+    /// 'labels' in Prometheus Registry.
+    void observeDistribution(const char*                 name,
+                             const ::prometheus::Labels& labels,
+                             const bmqst::Histogram&     histogram,
+                             bsls::Types::Int64          sum);
+
+    /// Remove from Prometheus Registry the series which were not updated
+    /// during the current publish.
+    void removeStaleSeries();
+
     /// Stop plugin
     void stopImpl();
 
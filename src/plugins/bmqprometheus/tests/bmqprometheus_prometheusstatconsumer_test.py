@@ -27,6 +27,12 @@ Test plan:
     - Run broker with local cluster and enabled Prometheus plugin in sandbox (temp folder);
     - Put several messages into different queues;
     - Request metrics from Prometheus and compare them with expected metric values.
+ - In both modes, also:
+    - Check the buckets of the exported latency histograms ('exportHistograms');
+    - Put messages into queues of an aggregated domain ('aggregatedDomains') and
+      check that they are reported as a single series without 'Queue' label;
+    - Put and consume a message, let the broker delete its queue, and check that
+      the series of the queue are removed.
 
 Prerequisites:
 1. bmqbroker, bmqtool and plugins library should be built;
@@ -50,6 +56,7 @@ __test__ = False  # This is not for pytest.
 import argparse
 import http.client
 import json
+import math
 import os
 import shutil
 import subprocess
@@ -78,6 +85,15 @@ QUEUE_PRIMARY_NODE_METRICS = [
 CLUSTER_METRICS = ["cluster_healthiness"]
 BROKER_METRICS = ["brkr_summary_queues_count", "brkr_summary_clients_count"]
 
+# Queues of this domain are reported aggregated per domain
+AGGREGATED_DOMAIN = "bmq.test.mem.priority"
+# Queue deleted by the broker during the test
+STALE_QUEUE_URI = "bmq://bmq.test.persistent.priority/stale-queue"
+# Upper bounds, in nanoseconds, of the buckets of the exported histograms
+HISTOGRAM_BOUNDARIES = [
+    mantissa * 10**exponent for exponent in range(3, 11) for mantissa in (1, 2, 5)
+] + [math.inf]
+
 # Must be in sync with docker/docker-compose.yml
 PROMETHEUS_HOST = "localhost:9090"
 
@@ -155,7 +171,11 @@ def test_local_cluster(
             dict(name="PrometheusStatConsumer", publishInterval=1)
         ]
 
-        prometheus_cfg = plugins_cfg[0]["prometheusSpecific"] = dict(host="localhost")
+        prometheus_cfg = plugins_cfg[0]["prometheusSpecific"] = dict(
+            host="localhost",
+            aggregatedDomains=[AGGREGATED_DOMAIN],
+            exportHistograms=True,
+        )
         if mode == "push":
             prometheus_cfg["port"] = 9091
             prometheus_cfg["mode"] = "E_PUSH"
@@ -189,37 +209,32 @@ def test_local_cluster(
             _check_initial_statistic(prometheus_host)
 
             # Run bmqtool to open queue, put two messages and exit
-            tool_args = [
-                tool_path,
-                "--mode=auto",
-                "-f",
-                "write",
-                "-q",
-                "bmq://bmq.test.persistent.priority/first-queue",
-                "--eventscount=2",
-                "--shutdownGrace=2",
-                "--verbosity=warning",
-            ]
-            tool_proc = subprocess.Popen(tool_args)
-            tool_proc.wait()
+            _run_tool(
+                tool_path, "write", "bmq://bmq.test.persistent.priority/first-queue", 2
+            )
             # Run bmqtool to open another queue, put one message and exit
-            tool_args = [
-                tool_path,
-                "--mode=auto",
-                "-f",
-                "write",
-                "-q",
-                "bmq://bmq.test.persistent.priority/second-queue",
-                "--eventscount=1",
-                "--shutdownGrace=2",
-                "--verbosity=warning",
-            ]
-            tool_proc = subprocess.Popen(tool_args)
-            tool_proc.wait()
+            _run_tool(
+                tool_path, "write", "bmq://bmq.test.persistent.priority/second-queue", 1
+            )
 
             # Check current statistic from Prometheus
             _check_statistic(prometheus_host)
 
+            # Check the histogram of the ack times of the first queue
+            _check_histograms(prometheus_host)
+
+            # Put messages into two queues of the aggregated domain
+            _run_tool(tool_path, "write", f"bmq://{AGGREGATED_DOMAIN}/first-queue", 2)
+            _run_tool(tool_path, "write", f"bmq://{AGGREGATED_DOMAIN}/second-queue", 1)
+            _check_aggregated_domain(prometheus_host)
+
+            # Put a message, consume it, and let the broker delete the queue
+            _run_tool(tool_path, "write", STALE_QUEUE_URI, 1)
+            _run_tool(tool_path, "read", STALE_QUEUE_URI)
+            _check_stale_series_removed(
+                prometheus_host, Path(tmpdirname).joinpath("bmqbrkr.ctl")
+            )
+
         except AssertionError as error:
             print("ERROR: Prometheus metrics check failed: ", error)
             return False
@@ -278,6 +293,120 @@ def _make_request(host, url, params={}):
         conn.close()
 
 
+def _run_tool(tool_path, flags, queue_uri, events_count=None):
+    """Run bmqtool in auto mode with the specified 'flags' on the queue with the
+    specified 'queue_uri': post the specified 'events_count' messages for
+    'write', or consume the messages until none arrives for 2 seconds for
+    'read', and wait for it to exit.
+    """
+    tool_args = [
+        tool_path,
+        "--mode=auto",
+        "-f",
+        flags,
+        "-q",
+        queue_uri,
+        "--shutdownGrace=2",
+        "--verbosity=warning",
+    ]
+    if events_count is not None:
+        tool_args.append(f"--eventscount={events_count}")
+    tool_proc = subprocess.Popen(tool_args)
+    tool_proc.wait(timeout=60)
+
+
+def _query(prometheus_host, query):
+    return _make_request(prometheus_host, "/api/v1/query", dict(query=query))[
+        "result"
+    ]
+
+
+def _wait_for(prometheus_host, query, predicate, description, timeout=20):
+    """Query Prometheus with the specified 'query' every second until the
+    result satisfies the specified 'predicate', and return the result.  Fail
+    with the specified 'description' if it does not within 'timeout' seconds.
+    """
+    for _ in range(timeout):
+        result = _query(prometheus_host, query)
+        if predicate(result):
+            return result
+        time.sleep(1)
+    assert False, f"{description} during {timeout} sec, last result: {result}"
+
+
+def _check_histograms(prometheus_host):
+    labels = 'Queue="first-queue"'
+    _wait_for(
+        prometheus_host,
+        f"queue_ack_time_count{{{labels}}}",
+        lambda result: result and result[0]["value"][-1] == "2",
+        "ack time histogram of first-queue did not count 2 acks",
+    )
+
+    result = _query(prometheus_host, f"queue_ack_time_bucket{{{labels}}}")
+    buckets = sorted(
+        (float(series["metric"]["le"]), float(series["value"][-1]))
+        for series in result
+    )
+    boundaries = [boundary for boundary, _ in buckets]
+    assert boundaries == HISTOGRAM_BOUNDARIES, _assert_message(
+        "queue_ack_time_bucket", HISTOGRAM_BOUNDARIES, boundaries
+    )
+    # Buckets are cumulative, and the last one counts all the observations
+    counts = [count for _, count in buckets]
+    assert counts == sorted(counts), _assert_message(
+        "queue_ack_time_bucket", "non-decreasing counts", counts
+    )
+    assert counts[-1] == 2, _assert_message("queue_ack_time_bucket", 2, counts[-1])
+
+
+def _check_aggregated_domain(prometheus_host):
+    result = _wait_for(
+        prometheus_host,
+        f'queue_put_msgs{{Domain="{AGGREGATED_DOMAIN}"}}',
+        lambda result: result and result[0]["value"][-1] == "3",
+        f"put messages of {AGGREGATED_DOMAIN} were not aggregated",
+    )
+    assert len(result) == 1, _assert_message("queue_put_msgs", 1, len(result))
+    labels = result[0]["metric"]
+    assert "Queue" not in labels, _assert_message(
+        "queue_put_msgs", "no Queue label", labels
+    )
+
+
+def _check_stale_series_removed(prometheus_host, control_path):
+    query = 'queue_heartbeat{Queue="stale-queue"}'
+    _wait_for(
+        prometheus_host,
+        query,
+        lambda result: len(result) == 1,
+        "stale-queue was not reported",
+    )
+
+    # Force the broker to delete the queue, which has no handle nor message
+    # left, retrying until the confirm of the message has been processed.
+    def gc_queues(result):
+        if not result:
+            return True
+        fd = os.open(control_path, os.O_WRONLY | os.O_NONBLOCK)
+        try:
+            os.write(fd, b"CMD CLUSTERS CLUSTER local FORCE_GC_QUEUES\n")
+        finally:
+            os.close(fd)
+        return False
+
+    _wait_for(
+        prometheus_host,
+        query,
+        gc_queues,
+        "series of stale-queue were not removed",
+        timeout=30,
+    )
+    for metric in ["queue_put_msgs", "queue_ack_time_count"]:
+        result = _query(prometheus_host, f'{metric}{{Queue="stale-queue"}}')
+        assert not result, _assert_message(metric, "no series", result)
+
+
 def _check_initial_statistic(prometheus_host):
     all_metrics = QUEUE_METRICS + QUEUE_PRIMARY_NODE_METRICS + BROKER_METRICS
     for metric in all_metrics:
@@ -0,0 +1,327 @@
+# Copyright 2026 Bloomberg Finance L.P.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+blazingmq.dev.it.benchmark
+
+
+PURPOSE: Provide workloads measuring the throughput and latency of a cluster.
+
+A 'Workload' describes a producer and a set of consumers, all 'bmqtool'
+processes in auto mode, posting to and consuming from a queue of a started
+'Cluster'.  'run_workload' runs a workload and summarizes the latency reports
+generated by 'bmqtool' into a 'BenchmarkResult'.  Results are appended, one
+JSON object per line, to a results file with 'append_result', and the results
+of two runs (e.g. before and after an upgrade) are compared with 'compare'.
+
+This module can also be run as a script comparing two results files:
+
+    python3 -m blazingmq.dev.it.benchmark BASELINE CANDIDATE [--tolerance PCT]
+
+which exits with a non-zero status if any workload of CANDIDATE regressed by
+more than PCT percent compared to BASELINE.
+"""
+
+import argparse
+import dataclasses
+import json
+import sys
+from pathlib import Path
+from typing import Dict, List, Optional
+from typing import TYPE_CHECKING
+
+if TYPE_CHECKING:
+    from blazingmq.dev.it.cluster import Cluster
+    from blazingmq.dev.it.process.broker import Broker
+
+# Seconds without receiving any message after which a consumer exits.
+CONSUMER_SHUTDOWN_GRACE = 3
+
+# Metrics of a 'BenchmarkResult' for which higher is better; lower is better
+# for all the other metrics.
+THROUGHPUT_METRICS = ("produce_rate", "deliver_rate")
+LATENCY_METRICS = (
+    "ack_median",
+    "ack_p99",
+    "ack_p999",
+    "e2e_median",
+    "e2e_p99",
+    "e2e_p999",
+    "e2e_max",
+)
+
+
+@dataclasses.dataclass
+class Workload:
+    """A producer posting to 'producer_uri' and one consumer per URI of
+    'consumer_uris'.  The producer posts 'post_rate' messages of 'msg_size'
+    bytes every 'post_interval_ms' milliseconds, from each of its
+    'producer_threads' threads, until each thread posted 'events_count'
+    messages.  Each message is delivered to 'deliveries_per_message'
+    consumers."""
+
+    name: str
+    producer_uri: str
+    consumer_uris: List[str]
+    deliveries_per_message: int
+    msg_size: int
+    post_rate: int = 10
+    post_interval_ms: int = 1
+    events_count: int = 10000
+    producer_threads: int = 1
+
+    @property
+    def num_messages(self) -> int:
+        return self.events_count * self.producer_threads
+
+
+@dataclasses.dataclass
+class BenchmarkResult:
+    """Throughput, in messages per second, and latencies, in nanoseconds, of
+    a workload.  Acknowledgement latencies are measured by the producer, and
+    end-to-end latencies are the worst of the ones measured by each
+    consumer."""
+
+    name: str
+    msg_size: int
+    messages: int
+    deliveries: int
+    produce_rate: float
+    deliver_rate: float
+    ack_median: int
+    ack_p99: int
+    ack_p999: int
+    e2e_median: int
+    e2e_p99: int
+    e2e_p999: int
+    e2e_max: int
+
+
+def count(report: dict) -> int:
+    """Return the number of values of the specified latency 'report'
+    generated by 'bmqtool'."""
+
+    return sum(report["dataPoints"].values())
+
+
+def rate(report: dict) -> float:
+    """Return the average number of values per second of the specified
+    latency 'report' generated by 'bmqtool', over the one second intervals
+    of its timeline between the first and the last one having values."""
+
+    timeline = report.get("timeline", [])
+    active = [index for index, interval in enumerate(timeline) if interval["count"]]
+    if not active:
+        return 0.0
+    total = sum(interval["count"] for interval in timeline)
+    return total / (active[-1] - active[0] + 1)
+
+
+def summarize(
+    workload: Workload, producer_report: dict, consumer_reports: List[dict]
+) -> BenchmarkResult:
+    """Return the result of the specified 'workload' from the specified
+    'producer_report' and 'consumer_reports' generated by 'bmqtool'."""
+
+    def worst(key):
+        return max((report[key] for report in consumer_reports), default=0)
+
+    return BenchmarkResult(
+        name=workload.name,
+        msg_size=workload.msg_size,
+        messages=count(producer_report),
+        deliveries=sum(count(report) for report in consumer_reports),
+        produce_rate=rate(producer_report),
+        deliver_rate=sum(rate(report) for report in consumer_reports),
+        ack_median=producer_report["median"],
+        ack_p99=producer_report["99percentile"],
+        ack_p999=producer_report["99.9percentile"],
+        e2e_median=worst("median"),
+        e2e_p99=worst("99percentile"),
+        e2e_p999=worst("99.9percentile"),
+        e2e_max=worst("max"),
+    )
+
+
+def run_workload(
+    cluster: "Cluster",
+    producer_proxy: "Broker",
+    consumer_proxy: "Broker",
+    workload: Workload,
+    timeout: float = 300,
+) -> BenchmarkResult:
+    """Run the specified 'workload' on the specified 'cluster', with the
+    producer connected to the specified 'producer_proxy' and the consumers
+    connected to the specified 'consumer_proxy', and return its result.
+    Raise an 'AssertionError' if a process fails, or if not every message is
+    delivered, within the optionally specified 'timeout' seconds."""
+
+    work_dir = cluster.work_dir / "benchmark" / workload.name
+    work_dir.mkdir(parents=True, exist_ok=True)
+
+    expected = workload.num_messages * workload.deliveries_per_message
+    max_unconfirmed = f"{expected}:{expected * workload.msg_size}"
+
+    consumers = []
+    for index, uri in enumerate(workload.consumer_uris):
+        report = work_dir / f"consumer{index}.json"
+        report.unlink(missing_ok=True)
+        client = consumer_proxy.create_client(
+            f"consumer{index}",
+            start=False,
+            dump_messages=False,
+            options=[
+                "--mode",
+                "auto",
+                "--queueflags",
+                "read",
+                "--queueuri",
+                uri,
+                "-c",
+                "--maxunconfirmed",
+                max_unconfirmed,
+                "--latency",
+                "epoch",
+                "--latency-report",
+                str(report),
+                "--shutdownGrace",
+                str(CONSUMER_SHUTDOWN_GRACE),
+            ],
+        )
+        consumers.append((client, report))
+
+    # Broadcast messages are only delivered to the consumers attached when
+    # they are posted.
+    for client, _ in consumers:
+        assert client.capture(r"Queue opened", timeout=timeout)
+
+    producer_report = work_dir / "producer.json"
+    producer_report.unlink(missing_ok=True)
+    producer = producer_proxy.create_client(
+        "producer",
+        start=False,
+        dump_messages=False,
+        options=[
+            "--mode",
+            "auto",
+            "--queueflags",
+            "write,ack",
+            "--queueuri",
+            workload.producer_uri,
+            "--msgsize",
+            str(workload.msg_size),
+            "--postrate",
+            str(workload.post_rate),
+            "--postinterval",
+            str(workload.post_interval_ms),
+            "--eventscount",
+            str(workload.events_count),
+            "--producerthreads",
+            str(workload.producer_threads),
+            "--openloop",
+            "--latency",
+            "epoch",
+            "--latency-report",
+            str(producer_report),
+        ],
+    )
+
+    assert producer.wait(timeout) == 0
+    for client, _ in consumers:
+        assert client.wait(timeout) == 0
+
+    result = summarize(
+        workload,
+        json.loads(producer_report.read_text()),
+        [
+            json.loads(report.read_text())
+            for _, report in consumers
+            if report.exists()
+        ],
+    )
+    assert result.deliveries == expected
+    return result
+
+
+def append_result(path: Path, result: BenchmarkResult) -> None:
+    """Append the specified 'result' to the results file at the specified
+    'path'."""
+
+    with open(path, "a") as file:
+        file.write(json.dumps(dataclasses.asdict(result)) + "\n")
+
+
+def load_results(path: Path) -> Dict[str, dict]:
+    """Return the results of the results file at the specified 'path', by
+    workload name.  If a workload was run several times, keep its last
+    result."""
+
+    results = {}
+    with open(path) as file:
+        for line in file:
+            if line.strip():
+                result = json.loads(line)
+                results[result["name"]] = result
+    return results
+
+
+def compare(
+    baseline: Dict[str, dict], candidate: Dict[str, dict], tolerance: float
+) -> List[str]:
+    """Return a description of each metric of the specified 'candidate'
+    results which regressed by more than the specified 'tolerance' percent
+    compared to the specified 'baseline' results.  Workloads missing from
+    either results are ignored."""
+
+    regressions = []
+    for name in sorted(baseline.keys() & candidate.keys()):
+        for metric in THROUGHPUT_METRICS + LATENCY_METRICS:
+            before = baseline[name][metric]
+            after = candidate[name][metric]
+            if metric in THROUGHPUT_METRICS:
+                regressed = after < before * (1 - tolerance / 100)
+            else:
+                regressed = after > before * (1 + tolerance / 100)
+            if regressed:
+                regressions.append(f"{name}: {metric} {before} -> {after}")
+    return regressions
+
+
+def main(argv: Optional[List[str]] = None) -> int:
+    parser = argparse.ArgumentParser(
+        prog="python3 -m blazingmq.dev.it.benchmark",
+        description="Compare two benchmark results files.",
+    )
+    parser.add_argument("baseline", type=Path)
+    parser.add_argument("candidate", type=Path)
+    parser.add_argument(
+        "--tolerance",
+        type=float,
+        default=10,
+        metavar="PCT",
+        help="percentage by which a metric may regress (default: 10)",
+    )
+    args = parser.parse_args(argv)
+
+    regressions = compare(
+        load_results(args.baseline), load_results(args.candidate), args.tolerance
+    )
+    for regression in regressions:
+        print(regression)
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
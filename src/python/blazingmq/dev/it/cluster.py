@@ -633,6 +633,7 @@ class Cluster(contextlib.AbstractContextManager):
         dump_messages=True,
         options=None,
         port=None,
+        uri=None,
     ) -> Client:
         """
         Create a client with the specified name.
@@ -640,7 +641,9 @@ class Cluster(contextlib.AbstractContextManager):
         Either 'proxyhostname' or 'proxy' must be specified; the client
         connects to the specified proxy.  If 'options' is specified, its string
         value is tacked at the end of the 'bmqtool.tsk' argument list. If 'port' is not
-        specified, use either the first listener if it exists or 'broker.port'.
+        specified, use either the first listener if it exists or 'broker.port'.  If
+        'uri' is specified, the client connects to this broker URI (e.g. the
+        'shm://' endpoint of the broker) instead of a TCP port.
         """
 
         if isinstance(options, str):
@@ -656,7 +659,7 @@ class Cluster(contextlib.AbstractContextManager):
 
         client = Client(
             name,
-            ("localhost", port),
+            uri or ("localhost", port),
             tool_path="bin/bmqtool.tsk",
             cwd=(self.work_dir / broker.name),
             dump_messages=dump_messages,
@@ -85,6 +85,9 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_ack_msgs_abs": 0,
                 "queue_ack_time_avg": 0,
                 "queue_ack_time_max": 0,
+                "queue_ack_time_p50": 0,
+                "queue_ack_time_p99": 0,
+                "queue_ack_time_p999": 0,
                 "queue_bytes_current": 0,
                 "queue_bytes_utilization_max": 0,
                 "queue_cfg_bytes": 0,
@@ -93,6 +96,9 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_confirm_msgs_abs": 0,
                 "queue_confirm_time_avg": 0,
                 "queue_confirm_time_max": 0,
+                "queue_confirm_time_p50": 0,
+                "queue_confirm_time_p99": 0,
+                "queue_confirm_time_p999": 0,
                 "queue_consumers_count": 0,
                 "queue_content_bytes": 0,
                 "queue_content_msgs": 0,
@@ -116,6 +122,9 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_put_msgs_abs": 0,
                 "queue_queue_time_avg": 0,
                 "queue_queue_time_max": 0,
+                "queue_queue_time_p50": 0,
+                "queue_queue_time_p99": 0,
+                "queue_queue_time_p999": 0,
                 "queue_reject_msgs": 0,
                 "queue_reject_msgs_abs": 0,
                 "queue_role": 0,
@@ -127,6 +136,9 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_ack_msgs_abs": 0,
                 "queue_ack_time_avg": 0,
                 "queue_ack_time_max": 0,
+                "queue_ack_time_p50": 0,
+                "queue_ack_time_p99": 0,
+                "queue_ack_time_p999": 0,
                 "queue_bytes_current": 0,
                 "queue_bytes_utilization_max": 0,
                 "queue_cfg_bytes": 0,
@@ -135,6 +147,9 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_confirm_msgs_abs": 0,
                 "queue_confirm_time_avg": 0,
                 "queue_confirm_time_max": 0,
+                "queue_confirm_time_p50": 0,
+                "queue_confirm_time_p99": 0,
+                "queue_confirm_time_p999": 0,
                 "queue_consumers_count": 0,
                 "queue_content_bytes": 0,
                 "queue_content_msgs": 0,
@@ -158,6 +173,9 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_put_msgs_abs": 0,
                 "queue_queue_time_avg": 0,
                 "queue_queue_time_max": 0,
+                "queue_queue_time_p50": 0,
+                "queue_queue_time_p99": 0,
+                "queue_queue_time_p999": 0,
                 "queue_reject_msgs": 0,
                 "queue_reject_msgs_abs": 0,
                 "queue_role": 0,
@@ -169,6 +187,9 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_ack_msgs_abs": 0,
                 "queue_ack_time_avg": 0,
                 "queue_ack_time_max": 0,
+                "queue_ack_time_p50": 0,
+                "queue_ack_time_p99": 0,
+                "queue_ack_time_p999": 0,
                 "queue_bytes_current": 0,
                 "queue_bytes_utilization_max": 0,
                 "queue_cfg_bytes": 0,
@@ -177,6 +198,9 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_confirm_msgs_abs": 0,
                 "queue_confirm_time_avg": 0,
                 "queue_confirm_time_max": 0,
+                "queue_confirm_time_p50": 0,
+                "queue_confirm_time_p99": 0,
+                "queue_confirm_time_p999": 0,
                 "queue_consumers_count": 0,
                 "queue_content_bytes": 0,
                 "queue_content_msgs": 0,
@@ -200,6 +224,9 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_put_msgs_abs": 0,
                 "queue_queue_time_avg": 0,
                 "queue_queue_time_max": 0,
+                "queue_queue_time_p50": 0,
+                "queue_queue_time_p99": 0,
+                "queue_queue_time_p999": 0,
                 "queue_reject_msgs": 0,
                 "queue_reject_msgs_abs": 0,
                 "queue_role": 0,
@@ -211,6 +238,9 @@ TEST_QUEUE_STATS_EMPTY = {
         "queue_ack_msgs_abs": 0,
         "queue_ack_time_avg": 0,
         "queue_ack_time_max": 0,
+        "queue_ack_time_p50": 0,
+        "queue_ack_time_p99": 0,
+        "queue_ack_time_p999": 0,
         "queue_bytes_current": 0,
         "queue_bytes_utilization_max": 0,
         "queue_cfg_bytes": 0,
@@ -219,6 +249,9 @@ TEST_QUEUE_STATS_EMPTY = {
         "queue_confirm_msgs_abs": 0,
         "queue_confirm_time_avg": 0,
         "queue_confirm_time_max": 0,
+        "queue_confirm_time_p50": 0,
+        "queue_confirm_time_p99": 0,
+        "queue_confirm_time_p999": 0,
         "queue_consumers_count": 0,
         "queue_content_bytes": 0,
         "queue_content_msgs": 0,
@@ -242,6 +275,9 @@ TEST_QUEUE_STATS_EMPTY = {
         "queue_put_msgs_abs": 0,
         "queue_queue_time_avg": 0,
         "queue_queue_time_max": 0,
+        "queue_queue_time_p50": 0,
+        "queue_queue_time_p99": 0,
+        "queue_queue_time_p999": 0,
         "queue_reject_msgs": 0,
         "queue_reject_msgs_abs": 0,
         "queue_role": 0,
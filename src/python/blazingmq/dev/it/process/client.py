@@ -27,7 +27,7 @@ import json
 import re
 import subprocess
 from pathlib import Path
-from typing import Any, Callable, Dict, Optional, List, NamedTuple
+from typing import Any, Callable, Dict, Optional, List, NamedTuple, Tuple, Union
 
 from blazingmq.dev.it.process import bmqproc
 from blazingmq.dev.it.process.bmqproc import BMQProcess
@@ -98,7 +98,7 @@ class Client(BMQProcess):
     def __init__(
         self,
         name,
-        broker: (str, int),
+        broker: Union[Tuple[str, int], str],
         tool_path: Path,
         options=None,
         dump_messages=True,
@@ -117,7 +117,9 @@ class Client(BMQProcess):
             [
                 str(tool_path),
                 "-b",
-                f"tcp://{broker[0]}:{broker[1]}",
+                broker
+                if isinstance(broker, str)
+                else f"tcp://{broker[0]}:{broker[1]}",
                 f'--logFormat="{bmqproc.PROC_LOG_FORMAT}"',
             ]
             + options,
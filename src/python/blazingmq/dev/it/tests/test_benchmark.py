@@ -0,0 +1,105 @@
+# Copyright 2026 Bloomberg Finance L.P.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import dataclasses
+
+from blazingmq.dev.it import benchmark
+
+
+def make_report(timeline, median=10, p99=20, p999=30, max_=40):
+    return {
+        "median": median,
+        "99percentile": p99,
+        "99.9percentile": p999,
+        "max": max_,
+        "dataPoints": {"10": sum(timeline)},
+        "timeline": [
+            {"interval": index, "count": count} for index, count in enumerate(timeline)
+        ],
+    }
+
+
+def test_rate():
+    assert benchmark.rate(make_report([])) == 0
+    assert benchmark.rate(make_report([0, 0])) == 0
+
+    # Idle intervals before the first and after the last value are ignored
+    assert benchmark.rate(make_report([0, 100, 0, 200, 0, 0])) == 100
+
+
+def test_summarize():
+    workload = benchmark.Workload(
+        name="fanout",
+        producer_uri="bmq://bmq.test.mmap.fanout/q",
+        consumer_uris=["foo", "bar"],
+        deliveries_per_message=2,
+        msg_size=1024,
+    )
+
+    result = benchmark.summarize(
+        workload,
+        make_report([50, 50]),
+        [make_report([100], p99=25), make_report([0, 50, 50], max_=60)],
+    )
+
+    assert result.messages == 100
+    assert result.deliveries == 200
+    assert result.produce_rate == 50
+    assert result.deliver_rate == 150
+    assert result.ack_p99 == 20
+    assert result.e2e_p99 == 25
+    assert result.e2e_max == 60
+
+
+def test_compare(tmp_path):
+    result = benchmark.BenchmarkResult(
+        name="priority",
+        msg_size=1024,
+        messages=100,
+        deliveries=100,
+        produce_rate=1000,
+        deliver_rate=1000,
+        ack_median=100,
+        ack_p99=200,
+        ack_p999=300,
+        e2e_median=100,
+        e2e_p99=200,
+        e2e_p999=300,
+        e2e_max=400,
+    )
+
+    path = tmp_path / "results.jsonl"
+    benchmark.append_result(path, dataclasses.replace(result, produce_rate=1))
+    benchmark.append_result(path, result)
+    baseline = benchmark.load_results(path)
+    assert baseline == {"priority": dataclasses.asdict(result)}
+
+    # Within tolerance
+    candidate = dataclasses.asdict(
+        dataclasses.replace(result, deliver_rate=950, e2e_p99=210)
+    )
+    assert benchmark.compare(baseline, {"priority": candidate}, 10) == []
+
+    # Regressions
+    candidate = dataclasses.asdict(
+        dataclasses.replace(result, deliver_rate=800, e2e_p99=250)
+    )
+    assert benchmark.compare(baseline, {"priority": candidate}, 10) == [
+        "priority: deliver_rate 1000 -> 800",
+        "priority: e2e_p99 200 -> 250",
+    ]
+
+    # Workloads missing from either results are ignored
+    assert benchmark.compare(baseline, {"fanout": candidate}, 10) == []
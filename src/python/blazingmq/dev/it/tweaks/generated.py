@@ -652,6 +652,16 @@ class TweakFactory:
 
                     listeners = Listeners()
 
+                    class IoRing(metaclass=TweakMetaclass):
+                        def __call__(self, value: bool) -> Callable: ...
+
+                    io_ring = IoRing()
+
+                    class ShmEndpoint(metaclass=TweakMetaclass):
+                        def __call__(self, value: str) -> Callable: ...
+
+                    shm_endpoint = ShmEndpoint()
+
                     def __call__(
                         self,
                         value: typing.Union[
@@ -753,6 +753,12 @@ class QueueOperationsConfig:
     ackWindowSize..............:
     number of PUTs without ACK requested after which we request an ACK.
     This is to remove pending broadcast PUTs.
+    assignmentBatchWindowMs....:
+    duration, in milliseconds, during which the leader accumulates
+    queue assignments before broadcasting them in a single advisory.
+    assignmentBatchMaxSize.....:
+    number of queue assignments after which the pending advisory is
+    broadcast without waiting for the end of the batching window.
     """
 
     open_timeout_ms: int = field(
@@ -863,6 +869,24 @@ class QueueOperationsConfig:
             "required": True,
         },
     )
+    assignment_batch_window_ms: int = field(
+        default=5,
+        metadata={
+            "name": "assignmentBatchWindowMs",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    assignment_batch_max_size: int = field(
+        default=512,
+        metadata={
+            "name": "assignmentBatchMaxSize",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -970,6 +994,9 @@ class StorageSyncConfig:
     partitionSyncEventSize.........:
     maximum size, in bytes, of bmqp::EventType::PARTITION_SYNC before
     we send it to the peer
+    maxFileChunksInFlight..........:
+    maximum number of file chunks written to the peer, and not yet
+    flushed by the channel, when serving a storage sync request from it
     """
 
     startup_recovery_max_duration_ms: int = field(
@@ -1053,6 +1080,15 @@ class StorageSyncConfig:
             "required": True,
         },
     )
+    max_file_chunks_in_flight: int = field(
+        default=16,
+        metadata={
+            "name": "maxFileChunksInFlight",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1429,6 +1465,12 @@ class PartitionConfig:
     storage files to disk at shutdown
     syncConfig...........: configuration for storage synchronization and
     recovery
+    groupSyncIntervalUs..: maximum time, in microseconds, during which
+    writes to the partition are accumulated before being synced to disk
+    together, or 0 to disable group sync
+    groupSyncBytes.......: number of bytes written to the partition after
+    which accumulated writes are synced to disk without waiting for
+    'groupSyncIntervalUs'
     """
 
     num_partitions: Optional[int] = field(
@@ -1537,6 +1579,24 @@ class PartitionConfig:
             "required": True,
         },
     )
+    group_sync_interval_us: int = field(
+        default=0,
+        metadata={
+            "name": "groupSyncIntervalUs",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    group_sync_bytes: int = field(
+        default=1048576,
+        metadata={
+            "name": "groupSyncBytes",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1591,6 +1651,23 @@ class StatPluginConfigPrometheus:
             "required": True,
         },
     )
+    aggregated_domains: List[str] = field(
+        default_factory=list,
+        metadata={
+            "name": "aggregatedDomains",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+        },
+    )
+    export_histograms: bool = field(
+        default=False,
+        metadata={
+            "name": "exportHistograms",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1669,6 +1746,17 @@ class TcpInterfaceConfig:
     listeners:
     A list of listener interfaces to receive TCP connections from. When non-empty
     this option overrides the listener specified by port.
+    ioRing...............:
+    When true, drive the sockets of this interface with the io_uring
+    proactor of the networking library instead of the default
+    reactor: receives complete directly into blob buffers and each
+    event blob is sent as a single gathered submission.  Linux only;
+    the broker fails to start if io_uring is not available.
+    shmEndpoint..........:
+    When non-empty, path of a Unix domain socket (optionally prefixed
+    with 'shm://') on which to also accept connections from clients
+    running on the same host, exchanging data through shared memory
+    rings instead of TCP.  Linux only.
     """
 
     name: Optional[str] = field(
@@ -1757,6 +1845,24 @@ class TcpInterfaceConfig:
             "namespace": "http://bloomberg.com/schemas/mqbcfg",
         },
     )
+    io_ring: bool = field(
+        default=False,
+        metadata={
+            "name": "ioRing",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    shm_endpoint: str = field(
+        default="",
+        metadata={
+            "name": "shmEndpoint",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1862,6 +1968,16 @@ class CredentialProviderConfig:
 
 @dataclass
 class DispatcherConfig:
+    """numaAware..:
+    When true and the host exposes more than one NUMA node, each
+    dispatcher processor thread is bound to a NUMA node (CPU affinity
+    and preferred memory policy), with the processors of each type
+    spread in contiguous blocks across the nodes.  Since partitions
+    are assigned to queue processors, the memory of a partition (its
+    mapped files and the objects allocated by its thread) becomes local
+    to the node of the thread serving it.
+    """
+
     sessions: Optional[DispatcherProcessorConfig] = field(
         default=None,
         metadata={
@@ -1904,6 +2020,15 @@ class DispatcherConfig:
             "required": True,
         },
     )
+    numa_aware: bool = field(
+        default=False,
+        metadata={
+            "name": "numaAware",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
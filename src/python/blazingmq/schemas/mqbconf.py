@@ -408,6 +408,13 @@ class Domain:
     PUTs.
     consistency.........: optional consistency mode.
     subscriptions.......: optional application subscriptions
+    priorityProperty....: name of the integer message property carrying
+    the delivery priority of a message.  Empty
+    (the default) means FIFO delivery.  Otherwise,
+    messages with a positive priority are
+    delivered ahead of the backlog of consumers
+    which are behind, in a small number of lanes
+    (higher values first)
     """
 
     name: Optional[str] = field(
@@ -521,6 +528,15 @@ class Domain:
             "min_occurs": 1,
         },
     )
+    priority_property: str = field(
+        default="",
+        metadata={
+            "name": "priorityProperty",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "required": True,
+        },
+    )
 
 
 @dataclass